@@ -0,0 +1,1413 @@
+
+_bigfilebench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+char buf[BUFSZ];
+char *name = "bigfile.tmp";
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 02 02 00 00       	mov    $0x202,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 19                	mov    (%ecx),%ebx
+  1b:	8b 71 04             	mov    0x4(%ecx),%esi
+  int fd, i, n, nchunk, mode;
+  uint start, elapsed;
+
+  mode = O_CREATE|O_RDWR;
+  if(argc > 1 && strcmp(argv[1], "-e") == 0){
+  1e:	83 fb 01             	cmp    $0x1,%ebx
+  21:	0f 8f 9f 00 00 00    	jg     c6 <main+0xc6>
+  n = 4096;
+  if(argc > 1)
+    n = atoi(argv[1]);
+  nchunk = n / (BUFSZ/1024);
+
+  unlink(name);
+  27:	83 ec 0c             	sub    $0xc,%esp
+  2a:	ff 35 bc 0d 00 00    	push   0xdbc
+  30:	e8 1e 05 00 00       	call   553 <unlink>
+  fd = open(name, mode);
+  35:	58                   	pop    %eax
+  36:	5a                   	pop    %edx
+  37:	57                   	push   %edi
+  38:	ff 35 bc 0d 00 00    	push   0xdbc
+  3e:	e8 00 05 00 00       	call   543 <open>
+  if(fd < 0){
+  43:	83 c4 10             	add    $0x10,%esp
+  fd = open(name, mode);
+  46:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+  48:	85 c0                	test   %eax,%eax
+  4a:	78 62                	js     ae <main+0xae>
+    printf(1, "bigfilebench: cannot create %s\n", name);
+    exit();
+  }
+  start = uptime();
+  4c:	e8 4a 05 00 00       	call   59b <uptime>
+  nchunk = n / (BUFSZ/1024);
+  51:	be 00 02 00 00       	mov    $0x200,%esi
+  start = uptime();
+  56:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  nchunk = n / (BUFSZ/1024);
+  59:	31 ff                	xor    %edi,%edi
+  5b:	eb 0e                	jmp    6b <main+0x6b>
+  5d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; i < nchunk; i++){
+  60:	83 c7 01             	add    $0x1,%edi
+  63:	39 f7                	cmp    %esi,%edi
+  65:	0f 8d 8b 00 00 00    	jge    f6 <main+0xf6>
+    memset(buf, i, BUFSZ);
+  6b:	83 ec 04             	sub    $0x4,%esp
+  6e:	68 00 20 00 00       	push   $0x2000
+  73:	57                   	push   %edi
+  74:	68 c0 0d 00 00       	push   $0xdc0
+  79:	e8 02 03 00 00       	call   380 <memset>
+    if(write(fd, buf, BUFSZ) != BUFSZ){
+  7e:	83 c4 0c             	add    $0xc,%esp
+  81:	68 00 20 00 00       	push   $0x2000
+  86:	68 c0 0d 00 00       	push   $0xdc0
+  8b:	53                   	push   %ebx
+  8c:	e8 92 04 00 00       	call   523 <write>
+  91:	83 c4 10             	add    $0x10,%esp
+  94:	3d 00 20 00 00       	cmp    $0x2000,%eax
+  99:	74 c5                	je     60 <main+0x60>
+      printf(1, "bigfilebench: write failed at chunk %d\n", i);
+  9b:	50                   	push   %eax
+  9c:	57                   	push   %edi
+  9d:	68 e8 09 00 00       	push   $0x9e8
+  a2:	6a 01                	push   $0x1
+  a4:	e8 c7 05 00 00       	call   670 <printf>
+      exit();
+  a9:	e8 55 04 00 00       	call   503 <exit>
+    printf(1, "bigfilebench: cannot create %s\n", name);
+  ae:	50                   	push   %eax
+  af:	ff 35 bc 0d 00 00    	push   0xdbc
+  b5:	68 c8 09 00 00       	push   $0x9c8
+  ba:	6a 01                	push   $0x1
+  bc:	e8 af 05 00 00       	call   670 <printf>
+    exit();
+  c1:	e8 3d 04 00 00       	call   503 <exit>
+  if(argc > 1 && strcmp(argv[1], "-e") == 0){
+  c6:	51                   	push   %ecx
+  c7:	51                   	push   %ecx
+  c8:	68 98 09 00 00       	push   $0x998
+  cd:	ff 76 04             	push   0x4(%esi)
+  d0:	e8 1b 02 00 00       	call   2f0 <strcmp>
+  d5:	83 c4 10             	add    $0x10,%esp
+  d8:	85 c0                	test   %eax,%eax
+  da:	0f 85 c3 00 00 00    	jne    1a3 <main+0x1a3>
+  if(argc > 1)
+  e0:	83 fb 02             	cmp    $0x2,%ebx
+  e3:	0f 84 93 01 00 00    	je     27c <main+0x27c>
+    argv++;
+  e9:	83 c6 04             	add    $0x4,%esi
+    mode |= O_EXTENT;
+  ec:	bb 02 06 00 00       	mov    $0x602,%ebx
+  f1:	e9 b2 00 00 00       	jmp    1a8 <main+0x1a8>
+    }
+  }
+  close(fd);
+  f6:	83 ec 0c             	sub    $0xc,%esp
+  f9:	53                   	push   %ebx
+  fa:	e8 2c 04 00 00       	call   52b <close>
+  elapsed = uptime() - start;
+  ff:	e8 97 04 00 00       	call   59b <uptime>
+ 104:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  printf(1, "bigfilebench: write %d KB in %d ticks\n", nchunk*(BUFSZ/1024), elapsed);
+ 107:	8d 14 f5 00 00 00 00 	lea    0x0(,%esi,8),%edx
+ 10e:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  elapsed = uptime() - start;
+ 111:	29 c8                	sub    %ecx,%eax
+  printf(1, "bigfilebench: write %d KB in %d ticks\n", nchunk*(BUFSZ/1024), elapsed);
+ 113:	50                   	push   %eax
+ 114:	52                   	push   %edx
+ 115:	68 10 0a 00 00       	push   $0xa10
+ 11a:	6a 01                	push   $0x1
+ 11c:	e8 4f 05 00 00       	call   670 <printf>
+
+  fd = open(name, O_RDONLY);
+ 121:	83 c4 18             	add    $0x18,%esp
+ 124:	6a 00                	push   $0x0
+ 126:	ff 35 bc 0d 00 00    	push   0xdbc
+ 12c:	e8 12 04 00 00       	call   543 <open>
+  if(fd < 0){
+ 131:	83 c4 10             	add    $0x10,%esp
+  fd = open(name, O_RDONLY);
+ 134:	89 c7                	mov    %eax,%edi
+  if(fd < 0){
+ 136:	85 c0                	test   %eax,%eax
+ 138:	0f 88 48 01 00 00    	js     286 <main+0x286>
+    printf(1, "bigfilebench: cannot open %s\n", name);
+    exit();
+  }
+  start = uptime();
+ 13e:	e8 58 04 00 00       	call   59b <uptime>
+  for(i = 0; i < nchunk; i++){
+ 143:	31 db                	xor    %ebx,%ebx
+  start = uptime();
+ 145:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < nchunk; i++){
+ 148:	eb 29                	jmp    173 <main+0x173>
+ 14a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(read(fd, buf, BUFSZ) != BUFSZ){
+      printf(1, "bigfilebench: read failed at chunk %d\n", i);
+      exit();
+    }
+    if(buf[0] != (char)i || buf[BUFSZ-1] != (char)i){
+ 150:	38 1d c0 0d 00 00    	cmp    %bl,0xdc0
+ 156:	0f 85 42 01 00 00    	jne    29e <main+0x29e>
+ 15c:	38 1d bf 2d 00 00    	cmp    %bl,0x2dbf
+ 162:	0f 85 36 01 00 00    	jne    29e <main+0x29e>
+  for(i = 0; i < nchunk; i++){
+ 168:	83 c3 01             	add    $0x1,%ebx
+ 16b:	39 f3                	cmp    %esi,%ebx
+ 16d:	0f 8d 3e 01 00 00    	jge    2b1 <main+0x2b1>
+    if(read(fd, buf, BUFSZ) != BUFSZ){
+ 173:	83 ec 04             	sub    $0x4,%esp
+ 176:	68 00 20 00 00       	push   $0x2000
+ 17b:	68 c0 0d 00 00       	push   $0xdc0
+ 180:	57                   	push   %edi
+ 181:	e8 95 03 00 00       	call   51b <read>
+ 186:	83 c4 10             	add    $0x10,%esp
+ 189:	3d 00 20 00 00       	cmp    $0x2000,%eax
+ 18e:	74 c0                	je     150 <main+0x150>
+      printf(1, "bigfilebench: read failed at chunk %d\n", i);
+ 190:	56                   	push   %esi
+ 191:	53                   	push   %ebx
+ 192:	68 38 0a 00 00       	push   $0xa38
+ 197:	6a 01                	push   $0x1
+ 199:	e8 d2 04 00 00       	call   670 <printf>
+      exit();
+ 19e:	e8 60 03 00 00       	call   503 <exit>
+  mode = O_CREATE|O_RDWR;
+ 1a3:	bb 02 02 00 00       	mov    $0x202,%ebx
+    n = atoi(argv[1]);
+ 1a8:	83 ec 0c             	sub    $0xc,%esp
+ 1ab:	ff 76 04             	push   0x4(%esi)
+ 1ae:	e8 dd 02 00 00       	call   490 <atoi>
+ 1b3:	89 c7                	mov    %eax,%edi
+  unlink(name);
+ 1b5:	58                   	pop    %eax
+ 1b6:	ff 35 bc 0d 00 00    	push   0xdbc
+ 1bc:	e8 92 03 00 00       	call   553 <unlink>
+  fd = open(name, mode);
+ 1c1:	58                   	pop    %eax
+ 1c2:	5a                   	pop    %edx
+ 1c3:	53                   	push   %ebx
+ 1c4:	ff 35 bc 0d 00 00    	push   0xdbc
+ 1ca:	e8 74 03 00 00       	call   543 <open>
+  if(fd < 0){
+ 1cf:	83 c4 10             	add    $0x10,%esp
+  fd = open(name, mode);
+ 1d2:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+ 1d4:	85 c0                	test   %eax,%eax
+ 1d6:	0f 88 d2 fe ff ff    	js     ae <main+0xae>
+  nchunk = n / (BUFSZ/1024);
+ 1dc:	89 f8                	mov    %edi,%eax
+ 1de:	b9 08 00 00 00       	mov    $0x8,%ecx
+ 1e3:	99                   	cltd
+ 1e4:	f7 f9                	idiv   %ecx
+ 1e6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 1e9:	89 c6                	mov    %eax,%esi
+  start = uptime();
+ 1eb:	e8 ab 03 00 00       	call   59b <uptime>
+ 1f0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < nchunk; i++){
+ 1f3:	83 ff 07             	cmp    $0x7,%edi
+ 1f6:	0f 8f 5d fe ff ff    	jg     59 <main+0x59>
+  close(fd);
+ 1fc:	83 ec 0c             	sub    $0xc,%esp
+ 1ff:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 202:	53                   	push   %ebx
+ 203:	e8 23 03 00 00       	call   52b <close>
+  elapsed = uptime() - start;
+ 208:	e8 8e 03 00 00       	call   59b <uptime>
+  printf(1, "bigfilebench: write %d KB in %d ticks\n", nchunk*(BUFSZ/1024), elapsed);
+ 20d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  elapsed = uptime() - start;
+ 210:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  printf(1, "bigfilebench: write %d KB in %d ticks\n", nchunk*(BUFSZ/1024), elapsed);
+ 213:	c1 e1 03             	shl    $0x3,%ecx
+  elapsed = uptime() - start;
+ 216:	29 d0                	sub    %edx,%eax
+  printf(1, "bigfilebench: write %d KB in %d ticks\n", nchunk*(BUFSZ/1024), elapsed);
+ 218:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 21b:	50                   	push   %eax
+ 21c:	51                   	push   %ecx
+ 21d:	68 10 0a 00 00       	push   $0xa10
+ 222:	6a 01                	push   $0x1
+ 224:	e8 47 04 00 00       	call   670 <printf>
+  fd = open(name, O_RDONLY);
+ 229:	83 c4 18             	add    $0x18,%esp
+ 22c:	6a 00                	push   $0x0
+ 22e:	ff 35 bc 0d 00 00    	push   0xdbc
+ 234:	e8 0a 03 00 00       	call   543 <open>
+  if(fd < 0){
+ 239:	83 c4 10             	add    $0x10,%esp
+  fd = open(name, O_RDONLY);
+ 23c:	89 c7                	mov    %eax,%edi
+  if(fd < 0){
+ 23e:	85 c0                	test   %eax,%eax
+ 240:	78 44                	js     286 <main+0x286>
+  start = uptime();
+ 242:	e8 54 03 00 00       	call   59b <uptime>
+ 247:	89 c6                	mov    %eax,%esi
+      printf(1, "bigfilebench: wrong data in chunk %d\n", i);
+      exit();
+    }
+  }
+  close(fd);
+ 249:	83 ec 0c             	sub    $0xc,%esp
+ 24c:	57                   	push   %edi
+ 24d:	e8 d9 02 00 00       	call   52b <close>
+  elapsed = uptime() - start;
+ 252:	e8 44 03 00 00       	call   59b <uptime>
+ 257:	29 f0                	sub    %esi,%eax
+  printf(1, "bigfilebench: read %d KB in %d ticks\n", nchunk*(BUFSZ/1024), elapsed);
+ 259:	50                   	push   %eax
+ 25a:	ff 75 e0             	push   -0x20(%ebp)
+ 25d:	68 88 0a 00 00       	push   $0xa88
+ 262:	6a 01                	push   $0x1
+ 264:	e8 07 04 00 00       	call   670 <printf>
+
+  unlink(name);
+ 269:	83 c4 14             	add    $0x14,%esp
+ 26c:	ff 35 bc 0d 00 00    	push   0xdbc
+ 272:	e8 dc 02 00 00       	call   553 <unlink>
+  exit();
+ 277:	e8 87 02 00 00       	call   503 <exit>
+    mode |= O_EXTENT;
+ 27c:	bf 02 06 00 00       	mov    $0x602,%edi
+ 281:	e9 a1 fd ff ff       	jmp    27 <main+0x27>
+    printf(1, "bigfilebench: cannot open %s\n", name);
+ 286:	57                   	push   %edi
+ 287:	ff 35 bc 0d 00 00    	push   0xdbc
+ 28d:	68 9b 09 00 00       	push   $0x99b
+ 292:	6a 01                	push   $0x1
+ 294:	e8 d7 03 00 00       	call   670 <printf>
+    exit();
+ 299:	e8 65 02 00 00       	call   503 <exit>
+      printf(1, "bigfilebench: wrong data in chunk %d\n", i);
+ 29e:	51                   	push   %ecx
+ 29f:	53                   	push   %ebx
+ 2a0:	68 60 0a 00 00       	push   $0xa60
+ 2a5:	6a 01                	push   $0x1
+ 2a7:	e8 c4 03 00 00       	call   670 <printf>
+      exit();
+ 2ac:	e8 52 02 00 00       	call   503 <exit>
+  start = uptime();
+ 2b1:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 2b4:	eb 93                	jmp    249 <main+0x249>
+ 2b6:	66 90                	xchg   %ax,%ax
+ 2b8:	66 90                	xchg   %ax,%ax
+ 2ba:	66 90                	xchg   %ax,%ax
+ 2bc:	66 90                	xchg   %ax,%ax
+ 2be:	66 90                	xchg   %ax,%ax
+
+000002c0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 2c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2c1:	31 c0                	xor    %eax,%eax
+{
+ 2c3:	89 e5                	mov    %esp,%ebp
+ 2c5:	53                   	push   %ebx
+ 2c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 2cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 2d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 2d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 2d7:	83 c0 01             	add    $0x1,%eax
+ 2da:	84 d2                	test   %dl,%dl
+ 2dc:	75 f2                	jne    2d0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 2de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2e1:	89 c8                	mov    %ecx,%eax
+ 2e3:	c9                   	leave
+ 2e4:	c3                   	ret
+ 2e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	53                   	push   %ebx
+ 2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2fa:	0f b6 02             	movzbl (%edx),%eax
+ 2fd:	84 c0                	test   %al,%al
+ 2ff:	75 17                	jne    318 <strcmp+0x28>
+ 301:	eb 3a                	jmp    33d <strcmp+0x4d>
+ 303:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 307:	90                   	nop
+ 308:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 30c:	83 c2 01             	add    $0x1,%edx
+ 30f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 312:	84 c0                	test   %al,%al
+ 314:	74 1a                	je     330 <strcmp+0x40>
+    p++, q++;
+ 316:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 318:	0f b6 19             	movzbl (%ecx),%ebx
+ 31b:	38 c3                	cmp    %al,%bl
+ 31d:	74 e9                	je     308 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 31f:	29 d8                	sub    %ebx,%eax
+}
+ 321:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 324:	c9                   	leave
+ 325:	c3                   	ret
+ 326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 330:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 334:	31 c0                	xor    %eax,%eax
+ 336:	29 d8                	sub    %ebx,%eax
+}
+ 338:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 33b:	c9                   	leave
+ 33c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 33d:	0f b6 19             	movzbl (%ecx),%ebx
+ 340:	31 c0                	xor    %eax,%eax
+ 342:	eb db                	jmp    31f <strcmp+0x2f>
+ 344:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+
+00000350 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 356:	80 3a 00             	cmpb   $0x0,(%edx)
+ 359:	74 15                	je     370 <strlen+0x20>
+ 35b:	31 c0                	xor    %eax,%eax
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+ 360:	83 c0 01             	add    $0x1,%eax
+ 363:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 367:	89 c1                	mov    %eax,%ecx
+ 369:	75 f5                	jne    360 <strlen+0x10>
+    ;
+  return n;
+}
+ 36b:	89 c8                	mov    %ecx,%eax
+ 36d:	5d                   	pop    %ebp
+ 36e:	c3                   	ret
+ 36f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 370:	31 c9                	xor    %ecx,%ecx
+}
+ 372:	5d                   	pop    %ebp
+ 373:	89 c8                	mov    %ecx,%eax
+ 375:	c3                   	ret
+ 376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000380 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	57                   	push   %edi
+ 384:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 387:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 38a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 38d:	89 d7                	mov    %edx,%edi
+ 38f:	fc                   	cld
+ 390:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 392:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 395:	89 d0                	mov    %edx,%eax
+ 397:	c9                   	leave
+ 398:	c3                   	ret
+ 399:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3aa:	0f b6 10             	movzbl (%eax),%edx
+ 3ad:	84 d2                	test   %dl,%dl
+ 3af:	75 12                	jne    3c3 <strchr+0x23>
+ 3b1:	eb 1d                	jmp    3d0 <strchr+0x30>
+ 3b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3b7:	90                   	nop
+ 3b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3bc:	83 c0 01             	add    $0x1,%eax
+ 3bf:	84 d2                	test   %dl,%dl
+ 3c1:	74 0d                	je     3d0 <strchr+0x30>
+    if(*s == c)
+ 3c3:	38 d1                	cmp    %dl,%cl
+ 3c5:	75 f1                	jne    3b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3c7:	5d                   	pop    %ebp
+ 3c8:	c3                   	ret
+ 3c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 3d0:	31 c0                	xor    %eax,%eax
+}
+ 3d2:	5d                   	pop    %ebp
+ 3d3:	c3                   	ret
+ 3d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3df:	90                   	nop
+
+000003e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	57                   	push   %edi
+ 3e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 3e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 3e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 3e9:	31 db                	xor    %ebx,%ebx
+{
+ 3eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 3ee:	eb 27                	jmp    417 <gets+0x37>
+    cc = read(0, &c, 1);
+ 3f0:	83 ec 04             	sub    $0x4,%esp
+ 3f3:	6a 01                	push   $0x1
+ 3f5:	56                   	push   %esi
+ 3f6:	6a 00                	push   $0x0
+ 3f8:	e8 1e 01 00 00       	call   51b <read>
+    if(cc < 1)
+ 3fd:	83 c4 10             	add    $0x10,%esp
+ 400:	85 c0                	test   %eax,%eax
+ 402:	7e 1d                	jle    421 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 404:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 408:	8b 55 08             	mov    0x8(%ebp),%edx
+ 40b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 40f:	3c 0a                	cmp    $0xa,%al
+ 411:	74 10                	je     423 <gets+0x43>
+ 413:	3c 0d                	cmp    $0xd,%al
+ 415:	74 0c                	je     423 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 417:	89 df                	mov    %ebx,%edi
+ 419:	83 c3 01             	add    $0x1,%ebx
+ 41c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 41f:	7c cf                	jl     3f0 <gets+0x10>
+ 421:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 423:	8b 45 08             	mov    0x8(%ebp),%eax
+ 426:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 42a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 42d:	5b                   	pop    %ebx
+ 42e:	5e                   	pop    %esi
+ 42f:	5f                   	pop    %edi
+ 430:	5d                   	pop    %ebp
+ 431:	c3                   	ret
+ 432:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 439:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000440 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	56                   	push   %esi
+ 444:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 445:	83 ec 08             	sub    $0x8,%esp
+ 448:	6a 00                	push   $0x0
+ 44a:	ff 75 08             	push   0x8(%ebp)
+ 44d:	e8 f1 00 00 00       	call   543 <open>
+  if(fd < 0)
+ 452:	83 c4 10             	add    $0x10,%esp
+ 455:	85 c0                	test   %eax,%eax
+ 457:	78 27                	js     480 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 459:	83 ec 08             	sub    $0x8,%esp
+ 45c:	ff 75 0c             	push   0xc(%ebp)
+ 45f:	89 c3                	mov    %eax,%ebx
+ 461:	50                   	push   %eax
+ 462:	e8 f4 00 00 00       	call   55b <fstat>
+  close(fd);
+ 467:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 46a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 46c:	e8 ba 00 00 00       	call   52b <close>
+  return r;
+ 471:	83 c4 10             	add    $0x10,%esp
+}
+ 474:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 477:	89 f0                	mov    %esi,%eax
+ 479:	5b                   	pop    %ebx
+ 47a:	5e                   	pop    %esi
+ 47b:	5d                   	pop    %ebp
+ 47c:	c3                   	ret
+ 47d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 480:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 485:	eb ed                	jmp    474 <stat+0x34>
+ 487:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48e:	66 90                	xchg   %ax,%ax
+
+00000490 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	53                   	push   %ebx
+ 494:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 497:	0f be 02             	movsbl (%edx),%eax
+ 49a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 49d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 4a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 4a5:	77 1e                	ja     4c5 <atoi+0x35>
+ 4a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4b0:	83 c2 01             	add    $0x1,%edx
+ 4b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 4b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 4ba:	0f be 02             	movsbl (%edx),%eax
+ 4bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 4c0:	80 fb 09             	cmp    $0x9,%bl
+ 4c3:	76 eb                	jbe    4b0 <atoi+0x20>
+  return n;
+}
+ 4c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4c8:	89 c8                	mov    %ecx,%eax
+ 4ca:	c9                   	leave
+ 4cb:	c3                   	ret
+ 4cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004d0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	57                   	push   %edi
+ 4d4:	56                   	push   %esi
+ 4d5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4de:	85 c0                	test   %eax,%eax
+ 4e0:	7e 13                	jle    4f5 <memmove+0x25>
+ 4e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4e4:	89 d7                	mov    %edx,%edi
+ 4e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4f1:	39 f8                	cmp    %edi,%eax
+ 4f3:	75 fb                	jne    4f0 <memmove+0x20>
+  return vdst;
+}
+ 4f5:	5e                   	pop    %esi
+ 4f6:	89 d0                	mov    %edx,%eax
+ 4f8:	5f                   	pop    %edi
+ 4f9:	5d                   	pop    %ebp
+ 4fa:	c3                   	ret
+
+000004fb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4fb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <exit>:
+SYSCALL(exit)
+ 503:	b8 02 00 00 00       	mov    $0x2,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <wait>:
+SYSCALL(wait)
+ 50b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <pipe>:
+SYSCALL(pipe)
+ 513:	b8 04 00 00 00       	mov    $0x4,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <read>:
+SYSCALL(read)
+ 51b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <write>:
+SYSCALL(write)
+ 523:	b8 10 00 00 00       	mov    $0x10,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <close>:
+SYSCALL(close)
+ 52b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <kill>:
+SYSCALL(kill)
+ 533:	b8 06 00 00 00       	mov    $0x6,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <exec>:
+SYSCALL(exec)
+ 53b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <open>:
+SYSCALL(open)
+ 543:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <mknod>:
+SYSCALL(mknod)
+ 54b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <unlink>:
+SYSCALL(unlink)
+ 553:	b8 12 00 00 00       	mov    $0x12,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <fstat>:
+SYSCALL(fstat)
+ 55b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <link>:
+SYSCALL(link)
+ 563:	b8 13 00 00 00       	mov    $0x13,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <mkdir>:
+SYSCALL(mkdir)
+ 56b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <chdir>:
+SYSCALL(chdir)
+ 573:	b8 09 00 00 00       	mov    $0x9,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <dup>:
+SYSCALL(dup)
+ 57b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <getpid>:
+SYSCALL(getpid)
+ 583:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <sbrk>:
+SYSCALL(sbrk)
+ 58b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <sleep>:
+SYSCALL(sleep)
+ 593:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <uptime>:
+SYSCALL(uptime)
+ 59b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <getpstat>:
+SYSCALL(getpstat)
+ 5a3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <pipesize>:
+SYSCALL(pipesize)
+ 5ab:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <splice>:
+SYSCALL(splice)
+ 5b3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <copyrange>:
+SYSCALL(copyrange)
+ 5bb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+ 5c3:	66 90                	xchg   %ax,%ax
+ 5c5:	66 90                	xchg   %ax,%ax
+ 5c7:	66 90                	xchg   %ax,%ax
+ 5c9:	66 90                	xchg   %ax,%ax
+ 5cb:	66 90                	xchg   %ax,%ax
+ 5cd:	66 90                	xchg   %ax,%ax
+ 5cf:	90                   	nop
+
+000005d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	57                   	push   %edi
+ 5d4:	56                   	push   %esi
+ 5d5:	53                   	push   %ebx
+ 5d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5d8:	89 d1                	mov    %edx,%ecx
+{
+ 5da:	83 ec 3c             	sub    $0x3c,%esp
+ 5dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5e0:	85 d2                	test   %edx,%edx
+ 5e2:	0f 89 80 00 00 00    	jns    668 <printint+0x98>
+ 5e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5ec:	74 7a                	je     668 <printint+0x98>
+    x = -xx;
+ 5ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5f8:	31 f6                	xor    %esi,%esi
+ 5fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 600:	89 c8                	mov    %ecx,%eax
+ 602:	31 d2                	xor    %edx,%edx
+ 604:	89 f7                	mov    %esi,%edi
+ 606:	f7 f3                	div    %ebx
+ 608:	8d 76 01             	lea    0x1(%esi),%esi
+ 60b:	0f b6 92 10 0b 00 00 	movzbl 0xb10(%edx),%edx
+ 612:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 616:	89 ca                	mov    %ecx,%edx
+ 618:	89 c1                	mov    %eax,%ecx
+ 61a:	39 da                	cmp    %ebx,%edx
+ 61c:	73 e2                	jae    600 <printint+0x30>
+  if(neg)
+ 61e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 621:	85 c0                	test   %eax,%eax
+ 623:	74 07                	je     62c <printint+0x5c>
+    buf[i++] = '-';
+ 625:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 62a:	89 f7                	mov    %esi,%edi
+ 62c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 62f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 632:	01 df                	add    %ebx,%edi
+ 634:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 638:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 63b:	83 ec 04             	sub    $0x4,%esp
+ 63e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 641:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 644:	6a 01                	push   $0x1
+ 646:	50                   	push   %eax
+ 647:	56                   	push   %esi
+ 648:	e8 d6 fe ff ff       	call   523 <write>
+  while(--i >= 0)
+ 64d:	89 f8                	mov    %edi,%eax
+ 64f:	83 c4 10             	add    $0x10,%esp
+ 652:	83 ef 01             	sub    $0x1,%edi
+ 655:	39 d8                	cmp    %ebx,%eax
+ 657:	75 df                	jne    638 <printint+0x68>
+}
+ 659:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 65c:	5b                   	pop    %ebx
+ 65d:	5e                   	pop    %esi
+ 65e:	5f                   	pop    %edi
+ 65f:	5d                   	pop    %ebp
+ 660:	c3                   	ret
+ 661:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 668:	31 c0                	xor    %eax,%eax
+ 66a:	eb 89                	jmp    5f5 <printint+0x25>
+ 66c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000670 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 670:	55                   	push   %ebp
+ 671:	89 e5                	mov    %esp,%ebp
+ 673:	57                   	push   %edi
+ 674:	56                   	push   %esi
+ 675:	53                   	push   %ebx
+ 676:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 679:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 67c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 67f:	0f b6 1e             	movzbl (%esi),%ebx
+ 682:	83 c6 01             	add    $0x1,%esi
+ 685:	84 db                	test   %bl,%bl
+ 687:	74 67                	je     6f0 <printf+0x80>
+ 689:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 68c:	31 d2                	xor    %edx,%edx
+ 68e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 691:	eb 34                	jmp    6c7 <printf+0x57>
+ 693:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 697:	90                   	nop
+ 698:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 69b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 6a0:	83 f8 25             	cmp    $0x25,%eax
+ 6a3:	74 18                	je     6bd <printf+0x4d>
+  write(fd, &c, 1);
+ 6a5:	83 ec 04             	sub    $0x4,%esp
+ 6a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6ae:	6a 01                	push   $0x1
+ 6b0:	50                   	push   %eax
+ 6b1:	57                   	push   %edi
+ 6b2:	e8 6c fe ff ff       	call   523 <write>
+ 6b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 6ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 6bd:	0f b6 1e             	movzbl (%esi),%ebx
+ 6c0:	83 c6 01             	add    $0x1,%esi
+ 6c3:	84 db                	test   %bl,%bl
+ 6c5:	74 29                	je     6f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6ca:	85 d2                	test   %edx,%edx
+ 6cc:	74 ca                	je     698 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6ce:	83 fa 25             	cmp    $0x25,%edx
+ 6d1:	75 ea                	jne    6bd <printf+0x4d>
+      if(c == 'd'){
+ 6d3:	83 f8 25             	cmp    $0x25,%eax
+ 6d6:	0f 84 24 01 00 00    	je     800 <printf+0x190>
+ 6dc:	83 e8 63             	sub    $0x63,%eax
+ 6df:	83 f8 15             	cmp    $0x15,%eax
+ 6e2:	77 1c                	ja     700 <printf+0x90>
+ 6e4:	ff 24 85 b8 0a 00 00 	jmp    *0xab8(,%eax,4)
+ 6eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6f3:	5b                   	pop    %ebx
+ 6f4:	5e                   	pop    %esi
+ 6f5:	5f                   	pop    %edi
+ 6f6:	5d                   	pop    %ebp
+ 6f7:	c3                   	ret
+ 6f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ff:	90                   	nop
+  write(fd, &c, 1);
+ 700:	83 ec 04             	sub    $0x4,%esp
+ 703:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 706:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 70a:	6a 01                	push   $0x1
+ 70c:	52                   	push   %edx
+ 70d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 710:	57                   	push   %edi
+ 711:	e8 0d fe ff ff       	call   523 <write>
+ 716:	83 c4 0c             	add    $0xc,%esp
+ 719:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 71c:	6a 01                	push   $0x1
+ 71e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 721:	52                   	push   %edx
+ 722:	57                   	push   %edi
+ 723:	e8 fb fd ff ff       	call   523 <write>
+        putc(fd, c);
+ 728:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 72b:	31 d2                	xor    %edx,%edx
+ 72d:	eb 8e                	jmp    6bd <printf+0x4d>
+ 72f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 730:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 733:	83 ec 0c             	sub    $0xc,%esp
+ 736:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 73b:	8b 13                	mov    (%ebx),%edx
+ 73d:	6a 00                	push   $0x0
+ 73f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 741:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 744:	e8 87 fe ff ff       	call   5d0 <printint>
+        ap++;
+ 749:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 74c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 74f:	31 d2                	xor    %edx,%edx
+ 751:	e9 67 ff ff ff       	jmp    6bd <printf+0x4d>
+ 756:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 75d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 760:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 763:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 765:	83 c0 04             	add    $0x4,%eax
+ 768:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 76b:	85 db                	test   %ebx,%ebx
+ 76d:	0f 84 9d 00 00 00    	je     810 <printf+0x1a0>
+        while(*s != 0){
+ 773:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 776:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 778:	84 c0                	test   %al,%al
+ 77a:	0f 84 3d ff ff ff    	je     6bd <printf+0x4d>
+ 780:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 783:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 786:	89 de                	mov    %ebx,%esi
+ 788:	89 d3                	mov    %edx,%ebx
+ 78a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 790:	83 ec 04             	sub    $0x4,%esp
+ 793:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 796:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 799:	6a 01                	push   $0x1
+ 79b:	53                   	push   %ebx
+ 79c:	57                   	push   %edi
+ 79d:	e8 81 fd ff ff       	call   523 <write>
+        while(*s != 0){
+ 7a2:	0f b6 06             	movzbl (%esi),%eax
+ 7a5:	83 c4 10             	add    $0x10,%esp
+ 7a8:	84 c0                	test   %al,%al
+ 7aa:	75 e4                	jne    790 <printf+0x120>
+      state = 0;
+ 7ac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 7af:	31 d2                	xor    %edx,%edx
+ 7b1:	e9 07 ff ff ff       	jmp    6bd <printf+0x4d>
+ 7b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7bd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7c3:	83 ec 0c             	sub    $0xc,%esp
+ 7c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7cb:	8b 13                	mov    (%ebx),%edx
+ 7cd:	6a 01                	push   $0x1
+ 7cf:	e9 6b ff ff ff       	jmp    73f <printf+0xcf>
+ 7d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7d8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7db:	83 ec 04             	sub    $0x4,%esp
+ 7de:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7e1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7e3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7e6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7e9:	6a 01                	push   $0x1
+ 7eb:	52                   	push   %edx
+ 7ec:	57                   	push   %edi
+ 7ed:	e8 31 fd ff ff       	call   523 <write>
+        ap++;
+ 7f2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7f5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7f8:	31 d2                	xor    %edx,%edx
+ 7fa:	e9 be fe ff ff       	jmp    6bd <printf+0x4d>
+ 7ff:	90                   	nop
+  write(fd, &c, 1);
+ 800:	83 ec 04             	sub    $0x4,%esp
+ 803:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 806:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 809:	6a 01                	push   $0x1
+ 80b:	e9 11 ff ff ff       	jmp    721 <printf+0xb1>
+ 810:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 815:	bb ae 0a 00 00       	mov    $0xaae,%ebx
+ 81a:	e9 61 ff ff ff       	jmp    780 <printf+0x110>
+ 81f:	90                   	nop
+
+00000820 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 820:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 821:	a1 c0 2d 00 00       	mov    0x2dc0,%eax
+{
+ 826:	89 e5                	mov    %esp,%ebp
+ 828:	57                   	push   %edi
+ 829:	56                   	push   %esi
+ 82a:	53                   	push   %ebx
+ 82b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 82e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 831:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 838:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 83a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 83c:	39 ca                	cmp    %ecx,%edx
+ 83e:	73 30                	jae    870 <free+0x50>
+ 840:	39 c1                	cmp    %eax,%ecx
+ 842:	72 04                	jb     848 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 844:	39 c2                	cmp    %eax,%edx
+ 846:	72 f0                	jb     838 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 848:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 84b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 84e:	39 f8                	cmp    %edi,%eax
+ 850:	74 2e                	je     880 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 852:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 855:	8b 42 04             	mov    0x4(%edx),%eax
+ 858:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 85b:	39 f1                	cmp    %esi,%ecx
+ 85d:	74 38                	je     897 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 85f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 861:	5b                   	pop    %ebx
+  freep = p;
+ 862:	89 15 c0 2d 00 00    	mov    %edx,0x2dc0
+}
+ 868:	5e                   	pop    %esi
+ 869:	5f                   	pop    %edi
+ 86a:	5d                   	pop    %ebp
+ 86b:	c3                   	ret
+ 86c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 870:	39 c1                	cmp    %eax,%ecx
+ 872:	72 d0                	jb     844 <free+0x24>
+ 874:	eb c2                	jmp    838 <free+0x18>
+ 876:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 87d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 880:	03 70 04             	add    0x4(%eax),%esi
+ 883:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 886:	8b 02                	mov    (%edx),%eax
+ 888:	8b 00                	mov    (%eax),%eax
+ 88a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 88d:	8b 42 04             	mov    0x4(%edx),%eax
+ 890:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 893:	39 f1                	cmp    %esi,%ecx
+ 895:	75 c8                	jne    85f <free+0x3f>
+    p->s.size += bp->s.size;
+ 897:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 89a:	89 15 c0 2d 00 00    	mov    %edx,0x2dc0
+    p->s.size += bp->s.size;
+ 8a0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8a3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 8a6:	89 0a                	mov    %ecx,(%edx)
+}
+ 8a8:	5b                   	pop    %ebx
+ 8a9:	5e                   	pop    %esi
+ 8aa:	5f                   	pop    %edi
+ 8ab:	5d                   	pop    %ebp
+ 8ac:	c3                   	ret
+ 8ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008b0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	57                   	push   %edi
+ 8b4:	56                   	push   %esi
+ 8b5:	53                   	push   %ebx
+ 8b6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 8bc:	8b 15 c0 2d 00 00    	mov    0x2dc0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8c2:	8d 78 07             	lea    0x7(%eax),%edi
+ 8c5:	c1 ef 03             	shr    $0x3,%edi
+ 8c8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 8cb:	85 d2                	test   %edx,%edx
+ 8cd:	0f 84 8d 00 00 00    	je     960 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8d3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8d5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8d8:	39 f9                	cmp    %edi,%ecx
+ 8da:	73 64                	jae    940 <malloc+0x90>
+  if(nu < 4096)
+ 8dc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 8e1:	39 df                	cmp    %ebx,%edi
+ 8e3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 8e6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 8ed:	eb 0a                	jmp    8f9 <malloc+0x49>
+ 8ef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8f0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8f2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8f5:	39 f9                	cmp    %edi,%ecx
+ 8f7:	73 47                	jae    940 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 8f9:	89 c2                	mov    %eax,%edx
+ 8fb:	39 05 c0 2d 00 00    	cmp    %eax,0x2dc0
+ 901:	75 ed                	jne    8f0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 903:	83 ec 0c             	sub    $0xc,%esp
+ 906:	56                   	push   %esi
+ 907:	e8 7f fc ff ff       	call   58b <sbrk>
+  if(p == (char*)-1)
+ 90c:	83 c4 10             	add    $0x10,%esp
+ 90f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 912:	74 1c                	je     930 <malloc+0x80>
+  hp->s.size = nu;
+ 914:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 917:	83 ec 0c             	sub    $0xc,%esp
+ 91a:	83 c0 08             	add    $0x8,%eax
+ 91d:	50                   	push   %eax
+ 91e:	e8 fd fe ff ff       	call   820 <free>
+  return freep;
+ 923:	8b 15 c0 2d 00 00    	mov    0x2dc0,%edx
+      if((p = morecore(nunits)) == 0)
+ 929:	83 c4 10             	add    $0x10,%esp
+ 92c:	85 d2                	test   %edx,%edx
+ 92e:	75 c0                	jne    8f0 <malloc+0x40>
+        return 0;
+  }
+}
+ 930:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 933:	31 c0                	xor    %eax,%eax
+}
+ 935:	5b                   	pop    %ebx
+ 936:	5e                   	pop    %esi
+ 937:	5f                   	pop    %edi
+ 938:	5d                   	pop    %ebp
+ 939:	c3                   	ret
+ 93a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 940:	39 cf                	cmp    %ecx,%edi
+ 942:	74 4c                	je     990 <malloc+0xe0>
+        p->s.size -= nunits;
+ 944:	29 f9                	sub    %edi,%ecx
+ 946:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 949:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 94c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 94f:	89 15 c0 2d 00 00    	mov    %edx,0x2dc0
+}
+ 955:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 958:	83 c0 08             	add    $0x8,%eax
+}
+ 95b:	5b                   	pop    %ebx
+ 95c:	5e                   	pop    %esi
+ 95d:	5f                   	pop    %edi
+ 95e:	5d                   	pop    %ebp
+ 95f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 960:	c7 05 c0 2d 00 00 c4 	movl   $0x2dc4,0x2dc0
+ 967:	2d 00 00 
+    base.s.size = 0;
+ 96a:	b8 c4 2d 00 00       	mov    $0x2dc4,%eax
+    base.s.ptr = freep = prevp = &base;
+ 96f:	c7 05 c4 2d 00 00 c4 	movl   $0x2dc4,0x2dc4
+ 976:	2d 00 00 
+    base.s.size = 0;
+ 979:	c7 05 c8 2d 00 00 00 	movl   $0x0,0x2dc8
+ 980:	00 00 00 
+    if(p->s.size >= nunits){
+ 983:	e9 54 ff ff ff       	jmp    8dc <malloc+0x2c>
+ 988:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 98f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 990:	8b 08                	mov    (%eax),%ecx
+ 992:	89 0a                	mov    %ecx,(%edx)
+ 994:	eb b9                	jmp    94f <malloc+0x9f>
@@ -0,0 +1,74 @@
+// Measure sequential write and read throughput of one large file.
+// bigfilebench [kbytes] writes a file of the given size (default
+// 4096 KB, well into the doubly-indirect blocks) in BUFSZ chunks,
+// reads it back and checks it, then removes it.  With -e the
+// file is extent-mapped.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define BUFSZ 8192
+
+char buf[BUFSZ];
+char *name = "bigfile.tmp";
+
+int
+main(int argc, char *argv[])
+{
+  int fd, i, n, nchunk, mode;
+  uint start, elapsed;
+
+  mode = O_CREATE|O_RDWR;
+  if(argc > 1 && strcmp(argv[1], "-e") == 0){
+    mode |= O_EXTENT;
+    argc--;
+    argv++;
+  }
+  n = 4096;
+  if(argc > 1)
+    n = atoi(argv[1]);
+  nchunk = n / (BUFSZ/1024);
+
+  unlink(name);
+  fd = open(name, mode);
+  if(fd < 0){
+    printf(1, "bigfilebench: cannot create %s\n", name);
+    exit();
+  }
+  start = uptime();
+  for(i = 0; i < nchunk; i++){
+    memset(buf, i, BUFSZ);
+    if(write(fd, buf, BUFSZ) != BUFSZ){
+      printf(1, "bigfilebench: write failed at chunk %d\n", i);
+      exit();
+    }
+  }
+  close(fd);
+  elapsed = uptime() - start;
+  printf(1, "bigfilebench: write %d KB in %d ticks\n", nchunk*(BUFSZ/1024), elapsed);
+
+  fd = open(name, O_RDONLY);
+  if(fd < 0){
+    printf(1, "bigfilebench: cannot open %s\n", name);
+    exit();
+  }
+  start = uptime();
+  for(i = 0; i < nchunk; i++){
+    if(read(fd, buf, BUFSZ) != BUFSZ){
+      printf(1, "bigfilebench: read failed at chunk %d\n", i);
+      exit();
+    }
+    if(buf[0] != (char)i || buf[BUFSZ-1] != (char)i){
+      printf(1, "bigfilebench: wrong data in chunk %d\n", i);
+      exit();
+    }
+  }
+  close(fd);
+  elapsed = uptime() - start;
+  printf(1, "bigfilebench: read %d KB in %d ticks\n", nchunk*(BUFSZ/1024), elapsed);
+
+  unlink(name);
+  exit();
+}
@@ -1,12 +1,13 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
 //
 // Interface:
 // * To get a buffer for a particular disk block, call bread.
+// * To overwrite all of a block, call bclaim, which skips the read.
 // * After changing buffer data, call bwrite to write it to disk.
 // * When done with the buffer, call brelse.
 // * Do not use the buffer after calling brelse.
@@ -17,6 +18,14 @@
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+//
+// Buffers are hashed by (dev, blockno) into NBUCKET buckets, a
+// number that grows with NBUF.  Each bucket has its own lock and
+// its own LRU list, so lookups of different blocks rarely contend
+// and cost only a walk of one short bucket.  A miss recycles the
+// least recently used free buffer of its own bucket, or else
+// steals one from another bucket.  No code path holds two bucket
+// locks at once.
 
 #include "types.h"
 #include "defs.h"
@@ -26,33 +35,120 @@
 #include "fs.h"
 #include "buf.h"
 
-struct {
-  struct spinlock lock;
-  struct buf buf[NBUF];
+// About 4 buffers per bucket, however big NBUF is.  An odd
+// count spreads the blocks of strided access patterns evenly.
+#define NBUCKET ((NBUF/4) | 1)
 
-  // Linked list of all buffers, through prev/next.
+struct bucket {
+  struct spinlock lock;
+  // Linked list of buffers in this bucket, through prev/next.
   // head.next is most recently used.
   struct buf head;
+};
+
+struct {
+  struct buf buf[NBUF];
+  struct bucket bucket[NBUCKET];
 } bcache;
 
+static struct bucket*
+bhash(uint dev, uint blockno)
+{
+  return &bcache.bucket[((dev << 16) ^ blockno) % NBUCKET];
+}
+
+// Insert b into bk's list as most recently used.
+// Caller must hold bk->lock.
+static void
+binsert(struct bucket *bk, struct buf *b)
+{
+  b->next = bk->head.next;
+  b->prev = &bk->head;
+  bk->head.next->prev = b;
+  bk->head.next = b;
+}
+
+static void
+bunlink(struct buf *b)
+{
+  b->next->prev = b->prev;
+  b->prev->next = b->next;
+}
+
 void
 binit(void)
 {
   struct buf *b;
+  struct bucket *bk;
+  int i;
 
-  initlock(&bcache.lock, "bcache");
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++){
+    initlock(&bk->lock, "bcache");
+    bk->head.prev = &bk->head;
+    bk->head.next = &bk->head;
+  }
 
 //PAGEBREAK!
-  // Create linked list of buffers
-  bcache.head.prev = &bcache.head;
-  bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
+  // Spread the buffers over the buckets.
+  for(i = 0, b = bcache.buf; b < bcache.buf+NBUF; i++, b++){
     initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+    binsert(&bcache.bucket[i % NBUCKET], b);
+  }
+}
+
+// Return the cached buffer for block on device dev in bk, or 0.
+// Caller must hold bk->lock.
+static struct buf*
+bfind(struct bucket *bk, uint dev, uint blockno)
+{
+  struct buf *b;
+
+  for(b = bk->head.next; b != &bk->head; b = b->next)
+    if(b->dev == dev && b->blockno == blockno)
+      return b;
+  return 0;
+}
+
+// Return the least recently used recyclable buffer in bk, or 0.
+// Even if refcnt==0, B_DIRTY indicates a buffer is in use
+// because log.c has modified it but not yet committed it.
+// Caller must hold bk->lock.
+static struct buf*
+bvictim(struct bucket *bk)
+{
+  struct buf *b;
+
+  for(b = bk->head.prev; b != &bk->head; b = b->prev)
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0)
+      return b;
+  return 0;
+}
+
+// Remove a recyclable buffer from some bucket other than self
+// and return it, unlinked and invalid.  Caller must not hold
+// any bucket lock.
+static struct buf*
+bsteal(struct bucket *self)
+{
+  struct bucket *bk;
+  struct buf *b;
+  int i;
+
+  bk = self;
+  for(i = 1; i < NBUCKET; i++){
+    if(++bk == bcache.bucket+NBUCKET)
+      bk = bcache.bucket;
+    acquire(&bk->lock);
+    if((b = bvictim(bk)) != 0){
+      bunlink(b);
+      b->dev = -1;  // matches no device, so bfind() never returns it
+      b->flags = 0;
+      release(&bk->lock);
+      return b;
+    }
+    release(&bk->lock);
   }
+  panic("bget: no buffers");
 }
 
 // Look through buffer cache for block on device dev.
@@ -61,35 +157,48 @@ binit(void)
 static struct buf*
 bget(uint dev, uint blockno)
 {
-  struct buf *b;
+  struct bucket *bk;
+  struct buf *b, *spare;
 
-  acquire(&bcache.lock);
+  bk = bhash(dev, blockno);
+  acquire(&bk->lock);
 
   // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
-    if(b->dev == dev && b->blockno == blockno){
-      b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
-    }
+  if((b = bfind(bk, dev, blockno)) != 0){
+    b->refcnt++;
+    release(&bk->lock);
+    acquiresleep(&b->lock);
+    return b;
   }
 
   // Not cached; recycle an unused buffer.
-  // Even if refcnt==0, B_DIRTY indicates a buffer is in use
-  // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
-      release(&bcache.lock);
+  if((b = bvictim(bk)) == 0){
+    release(&bk->lock);
+    spare = bsteal(bk);
+    acquire(&bk->lock);
+    // Another process may have cached the block while bk
+    // was unlocked; if so, park the stolen (invalid) buffer
+    // at the LRU end of bk and use the cached one.
+    if((b = bfind(bk, dev, blockno)) != 0){
+      spare->next = &bk->head;
+      spare->prev = bk->head.prev;
+      bk->head.prev->next = spare;
+      bk->head.prev = spare;
+      b->refcnt++;
+      release(&bk->lock);
       acquiresleep(&b->lock);
       return b;
     }
+    b = spare;
+    binsert(bk, b);
   }
-  panic("bget: no buffers");
+  b->dev = dev;
+  b->blockno = blockno;
+  b->flags = 0;
+  b->refcnt = 1;
+  release(&bk->lock);
+  acquiresleep(&b->lock);
+  return b;
 }
 
 // Return a locked buf with the contents of the indicated block.
@@ -105,6 +214,41 @@ bread(uint dev, uint blockno)
   return b;
 }
 
+// Return a locked buf for the indicated block without reading
+// it from disk.  The caller must overwrite all of b->data,
+// which holds garbage unless the block was already cached.
+struct buf*
+bclaim(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  b = bget(dev, blockno);
+  b->flags |= B_VALID;
+  return b;
+}
+
+// Fill bp[0..n-1] with locked bufs holding the n consecutive
+// blocks starting at blockno.  The blocks that are not cached
+// are read with one call to the driver, which can then
+// transfer them in a single command.
+void
+breadn(uint dev, uint blockno, int n, struct buf **bp)
+{
+  struct buf *miss[NBREADN];
+  int i, m;
+
+  if(n > NBREADN)
+    panic("breadn");
+  m = 0;
+  for(i = 0; i < n; i++){
+    bp[i] = bget(dev, blockno + i);
+    if((bp[i]->flags & B_VALID) == 0)
+      miss[m++] = bp[i];
+  }
+  if(m > 0)
+    iderwv(miss, m);
+}
+
 // Write b's contents to disk.  Must be locked.
 void
 bwrite(struct buf *b)
@@ -116,29 +260,27 @@ bwrite(struct buf *b)
 }
 
 // Release a locked buffer.
-// Move to the head of the MRU list.
+// Move to the head of its bucket's MRU list.
 void
 brelse(struct buf *b)
 {
+  struct bucket *bk;
+
   if(!holdingsleep(&b->lock))
     panic("brelse");
 
   releasesleep(&b->lock);
 
-  acquire(&bcache.lock);
+  bk = bhash(b->dev, b->blockno);
+  acquire(&bk->lock);
   b->refcnt--;
   if (b->refcnt == 0) {
     // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+    bunlink(b);
+    binsert(bk, b);
   }
   
-  release(&bcache.lock);
+  release(&bk->lock);
 }
 //PAGEBREAK!
 // Blank page.
-
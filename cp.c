@@ -0,0 +1,45 @@
+// cp src dst: copy file src to dst, in the kernel with
+// copyrange() where it can, else with read and write.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+char buf[4096];
+
+int
+main(int argc, char *argv[])
+{
+  int fd0, fd1, n;
+
+  if(argc != 3){
+    printf(2, "usage: cp src dst\n");
+    exit();
+  }
+  if((fd0 = open(argv[1], O_RDONLY)) < 0){
+    printf(2, "cp: cannot open %s\n", argv[1]);
+    exit();
+  }
+  unlink(argv[2]);
+  if((fd1 = open(argv[2], O_CREATE|O_WRONLY)) < 0){
+    printf(2, "cp: cannot create %s\n", argv[2]);
+    exit();
+  }
+
+  while((n = copyrange(fd0, fd1, 65536)) > 0)
+    ;
+  if(n < 0){
+    while((n = read(fd0, buf, sizeof(buf))) > 0){
+      if(write(fd1, buf, n) != n){
+        printf(2, "cp: write error\n");
+        exit();
+      }
+    }
+    if(n < 0)
+      printf(2, "cp: read error\n");
+  }
+  close(fd0);
+  close(fd1);
+  exit();
+}
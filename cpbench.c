@@ -0,0 +1,102 @@
+// Compare copying a file with read and write against copyrange().
+// cpbench [kbytes] makes a file of kbytes (default 1024) KB, copies
+// it with a read/write loop of 512-byte chunks, with copyrange()
+// calls of one page, and with a single copyrange() call, which
+// can fill log transactions of many pages.  It checks the copies
+// and prints the ticks each took.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+char buf[512];
+
+// Check that file name holds the pattern written by main.
+void
+check(char *name, int n)
+{
+  int fd, i;
+
+  if((fd = open(name, O_RDONLY)) < 0){
+    printf(1, "cpbench: cannot open %s\n", name);
+    exit();
+  }
+  for(i = 0; i < n; i++){
+    if(read(fd, buf, sizeof(buf)) != sizeof(buf) ||
+       buf[0] != (char)i || buf[sizeof(buf)-1] != (char)i){
+      printf(1, "cpbench: %s is wrong at block %d\n", name, i);
+      exit();
+    }
+  }
+  close(fd);
+}
+
+// Copy cpbench.src to name with copyrange() calls of up to
+// chunk bytes, and return the ticks it took.
+uint
+copy(char *name, int chunk)
+{
+  int fd0, fd1, r;
+  uint start;
+
+  fd0 = open("cpbench.src", O_RDONLY);
+  fd1 = open(name, O_CREATE|O_WRONLY);
+  start = uptime();
+  while((r = copyrange(fd0, fd1, chunk)) > 0)
+    ;
+  start = uptime() - start;
+  close(fd0);
+  close(fd1);
+  if(r < 0){
+    printf(1, "cpbench: copyrange to %s failed\n", name);
+    exit();
+  }
+  return start;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int fd0, fd1, i, n, r;
+  uint start, rw, cr1, cr;
+
+  n = (argc > 1 ? atoi(argv[1]) : 1024) * 2;
+
+  fd0 = open("cpbench.src", O_CREATE|O_RDWR);
+  if(fd0 < 0){
+    printf(1, "cpbench: cannot create cpbench.src\n");
+    exit();
+  }
+  for(i = 0; i < n; i++){
+    memset(buf, i, sizeof(buf));
+    if(write(fd0, buf, sizeof(buf)) != sizeof(buf)){
+      printf(1, "cpbench: write failed\n");
+      exit();
+    }
+  }
+  close(fd0);
+
+  fd0 = open("cpbench.src", O_RDONLY);
+  fd1 = open("cpbench.rw", O_CREATE|O_WRONLY);
+  start = uptime();
+  while((r = read(fd0, buf, sizeof(buf))) > 0)
+    write(fd1, buf, r);
+  rw = uptime() - start;
+  close(fd0);
+  close(fd1);
+
+  cr1 = copy("cpbench.cr1", 4096);
+  cr = copy("cpbench.cr", n*512);
+
+  check("cpbench.rw", n);
+  check("cpbench.cr1", n);
+  check("cpbench.cr", n);
+  printf(1, "cpbench: %d KB: read/write %d ticks, copyrange by page %d "
+         "ticks, copyrange at once %d ticks\n", n/2, rw, cr1, cr);
+  unlink("cpbench.src");
+  unlink("cpbench.rw");
+  unlink("cpbench.cr1");
+  unlink("cpbench.cr");
+  exit();
+}
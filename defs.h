@@ -4,15 +4,19 @@ struct file;
 struct inode;
 struct pipe;
 struct proc;
+struct pstat;
 struct rtcdate;
 struct spinlock;
+struct rwspinlock;
 struct sleeplock;
 struct stat;
 struct superblock;
 
 // bio.c
 void            binit(void);
+struct buf*     bclaim(uint, uint);
 struct buf*     bread(uint, uint);
+void            breadn(uint, uint, int, struct buf**);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
 
@@ -33,10 +37,13 @@ void            fileinit(void);
 int             fileread(struct file*, char*, int n);
 int             filestat(struct file*, struct stat*);
 int             filewrite(struct file*, char*, int n);
+int             filesplice(struct file*, struct file*, int n);
+int             filecopy(struct file*, struct file*, int n);
 
 // fs.c
 void            readsb(int dev, struct superblock *sb);
 int             dirlink(struct inode*, char*, uint);
+void            dcinvalidate(struct inode*, char*);
 struct inode*   dirlookup(struct inode*, char*, uint*);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
@@ -45,6 +52,8 @@ void            ilock(struct inode*);
 void            iput(struct inode*);
 void            iunlock(struct inode*);
 void            iunlockput(struct inode*);
+void            ilockread(struct inode*);
+void            iunlockread(struct inode*);
 void            iupdate(struct inode*);
 int             namecmp(const char*, const char*);
 struct inode*   namei(char*);
@@ -52,11 +61,13 @@ struct inode*   nameiparent(char*, char*);
 int             readi(struct inode*, char*, uint, uint);
 void            stati(struct inode*, struct stat*);
 int             writei(struct inode*, char*, uint, uint);
+uint            writeiblocks(struct inode*, uint, uint);
 
 // ide.c
 void            ideinit(void);
 void            ideintr(void);
 void            iderw(struct buf*);
+void            iderwv(struct buf**, int);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
@@ -65,9 +76,11 @@ void            ioapicinit(void);
 
 // kalloc.c
 char*           kalloc(void);
+void            kaddref(char*);
 void            kfree(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
+int             krefcnt(char*);
 
 // kbd.c
 void            kbdintr(void);
@@ -78,6 +91,7 @@ int             lapicid(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
+void            lapicipi(uchar, int);
 void            lapicstartap(uchar, uint);
 void            microdelay(int);
 
@@ -85,7 +99,9 @@ void            microdelay(int);
 void            initlog(int dev);
 void            log_write(struct buf*);
 void            begin_op();
+void            begin_opn(int);
 void            end_op();
+int             log_opmax(void);
 
 // mp.c
 extern int      ismp;
@@ -100,6 +116,11 @@ int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
 int             piperead(struct pipe*, char*, int);
 int             pipewrite(struct pipe*, char*, int);
+int             pipesize(struct pipe*, int);
+char*           pipewbegin(struct pipe*, int*);
+void            pipewend(struct pipe*, int);
+char*           piperbegin(struct pipe*, int*);
+void            piperend(struct pipe*, int);
 
 //PAGEBREAK: 16
 // proc.c
@@ -108,6 +129,7 @@ void            exit(void);
 int             fork(void);
 int             growproc(int);
 int             kill(int);
+int             kproc(char*, void (*)(void));
 struct cpu*     mycpu(void);
 struct proc*    myproc();
 void            pinit(void);
@@ -120,6 +142,8 @@ void            userinit(void);
 int             wait(void);
 void            wakeup(void*);
 void            yield(void);
+int             schedtick(void);
+int             getpstat(int, struct pstat*);
 
 // swtch.S
 void            swtch(struct context**, struct context*);
@@ -130,12 +154,20 @@ void            getcallerpcs(void*, uint*);
 int             holding(struct spinlock*);
 void            initlock(struct spinlock*, char*);
 void            release(struct spinlock*);
+void            initrwlock(struct rwspinlock*, char*);
+void            acquireread(struct rwspinlock*);
+void            releaseread(struct rwspinlock*);
+void            acquirewrite(struct rwspinlock*);
+void            releasewrite(struct rwspinlock*);
 void            pushcli(void);
 void            popcli(void);
+void            lockdump(void);
 
 // sleeplock.c
 void            acquiresleep(struct sleeplock*);
 void            releasesleep(struct sleeplock*);
+void            acquiresleepread(struct sleeplock*);
+void            releasesleepread(struct sleeplock*);
 int             holdingsleep(struct sleeplock*);
 void            initsleeplock(struct sleeplock*, char*);
 
@@ -151,6 +183,7 @@ char*           strncpy(char*, const char*, int);
 // syscall.c
 int             argint(int, int*);
 int             argptr(int, char**, int);
+int             argptrw(int, char**, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
@@ -161,6 +194,7 @@ void            timerinit(void);
 
 // trap.c
 void            idtinit(void);
+void            sleepticks(uint);
 extern uint     ticks;
 void            tvinit(void);
 extern struct spinlock tickslock;
@@ -181,6 +215,9 @@ void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
 int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
 pde_t*          copyuvm(pde_t*, uint);
+int             cowfault(pde_t*, uint);
+int             lazyfault(pde_t*, uint, uint);
+int             uvmtouch(pde_t*, uint, uint, uint, int);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
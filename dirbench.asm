@@ -0,0 +1,1486 @@
+
+_dirbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	bb 10 27 00 00       	mov    $0x2710,%ebx
+  13:	51                   	push   %ecx
+  int n;
+
+  n = 10000;
+  if(argc > 1)
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  17:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc > 1)
+  1a:	7e 1a                	jle    36 <main+0x36>
+    n = atoi(argv[1]);
+  1c:	83 ec 0c             	sub    $0xc,%esp
+  1f:	ff 70 04             	push   0x4(%eax)
+  22:	e8 f9 04 00 00       	call   520 <atoi>
+  27:	89 c3                	mov    %eax,%ebx
+  if(n < NSTEP)
+  29:	b8 0a 00 00 00       	mov    $0xa,%eax
+  2e:	39 c3                	cmp    %eax,%ebx
+  30:	0f 4c d8             	cmovl  %eax,%ebx
+  33:	83 c4 10             	add    $0x10,%esp
+    n = NSTEP;
+
+  if(mkdir(dir) < 0 || chdir(dir) < 0){
+  36:	83 ec 0c             	sub    $0xc,%esp
+  39:	ff 35 60 0e 00 00    	push   0xe60
+  3f:	e8 b7 05 00 00       	call   5fb <mkdir>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	85 c0                	test   %eax,%eax
+  49:	78 15                	js     60 <main+0x60>
+  4b:	83 ec 0c             	sub    $0xc,%esp
+  4e:	ff 35 60 0e 00 00    	push   0xe60
+  54:	e8 aa 05 00 00       	call   603 <chdir>
+  59:	83 c4 10             	add    $0x10,%esp
+  5c:	85 c0                	test   %eax,%eax
+  5e:	79 1a                	jns    7a <main+0x7a>
+    printf(1, "dirbench: cannot make %s\n", dir);
+  60:	83 ec 04             	sub    $0x4,%esp
+  63:	ff 35 60 0e 00 00    	push   0xe60
+  69:	68 66 0a 00 00       	push   $0xa66
+  6e:	6a 01                	push   $0x1
+  70:	e8 8b 06 00 00       	call   700 <printf>
+    exit();
+  75:	e8 19 05 00 00       	call   593 <exit>
+  }
+  phase("create", n, createone);
+  7a:	50                   	push   %eax
+  7b:	68 d0 00 00 00       	push   $0xd0
+  80:	53                   	push   %ebx
+  81:	68 80 0a 00 00       	push   $0xa80
+  86:	e8 65 01 00 00       	call   1f0 <phase>
+  phase("lookup", n, lookupone);
+  8b:	83 c4 0c             	add    $0xc,%esp
+  8e:	68 10 01 00 00       	push   $0x110
+  93:	53                   	push   %ebx
+  94:	68 87 0a 00 00       	push   $0xa87
+  99:	e8 52 01 00 00       	call   1f0 <phase>
+  phase("unlink", n, unlink);
+  9e:	83 c4 0c             	add    $0xc,%esp
+  a1:	68 e3 05 00 00       	push   $0x5e3
+  a6:	53                   	push   %ebx
+  a7:	68 8e 0a 00 00       	push   $0xa8e
+  ac:	e8 3f 01 00 00       	call   1f0 <phase>
+  chdir("..");
+  b1:	c7 04 24 95 0a 00 00 	movl   $0xa95,(%esp)
+  b8:	e8 46 05 00 00       	call   603 <chdir>
+  unlink(dir);
+  bd:	5a                   	pop    %edx
+  be:	ff 35 60 0e 00 00    	push   0xe60
+  c4:	e8 1a 05 00 00       	call   5e3 <unlink>
+  exit();
+  c9:	e8 c5 04 00 00       	call   593 <exit>
+  ce:	66 90                	xchg   %ax,%ax
+
+000000d0 <createone>:
+{
+  d0:	55                   	push   %ebp
+  d1:	89 e5                	mov    %esp,%ebp
+  d3:	83 ec 10             	sub    $0x10,%esp
+  if((fd = open(path, O_CREATE|O_RDWR)) < 0)
+  d6:	68 02 02 00 00       	push   $0x202
+  db:	ff 75 08             	push   0x8(%ebp)
+  de:	e8 f0 04 00 00       	call   5d3 <open>
+  e3:	83 c4 10             	add    $0x10,%esp
+  e6:	85 c0                	test   %eax,%eax
+  e8:	78 16                	js     100 <createone+0x30>
+  close(fd);
+  ea:	83 ec 0c             	sub    $0xc,%esp
+  ed:	50                   	push   %eax
+  ee:	e8 c8 04 00 00       	call   5bb <close>
+  return 0;
+  f3:	83 c4 10             	add    $0x10,%esp
+  f6:	31 c0                	xor    %eax,%eax
+}
+  f8:	c9                   	leave
+  f9:	c3                   	ret
+  fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 100:	c9                   	leave
+    return -1;
+ 101:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ 106:	c3                   	ret
+ 107:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10e:	66 90                	xchg   %ax,%ax
+
+00000110 <lookupone>:
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	83 ec 10             	sub    $0x10,%esp
+  if((fd = open(path, O_RDONLY)) < 0)
+ 116:	6a 00                	push   $0x0
+ 118:	ff 75 08             	push   0x8(%ebp)
+ 11b:	e8 b3 04 00 00       	call   5d3 <open>
+ 120:	83 c4 10             	add    $0x10,%esp
+ 123:	85 c0                	test   %eax,%eax
+ 125:	78 19                	js     140 <lookupone+0x30>
+  close(fd);
+ 127:	83 ec 0c             	sub    $0xc,%esp
+ 12a:	50                   	push   %eax
+ 12b:	e8 8b 04 00 00       	call   5bb <close>
+  return 0;
+ 130:	83 c4 10             	add    $0x10,%esp
+ 133:	31 c0                	xor    %eax,%eax
+}
+ 135:	c9                   	leave
+ 136:	c3                   	ret
+ 137:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13e:	66 90                	xchg   %ax,%ax
+ 140:	c9                   	leave
+    return -1;
+ 141:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ 146:	c3                   	ret
+ 147:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14e:	66 90                	xchg   %ax,%ax
+
+00000150 <name>:
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	57                   	push   %edi
+ 154:	56                   	push   %esi
+ 155:	53                   	push   %ebx
+ 156:	8b 7d 08             	mov    0x8(%ebp),%edi
+ 159:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  buf[0] = 'f';
+ 15c:	c6 07 66             	movb   $0x66,(%edi)
+  for(n = i, j = 1; n >= 10; n /= 10)
+ 15f:	83 f9 09             	cmp    $0x9,%ecx
+ 162:	7e 5c                	jle    1c0 <name+0x70>
+ 164:	89 ca                	mov    %ecx,%edx
+ 166:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 16b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 16f:	90                   	nop
+ 170:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+ 175:	89 d6                	mov    %edx,%esi
+ 177:	89 df                	mov    %ebx,%edi
+    j++;
+ 179:	83 c3 01             	add    $0x1,%ebx
+  for(n = i, j = 1; n >= 10; n /= 10)
+ 17c:	f7 e2                	mul    %edx
+ 17e:	c1 ea 03             	shr    $0x3,%edx
+ 181:	83 fe 63             	cmp    $0x63,%esi
+ 184:	7f ea                	jg     170 <name+0x20>
+ 186:	89 f8                	mov    %edi,%eax
+ 188:	8b 7d 08             	mov    0x8(%ebp),%edi
+    buf[j] = '0' + i%10;
+ 18b:	be 67 66 66 66       	mov    $0x66666667,%esi
+  buf[j+1] = '\0';
+ 190:	c6 44 07 02 00       	movb   $0x0,0x2(%edi,%eax,1)
+  for(; j > 0; j--, i /= 10)
+ 195:	8d 76 00             	lea    0x0(%esi),%esi
+    buf[j] = '0' + i%10;
+ 198:	89 c8                	mov    %ecx,%eax
+ 19a:	f7 ee                	imul   %esi
+ 19c:	89 c8                	mov    %ecx,%eax
+ 19e:	c1 f8 1f             	sar    $0x1f,%eax
+ 1a1:	c1 fa 02             	sar    $0x2,%edx
+ 1a4:	29 c2                	sub    %eax,%edx
+ 1a6:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ 1a9:	01 c0                	add    %eax,%eax
+ 1ab:	29 c1                	sub    %eax,%ecx
+ 1ad:	83 c1 30             	add    $0x30,%ecx
+ 1b0:	88 0c 1f             	mov    %cl,(%edi,%ebx,1)
+  for(; j > 0; j--, i /= 10)
+ 1b3:	89 d1                	mov    %edx,%ecx
+ 1b5:	83 eb 01             	sub    $0x1,%ebx
+ 1b8:	75 de                	jne    198 <name+0x48>
+}
+ 1ba:	5b                   	pop    %ebx
+ 1bb:	5e                   	pop    %esi
+ 1bc:	5f                   	pop    %edi
+ 1bd:	5d                   	pop    %ebp
+ 1be:	c3                   	ret
+ 1bf:	90                   	nop
+    buf[j] = '0' + i%10;
+ 1c0:	b8 67 66 66 66       	mov    $0x66666667,%eax
+  buf[j+1] = '\0';
+ 1c5:	c6 47 02 00          	movb   $0x0,0x2(%edi)
+    buf[j] = '0' + i%10;
+ 1c9:	f7 e9                	imul   %ecx
+ 1cb:	89 c8                	mov    %ecx,%eax
+ 1cd:	c1 f8 1f             	sar    $0x1f,%eax
+ 1d0:	c1 fa 02             	sar    $0x2,%edx
+ 1d3:	29 c2                	sub    %eax,%edx
+ 1d5:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ 1d8:	01 c0                	add    %eax,%eax
+ 1da:	29 c1                	sub    %eax,%ecx
+ 1dc:	83 c1 30             	add    $0x30,%ecx
+ 1df:	88 4f 01             	mov    %cl,0x1(%edi)
+}
+ 1e2:	5b                   	pop    %ebx
+ 1e3:	5e                   	pop    %esi
+ 1e4:	5f                   	pop    %edi
+ 1e5:	5d                   	pop    %ebp
+ 1e6:	c3                   	ret
+ 1e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ee:	66 90                	xchg   %ax,%ax
+
+000001f0 <phase>:
+{
+ 1f0:	55                   	push   %ebp
+  printf(1, "dirbench: %s ticks per %d files:", what, n/NSTEP);
+ 1f1:	b8 67 66 66 66       	mov    $0x66666667,%eax
+{
+ 1f6:	89 e5                	mov    %esp,%ebp
+ 1f8:	57                   	push   %edi
+ 1f9:	56                   	push   %esi
+ 1fa:	53                   	push   %ebx
+ 1fb:	83 ec 2c             	sub    $0x2c,%esp
+  printf(1, "dirbench: %s ticks per %d files:", what, n/NSTEP);
+ 1fe:	f7 6d 0c             	imull  0xc(%ebp)
+ 201:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 204:	c1 f8 1f             	sar    $0x1f,%eax
+ 207:	c1 fa 02             	sar    $0x2,%edx
+ 20a:	29 c2                	sub    %eax,%edx
+ 20c:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 20f:	52                   	push   %edx
+ 210:	ff 75 08             	push   0x8(%ebp)
+ 213:	68 28 0a 00 00       	push   $0xa28
+ 218:	6a 01                	push   $0x1
+ 21a:	e8 e1 04 00 00       	call   700 <printf>
+  start = uptime();
+ 21f:	e8 07 04 00 00       	call   62b <uptime>
+  for(i = 0; i < n; i++){
+ 224:	83 c4 10             	add    $0x10,%esp
+  start = uptime();
+ 227:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  for(i = 0; i < n; i++){
+ 22a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 22d:	85 c0                	test   %eax,%eax
+ 22f:	0f 8e a4 00 00 00    	jle    2d9 <phase+0xe9>
+ 235:	31 db                	xor    %ebx,%ebx
+ 237:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 23a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  buf[0] = 'f';
+ 240:	c6 45 d8 66          	movb   $0x66,-0x28(%ebp)
+  for(n = i, j = 1; n >= 10; n /= 10)
+ 244:	83 fb 09             	cmp    $0x9,%ebx
+ 247:	0f 8e d3 00 00 00    	jle    320 <phase+0x130>
+ 24d:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 250:	89 da                	mov    %ebx,%edx
+ 252:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25e:	66 90                	xchg   %ax,%ax
+ 260:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+ 265:	89 d3                	mov    %edx,%ebx
+ 267:	89 cf                	mov    %ecx,%edi
+    j++;
+ 269:	83 c1 01             	add    $0x1,%ecx
+  for(n = i, j = 1; n >= 10; n /= 10)
+ 26c:	f7 e2                	mul    %edx
+ 26e:	c1 ea 03             	shr    $0x3,%edx
+ 271:	83 fb 63             	cmp    $0x63,%ebx
+ 274:	7f ea                	jg     260 <phase+0x70>
+  buf[j+1] = '\0';
+ 276:	c6 44 3d da 00       	movb   $0x0,-0x26(%ebp,%edi,1)
+ 27b:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  for(; j > 0; j--, i /= 10)
+ 27e:	01 f1                	add    %esi,%ecx
+  for(n = i, j = 1; n >= 10; n /= 10)
+ 280:	89 df                	mov    %ebx,%edi
+ 282:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    buf[j] = '0' + i%10;
+ 288:	b8 67 66 66 66       	mov    $0x66666667,%eax
+  for(; j > 0; j--, i /= 10)
+ 28d:	83 e9 01             	sub    $0x1,%ecx
+    buf[j] = '0' + i%10;
+ 290:	f7 ef                	imul   %edi
+ 292:	89 f8                	mov    %edi,%eax
+ 294:	c1 f8 1f             	sar    $0x1f,%eax
+ 297:	c1 fa 02             	sar    $0x2,%edx
+ 29a:	29 c2                	sub    %eax,%edx
+ 29c:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ 29f:	01 c0                	add    %eax,%eax
+ 2a1:	29 c7                	sub    %eax,%edi
+ 2a3:	8d 47 30             	lea    0x30(%edi),%eax
+  for(; j > 0; j--, i /= 10)
+ 2a6:	89 d7                	mov    %edx,%edi
+    buf[j] = '0' + i%10;
+ 2a8:	88 41 01             	mov    %al,0x1(%ecx)
+  for(; j > 0; j--, i /= 10)
+ 2ab:	39 f1                	cmp    %esi,%ecx
+ 2ad:	75 d9                	jne    288 <phase+0x98>
+    if(op(buf) < 0){
+ 2af:	83 ec 0c             	sub    $0xc,%esp
+ 2b2:	51                   	push   %ecx
+ 2b3:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+ 2b6:	ff 55 10             	call   *0x10(%ebp)
+ 2b9:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 2bc:	83 c4 10             	add    $0x10,%esp
+ 2bf:	85 c0                	test   %eax,%eax
+ 2c1:	78 6b                	js     32e <phase+0x13e>
+    if((i+1) % step == 0){
+ 2c3:	83 c3 01             	add    $0x1,%ebx
+ 2c6:	89 d8                	mov    %ebx,%eax
+ 2c8:	99                   	cltd
+ 2c9:	f7 7d d0             	idivl  -0x30(%ebp)
+ 2cc:	85 d2                	test   %edx,%edx
+ 2ce:	74 28                	je     2f8 <phase+0x108>
+  for(i = 0; i < n; i++){
+ 2d0:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2d3:	0f 85 67 ff ff ff    	jne    240 <phase+0x50>
+  printf(1, "\n");
+ 2d9:	83 ec 08             	sub    $0x8,%esp
+ 2dc:	68 60 0a 00 00       	push   $0xa60
+ 2e1:	6a 01                	push   $0x1
+ 2e3:	e8 18 04 00 00       	call   700 <printf>
+}
+ 2e8:	83 c4 10             	add    $0x10,%esp
+ 2eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2ee:	5b                   	pop    %ebx
+ 2ef:	5e                   	pop    %esi
+ 2f0:	5f                   	pop    %edi
+ 2f1:	5d                   	pop    %ebp
+ 2f2:	c3                   	ret
+ 2f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2f7:	90                   	nop
+      printf(1, " %d", uptime() - start);
+ 2f8:	e8 2e 03 00 00       	call   62b <uptime>
+ 2fd:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+ 300:	83 ec 04             	sub    $0x4,%esp
+ 303:	29 c8                	sub    %ecx,%eax
+ 305:	50                   	push   %eax
+ 306:	68 62 0a 00 00       	push   $0xa62
+ 30b:	6a 01                	push   $0x1
+ 30d:	e8 ee 03 00 00       	call   700 <printf>
+      start = uptime();
+ 312:	e8 14 03 00 00       	call   62b <uptime>
+ 317:	83 c4 10             	add    $0x10,%esp
+ 31a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+ 31d:	eb b1                	jmp    2d0 <phase+0xe0>
+ 31f:	90                   	nop
+  buf[j+1] = '\0';
+ 320:	c6 45 da 00          	movb   $0x0,-0x26(%ebp)
+  for(n = i, j = 1; n >= 10; n /= 10)
+ 324:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 329:	e9 50 ff ff ff       	jmp    27e <phase+0x8e>
+      printf(1, "\ndirbench: %s %s failed\n", what, buf);
+ 32e:	51                   	push   %ecx
+ 32f:	ff 75 08             	push   0x8(%ebp)
+ 332:	68 49 0a 00 00       	push   $0xa49
+ 337:	6a 01                	push   $0x1
+ 339:	e8 c2 03 00 00       	call   700 <printf>
+      exit();
+ 33e:	e8 50 02 00 00       	call   593 <exit>
+ 343:	66 90                	xchg   %ax,%ax
+ 345:	66 90                	xchg   %ax,%ax
+ 347:	66 90                	xchg   %ax,%ax
+ 349:	66 90                	xchg   %ax,%ax
+ 34b:	66 90                	xchg   %ax,%ax
+ 34d:	66 90                	xchg   %ax,%ax
+ 34f:	90                   	nop
+
+00000350 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 350:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 351:	31 c0                	xor    %eax,%eax
+{
+ 353:	89 e5                	mov    %esp,%ebp
+ 355:	53                   	push   %ebx
+ 356:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 359:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 35c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 360:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 364:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 367:	83 c0 01             	add    $0x1,%eax
+ 36a:	84 d2                	test   %dl,%dl
+ 36c:	75 f2                	jne    360 <strcpy+0x10>
+    ;
+  return os;
+}
+ 36e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 371:	89 c8                	mov    %ecx,%eax
+ 373:	c9                   	leave
+ 374:	c3                   	ret
+ 375:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000380 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	53                   	push   %ebx
+ 384:	8b 55 08             	mov    0x8(%ebp),%edx
+ 387:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 38a:	0f b6 02             	movzbl (%edx),%eax
+ 38d:	84 c0                	test   %al,%al
+ 38f:	75 17                	jne    3a8 <strcmp+0x28>
+ 391:	eb 3a                	jmp    3cd <strcmp+0x4d>
+ 393:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 397:	90                   	nop
+ 398:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 39c:	83 c2 01             	add    $0x1,%edx
+ 39f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 3a2:	84 c0                	test   %al,%al
+ 3a4:	74 1a                	je     3c0 <strcmp+0x40>
+    p++, q++;
+ 3a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 3a8:	0f b6 19             	movzbl (%ecx),%ebx
+ 3ab:	38 c3                	cmp    %al,%bl
+ 3ad:	74 e9                	je     398 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 3af:	29 d8                	sub    %ebx,%eax
+}
+ 3b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3b4:	c9                   	leave
+ 3b5:	c3                   	ret
+ 3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 3c4:	31 c0                	xor    %eax,%eax
+ 3c6:	29 d8                	sub    %ebx,%eax
+}
+ 3c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3cb:	c9                   	leave
+ 3cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3cd:	0f b6 19             	movzbl (%ecx),%ebx
+ 3d0:	31 c0                	xor    %eax,%eax
+ 3d2:	eb db                	jmp    3af <strcmp+0x2f>
+ 3d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3df:	90                   	nop
+
+000003e0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3e6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3e9:	74 15                	je     400 <strlen+0x20>
+ 3eb:	31 c0                	xor    %eax,%eax
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 3f0:	83 c0 01             	add    $0x1,%eax
+ 3f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3f7:	89 c1                	mov    %eax,%ecx
+ 3f9:	75 f5                	jne    3f0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3fb:	89 c8                	mov    %ecx,%eax
+ 3fd:	5d                   	pop    %ebp
+ 3fe:	c3                   	ret
+ 3ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 400:	31 c9                	xor    %ecx,%ecx
+}
+ 402:	5d                   	pop    %ebp
+ 403:	89 c8                	mov    %ecx,%eax
+ 405:	c3                   	ret
+ 406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000410 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	57                   	push   %edi
+ 414:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 417:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 41a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 41d:	89 d7                	mov    %edx,%edi
+ 41f:	fc                   	cld
+ 420:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 422:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 425:	89 d0                	mov    %edx,%eax
+ 427:	c9                   	leave
+ 428:	c3                   	ret
+ 429:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000430 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	8b 45 08             	mov    0x8(%ebp),%eax
+ 436:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 43a:	0f b6 10             	movzbl (%eax),%edx
+ 43d:	84 d2                	test   %dl,%dl
+ 43f:	75 12                	jne    453 <strchr+0x23>
+ 441:	eb 1d                	jmp    460 <strchr+0x30>
+ 443:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 447:	90                   	nop
+ 448:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 44c:	83 c0 01             	add    $0x1,%eax
+ 44f:	84 d2                	test   %dl,%dl
+ 451:	74 0d                	je     460 <strchr+0x30>
+    if(*s == c)
+ 453:	38 d1                	cmp    %dl,%cl
+ 455:	75 f1                	jne    448 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 457:	5d                   	pop    %ebp
+ 458:	c3                   	ret
+ 459:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 460:	31 c0                	xor    %eax,%eax
+}
+ 462:	5d                   	pop    %ebp
+ 463:	c3                   	ret
+ 464:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 46f:	90                   	nop
+
+00000470 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 475:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 478:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 479:	31 db                	xor    %ebx,%ebx
+{
+ 47b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 47e:	eb 27                	jmp    4a7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 480:	83 ec 04             	sub    $0x4,%esp
+ 483:	6a 01                	push   $0x1
+ 485:	56                   	push   %esi
+ 486:	6a 00                	push   $0x0
+ 488:	e8 1e 01 00 00       	call   5ab <read>
+    if(cc < 1)
+ 48d:	83 c4 10             	add    $0x10,%esp
+ 490:	85 c0                	test   %eax,%eax
+ 492:	7e 1d                	jle    4b1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 494:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 498:	8b 55 08             	mov    0x8(%ebp),%edx
+ 49b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 49f:	3c 0a                	cmp    $0xa,%al
+ 4a1:	74 10                	je     4b3 <gets+0x43>
+ 4a3:	3c 0d                	cmp    $0xd,%al
+ 4a5:	74 0c                	je     4b3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 4a7:	89 df                	mov    %ebx,%edi
+ 4a9:	83 c3 01             	add    $0x1,%ebx
+ 4ac:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 4af:	7c cf                	jl     480 <gets+0x10>
+ 4b1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 4b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 4ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4bd:	5b                   	pop    %ebx
+ 4be:	5e                   	pop    %esi
+ 4bf:	5f                   	pop    %edi
+ 4c0:	5d                   	pop    %ebp
+ 4c1:	c3                   	ret
+ 4c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004d0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	56                   	push   %esi
+ 4d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4d5:	83 ec 08             	sub    $0x8,%esp
+ 4d8:	6a 00                	push   $0x0
+ 4da:	ff 75 08             	push   0x8(%ebp)
+ 4dd:	e8 f1 00 00 00       	call   5d3 <open>
+  if(fd < 0)
+ 4e2:	83 c4 10             	add    $0x10,%esp
+ 4e5:	85 c0                	test   %eax,%eax
+ 4e7:	78 27                	js     510 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 4e9:	83 ec 08             	sub    $0x8,%esp
+ 4ec:	ff 75 0c             	push   0xc(%ebp)
+ 4ef:	89 c3                	mov    %eax,%ebx
+ 4f1:	50                   	push   %eax
+ 4f2:	e8 f4 00 00 00       	call   5eb <fstat>
+  close(fd);
+ 4f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4fc:	e8 ba 00 00 00       	call   5bb <close>
+  return r;
+ 501:	83 c4 10             	add    $0x10,%esp
+}
+ 504:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 507:	89 f0                	mov    %esi,%eax
+ 509:	5b                   	pop    %ebx
+ 50a:	5e                   	pop    %esi
+ 50b:	5d                   	pop    %ebp
+ 50c:	c3                   	ret
+ 50d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 510:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 515:	eb ed                	jmp    504 <stat+0x34>
+ 517:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51e:	66 90                	xchg   %ax,%ax
+
+00000520 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	53                   	push   %ebx
+ 524:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 527:	0f be 02             	movsbl (%edx),%eax
+ 52a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 52d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 530:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 535:	77 1e                	ja     555 <atoi+0x35>
+ 537:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 540:	83 c2 01             	add    $0x1,%edx
+ 543:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 546:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 54a:	0f be 02             	movsbl (%edx),%eax
+ 54d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 550:	80 fb 09             	cmp    $0x9,%bl
+ 553:	76 eb                	jbe    540 <atoi+0x20>
+  return n;
+}
+ 555:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 558:	89 c8                	mov    %ecx,%eax
+ 55a:	c9                   	leave
+ 55b:	c3                   	ret
+ 55c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000560 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	57                   	push   %edi
+ 564:	56                   	push   %esi
+ 565:	8b 45 10             	mov    0x10(%ebp),%eax
+ 568:	8b 55 08             	mov    0x8(%ebp),%edx
+ 56b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 56e:	85 c0                	test   %eax,%eax
+ 570:	7e 13                	jle    585 <memmove+0x25>
+ 572:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 574:	89 d7                	mov    %edx,%edi
+ 576:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 580:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 581:	39 f8                	cmp    %edi,%eax
+ 583:	75 fb                	jne    580 <memmove+0x20>
+  return vdst;
+}
+ 585:	5e                   	pop    %esi
+ 586:	89 d0                	mov    %edx,%eax
+ 588:	5f                   	pop    %edi
+ 589:	5d                   	pop    %ebp
+ 58a:	c3                   	ret
+
+0000058b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 58b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <exit>:
+SYSCALL(exit)
+ 593:	b8 02 00 00 00       	mov    $0x2,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <wait>:
+SYSCALL(wait)
+ 59b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <pipe>:
+SYSCALL(pipe)
+ 5a3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <read>:
+SYSCALL(read)
+ 5ab:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <write>:
+SYSCALL(write)
+ 5b3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <close>:
+SYSCALL(close)
+ 5bb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <kill>:
+SYSCALL(kill)
+ 5c3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <exec>:
+SYSCALL(exec)
+ 5cb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <open>:
+SYSCALL(open)
+ 5d3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <mknod>:
+SYSCALL(mknod)
+ 5db:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <unlink>:
+SYSCALL(unlink)
+ 5e3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <fstat>:
+SYSCALL(fstat)
+ 5eb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <link>:
+SYSCALL(link)
+ 5f3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <mkdir>:
+SYSCALL(mkdir)
+ 5fb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <chdir>:
+SYSCALL(chdir)
+ 603:	b8 09 00 00 00       	mov    $0x9,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <dup>:
+SYSCALL(dup)
+ 60b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <getpid>:
+SYSCALL(getpid)
+ 613:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <sbrk>:
+SYSCALL(sbrk)
+ 61b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <sleep>:
+SYSCALL(sleep)
+ 623:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <uptime>:
+SYSCALL(uptime)
+ 62b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <getpstat>:
+SYSCALL(getpstat)
+ 633:	b8 16 00 00 00       	mov    $0x16,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <pipesize>:
+SYSCALL(pipesize)
+ 63b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <splice>:
+SYSCALL(splice)
+ 643:	b8 18 00 00 00       	mov    $0x18,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <copyrange>:
+SYSCALL(copyrange)
+ 64b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+ 653:	66 90                	xchg   %ax,%ax
+ 655:	66 90                	xchg   %ax,%ax
+ 657:	66 90                	xchg   %ax,%ax
+ 659:	66 90                	xchg   %ax,%ax
+ 65b:	66 90                	xchg   %ax,%ax
+ 65d:	66 90                	xchg   %ax,%ax
+ 65f:	90                   	nop
+
+00000660 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	57                   	push   %edi
+ 664:	56                   	push   %esi
+ 665:	53                   	push   %ebx
+ 666:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 668:	89 d1                	mov    %edx,%ecx
+{
+ 66a:	83 ec 3c             	sub    $0x3c,%esp
+ 66d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 670:	85 d2                	test   %edx,%edx
+ 672:	0f 89 80 00 00 00    	jns    6f8 <printint+0x98>
+ 678:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 67c:	74 7a                	je     6f8 <printint+0x98>
+    x = -xx;
+ 67e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 680:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 685:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 688:	31 f6                	xor    %esi,%esi
+ 68a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 690:	89 c8                	mov    %ecx,%eax
+ 692:	31 d2                	xor    %edx,%edx
+ 694:	89 f7                	mov    %esi,%edi
+ 696:	f7 f3                	div    %ebx
+ 698:	8d 76 01             	lea    0x1(%esi),%esi
+ 69b:	0f b6 92 04 0b 00 00 	movzbl 0xb04(%edx),%edx
+ 6a2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 6a6:	89 ca                	mov    %ecx,%edx
+ 6a8:	89 c1                	mov    %eax,%ecx
+ 6aa:	39 da                	cmp    %ebx,%edx
+ 6ac:	73 e2                	jae    690 <printint+0x30>
+  if(neg)
+ 6ae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 6b1:	85 c0                	test   %eax,%eax
+ 6b3:	74 07                	je     6bc <printint+0x5c>
+    buf[i++] = '-';
+ 6b5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 6ba:	89 f7                	mov    %esi,%edi
+ 6bc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 6bf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 6c2:	01 df                	add    %ebx,%edi
+ 6c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 6c8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 6cb:	83 ec 04             	sub    $0x4,%esp
+ 6ce:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 6d1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 6d4:	6a 01                	push   $0x1
+ 6d6:	50                   	push   %eax
+ 6d7:	56                   	push   %esi
+ 6d8:	e8 d6 fe ff ff       	call   5b3 <write>
+  while(--i >= 0)
+ 6dd:	89 f8                	mov    %edi,%eax
+ 6df:	83 c4 10             	add    $0x10,%esp
+ 6e2:	83 ef 01             	sub    $0x1,%edi
+ 6e5:	39 d8                	cmp    %ebx,%eax
+ 6e7:	75 df                	jne    6c8 <printint+0x68>
+}
+ 6e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6ec:	5b                   	pop    %ebx
+ 6ed:	5e                   	pop    %esi
+ 6ee:	5f                   	pop    %edi
+ 6ef:	5d                   	pop    %ebp
+ 6f0:	c3                   	ret
+ 6f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 6f8:	31 c0                	xor    %eax,%eax
+ 6fa:	eb 89                	jmp    685 <printint+0x25>
+ 6fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000700 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 700:	55                   	push   %ebp
+ 701:	89 e5                	mov    %esp,%ebp
+ 703:	57                   	push   %edi
+ 704:	56                   	push   %esi
+ 705:	53                   	push   %ebx
+ 706:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 709:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 70c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 70f:	0f b6 1e             	movzbl (%esi),%ebx
+ 712:	83 c6 01             	add    $0x1,%esi
+ 715:	84 db                	test   %bl,%bl
+ 717:	74 67                	je     780 <printf+0x80>
+ 719:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 71c:	31 d2                	xor    %edx,%edx
+ 71e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 721:	eb 34                	jmp    757 <printf+0x57>
+ 723:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 727:	90                   	nop
+ 728:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 72b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 730:	83 f8 25             	cmp    $0x25,%eax
+ 733:	74 18                	je     74d <printf+0x4d>
+  write(fd, &c, 1);
+ 735:	83 ec 04             	sub    $0x4,%esp
+ 738:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 73b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 73e:	6a 01                	push   $0x1
+ 740:	50                   	push   %eax
+ 741:	57                   	push   %edi
+ 742:	e8 6c fe ff ff       	call   5b3 <write>
+ 747:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 74a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 74d:	0f b6 1e             	movzbl (%esi),%ebx
+ 750:	83 c6 01             	add    $0x1,%esi
+ 753:	84 db                	test   %bl,%bl
+ 755:	74 29                	je     780 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 757:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 75a:	85 d2                	test   %edx,%edx
+ 75c:	74 ca                	je     728 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 75e:	83 fa 25             	cmp    $0x25,%edx
+ 761:	75 ea                	jne    74d <printf+0x4d>
+      if(c == 'd'){
+ 763:	83 f8 25             	cmp    $0x25,%eax
+ 766:	0f 84 24 01 00 00    	je     890 <printf+0x190>
+ 76c:	83 e8 63             	sub    $0x63,%eax
+ 76f:	83 f8 15             	cmp    $0x15,%eax
+ 772:	77 1c                	ja     790 <printf+0x90>
+ 774:	ff 24 85 ac 0a 00 00 	jmp    *0xaac(,%eax,4)
+ 77b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 77f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 780:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 783:	5b                   	pop    %ebx
+ 784:	5e                   	pop    %esi
+ 785:	5f                   	pop    %edi
+ 786:	5d                   	pop    %ebp
+ 787:	c3                   	ret
+ 788:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 78f:	90                   	nop
+  write(fd, &c, 1);
+ 790:	83 ec 04             	sub    $0x4,%esp
+ 793:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 796:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 79a:	6a 01                	push   $0x1
+ 79c:	52                   	push   %edx
+ 79d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 7a0:	57                   	push   %edi
+ 7a1:	e8 0d fe ff ff       	call   5b3 <write>
+ 7a6:	83 c4 0c             	add    $0xc,%esp
+ 7a9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7ac:	6a 01                	push   $0x1
+ 7ae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 7b1:	52                   	push   %edx
+ 7b2:	57                   	push   %edi
+ 7b3:	e8 fb fd ff ff       	call   5b3 <write>
+        putc(fd, c);
+ 7b8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7bb:	31 d2                	xor    %edx,%edx
+ 7bd:	eb 8e                	jmp    74d <printf+0x4d>
+ 7bf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 7c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7c3:	83 ec 0c             	sub    $0xc,%esp
+ 7c6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 7cb:	8b 13                	mov    (%ebx),%edx
+ 7cd:	6a 00                	push   $0x0
+ 7cf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 7d1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 7d4:	e8 87 fe ff ff       	call   660 <printint>
+        ap++;
+ 7d9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7dc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7df:	31 d2                	xor    %edx,%edx
+ 7e1:	e9 67 ff ff ff       	jmp    74d <printf+0x4d>
+ 7e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 7f0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7f3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 7f5:	83 c0 04             	add    $0x4,%eax
+ 7f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 7fb:	85 db                	test   %ebx,%ebx
+ 7fd:	0f 84 9d 00 00 00    	je     8a0 <printf+0x1a0>
+        while(*s != 0){
+ 803:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 806:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 808:	84 c0                	test   %al,%al
+ 80a:	0f 84 3d ff ff ff    	je     74d <printf+0x4d>
+ 810:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 813:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 816:	89 de                	mov    %ebx,%esi
+ 818:	89 d3                	mov    %edx,%ebx
+ 81a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 820:	83 ec 04             	sub    $0x4,%esp
+ 823:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 826:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 829:	6a 01                	push   $0x1
+ 82b:	53                   	push   %ebx
+ 82c:	57                   	push   %edi
+ 82d:	e8 81 fd ff ff       	call   5b3 <write>
+        while(*s != 0){
+ 832:	0f b6 06             	movzbl (%esi),%eax
+ 835:	83 c4 10             	add    $0x10,%esp
+ 838:	84 c0                	test   %al,%al
+ 83a:	75 e4                	jne    820 <printf+0x120>
+      state = 0;
+ 83c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 83f:	31 d2                	xor    %edx,%edx
+ 841:	e9 07 ff ff ff       	jmp    74d <printf+0x4d>
+ 846:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 850:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 853:	83 ec 0c             	sub    $0xc,%esp
+ 856:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 85b:	8b 13                	mov    (%ebx),%edx
+ 85d:	6a 01                	push   $0x1
+ 85f:	e9 6b ff ff ff       	jmp    7cf <printf+0xcf>
+ 864:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 868:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 86b:	83 ec 04             	sub    $0x4,%esp
+ 86e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 871:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 873:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 876:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 879:	6a 01                	push   $0x1
+ 87b:	52                   	push   %edx
+ 87c:	57                   	push   %edi
+ 87d:	e8 31 fd ff ff       	call   5b3 <write>
+        ap++;
+ 882:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 885:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 888:	31 d2                	xor    %edx,%edx
+ 88a:	e9 be fe ff ff       	jmp    74d <printf+0x4d>
+ 88f:	90                   	nop
+  write(fd, &c, 1);
+ 890:	83 ec 04             	sub    $0x4,%esp
+ 893:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 896:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 899:	6a 01                	push   $0x1
+ 89b:	e9 11 ff ff ff       	jmp    7b1 <printf+0xb1>
+ 8a0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 8a5:	bb a3 0a 00 00       	mov    $0xaa3,%ebx
+ 8aa:	e9 61 ff ff ff       	jmp    810 <printf+0x110>
+ 8af:	90                   	nop
+
+000008b0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8b0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8b1:	a1 64 0e 00 00       	mov    0xe64,%eax
+{
+ 8b6:	89 e5                	mov    %esp,%ebp
+ 8b8:	57                   	push   %edi
+ 8b9:	56                   	push   %esi
+ 8ba:	53                   	push   %ebx
+ 8bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 8be:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8c8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8ca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8cc:	39 ca                	cmp    %ecx,%edx
+ 8ce:	73 30                	jae    900 <free+0x50>
+ 8d0:	39 c1                	cmp    %eax,%ecx
+ 8d2:	72 04                	jb     8d8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8d4:	39 c2                	cmp    %eax,%edx
+ 8d6:	72 f0                	jb     8c8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8d8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 8db:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 8de:	39 f8                	cmp    %edi,%eax
+ 8e0:	74 2e                	je     910 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8e2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 8e5:	8b 42 04             	mov    0x4(%edx),%eax
+ 8e8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8eb:	39 f1                	cmp    %esi,%ecx
+ 8ed:	74 38                	je     927 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8ef:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 8f1:	5b                   	pop    %ebx
+  freep = p;
+ 8f2:	89 15 64 0e 00 00    	mov    %edx,0xe64
+}
+ 8f8:	5e                   	pop    %esi
+ 8f9:	5f                   	pop    %edi
+ 8fa:	5d                   	pop    %ebp
+ 8fb:	c3                   	ret
+ 8fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 900:	39 c1                	cmp    %eax,%ecx
+ 902:	72 d0                	jb     8d4 <free+0x24>
+ 904:	eb c2                	jmp    8c8 <free+0x18>
+ 906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 910:	03 70 04             	add    0x4(%eax),%esi
+ 913:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 916:	8b 02                	mov    (%edx),%eax
+ 918:	8b 00                	mov    (%eax),%eax
+ 91a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 91d:	8b 42 04             	mov    0x4(%edx),%eax
+ 920:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 923:	39 f1                	cmp    %esi,%ecx
+ 925:	75 c8                	jne    8ef <free+0x3f>
+    p->s.size += bp->s.size;
+ 927:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 92a:	89 15 64 0e 00 00    	mov    %edx,0xe64
+    p->s.size += bp->s.size;
+ 930:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 933:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 936:	89 0a                	mov    %ecx,(%edx)
+}
+ 938:	5b                   	pop    %ebx
+ 939:	5e                   	pop    %esi
+ 93a:	5f                   	pop    %edi
+ 93b:	5d                   	pop    %ebp
+ 93c:	c3                   	ret
+ 93d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000940 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 940:	55                   	push   %ebp
+ 941:	89 e5                	mov    %esp,%ebp
+ 943:	57                   	push   %edi
+ 944:	56                   	push   %esi
+ 945:	53                   	push   %ebx
+ 946:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 949:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 94c:	8b 15 64 0e 00 00    	mov    0xe64,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 952:	8d 78 07             	lea    0x7(%eax),%edi
+ 955:	c1 ef 03             	shr    $0x3,%edi
+ 958:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 95b:	85 d2                	test   %edx,%edx
+ 95d:	0f 84 8d 00 00 00    	je     9f0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 963:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 965:	8b 48 04             	mov    0x4(%eax),%ecx
+ 968:	39 f9                	cmp    %edi,%ecx
+ 96a:	73 64                	jae    9d0 <malloc+0x90>
+  if(nu < 4096)
+ 96c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 971:	39 df                	cmp    %ebx,%edi
+ 973:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 976:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 97d:	eb 0a                	jmp    989 <malloc+0x49>
+ 97f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 980:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 982:	8b 48 04             	mov    0x4(%eax),%ecx
+ 985:	39 f9                	cmp    %edi,%ecx
+ 987:	73 47                	jae    9d0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 989:	89 c2                	mov    %eax,%edx
+ 98b:	39 05 64 0e 00 00    	cmp    %eax,0xe64
+ 991:	75 ed                	jne    980 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 993:	83 ec 0c             	sub    $0xc,%esp
+ 996:	56                   	push   %esi
+ 997:	e8 7f fc ff ff       	call   61b <sbrk>
+  if(p == (char*)-1)
+ 99c:	83 c4 10             	add    $0x10,%esp
+ 99f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9a2:	74 1c                	je     9c0 <malloc+0x80>
+  hp->s.size = nu;
+ 9a4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9a7:	83 ec 0c             	sub    $0xc,%esp
+ 9aa:	83 c0 08             	add    $0x8,%eax
+ 9ad:	50                   	push   %eax
+ 9ae:	e8 fd fe ff ff       	call   8b0 <free>
+  return freep;
+ 9b3:	8b 15 64 0e 00 00    	mov    0xe64,%edx
+      if((p = morecore(nunits)) == 0)
+ 9b9:	83 c4 10             	add    $0x10,%esp
+ 9bc:	85 d2                	test   %edx,%edx
+ 9be:	75 c0                	jne    980 <malloc+0x40>
+        return 0;
+  }
+}
+ 9c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 9c3:	31 c0                	xor    %eax,%eax
+}
+ 9c5:	5b                   	pop    %ebx
+ 9c6:	5e                   	pop    %esi
+ 9c7:	5f                   	pop    %edi
+ 9c8:	5d                   	pop    %ebp
+ 9c9:	c3                   	ret
+ 9ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 9d0:	39 cf                	cmp    %ecx,%edi
+ 9d2:	74 4c                	je     a20 <malloc+0xe0>
+        p->s.size -= nunits;
+ 9d4:	29 f9                	sub    %edi,%ecx
+ 9d6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 9d9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 9dc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 9df:	89 15 64 0e 00 00    	mov    %edx,0xe64
+}
+ 9e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 9e8:	83 c0 08             	add    $0x8,%eax
+}
+ 9eb:	5b                   	pop    %ebx
+ 9ec:	5e                   	pop    %esi
+ 9ed:	5f                   	pop    %edi
+ 9ee:	5d                   	pop    %ebp
+ 9ef:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 9f0:	c7 05 64 0e 00 00 68 	movl   $0xe68,0xe64
+ 9f7:	0e 00 00 
+    base.s.size = 0;
+ 9fa:	b8 68 0e 00 00       	mov    $0xe68,%eax
+    base.s.ptr = freep = prevp = &base;
+ 9ff:	c7 05 68 0e 00 00 68 	movl   $0xe68,0xe68
+ a06:	0e 00 00 
+    base.s.size = 0;
+ a09:	c7 05 6c 0e 00 00 00 	movl   $0x0,0xe6c
+ a10:	00 00 00 
+    if(p->s.size >= nunits){
+ a13:	e9 54 ff ff ff       	jmp    96c <malloc+0x2c>
+ a18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a1f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a20:	8b 08                	mov    (%eax),%ecx
+ a22:	89 0a                	mov    %ecx,(%edx)
+ a24:	eb b9                	jmp    9df <malloc+0x9f>
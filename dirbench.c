@@ -0,0 +1,97 @@
+// Measure how directory operations scale with directory size.
+// dirbench [n] creates n files (default 10000) in one new
+// directory, then opens each of them again, then removes them.
+// Each phase prints the ticks taken by each tenth of its files,
+// which stay flat if lookups do not scan the whole directory.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define NSTEP 10
+
+char *dir = "dirbench.d";
+
+void
+name(char *buf, int i)
+{
+  int j, n;
+
+  buf[0] = 'f';
+  for(n = i, j = 1; n >= 10; n /= 10)
+    j++;
+  buf[j+1] = '\0';
+  for(; j > 0; j--, i /= 10)
+    buf[j] = '0' + i%10;
+}
+
+// Run op on files 0..n-1, printing ticks per tenth.
+void
+phase(char *what, int n, int (*op)(char*))
+{
+  char buf[16];
+  int i, step;
+  uint start;
+
+  printf(1, "dirbench: %s ticks per %d files:", what, n/NSTEP);
+  step = n / NSTEP;
+  start = uptime();
+  for(i = 0; i < n; i++){
+    name(buf, i);
+    if(op(buf) < 0){
+      printf(1, "\ndirbench: %s %s failed\n", what, buf);
+      exit();
+    }
+    if((i+1) % step == 0){
+      printf(1, " %d", uptime() - start);
+      start = uptime();
+    }
+  }
+  printf(1, "\n");
+}
+
+int
+createone(char *path)
+{
+  int fd;
+
+  if((fd = open(path, O_CREATE|O_RDWR)) < 0)
+    return -1;
+  close(fd);
+  return 0;
+}
+
+int
+lookupone(char *path)
+{
+  int fd;
+
+  if((fd = open(path, O_RDONLY)) < 0)
+    return -1;
+  close(fd);
+  return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int n;
+
+  n = 10000;
+  if(argc > 1)
+    n = atoi(argv[1]);
+  if(n < NSTEP)
+    n = NSTEP;
+
+  if(mkdir(dir) < 0 || chdir(dir) < 0){
+    printf(1, "dirbench: cannot make %s\n", dir);
+    exit();
+  }
+  phase("create", n, createone);
+  phase("lookup", n, lookupone);
+  phase("unlink", n, unlink);
+  chdir("..");
+  unlink(dir);
+  exit();
+}
@@ -5,11 +5,14 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "fs.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
 
+#define min(a, b) ((a) < (b) ? (a) : (b))
+
 struct devsw devsw[NDEV];
 struct {
   struct spinlock lock;
@@ -112,46 +115,185 @@ fileread(struct file *f, char *addr, int n)
   panic("fileread");
 }
 
+// Return how many of n bytes written to ip at off fit in one log
+// transaction of at most log_opmax() blocks.  A write cut short
+// ends on a block boundary, so the next one starts with a whole
+// block.
+static int
+opbytes(struct inode *ip, uint off, int n)
+{
+  int m;
+  uint nb, max;
+
+  max = log_opmax();
+  m = n;
+  while(m > BSIZE && (nb = writeiblocks(ip, off, m)) > max)
+    m -= min(m - BSIZE, (nb - max) * BSIZE);
+  if(m < n && m > (off + m) % BSIZE)
+    m -= (off + m) % BSIZE;
+  return m;
+}
+
+// Write n bytes from addr to the inode file f at its offset,
+// in as few log transactions as the log allows, each reserving
+// only the blocks its writei() can log.  Returns the number of
+// bytes written, which is short if an extent-mapped file runs
+// out of extents, or -1 if none could be written.
+static int
+filewritei(struct file *f, char *addr, int n)
+{
+  int i, n1, r;
+  uint off;
+
+  r = 0;
+  for(i = 0; i < n; ){
+    off = f->off;
+    n1 = opbytes(f->ip, off, n - i);
+    begin_opn(writeiblocks(f->ip, off, n1));
+    ilock(f->ip);
+    if(f->off != off){
+      // Another writer sharing f moved the offset, so the
+      // reservation may be too small; size the write again.
+      iunlock(f->ip);
+      end_op();
+      continue;
+    }
+    if((r = writei(f->ip, addr + i, off, n1)) > 0)
+      f->off += r;
+    iunlock(f->ip);
+    end_op();
+
+    if(r > 0)
+      i += r;
+    if(r != n1)
+      break;
+  }
+  return i > 0 || n == 0 ? i : -1;
+}
+
 //PAGEBREAK!
-// Write to file f.
+// Write to file f.  Returns the number of bytes written,
+// which may be less than n, or -1.
 int
 filewrite(struct file *f, char *addr, int n)
 {
-  int r;
-
   if(f->writable == 0)
     return -1;
   if(f->type == FD_PIPE)
     return pipewrite(f->pipe, addr, n);
-  if(f->type == FD_INODE){
-    // write a few blocks at a time to avoid exceeding
-    // the maximum log transaction size, including
-    // i-node, indirect block, allocation blocks,
-    // and 2 blocks of slop for non-aligned writes.
-    // this really belongs lower down, since writei()
-    // might be writing a device like the console.
-    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
-    int i = 0;
-    while(i < n){
-      int n1 = n - i;
-      if(n1 > max)
-        n1 = max;
-
-      begin_op();
-      ilock(f->ip);
-      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
-        f->off += r;
-      iunlock(f->ip);
-      end_op();
+  if(f->type == FD_INODE)
+    return filewritei(f, addr, n);
+  panic("filewrite");
+}
 
-      if(r < 0)
+//PAGEBREAK!
+// Move up to n bytes between file in and file out, one of
+// which must be a pipe and the other an inode, without copying
+// through user space.  From an inode, moves up to n bytes, as
+// many as the inode holds.  From a pipe, waits for data like
+// read() and moves what is there, up to n bytes.  Returns the
+// number of bytes moved, 0 at end of file, or -1.
+int
+filesplice(struct file *in, struct file *out, int n)
+{
+  int r, m, tot;
+  char *a;
+
+  if(in->readable == 0 || out->writable == 0 || n < 0)
+    return -1;
+
+  if(in->type == FD_INODE && out->type == FD_PIPE){
+    r = 0;
+    for(tot = 0; tot < n; tot += r){
+      m = n - tot;
+      if((a = pipewbegin(out->pipe, &m)) == 0)
+        return tot > 0 ? tot : -1;
+      ilock(in->ip);
+      if((r = readi(in->ip, a, in->off, m)) > 0)
+        in->off += r;
+      iunlock(in->ip);
+      pipewend(out->pipe, r > 0 ? r : 0);
+      if(r <= 0)
         break;
-      if(r != n1)
-        panic("short filewrite");
-      i += r;
     }
-    return i == n ? n : -1;
+    return r < 0 && tot == 0 ? -1 : tot;
   }
-  panic("filewrite");
+
+  if(in->type == FD_PIPE && out->type == FD_INODE){
+    m = n;
+    if((a = piperbegin(in->pipe, &m)) == 0)
+      return -1;
+    r = 0;
+    if(m > 0)
+      r = filewritei(out, a, m);
+    piperend(in->pipe, r > 0 ? r : 0);
+    return r;
+  }
+
+  return -1;
 }
 
+// Copy up to n bytes from inode file in to inode file out, at
+// their offsets, without copying through user space.  Each log
+// transaction reserves for as much of out as filewrite() would
+// write in one, and fills it a page at a time: read a page of in,
+// write it to out.  Returns the number of bytes copied, 0 at end
+// of file, or -1.
+int
+filecopy(struct file *in, struct file *out, int n)
+{
+  int r, w, m, done, tot, stop, err;
+  uint off;
+  char *buf;
+
+  if(in->readable == 0 || out->writable == 0 || n < 0)
+    return -1;
+  if(in->type != FD_INODE || out->type != FD_INODE)
+    return -1;
+  if((buf = kalloc()) == 0)
+    return -1;
+
+  stop = err = 0;
+  for(tot = 0; tot < n && !stop; tot += done){
+    off = out->off;
+    m = opbytes(out->ip, off, n - tot);
+    begin_opn(writeiblocks(out->ip, off, m));
+    for(done = 0; done < m; done += w){
+      ilock(in->ip);
+      if((r = readi(in->ip, buf, in->off, min(m - done, PGSIZE))) > 0)
+        in->off += r;
+      iunlock(in->ip);
+      if(r <= 0){
+        // End of in, or an error.
+        err = r < 0;
+        stop = 1;
+        break;
+      }
+
+      // Only write where the reservation was made for; another
+      // writer sharing out may have moved its offset.
+      w = 0;
+      ilock(out->ip);
+      if(out->off == off + done && (w = writei(out->ip, buf, out->off, r)) > 0)
+        out->off += w;
+      iunlock(out->ip);
+      if(w != r){
+        // Leave in's offset after what was copied.
+        if(w < 0)
+          w = 0;
+        in->off -= r - w;
+        done += w;
+        if(out->off == off + done){
+          // out cannot grow; otherwise size the next
+          // transaction again from out's new offset.
+          err = 1;
+          stop = 1;
+        }
+        break;
+      }
+    }
+    end_op();
+  }
+  kfree(buf);
+  return tot > 0 || !err ? tot : -1;
+}
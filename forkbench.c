@@ -0,0 +1,56 @@
+// Measure fork+exec latency as a function of the parent's size.
+// For each size the parent grows its heap, touches every page,
+// and then runs NITER rounds of fork(); the child immediately
+// exec()s this program with "-x", which exits at once.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "mmu.h"
+
+#define NITER 100
+
+int sizes[] = { 0, 1024*1024, 4*1024*1024, 16*1024*1024 };
+char *xargv[] = { "forkbench", "-x", 0 };
+
+int
+main(int argc, char *argv[])
+{
+  int i, j, pid;
+  uint start, elapsed, sz;
+  char *a, *base;
+
+  if(argc > 1 && strcmp(argv[1], "-x") == 0)
+    exit();
+
+  base = sbrk(0);
+  for(i = 0; i < sizeof(sizes)/sizeof(sizes[0]); i++){
+    sz = sizes[i];
+    a = sbrk(sz - (uint)(sbrk(0) - base));
+    if(a == (char*)-1){
+      printf(1, "forkbench: sbrk failed\n");
+      exit();
+    }
+    for(j = 0; j < sz; j += PGSIZE)
+      base[j] = j;
+
+    start = uptime();
+    for(j = 0; j < NITER; j++){
+      pid = fork();
+      if(pid < 0){
+        printf(1, "forkbench: fork failed\n");
+        exit();
+      }
+      if(pid == 0){
+        exec(xargv[0], xargv);
+        printf(1, "forkbench: exec failed\n");
+        exit();
+      }
+      wait();
+    }
+    elapsed = uptime() - start;
+    printf(1, "forkbench: heap %d KB: %d fork+exec in %d ticks\n",
+           sz/1024, NITER, elapsed);
+  }
+  exit();
+}
@@ -22,6 +22,9 @@
 #include "file.h"
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
+// Number of blocks, at most NBREADN, that n bytes at off touch.
+#define NBLOCKS(off, n) min(NBREADN, ((off)%BSIZE + (n) + BSIZE-1) / BSIZE)
+
 static void itrunc(struct inode*);
 // there should be one superblock per disk device, but we run with
 // only one device
@@ -44,7 +47,7 @@ bzero(int dev, int bno)
 {
   struct buf *bp;
 
-  bp = bread(dev, bno);
+  bp = bclaim(dev, bno);
   memset(bp->data, 0, BSIZE);
   log_write(bp);
   brelse(bp);
@@ -52,23 +55,39 @@ bzero(int dev, int bno)
 
 // Blocks.
 
-// Allocate a zeroed disk block.
+// Allocate up to *n zeroed disk blocks that are contiguous on
+// disk, searching the bitmap from block goal on.  Set *n to the
+// number allocated, at least 1, and return the first.  A run
+// does not extend past the bitmap block it starts in.
 static uint
-balloc(uint dev)
+ballocn(uint dev, uint goal, uint *n)
 {
-  int b, bi, m;
+  int b, bi, m, i, nbmap;
+  uint k;
   struct buf *bp;
 
+  if(goal >= sb.size)
+    goal = 0;
+  nbmap = (sb.size + BPB - 1) / BPB;
   bp = 0;
-  for(b = 0; b < sb.size; b += BPB){
+  for(i = 0; i <= nbmap; i++){
+    b = ((goal/BPB + i) % nbmap) * BPB;
     bp = bread(dev, BBLOCK(b, sb));
-    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+    for(bi = (i == 0 ? goal%BPB : 0); bi < BPB && b + bi < sb.size; bi++){
       m = 1 << (bi % 8);
       if((bp->data[bi/8] & m) == 0){  // Is block free?
-        bp->data[bi/8] |= m;  // Mark block in use.
+        // Take the free blocks that follow it too, up to *n.
+        for(k = 0; k < *n && bi + k < BPB && b + bi + k < sb.size; k++){
+          m = 1 << ((bi + k) % 8);
+          if(bp->data[(bi + k)/8] & m)
+            break;
+          bp->data[(bi + k)/8] |= m;  // Mark block in use.
+        }
         log_write(bp);
         brelse(bp);
-        bzero(dev, b + bi);
+        *n = k;
+        for(k = 0; k < *n; k++)
+          bzero(dev, b + bi + k);
         return b + bi;
       }
     }
@@ -77,6 +96,15 @@ balloc(uint dev)
   panic("balloc: out of blocks");
 }
 
+// Allocate a zeroed disk block.
+static uint
+balloc(uint dev)
+{
+  uint n = 1;
+
+  return ballocn(dev, 0, &n);
+}
+
 // Free a disk block.
 static void
 bfree(int dev, uint b)
@@ -125,7 +153,9 @@ bfree(int dev, uint b)
 //   the number of in-memory pointers to the entry (open
 //   files and current directories). iget() finds or
 //   creates a cache entry and increments its ref; iput()
-//   decrements ref.
+//   decrements ref.  Free entries stay hashed, and valid,
+//   on an LRU list, so iget() can reuse them until they
+//   are recycled for another inode.
 //
 // * Valid: the information (type, size, &c) in an inode
 //   cache entry is only correct when ip->valid is 1.
@@ -155,29 +185,49 @@ bfree(int dev, uint b)
 // have locked the inodes involved; this lets callers create
 // multi-step atomic operations.
 //
-// The icache.lock spin-lock protects the allocation of icache
-// entries. Since ip->ref indicates whether an entry is free,
-// and ip->dev and ip->inum indicate which i-node an entry
+// The icache is a hash table on (dev, inum), and grows a page of
+// entries at a time, up to NINODE entries and beyond that only
+// if none is free.
+//
+// The icache.lock reader-writer spin-lock protects the allocation
+// of icache entries. Since ip->ref indicates whether an entry is
+// free, and ip->dev and ip->inum indicate which i-node an entry
 // holds, one must hold icache.lock while using any of those fields.
+// Changing the hash chains or the free list, and so taking an
+// entry's ref to or from zero, needs the lock for writing;
+// finding a cached entry and adding to its ref need only read
+// it, and change ref atomically.  Dropping a ref that is not
+// the last needs no lock at all.
 //
 // An ip->lock sleep-lock protects all ip-> fields other than ref,
 // dev, and inum.  One must hold ip->lock in order to
 // read or write that inode's ip->valid, ip->size, ip->type, &c.
+// Code that only reads a directory, such as path lookup, may
+// hold ip->lock shared, with ilockread(), so that lookups in
+// the same directory run in parallel.
+
+#define NIHASH 127
 
 struct {
-  struct spinlock lock;
-  struct inode inode[NINODE];
+  struct rwspinlock lock;
+  struct inode *hash[NIHASH];
+  struct inode lru;   // Free entries, most recently used first
+  int ninode;         // Entries allocated
 } icache;
 
+#define IHASH(dev, inum) (&icache.hash[((dev)*31 + (inum)) % NIHASH])
+
+static void dcinit(void);
+static void dxfree(struct inode*);
+static void dcpurge(uint, uint);
+
 void
 iinit(int dev)
 {
-  int i = 0;
-  
-  initlock(&icache.lock, "icache");
-  for(i = 0; i < NINODE; i++) {
-    initsleeplock(&icache.inode[i].lock, "inode");
-  }
+  initrwlock(&icache.lock, "icache");
+  icache.lru.prev = &icache.lru;
+  icache.lru.next = &icache.lru;
+  dcinit();
 
   readsb(dev, &sb);
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
@@ -188,6 +238,11 @@ iinit(int dev)
 
 static struct inode* iget(uint dev, uint inum);
 
+// Inode number to start the next ialloc() search at, so that
+// allocation does not rescan the inodes in use.  Only a hint,
+// so it needs no lock.
+static uint inext = 1;
+
 //PAGEBREAK!
 // Allocate an inode on device dev.
 // Mark it as allocated by  giving it type type.
@@ -195,19 +250,27 @@ static struct inode* iget(uint dev, uint inum);
 struct inode*
 ialloc(uint dev, short type)
 {
-  int inum;
+  uint inum, n, m, i;
   struct buf *bp;
   struct dinode *dip;
 
-  for(inum = 1; inum < sb.ninodes; inum++){
+  // Search a block of inodes at a time, from inext round.
+  for(n = 0; n < sb.ninodes; n += m){
+    inum = (inext + n) % sb.ninodes;
+    m = IPB - inum%IPB;
     bp = bread(dev, IBLOCK(inum, sb));
-    dip = (struct dinode*)bp->data + inum%IPB;
-    if(dip->type == 0){  // a free inode
-      memset(dip, 0, sizeof(*dip));
-      dip->type = type;
-      log_write(bp);   // mark it allocated on the disk
-      brelse(bp);
-      return iget(dev, inum);
+    for(i = 0; i < m; i++, inum++){
+      if(inum == 0 || inum >= sb.ninodes)
+        continue;
+      dip = (struct dinode*)bp->data + inum%IPB;
+      if(dip->type == 0){  // a free inode
+        memset(dip, 0, sizeof(*dip));
+        dip->type = type;
+        log_write(bp);   // mark it allocated on the disk
+        brelse(bp);
+        inext = inum + 1;
+        return iget(dev, inum);
+      }
     }
     brelse(bp);
   }
@@ -229,6 +292,7 @@ iupdate(struct inode *ip)
   dip->type = ip->type;
   dip->major = ip->major;
   dip->minor = ip->minor;
+  dip->flags = ip->flags;
   dip->nlink = ip->nlink;
   dip->size = ip->size;
   memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
@@ -236,38 +300,92 @@ iupdate(struct inode *ip)
   brelse(bp);
 }
 
+// Add a page of free entries to the icache.
+// Returns 0 if there is no memory.  Caller must hold
+// icache.lock for writing.
+static int
+igrow(void)
+{
+  struct inode *ip;
+  char *page;
+
+  if((page = kalloc()) == 0)
+    return 0;
+  memset(page, 0, PGSIZE);
+  for(ip = (struct inode*)page; ip+1 <= (struct inode*)(page+PGSIZE); ip++){
+    initsleeplock(&ip->lock, "inode");
+    ip->next = icache.lru.next;
+    ip->prev = &icache.lru;
+    icache.lru.next->prev = ip;
+    icache.lru.next = ip;
+    icache.ninode++;
+  }
+  return 1;
+}
+
 // Find the inode with number inum on device dev
 // and return the in-memory copy. Does not lock
 // the inode and does not read it from disk.
 static struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
+  struct inode *ip, **pp;
+  int r;
+
+  // Is the inode already cached and in use?  A reference
+  // may be added under the read lock, but only to an entry
+  // that already has one, since a free entry may be recycled.
+  acquireread(&icache.lock);
+  for(ip = *IHASH(dev, inum); ip; ip = ip->hnext){
+    if(ip->dev != dev || ip->inum != inum)
+      continue;
+    while((r = ip->ref) > 0){
+      if(__sync_bool_compare_and_swap(&ip->ref, r, r+1)){
+        releaseread(&icache.lock);
+        return ip;
+      }
+    }
+    break;
+  }
+  releaseread(&icache.lock);
 
-  acquire(&icache.lock);
+  acquirewrite(&icache.lock);
 
-  // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-      ip->ref++;
-      release(&icache.lock);
+  // Look again, in case it was added or freed meanwhile.
+  for(ip = *IHASH(dev, inum); ip; ip = ip->hnext){
+    if(ip->dev == dev && ip->inum == inum){
+      if(__sync_fetch_and_add(&ip->ref, 1) == 0){
+        // Take it off the free list, still valid.
+        ip->prev->next = ip->next;
+        ip->next->prev = ip->prev;
+      }
+      releasewrite(&icache.lock);
       return ip;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
   }
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
+  // Recycle the least recently used free entry, or
+  // grow the cache if it is small or none is free.
+  if((icache.ninode < NINODE || icache.lru.prev == &icache.lru) &&
+     !igrow() && icache.lru.prev == &icache.lru)
     panic("iget: no inodes");
+  ip = icache.lru.prev;
+  ip->prev->next = ip->next;
+  ip->next->prev = ip->prev;
+  if(ip->inum != 0){
+    for(pp = IHASH(ip->dev, ip->inum); *pp != ip; pp = &(*pp)->hnext)
+      ;
+    *pp = ip->hnext;
+  }
 
-  ip = empty;
   ip->dev = dev;
   ip->inum = inum;
   ip->ref = 1;
   ip->valid = 0;
-  release(&icache.lock);
+  pp = IHASH(dev, inum);
+  ip->hnext = *pp;
+  *pp = ip;
+  releasewrite(&icache.lock);
 
   return ip;
 }
@@ -277,9 +395,9 @@ iget(uint dev, uint inum)
 struct inode*
 idup(struct inode *ip)
 {
-  acquire(&icache.lock);
-  ip->ref++;
-  release(&icache.lock);
+  acquireread(&icache.lock);
+  __sync_fetch_and_add(&ip->ref, 1);
+  releaseread(&icache.lock);
   return ip;
 }
 
@@ -302,6 +420,7 @@ ilock(struct inode *ip)
     ip->type = dip->type;
     ip->major = dip->major;
     ip->minor = dip->minor;
+    ip->flags = dip->flags;
     ip->nlink = dip->nlink;
     ip->size = dip->size;
     memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
@@ -322,6 +441,36 @@ iunlock(struct inode *ip)
   releasesleep(&ip->lock);
 }
 
+// Lock the given inode shared with other readers.
+// The caller may only read ip and its content.
+void
+ilockread(struct inode *ip)
+{
+  if(ip == 0 || ip->ref < 1)
+    panic("ilockread");
+
+  acquiresleepread(&ip->lock);
+
+  // Reading the inode in needs the lock exclusively.  Once
+  // valid it stays so while we hold a reference.
+  if(ip->valid == 0){
+    releasesleepread(&ip->lock);
+    ilock(ip);
+    iunlock(ip);
+    acquiresleepread(&ip->lock);
+  }
+}
+
+// Unlock an inode locked with ilockread().
+void
+iunlockread(struct inode *ip)
+{
+  if(ip == 0 || ip->lock.readers < 1 || ip->ref < 1)
+    panic("iunlockread");
+
+  releasesleepread(&ip->lock);
+}
+
 // Drop a reference to an in-memory inode.
 // If that was the last reference, the inode cache entry can
 // be recycled.
@@ -332,13 +481,17 @@ iunlock(struct inode *ip)
 void
 iput(struct inode *ip)
 {
+  int r;
+
   acquiresleep(&ip->lock);
   if(ip->valid && ip->nlink == 0){
-    acquire(&icache.lock);
-    int r = ip->ref;
-    release(&icache.lock);
+    acquireread(&icache.lock);
+    r = ip->ref;
+    releaseread(&icache.lock);
     if(r == 1){
       // inode has no links and no other references: truncate and free.
+      if(ip->type == T_DIR)
+        dcpurge(ip->dev, ip->inum);
       itrunc(ip);
       ip->type = 0;
       iupdate(ip);
@@ -347,9 +500,20 @@ iput(struct inode *ip)
   }
   releasesleep(&ip->lock);
 
-  acquire(&icache.lock);
-  ip->ref--;
-  release(&icache.lock);
+  // Not the last reference?
+  while((r = ip->ref) > 1)
+    if(__sync_bool_compare_and_swap(&ip->ref, r, r-1))
+      return;
+
+  acquirewrite(&icache.lock);
+  if(__sync_sub_and_fetch(&ip->ref, 1) == 0){
+    // Most recently used free entry.
+    ip->next = icache.lru.next;
+    ip->prev = &icache.lru;
+    icache.lru.next->prev = ip;
+    icache.lru.next = ip;
+  }
+  releasewrite(&icache.lock);
 }
 
 // Common idiom: unlock, then put.
@@ -366,14 +530,18 @@ iunlockput(struct inode *ip)
 // The content (data) associated with each inode is stored
 // in blocks on the disk. The first NDIRECT block numbers
 // are listed in ip->addrs[].  The next NINDIRECT blocks are
-// listed in block ip->addrs[NDIRECT].
+// listed in block ip->addrs[NDIRECT].  The next NDINDIRECT
+// blocks hang off ip->addrs[NDIRECT+1] through two levels of
+// indirect blocks, and the next NTINDIRECT off ip->addrs[NDIRECT+2]
+// through three.
 
 // Return the disk block address of the nth block in inode ip.
 // If there is no such block, bmap allocates one.
 static uint
 bmap(struct inode *ip, uint bn)
 {
-  uint addr, *a;
+  uint addr, *a, n, i;
+  int level;
   struct buf *bp;
 
   if(bn < NDIRECT){
@@ -383,21 +551,170 @@ bmap(struct inode *ip, uint bn)
   }
   bn -= NDIRECT;
 
-  if(bn < NINDIRECT){
-    // Load indirect block, allocating if necessary.
-    if((addr = ip->addrs[NDIRECT]) == 0)
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+  // Find the tree holding bn; it maps n blocks through
+  // level levels of indirect blocks.
+  for(level = 1, n = NINDIRECT; bn >= n; level++, n *= NINDIRECT){
+    if(level == 3)
+      panic("bmap: out of range");
+    bn -= n;
+  }
+
+  if((addr = ip->addrs[NDIRECT+level-1]) == 0)
+    ip->addrs[NDIRECT+level-1] = addr = balloc(ip->dev);
+  for(; level > 0; level--){
+    // Load indirect block, allocating the next one down if necessary.
+    n /= NINDIRECT;
+    i = bn / n;
+    bn %= n;
     bp = bread(ip->dev, addr);
     a = (uint*)bp->data;
-    if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
+    if((addr = a[i]) == 0){
+      a[i] = addr = balloc(ip->dev);
       log_write(bp);
     }
     brelse(bp);
-    return addr;
   }
+  return addr;
+}
 
-  panic("bmap: out of range");
+// Return slot i of the extent map whose first NEXTENT slots
+// are in direct and the rest in the extent block held in bp.
+static struct extent*
+extent(struct extent *direct, struct buf *bp, int i)
+{
+  if(i < NEXTENT)
+    return &direct[i];
+  return (struct extent*)bp->data + (i - NEXTENT);
+}
+
+// Return the disk block address of the nth block in the
+// extent-mapped inode ip, and set *run to the number of blocks,
+// at most max, that follow contiguously on disk.  If there is
+// no such block, emap allocates up to max blocks, growing the
+// last extent when the blocks after it are free.
+// Returns 0 if the extent map is full.
+static uint
+emap(struct inode *ip, uint bn, uint max, uint *run)
+{
+  struct extent *e, *ex, *last;
+  struct buf *bp;
+  uint lbn, addr, n;
+  int i;
+
+  e = (struct extent*)ip->addrs;
+  last = 0;
+  bp = 0;
+  lbn = 0;  // file block at the start of extent i
+  for(i = 0; i < NEXTENT + NIEXTENT; i++){
+    if(i == NEXTENT){
+      if(ip->addrs[NDIRECT+2] == 0)
+        break;
+      bp = bread(ip->dev, ip->addrs[NDIRECT+2]);
+    }
+    ex = extent(e, bp, i);
+    if(ex->len == 0)
+      break;
+    if(bn < lbn + ex->len){
+      addr = ex->start + (bn - lbn);
+      *run = ex->len - (bn - lbn);
+      if(*run > max)
+        *run = max;
+      if(bp)
+        brelse(bp);
+      return addr;
+    }
+    lbn += ex->len;
+    last = ex;
+  }
+
+  // Files only grow at the end, so bn is the first unmapped block.
+  if(bn != lbn)
+    panic("emap: hole");
+  n = max;
+  addr = ballocn(ip->dev, last ? last->start + last->len : 0, &n);
+  if(last && addr == last->start + last->len){
+    last->len += n;
+  } else if(i == NEXTENT + NIEXTENT){
+    for(; n > 0; n--)
+      bfree(ip->dev, addr + n - 1);
+    brelse(bp);
+    return 0;
+  } else {
+    if(i == NEXTENT){
+      ip->addrs[NDIRECT+2] = balloc(ip->dev);
+      bp = bread(ip->dev, ip->addrs[NDIRECT+2]);
+    }
+    ex = extent(e, bp, i);
+    ex->start = addr;
+    ex->len = n;
+  }
+  if(bp){
+    log_write(bp);
+    brelse(bp);
+  }
+  *run = n;
+  return addr;
+}
+
+// Like bmap, but also set *run to the number of blocks from
+// bn on, at most max, that are contiguous on disk.
+static uint
+bmaprun(struct inode *ip, uint bn, uint max, uint *run)
+{
+  if(ip->flags & I_EXTENT)
+    return emap(ip, bn, max, run);
+  *run = 1;
+  return bmap(ip, bn);
+}
+
+// Free the blocks of the extent-mapped inode ip.
+static void
+itruncext(struct inode *ip)
+{
+  struct extent *e;
+  struct buf *bp;
+  uint k;
+  int i;
+
+  e = (struct extent*)ip->addrs;
+  bp = 0;
+  for(i = 0; i < NEXTENT + NIEXTENT; i++){
+    if(i == NEXTENT){
+      if(ip->addrs[NDIRECT+2] == 0)
+        break;
+      bp = bread(ip->dev, ip->addrs[NDIRECT+2]);
+    }
+    if(extent(e, bp, i)->len == 0)
+      break;
+    for(k = 0; k < extent(e, bp, i)->len; k++)
+      bfree(ip->dev, extent(e, bp, i)->start + k);
+  }
+  if(bp){
+    brelse(bp);
+    bfree(ip->dev, ip->addrs[NDIRECT+2]);
+  }
+  memset(ip->addrs, 0, sizeof(ip->addrs));
+}
+
+// Free indirect block addr, with level levels of blocks
+// below it.  Level 0 is a data block.
+static void
+itruncind(uint dev, uint addr, int level)
+{
+  struct buf *bp;
+  uint *a;
+  int j;
+
+  if(level > 0){
+    bp = bread(dev, addr);
+    a = (uint*)bp->data;
+    for(j = 0; j < NINDIRECT; j++){
+      if(a[j])
+        itruncind(dev, a[j], level-1);
+    }
+    brelse(bp);
+  }
+  bfree(dev, addr);
 }
 
 // Truncate inode (discard contents).
@@ -408,9 +725,18 @@ bmap(struct inode *ip, uint bn)
 static void
 itrunc(struct inode *ip)
 {
-  int i, j;
-  struct buf *bp;
-  uint *a;
+  int i;
+
+  if(ip->flags & I_EXTENT){
+    itruncext(ip);
+    ip->size = 0;
+    iupdate(ip);
+    return;
+  }
+
+  // A directory's index is not an indirect block tree.
+  if(ip->type == T_DIR && ip->addrs[DXROOT])
+    dxfree(ip);
 
   for(i = 0; i < NDIRECT; i++){
     if(ip->addrs[i]){
@@ -419,16 +745,11 @@ itrunc(struct inode *ip)
     }
   }
 
-  if(ip->addrs[NDIRECT]){
-    bp = bread(ip->dev, ip->addrs[NDIRECT]);
-    a = (uint*)bp->data;
-    for(j = 0; j < NINDIRECT; j++){
-      if(a[j])
-        bfree(ip->dev, a[j]);
+  for(i = 0; i < 3; i++){
+    if(ip->addrs[NDIRECT+i]){
+      itruncind(ip->dev, ip->addrs[NDIRECT+i], i+1);
+      ip->addrs[NDIRECT+i] = 0;
     }
-    brelse(bp);
-    bfree(ip->dev, ip->addrs[NDIRECT]);
-    ip->addrs[NDIRECT] = 0;
   }
 
   ip->size = 0;
@@ -453,8 +774,8 @@ stati(struct inode *ip, struct stat *st)
 int
 readi(struct inode *ip, char *dst, uint off, uint n)
 {
-  uint tot, m;
-  struct buf *bp;
+  uint tot, m, addr, run, i;
+  struct buf *bp[NBREADN];
 
   if(ip->type == T_DEV){
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
@@ -467,11 +788,15 @@ readi(struct inode *ip, char *dst, uint off, uint n)
   if(off + n > ip->size)
     n = ip->size - off;
 
-  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
-    m = min(n - tot, BSIZE - off%BSIZE);
-    memmove(dst, bp->data + off%BSIZE, m);
-    brelse(bp);
+  for(tot=0; tot<n; ){
+    // Read as many of the remaining blocks as are contiguous.
+    addr = bmaprun(ip, off/BSIZE, NBLOCKS(off, n-tot), &run);
+    breadn(ip->dev, addr, run, bp);
+    for(i = 0; i < run; i++, tot+=m, off+=m, dst+=m){
+      m = min(n - tot, BSIZE - off%BSIZE);
+      memmove(dst, bp[i]->data + off%BSIZE, m);
+      brelse(bp[i]);
+    }
   }
   return n;
 }
@@ -482,7 +807,7 @@ readi(struct inode *ip, char *dst, uint off, uint n)
 int
 writei(struct inode *ip, char *src, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, addr, run, i;
   struct buf *bp;
 
   if(ip->type == T_DEV){
@@ -496,19 +821,64 @@ writei(struct inode *ip, char *src, uint off, uint n)
   if(off + n > MAXFILE*BSIZE)
     return -1;
 
-  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
-    m = min(n - tot, BSIZE - off%BSIZE);
-    memmove(bp->data + off%BSIZE, src, m);
-    log_write(bp);
-    brelse(bp);
+  for(tot=0; tot<n; ){
+    addr = bmaprun(ip, off/BSIZE, NBLOCKS(off, n-tot), &run);
+    if(addr == 0)
+      break;
+    for(i = 0; i < run; i++, tot+=m, off+=m, src+=m){
+      m = min(n - tot, BSIZE - off%BSIZE);
+      // Only a block the write covers in part needs reading.
+      if(m == BSIZE)
+        bp = bclaim(ip->dev, addr + i);
+      else
+        bp = bread(ip->dev, addr + i);
+      memmove(bp->data + off%BSIZE, src, m);
+      log_write(bp);
+      brelse(bp);
+    }
   }
 
-  if(n > 0 && off > ip->size){
+  if(tot > 0 && off > ip->size){
     ip->size = off;
     iupdate(ip);
   }
-  return n;
+  return tot;
+}
+
+// Return the most blocks writei(ip, src, off, n) can log: the
+// data blocks, the indirect or extent blocks that map them,
+// the free bitmap blocks recording their allocation and the
+// i-node.  Does not look at the blocks, so the caller need not
+// hold ip->lock.
+uint
+writeiblocks(struct inode *ip, uint off, uint n)
+{
+  uint b0, b1, lo, span, s, nmap, nalloc, nbmap;
+  int level;
+
+  if(ip->type == T_DEV || n == 0)
+    return 0;
+  b0 = off / BSIZE;
+  b1 = (off + n - 1) / BSIZE;
+
+  // Indirect blocks on the paths to blocks b0 through b1, at
+  // each level of each tree that holds some of them.
+  nmap = 0;
+  lo = NDIRECT;
+  for(level = 1, span = NINDIRECT; level <= 3; level++, span *= NINDIRECT){
+    if(b0 < lo + span && b1 >= lo)
+      for(s = span; s > 1; s /= NINDIRECT)
+        nmap += (min(b1, lo+span-1) - lo)/s - (b0 > lo ? b0 - lo : 0)/s + 1;
+    lo += span;
+  }
+  // An extent-mapped file needs at most its extent block, and
+  // O_EXTENT can make an empty file extent-mapped at any time.
+  if(nmap == 0)
+    nmap = 1;
+
+  nalloc = b1 - b0 + 1 + nmap;
+  nbmap = (sb.size + BPB - 1) / BPB;
+  return nalloc + min(nalloc, nbmap) + 1;
 }
 
 //PAGEBREAK!
@@ -520,17 +890,448 @@ namecmp(const char *s, const char *t)
   return strncmp(s, t, DIRSIZ);
 }
 
+// Directory name cache.
+//
+// Remembers the result of recent dirlookup() calls, keyed by
+// directory and name: the entry's inum and offset, or that the
+// name is absent (inum 0).  The cache is set-associative, with
+// DCWAYS entries per set, replaced round-robin.
+//
+// An entry for dp is only added while dp is locked (at least
+// shared), and only removed while dp is locked exclusively,
+// as it is by every change to dp's entries, so an entry is
+// never stale.  dcache.lock protects the table itself.
+
+#define DCWAYS 4
+#define NDCSET (NDCACHE/DCWAYS)
+
+struct dentry {
+  uint dev;
+  uint dinum;         // Directory inode number, 0 if unused
+  char name[DIRSIZ];
+  uint inum;          // 0 if name is not in the directory
+  uint off;           // Offset of entry in the directory
+};
+
+struct {
+  struct rwspinlock lock;
+  struct dentry ent[NDCSET][DCWAYS];
+  uchar victim[NDCSET];   // Next way to replace in each set
+} dcache;
+
+static void
+dcinit(void)
+{
+  initrwlock(&dcache.lock, "dcache");
+}
+
+static struct dentry*
+dcset(uint dev, uint dinum, char *name)
+{
+  uint h;
+  int i;
+
+  h = dev*31 + dinum;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = h*31 + (uchar)name[i];
+  return dcache.ent[h % NDCSET];
+}
+
+// Look up name in dp.  Returns 1 and sets *inum and *off if
+// the answer is cached, else 0.  Caller must hold dp->lock.
+static int
+dcget(struct inode *dp, char *name, uint *inum, uint *off)
+{
+  struct dentry *e;
+  int i;
+
+  acquireread(&dcache.lock);
+  e = dcset(dp->dev, dp->inum, name);
+  for(i = 0; i < DCWAYS; i++, e++){
+    if(e->dinum == dp->inum && e->dev == dp->dev &&
+       namecmp(e->name, name) == 0){
+      *inum = e->inum;
+      *off = e->off;
+      releaseread(&dcache.lock);
+      return 1;
+    }
+  }
+  releaseread(&dcache.lock);
+  return 0;
+}
+
+// Remember that name in dp is inum at off, or absent if inum
+// is 0.  Caller must hold dp->lock.
+static void
+dcput(struct inode *dp, char *name, uint inum, uint off)
+{
+  struct dentry *set, *e;
+  int i;
+
+  acquirewrite(&dcache.lock);
+  set = dcset(dp->dev, dp->inum, name);
+  e = 0;
+  for(i = 0; i < DCWAYS; i++){
+    if(set[i].dinum == dp->inum && set[i].dev == dp->dev &&
+       namecmp(set[i].name, name) == 0){
+      e = &set[i];
+      break;
+    }
+    if(e == 0 && set[i].dinum == 0)
+      e = &set[i];
+  }
+  if(e == 0){
+    i = dcache.victim[(set - dcache.ent[0]) / DCWAYS]++ % DCWAYS;
+    e = &set[i];
+  }
+  e->dev = dp->dev;
+  e->dinum = dp->inum;
+  strncpy(e->name, name, DIRSIZ);
+  e->inum = inum;
+  e->off = off;
+  releasewrite(&dcache.lock);
+}
+
+// Forget what the cache knows about name in dp, which is
+// about to change.  Caller must hold dp->lock exclusively.
+void
+dcinvalidate(struct inode *dp, char *name)
+{
+  struct dentry *e;
+  int i;
+
+  acquirewrite(&dcache.lock);
+  e = dcset(dp->dev, dp->inum, name);
+  for(i = 0; i < DCWAYS; i++, e++)
+    if(e->dinum == dp->inum && e->dev == dp->dev &&
+       namecmp(e->name, name) == 0)
+      e->dinum = 0;
+  releasewrite(&dcache.lock);
+}
+
+// Forget every name in directory inum on dev, which is
+// being freed, so that a new directory reusing it starts clean.
+static void
+dcpurge(uint dev, uint inum)
+{
+  struct dentry *e;
+
+  acquirewrite(&dcache.lock);
+  for(e = dcache.ent[0]; e < dcache.ent[NDCSET]; e++)
+    if(e->dinum == inum && e->dev == dev)
+      e->dinum = 0;
+  releasewrite(&dcache.lock);
+}
+
+// Directory index.  See fs.h for the format.
+
+// Return the slot in index node n to follow for hash h:
+// the last whose hash is at most h.
+static int
+dxfind(struct dxnode *n, uint h)
+{
+  int lo, hi, mid;
+
+  lo = 0;
+  hi = n->count - 1;
+  while(lo < hi){
+    mid = (lo + hi + 1) / 2;
+    if(n->e[mid].hash <= h)
+      lo = mid;
+    else
+      hi = mid - 1;
+  }
+  return lo;
+}
+
+// Walk dp's index down to the leaf for hash h, and return the
+// leaf's block number within dp.  If path is not 0, record the
+// index nodes visited in path[], the slots followed in slot[],
+// and their number in *nlevel.
+static uint
+dxleaf(struct inode *dp, uint h, uint *path, int *slot, int *nlevel)
+{
+  struct buf *bp;
+  struct dxnode *n;
+  uint addr, next;
+  int i, lvl, depth;
+
+  addr = dp->addrs[DXROOT];
+  for(lvl = 0; ; lvl++){
+    bp = bread(dp->dev, addr);
+    n = (struct dxnode*)bp->data;
+    i = dxfind(n, h);
+    next = n->e[i].block;
+    depth = n->depth;
+    brelse(bp);
+    if(path){
+      path[lvl] = addr;
+      slot[lvl] = i;
+    }
+    if(depth == 0)
+      break;
+    addr = next;
+  }
+  if(nlevel)
+    *nlevel = lvl + 1;
+  return next;
+}
+
+// Give a one-block directory an index, with its block as the
+// only leaf.
+static void
+dxcreate(struct inode *dp)
+{
+  struct buf *bp;
+  struct dxnode *n;
+
+  dp->addrs[DXROOT] = balloc(dp->dev);
+  bp = bread(dp->dev, dp->addrs[DXROOT]);
+  n = (struct dxnode*)bp->data;
+  n->depth = 0;
+  n->count = 1;
+  n->e[0].hash = 0;
+  n->e[0].block = 0;
+  log_write(bp);
+  brelse(bp);
+  iupdate(dp);
+}
+
+// Free the index of dp.  The leaves are freed with the rest
+// of its data.
+static void
+dxfree(struct inode *dp)
+{
+  struct buf *bp;
+  struct dxnode *n;
+  int i;
+
+  bp = bread(dp->dev, dp->addrs[DXROOT]);
+  n = (struct dxnode*)bp->data;
+  if(n->depth > 0)
+    for(i = 0; i < n->count; i++)
+      bfree(dp->dev, n->e[i].block);
+  brelse(bp);
+  bfree(dp->dev, dp->addrs[DXROOT]);
+  dp->addrs[DXROOT] = 0;
+}
+
+// Insert e after slot i in the index node at addr, which
+// must have room.
+static void
+dxinsert(uint dev, uint addr, int i, uint hash, uint block)
+{
+  struct buf *bp;
+  struct dxnode *n;
+
+  bp = bread(dev, addr);
+  n = (struct dxnode*)bp->data;
+  memmove(&n->e[i+2], &n->e[i+1], (n->count - i - 1) * sizeof(n->e[0]));
+  n->e[i+1].hash = hash;
+  n->e[i+1].block = block;
+  n->count++;
+  log_write(bp);
+  brelse(bp);
+}
+
+// Make room for another entry in the index node that is the
+// parent of a leaf, found by dxleaf().  Returns 0 if it has room,
+// 1 if the index was rearranged to make some, and -1 if the
+// index is full.
+static int
+dxroom(struct inode *dp, uint *path, int *slot, int nlevel)
+{
+  struct buf *bp, *nbp;
+  struct dxnode *n, *nn;
+  uint addr;
+  int full, half;
+
+  bp = bread(dp->dev, path[nlevel-1]);
+  full = ((struct dxnode*)bp->data)->count == NDXENTRY;
+  brelse(bp);
+  if(!full)
+    return 0;
+
+  if(nlevel == 1){
+    // The root points at leaves: move its entries down
+    // into a new node and point the root at that.
+    addr = balloc(dp->dev);
+    bp = bread(dp->dev, path[0]);
+    nbp = bread(dp->dev, addr);
+    memmove(nbp->data, bp->data, BSIZE);
+    n = (struct dxnode*)bp->data;
+    n->depth = 1;
+    n->count = 1;
+    n->e[0].hash = 0;
+    n->e[0].block = addr;
+    log_write(nbp);
+    log_write(bp);
+    brelse(nbp);
+    brelse(bp);
+    return 1;
+  }
+
+  // Split the full node in two, if the root has room for another.
+  bp = bread(dp->dev, path[0]);
+  full = ((struct dxnode*)bp->data)->count == NDXENTRY;
+  brelse(bp);
+  if(full)
+    return -1;
+  addr = balloc(dp->dev);
+  bp = bread(dp->dev, path[1]);
+  nbp = bread(dp->dev, addr);
+  n = (struct dxnode*)bp->data;
+  nn = (struct dxnode*)nbp->data;
+  half = n->count / 2;
+  nn->depth = 0;
+  nn->count = n->count - half;
+  memmove(nn->e, &n->e[half], nn->count * sizeof(n->e[0]));
+  n->count = half;
+  log_write(nbp);
+  log_write(bp);
+  dxinsert(dp->dev, path[0], slot[0], nn->e[0].hash, addr);
+  brelse(nbp);
+  brelse(bp);
+  return 1;
+}
+
+#define DIST(a, b) ((a) > (b) ? (a) - (b) : (b) - (a))
+
+// Split the full leaf holding hash h, moving the upper half of
+// its entries, by hash, to a new leaf at the end of dp and adding
+// that to the index node parent after slot i.  Returns -1 if the
+// leaf cannot be split because its names all hash alike.
+static int
+dxsplit(struct inode *dp, uint leaf, uint h, uint parent, int i)
+{
+  struct buf *bp, *nbp;
+  struct dirent *de, *nde;
+  uint hash[DPB+1], m, t, nleaf, addr;
+  int j, k, n, mid;
+
+  // Sort the hashes of the entries and the new name, and
+  // split at the change of value nearest the middle.
+  bp = bread(dp->dev, bmap(dp, leaf));
+  de = (struct dirent*)bp->data;
+  for(j = 0; j < DPB; j++)
+    hash[j] = dxhash(de[j].name);
+  hash[DPB] = h;
+  brelse(bp);
+  for(j = 1; j <= DPB; j++){
+    t = hash[j];
+    for(k = j; k > 0 && hash[k-1] > t; k--)
+      hash[k] = hash[k-1];
+    hash[k] = t;
+  }
+  mid = (DPB+1) / 2;
+  k = 0;
+  for(j = 1; j <= DPB; j++)
+    if(hash[j-1] != hash[j] && (k == 0 || DIST(j, mid) < DIST(k, mid)))
+      k = j;
+  if(k == 0)
+    return -1;
+  m = hash[k];
+
+  nleaf = dp->size / BSIZE;
+  addr = bmap(dp, nleaf);
+  dp->size += BSIZE;
+  iupdate(dp);
+
+  bp = bread(dp->dev, bmap(dp, leaf));
+  nbp = bread(dp->dev, addr);
+  de = (struct dirent*)bp->data;
+  nde = (struct dirent*)nbp->data;
+  for(j = n = 0; j < DPB; j++){
+    if(dxhash(de[j].name) >= m){
+      // Its offset changes.
+      dcinvalidate(dp, de[j].name);
+      nde[n++] = de[j];
+      memset(&de[j], 0, sizeof(de[j]));
+    }
+  }
+  log_write(bp);
+  log_write(nbp);
+  brelse(nbp);
+  brelse(bp);
+
+  dxinsert(dp->dev, parent, i, m, nleaf);
+  return 0;
+}
+
+// Add (name, inum) to the indexed directory dp.
+static int
+dxlink(struct inode *dp, char *name, uint inum)
+{
+  struct buf *bp;
+  struct dirent *de;
+  uint h, leaf, path[2];
+  int i, r, slot[2], nlevel;
+
+  h = dxhash(name);
+  for(;;){
+    leaf = dxleaf(dp, h, path, slot, &nlevel);
+    bp = bread(dp->dev, bmap(dp, leaf));
+    de = (struct dirent*)bp->data;
+    for(i = 0; i < DPB; i++){
+      if(de[i].inum == 0){
+        strncpy(de[i].name, name, DIRSIZ);
+        de[i].inum = inum;
+        log_write(bp);
+        brelse(bp);
+        return 0;
+      }
+    }
+    brelse(bp);
+
+    // The leaf is full: split it and try again.
+    if((r = dxroom(dp, path, slot, nlevel)) < 0)
+      return -1;
+    if(r == 0 && dxsplit(dp, leaf, h, path[nlevel-1], slot[nlevel-1]) < 0)
+      return -1;
+  }
+}
+
 // Look for a directory entry in a directory.
 // If found, set *poff to byte offset of entry.
+// Caller must hold dp->lock, shared or exclusive.
 struct inode*
 dirlookup(struct inode *dp, char *name, uint *poff)
 {
-  uint off, inum;
-  struct dirent de;
+  uint off, inum, leaf;
+  struct dirent de, *dep;
+  struct buf *bp;
+  int i;
 
   if(dp->type != T_DIR)
     panic("dirlookup not DIR");
 
+  if(dcget(dp, name, &inum, &off)){
+    if(inum == 0)
+      return 0;
+    if(poff)
+      *poff = off;
+    return iget(dp->dev, inum);
+  }
+
+  // In an indexed directory, only one leaf can hold name.
+  if(dp->addrs[DXROOT]){
+    leaf = dxleaf(dp, dxhash(name), 0, 0, 0);
+    bp = bread(dp->dev, bmap(dp, leaf));
+    dep = (struct dirent*)bp->data;
+    for(i = 0; i < DPB; i++)
+      if(dep[i].inum != 0 && namecmp(name, dep[i].name) == 0)
+        break;
+    inum = i < DPB ? dep[i].inum : 0;
+    off = leaf*BSIZE + i*sizeof(de);
+    brelse(bp);
+    dcput(dp, name, inum, off);
+    if(inum == 0)
+      return 0;
+    if(poff)
+      *poff = off;
+    return iget(dp->dev, inum);
+  }
+
   for(off = 0; off < dp->size; off += sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
       panic("dirlookup read");
@@ -541,14 +1342,17 @@ dirlookup(struct inode *dp, char *name, uint *poff)
       if(poff)
         *poff = off;
       inum = de.inum;
+      dcput(dp, name, inum, off);
       return iget(dp->dev, inum);
     }
   }
 
+  dcput(dp, name, 0, 0);
   return 0;
 }
 
 // Write a new directory entry (name, inum) into the directory dp.
+// Returns -1 if name is present, or if the directory is full.
 int
 dirlink(struct inode *dp, char *name, uint inum)
 {
@@ -562,6 +1366,10 @@ dirlink(struct inode *dp, char *name, uint inum)
     return -1;
   }
 
+  dcinvalidate(dp, name);
+  if(dp->addrs[DXROOT])
+    return dxlink(dp, name, inum);
+
   // Look for an empty dirent.
   for(off = 0; off < dp->size; off += sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
@@ -570,6 +1378,12 @@ dirlink(struct inode *dp, char *name, uint inum)
       break;
   }
 
+  // Rather than grow past one block, start an index.
+  if(off == BSIZE && dp->size == BSIZE){
+    dxcreate(dp);
+    return dxlink(dp, name, inum);
+  }
+
   strncpy(de.name, name, DIRSIZ);
   de.inum = inum;
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
@@ -633,21 +1447,23 @@ namex(char *path, int nameiparent, char *name)
     ip = idup(myproc()->cwd);
 
   while((path = skipelem(path, name)) != 0){
-    ilock(ip);
+    // Only reading ip, so share it with other lookups.
+    ilockread(ip);
     if(ip->type != T_DIR){
-      iunlockput(ip);
+      iunlockread(ip);
+      iput(ip);
       return 0;
     }
     if(nameiparent && *path == '\0'){
       // Stop one level early.
-      iunlock(ip);
+      iunlockread(ip);
       return ip;
     }
-    if((next = dirlookup(ip, name, 0)) == 0){
-      iunlockput(ip);
+    next = dirlookup(ip, name, 0);
+    iunlockread(ip);
+    iput(ip);
+    if(next == 0)
       return 0;
-    }
-    iunlockput(ip);
     ip = next;
   }
   if(nameiparent){
@@ -21,18 +21,44 @@ struct superblock {
   uint bmapstart;    // Block number of first free map block
 };
 
-#define NDIRECT 12
+// The log begins with LOGHDRBLOCKS blocks holding its header:
+// the count of logged blocks, then their block numbers.
+#define LOGHDRBLOCKS (((LOGSIZE+1)*sizeof(int) + BSIZE-1) / BSIZE)
+
+// addrs[] holds NDIRECT direct block numbers, then the roots of
+// a singly, a doubly and a triply indirect block tree.
+#define NDIRECT 10
 #define NINDIRECT (BSIZE / sizeof(uint))
-#define MAXFILE (NDIRECT + NINDIRECT)
+#define NDINDIRECT (NINDIRECT * NINDIRECT)
+#define NTINDIRECT (NDINDIRECT * NINDIRECT)
+#define MAXFILE (NDIRECT + NINDIRECT + NDINDIRECT + NTINDIRECT)
+
+// An extent-mapped inode (I_EXTENT) instead uses addrs[] as
+// NEXTENT runs of contiguous blocks, in file order, followed by
+// the address of a block holding NIEXTENT more.  An extent with
+// len 0 ends the map.  There is no deeper level: a file whose
+// blocks are scattered over more than NEXTENT+NIEXTENT runs
+// cannot grow, and writes to it come up short.
+struct extent {
+  uint start;           // First block of the run
+  uint len;             // Number of blocks in the run
+};
+
+#define NEXTENT ((NDIRECT+2) / 2)
+#define NIEXTENT (BSIZE / sizeof(struct extent))
+
+// Inode flags
+#define I_EXTENT 0x1    // addrs[] holds extents
 
 // On-disk inode structure
 struct dinode {
   short type;           // File type
-  short major;          // Major device number (T_DEV only)
-  short minor;          // Minor device number (T_DEV only)
+  uchar major;          // Major device number (T_DEV only)
+  uchar minor;          // Minor device number (T_DEV only)
+  short flags;          // I_EXTENT
   short nlink;          // Number of links to inode in file system
   uint size;            // Size of file (bytes)
-  uint addrs[NDIRECT+1];   // Data block addresses
+  uint addrs[NDIRECT+3];   // Data block addresses
 };
 
 // Inodes per block.
@@ -55,3 +81,45 @@ struct dirent {
   char name[DIRSIZ];
 };
 
+// Directory entries per block.
+#define DPB           (BSIZE / sizeof(struct dirent))
+
+// A directory that outgrows one block gets a hash index, like
+// ext3's htree.  Its blocks then become leaves, each holding
+// the entries whose names hash into one range.  The index
+// lives outside the directory's data, in blocks reached from
+// addrs[DXROOT]: a directory never needs triply-indirect
+// blocks, so it can use that slot.  Readers that ignore the
+// index still see an ordinary array of dirents.
+#define DXROOT (NDIRECT+2)
+
+struct dxentry {
+  uint hash;    // Lowest name hash covered by this entry
+  uint block;   // Leaf (block number within the directory),
+                // or index node (disk block), per depth
+};
+
+#define NDXENTRY (BSIZE / sizeof(struct dxentry) - 1)
+
+// An index node: the root, and if depth is 1, the nodes below it.
+// Entries are sorted by hash, and the first covers hash 0 up.
+struct dxnode {
+  ushort depth;     // 0 if entries point at leaves
+  ushort count;     // Entries in use
+  uint unused;
+  struct dxentry e[NDXENTRY];
+};
+
+// Hash of a directory entry name (FNV-1a).
+static inline uint
+dxhash(char *name)
+{
+  uint h;
+  int i;
+
+  h = 2166136261U;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = (h ^ (uchar)name[i]) * 16777619;
+  return h;
+}
+
@@ -1,4 +1,6 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// Simple IDE driver code.
+// Uses PIIX-style bus-master DMA when a PCI IDE controller
+// that supports it is found, and PIO otherwise.
 
 #include "types.h"
 #include "defs.h"
@@ -23,17 +25,54 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
+
+// Bus-master IDE registers for the primary channel,
+// relative to the I/O base in BAR4 of the controller.
+#define BM_CMD        0x0
+  #define BM_START      0x01   // Start/stop transfer
+  #define BM_READ       0x08   // Direction: disk to memory
+#define BM_STATUS     0x2
+  #define BM_ERR        0x02   // Transfer error (write 1 to clear)
+  #define BM_INTR       0x04   // Interrupt raised (write 1 to clear)
+#define BM_PRDT       0x4      // Physical address of PRD table
+
+// PCI configuration space access.
+#define PCI_CONFADDR  0xcf8
+#define PCI_CONFDATA  0xcfc
+
+// Physical region descriptor: one physically contiguous piece
+// of a DMA transfer.  Pieces may not cross a 64KB boundary.
+struct prd {
+  uint addr;       // physical address
+  ushort nbytes;   // byte count, 0 means 64KB
+  ushort flags;
+};
+#define PRD_EOT       0x8000   // last entry in the table
+
+// Max bufs merged into one command.  Each BSIZE buffer needs
+// at most two PRD entries (if it crosses a 64KB boundary).
+#define IDE_MAXMERGE  16
+#define NPRD          (2*IDE_MAXMERGE)
 
 // idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
+// The first idenbuf bufs of the queue are covered by the command
+// in progress (consecutive blocks merged into one transfer).
+// The remaining bufs wait in C-SCAN order: ascending block number
+// from the head of the queue, then wrapping around to the lowest.
 // You must hold idelock while manipulating queue.
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static int idenbuf;
 
 static int havedisk1;
 static void idestart(struct buf*);
 
+static ushort idebm;   // bus-master I/O base; 0 means use PIO
+static struct prd prdt[NPRD] __attribute__((aligned(16)));
+
 // Wait for IDE disk to become ready.
 static int
 idewait(int checkerr)
@@ -47,6 +86,73 @@ idewait(int checkerr)
   return 0;
 }
 
+static uint
+pciconfread(int dev, int func, int off)
+{
+  outl(PCI_CONFADDR, 0x80000000 | (dev<<11) | (func<<8) | (off&0xfc));
+  return inl(PCI_CONFDATA);
+}
+
+static void
+pciconfwrite(int dev, int func, int off, uint v)
+{
+  outl(PCI_CONFADDR, 0x80000000 | (dev<<11) | (func<<8) | (off&0xfc));
+  outl(PCI_CONFDATA, v);
+}
+
+// Look on PCI bus 0 for an IDE controller capable of bus
+// mastering (such as the PIIX that QEMU emulates), enable
+// it, and return its bus-master I/O base.  Return 0 if
+// there is none.
+static ushort
+idebminit(void)
+{
+  int dev, func;
+  uint class, bar4, cmd;
+
+  for(dev = 0; dev < 32; dev++){
+    for(func = 0; func < 8; func++){
+      if((pciconfread(dev, func, 0x00) & 0xffff) == 0xffff)
+        continue;  // no such device
+      // Class 01 (storage), subclass 01 (IDE), prog-if bit 7 (bus master).
+      class = pciconfread(dev, func, 0x08);
+      if((class >> 16) != 0x0101 || (class & 0x8000) == 0)
+        continue;
+      bar4 = pciconfread(dev, func, 0x20);
+      if((bar4 & 1) == 0 || (bar4 & ~3) == 0)
+        continue;  // not mapped in I/O space
+      // Enable I/O space decoding and bus mastering.
+      cmd = pciconfread(dev, func, 0x04);
+      pciconfwrite(dev, func, 0x04, (cmd & 0xffff) | 0x5);
+      return bar4 & 0xfffc;
+    }
+  }
+  return 0;
+}
+
+// Fill PRD entries starting at p to describe the n bytes at
+// kernel address data.  Returns the next free entry.
+static struct prd*
+idesetprd(struct prd *p, uchar *data, uint n)
+{
+  uint pa, m;
+
+  pa = V2P(data);
+  for(; n > 0; p++){
+    if(p >= prdt+NPRD)
+      panic("idesetprd");
+    m = 0x10000 - (pa & 0xffff);
+    if(m > n)
+      m = n;
+    p->addr = pa;
+    p->nbytes = m;
+    p->flags = 0;
+    pa += m;
+    n -= m;
+  }
+  return p;
+}
+
 void
 ideinit(void)
 {
@@ -67,16 +173,26 @@ ideinit(void)
 
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
+
+  idebm = idebminit();
+  if(idebm)
+    outl(idebm + BM_PRDT, V2P(prdt));
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Start the request for b, the head of idequeue.
+// With DMA, the following bufs for the next blocks of the same
+// disk in the same direction join the same command; PIO moves
+// one buf per command, since it interrupts for every sector.
+// Caller must hold idelock.
 static void
 idestart(struct buf *b)
 {
+  struct buf *last;
+  struct prd *p;
+  int i;
+
   if(b == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
-    panic("incorrect blockno");
   int sector_per_block =  BSIZE/SECTOR_SIZE;
   int sector = b->blockno * sector_per_block;
   int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
@@ -84,14 +200,37 @@ idestart(struct buf *b)
 
   if (sector_per_block > 7) panic("idestart");
 
+  idenbuf = 1;
+  last = b;
+  while(idebm && idenbuf < IDE_MAXMERGE && last->qnext &&
+        last->qnext->dev == b->dev &&
+        last->qnext->blockno == last->blockno + 1 &&
+        (last->qnext->flags & B_DIRTY) == (b->flags & B_DIRTY)){
+    last = last->qnext;
+    idenbuf++;
+  }
+
   idewait(0);
+  if(idebm){
+    // Point the bus master at the bufs' data; clear old status.
+    p = prdt;
+    for(i = 0, last = b; i < idenbuf; i++, last = last->qnext)
+      p = idesetprd(p, last->data, BSIZE);
+    (p-1)->flags = PRD_EOT;
+    outb(idebm + BM_CMD, (b->flags & B_DIRTY) ? 0 : BM_READ);
+    outb(idebm + BM_STATUS, inb(idebm + BM_STATUS) | BM_ERR | BM_INTR);
+  }
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, idenbuf * sector_per_block);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
-  if(b->flags & B_DIRTY){
+  if(idebm){
+    // The controller moves the data; ideintr() runs when it is done.
+    outb(0x1f7, (b->flags & B_DIRTY) ? IDE_CMD_WRDMA : IDE_CMD_RDDMA);
+    outb(idebm + BM_CMD, inb(idebm + BM_CMD) | BM_START);
+  } else if(b->flags & B_DIRTY){
     outb(0x1f7, write_cmd);
     outsl(0x1f0, b->data, BSIZE/4);
   } else {
@@ -104,6 +243,7 @@ void
 ideintr(void)
 {
   struct buf *b;
+  uchar st;
 
   // First queued buffer is the active request.
   acquire(&idelock);
@@ -112,16 +252,33 @@ ideintr(void)
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
+  if(idebm){
+    // Stop the bus master and acknowledge the interrupt.
+    // The data is already in (or out of) the bufs.
+    st = inb(idebm + BM_STATUS);
+    if((st & BM_INTR) == 0){
+      // Not from the command in progress.
+      release(&idelock);
+      return;
+    }
+    outb(idebm + BM_CMD, 0);
+    outb(idebm + BM_STATUS, st | BM_ERR | BM_INTR);
+    if(idewait(1) < 0 || (st & BM_ERR))
+      panic("ideintr: dma error");
+  } else if(!(b->flags & B_DIRTY) && idewait(1) >= 0){
+    // Read data if needed.
     insl(0x1f0, b->data, BSIZE/4);
+  }
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+  // Wake processes waiting for the bufs of this command.
+  for(; idenbuf > 0; idenbuf--){
+    b = idequeue;
+    idequeue = b->qnext;
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    wakeup(b);
+  }
 
   // Start disk on next buf in queue.
   if(idequeue != 0)
@@ -131,13 +288,17 @@ ideintr(void)
 }
 
 //PAGEBREAK!
-// Sync buf with disk.
-// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
-// Else if B_VALID is not set, read buf from disk, set B_VALID.
-void
-iderw(struct buf *b)
+// Insert b into idequeue in C-SCAN order, after the bufs of
+// the command in progress.  Measuring block numbers as
+// unsigned distances from the head makes lower block numbers
+// sort after higher ones, i.e., on the next sweep.
+// Caller must hold idelock.
+static void
+ideinsert(struct buf *b)
 {
   struct buf **pp;
+  uint base;
+  int i;
 
   if(!holdingsleep(&b->lock))
     panic("iderw: buf not locked");
@@ -145,24 +306,50 @@ iderw(struct buf *b)
     panic("iderw: nothing to do");
   if(b->dev != 0 && !havedisk1)
     panic("iderw: ide disk 1 not present");
+  if(b->blockno >= FSSIZE)
+    panic("incorrect blockno");
+
+  pp = &idequeue;
+  for(i = 0; i < idenbuf; i++)
+    pp = &(*pp)->qnext;
+  base = idequeue ? idequeue->blockno : b->blockno;
+  for(; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+    if((*pp)->blockno - base > b->blockno - base)
+      break;
+  b->qnext = *pp;
+  *pp = b;
+}
+
+// Sync n bufs with disk, queueing them all before waiting
+// so that idestart can merge adjacent blocks into one command.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderwv(struct buf **bs, int n)
+{
+  int i, idle;
 
   acquire(&idelock);  //DOC:acquire-lock
 
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
-    ;
-  *pp = b;
+  idle = (idequeue == 0);
+  for(i = 0; i < n; i++)
+    ideinsert(bs[i]);
 
   // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
-
-  // Wait for request to finish.
-  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
-    sleep(b, &idelock);
-  }
+  if(idle && n > 0)
+    idestart(idequeue);
 
+  // Wait for requests to finish.
+  for(i = 0; i < n; i++)
+    while((bs[i]->flags & (B_VALID|B_DIRTY)) != B_VALID)
+      sleep(bs[i], &idelock);
 
   release(&idelock);
 }
+
+// Sync buf with disk.
+void
+iderw(struct buf *b)
+{
+  iderwv(&b, 1);
+}
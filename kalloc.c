@@ -1,14 +1,28 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
 // and pipe buffers. Allocates 4096-byte pages.
+//
+// Each CPU keeps its own free list, protected by its own lock,
+// so that kalloc() and kfree() on different CPUs do not contend.
+// A CPU whose list is empty steals a batch of pages from another
+// CPU's list.
+//
+// Pages may be shared between address spaces (copy-on-write fork),
+// so each page has a reference count.  kalloc() sets it to 1,
+// kaddref() increments it, and kfree() only puts the page back on
+// a free list when the count drops to zero.  The counts are updated
+// with atomic instructions so they need no lock.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "proc.h"
 #include "spinlock.h"
 
+#define NSTEAL 32  // max pages moved from another CPU's list at once
+
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
                    // defined by the kernel linker script in kernel.ld
@@ -17,21 +31,34 @@ struct run {
   struct run *next;
 };
 
-struct {
+struct freelist {
   struct spinlock lock;
+  struct run *head;
+  int nfree;         // number of pages on this list
+};
+
+struct {
   int use_lock;
-  struct run *freelist;
+  struct freelist list[NCPU];  // one per CPU, indexed by cpuid()
+  ushort ref[PHYSTOP/PGSIZE];  // reference count of each physical page
 } kmem;
 
+#define PAGEREF(v) (kmem.ref[V2P(v)/PGSIZE])
+
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
 // the pages mapped by entrypgdir on free list.
 // 2. main() calls kinit2() with the rest of the physical pages
 // after installing a full page table that maps them on all cores.
+// Until kinit2() finishes, only the boot CPU is allocating and
+// everything lives on list[0]; the other CPUs steal from it later.
 void
 kinit1(void *vstart, void *vend)
 {
-  initlock(&kmem.lock, "kmem");
+  int i;
+
+  for(i = 0; i < NCPU; i++)
+    initlock(&kmem.list[i].lock, "kmem");
   kmem.use_lock = 0;
   freerange(vstart, vend);
 }
@@ -48,32 +75,90 @@ freerange(void *vstart, void *vend)
 {
   char *p;
   p = (char*)PGROUNDUP((uint)vstart);
-  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+    PAGEREF(p) = 1;
     kfree(p);
+  }
 }
+
+// Return the free list of the current CPU.
+// Caller must have interrupts disabled.
+static struct freelist*
+mylist(void)
+{
+  if(!kmem.use_lock)
+    return &kmem.list[0];
+  return &kmem.list[cpuid()];
+}
+
 //PAGEBREAK: 21
-// Free the page of physical memory pointed at by v,
-// which normally should have been returned by a
+// Drop a reference to the page of physical memory pointed
+// at by v, which normally should have been returned by a
 // call to kalloc().  (The exception is when
 // initializing the allocator; see kinit above.)
+// The page is freed when its last reference goes away.
 void
 kfree(char *v)
 {
   struct run *r;
+  struct freelist *fl;
 
   if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
     panic("kfree");
+  if(PAGEREF(v) == 0)
+    panic("kfree: ref");
+  if(__sync_sub_and_fetch(&PAGEREF(v), 1) > 0)
+    return;
 
   // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
   r = (struct run*)v;
-  r->next = kmem.freelist;
-  kmem.freelist = r;
+  pushcli();
+  fl = mylist();
+  if(kmem.use_lock)
+    acquire(&fl->lock);
+  r->next = fl->head;
+  fl->head = r;
+  fl->nfree++;
   if(kmem.use_lock)
-    release(&kmem.lock);
+    release(&fl->lock);
+  popcli();
+}
+
+// Take up to NSTEAL pages from the first other CPU that has any.
+// Returns the stolen pages as a list and their count in *np.
+// Holds only one list lock at a time, so two CPUs stealing
+// from each other cannot deadlock.
+static struct run*
+steal(struct freelist *self, int *np)
+{
+  struct freelist *fl;
+  struct run *head, *tail;
+  int i, n;
+
+  for(i = 0; i < ncpu; i++){
+    fl = &kmem.list[i];
+    if(fl == self)
+      continue;
+    acquire(&fl->lock);
+    head = fl->head;
+    if(head == 0){
+      release(&fl->lock);
+      continue;
+    }
+    tail = head;
+    for(n = 1; n < NSTEAL && tail->next; n++)
+      tail = tail->next;
+    fl->head = tail->next;
+    fl->nfree -= n;
+    release(&fl->lock);
+    tail->next = 0;
+    *np = n;
+    return head;
+  }
+  *np = 0;
+  return 0;
 }
 
 // Allocate one 4096-byte page of physical memory.
@@ -82,15 +167,60 @@ kfree(char *v)
 char*
 kalloc(void)
 {
-  struct run *r;
+  struct run *r, *tail;
+  struct freelist *fl;
+  int n;
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
-  r = kmem.freelist;
+  pushcli();
+  fl = mylist();
+  if(!kmem.use_lock){
+    r = fl->head;
+    if(r){
+      fl->head = r->next;
+      fl->nfree--;
+    }
+    popcli();
+    if(r)
+      PAGEREF(r) = 1;
+    return (char*)r;
+  }
+
+  acquire(&fl->lock);
+  r = fl->head;
+  if(r){
+    fl->head = r->next;
+    fl->nfree--;
+  }
+  release(&fl->lock);
+
+  if(r == 0 && (r = steal(fl, &n)) != 0 && n > 1){
+    // Keep the first stolen page, cache the rest locally.
+    for(tail = r->next; tail->next; tail = tail->next)
+      ;
+    acquire(&fl->lock);
+    tail->next = fl->head;
+    fl->head = r->next;
+    fl->nfree += n - 1;
+    release(&fl->lock);
+  }
+  popcli();
   if(r)
-    kmem.freelist = r->next;
-  if(kmem.use_lock)
-    release(&kmem.lock);
+    PAGEREF(r) = 1;
   return (char*)r;
 }
 
+// Add a reference to the allocated page pointed at by v.
+void
+kaddref(char *v)
+{
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP || PAGEREF(v) == 0)
+    panic("kaddref");
+  __sync_add_and_fetch(&PAGEREF(v), 1);
+}
+
+// Return the number of references to the page pointed at by v.
+int
+krefcnt(char *v)
+{
+  return PAGEREF(v);
+}
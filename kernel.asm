@@ -0,0 +1,23549 @@
+
+kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+80100000 <multiboot_header>:
+80100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+80100006:	00 00                	add    %al,(%eax)
+80100008:	fe 4f 52             	decb   0x52(%edi)
+8010000b:	e4                   	.byte 0xe4
+
+8010000c <entry>:
+
+# Entering xv6 on boot processor, with paging off.
+.globl entry
+entry:
+  # Turn on page size extension for 4Mbyte pages
+  movl    %cr4, %eax
+8010000c:	0f 20 e0             	mov    %cr4,%eax
+  orl     $(CR4_PSE), %eax
+8010000f:	83 c8 10             	or     $0x10,%eax
+  movl    %eax, %cr4
+80100012:	0f 22 e0             	mov    %eax,%cr4
+  # Set page directory
+  movl    $(V2P_WO(entrypgdir)), %eax
+80100015:	b8 00 e0 10 00       	mov    $0x10e000,%eax
+  movl    %eax, %cr3
+8010001a:	0f 22 d8             	mov    %eax,%cr3
+  # Turn on paging.
+  movl    %cr0, %eax
+8010001d:	0f 20 c0             	mov    %cr0,%eax
+  orl     $(CR0_PG|CR0_WP), %eax
+80100020:	0d 00 00 01 80       	or     $0x80010000,%eax
+  movl    %eax, %cr0
+80100025:	0f 22 c0             	mov    %eax,%cr0
+
+  # Set up the stack pointer.
+  movl $(stack + KSTACKSIZE), %esp
+80100028:	bc f0 78 23 80       	mov    $0x802378f0,%esp
+
+  # Jump to main(), and switch to executing at
+  # high addresses. The indirect call is needed because
+  # the assembler produces a PC-relative instruction
+  # for a direct jump.
+  mov $main, %eax
+8010002d:	b8 a0 5d 10 80       	mov    $0x80105da0,%eax
+  jmp *%eax
+80100032:	ff e0                	jmp    *%eax
+80100034:	66 90                	xchg   %ax,%ax
+80100036:	66 90                	xchg   %ax,%ax
+80100038:	66 90                	xchg   %ax,%ax
+8010003a:	66 90                	xchg   %ax,%ax
+8010003c:	66 90                	xchg   %ax,%ax
+8010003e:	66 90                	xchg   %ax,%ax
+
+80100040 <bget>:
+// Look through buffer cache for block on device dev.
+// If not found, allocate a buffer.
+// In either case, return locked buffer.
+static struct buf*
+bget(uint dev, uint blockno)
+{
+80100040:	55                   	push   %ebp
+  return &bcache.bucket[((dev << 16) ^ blockno) % NBUCKET];
+80100041:	89 c1                	mov    %eax,%ecx
+80100043:	c1 e1 10             	shl    $0x10,%ecx
+80100046:	31 d1                	xor    %edx,%ecx
+{
+80100048:	89 e5                	mov    %esp,%ebp
+8010004a:	57                   	push   %edi
+8010004b:	56                   	push   %esi
+8010004c:	89 c6                	mov    %eax,%esi
+  return &bcache.bucket[((dev << 16) ^ blockno) % NBUCKET];
+8010004e:	b8 a1 01 1a a0       	mov    $0xa01a01a1,%eax
+{
+80100053:	53                   	push   %ebx
+80100054:	83 ec 28             	sub    $0x28,%esp
+  return &bcache.bucket[((dev << 16) ^ blockno) % NBUCKET];
+80100057:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010005a:	f7 e1                	mul    %ecx
+8010005c:	89 c8                	mov    %ecx,%eax
+8010005e:	29 d0                	sub    %edx,%eax
+80100060:	d1 e8                	shr    %eax
+80100062:	01 c2                	add    %eax,%edx
+80100064:	89 d7                	mov    %edx,%edi
+80100066:	c1 ef 08             	shr    $0x8,%edi
+80100069:	69 c7 3b 01 00 00    	imul   $0x13b,%edi,%eax
+8010006f:	29 c1                	sub    %eax,%ecx
+80100071:	69 f9 b0 02 00 00    	imul   $0x2b0,%ecx,%edi
+80100077:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+8010007a:	8d 8f 60 f4 1c 80    	lea    -0x7fe30ba0(%edi),%ecx
+80100080:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  struct bucket *bk;
+  struct buf *b, *spare;
+
+  bk = bhash(dev, blockno);
+  acquire(&bk->lock);
+80100083:	51                   	push   %ecx
+80100084:	e8 d7 80 00 00       	call   80108160 <acquire>
+  for(b = bk->head.next; b != &bk->head; b = b->next)
+80100089:	8b 9f 08 f5 1c 80    	mov    -0x7fe30af8(%edi),%ebx
+8010008f:	8d 97 a0 f4 1c 80    	lea    -0x7fe30b60(%edi),%edx
+80100095:	83 c4 10             	add    $0x10,%esp
+80100098:	39 da                	cmp    %ebx,%edx
+8010009a:	74 44                	je     801000e0 <bget+0xa0>
+8010009c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010009f:	eb 0e                	jmp    801000af <bget+0x6f>
+801000a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801000a8:	8b 5b 68             	mov    0x68(%ebx),%ebx
+801000ab:	39 da                	cmp    %ebx,%edx
+801000ad:	74 31                	je     801000e0 <bget+0xa0>
+    if(b->dev == dev && b->blockno == blockno)
+801000af:	3b 73 04             	cmp    0x4(%ebx),%esi
+801000b2:	75 f4                	jne    801000a8 <bget+0x68>
+801000b4:	3b 43 08             	cmp    0x8(%ebx),%eax
+801000b7:	75 ef                	jne    801000a8 <bget+0x68>
+
+  // Is the block already cached?
+  if((b = bfind(bk, dev, blockno)) != 0){
+    b->refcnt++;
+801000b9:	83 43 60 01          	addl   $0x1,0x60(%ebx)
+    release(&bk->lock);
+801000bd:	83 ec 0c             	sub    $0xc,%esp
+801000c0:	ff 75 e0             	push   -0x20(%ebp)
+801000c3:	e8 d8 82 00 00       	call   801083a0 <release>
+    acquiresleep(&b->lock);
+801000c8:	8d 43 0c             	lea    0xc(%ebx),%eax
+801000cb:	89 04 24             	mov    %eax,(%esp)
+801000ce:	e8 bd 7c 00 00       	call   80107d90 <acquiresleep>
+    return b;
+801000d3:	83 c4 10             	add    $0x10,%esp
+  b->flags = 0;
+  b->refcnt = 1;
+  release(&bk->lock);
+  acquiresleep(&b->lock);
+  return b;
+}
+801000d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801000d9:	89 d8                	mov    %ebx,%eax
+801000db:	5b                   	pop    %ebx
+801000dc:	5e                   	pop    %esi
+801000dd:	5f                   	pop    %edi
+801000de:	5d                   	pop    %ebp
+801000df:	c3                   	ret
+  for(b = bk->head.prev; b != &bk->head; b = b->prev)
+801000e0:	69 45 dc b0 02 00 00 	imul   $0x2b0,-0x24(%ebp),%eax
+801000e7:	8b 98 04 f5 1c 80    	mov    -0x7fe30afc(%eax),%ebx
+801000ed:	39 d3                	cmp    %edx,%ebx
+801000ef:	74 1e                	je     8010010f <bget+0xcf>
+801000f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0)
+801000f8:	8b 7b 60             	mov    0x60(%ebx),%edi
+801000fb:	85 ff                	test   %edi,%edi
+801000fd:	75 09                	jne    80100108 <bget+0xc8>
+801000ff:	f6 03 04             	testb  $0x4,(%ebx)
+80100102:	0f 84 a5 00 00 00    	je     801001ad <bget+0x16d>
+  for(b = bk->head.prev; b != &bk->head; b = b->prev)
+80100108:	8b 5b 64             	mov    0x64(%ebx),%ebx
+8010010b:	39 d3                	cmp    %edx,%ebx
+8010010d:	75 e9                	jne    801000f8 <bget+0xb8>
+    release(&bk->lock);
+8010010f:	8b 7d e0             	mov    -0x20(%ebp),%edi
+80100112:	83 ec 0c             	sub    $0xc,%esp
+80100115:	89 55 d8             	mov    %edx,-0x28(%ebp)
+80100118:	bb 3a 01 00 00       	mov    $0x13a,%ebx
+8010011d:	57                   	push   %edi
+8010011e:	e8 7d 82 00 00       	call   801083a0 <release>
+      bk = bcache.bucket;
+80100123:	89 f0                	mov    %esi,%eax
+    release(&bk->lock);
+80100125:	83 c4 10             	add    $0x10,%esp
+      bk = bcache.bucket;
+80100128:	89 fe                	mov    %edi,%esi
+8010012a:	89 c7                	mov    %eax,%edi
+8010012c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(++bk == bcache.bucket+NBUCKET)
+80100130:	81 c6 b0 02 00 00    	add    $0x2b0,%esi
+      bk = bcache.bucket;
+80100136:	b8 60 f4 1c 80       	mov    $0x801cf460,%eax
+8010013b:	81 fe f0 42 20 80    	cmp    $0x802042f0,%esi
+80100141:	0f 44 f0             	cmove  %eax,%esi
+    acquire(&bk->lock);
+80100144:	83 ec 0c             	sub    $0xc,%esp
+80100147:	56                   	push   %esi
+80100148:	e8 13 80 00 00       	call   80108160 <acquire>
+  for(b = bk->head.prev; b != &bk->head; b = b->prev)
+8010014d:	8b 86 a4 00 00 00    	mov    0xa4(%esi),%eax
+80100153:	8d 56 40             	lea    0x40(%esi),%edx
+80100156:	83 c4 10             	add    $0x10,%esp
+80100159:	39 d0                	cmp    %edx,%eax
+8010015b:	74 16                	je     80100173 <bget+0x133>
+8010015d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0)
+80100160:	8b 48 60             	mov    0x60(%eax),%ecx
+80100163:	85 c9                	test   %ecx,%ecx
+80100165:	75 05                	jne    8010016c <bget+0x12c>
+80100167:	f6 00 04             	testb  $0x4,(%eax)
+8010016a:	74 64                	je     801001d0 <bget+0x190>
+  for(b = bk->head.prev; b != &bk->head; b = b->prev)
+8010016c:	8b 40 64             	mov    0x64(%eax),%eax
+8010016f:	39 d0                	cmp    %edx,%eax
+80100171:	75 ed                	jne    80100160 <bget+0x120>
+    release(&bk->lock);
+80100173:	83 ec 0c             	sub    $0xc,%esp
+80100176:	56                   	push   %esi
+80100177:	e8 24 82 00 00       	call   801083a0 <release>
+  for(i = 1; i < NBUCKET; i++){
+8010017c:	83 c4 10             	add    $0x10,%esp
+8010017f:	83 eb 01             	sub    $0x1,%ebx
+80100182:	75 ac                	jne    80100130 <bget+0xf0>
+  panic("bget: no buffers");
+80100184:	83 ec 0c             	sub    $0xc,%esp
+80100187:	68 c0 b6 10 80       	push   $0x8010b6c0
+8010018c:	e8 cf 04 00 00       	call   80100660 <panic>
+  bk->head.next->prev = b;
+80100191:	69 45 dc b0 02 00 00 	imul   $0x2b0,-0x24(%ebp),%eax
+  b->next = bk->head.next;
+80100198:	89 4b 68             	mov    %ecx,0x68(%ebx)
+  b->prev = &bk->head;
+8010019b:	89 53 64             	mov    %edx,0x64(%ebx)
+  bk->head.next->prev = b;
+8010019e:	8b 90 08 f5 1c 80    	mov    -0x7fe30af8(%eax),%edx
+801001a4:	89 5a 64             	mov    %ebx,0x64(%edx)
+  bk->head.next = b;
+801001a7:	89 98 08 f5 1c 80    	mov    %ebx,-0x7fe30af8(%eax)
+  b->blockno = blockno;
+801001ad:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  b->dev = dev;
+801001b0:	89 73 04             	mov    %esi,0x4(%ebx)
+  b->flags = 0;
+801001b3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  b->blockno = blockno;
+801001b9:	89 43 08             	mov    %eax,0x8(%ebx)
+  b->refcnt = 1;
+801001bc:	c7 43 60 01 00 00 00 	movl   $0x1,0x60(%ebx)
+  release(&bk->lock);
+801001c3:	e9 f5 fe ff ff       	jmp    801000bd <bget+0x7d>
+801001c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801001cf:	90                   	nop
+  b->next->prev = b->prev;
+801001d0:	89 c3                	mov    %eax,%ebx
+801001d2:	89 f8                	mov    %edi,%eax
+801001d4:	89 f7                	mov    %esi,%edi
+      release(&bk->lock);
+801001d6:	83 ec 0c             	sub    $0xc,%esp
+  b->next->prev = b->prev;
+801001d9:	8b 4b 68             	mov    0x68(%ebx),%ecx
+801001dc:	89 c6                	mov    %eax,%esi
+801001de:	8b 43 64             	mov    0x64(%ebx),%eax
+801001e1:	89 41 64             	mov    %eax,0x64(%ecx)
+  b->prev->next = b->next;
+801001e4:	8b 4b 68             	mov    0x68(%ebx),%ecx
+801001e7:	89 48 68             	mov    %ecx,0x68(%eax)
+      b->dev = -1;  // matches no device, so bfind() never returns it
+801001ea:	c7 43 04 ff ff ff ff 	movl   $0xffffffff,0x4(%ebx)
+      b->flags = 0;
+801001f1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+      release(&bk->lock);
+801001f7:	57                   	push   %edi
+801001f8:	e8 a3 81 00 00       	call   801083a0 <release>
+    acquire(&bk->lock);
+801001fd:	58                   	pop    %eax
+801001fe:	ff 75 e0             	push   -0x20(%ebp)
+80100201:	e8 5a 7f 00 00       	call   80108160 <acquire>
+  for(b = bk->head.next; b != &bk->head; b = b->next)
+80100206:	8b 55 d8             	mov    -0x28(%ebp),%edx
+80100209:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+8010020c:	83 c4 10             	add    $0x10,%esp
+8010020f:	69 45 dc b0 02 00 00 	imul   $0x2b0,-0x24(%ebp),%eax
+80100216:	8b 88 08 f5 1c 80    	mov    -0x7fe30af8(%eax),%ecx
+8010021c:	89 c8                	mov    %ecx,%eax
+8010021e:	39 d1                	cmp    %edx,%ecx
+80100220:	75 19                	jne    8010023b <bget+0x1fb>
+80100222:	e9 6a ff ff ff       	jmp    80100191 <bget+0x151>
+80100227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010022e:	66 90                	xchg   %ax,%ax
+80100230:	8b 40 68             	mov    0x68(%eax),%eax
+80100233:	39 d0                	cmp    %edx,%eax
+80100235:	0f 84 56 ff ff ff    	je     80100191 <bget+0x151>
+    if(b->dev == dev && b->blockno == blockno)
+8010023b:	3b 70 04             	cmp    0x4(%eax),%esi
+8010023e:	75 f0                	jne    80100230 <bget+0x1f0>
+80100240:	3b 78 08             	cmp    0x8(%eax),%edi
+80100243:	75 eb                	jne    80100230 <bget+0x1f0>
+      spare->next = &bk->head;
+80100245:	89 53 68             	mov    %edx,0x68(%ebx)
+      spare->prev = bk->head.prev;
+80100248:	69 55 dc b0 02 00 00 	imul   $0x2b0,-0x24(%ebp),%edx
+      release(&bk->lock);
+8010024f:	83 ec 0c             	sub    $0xc,%esp
+      b->refcnt++;
+80100252:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      spare->prev = bk->head.prev;
+80100255:	8b 8a 04 f5 1c 80    	mov    -0x7fe30afc(%edx),%ecx
+8010025b:	89 4b 64             	mov    %ecx,0x64(%ebx)
+      bk->head.prev->next = spare;
+8010025e:	89 59 68             	mov    %ebx,0x68(%ecx)
+      bk->head.prev = spare;
+80100261:	89 9a 04 f5 1c 80    	mov    %ebx,-0x7fe30afc(%edx)
+      b->refcnt++;
+80100267:	83 40 60 01          	addl   $0x1,0x60(%eax)
+      release(&bk->lock);
+8010026b:	ff 75 e0             	push   -0x20(%ebp)
+8010026e:	e8 2d 81 00 00       	call   801083a0 <release>
+      acquiresleep(&b->lock);
+80100273:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80100276:	8d 50 0c             	lea    0xc(%eax),%edx
+80100279:	89 14 24             	mov    %edx,(%esp)
+8010027c:	e8 0f 7b 00 00       	call   80107d90 <acquiresleep>
+      return b;
+80100281:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80100284:	83 c4 10             	add    $0x10,%esp
+80100287:	e9 4a fe ff ff       	jmp    801000d6 <bget+0x96>
+8010028c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80100290 <binit>:
+{
+80100290:	55                   	push   %ebp
+80100291:	89 e5                	mov    %esp,%ebp
+80100293:	57                   	push   %edi
+80100294:	56                   	push   %esi
+80100295:	53                   	push   %ebx
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++){
+80100296:	bb 60 f4 1c 80       	mov    $0x801cf460,%ebx
+{
+8010029b:	83 ec 0c             	sub    $0xc,%esp
+8010029e:	66 90                	xchg   %ax,%ax
+    initlock(&bk->lock, "bcache");
+801002a0:	83 ec 08             	sub    $0x8,%esp
+801002a3:	68 d1 b6 10 80       	push   $0x8010b6d1
+801002a8:	53                   	push   %ebx
+801002a9:	e8 62 7c 00 00       	call   80107f10 <initlock>
+    bk->head.prev = &bk->head;
+801002ae:	8d 43 40             	lea    0x40(%ebx),%eax
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++){
+801002b1:	81 c3 b0 02 00 00    	add    $0x2b0,%ebx
+801002b7:	83 c4 10             	add    $0x10,%esp
+    bk->head.prev = &bk->head;
+801002ba:	89 83 f4 fd ff ff    	mov    %eax,-0x20c(%ebx)
+    bk->head.next = &bk->head;
+801002c0:	89 83 f8 fd ff ff    	mov    %eax,-0x208(%ebx)
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++){
+801002c6:	81 fb f0 42 20 80    	cmp    $0x802042f0,%ebx
+801002cc:	75 d2                	jne    801002a0 <binit+0x10>
+  for(i = 0, b = bcache.buf; b < bcache.buf+NBUF; i++, b++){
+801002ce:	31 ff                	xor    %edi,%edi
+801002d0:	bb 20 f5 10 80       	mov    $0x8010f520,%ebx
+    binsert(&bcache.bucket[i % NBUCKET], b);
+801002d5:	be d1 00 0d d0       	mov    $0xd00d00d1,%esi
+801002da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    initsleeplock(&b->lock, "buffer");
+801002e0:	83 ec 08             	sub    $0x8,%esp
+801002e3:	8d 43 0c             	lea    0xc(%ebx),%eax
+801002e6:	68 d8 b6 10 80       	push   $0x8010b6d8
+801002eb:	50                   	push   %eax
+801002ec:	e8 4f 7a 00 00       	call   80107d40 <initsleeplock>
+    binsert(&bcache.bucket[i % NBUCKET], b);
+801002f1:	89 f8                	mov    %edi,%eax
+801002f3:	83 c4 10             	add    $0x10,%esp
+801002f6:	f7 ee                	imul   %esi
+801002f8:	89 f8                	mov    %edi,%eax
+801002fa:	c1 f8 1f             	sar    $0x1f,%eax
+801002fd:	01 fa                	add    %edi,%edx
+801002ff:	c1 fa 08             	sar    $0x8,%edx
+80100302:	29 c2                	sub    %eax,%edx
+80100304:	69 c2 3b 01 00 00    	imul   $0x13b,%edx,%eax
+8010030a:	89 fa                	mov    %edi,%edx
+  for(i = 0, b = bcache.buf; b < bcache.buf+NBUF; i++, b++){
+8010030c:	83 c7 01             	add    $0x1,%edi
+    binsert(&bcache.bucket[i % NBUCKET], b);
+8010030f:	29 c2                	sub    %eax,%edx
+  b->next = bk->head.next;
+80100311:	69 d2 b0 02 00 00    	imul   $0x2b0,%edx,%edx
+80100317:	8b 8a 08 f5 1c 80    	mov    -0x7fe30af8(%edx),%ecx
+8010031d:	8d 82 20 f5 10 80    	lea    -0x7fef0ae0(%edx),%eax
+  b->prev = &bk->head;
+80100323:	81 c2 a0 f4 1c 80    	add    $0x801cf4a0,%edx
+80100329:	89 53 64             	mov    %edx,0x64(%ebx)
+  b->next = bk->head.next;
+8010032c:	89 4b 68             	mov    %ecx,0x68(%ebx)
+  bk->head.next->prev = b;
+8010032f:	8b 90 e8 ff 0b 00    	mov    0xbffe8(%eax),%edx
+80100335:	89 5a 64             	mov    %ebx,0x64(%edx)
+  bk->head.next = b;
+80100338:	89 98 e8 ff 0b 00    	mov    %ebx,0xbffe8(%eax)
+  for(i = 0, b = bcache.buf; b < bcache.buf+NBUF; i++, b++){
+8010033e:	81 c3 70 02 00 00    	add    $0x270,%ebx
+80100344:	81 fb 60 f4 1c 80    	cmp    $0x801cf460,%ebx
+8010034a:	75 94                	jne    801002e0 <binit+0x50>
+}
+8010034c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010034f:	5b                   	pop    %ebx
+80100350:	5e                   	pop    %esi
+80100351:	5f                   	pop    %edi
+80100352:	5d                   	pop    %ebp
+80100353:	c3                   	ret
+80100354:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010035b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010035f:	90                   	nop
+
+80100360 <bread>:
+
+// Return a locked buf with the contents of the indicated block.
+struct buf*
+bread(uint dev, uint blockno)
+{
+80100360:	55                   	push   %ebp
+80100361:	89 e5                	mov    %esp,%ebp
+80100363:	83 ec 18             	sub    $0x18,%esp
+  struct buf *b;
+
+  b = bget(dev, blockno);
+80100366:	8b 55 0c             	mov    0xc(%ebp),%edx
+80100369:	8b 45 08             	mov    0x8(%ebp),%eax
+8010036c:	e8 cf fc ff ff       	call   80100040 <bget>
+  if((b->flags & B_VALID) == 0) {
+80100371:	f6 00 02             	testb  $0x2,(%eax)
+80100374:	74 0a                	je     80100380 <bread+0x20>
+    iderw(b);
+  }
+  return b;
+}
+80100376:	c9                   	leave
+80100377:	c3                   	ret
+80100378:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010037f:	90                   	nop
+    iderw(b);
+80100380:	83 ec 0c             	sub    $0xc,%esp
+80100383:	50                   	push   %eax
+80100384:	89 45 f4             	mov    %eax,-0xc(%ebp)
+80100387:	e8 a4 44 00 00       	call   80104830 <iderw>
+8010038c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+8010038f:	83 c4 10             	add    $0x10,%esp
+}
+80100392:	c9                   	leave
+80100393:	c3                   	ret
+80100394:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010039b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010039f:	90                   	nop
+
+801003a0 <bclaim>:
+// Return a locked buf for the indicated block without reading
+// it from disk.  The caller must overwrite all of b->data,
+// which holds garbage unless the block was already cached.
+struct buf*
+bclaim(uint dev, uint blockno)
+{
+801003a0:	55                   	push   %ebp
+801003a1:	89 e5                	mov    %esp,%ebp
+801003a3:	83 ec 08             	sub    $0x8,%esp
+  struct buf *b;
+
+  b = bget(dev, blockno);
+801003a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+801003a9:	8b 45 08             	mov    0x8(%ebp),%eax
+801003ac:	e8 8f fc ff ff       	call   80100040 <bget>
+  b->flags |= B_VALID;
+801003b1:	83 08 02             	orl    $0x2,(%eax)
+  return b;
+}
+801003b4:	c9                   	leave
+801003b5:	c3                   	ret
+801003b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801003bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+801003c0 <breadn>:
+// blocks starting at blockno.  The blocks that are not cached
+// are read with one call to the driver, which can then
+// transfer them in a single command.
+void
+breadn(uint dev, uint blockno, int n, struct buf **bp)
+{
+801003c0:	55                   	push   %ebp
+801003c1:	89 e5                	mov    %esp,%ebp
+801003c3:	57                   	push   %edi
+801003c4:	56                   	push   %esi
+801003c5:	53                   	push   %ebx
+801003c6:	83 ec 5c             	sub    $0x5c,%esp
+801003c9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+801003cc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  struct buf *miss[NBREADN];
+  int i, m;
+
+  if(n > NBREADN)
+801003cf:	83 fb 10             	cmp    $0x10,%ebx
+801003d2:	7f 74                	jg     80100448 <breadn+0x88>
+    panic("breadn");
+  m = 0;
+  for(i = 0; i < n; i++){
+801003d4:	85 db                	test   %ebx,%ebx
+801003d6:	7e 47                	jle    8010041f <breadn+0x5f>
+801003d8:	8b 55 14             	mov    0x14(%ebp),%edx
+801003db:	8d 04 b5 00 00 00 00 	lea    0x0(,%esi,4),%eax
+801003e2:	01 f3                	add    %esi,%ebx
+  m = 0;
+801003e4:	89 75 0c             	mov    %esi,0xc(%ebp)
+801003e7:	89 de                	mov    %ebx,%esi
+801003e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+801003ec:	31 ff                	xor    %edi,%edi
+801003ee:	29 c2                	sub    %eax,%edx
+801003f0:	89 55 a4             	mov    %edx,-0x5c(%ebp)
+801003f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801003f7:	90                   	nop
+    bp[i] = bget(dev, blockno + i);
+801003f8:	8b 45 08             	mov    0x8(%ebp),%eax
+801003fb:	89 da                	mov    %ebx,%edx
+801003fd:	e8 3e fc ff ff       	call   80100040 <bget>
+80100402:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+80100405:	89 04 99             	mov    %eax,(%ecx,%ebx,4)
+    if((bp[i]->flags & B_VALID) == 0)
+80100408:	f6 00 02             	testb  $0x2,(%eax)
+8010040b:	75 07                	jne    80100414 <breadn+0x54>
+      miss[m++] = bp[i];
+8010040d:	89 44 bd a8          	mov    %eax,-0x58(%ebp,%edi,4)
+80100411:	83 c7 01             	add    $0x1,%edi
+  for(i = 0; i < n; i++){
+80100414:	83 c3 01             	add    $0x1,%ebx
+80100417:	39 f3                	cmp    %esi,%ebx
+80100419:	75 dd                	jne    801003f8 <breadn+0x38>
+  }
+  if(m > 0)
+8010041b:	85 ff                	test   %edi,%edi
+8010041d:	75 11                	jne    80100430 <breadn+0x70>
+    iderwv(miss, m);
+}
+8010041f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100422:	5b                   	pop    %ebx
+80100423:	5e                   	pop    %esi
+80100424:	5f                   	pop    %edi
+80100425:	5d                   	pop    %ebp
+80100426:	c3                   	ret
+80100427:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010042e:	66 90                	xchg   %ax,%ax
+    iderwv(miss, m);
+80100430:	83 ec 08             	sub    $0x8,%esp
+80100433:	8d 45 a8             	lea    -0x58(%ebp),%eax
+80100436:	57                   	push   %edi
+80100437:	50                   	push   %eax
+80100438:	e8 43 42 00 00       	call   80104680 <iderwv>
+8010043d:	83 c4 10             	add    $0x10,%esp
+}
+80100440:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100443:	5b                   	pop    %ebx
+80100444:	5e                   	pop    %esi
+80100445:	5f                   	pop    %edi
+80100446:	5d                   	pop    %ebp
+80100447:	c3                   	ret
+    panic("breadn");
+80100448:	83 ec 0c             	sub    $0xc,%esp
+8010044b:	68 df b6 10 80       	push   $0x8010b6df
+80100450:	e8 0b 02 00 00       	call   80100660 <panic>
+80100455:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010045c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80100460 <bwrite>:
+
+// Write b's contents to disk.  Must be locked.
+void
+bwrite(struct buf *b)
+{
+80100460:	55                   	push   %ebp
+80100461:	89 e5                	mov    %esp,%ebp
+80100463:	53                   	push   %ebx
+80100464:	83 ec 10             	sub    $0x10,%esp
+80100467:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+8010046a:	8d 43 0c             	lea    0xc(%ebx),%eax
+8010046d:	50                   	push   %eax
+8010046e:	e8 6d 7a 00 00       	call   80107ee0 <holdingsleep>
+80100473:	83 c4 10             	add    $0x10,%esp
+80100476:	85 c0                	test   %eax,%eax
+80100478:	74 0f                	je     80100489 <bwrite+0x29>
+    panic("bwrite");
+  b->flags |= B_DIRTY;
+8010047a:	83 0b 04             	orl    $0x4,(%ebx)
+  iderw(b);
+8010047d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+80100480:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100483:	c9                   	leave
+  iderw(b);
+80100484:	e9 a7 43 00 00       	jmp    80104830 <iderw>
+    panic("bwrite");
+80100489:	83 ec 0c             	sub    $0xc,%esp
+8010048c:	68 e6 b6 10 80       	push   $0x8010b6e6
+80100491:	e8 ca 01 00 00       	call   80100660 <panic>
+80100496:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010049d:	8d 76 00             	lea    0x0(%esi),%esi
+
+801004a0 <brelse>:
+
+// Release a locked buffer.
+// Move to the head of its bucket's MRU list.
+void
+brelse(struct buf *b)
+{
+801004a0:	55                   	push   %ebp
+801004a1:	89 e5                	mov    %esp,%ebp
+801004a3:	57                   	push   %edi
+801004a4:	56                   	push   %esi
+801004a5:	53                   	push   %ebx
+801004a6:	83 ec 18             	sub    $0x18,%esp
+801004a9:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct bucket *bk;
+
+  if(!holdingsleep(&b->lock))
+801004ac:	8d 5e 0c             	lea    0xc(%esi),%ebx
+801004af:	53                   	push   %ebx
+801004b0:	e8 2b 7a 00 00       	call   80107ee0 <holdingsleep>
+801004b5:	83 c4 10             	add    $0x10,%esp
+801004b8:	85 c0                	test   %eax,%eax
+801004ba:	0f 84 8f 00 00 00    	je     8010054f <brelse+0xaf>
+    panic("brelse");
+
+  releasesleep(&b->lock);
+801004c0:	83 ec 0c             	sub    $0xc,%esp
+801004c3:	53                   	push   %ebx
+801004c4:	e8 27 79 00 00       	call   80107df0 <releasesleep>
+  return &bcache.bucket[((dev << 16) ^ blockno) % NBUCKET];
+801004c9:	8b 4e 04             	mov    0x4(%esi),%ecx
+801004cc:	b8 a1 01 1a a0       	mov    $0xa01a01a1,%eax
+801004d1:	c1 e1 10             	shl    $0x10,%ecx
+801004d4:	33 4e 08             	xor    0x8(%esi),%ecx
+801004d7:	f7 e1                	mul    %ecx
+801004d9:	89 c8                	mov    %ecx,%eax
+801004db:	29 d0                	sub    %edx,%eax
+801004dd:	d1 e8                	shr    %eax
+801004df:	01 c2                	add    %eax,%edx
+801004e1:	c1 ea 08             	shr    $0x8,%edx
+801004e4:	69 c2 3b 01 00 00    	imul   $0x13b,%edx,%eax
+801004ea:	29 c1                	sub    %eax,%ecx
+
+  bk = bhash(b->dev, b->blockno);
+  acquire(&bk->lock);
+801004ec:	69 d9 b0 02 00 00    	imul   $0x2b0,%ecx,%ebx
+801004f2:	8d bb 60 f4 1c 80    	lea    -0x7fe30ba0(%ebx),%edi
+801004f8:	89 3c 24             	mov    %edi,(%esp)
+801004fb:	e8 60 7c 00 00       	call   80108160 <acquire>
+  b->refcnt--;
+80100500:	8b 46 60             	mov    0x60(%esi),%eax
+  if (b->refcnt == 0) {
+80100503:	83 c4 10             	add    $0x10,%esp
+  b->refcnt--;
+80100506:	83 e8 01             	sub    $0x1,%eax
+80100509:	89 46 60             	mov    %eax,0x60(%esi)
+  if (b->refcnt == 0) {
+8010050c:	85 c0                	test   %eax,%eax
+8010050e:	75 30                	jne    80100540 <brelse+0xa0>
+  b->next->prev = b->prev;
+80100510:	8b 56 68             	mov    0x68(%esi),%edx
+80100513:	8b 46 64             	mov    0x64(%esi),%eax
+80100516:	89 42 64             	mov    %eax,0x64(%edx)
+  b->prev->next = b->next;
+80100519:	8b 56 68             	mov    0x68(%esi),%edx
+8010051c:	89 50 68             	mov    %edx,0x68(%eax)
+  b->next = bk->head.next;
+8010051f:	8b 93 08 f5 1c 80    	mov    -0x7fe30af8(%ebx),%edx
+80100525:	89 56 68             	mov    %edx,0x68(%esi)
+  b->prev = &bk->head;
+80100528:	8d 93 a0 f4 1c 80    	lea    -0x7fe30b60(%ebx),%edx
+8010052e:	89 56 64             	mov    %edx,0x64(%esi)
+  bk->head.next->prev = b;
+80100531:	8b 93 08 f5 1c 80    	mov    -0x7fe30af8(%ebx),%edx
+80100537:	89 72 64             	mov    %esi,0x64(%edx)
+  bk->head.next = b;
+8010053a:	89 b3 08 f5 1c 80    	mov    %esi,-0x7fe30af8(%ebx)
+    // no one is waiting for it.
+    bunlink(b);
+    binsert(bk, b);
+  }
+  
+  release(&bk->lock);
+80100540:	89 7d 08             	mov    %edi,0x8(%ebp)
+}
+80100543:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100546:	5b                   	pop    %ebx
+80100547:	5e                   	pop    %esi
+80100548:	5f                   	pop    %edi
+80100549:	5d                   	pop    %ebp
+  release(&bk->lock);
+8010054a:	e9 51 7e 00 00       	jmp    801083a0 <release>
+    panic("brelse");
+8010054f:	83 ec 0c             	sub    $0xc,%esp
+80100552:	68 ed b6 10 80       	push   $0x8010b6ed
+80100557:	e8 04 01 00 00       	call   80100660 <panic>
+8010055c:	66 90                	xchg   %ax,%ax
+8010055e:	66 90                	xchg   %ax,%ax
+
+80100560 <consoleread>:
+    lockdump();
+}
+
+int
+consoleread(struct inode *ip, char *dst, int n)
+{
+80100560:	55                   	push   %ebp
+80100561:	89 e5                	mov    %esp,%ebp
+80100563:	57                   	push   %edi
+80100564:	56                   	push   %esi
+80100565:	53                   	push   %ebx
+80100566:	83 ec 18             	sub    $0x18,%esp
+80100569:	8b 5d 10             	mov    0x10(%ebp),%ebx
+8010056c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  uint target;
+  int c;
+
+  iunlock(ip);
+8010056f:	ff 75 08             	push   0x8(%ebp)
+  target = n;
+80100572:	89 df                	mov    %ebx,%edi
+  iunlock(ip);
+80100574:	e8 d7 24 00 00       	call   80102a50 <iunlock>
+  acquire(&cons.lock);
+80100579:	c7 04 24 a0 43 20 80 	movl   $0x802043a0,(%esp)
+80100580:	e8 db 7b 00 00       	call   80108160 <acquire>
+  while(n > 0){
+80100585:	83 c4 10             	add    $0x10,%esp
+80100588:	85 db                	test   %ebx,%ebx
+8010058a:	0f 8e 94 00 00 00    	jle    80100624 <consoleread+0xc4>
+    while(input.r == input.w){
+80100590:	a1 80 43 20 80       	mov    0x80204380,%eax
+80100595:	39 05 84 43 20 80    	cmp    %eax,0x80204384
+8010059b:	74 25                	je     801005c2 <consoleread+0x62>
+8010059d:	eb 59                	jmp    801005f8 <consoleread+0x98>
+8010059f:	90                   	nop
+      if(myproc()->killed){
+        release(&cons.lock);
+        ilock(ip);
+        return -1;
+      }
+      sleep(&input.r, &cons.lock);
+801005a0:	83 ec 08             	sub    $0x8,%esp
+801005a3:	68 a0 43 20 80       	push   $0x802043a0
+801005a8:	68 80 43 20 80       	push   $0x80204380
+801005ad:	e8 8e 70 00 00       	call   80107640 <sleep>
+    while(input.r == input.w){
+801005b2:	a1 80 43 20 80       	mov    0x80204380,%eax
+801005b7:	83 c4 10             	add    $0x10,%esp
+801005ba:	3b 05 84 43 20 80    	cmp    0x80204384,%eax
+801005c0:	75 36                	jne    801005f8 <consoleread+0x98>
+      if(myproc()->killed){
+801005c2:	e8 a9 68 00 00       	call   80106e70 <myproc>
+801005c7:	8b 48 24             	mov    0x24(%eax),%ecx
+801005ca:	85 c9                	test   %ecx,%ecx
+801005cc:	74 d2                	je     801005a0 <consoleread+0x40>
+        release(&cons.lock);
+801005ce:	83 ec 0c             	sub    $0xc,%esp
+801005d1:	68 a0 43 20 80       	push   $0x802043a0
+801005d6:	e8 c5 7d 00 00       	call   801083a0 <release>
+        ilock(ip);
+801005db:	5a                   	pop    %edx
+801005dc:	ff 75 08             	push   0x8(%ebp)
+801005df:	e8 8c 23 00 00       	call   80102970 <ilock>
+        return -1;
+801005e4:	83 c4 10             	add    $0x10,%esp
+  }
+  release(&cons.lock);
+  ilock(ip);
+
+  return target - n;
+}
+801005e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return -1;
+801005ea:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801005ef:	5b                   	pop    %ebx
+801005f0:	5e                   	pop    %esi
+801005f1:	5f                   	pop    %edi
+801005f2:	5d                   	pop    %ebp
+801005f3:	c3                   	ret
+801005f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = input.buf[input.r++ % INPUT_BUF];
+801005f8:	8d 50 01             	lea    0x1(%eax),%edx
+801005fb:	89 15 80 43 20 80    	mov    %edx,0x80204380
+80100601:	89 c2                	mov    %eax,%edx
+80100603:	83 e2 7f             	and    $0x7f,%edx
+80100606:	0f be 8a 00 43 20 80 	movsbl -0x7fdfbd00(%edx),%ecx
+    if(c == C('D')){  // EOF
+8010060d:	80 f9 04             	cmp    $0x4,%cl
+80100610:	74 37                	je     80100649 <consoleread+0xe9>
+    *dst++ = c;
+80100612:	83 c6 01             	add    $0x1,%esi
+    --n;
+80100615:	83 eb 01             	sub    $0x1,%ebx
+    *dst++ = c;
+80100618:	88 4e ff             	mov    %cl,-0x1(%esi)
+    if(c == '\n')
+8010061b:	83 f9 0a             	cmp    $0xa,%ecx
+8010061e:	0f 85 64 ff ff ff    	jne    80100588 <consoleread+0x28>
+  release(&cons.lock);
+80100624:	83 ec 0c             	sub    $0xc,%esp
+80100627:	68 a0 43 20 80       	push   $0x802043a0
+8010062c:	e8 6f 7d 00 00       	call   801083a0 <release>
+  ilock(ip);
+80100631:	58                   	pop    %eax
+80100632:	ff 75 08             	push   0x8(%ebp)
+80100635:	e8 36 23 00 00       	call   80102970 <ilock>
+  return target - n;
+8010063a:	89 f8                	mov    %edi,%eax
+8010063c:	83 c4 10             	add    $0x10,%esp
+}
+8010063f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return target - n;
+80100642:	29 d8                	sub    %ebx,%eax
+}
+80100644:	5b                   	pop    %ebx
+80100645:	5e                   	pop    %esi
+80100646:	5f                   	pop    %edi
+80100647:	5d                   	pop    %ebp
+80100648:	c3                   	ret
+      if(n < target){
+80100649:	39 fb                	cmp    %edi,%ebx
+8010064b:	73 d7                	jae    80100624 <consoleread+0xc4>
+        input.r--;
+8010064d:	a3 80 43 20 80       	mov    %eax,0x80204380
+80100652:	eb d0                	jmp    80100624 <consoleread+0xc4>
+80100654:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010065b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010065f:	90                   	nop
+
+80100660 <panic>:
+{
+80100660:	55                   	push   %ebp
+80100661:	89 e5                	mov    %esp,%ebp
+80100663:	56                   	push   %esi
+80100664:	53                   	push   %ebx
+80100665:	83 ec 30             	sub    $0x30,%esp
+}
+
+static inline void
+cli(void)
+{
+  asm volatile("cli");
+80100668:	fa                   	cli
+  cons.locking = 0;
+80100669:	c7 05 e0 43 20 80 00 	movl   $0x0,0x802043e0
+80100670:	00 00 00 
+  getcallerpcs(&s, pcs);
+80100673:	8d 5d d0             	lea    -0x30(%ebp),%ebx
+80100676:	8d 75 f8             	lea    -0x8(%ebp),%esi
+  cprintf("lapicid %d: panic: ", lapicid());
+80100679:	e8 e2 49 00 00       	call   80105060 <lapicid>
+8010067e:	83 ec 08             	sub    $0x8,%esp
+80100681:	50                   	push   %eax
+80100682:	68 f4 b6 10 80       	push   $0x8010b6f4
+80100687:	e8 04 03 00 00       	call   80100990 <cprintf>
+  cprintf(s);
+8010068c:	58                   	pop    %eax
+8010068d:	ff 75 08             	push   0x8(%ebp)
+80100690:	e8 fb 02 00 00       	call   80100990 <cprintf>
+  cprintf("\n");
+80100695:	c7 04 24 bf c1 10 80 	movl   $0x8010c1bf,(%esp)
+8010069c:	e8 ef 02 00 00       	call   80100990 <cprintf>
+  getcallerpcs(&s, pcs);
+801006a1:	8d 45 08             	lea    0x8(%ebp),%eax
+801006a4:	5a                   	pop    %edx
+801006a5:	59                   	pop    %ecx
+801006a6:	53                   	push   %ebx
+801006a7:	50                   	push   %eax
+801006a8:	e8 e3 78 00 00       	call   80107f90 <getcallerpcs>
+  for(i=0; i<10; i++)
+801006ad:	83 c4 10             	add    $0x10,%esp
+    cprintf(" %p", pcs[i]);
+801006b0:	83 ec 08             	sub    $0x8,%esp
+801006b3:	ff 33                	push   (%ebx)
+  for(i=0; i<10; i++)
+801006b5:	83 c3 04             	add    $0x4,%ebx
+    cprintf(" %p", pcs[i]);
+801006b8:	68 08 b7 10 80       	push   $0x8010b708
+801006bd:	e8 ce 02 00 00       	call   80100990 <cprintf>
+  for(i=0; i<10; i++)
+801006c2:	83 c4 10             	add    $0x10,%esp
+801006c5:	39 f3                	cmp    %esi,%ebx
+801006c7:	75 e7                	jne    801006b0 <panic+0x50>
+  panicked = 1; // freeze other CPU
+801006c9:	c7 05 e4 43 20 80 01 	movl   $0x1,0x802043e4
+801006d0:	00 00 00 
+  for(;;)
+801006d3:	eb fe                	jmp    801006d3 <panic+0x73>
+801006d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801006dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801006e0 <consputc.part.0>:
+consputc(int c)
+801006e0:	55                   	push   %ebp
+801006e1:	89 e5                	mov    %esp,%ebp
+801006e3:	57                   	push   %edi
+801006e4:	56                   	push   %esi
+801006e5:	53                   	push   %ebx
+801006e6:	83 ec 1c             	sub    $0x1c,%esp
+  if(c == BACKSPACE){
+801006e9:	3d 00 01 00 00       	cmp    $0x100,%eax
+801006ee:	0f 84 cc 00 00 00    	je     801007c0 <consputc.part.0+0xe0>
+    uartputc(c);
+801006f4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801006f7:	bf d4 03 00 00       	mov    $0x3d4,%edi
+801006fc:	89 c3                	mov    %eax,%ebx
+801006fe:	50                   	push   %eax
+801006ff:	e8 6c 98 00 00       	call   80109f70 <uartputc>
+80100704:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100709:	89 fa                	mov    %edi,%edx
+8010070b:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010070c:	be d5 03 00 00       	mov    $0x3d5,%esi
+80100711:	89 f2                	mov    %esi,%edx
+80100713:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+80100714:	0f b6 c8             	movzbl %al,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100717:	89 fa                	mov    %edi,%edx
+80100719:	b8 0f 00 00 00       	mov    $0xf,%eax
+8010071e:	c1 e1 08             	shl    $0x8,%ecx
+80100721:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100722:	89 f2                	mov    %esi,%edx
+80100724:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+80100725:	0f b6 c0             	movzbl %al,%eax
+  if(c == '\n')
+80100728:	83 c4 10             	add    $0x10,%esp
+  pos |= inb(CRTPORT+1);
+8010072b:	09 c8                	or     %ecx,%eax
+  if(c == '\n')
+8010072d:	83 fb 0a             	cmp    $0xa,%ebx
+80100730:	75 76                	jne    801007a8 <consputc.part.0+0xc8>
+    pos += 80 - pos%80;
+80100732:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+80100737:	f7 e2                	mul    %edx
+80100739:	c1 ea 06             	shr    $0x6,%edx
+8010073c:	8d 04 92             	lea    (%edx,%edx,4),%eax
+8010073f:	c1 e0 04             	shl    $0x4,%eax
+80100742:	8d 70 50             	lea    0x50(%eax),%esi
+  if(pos < 0 || pos > 25*80)
+80100745:	81 fe d0 07 00 00    	cmp    $0x7d0,%esi
+8010074b:	0f 8f 2f 01 00 00    	jg     80100880 <consputc.part.0+0x1a0>
+  if((pos/80) >= 24){  // Scroll up.
+80100751:	81 fe 7f 07 00 00    	cmp    $0x77f,%esi
+80100757:	0f 8f c3 00 00 00    	jg     80100820 <consputc.part.0+0x140>
+  outb(CRTPORT+1, pos>>8);
+8010075d:	89 f0                	mov    %esi,%eax
+  crt[pos] = ' ' | 0x0700;
+8010075f:	8d b4 36 00 80 0b 80 	lea    -0x7ff48000(%esi,%esi,1),%esi
+  outb(CRTPORT+1, pos);
+80100766:	88 45 e7             	mov    %al,-0x19(%ebp)
+  outb(CRTPORT+1, pos>>8);
+80100769:	0f b6 fc             	movzbl %ah,%edi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010076c:	bb d4 03 00 00       	mov    $0x3d4,%ebx
+80100771:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100776:	89 da                	mov    %ebx,%edx
+80100778:	ee                   	out    %al,(%dx)
+80100779:	b9 d5 03 00 00       	mov    $0x3d5,%ecx
+8010077e:	89 f8                	mov    %edi,%eax
+80100780:	89 ca                	mov    %ecx,%edx
+80100782:	ee                   	out    %al,(%dx)
+80100783:	b8 0f 00 00 00       	mov    $0xf,%eax
+80100788:	89 da                	mov    %ebx,%edx
+8010078a:	ee                   	out    %al,(%dx)
+8010078b:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+8010078f:	89 ca                	mov    %ecx,%edx
+80100791:	ee                   	out    %al,(%dx)
+  crt[pos] = ' ' | 0x0700;
+80100792:	b8 20 07 00 00       	mov    $0x720,%eax
+80100797:	66 89 06             	mov    %ax,(%esi)
+}
+8010079a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010079d:	5b                   	pop    %ebx
+8010079e:	5e                   	pop    %esi
+8010079f:	5f                   	pop    %edi
+801007a0:	5d                   	pop    %ebp
+801007a1:	c3                   	ret
+801007a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    crt[pos++] = (c&0xff) | 0x0700;  // black on white
+801007a8:	0f b6 db             	movzbl %bl,%ebx
+801007ab:	8d 70 01             	lea    0x1(%eax),%esi
+801007ae:	80 cf 07             	or     $0x7,%bh
+801007b1:	66 89 9c 00 00 80 0b 	mov    %bx,-0x7ff48000(%eax,%eax,1)
+801007b8:	80 
+801007b9:	eb 8a                	jmp    80100745 <consputc.part.0+0x65>
+801007bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801007bf:	90                   	nop
+    uartputc('\b'); uartputc(' '); uartputc('\b');
+801007c0:	83 ec 0c             	sub    $0xc,%esp
+801007c3:	be d4 03 00 00       	mov    $0x3d4,%esi
+801007c8:	6a 08                	push   $0x8
+801007ca:	e8 a1 97 00 00       	call   80109f70 <uartputc>
+801007cf:	c7 04 24 20 00 00 00 	movl   $0x20,(%esp)
+801007d6:	e8 95 97 00 00       	call   80109f70 <uartputc>
+801007db:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+801007e2:	e8 89 97 00 00       	call   80109f70 <uartputc>
+801007e7:	b8 0e 00 00 00       	mov    $0xe,%eax
+801007ec:	89 f2                	mov    %esi,%edx
+801007ee:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801007ef:	bb d5 03 00 00       	mov    $0x3d5,%ebx
+801007f4:	89 da                	mov    %ebx,%edx
+801007f6:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+801007f7:	0f b6 c8             	movzbl %al,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801007fa:	89 f2                	mov    %esi,%edx
+801007fc:	b8 0f 00 00 00       	mov    $0xf,%eax
+80100801:	c1 e1 08             	shl    $0x8,%ecx
+80100804:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100805:	89 da                	mov    %ebx,%edx
+80100807:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+80100808:	0f b6 f0             	movzbl %al,%esi
+    if(pos > 0) --pos;
+8010080b:	83 c4 10             	add    $0x10,%esp
+8010080e:	09 ce                	or     %ecx,%esi
+80100810:	74 5e                	je     80100870 <consputc.part.0+0x190>
+80100812:	83 ee 01             	sub    $0x1,%esi
+80100815:	e9 2b ff ff ff       	jmp    80100745 <consputc.part.0+0x65>
+8010081a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+80100820:	83 ec 04             	sub    $0x4,%esp
+    pos -= 80;
+80100823:	8d 5e b0             	lea    -0x50(%esi),%ebx
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+80100826:	8d b4 36 60 7f 0b 80 	lea    -0x7ff480a0(%esi,%esi,1),%esi
+  outb(CRTPORT+1, pos);
+8010082d:	bf 07 00 00 00       	mov    $0x7,%edi
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+80100832:	68 60 0e 00 00       	push   $0xe60
+80100837:	68 a0 80 0b 80       	push   $0x800b80a0
+8010083c:	68 00 80 0b 80       	push   $0x800b8000
+80100841:	e8 da 7c 00 00       	call   80108520 <memmove>
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+80100846:	b8 80 07 00 00       	mov    $0x780,%eax
+8010084b:	83 c4 0c             	add    $0xc,%esp
+8010084e:	29 d8                	sub    %ebx,%eax
+80100850:	01 c0                	add    %eax,%eax
+80100852:	50                   	push   %eax
+80100853:	6a 00                	push   $0x0
+80100855:	56                   	push   %esi
+80100856:	e8 35 7c 00 00       	call   80108490 <memset>
+  outb(CRTPORT+1, pos);
+8010085b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+8010085e:	83 c4 10             	add    $0x10,%esp
+80100861:	e9 06 ff ff ff       	jmp    8010076c <consputc.part.0+0x8c>
+80100866:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010086d:	8d 76 00             	lea    0x0(%esi),%esi
+80100870:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+80100874:	be 00 80 0b 80       	mov    $0x800b8000,%esi
+80100879:	31 ff                	xor    %edi,%edi
+8010087b:	e9 ec fe ff ff       	jmp    8010076c <consputc.part.0+0x8c>
+    panic("pos under/overflow");
+80100880:	83 ec 0c             	sub    $0xc,%esp
+80100883:	68 0c b7 10 80       	push   $0x8010b70c
+80100888:	e8 d3 fd ff ff       	call   80100660 <panic>
+8010088d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80100890 <consolewrite>:
+
+int
+consolewrite(struct inode *ip, char *buf, int n)
+{
+80100890:	55                   	push   %ebp
+80100891:	89 e5                	mov    %esp,%ebp
+80100893:	57                   	push   %edi
+80100894:	56                   	push   %esi
+80100895:	53                   	push   %ebx
+80100896:	83 ec 18             	sub    $0x18,%esp
+80100899:	8b 75 10             	mov    0x10(%ebp),%esi
+  int i;
+
+  iunlock(ip);
+8010089c:	ff 75 08             	push   0x8(%ebp)
+8010089f:	e8 ac 21 00 00       	call   80102a50 <iunlock>
+  acquire(&cons.lock);
+801008a4:	c7 04 24 a0 43 20 80 	movl   $0x802043a0,(%esp)
+801008ab:	e8 b0 78 00 00       	call   80108160 <acquire>
+  for(i = 0; i < n; i++)
+801008b0:	83 c4 10             	add    $0x10,%esp
+801008b3:	85 f6                	test   %esi,%esi
+801008b5:	7e 25                	jle    801008dc <consolewrite+0x4c>
+801008b7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+801008ba:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+  if(panicked){
+801008bd:	8b 15 e4 43 20 80    	mov    0x802043e4,%edx
+    consputc(buf[i] & 0xff);
+801008c3:	0f b6 03             	movzbl (%ebx),%eax
+  if(panicked){
+801008c6:	85 d2                	test   %edx,%edx
+801008c8:	74 06                	je     801008d0 <consolewrite+0x40>
+  asm volatile("cli");
+801008ca:	fa                   	cli
+    for(;;)
+801008cb:	eb fe                	jmp    801008cb <consolewrite+0x3b>
+801008cd:	8d 76 00             	lea    0x0(%esi),%esi
+801008d0:	e8 0b fe ff ff       	call   801006e0 <consputc.part.0>
+  for(i = 0; i < n; i++)
+801008d5:	83 c3 01             	add    $0x1,%ebx
+801008d8:	39 df                	cmp    %ebx,%edi
+801008da:	75 e1                	jne    801008bd <consolewrite+0x2d>
+  release(&cons.lock);
+801008dc:	83 ec 0c             	sub    $0xc,%esp
+801008df:	68 a0 43 20 80       	push   $0x802043a0
+801008e4:	e8 b7 7a 00 00       	call   801083a0 <release>
+  ilock(ip);
+801008e9:	58                   	pop    %eax
+801008ea:	ff 75 08             	push   0x8(%ebp)
+801008ed:	e8 7e 20 00 00       	call   80102970 <ilock>
+
+  return n;
+}
+801008f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801008f5:	89 f0                	mov    %esi,%eax
+801008f7:	5b                   	pop    %ebx
+801008f8:	5e                   	pop    %esi
+801008f9:	5f                   	pop    %edi
+801008fa:	5d                   	pop    %ebp
+801008fb:	c3                   	ret
+801008fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80100900 <printint>:
+{
+80100900:	55                   	push   %ebp
+80100901:	89 e5                	mov    %esp,%ebp
+80100903:	57                   	push   %edi
+80100904:	56                   	push   %esi
+80100905:	89 c6                	mov    %eax,%esi
+80100907:	53                   	push   %ebx
+80100908:	89 d3                	mov    %edx,%ebx
+8010090a:	83 ec 2c             	sub    $0x2c,%esp
+  if(sign && (sign = xx < 0))
+8010090d:	85 c9                	test   %ecx,%ecx
+8010090f:	74 04                	je     80100915 <printint+0x15>
+80100911:	85 c0                	test   %eax,%eax
+80100913:	78 63                	js     80100978 <printint+0x78>
+    x = xx;
+80100915:	89 f1                	mov    %esi,%ecx
+80100917:	31 c0                	xor    %eax,%eax
+  i = 0;
+80100919:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+8010091c:	31 f6                	xor    %esi,%esi
+8010091e:	66 90                	xchg   %ax,%ax
+    buf[i++] = digits[x % base];
+80100920:	89 c8                	mov    %ecx,%eax
+80100922:	31 d2                	xor    %edx,%edx
+80100924:	89 f7                	mov    %esi,%edi
+80100926:	f7 f3                	div    %ebx
+80100928:	8d 76 01             	lea    0x1(%esi),%esi
+8010092b:	0f b6 92 38 b7 10 80 	movzbl -0x7fef48c8(%edx),%edx
+80100932:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+80100936:	89 ca                	mov    %ecx,%edx
+80100938:	89 c1                	mov    %eax,%ecx
+8010093a:	39 da                	cmp    %ebx,%edx
+8010093c:	73 e2                	jae    80100920 <printint+0x20>
+  if(sign)
+8010093e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80100941:	85 c0                	test   %eax,%eax
+80100943:	74 07                	je     8010094c <printint+0x4c>
+    buf[i++] = '-';
+80100945:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+8010094a:	89 f7                	mov    %esi,%edi
+8010094c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+8010094f:	01 df                	add    %ebx,%edi
+  if(panicked){
+80100951:	8b 15 e4 43 20 80    	mov    0x802043e4,%edx
+    consputc(buf[i]);
+80100957:	0f be 07             	movsbl (%edi),%eax
+  if(panicked){
+8010095a:	85 d2                	test   %edx,%edx
+8010095c:	74 0a                	je     80100968 <printint+0x68>
+8010095e:	fa                   	cli
+    for(;;)
+8010095f:	eb fe                	jmp    8010095f <printint+0x5f>
+80100961:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100968:	e8 73 fd ff ff       	call   801006e0 <consputc.part.0>
+  while(--i >= 0)
+8010096d:	8d 47 ff             	lea    -0x1(%edi),%eax
+80100970:	39 df                	cmp    %ebx,%edi
+80100972:	74 0c                	je     80100980 <printint+0x80>
+80100974:	89 c7                	mov    %eax,%edi
+80100976:	eb d9                	jmp    80100951 <printint+0x51>
+80100978:	89 c8                	mov    %ecx,%eax
+    x = -xx;
+8010097a:	89 f1                	mov    %esi,%ecx
+8010097c:	f7 d9                	neg    %ecx
+8010097e:	eb 99                	jmp    80100919 <printint+0x19>
+}
+80100980:	83 c4 2c             	add    $0x2c,%esp
+80100983:	5b                   	pop    %ebx
+80100984:	5e                   	pop    %esi
+80100985:	5f                   	pop    %edi
+80100986:	5d                   	pop    %ebp
+80100987:	c3                   	ret
+80100988:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010098f:	90                   	nop
+
+80100990 <cprintf>:
+{
+80100990:	55                   	push   %ebp
+80100991:	89 e5                	mov    %esp,%ebp
+80100993:	57                   	push   %edi
+80100994:	56                   	push   %esi
+80100995:	53                   	push   %ebx
+80100996:	83 ec 1c             	sub    $0x1c,%esp
+  locking = cons.locking;
+80100999:	8b 3d e0 43 20 80    	mov    0x802043e0,%edi
+  if (fmt == 0)
+8010099f:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(locking)
+801009a2:	85 ff                	test   %edi,%edi
+801009a4:	0f 85 36 01 00 00    	jne    80100ae0 <cprintf+0x150>
+  if (fmt == 0)
+801009aa:	85 f6                	test   %esi,%esi
+801009ac:	0f 84 e0 01 00 00    	je     80100b92 <cprintf+0x202>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+801009b2:	0f b6 06             	movzbl (%esi),%eax
+801009b5:	85 c0                	test   %eax,%eax
+801009b7:	74 6b                	je     80100a24 <cprintf+0x94>
+  argp = (uint*)(void*)(&fmt + 1);
+801009b9:	8d 55 0c             	lea    0xc(%ebp),%edx
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+801009bc:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+801009bf:	31 db                	xor    %ebx,%ebx
+801009c1:	89 d7                	mov    %edx,%edi
+    if(c != '%'){
+801009c3:	83 f8 25             	cmp    $0x25,%eax
+801009c6:	0f 85 dc 00 00 00    	jne    80100aa8 <cprintf+0x118>
+    c = fmt[++i] & 0xff;
+801009cc:	83 c3 01             	add    $0x1,%ebx
+801009cf:	0f b6 0c 1e          	movzbl (%esi,%ebx,1),%ecx
+    if(c == 0)
+801009d3:	85 c9                	test   %ecx,%ecx
+801009d5:	74 42                	je     80100a19 <cprintf+0x89>
+    switch(c){
+801009d7:	83 f9 70             	cmp    $0x70,%ecx
+801009da:	0f 84 99 00 00 00    	je     80100a79 <cprintf+0xe9>
+801009e0:	7f 4e                	jg     80100a30 <cprintf+0xa0>
+801009e2:	83 f9 25             	cmp    $0x25,%ecx
+801009e5:	0f 84 cd 00 00 00    	je     80100ab8 <cprintf+0x128>
+801009eb:	83 f9 64             	cmp    $0x64,%ecx
+801009ee:	0f 85 24 01 00 00    	jne    80100b18 <cprintf+0x188>
+      printint(*argp++, 10, 1);
+801009f4:	8d 47 04             	lea    0x4(%edi),%eax
+801009f7:	b9 01 00 00 00       	mov    $0x1,%ecx
+801009fc:	ba 0a 00 00 00       	mov    $0xa,%edx
+80100a01:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80100a04:	8b 07                	mov    (%edi),%eax
+80100a06:	e8 f5 fe ff ff       	call   80100900 <printint>
+80100a0b:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100a0e:	83 c3 01             	add    $0x1,%ebx
+80100a11:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+80100a15:	85 c0                	test   %eax,%eax
+80100a17:	75 aa                	jne    801009c3 <cprintf+0x33>
+80100a19:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  if(locking)
+80100a1c:	85 ff                	test   %edi,%edi
+80100a1e:	0f 85 df 00 00 00    	jne    80100b03 <cprintf+0x173>
+}
+80100a24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100a27:	5b                   	pop    %ebx
+80100a28:	5e                   	pop    %esi
+80100a29:	5f                   	pop    %edi
+80100a2a:	5d                   	pop    %ebp
+80100a2b:	c3                   	ret
+80100a2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+80100a30:	83 f9 73             	cmp    $0x73,%ecx
+80100a33:	75 3b                	jne    80100a70 <cprintf+0xe0>
+      if((s = (char*)*argp++) == 0)
+80100a35:	8b 17                	mov    (%edi),%edx
+80100a37:	8d 47 04             	lea    0x4(%edi),%eax
+80100a3a:	85 d2                	test   %edx,%edx
+80100a3c:	0f 85 0e 01 00 00    	jne    80100b50 <cprintf+0x1c0>
+80100a42:	b9 28 00 00 00       	mov    $0x28,%ecx
+        s = "(null)";
+80100a47:	bf 1f b7 10 80       	mov    $0x8010b71f,%edi
+80100a4c:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+80100a4f:	89 fb                	mov    %edi,%ebx
+80100a51:	89 f7                	mov    %esi,%edi
+80100a53:	89 c6                	mov    %eax,%esi
+80100a55:	0f be c1             	movsbl %cl,%eax
+  if(panicked){
+80100a58:	8b 15 e4 43 20 80    	mov    0x802043e4,%edx
+80100a5e:	85 d2                	test   %edx,%edx
+80100a60:	0f 84 fe 00 00 00    	je     80100b64 <cprintf+0x1d4>
+80100a66:	fa                   	cli
+    for(;;)
+80100a67:	eb fe                	jmp    80100a67 <cprintf+0xd7>
+80100a69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+80100a70:	83 f9 78             	cmp    $0x78,%ecx
+80100a73:	0f 85 9f 00 00 00    	jne    80100b18 <cprintf+0x188>
+      printint(*argp++, 16, 0);
+80100a79:	8d 47 04             	lea    0x4(%edi),%eax
+80100a7c:	31 c9                	xor    %ecx,%ecx
+80100a7e:	ba 10 00 00 00       	mov    $0x10,%edx
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100a83:	83 c3 01             	add    $0x1,%ebx
+      printint(*argp++, 16, 0);
+80100a86:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80100a89:	8b 07                	mov    (%edi),%eax
+80100a8b:	e8 70 fe ff ff       	call   80100900 <printint>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100a90:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+      printint(*argp++, 16, 0);
+80100a94:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100a97:	85 c0                	test   %eax,%eax
+80100a99:	0f 85 24 ff ff ff    	jne    801009c3 <cprintf+0x33>
+80100a9f:	e9 75 ff ff ff       	jmp    80100a19 <cprintf+0x89>
+80100aa4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(panicked){
+80100aa8:	8b 0d e4 43 20 80    	mov    0x802043e4,%ecx
+80100aae:	85 c9                	test   %ecx,%ecx
+80100ab0:	74 15                	je     80100ac7 <cprintf+0x137>
+80100ab2:	fa                   	cli
+    for(;;)
+80100ab3:	eb fe                	jmp    80100ab3 <cprintf+0x123>
+80100ab5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(panicked){
+80100ab8:	8b 0d e4 43 20 80    	mov    0x802043e4,%ecx
+80100abe:	85 c9                	test   %ecx,%ecx
+80100ac0:	75 7e                	jne    80100b40 <cprintf+0x1b0>
+80100ac2:	b8 25 00 00 00       	mov    $0x25,%eax
+80100ac7:	e8 14 fc ff ff       	call   801006e0 <consputc.part.0>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100acc:	83 c3 01             	add    $0x1,%ebx
+80100acf:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+80100ad3:	85 c0                	test   %eax,%eax
+80100ad5:	0f 85 e8 fe ff ff    	jne    801009c3 <cprintf+0x33>
+80100adb:	e9 39 ff ff ff       	jmp    80100a19 <cprintf+0x89>
+    acquire(&cons.lock);
+80100ae0:	83 ec 0c             	sub    $0xc,%esp
+80100ae3:	68 a0 43 20 80       	push   $0x802043a0
+80100ae8:	e8 73 76 00 00       	call   80108160 <acquire>
+  if (fmt == 0)
+80100aed:	83 c4 10             	add    $0x10,%esp
+80100af0:	85 f6                	test   %esi,%esi
+80100af2:	0f 84 9a 00 00 00    	je     80100b92 <cprintf+0x202>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100af8:	0f b6 06             	movzbl (%esi),%eax
+80100afb:	85 c0                	test   %eax,%eax
+80100afd:	0f 85 b6 fe ff ff    	jne    801009b9 <cprintf+0x29>
+    release(&cons.lock);
+80100b03:	83 ec 0c             	sub    $0xc,%esp
+80100b06:	68 a0 43 20 80       	push   $0x802043a0
+80100b0b:	e8 90 78 00 00       	call   801083a0 <release>
+80100b10:	83 c4 10             	add    $0x10,%esp
+80100b13:	e9 0c ff ff ff       	jmp    80100a24 <cprintf+0x94>
+  if(panicked){
+80100b18:	8b 15 e4 43 20 80    	mov    0x802043e4,%edx
+80100b1e:	85 d2                	test   %edx,%edx
+80100b20:	75 26                	jne    80100b48 <cprintf+0x1b8>
+80100b22:	b8 25 00 00 00       	mov    $0x25,%eax
+80100b27:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+80100b2a:	e8 b1 fb ff ff       	call   801006e0 <consputc.part.0>
+80100b2f:	a1 e4 43 20 80       	mov    0x802043e4,%eax
+80100b34:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80100b37:	85 c0                	test   %eax,%eax
+80100b39:	74 4b                	je     80100b86 <cprintf+0x1f6>
+80100b3b:	fa                   	cli
+    for(;;)
+80100b3c:	eb fe                	jmp    80100b3c <cprintf+0x1ac>
+80100b3e:	66 90                	xchg   %ax,%ax
+80100b40:	fa                   	cli
+80100b41:	eb fe                	jmp    80100b41 <cprintf+0x1b1>
+80100b43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100b47:	90                   	nop
+80100b48:	fa                   	cli
+80100b49:	eb fe                	jmp    80100b49 <cprintf+0x1b9>
+80100b4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100b4f:	90                   	nop
+      for(; *s; s++)
+80100b50:	0f b6 0a             	movzbl (%edx),%ecx
+      if((s = (char*)*argp++) == 0)
+80100b53:	89 d7                	mov    %edx,%edi
+      for(; *s; s++)
+80100b55:	84 c9                	test   %cl,%cl
+80100b57:	0f 85 ef fe ff ff    	jne    80100a4c <cprintf+0xbc>
+      if((s = (char*)*argp++) == 0)
+80100b5d:	89 c7                	mov    %eax,%edi
+80100b5f:	e9 aa fe ff ff       	jmp    80100a0e <cprintf+0x7e>
+80100b64:	e8 77 fb ff ff       	call   801006e0 <consputc.part.0>
+      for(; *s; s++)
+80100b69:	0f be 43 01          	movsbl 0x1(%ebx),%eax
+80100b6d:	83 c3 01             	add    $0x1,%ebx
+80100b70:	84 c0                	test   %al,%al
+80100b72:	0f 85 e0 fe ff ff    	jne    80100a58 <cprintf+0xc8>
+      if((s = (char*)*argp++) == 0)
+80100b78:	89 f0                	mov    %esi,%eax
+80100b7a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80100b7d:	89 fe                	mov    %edi,%esi
+80100b7f:	89 c7                	mov    %eax,%edi
+80100b81:	e9 88 fe ff ff       	jmp    80100a0e <cprintf+0x7e>
+80100b86:	89 c8                	mov    %ecx,%eax
+80100b88:	e8 53 fb ff ff       	call   801006e0 <consputc.part.0>
+80100b8d:	e9 7c fe ff ff       	jmp    80100a0e <cprintf+0x7e>
+    panic("null fmt");
+80100b92:	83 ec 0c             	sub    $0xc,%esp
+80100b95:	68 26 b7 10 80       	push   $0x8010b726
+80100b9a:	e8 c1 fa ff ff       	call   80100660 <panic>
+80100b9f:	90                   	nop
+
+80100ba0 <consoleintr>:
+{
+80100ba0:	55                   	push   %ebp
+80100ba1:	89 e5                	mov    %esp,%ebp
+80100ba3:	57                   	push   %edi
+80100ba4:	56                   	push   %esi
+  int c, doprocdump = 0, dolockdump = 0;
+80100ba5:	31 f6                	xor    %esi,%esi
+{
+80100ba7:	53                   	push   %ebx
+80100ba8:	83 ec 28             	sub    $0x28,%esp
+80100bab:	8b 7d 08             	mov    0x8(%ebp),%edi
+  acquire(&cons.lock);
+80100bae:	68 a0 43 20 80       	push   $0x802043a0
+80100bb3:	e8 a8 75 00 00       	call   80108160 <acquire>
+  int c, doprocdump = 0, dolockdump = 0;
+80100bb8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  while((c = getc()) >= 0){
+80100bbf:	83 c4 10             	add    $0x10,%esp
+80100bc2:	ff d7                	call   *%edi
+80100bc4:	89 c3                	mov    %eax,%ebx
+80100bc6:	85 c0                	test   %eax,%eax
+80100bc8:	0f 88 9d 00 00 00    	js     80100c6b <consoleintr+0xcb>
+80100bce:	66 90                	xchg   %ax,%ax
+    switch(c){
+80100bd0:	83 fb 10             	cmp    $0x10,%ebx
+80100bd3:	0f 84 c7 00 00 00    	je     80100ca0 <consoleintr+0x100>
+80100bd9:	7e 75                	jle    80100c50 <consoleintr+0xb0>
+80100bdb:	83 fb 15             	cmp    $0x15,%ebx
+80100bde:	74 3a                	je     80100c1a <consoleintr+0x7a>
+80100be0:	83 fb 7f             	cmp    $0x7f,%ebx
+80100be3:	0f 85 8e 01 00 00    	jne    80100d77 <consoleintr+0x1d7>
+      if(input.e != input.w){
+80100be9:	a1 88 43 20 80       	mov    0x80204388,%eax
+80100bee:	3b 05 84 43 20 80    	cmp    0x80204384,%eax
+80100bf4:	74 cc                	je     80100bc2 <consoleintr+0x22>
+  if(panicked){
+80100bf6:	8b 15 e4 43 20 80    	mov    0x802043e4,%edx
+        input.e--;
+80100bfc:	83 e8 01             	sub    $0x1,%eax
+80100bff:	a3 88 43 20 80       	mov    %eax,0x80204388
+  if(panicked){
+80100c04:	85 d2                	test   %edx,%edx
+80100c06:	0f 84 1f 01 00 00    	je     80100d2b <consoleintr+0x18b>
+80100c0c:	fa                   	cli
+    for(;;)
+80100c0d:	eb fe                	jmp    80100c0d <consoleintr+0x6d>
+80100c0f:	90                   	nop
+80100c10:	b8 00 01 00 00       	mov    $0x100,%eax
+80100c15:	e8 c6 fa ff ff       	call   801006e0 <consputc.part.0>
+      while(input.e != input.w &&
+80100c1a:	a1 88 43 20 80       	mov    0x80204388,%eax
+80100c1f:	3b 05 84 43 20 80    	cmp    0x80204384,%eax
+80100c25:	74 9b                	je     80100bc2 <consoleintr+0x22>
+            input.buf[(input.e-1) % INPUT_BUF] != '\n'){
+80100c27:	83 e8 01             	sub    $0x1,%eax
+80100c2a:	89 c2                	mov    %eax,%edx
+80100c2c:	83 e2 7f             	and    $0x7f,%edx
+      while(input.e != input.w &&
+80100c2f:	80 ba 00 43 20 80 0a 	cmpb   $0xa,-0x7fdfbd00(%edx)
+80100c36:	74 8a                	je     80100bc2 <consoleintr+0x22>
+  if(panicked){
+80100c38:	8b 0d e4 43 20 80    	mov    0x802043e4,%ecx
+        input.e--;
+80100c3e:	a3 88 43 20 80       	mov    %eax,0x80204388
+  if(panicked){
+80100c43:	85 c9                	test   %ecx,%ecx
+80100c45:	74 c9                	je     80100c10 <consoleintr+0x70>
+80100c47:	fa                   	cli
+    for(;;)
+80100c48:	eb fe                	jmp    80100c48 <consoleintr+0xa8>
+80100c4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    switch(c){
+80100c50:	83 fb 08             	cmp    $0x8,%ebx
+80100c53:	74 94                	je     80100be9 <consoleintr+0x49>
+80100c55:	83 fb 0c             	cmp    $0xc,%ebx
+80100c58:	75 52                	jne    80100cac <consoleintr+0x10c>
+  while((c = getc()) >= 0){
+80100c5a:	ff d7                	call   *%edi
+    switch(c){
+80100c5c:	be 01 00 00 00       	mov    $0x1,%esi
+  while((c = getc()) >= 0){
+80100c61:	89 c3                	mov    %eax,%ebx
+80100c63:	85 c0                	test   %eax,%eax
+80100c65:	0f 89 65 ff ff ff    	jns    80100bd0 <consoleintr+0x30>
+  release(&cons.lock);
+80100c6b:	83 ec 0c             	sub    $0xc,%esp
+80100c6e:	68 a0 43 20 80       	push   $0x802043a0
+80100c73:	e8 28 77 00 00       	call   801083a0 <release>
+  if(doprocdump) {
+80100c78:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80100c7b:	83 c4 10             	add    $0x10,%esp
+80100c7e:	85 c0                	test   %eax,%eax
+80100c80:	0f 85 c6 00 00 00    	jne    80100d4c <consoleintr+0x1ac>
+  if(dolockdump)
+80100c86:	85 f6                	test   %esi,%esi
+80100c88:	0f 85 b2 00 00 00    	jne    80100d40 <consoleintr+0x1a0>
+}
+80100c8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100c91:	5b                   	pop    %ebx
+80100c92:	5e                   	pop    %esi
+80100c93:	5f                   	pop    %edi
+80100c94:	5d                   	pop    %ebp
+80100c95:	c3                   	ret
+80100c96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100c9d:	8d 76 00             	lea    0x0(%esi),%esi
+      doprocdump = 1;
+80100ca0:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+80100ca7:	e9 16 ff ff ff       	jmp    80100bc2 <consoleintr+0x22>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+80100cac:	85 db                	test   %ebx,%ebx
+80100cae:	0f 84 0e ff ff ff    	je     80100bc2 <consoleintr+0x22>
+80100cb4:	a1 88 43 20 80       	mov    0x80204388,%eax
+80100cb9:	89 c2                	mov    %eax,%edx
+80100cbb:	2b 15 80 43 20 80    	sub    0x80204380,%edx
+80100cc1:	83 fa 7f             	cmp    $0x7f,%edx
+80100cc4:	0f 87 f8 fe ff ff    	ja     80100bc2 <consoleintr+0x22>
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100cca:	89 c2                	mov    %eax,%edx
+  if(panicked){
+80100ccc:	8b 0d e4 43 20 80    	mov    0x802043e4,%ecx
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100cd2:	83 c0 01             	add    $0x1,%eax
+80100cd5:	83 e2 7f             	and    $0x7f,%edx
+        c = (c == '\r') ? '\n' : c;
+80100cd8:	83 fb 0d             	cmp    $0xd,%ebx
+80100cdb:	74 79                	je     80100d56 <consoleintr+0x1b6>
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100cdd:	a3 88 43 20 80       	mov    %eax,0x80204388
+80100ce2:	88 9a 00 43 20 80    	mov    %bl,-0x7fdfbd00(%edx)
+  if(panicked){
+80100ce8:	85 c9                	test   %ecx,%ecx
+80100cea:	75 4e                	jne    80100d3a <consoleintr+0x19a>
+80100cec:	89 d8                	mov    %ebx,%eax
+80100cee:	e8 ed f9 ff ff       	call   801006e0 <consputc.part.0>
+        if(c == '\n' || c == C('D') || input.e == input.r+INPUT_BUF){
+80100cf3:	83 fb 0a             	cmp    $0xa,%ebx
+80100cf6:	74 78                	je     80100d70 <consoleintr+0x1d0>
+80100cf8:	83 fb 04             	cmp    $0x4,%ebx
+80100cfb:	74 73                	je     80100d70 <consoleintr+0x1d0>
+80100cfd:	a1 80 43 20 80       	mov    0x80204380,%eax
+80100d02:	83 e8 80             	sub    $0xffffff80,%eax
+80100d05:	39 05 88 43 20 80    	cmp    %eax,0x80204388
+80100d0b:	0f 85 b1 fe ff ff    	jne    80100bc2 <consoleintr+0x22>
+          wakeup(&input.r);
+80100d11:	83 ec 0c             	sub    $0xc,%esp
+          input.w = input.e;
+80100d14:	a3 84 43 20 80       	mov    %eax,0x80204384
+          wakeup(&input.r);
+80100d19:	68 80 43 20 80       	push   $0x80204380
+80100d1e:	e8 6d 6b 00 00       	call   80107890 <wakeup>
+80100d23:	83 c4 10             	add    $0x10,%esp
+80100d26:	e9 97 fe ff ff       	jmp    80100bc2 <consoleintr+0x22>
+80100d2b:	b8 00 01 00 00       	mov    $0x100,%eax
+80100d30:	e8 ab f9 ff ff       	call   801006e0 <consputc.part.0>
+80100d35:	e9 88 fe ff ff       	jmp    80100bc2 <consoleintr+0x22>
+80100d3a:	fa                   	cli
+    for(;;)
+80100d3b:	eb fe                	jmp    80100d3b <consoleintr+0x19b>
+80100d3d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+80100d40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100d43:	5b                   	pop    %ebx
+80100d44:	5e                   	pop    %esi
+80100d45:	5f                   	pop    %edi
+80100d46:	5d                   	pop    %ebp
+    lockdump();
+80100d47:	e9 e4 72 00 00       	jmp    80108030 <lockdump>
+    procdump();  // now call procdump() wo. cons.lock held
+80100d4c:	e8 ef 6e 00 00       	call   80107c40 <procdump>
+80100d51:	e9 30 ff ff ff       	jmp    80100c86 <consoleintr+0xe6>
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100d56:	a3 88 43 20 80       	mov    %eax,0x80204388
+80100d5b:	c6 82 00 43 20 80 0a 	movb   $0xa,-0x7fdfbd00(%edx)
+  if(panicked){
+80100d62:	85 c9                	test   %ecx,%ecx
+80100d64:	75 d4                	jne    80100d3a <consoleintr+0x19a>
+80100d66:	b8 0a 00 00 00       	mov    $0xa,%eax
+80100d6b:	e8 70 f9 ff ff       	call   801006e0 <consputc.part.0>
+          input.w = input.e;
+80100d70:	a1 88 43 20 80       	mov    0x80204388,%eax
+80100d75:	eb 9a                	jmp    80100d11 <consoleintr+0x171>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+80100d77:	a1 88 43 20 80       	mov    0x80204388,%eax
+80100d7c:	89 c2                	mov    %eax,%edx
+80100d7e:	2b 15 80 43 20 80    	sub    0x80204380,%edx
+80100d84:	83 fa 7f             	cmp    $0x7f,%edx
+80100d87:	0f 87 35 fe ff ff    	ja     80100bc2 <consoleintr+0x22>
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100d8d:	89 c2                	mov    %eax,%edx
+  if(panicked){
+80100d8f:	8b 0d e4 43 20 80    	mov    0x802043e4,%ecx
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100d95:	83 c0 01             	add    $0x1,%eax
+80100d98:	83 e2 7f             	and    $0x7f,%edx
+80100d9b:	e9 3d ff ff ff       	jmp    80100cdd <consoleintr+0x13d>
+
+80100da0 <consoleinit>:
+
+void
+consoleinit(void)
+{
+80100da0:	55                   	push   %ebp
+80100da1:	89 e5                	mov    %esp,%ebp
+80100da3:	83 ec 10             	sub    $0x10,%esp
+  initlock(&cons.lock, "console");
+80100da6:	68 2f b7 10 80       	push   $0x8010b72f
+80100dab:	68 a0 43 20 80       	push   $0x802043a0
+80100db0:	e8 5b 71 00 00       	call   80107f10 <initlock>
+
+  devsw[CONSOLE].write = consolewrite;
+80100db5:	c7 05 2c 73 20 80 90 	movl   $0x80100890,0x8020732c
+80100dbc:	08 10 80 
+  devsw[CONSOLE].read = consoleread;
+80100dbf:	c7 05 28 73 20 80 60 	movl   $0x80100560,0x80207328
+80100dc6:	05 10 80 
+  cons.locking = 1;
+80100dc9:	c7 05 e0 43 20 80 01 	movl   $0x1,0x802043e0
+80100dd0:	00 00 00 
+
+  ioapicenable(IRQ_KBD, 0);
+80100dd3:	58                   	pop    %eax
+80100dd4:	5a                   	pop    %edx
+80100dd5:	6a 00                	push   $0x0
+80100dd7:	6a 01                	push   $0x1
+80100dd9:	e8 12 3b 00 00       	call   801048f0 <ioapicenable>
+}
+80100dde:	83 c4 10             	add    $0x10,%esp
+80100de1:	c9                   	leave
+80100de2:	c3                   	ret
+80100de3:	66 90                	xchg   %ax,%ax
+80100de5:	66 90                	xchg   %ax,%ax
+80100de7:	66 90                	xchg   %ax,%ax
+80100de9:	66 90                	xchg   %ax,%ax
+80100deb:	66 90                	xchg   %ax,%ax
+80100ded:	66 90                	xchg   %ax,%ax
+80100def:	90                   	nop
+
+80100df0 <exec>:
+#include "x86.h"
+#include "elf.h"
+
+int
+exec(char *path, char **argv)
+{
+80100df0:	55                   	push   %ebp
+80100df1:	89 e5                	mov    %esp,%ebp
+80100df3:	57                   	push   %edi
+80100df4:	56                   	push   %esi
+80100df5:	53                   	push   %ebx
+80100df6:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+  uint argc, sz, sp, ustack[3+MAXARG+1];
+  struct elfhdr elf;
+  struct inode *ip;
+  struct proghdr ph;
+  pde_t *pgdir, *oldpgdir;
+  struct proc *curproc = myproc();
+80100dfc:	e8 6f 60 00 00       	call   80106e70 <myproc>
+80100e01:	89 85 ec fe ff ff    	mov    %eax,-0x114(%ebp)
+
+  begin_op();
+80100e07:	e8 b4 4c 00 00       	call   80105ac0 <begin_op>
+
+  if((ip = namei(path)) == 0){
+80100e0c:	83 ec 0c             	sub    $0xc,%esp
+80100e0f:	ff 75 08             	push   0x8(%ebp)
+80100e12:	e8 09 33 00 00       	call   80104120 <namei>
+80100e17:	83 c4 10             	add    $0x10,%esp
+80100e1a:	85 c0                	test   %eax,%eax
+80100e1c:	0f 84 30 03 00 00    	je     80101152 <exec+0x362>
+    end_op();
+    cprintf("exec: fail\n");
+    return -1;
+  }
+  ilock(ip);
+80100e22:	83 ec 0c             	sub    $0xc,%esp
+80100e25:	89 c7                	mov    %eax,%edi
+80100e27:	50                   	push   %eax
+80100e28:	e8 43 1b 00 00       	call   80102970 <ilock>
+  pgdir = 0;
+
+  // Check ELF header
+  if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
+80100e2d:	8d 85 24 ff ff ff    	lea    -0xdc(%ebp),%eax
+80100e33:	6a 34                	push   $0x34
+80100e35:	6a 00                	push   $0x0
+80100e37:	50                   	push   %eax
+80100e38:	57                   	push   %edi
+80100e39:	e8 02 21 00 00       	call   80102f40 <readi>
+80100e3e:	83 c4 20             	add    $0x20,%esp
+80100e41:	83 f8 34             	cmp    $0x34,%eax
+80100e44:	0f 85 01 01 00 00    	jne    80100f4b <exec+0x15b>
+    goto bad;
+  if(elf.magic != ELF_MAGIC)
+80100e4a:	81 bd 24 ff ff ff 7f 	cmpl   $0x464c457f,-0xdc(%ebp)
+80100e51:	45 4c 46 
+80100e54:	0f 85 f1 00 00 00    	jne    80100f4b <exec+0x15b>
+    goto bad;
+
+  if((pgdir = setupkvm()) == 0)
+80100e5a:	e8 81 a2 00 00       	call   8010b0e0 <setupkvm>
+80100e5f:	89 85 f4 fe ff ff    	mov    %eax,-0x10c(%ebp)
+80100e65:	85 c0                	test   %eax,%eax
+80100e67:	0f 84 de 00 00 00    	je     80100f4b <exec+0x15b>
+    goto bad;
+
+  // Load program into memory.
+  sz = 0;
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80100e6d:	66 83 bd 50 ff ff ff 	cmpw   $0x0,-0xb0(%ebp)
+80100e74:	00 
+80100e75:	8b b5 40 ff ff ff    	mov    -0xc0(%ebp),%esi
+80100e7b:	0f 84 a1 02 00 00    	je     80101122 <exec+0x332>
+  sz = 0;
+80100e81:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+80100e88:	00 00 00 
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80100e8b:	31 db                	xor    %ebx,%ebx
+80100e8d:	e9 8c 00 00 00       	jmp    80100f1e <exec+0x12e>
+80100e92:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+      goto bad;
+    if(ph.type != ELF_PROG_LOAD)
+80100e98:	83 bd 04 ff ff ff 01 	cmpl   $0x1,-0xfc(%ebp)
+80100e9f:	75 6c                	jne    80100f0d <exec+0x11d>
+      continue;
+    if(ph.memsz < ph.filesz)
+80100ea1:	8b 85 18 ff ff ff    	mov    -0xe8(%ebp),%eax
+80100ea7:	3b 85 14 ff ff ff    	cmp    -0xec(%ebp),%eax
+80100ead:	0f 82 87 00 00 00    	jb     80100f3a <exec+0x14a>
+      goto bad;
+    if(ph.vaddr + ph.memsz < ph.vaddr)
+80100eb3:	03 85 0c ff ff ff    	add    -0xf4(%ebp),%eax
+80100eb9:	72 7f                	jb     80100f3a <exec+0x14a>
+      goto bad;
+    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+80100ebb:	83 ec 04             	sub    $0x4,%esp
+80100ebe:	50                   	push   %eax
+80100ebf:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+80100ec5:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100ecb:	e8 40 a0 00 00       	call   8010af10 <allocuvm>
+80100ed0:	83 c4 10             	add    $0x10,%esp
+80100ed3:	89 85 f0 fe ff ff    	mov    %eax,-0x110(%ebp)
+80100ed9:	85 c0                	test   %eax,%eax
+80100edb:	74 5d                	je     80100f3a <exec+0x14a>
+      goto bad;
+    if(ph.vaddr % PGSIZE != 0)
+80100edd:	8b 85 0c ff ff ff    	mov    -0xf4(%ebp),%eax
+80100ee3:	a9 ff 0f 00 00       	test   $0xfff,%eax
+80100ee8:	75 50                	jne    80100f3a <exec+0x14a>
+      goto bad;
+    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+80100eea:	83 ec 0c             	sub    $0xc,%esp
+80100eed:	ff b5 14 ff ff ff    	push   -0xec(%ebp)
+80100ef3:	ff b5 08 ff ff ff    	push   -0xf8(%ebp)
+80100ef9:	57                   	push   %edi
+80100efa:	50                   	push   %eax
+80100efb:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100f01:	e8 3a 9f 00 00       	call   8010ae40 <loaduvm>
+80100f06:	83 c4 20             	add    $0x20,%esp
+80100f09:	85 c0                	test   %eax,%eax
+80100f0b:	78 2d                	js     80100f3a <exec+0x14a>
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80100f0d:	0f b7 85 50 ff ff ff 	movzwl -0xb0(%ebp),%eax
+80100f14:	83 c3 01             	add    $0x1,%ebx
+80100f17:	83 c6 20             	add    $0x20,%esi
+80100f1a:	39 d8                	cmp    %ebx,%eax
+80100f1c:	7e 52                	jle    80100f70 <exec+0x180>
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+80100f1e:	8d 85 04 ff ff ff    	lea    -0xfc(%ebp),%eax
+80100f24:	6a 20                	push   $0x20
+80100f26:	56                   	push   %esi
+80100f27:	50                   	push   %eax
+80100f28:	57                   	push   %edi
+80100f29:	e8 12 20 00 00       	call   80102f40 <readi>
+80100f2e:	83 c4 10             	add    $0x10,%esp
+80100f31:	83 f8 20             	cmp    $0x20,%eax
+80100f34:	0f 84 5e ff ff ff    	je     80100e98 <exec+0xa8>
+  freevm(oldpgdir);
+  return 0;
+
+ bad:
+  if(pgdir)
+    freevm(pgdir);
+80100f3a:	83 ec 0c             	sub    $0xc,%esp
+80100f3d:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100f43:	e8 18 a1 00 00       	call   8010b060 <freevm>
+  if(ip){
+80100f48:	83 c4 10             	add    $0x10,%esp
+    iunlockput(ip);
+80100f4b:	83 ec 0c             	sub    $0xc,%esp
+80100f4e:	57                   	push   %edi
+80100f4f:	e8 6c 1f 00 00       	call   80102ec0 <iunlockput>
+    end_op();
+80100f54:	e8 97 4b 00 00       	call   80105af0 <end_op>
+80100f59:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80100f5c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  }
+  return -1;
+}
+80100f61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100f64:	5b                   	pop    %ebx
+80100f65:	5e                   	pop    %esi
+80100f66:	5f                   	pop    %edi
+80100f67:	5d                   	pop    %ebp
+80100f68:	c3                   	ret
+80100f69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sz = PGROUNDUP(sz);
+80100f70:	8b b5 f0 fe ff ff    	mov    -0x110(%ebp),%esi
+80100f76:	81 c6 ff 0f 00 00    	add    $0xfff,%esi
+80100f7c:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+80100f82:	8d 9e 00 20 00 00    	lea    0x2000(%esi),%ebx
+  iunlockput(ip);
+80100f88:	83 ec 0c             	sub    $0xc,%esp
+80100f8b:	57                   	push   %edi
+80100f8c:	e8 2f 1f 00 00       	call   80102ec0 <iunlockput>
+  end_op();
+80100f91:	e8 5a 4b 00 00       	call   80105af0 <end_op>
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+80100f96:	83 c4 0c             	add    $0xc,%esp
+80100f99:	53                   	push   %ebx
+80100f9a:	56                   	push   %esi
+80100f9b:	8b b5 f4 fe ff ff    	mov    -0x10c(%ebp),%esi
+80100fa1:	56                   	push   %esi
+80100fa2:	e8 69 9f 00 00       	call   8010af10 <allocuvm>
+80100fa7:	83 c4 10             	add    $0x10,%esp
+80100faa:	89 c7                	mov    %eax,%edi
+80100fac:	85 c0                	test   %eax,%eax
+80100fae:	0f 84 86 00 00 00    	je     8010103a <exec+0x24a>
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+80100fb4:	83 ec 08             	sub    $0x8,%esp
+80100fb7:	8d 80 00 e0 ff ff    	lea    -0x2000(%eax),%eax
+  for(argc = 0; argv[argc]; argc++) {
+80100fbd:	89 fb                	mov    %edi,%ebx
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+80100fbf:	50                   	push   %eax
+80100fc0:	56                   	push   %esi
+  for(argc = 0; argv[argc]; argc++) {
+80100fc1:	31 f6                	xor    %esi,%esi
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+80100fc3:	e8 b8 a1 00 00       	call   8010b180 <clearpteu>
+  for(argc = 0; argv[argc]; argc++) {
+80100fc8:	8b 45 0c             	mov    0xc(%ebp),%eax
+80100fcb:	83 c4 10             	add    $0x10,%esp
+80100fce:	8b 10                	mov    (%eax),%edx
+80100fd0:	85 d2                	test   %edx,%edx
+80100fd2:	0f 84 56 01 00 00    	je     8010112e <exec+0x33e>
+80100fd8:	89 bd f0 fe ff ff    	mov    %edi,-0x110(%ebp)
+80100fde:	8b 7d 0c             	mov    0xc(%ebp),%edi
+80100fe1:	eb 23                	jmp    80101006 <exec+0x216>
+80100fe3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100fe7:	90                   	nop
+80100fe8:	8d 46 01             	lea    0x1(%esi),%eax
+    ustack[3+argc] = sp;
+80100feb:	89 9c b5 64 ff ff ff 	mov    %ebx,-0x9c(%ebp,%esi,4)
+80100ff2:	8d 8d 58 ff ff ff    	lea    -0xa8(%ebp),%ecx
+  for(argc = 0; argv[argc]; argc++) {
+80100ff8:	8b 14 87             	mov    (%edi,%eax,4),%edx
+80100ffb:	85 d2                	test   %edx,%edx
+80100ffd:	74 51                	je     80101050 <exec+0x260>
+    if(argc >= MAXARG)
+80100fff:	83 f8 20             	cmp    $0x20,%eax
+80101002:	74 36                	je     8010103a <exec+0x24a>
+  for(argc = 0; argv[argc]; argc++) {
+80101004:	89 c6                	mov    %eax,%esi
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+80101006:	83 ec 0c             	sub    $0xc,%esp
+80101009:	52                   	push   %edx
+8010100a:	e8 71 76 00 00       	call   80108680 <strlen>
+8010100f:	29 c3                	sub    %eax,%ebx
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+80101011:	58                   	pop    %eax
+80101012:	ff 34 b7             	push   (%edi,%esi,4)
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+80101015:	83 eb 01             	sub    $0x1,%ebx
+80101018:	83 e3 fc             	and    $0xfffffffc,%ebx
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+8010101b:	e8 60 76 00 00       	call   80108680 <strlen>
+80101020:	83 c0 01             	add    $0x1,%eax
+80101023:	50                   	push   %eax
+80101024:	ff 34 b7             	push   (%edi,%esi,4)
+80101027:	53                   	push   %ebx
+80101028:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+8010102e:	e8 bd a5 00 00       	call   8010b5f0 <copyout>
+80101033:	83 c4 20             	add    $0x20,%esp
+80101036:	85 c0                	test   %eax,%eax
+80101038:	79 ae                	jns    80100fe8 <exec+0x1f8>
+    freevm(pgdir);
+8010103a:	83 ec 0c             	sub    $0xc,%esp
+8010103d:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80101043:	e8 18 a0 00 00       	call   8010b060 <freevm>
+80101048:	83 c4 10             	add    $0x10,%esp
+8010104b:	e9 0c ff ff ff       	jmp    80100f5c <exec+0x16c>
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+80101050:	8d 14 b5 08 00 00 00 	lea    0x8(,%esi,4),%edx
+  ustack[3+argc] = 0;
+80101057:	8b bd f0 fe ff ff    	mov    -0x110(%ebp),%edi
+8010105d:	89 85 f0 fe ff ff    	mov    %eax,-0x110(%ebp)
+80101063:	8d 46 04             	lea    0x4(%esi),%eax
+  sp -= (3+argc+1) * 4;
+80101066:	8d 72 0c             	lea    0xc(%edx),%esi
+  ustack[3+argc] = 0;
+80101069:	c7 84 85 58 ff ff ff 	movl   $0x0,-0xa8(%ebp,%eax,4)
+80101070:	00 00 00 00 
+  ustack[1] = argc;
+80101074:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  ustack[0] = 0xffffffff;  // fake return PC
+8010107a:	c7 85 58 ff ff ff ff 	movl   $0xffffffff,-0xa8(%ebp)
+80101081:	ff ff ff 
+  ustack[1] = argc;
+80101084:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+8010108a:	89 d8                	mov    %ebx,%eax
+  sp -= (3+argc+1) * 4;
+8010108c:	29 f3                	sub    %esi,%ebx
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+8010108e:	29 d0                	sub    %edx,%eax
+80101090:	89 85 60 ff ff ff    	mov    %eax,-0xa0(%ebp)
+  if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
+80101096:	56                   	push   %esi
+80101097:	51                   	push   %ecx
+80101098:	53                   	push   %ebx
+80101099:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+8010109f:	e8 4c a5 00 00       	call   8010b5f0 <copyout>
+801010a4:	83 c4 10             	add    $0x10,%esp
+801010a7:	85 c0                	test   %eax,%eax
+801010a9:	78 8f                	js     8010103a <exec+0x24a>
+  for(last=s=path; *s; s++)
+801010ab:	8b 45 08             	mov    0x8(%ebp),%eax
+801010ae:	8b 55 08             	mov    0x8(%ebp),%edx
+801010b1:	0f b6 00             	movzbl (%eax),%eax
+801010b4:	84 c0                	test   %al,%al
+801010b6:	74 17                	je     801010cf <exec+0x2df>
+801010b8:	89 d1                	mov    %edx,%ecx
+801010ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      last = s+1;
+801010c0:	83 c1 01             	add    $0x1,%ecx
+801010c3:	3c 2f                	cmp    $0x2f,%al
+  for(last=s=path; *s; s++)
+801010c5:	0f b6 01             	movzbl (%ecx),%eax
+      last = s+1;
+801010c8:	0f 44 d1             	cmove  %ecx,%edx
+  for(last=s=path; *s; s++)
+801010cb:	84 c0                	test   %al,%al
+801010cd:	75 f1                	jne    801010c0 <exec+0x2d0>
+  safestrcpy(curproc->name, last, sizeof(curproc->name));
+801010cf:	83 ec 04             	sub    $0x4,%esp
+801010d2:	6a 10                	push   $0x10
+801010d4:	52                   	push   %edx
+801010d5:	8b b5 ec fe ff ff    	mov    -0x114(%ebp),%esi
+801010db:	8d 46 6c             	lea    0x6c(%esi),%eax
+801010de:	50                   	push   %eax
+801010df:	e8 5c 75 00 00       	call   80108640 <safestrcpy>
+  curproc->pgdir = pgdir;
+801010e4:	8b 8d f4 fe ff ff    	mov    -0x10c(%ebp),%ecx
+  oldpgdir = curproc->pgdir;
+801010ea:	89 f0                	mov    %esi,%eax
+801010ec:	8b 76 04             	mov    0x4(%esi),%esi
+  curproc->sz = sz;
+801010ef:	89 38                	mov    %edi,(%eax)
+  curproc->pgdir = pgdir;
+801010f1:	89 48 04             	mov    %ecx,0x4(%eax)
+  curproc->tf->eip = elf.entry;  // main
+801010f4:	89 c1                	mov    %eax,%ecx
+801010f6:	8b 95 3c ff ff ff    	mov    -0xc4(%ebp),%edx
+801010fc:	8b 40 18             	mov    0x18(%eax),%eax
+801010ff:	89 50 38             	mov    %edx,0x38(%eax)
+  curproc->tf->esp = sp;
+80101102:	8b 41 18             	mov    0x18(%ecx),%eax
+80101105:	89 58 44             	mov    %ebx,0x44(%eax)
+  switchuvm(curproc);
+80101108:	89 0c 24             	mov    %ecx,(%esp)
+8010110b:	e8 a0 9b 00 00       	call   8010acb0 <switchuvm>
+  freevm(oldpgdir);
+80101110:	89 34 24             	mov    %esi,(%esp)
+80101113:	e8 48 9f 00 00       	call   8010b060 <freevm>
+  return 0;
+80101118:	83 c4 10             	add    $0x10,%esp
+8010111b:	31 c0                	xor    %eax,%eax
+8010111d:	e9 3f fe ff ff       	jmp    80100f61 <exec+0x171>
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80101122:	bb 00 20 00 00       	mov    $0x2000,%ebx
+80101127:	31 f6                	xor    %esi,%esi
+80101129:	e9 5a fe ff ff       	jmp    80100f88 <exec+0x198>
+  for(argc = 0; argv[argc]; argc++) {
+8010112e:	be 10 00 00 00       	mov    $0x10,%esi
+80101133:	ba 04 00 00 00       	mov    $0x4,%edx
+80101138:	b8 03 00 00 00       	mov    $0x3,%eax
+8010113d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+80101144:	00 00 00 
+80101147:	8d 8d 58 ff ff ff    	lea    -0xa8(%ebp),%ecx
+8010114d:	e9 17 ff ff ff       	jmp    80101069 <exec+0x279>
+    end_op();
+80101152:	e8 99 49 00 00       	call   80105af0 <end_op>
+    cprintf("exec: fail\n");
+80101157:	83 ec 0c             	sub    $0xc,%esp
+8010115a:	68 49 b7 10 80       	push   $0x8010b749
+8010115f:	e8 2c f8 ff ff       	call   80100990 <cprintf>
+    return -1;
+80101164:	83 c4 10             	add    $0x10,%esp
+80101167:	e9 f0 fd ff ff       	jmp    80100f5c <exec+0x16c>
+8010116c:	66 90                	xchg   %ax,%ax
+8010116e:	66 90                	xchg   %ax,%ax
+
+80101170 <opbytes>:
+// transaction of at most log_opmax() blocks.  A write cut short
+// ends on a block boundary, so the next one starts with a whole
+// block.
+static int
+opbytes(struct inode *ip, uint off, int n)
+{
+80101170:	55                   	push   %ebp
+80101171:	89 e5                	mov    %esp,%ebp
+80101173:	57                   	push   %edi
+80101174:	89 cf                	mov    %ecx,%edi
+80101176:	56                   	push   %esi
+80101177:	53                   	push   %ebx
+80101178:	89 d3                	mov    %edx,%ebx
+8010117a:	83 ec 1c             	sub    $0x1c,%esp
+8010117d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80101180:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  int m;
+  uint nb, max;
+
+  max = log_opmax();
+80101183:	e8 58 49 00 00       	call   80105ae0 <log_opmax>
+  m = n;
+  while(m > BSIZE && (nb = writeiblocks(ip, off, m)) > max)
+80101188:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+8010118e:	7e 5b                	jle    801011eb <opbytes+0x7b>
+80101190:	89 c6                	mov    %eax,%esi
+80101192:	89 d8                	mov    %ebx,%eax
+80101194:	89 fb                	mov    %edi,%ebx
+80101196:	89 c7                	mov    %eax,%edi
+80101198:	eb 24                	jmp    801011be <opbytes+0x4e>
+8010119a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    m -= min(m - BSIZE, (nb - max) * BSIZE);
+801011a0:	29 f0                	sub    %esi,%eax
+801011a2:	8d 8b 00 fe ff ff    	lea    -0x200(%ebx),%ecx
+801011a8:	c1 e0 09             	shl    $0x9,%eax
+801011ab:	39 c8                	cmp    %ecx,%eax
+801011ad:	0f 47 c1             	cmova  %ecx,%eax
+801011b0:	89 d9                	mov    %ebx,%ecx
+801011b2:	29 c1                	sub    %eax,%ecx
+801011b4:	89 cb                	mov    %ecx,%ebx
+  while(m > BSIZE && (nb = writeiblocks(ip, off, m)) > max)
+801011b6:	81 f9 00 02 00 00    	cmp    $0x200,%ecx
+801011bc:	7e 3a                	jle    801011f8 <opbytes+0x88>
+801011be:	83 ec 04             	sub    $0x4,%esp
+801011c1:	53                   	push   %ebx
+801011c2:	57                   	push   %edi
+801011c3:	ff 75 e4             	push   -0x1c(%ebp)
+801011c6:	e8 15 21 00 00       	call   801032e0 <writeiblocks>
+801011cb:	83 c4 10             	add    $0x10,%esp
+801011ce:	39 c6                	cmp    %eax,%esi
+801011d0:	72 ce                	jb     801011a0 <opbytes+0x30>
+801011d2:	89 f8                	mov    %edi,%eax
+801011d4:	89 df                	mov    %ebx,%edi
+801011d6:	89 c3                	mov    %eax,%ebx
+  if(m < n && m > (off + m) % BSIZE)
+801011d8:	39 7d e0             	cmp    %edi,-0x20(%ebp)
+801011db:	7e 0e                	jle    801011eb <opbytes+0x7b>
+801011dd:	01 fb                	add    %edi,%ebx
+801011df:	89 f8                	mov    %edi,%eax
+801011e1:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+    m -= (off + m) % BSIZE;
+801011e7:	29 d8                	sub    %ebx,%eax
+801011e9:	89 c7                	mov    %eax,%edi
+  return m;
+}
+801011eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801011ee:	89 f8                	mov    %edi,%eax
+801011f0:	5b                   	pop    %ebx
+801011f1:	5e                   	pop    %esi
+801011f2:	5f                   	pop    %edi
+801011f3:	5d                   	pop    %ebp
+801011f4:	c3                   	ret
+801011f5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(m < n && m > (off + m) % BSIZE)
+801011f8:	89 fa                	mov    %edi,%edx
+801011fa:	89 c8                	mov    %ecx,%eax
+801011fc:	89 cf                	mov    %ecx,%edi
+801011fe:	89 d3                	mov    %edx,%ebx
+80101200:	01 cb                	add    %ecx,%ebx
+80101202:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+80101208:	39 cb                	cmp    %ecx,%ebx
+8010120a:	72 db                	jb     801011e7 <opbytes+0x77>
+}
+8010120c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010120f:	89 f8                	mov    %edi,%eax
+80101211:	5b                   	pop    %ebx
+80101212:	5e                   	pop    %esi
+80101213:	5f                   	pop    %edi
+80101214:	5d                   	pop    %ebp
+80101215:	c3                   	ret
+80101216:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010121d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80101220 <filewritei>:
+// only the blocks its writei() can log.  Returns the number of
+// bytes written, which is short if an extent-mapped file runs
+// out of extents, or -1 if none could be written.
+static int
+filewritei(struct file *f, char *addr, int n)
+{
+80101220:	55                   	push   %ebp
+80101221:	89 e5                	mov    %esp,%ebp
+80101223:	57                   	push   %edi
+80101224:	56                   	push   %esi
+80101225:	53                   	push   %ebx
+80101226:	89 c3                	mov    %eax,%ebx
+80101228:	83 ec 1c             	sub    $0x1c,%esp
+8010122b:	89 55 d8             	mov    %edx,-0x28(%ebp)
+8010122e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  int i, n1, r;
+  uint off;
+
+  r = 0;
+  for(i = 0; i < n; ){
+80101231:	85 c9                	test   %ecx,%ecx
+80101233:	0f 8e f3 00 00 00    	jle    8010132c <filewritei+0x10c>
+80101239:	31 ff                	xor    %edi,%edi
+8010123b:	eb 21                	jmp    8010125e <filewritei+0x3e>
+8010123d:	8d 76 00             	lea    0x0(%esi),%esi
+    begin_opn(writeiblocks(f->ip, off, n1));
+    ilock(f->ip);
+    if(f->off != off){
+      // Another writer sharing f moved the offset, so the
+      // reservation may be too small; size the write again.
+      iunlock(f->ip);
+80101240:	83 ec 0c             	sub    $0xc,%esp
+80101243:	ff 73 10             	push   0x10(%ebx)
+80101246:	e8 05 18 00 00       	call   80102a50 <iunlock>
+      end_op();
+8010124b:	e8 a0 48 00 00       	call   80105af0 <end_op>
+      continue;
+80101250:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; ){
+80101253:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101256:	39 c7                	cmp    %eax,%edi
+80101258:	0f 8d c2 00 00 00    	jge    80101320 <filewritei+0x100>
+    off = f->off;
+8010125e:	8b 73 14             	mov    0x14(%ebx),%esi
+    n1 = opbytes(f->ip, off, n - i);
+80101261:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80101264:	8b 43 10             	mov    0x10(%ebx),%eax
+80101267:	29 f9                	sub    %edi,%ecx
+80101269:	89 f2                	mov    %esi,%edx
+8010126b:	e8 00 ff ff ff       	call   80101170 <opbytes>
+    begin_opn(writeiblocks(f->ip, off, n1));
+80101270:	83 ec 04             	sub    $0x4,%esp
+    n1 = opbytes(f->ip, off, n - i);
+80101273:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    begin_opn(writeiblocks(f->ip, off, n1));
+80101276:	50                   	push   %eax
+80101277:	56                   	push   %esi
+80101278:	ff 73 10             	push   0x10(%ebx)
+8010127b:	e8 60 20 00 00       	call   801032e0 <writeiblocks>
+80101280:	89 04 24             	mov    %eax,(%esp)
+80101283:	e8 38 47 00 00       	call   801059c0 <begin_opn>
+    ilock(f->ip);
+80101288:	58                   	pop    %eax
+80101289:	ff 73 10             	push   0x10(%ebx)
+8010128c:	e8 df 16 00 00       	call   80102970 <ilock>
+    if(f->off != off){
+80101291:	83 c4 10             	add    $0x10,%esp
+80101294:	39 73 14             	cmp    %esi,0x14(%ebx)
+80101297:	75 a7                	jne    80101240 <filewritei+0x20>
+    }
+    if((r = writei(f->ip, addr + i, off, n1)) > 0)
+80101299:	ff 75 e0             	push   -0x20(%ebp)
+8010129c:	56                   	push   %esi
+8010129d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+801012a0:	01 f8                	add    %edi,%eax
+801012a2:	50                   	push   %eax
+801012a3:	ff 73 10             	push   0x10(%ebx)
+801012a6:	e8 35 1e 00 00       	call   801030e0 <writei>
+801012ab:	83 c4 10             	add    $0x10,%esp
+801012ae:	85 c0                	test   %eax,%eax
+801012b0:	7e 4e                	jle    80101300 <filewritei+0xe0>
+      f->off += r;
+801012b2:	01 43 14             	add    %eax,0x14(%ebx)
+    iunlock(f->ip);
+801012b5:	83 ec 0c             	sub    $0xc,%esp
+      f->off += r;
+801012b8:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    iunlock(f->ip);
+801012bb:	ff 73 10             	push   0x10(%ebx)
+801012be:	e8 8d 17 00 00       	call   80102a50 <iunlock>
+    end_op();
+801012c3:	e8 28 48 00 00       	call   80105af0 <end_op>
+
+    if(r > 0)
+      i += r;
+801012c8:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801012cb:	83 c4 10             	add    $0x10,%esp
+801012ce:	01 c7                	add    %eax,%edi
+    if(r != n1)
+801012d0:	39 45 e0             	cmp    %eax,-0x20(%ebp)
+801012d3:	0f 84 7a ff ff ff    	je     80101253 <filewritei+0x33>
+      break;
+  }
+  return i > 0 || n == 0 ? i : -1;
+801012d9:	85 ff                	test   %edi,%edi
+801012db:	89 fa                	mov    %edi,%edx
+801012dd:	0f 9f c0             	setg   %al
+801012e0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+801012e3:	85 c9                	test   %ecx,%ecx
+801012e5:	74 3b                	je     80101322 <filewritei+0x102>
+801012e7:	84 c0                	test   %al,%al
+801012e9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801012ee:	0f 44 d0             	cmove  %eax,%edx
+}
+801012f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801012f4:	5b                   	pop    %ebx
+801012f5:	5e                   	pop    %esi
+801012f6:	89 d0                	mov    %edx,%eax
+801012f8:	5f                   	pop    %edi
+801012f9:	5d                   	pop    %ebp
+801012fa:	c3                   	ret
+801012fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801012ff:	90                   	nop
+80101300:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    iunlock(f->ip);
+80101303:	83 ec 0c             	sub    $0xc,%esp
+80101306:	ff 73 10             	push   0x10(%ebx)
+80101309:	e8 42 17 00 00       	call   80102a50 <iunlock>
+    end_op();
+8010130e:	e8 dd 47 00 00       	call   80105af0 <end_op>
+    if(r > 0)
+80101313:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    end_op();
+80101316:	83 c4 10             	add    $0x10,%esp
+80101319:	eb b5                	jmp    801012d0 <filewritei+0xb0>
+8010131b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010131f:	90                   	nop
+80101320:	89 fa                	mov    %edi,%edx
+}
+80101322:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101325:	89 d0                	mov    %edx,%eax
+80101327:	5b                   	pop    %ebx
+80101328:	5e                   	pop    %esi
+80101329:	5f                   	pop    %edi
+8010132a:	5d                   	pop    %ebp
+8010132b:	c3                   	ret
+  for(i = 0; i < n; ){
+8010132c:	31 c0                	xor    %eax,%eax
+8010132e:	31 d2                	xor    %edx,%edx
+80101330:	eb ae                	jmp    801012e0 <filewritei+0xc0>
+80101332:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80101340 <fileinit>:
+{
+80101340:	55                   	push   %ebp
+80101341:	89 e5                	mov    %esp,%ebp
+80101343:	83 ec 10             	sub    $0x10,%esp
+  initlock(&ftable.lock, "ftable");
+80101346:	68 55 b7 10 80       	push   $0x8010b755
+8010134b:	68 00 44 20 80       	push   $0x80204400
+80101350:	e8 bb 6b 00 00       	call   80107f10 <initlock>
+}
+80101355:	83 c4 10             	add    $0x10,%esp
+80101358:	c9                   	leave
+80101359:	c3                   	ret
+8010135a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80101360 <filealloc>:
+{
+80101360:	55                   	push   %ebp
+80101361:	89 e5                	mov    %esp,%ebp
+80101363:	53                   	push   %ebx
+  for(f = ftable.file; f < ftable.file + NFILE; f++){
+80101364:	bb 40 44 20 80       	mov    $0x80204440,%ebx
+{
+80101369:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ftable.lock);
+8010136c:	68 00 44 20 80       	push   $0x80204400
+80101371:	e8 ea 6d 00 00       	call   80108160 <acquire>
+80101376:	83 c4 10             	add    $0x10,%esp
+80101379:	eb 10                	jmp    8010138b <filealloc+0x2b>
+8010137b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010137f:	90                   	nop
+  for(f = ftable.file; f < ftable.file + NFILE; f++){
+80101380:	83 c3 18             	add    $0x18,%ebx
+80101383:	81 fb 20 73 20 80    	cmp    $0x80207320,%ebx
+80101389:	74 25                	je     801013b0 <filealloc+0x50>
+    if(f->ref == 0){
+8010138b:	8b 43 04             	mov    0x4(%ebx),%eax
+8010138e:	85 c0                	test   %eax,%eax
+80101390:	75 ee                	jne    80101380 <filealloc+0x20>
+      release(&ftable.lock);
+80101392:	83 ec 0c             	sub    $0xc,%esp
+      f->ref = 1;
+80101395:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+      release(&ftable.lock);
+8010139c:	68 00 44 20 80       	push   $0x80204400
+801013a1:	e8 fa 6f 00 00       	call   801083a0 <release>
+}
+801013a6:	89 d8                	mov    %ebx,%eax
+      return f;
+801013a8:	83 c4 10             	add    $0x10,%esp
+}
+801013ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801013ae:	c9                   	leave
+801013af:	c3                   	ret
+  release(&ftable.lock);
+801013b0:	83 ec 0c             	sub    $0xc,%esp
+  return 0;
+801013b3:	31 db                	xor    %ebx,%ebx
+  release(&ftable.lock);
+801013b5:	68 00 44 20 80       	push   $0x80204400
+801013ba:	e8 e1 6f 00 00       	call   801083a0 <release>
+}
+801013bf:	89 d8                	mov    %ebx,%eax
+  return 0;
+801013c1:	83 c4 10             	add    $0x10,%esp
+}
+801013c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801013c7:	c9                   	leave
+801013c8:	c3                   	ret
+801013c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801013d0 <filedup>:
+{
+801013d0:	55                   	push   %ebp
+801013d1:	89 e5                	mov    %esp,%ebp
+801013d3:	53                   	push   %ebx
+801013d4:	83 ec 10             	sub    $0x10,%esp
+801013d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&ftable.lock);
+801013da:	68 00 44 20 80       	push   $0x80204400
+801013df:	e8 7c 6d 00 00       	call   80108160 <acquire>
+  if(f->ref < 1)
+801013e4:	8b 43 04             	mov    0x4(%ebx),%eax
+801013e7:	83 c4 10             	add    $0x10,%esp
+801013ea:	85 c0                	test   %eax,%eax
+801013ec:	7e 1a                	jle    80101408 <filedup+0x38>
+  f->ref++;
+801013ee:	83 c0 01             	add    $0x1,%eax
+  release(&ftable.lock);
+801013f1:	83 ec 0c             	sub    $0xc,%esp
+  f->ref++;
+801013f4:	89 43 04             	mov    %eax,0x4(%ebx)
+  release(&ftable.lock);
+801013f7:	68 00 44 20 80       	push   $0x80204400
+801013fc:	e8 9f 6f 00 00       	call   801083a0 <release>
+}
+80101401:	89 d8                	mov    %ebx,%eax
+80101403:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101406:	c9                   	leave
+80101407:	c3                   	ret
+    panic("filedup");
+80101408:	83 ec 0c             	sub    $0xc,%esp
+8010140b:	68 5c b7 10 80       	push   $0x8010b75c
+80101410:	e8 4b f2 ff ff       	call   80100660 <panic>
+80101415:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010141c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101420 <fileclose>:
+{
+80101420:	55                   	push   %ebp
+80101421:	89 e5                	mov    %esp,%ebp
+80101423:	57                   	push   %edi
+80101424:	56                   	push   %esi
+80101425:	53                   	push   %ebx
+80101426:	83 ec 28             	sub    $0x28,%esp
+80101429:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&ftable.lock);
+8010142c:	68 00 44 20 80       	push   $0x80204400
+80101431:	e8 2a 6d 00 00       	call   80108160 <acquire>
+  if(f->ref < 1)
+80101436:	8b 53 04             	mov    0x4(%ebx),%edx
+80101439:	83 c4 10             	add    $0x10,%esp
+8010143c:	85 d2                	test   %edx,%edx
+8010143e:	0f 8e a5 00 00 00    	jle    801014e9 <fileclose+0xc9>
+  if(--f->ref > 0){
+80101444:	83 ea 01             	sub    $0x1,%edx
+80101447:	89 53 04             	mov    %edx,0x4(%ebx)
+8010144a:	75 44                	jne    80101490 <fileclose+0x70>
+  ff = *f;
+8010144c:	0f b6 43 09          	movzbl 0x9(%ebx),%eax
+  release(&ftable.lock);
+80101450:	83 ec 0c             	sub    $0xc,%esp
+  ff = *f;
+80101453:	8b 3b                	mov    (%ebx),%edi
+  f->type = FD_NONE;
+80101455:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  ff = *f;
+8010145b:	8b 73 0c             	mov    0xc(%ebx),%esi
+8010145e:	88 45 e7             	mov    %al,-0x19(%ebp)
+80101461:	8b 43 10             	mov    0x10(%ebx),%eax
+80101464:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  release(&ftable.lock);
+80101467:	68 00 44 20 80       	push   $0x80204400
+8010146c:	e8 2f 6f 00 00       	call   801083a0 <release>
+  if(ff.type == FD_PIPE)
+80101471:	83 c4 10             	add    $0x10,%esp
+80101474:	83 ff 01             	cmp    $0x1,%edi
+80101477:	74 57                	je     801014d0 <fileclose+0xb0>
+  else if(ff.type == FD_INODE){
+80101479:	83 ff 02             	cmp    $0x2,%edi
+8010147c:	74 2a                	je     801014a8 <fileclose+0x88>
+}
+8010147e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101481:	5b                   	pop    %ebx
+80101482:	5e                   	pop    %esi
+80101483:	5f                   	pop    %edi
+80101484:	5d                   	pop    %ebp
+80101485:	c3                   	ret
+80101486:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010148d:	8d 76 00             	lea    0x0(%esi),%esi
+    release(&ftable.lock);
+80101490:	c7 45 08 00 44 20 80 	movl   $0x80204400,0x8(%ebp)
+}
+80101497:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010149a:	5b                   	pop    %ebx
+8010149b:	5e                   	pop    %esi
+8010149c:	5f                   	pop    %edi
+8010149d:	5d                   	pop    %ebp
+    release(&ftable.lock);
+8010149e:	e9 fd 6e 00 00       	jmp    801083a0 <release>
+801014a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801014a7:	90                   	nop
+    begin_op();
+801014a8:	e8 13 46 00 00       	call   80105ac0 <begin_op>
+    iput(ff.ip);
+801014ad:	83 ec 0c             	sub    $0xc,%esp
+801014b0:	ff 75 e0             	push   -0x20(%ebp)
+801014b3:	e8 b8 16 00 00       	call   80102b70 <iput>
+    end_op();
+801014b8:	83 c4 10             	add    $0x10,%esp
+}
+801014bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801014be:	5b                   	pop    %ebx
+801014bf:	5e                   	pop    %esi
+801014c0:	5f                   	pop    %edi
+801014c1:	5d                   	pop    %ebp
+    end_op();
+801014c2:	e9 29 46 00 00       	jmp    80105af0 <end_op>
+801014c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801014ce:	66 90                	xchg   %ax,%ax
+    pipeclose(ff.pipe, ff.writable);
+801014d0:	0f be 5d e7          	movsbl -0x19(%ebp),%ebx
+801014d4:	83 ec 08             	sub    $0x8,%esp
+801014d7:	53                   	push   %ebx
+801014d8:	56                   	push   %esi
+801014d9:	e8 d2 4d 00 00       	call   801062b0 <pipeclose>
+801014de:	83 c4 10             	add    $0x10,%esp
+}
+801014e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801014e4:	5b                   	pop    %ebx
+801014e5:	5e                   	pop    %esi
+801014e6:	5f                   	pop    %edi
+801014e7:	5d                   	pop    %ebp
+801014e8:	c3                   	ret
+    panic("fileclose");
+801014e9:	83 ec 0c             	sub    $0xc,%esp
+801014ec:	68 64 b7 10 80       	push   $0x8010b764
+801014f1:	e8 6a f1 ff ff       	call   80100660 <panic>
+801014f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801014fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80101500 <filestat>:
+{
+80101500:	55                   	push   %ebp
+80101501:	89 e5                	mov    %esp,%ebp
+80101503:	53                   	push   %ebx
+80101504:	83 ec 04             	sub    $0x4,%esp
+80101507:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->type == FD_INODE){
+8010150a:	83 3b 02             	cmpl   $0x2,(%ebx)
+8010150d:	75 31                	jne    80101540 <filestat+0x40>
+    ilock(f->ip);
+8010150f:	83 ec 0c             	sub    $0xc,%esp
+80101512:	ff 73 10             	push   0x10(%ebx)
+80101515:	e8 56 14 00 00       	call   80102970 <ilock>
+    stati(f->ip, st);
+8010151a:	58                   	pop    %eax
+8010151b:	5a                   	pop    %edx
+8010151c:	ff 75 0c             	push   0xc(%ebp)
+8010151f:	ff 73 10             	push   0x10(%ebx)
+80101522:	e8 e9 19 00 00       	call   80102f10 <stati>
+    iunlock(f->ip);
+80101527:	59                   	pop    %ecx
+80101528:	ff 73 10             	push   0x10(%ebx)
+8010152b:	e8 20 15 00 00       	call   80102a50 <iunlock>
+}
+80101530:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+80101533:	83 c4 10             	add    $0x10,%esp
+80101536:	31 c0                	xor    %eax,%eax
+}
+80101538:	c9                   	leave
+80101539:	c3                   	ret
+8010153a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80101540:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return -1;
+80101543:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80101548:	c9                   	leave
+80101549:	c3                   	ret
+8010154a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80101550 <fileread>:
+{
+80101550:	55                   	push   %ebp
+80101551:	89 e5                	mov    %esp,%ebp
+80101553:	57                   	push   %edi
+80101554:	56                   	push   %esi
+80101555:	53                   	push   %ebx
+80101556:	83 ec 0c             	sub    $0xc,%esp
+80101559:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010155c:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010155f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(f->readable == 0)
+80101562:	80 7b 08 00          	cmpb   $0x0,0x8(%ebx)
+80101566:	74 60                	je     801015c8 <fileread+0x78>
+  if(f->type == FD_PIPE)
+80101568:	8b 03                	mov    (%ebx),%eax
+8010156a:	83 f8 01             	cmp    $0x1,%eax
+8010156d:	74 41                	je     801015b0 <fileread+0x60>
+  if(f->type == FD_INODE){
+8010156f:	83 f8 02             	cmp    $0x2,%eax
+80101572:	75 5b                	jne    801015cf <fileread+0x7f>
+    ilock(f->ip);
+80101574:	83 ec 0c             	sub    $0xc,%esp
+80101577:	ff 73 10             	push   0x10(%ebx)
+8010157a:	e8 f1 13 00 00       	call   80102970 <ilock>
+    if((r = readi(f->ip, addr, f->off, n)) > 0)
+8010157f:	57                   	push   %edi
+80101580:	ff 73 14             	push   0x14(%ebx)
+80101583:	56                   	push   %esi
+80101584:	ff 73 10             	push   0x10(%ebx)
+80101587:	e8 b4 19 00 00       	call   80102f40 <readi>
+8010158c:	83 c4 20             	add    $0x20,%esp
+8010158f:	89 c6                	mov    %eax,%esi
+80101591:	85 c0                	test   %eax,%eax
+80101593:	7e 03                	jle    80101598 <fileread+0x48>
+      f->off += r;
+80101595:	01 43 14             	add    %eax,0x14(%ebx)
+    iunlock(f->ip);
+80101598:	83 ec 0c             	sub    $0xc,%esp
+8010159b:	ff 73 10             	push   0x10(%ebx)
+8010159e:	e8 ad 14 00 00       	call   80102a50 <iunlock>
+    return r;
+801015a3:	83 c4 10             	add    $0x10,%esp
+}
+801015a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801015a9:	89 f0                	mov    %esi,%eax
+801015ab:	5b                   	pop    %ebx
+801015ac:	5e                   	pop    %esi
+801015ad:	5f                   	pop    %edi
+801015ae:	5d                   	pop    %ebp
+801015af:	c3                   	ret
+    return piperead(f->pipe, addr, n);
+801015b0:	8b 43 0c             	mov    0xc(%ebx),%eax
+801015b3:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+801015b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801015b9:	5b                   	pop    %ebx
+801015ba:	5e                   	pop    %esi
+801015bb:	5f                   	pop    %edi
+801015bc:	5d                   	pop    %ebp
+    return piperead(f->pipe, addr, n);
+801015bd:	e9 5e 51 00 00       	jmp    80106720 <piperead>
+801015c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+801015c8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+801015cd:	eb d7                	jmp    801015a6 <fileread+0x56>
+  panic("fileread");
+801015cf:	83 ec 0c             	sub    $0xc,%esp
+801015d2:	68 6e b7 10 80       	push   $0x8010b76e
+801015d7:	e8 84 f0 ff ff       	call   80100660 <panic>
+801015dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801015e0 <filewrite>:
+//PAGEBREAK!
+// Write to file f.  Returns the number of bytes written,
+// which may be less than n, or -1.
+int
+filewrite(struct file *f, char *addr, int n)
+{
+801015e0:	55                   	push   %ebp
+801015e1:	89 e5                	mov    %esp,%ebp
+801015e3:	53                   	push   %ebx
+801015e4:	83 ec 04             	sub    $0x4,%esp
+801015e7:	8b 45 08             	mov    0x8(%ebp),%eax
+801015ea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+801015ed:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  if(f->writable == 0)
+801015f0:	80 78 09 00          	cmpb   $0x0,0x9(%eax)
+801015f4:	74 2a                	je     80101620 <filewrite+0x40>
+    return -1;
+  if(f->type == FD_PIPE)
+801015f6:	8b 10                	mov    (%eax),%edx
+801015f8:	83 fa 01             	cmp    $0x1,%edx
+801015fb:	74 13                	je     80101610 <filewrite+0x30>
+    return pipewrite(f->pipe, addr, n);
+  if(f->type == FD_INODE)
+801015fd:	83 fa 02             	cmp    $0x2,%edx
+80101600:	75 28                	jne    8010162a <filewrite+0x4a>
+    return filewritei(f, addr, n);
+80101602:	89 da                	mov    %ebx,%edx
+  panic("filewrite");
+}
+80101604:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101607:	c9                   	leave
+    return filewritei(f, addr, n);
+80101608:	e9 13 fc ff ff       	jmp    80101220 <filewritei>
+8010160d:	8d 76 00             	lea    0x0(%esi),%esi
+    return pipewrite(f->pipe, addr, n);
+80101610:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+80101613:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return pipewrite(f->pipe, addr, n);
+80101616:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80101619:	c9                   	leave
+    return pipewrite(f->pipe, addr, n);
+8010161a:	e9 d1 4f 00 00       	jmp    801065f0 <pipewrite>
+8010161f:	90                   	nop
+}
+80101620:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101623:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101628:	c9                   	leave
+80101629:	c3                   	ret
+  panic("filewrite");
+8010162a:	83 ec 0c             	sub    $0xc,%esp
+8010162d:	68 77 b7 10 80       	push   $0x8010b777
+80101632:	e8 29 f0 ff ff       	call   80100660 <panic>
+80101637:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010163e:	66 90                	xchg   %ax,%ax
+
+80101640 <filesplice>:
+// many as the inode holds.  From a pipe, waits for data like
+// read() and moves what is there, up to n bytes.  Returns the
+// number of bytes moved, 0 at end of file, or -1.
+int
+filesplice(struct file *in, struct file *out, int n)
+{
+80101640:	55                   	push   %ebp
+80101641:	89 e5                	mov    %esp,%ebp
+80101643:	57                   	push   %edi
+80101644:	56                   	push   %esi
+80101645:	53                   	push   %ebx
+80101646:	83 ec 1c             	sub    $0x1c,%esp
+80101649:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r, m, tot;
+  char *a;
+
+  if(in->readable == 0 || out->writable == 0 || n < 0)
+8010164c:	80 7b 08 00          	cmpb   $0x0,0x8(%ebx)
+80101650:	0f 84 8a 00 00 00    	je     801016e0 <filesplice+0xa0>
+80101656:	8b 45 0c             	mov    0xc(%ebp),%eax
+80101659:	80 78 09 00          	cmpb   $0x0,0x9(%eax)
+8010165d:	0f 84 7d 00 00 00    	je     801016e0 <filesplice+0xa0>
+80101663:	8b 45 10             	mov    0x10(%ebp),%eax
+80101666:	85 c0                	test   %eax,%eax
+80101668:	78 76                	js     801016e0 <filesplice+0xa0>
+    return -1;
+
+  if(in->type == FD_INODE && out->type == FD_PIPE){
+8010166a:	8b 03                	mov    (%ebx),%eax
+8010166c:	83 f8 02             	cmp    $0x2,%eax
+8010166f:	74 67                	je     801016d8 <filesplice+0x98>
+        break;
+    }
+    return r < 0 && tot == 0 ? -1 : tot;
+  }
+
+  if(in->type == FD_PIPE && out->type == FD_INODE){
+80101671:	83 f8 01             	cmp    $0x1,%eax
+80101674:	75 6a                	jne    801016e0 <filesplice+0xa0>
+80101676:	8b 45 0c             	mov    0xc(%ebp),%eax
+80101679:	83 38 02             	cmpl   $0x2,(%eax)
+8010167c:	75 62                	jne    801016e0 <filesplice+0xa0>
+    m = n;
+8010167e:	8b 45 10             	mov    0x10(%ebp),%eax
+    if((a = piperbegin(in->pipe, &m)) == 0)
+80101681:	83 ec 08             	sub    $0x8,%esp
+    m = n;
+80101684:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if((a = piperbegin(in->pipe, &m)) == 0)
+80101687:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+8010168a:	50                   	push   %eax
+8010168b:	ff 73 0c             	push   0xc(%ebx)
+8010168e:	e8 fd 52 00 00       	call   80106990 <piperbegin>
+80101693:	83 c4 10             	add    $0x10,%esp
+80101696:	89 c2                	mov    %eax,%edx
+80101698:	85 c0                	test   %eax,%eax
+8010169a:	74 44                	je     801016e0 <filesplice+0xa0>
+      return -1;
+    r = 0;
+    if(m > 0)
+8010169c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010169f:	31 c0                	xor    %eax,%eax
+    r = 0;
+801016a1:	31 f6                	xor    %esi,%esi
+    if(m > 0)
+801016a3:	85 c9                	test   %ecx,%ecx
+801016a5:	7f 19                	jg     801016c0 <filesplice+0x80>
+      r = filewritei(out, a, m);
+    piperend(in->pipe, r > 0 ? r : 0);
+801016a7:	83 ec 08             	sub    $0x8,%esp
+801016aa:	50                   	push   %eax
+801016ab:	ff 73 0c             	push   0xc(%ebx)
+801016ae:	e8 bd 53 00 00       	call   80106a70 <piperend>
+    return r;
+801016b3:	83 c4 10             	add    $0x10,%esp
+  }
+
+  return -1;
+}
+801016b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801016b9:	89 f0                	mov    %esi,%eax
+801016bb:	5b                   	pop    %ebx
+801016bc:	5e                   	pop    %esi
+801016bd:	5f                   	pop    %edi
+801016be:	5d                   	pop    %ebp
+801016bf:	c3                   	ret
+      r = filewritei(out, a, m);
+801016c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+801016c3:	e8 58 fb ff ff       	call   80101220 <filewritei>
+801016c8:	89 c6                	mov    %eax,%esi
+    piperend(in->pipe, r > 0 ? r : 0);
+801016ca:	31 c0                	xor    %eax,%eax
+801016cc:	85 f6                	test   %esi,%esi
+801016ce:	0f 49 c6             	cmovns %esi,%eax
+801016d1:	eb d4                	jmp    801016a7 <filesplice+0x67>
+801016d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801016d7:	90                   	nop
+  if(in->type == FD_INODE && out->type == FD_PIPE){
+801016d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+801016db:	83 38 01             	cmpl   $0x1,(%eax)
+801016de:	74 10                	je     801016f0 <filesplice+0xb0>
+}
+801016e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return tot > 0 ? tot : -1;
+801016e3:	be ff ff ff ff       	mov    $0xffffffff,%esi
+}
+801016e8:	5b                   	pop    %ebx
+801016e9:	89 f0                	mov    %esi,%eax
+801016eb:	5e                   	pop    %esi
+801016ec:	5f                   	pop    %edi
+801016ed:	5d                   	pop    %ebp
+801016ee:	c3                   	ret
+801016ef:	90                   	nop
+    for(tot = 0; tot < n; tot += r){
+801016f0:	8b 45 10             	mov    0x10(%ebp),%eax
+801016f3:	31 f6                	xor    %esi,%esi
+801016f5:	85 c0                	test   %eax,%eax
+801016f7:	75 2d                	jne    80101726 <filesplice+0xe6>
+801016f9:	eb bb                	jmp    801016b6 <filesplice+0x76>
+801016fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801016ff:	90                   	nop
+        in->off += r;
+80101700:	01 43 14             	add    %eax,0x14(%ebx)
+      iunlock(in->ip);
+80101703:	83 ec 0c             	sub    $0xc,%esp
+    for(tot = 0; tot < n; tot += r){
+80101706:	01 fe                	add    %edi,%esi
+      iunlock(in->ip);
+80101708:	ff 73 10             	push   0x10(%ebx)
+8010170b:	e8 40 13 00 00       	call   80102a50 <iunlock>
+      pipewend(out->pipe, r > 0 ? r : 0);
+80101710:	59                   	pop    %ecx
+80101711:	58                   	pop    %eax
+80101712:	57                   	push   %edi
+80101713:	8b 45 0c             	mov    0xc(%ebp),%eax
+80101716:	ff 70 0c             	push   0xc(%eax)
+80101719:	e8 12 52 00 00       	call   80106930 <pipewend>
+    for(tot = 0; tot < n; tot += r){
+8010171e:	83 c4 10             	add    $0x10,%esp
+80101721:	39 75 10             	cmp    %esi,0x10(%ebp)
+80101724:	7e 90                	jle    801016b6 <filesplice+0x76>
+      m = n - tot;
+80101726:	8b 45 10             	mov    0x10(%ebp),%eax
+      if((a = pipewbegin(out->pipe, &m)) == 0)
+80101729:	83 ec 08             	sub    $0x8,%esp
+      m = n - tot;
+8010172c:	29 f0                	sub    %esi,%eax
+8010172e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      if((a = pipewbegin(out->pipe, &m)) == 0)
+80101731:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80101734:	50                   	push   %eax
+80101735:	8b 45 0c             	mov    0xc(%ebp),%eax
+80101738:	ff 70 0c             	push   0xc(%eax)
+8010173b:	e8 00 51 00 00       	call   80106840 <pipewbegin>
+80101740:	83 c4 10             	add    $0x10,%esp
+80101743:	89 c7                	mov    %eax,%edi
+80101745:	85 c0                	test   %eax,%eax
+80101747:	74 57                	je     801017a0 <filesplice+0x160>
+      ilock(in->ip);
+80101749:	83 ec 0c             	sub    $0xc,%esp
+8010174c:	ff 73 10             	push   0x10(%ebx)
+8010174f:	e8 1c 12 00 00       	call   80102970 <ilock>
+      if((r = readi(in->ip, a, in->off, m)) > 0)
+80101754:	ff 75 e4             	push   -0x1c(%ebp)
+80101757:	ff 73 14             	push   0x14(%ebx)
+8010175a:	57                   	push   %edi
+8010175b:	ff 73 10             	push   0x10(%ebx)
+8010175e:	e8 dd 17 00 00       	call   80102f40 <readi>
+80101763:	83 c4 20             	add    $0x20,%esp
+80101766:	89 c7                	mov    %eax,%edi
+80101768:	85 c0                	test   %eax,%eax
+8010176a:	7f 94                	jg     80101700 <filesplice+0xc0>
+      iunlock(in->ip);
+8010176c:	83 ec 0c             	sub    $0xc,%esp
+8010176f:	ff 73 10             	push   0x10(%ebx)
+80101772:	e8 d9 12 00 00       	call   80102a50 <iunlock>
+      pipewend(out->pipe, r > 0 ? r : 0);
+80101777:	58                   	pop    %eax
+80101778:	5a                   	pop    %edx
+80101779:	6a 00                	push   $0x0
+8010177b:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010177e:	ff 70 0c             	push   0xc(%eax)
+80101781:	e8 aa 51 00 00       	call   80106930 <pipewend>
+    return r < 0 && tot == 0 ? -1 : tot;
+80101786:	83 c4 10             	add    $0x10,%esp
+80101789:	85 ff                	test   %edi,%edi
+8010178b:	0f 89 25 ff ff ff    	jns    801016b6 <filesplice+0x76>
+80101791:	85 f6                	test   %esi,%esi
+80101793:	0f 84 47 ff ff ff    	je     801016e0 <filesplice+0xa0>
+80101799:	e9 18 ff ff ff       	jmp    801016b6 <filesplice+0x76>
+8010179e:	66 90                	xchg   %ax,%ax
+        return tot > 0 ? tot : -1;
+801017a0:	85 f6                	test   %esi,%esi
+801017a2:	0f 85 0e ff ff ff    	jne    801016b6 <filesplice+0x76>
+801017a8:	e9 33 ff ff ff       	jmp    801016e0 <filesplice+0xa0>
+801017ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+801017b0 <filecopy>:
+// write in one, and fills it a page at a time: read a page of in,
+// write it to out.  Returns the number of bytes copied, 0 at end
+// of file, or -1.
+int
+filecopy(struct file *in, struct file *out, int n)
+{
+801017b0:	55                   	push   %ebp
+801017b1:	89 e5                	mov    %esp,%ebp
+801017b3:	57                   	push   %edi
+801017b4:	56                   	push   %esi
+801017b5:	53                   	push   %ebx
+801017b6:	83 ec 2c             	sub    $0x2c,%esp
+801017b9:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r, w, m, done, tot, stop, err;
+  uint off;
+  char *buf;
+
+  if(in->readable == 0 || out->writable == 0 || n < 0)
+801017bc:	80 7e 08 00          	cmpb   $0x0,0x8(%esi)
+801017c0:	0f 84 03 02 00 00    	je     801019c9 <filecopy+0x219>
+801017c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+801017c9:	80 78 09 00          	cmpb   $0x0,0x9(%eax)
+801017cd:	8b 45 10             	mov    0x10(%ebp),%eax
+801017d0:	0f 94 c2             	sete   %dl
+801017d3:	c1 e8 1f             	shr    $0x1f,%eax
+801017d6:	08 c2                	or     %al,%dl
+801017d8:	88 55 e4             	mov    %dl,-0x1c(%ebp)
+801017db:	0f 85 e8 01 00 00    	jne    801019c9 <filecopy+0x219>
+    return -1;
+  if(in->type != FD_INODE || out->type != FD_INODE)
+801017e1:	83 3e 02             	cmpl   $0x2,(%esi)
+801017e4:	0f 85 df 01 00 00    	jne    801019c9 <filecopy+0x219>
+801017ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+801017ed:	83 38 02             	cmpl   $0x2,(%eax)
+801017f0:	0f 85 d3 01 00 00    	jne    801019c9 <filecopy+0x219>
+    return -1;
+  if((buf = kalloc()) == 0)
+801017f6:	e8 b5 33 00 00       	call   80104bb0 <kalloc>
+801017fb:	89 45 dc             	mov    %eax,-0x24(%ebp)
+801017fe:	85 c0                	test   %eax,%eax
+80101800:	0f 84 c3 01 00 00    	je     801019c9 <filecopy+0x219>
+    return -1;
+
+  stop = err = 0;
+  for(tot = 0; tot < n && !stop; tot += done){
+80101806:	8b 4d 10             	mov    0x10(%ebp),%ecx
+80101809:	85 c9                	test   %ecx,%ecx
+8010180b:	0f 84 ca 01 00 00    	je     801019db <filecopy+0x22b>
+80101811:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+80101815:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+80101818:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+8010181f:	88 4d cf             	mov    %cl,-0x31(%ebp)
+80101822:	eb 6f                	jmp    80101893 <filecopy+0xe3>
+80101824:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    m = opbytes(out->ip, off, n - tot);
+    begin_opn(writeiblocks(out->ip, off, m));
+    for(done = 0; done < m; done += w){
+      ilock(in->ip);
+      if((r = readi(in->ip, buf, in->off, min(m - done, PGSIZE))) > 0)
+        in->off += r;
+80101828:	01 46 14             	add    %eax,0x14(%esi)
+      iunlock(in->ip);
+8010182b:	83 ec 0c             	sub    $0xc,%esp
+        in->off += r;
+8010182e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      iunlock(in->ip);
+80101831:	ff 76 10             	push   0x10(%esi)
+80101834:	e8 17 12 00 00       	call   80102a50 <iunlock>
+      }
+
+      // Only write where the reservation was made for; another
+      // writer sharing out may have moved its offset.
+      w = 0;
+      ilock(out->ip);
+80101839:	58                   	pop    %eax
+8010183a:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010183d:	ff 70 10             	push   0x10(%eax)
+80101840:	e8 2b 11 00 00       	call   80102970 <ilock>
+      if(out->off == off + done && (w = writei(out->ip, buf, out->off, r)) > 0)
+80101845:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80101848:	83 c4 10             	add    $0x10,%esp
+8010184b:	8d 0c 07             	lea    (%edi,%eax,1),%ecx
+8010184e:	8b 45 0c             	mov    0xc(%ebp),%eax
+80101851:	39 48 14             	cmp    %ecx,0x14(%eax)
+80101854:	0f 84 06 01 00 00    	je     80101960 <filecopy+0x1b0>
+        out->off += w;
+      iunlock(out->ip);
+8010185a:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+8010185d:	89 c3                	mov    %eax,%ebx
+8010185f:	83 ec 0c             	sub    $0xc,%esp
+80101862:	ff 73 10             	push   0x10(%ebx)
+80101865:	e8 e6 11 00 00       	call   80102a50 <iunlock>
+      if(w != r){
+8010186a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+      iunlock(out->ip);
+8010186d:	83 c4 10             	add    $0x10,%esp
+        // Leave in's offset after what was copied.
+        if(w < 0)
+          w = 0;
+        in->off -= r - w;
+80101870:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80101873:	29 46 14             	sub    %eax,0x14(%esi)
+        done += w;
+        if(out->off == off + done){
+80101876:	39 4b 14             	cmp    %ecx,0x14(%ebx)
+80101879:	0f 84 41 01 00 00    	je     801019c0 <filecopy+0x210>
+  for(tot = 0; tot < n && !stop; tot += done){
+8010187f:	01 7d d4             	add    %edi,-0x2c(%ebp)
+          stop = 1;
+        }
+        break;
+      }
+    }
+    end_op();
+80101882:	e8 69 42 00 00       	call   80105af0 <end_op>
+  for(tot = 0; tot < n && !stop; tot += done){
+80101887:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+8010188a:	39 45 10             	cmp    %eax,0x10(%ebp)
+8010188d:	0f 8e 7a 01 00 00    	jle    80101a0d <filecopy+0x25d>
+    m = opbytes(out->ip, off, n - tot);
+80101893:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80101896:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    off = out->off;
+80101899:	8b 7b 14             	mov    0x14(%ebx),%edi
+    m = opbytes(out->ip, off, n - tot);
+8010189c:	29 c1                	sub    %eax,%ecx
+8010189e:	8b 43 10             	mov    0x10(%ebx),%eax
+801018a1:	89 fa                	mov    %edi,%edx
+    off = out->off;
+801018a3:	89 7d d8             	mov    %edi,-0x28(%ebp)
+    m = opbytes(out->ip, off, n - tot);
+801018a6:	e8 c5 f8 ff ff       	call   80101170 <opbytes>
+    begin_opn(writeiblocks(out->ip, off, m));
+801018ab:	83 ec 04             	sub    $0x4,%esp
+801018ae:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801018b1:	50                   	push   %eax
+801018b2:	57                   	push   %edi
+801018b3:	ff 73 10             	push   0x10(%ebx)
+801018b6:	e8 25 1a 00 00       	call   801032e0 <writeiblocks>
+801018bb:	89 04 24             	mov    %eax,(%esp)
+801018be:	e8 fd 40 00 00       	call   801059c0 <begin_opn>
+    for(done = 0; done < m; done += w){
+801018c3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801018c6:	83 c4 10             	add    $0x10,%esp
+801018c9:	85 d2                	test   %edx,%edx
+801018cb:	7e b5                	jle    80101882 <filecopy+0xd2>
+801018cd:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+801018d0:	31 ff                	xor    %edi,%edi
+801018d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      ilock(in->ip);
+801018d8:	83 ec 0c             	sub    $0xc,%esp
+801018db:	ff 76 10             	push   0x10(%esi)
+801018de:	e8 8d 10 00 00       	call   80102970 <ilock>
+      if((r = readi(in->ip, buf, in->off, min(m - done, PGSIZE))) > 0)
+801018e3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801018e6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+801018eb:	29 f8                	sub    %edi,%eax
+801018ed:	39 c8                	cmp    %ecx,%eax
+801018ef:	0f 4f c1             	cmovg  %ecx,%eax
+801018f2:	50                   	push   %eax
+801018f3:	ff 76 14             	push   0x14(%esi)
+801018f6:	ff 75 dc             	push   -0x24(%ebp)
+801018f9:	ff 76 10             	push   0x10(%esi)
+801018fc:	e8 3f 16 00 00       	call   80102f40 <readi>
+80101901:	83 c4 20             	add    $0x20,%esp
+80101904:	89 c3                	mov    %eax,%ebx
+80101906:	85 c0                	test   %eax,%eax
+80101908:	0f 8f 1a ff ff ff    	jg     80101828 <filecopy+0x78>
+      iunlock(in->ip);
+8010190e:	83 ec 0c             	sub    $0xc,%esp
+80101911:	ff 76 10             	push   0x10(%esi)
+80101914:	f7 d3                	not    %ebx
+80101916:	c1 eb 1f             	shr    $0x1f,%ebx
+80101919:	e8 32 11 00 00       	call   80102a50 <iunlock>
+        break;
+8010191e:	89 d9                	mov    %ebx,%ecx
+80101920:	83 c4 10             	add    $0x10,%esp
+80101923:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+    end_op();
+80101926:	e8 c5 41 00 00       	call   80105af0 <end_op>
+  for(tot = 0; tot < n && !stop; tot += done){
+8010192b:	01 7d d4             	add    %edi,-0x2c(%ebp)
+  }
+  kfree(buf);
+8010192e:	83 ec 0c             	sub    $0xc,%esp
+  for(tot = 0; tot < n && !stop; tot += done){
+80101931:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  kfree(buf);
+80101934:	ff 75 dc             	push   -0x24(%ebp)
+80101937:	e8 f4 2f 00 00       	call   80104930 <kfree>
+  return tot > 0 || !err ? tot : -1;
+8010193c:	83 c4 10             	add    $0x10,%esp
+8010193f:	85 ff                	test   %edi,%edi
+80101941:	7f 08                	jg     8010194b <filecopy+0x19b>
+80101943:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+80101947:	84 c9                	test   %cl,%cl
+80101949:	74 7e                	je     801019c9 <filecopy+0x219>
+}
+8010194b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+8010194e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101951:	5b                   	pop    %ebx
+80101952:	5e                   	pop    %esi
+80101953:	5f                   	pop    %edi
+80101954:	5d                   	pop    %ebp
+80101955:	c3                   	ret
+80101956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010195d:	8d 76 00             	lea    0x0(%esi),%esi
+      if(out->off == off + done && (w = writei(out->ip, buf, out->off, r)) > 0)
+80101960:	ff 75 e0             	push   -0x20(%ebp)
+80101963:	51                   	push   %ecx
+80101964:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+80101967:	ff 75 dc             	push   -0x24(%ebp)
+8010196a:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010196d:	ff 70 10             	push   0x10(%eax)
+80101970:	e8 6b 17 00 00       	call   801030e0 <writei>
+80101975:	83 c4 10             	add    $0x10,%esp
+80101978:	85 c0                	test   %eax,%eax
+8010197a:	7e 34                	jle    801019b0 <filecopy+0x200>
+        out->off += w;
+8010197c:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010197f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+      iunlock(out->ip);
+80101982:	83 ec 0c             	sub    $0xc,%esp
+        out->off += w;
+80101985:	01 42 14             	add    %eax,0x14(%edx)
+      iunlock(out->ip);
+80101988:	ff 72 10             	push   0x10(%edx)
+8010198b:	e8 c0 10 00 00       	call   80102a50 <iunlock>
+      if(w != r){
+80101990:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80101993:	83 c4 10             	add    $0x10,%esp
+80101996:	39 45 e0             	cmp    %eax,-0x20(%ebp)
+80101999:	75 60                	jne    801019fb <filecopy+0x24b>
+    for(done = 0; done < m; done += w){
+8010199b:	01 df                	add    %ebx,%edi
+8010199d:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+801019a0:	0f 8f 32 ff ff ff    	jg     801018d8 <filecopy+0x128>
+  for(tot = 0; tot < n && !stop; tot += done){
+801019a6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+801019a9:	e9 d1 fe ff ff       	jmp    8010187f <filecopy+0xcf>
+801019ae:	66 90                	xchg   %ax,%ax
+      iunlock(out->ip);
+801019b0:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+801019b3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+801019b6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+801019b9:	e9 a1 fe ff ff       	jmp    8010185f <filecopy+0xaf>
+801019be:	66 90                	xchg   %ax,%ax
+801019c0:	0f b6 4d cf          	movzbl -0x31(%ebp),%ecx
+801019c4:	e9 5a ff ff ff       	jmp    80101923 <filecopy+0x173>
+    return -1;
+801019c9:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+}
+801019d0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+801019d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801019d6:	5b                   	pop    %ebx
+801019d7:	5e                   	pop    %esi
+801019d8:	5f                   	pop    %edi
+801019d9:	5d                   	pop    %ebp
+801019da:	c3                   	ret
+  kfree(buf);
+801019db:	83 ec 0c             	sub    $0xc,%esp
+801019de:	ff 75 dc             	push   -0x24(%ebp)
+801019e1:	e8 4a 2f 00 00       	call   80104930 <kfree>
+  for(tot = 0; tot < n && !stop; tot += done){
+801019e6:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  kfree(buf);
+801019ed:	83 c4 10             	add    $0x10,%esp
+}
+801019f0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+801019f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801019f6:	5b                   	pop    %ebx
+801019f7:	5e                   	pop    %esi
+801019f8:	5f                   	pop    %edi
+801019f9:	5d                   	pop    %ebp
+801019fa:	c3                   	ret
+        if(out->off == off + done){
+801019fb:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+        done += w;
+801019fe:	01 c7                	add    %eax,%edi
+        in->off -= r - w;
+80101a00:	29 45 e0             	sub    %eax,-0x20(%ebp)
+80101a03:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+        if(out->off == off + done){
+80101a06:	01 f9                	add    %edi,%ecx
+80101a08:	e9 63 fe ff ff       	jmp    80101870 <filecopy+0xc0>
+  kfree(buf);
+80101a0d:	83 ec 0c             	sub    $0xc,%esp
+80101a10:	ff 75 dc             	push   -0x24(%ebp)
+80101a13:	e8 18 2f 00 00       	call   80104930 <kfree>
+80101a18:	83 c4 10             	add    $0x10,%esp
+80101a1b:	e9 2b ff ff ff       	jmp    8010194b <filecopy+0x19b>
+
+80101a20 <dxleaf>:
+// leaf's block number within dp.  If path is not 0, record the
+// index nodes visited in path[], the slots followed in slot[],
+// and their number in *nlevel.
+static uint
+dxleaf(struct inode *dp, uint h, uint *path, int *slot, int *nlevel)
+{
+80101a20:	55                   	push   %ebp
+80101a21:	89 e5                	mov    %esp,%ebp
+80101a23:	57                   	push   %edi
+80101a24:	56                   	push   %esi
+  struct dxnode *n;
+  uint addr, next;
+  int i, lvl, depth;
+
+  addr = dp->addrs[DXROOT];
+  for(lvl = 0; ; lvl++){
+80101a25:	31 f6                	xor    %esi,%esi
+{
+80101a27:	53                   	push   %ebx
+80101a28:	83 ec 2c             	sub    $0x2c,%esp
+80101a2b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  addr = dp->addrs[DXROOT];
+80101a2e:	8b 80 b0 00 00 00    	mov    0xb0(%eax),%eax
+{
+80101a34:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  addr = dp->addrs[DXROOT];
+80101a37:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(lvl = 0; ; lvl++){
+80101a3a:	89 75 dc             	mov    %esi,-0x24(%ebp)
+80101a3d:	89 d6                	mov    %edx,%esi
+80101a3f:	90                   	nop
+    bp = bread(dp->dev, addr);
+80101a40:	83 ec 08             	sub    $0x8,%esp
+80101a43:	ff 75 e4             	push   -0x1c(%ebp)
+80101a46:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  lo = 0;
+80101a49:	31 db                	xor    %ebx,%ebx
+    bp = bread(dp->dev, addr);
+80101a4b:	ff 30                	push   (%eax)
+80101a4d:	e8 0e e9 ff ff       	call   80100360 <bread>
+  while(lo < hi){
+80101a52:	83 c4 10             	add    $0x10,%esp
+  hi = n->count - 1;
+80101a55:	0f b7 78 72          	movzwl 0x72(%eax),%edi
+    bp = bread(dp->dev, addr);
+80101a59:	89 c1                	mov    %eax,%ecx
+  hi = n->count - 1;
+80101a5b:	83 ef 01             	sub    $0x1,%edi
+  while(lo < hi){
+80101a5e:	eb 0e                	jmp    80101a6e <dxleaf+0x4e>
+    mid = (lo + hi + 1) / 2;
+80101a60:	8d 44 1f 01          	lea    0x1(%edi,%ebx,1),%eax
+80101a64:	d1 f8                	sar    %eax
+    if(n->e[mid].hash <= h)
+80101a66:	3b 74 c1 78          	cmp    0x78(%ecx,%eax,8),%esi
+80101a6a:	72 44                	jb     80101ab0 <dxleaf+0x90>
+    mid = (lo + hi + 1) / 2;
+80101a6c:	89 c3                	mov    %eax,%ebx
+  while(lo < hi){
+80101a6e:	39 fb                	cmp    %edi,%ebx
+80101a70:	7c ee                	jl     80101a60 <dxleaf+0x40>
+    n = (struct dxnode*)bp->data;
+    i = dxfind(n, h);
+    next = n->e[i].block;
+80101a72:	8b 44 d9 7c          	mov    0x7c(%ecx,%ebx,8),%eax
+    depth = n->depth;
+    brelse(bp);
+80101a76:	83 ec 0c             	sub    $0xc,%esp
+    depth = n->depth;
+80101a79:	0f b7 79 70          	movzwl 0x70(%ecx),%edi
+    next = n->e[i].block;
+80101a7d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    brelse(bp);
+80101a80:	51                   	push   %ecx
+80101a81:	e8 1a ea ff ff       	call   801004a0 <brelse>
+    if(path){
+80101a86:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80101a89:	83 c4 10             	add    $0x10,%esp
+80101a8c:	85 c0                	test   %eax,%eax
+80101a8e:	74 0f                	je     80101a9f <dxleaf+0x7f>
+      path[lvl] = addr;
+80101a90:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80101a93:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80101a96:	89 0c 90             	mov    %ecx,(%eax,%edx,4)
+      slot[lvl] = i;
+80101a99:	8b 45 08             	mov    0x8(%ebp),%eax
+80101a9c:	89 1c 90             	mov    %ebx,(%eax,%edx,4)
+    }
+    if(depth == 0)
+80101a9f:	66 85 ff             	test   %di,%di
+80101aa2:	74 11                	je     80101ab5 <dxleaf+0x95>
+    next = n->e[i].block;
+80101aa4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  for(lvl = 0; ; lvl++){
+80101aa7:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+    next = n->e[i].block;
+80101aab:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    bp = bread(dp->dev, addr);
+80101aae:	eb 90                	jmp    80101a40 <dxleaf+0x20>
+      hi = mid - 1;
+80101ab0:	8d 78 ff             	lea    -0x1(%eax),%edi
+80101ab3:	eb b9                	jmp    80101a6e <dxleaf+0x4e>
+      break;
+    addr = next;
+  }
+  if(nlevel)
+80101ab5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+80101ab8:	8b 75 dc             	mov    -0x24(%ebp),%esi
+80101abb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80101abe:	85 db                	test   %ebx,%ebx
+80101ac0:	74 05                	je     80101ac7 <dxleaf+0xa7>
+    *nlevel = lvl + 1;
+80101ac2:	83 c6 01             	add    $0x1,%esi
+80101ac5:	89 33                	mov    %esi,(%ebx)
+  return next;
+}
+80101ac7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101aca:	5b                   	pop    %ebx
+80101acb:	5e                   	pop    %esi
+80101acc:	5f                   	pop    %edi
+80101acd:	5d                   	pop    %ebp
+80101ace:	c3                   	ret
+80101acf:	90                   	nop
+
+80101ad0 <dxinsert>:
+
+// Insert e after slot i in the index node at addr, which
+// must have room.
+static void
+dxinsert(uint dev, uint addr, int i, uint hash, uint block)
+{
+80101ad0:	55                   	push   %ebp
+80101ad1:	89 e5                	mov    %esp,%ebp
+80101ad3:	57                   	push   %edi
+80101ad4:	56                   	push   %esi
+80101ad5:	89 ce                	mov    %ecx,%esi
+80101ad7:	53                   	push   %ebx
+80101ad8:	83 ec 24             	sub    $0x24,%esp
+80101adb:	8b 7d 08             	mov    0x8(%ebp),%edi
+80101ade:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80101ae1:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  struct buf *bp;
+  struct dxnode *n;
+
+  bp = bread(dev, addr);
+  n = (struct dxnode*)bp->data;
+  memmove(&n->e[i+2], &n->e[i+1], (n->count - i - 1) * sizeof(n->e[0]));
+80101ae4:	8d 7e 01             	lea    0x1(%esi),%edi
+{
+80101ae7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  bp = bread(dev, addr);
+80101aea:	52                   	push   %edx
+80101aeb:	50                   	push   %eax
+80101aec:	e8 6f e8 ff ff       	call   80100360 <bread>
+  memmove(&n->e[i+2], &n->e[i+1], (n->count - i - 1) * sizeof(n->e[0]));
+80101af1:	83 c4 0c             	add    $0xc,%esp
+80101af4:	8d 14 f5 10 00 00 00 	lea    0x10(,%esi,8),%edx
+  bp = bread(dev, addr);
+80101afb:	89 c3                	mov    %eax,%ebx
+  memmove(&n->e[i+2], &n->e[i+1], (n->count - i - 1) * sizeof(n->e[0]));
+80101afd:	8d 48 70             	lea    0x70(%eax),%ecx
+80101b00:	0f b7 40 72          	movzwl 0x72(%eax),%eax
+80101b04:	29 f0                	sub    %esi,%eax
+80101b06:	8d 04 c5 f8 ff ff ff 	lea    -0x8(,%eax,8),%eax
+80101b0d:	50                   	push   %eax
+80101b0e:	8d 04 11             	lea    (%ecx,%edx,1),%eax
+80101b11:	50                   	push   %eax
+80101b12:	8d 44 11 08          	lea    0x8(%ecx,%edx,1),%eax
+80101b16:	50                   	push   %eax
+80101b17:	e8 04 6a 00 00       	call   80108520 <memmove>
+  n->e[i+1].hash = hash;
+80101b1c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  n->e[i+1].block = block;
+80101b1f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  n->e[i+1].hash = hash;
+80101b22:	89 44 fb 78          	mov    %eax,0x78(%ebx,%edi,8)
+  n->e[i+1].block = block;
+80101b26:	89 4c fb 7c          	mov    %ecx,0x7c(%ebx,%edi,8)
+  n->count++;
+80101b2a:	66 83 43 72 01       	addw   $0x1,0x72(%ebx)
+  log_write(bp);
+80101b2f:	89 1c 24             	mov    %ebx,(%esp)
+80101b32:	e8 b9 40 00 00       	call   80105bf0 <log_write>
+  brelse(bp);
+80101b37:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80101b3a:	83 c4 10             	add    $0x10,%esp
+}
+80101b3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101b40:	5b                   	pop    %ebx
+80101b41:	5e                   	pop    %esi
+80101b42:	5f                   	pop    %edi
+80101b43:	5d                   	pop    %ebp
+  brelse(bp);
+80101b44:	e9 57 e9 ff ff       	jmp    801004a0 <brelse>
+80101b49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80101b50 <iget>:
+{
+80101b50:	55                   	push   %ebp
+80101b51:	89 e5                	mov    %esp,%ebp
+80101b53:	57                   	push   %edi
+80101b54:	56                   	push   %esi
+80101b55:	89 c6                	mov    %eax,%esi
+80101b57:	53                   	push   %ebx
+  for(ip = *IHASH(dev, inum); ip; ip = ip->hnext){
+80101b58:	89 f7                	mov    %esi,%edi
+80101b5a:	c1 e7 05             	shl    $0x5,%edi
+80101b5d:	29 f7                	sub    %esi,%edi
+{
+80101b5f:	83 ec 28             	sub    $0x28,%esp
+80101b62:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  acquireread(&icache.lock);
+80101b65:	68 e0 93 20 80       	push   $0x802093e0
+80101b6a:	e8 11 67 00 00       	call   80108280 <acquireread>
+  for(ip = *IHASH(dev, inum); ip; ip = ip->hnext){
+80101b6f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80101b72:	b8 11 08 04 02       	mov    $0x2040811,%eax
+80101b77:	83 c4 10             	add    $0x10,%esp
+80101b7a:	01 cf                	add    %ecx,%edi
+80101b7c:	f7 e7                	mul    %edi
+80101b7e:	89 f8                	mov    %edi,%eax
+80101b80:	29 d0                	sub    %edx,%eax
+80101b82:	d1 e8                	shr    %eax
+80101b84:	8d 1c 02             	lea    (%edx,%eax,1),%ebx
+80101b87:	c1 eb 06             	shr    $0x6,%ebx
+80101b8a:	89 d8                	mov    %ebx,%eax
+80101b8c:	c1 e0 07             	shl    $0x7,%eax
+80101b8f:	29 d8                	sub    %ebx,%eax
+80101b91:	89 fb                	mov    %edi,%ebx
+80101b93:	29 c3                	sub    %eax,%ebx
+80101b95:	8b 3c 9d ec 93 20 80 	mov    -0x7fdf6c14(,%ebx,4),%edi
+80101b9c:	85 ff                	test   %edi,%edi
+80101b9e:	74 3f                	je     80101bdf <iget+0x8f>
+    if(ip->dev != dev || ip->inum != inum)
+80101ba0:	39 37                	cmp    %esi,(%edi)
+80101ba2:	75 34                	jne    80101bd8 <iget+0x88>
+80101ba4:	39 4f 04             	cmp    %ecx,0x4(%edi)
+80101ba7:	75 2f                	jne    80101bd8 <iget+0x88>
+    while((r = ip->ref) > 0){
+80101ba9:	8b 47 08             	mov    0x8(%edi),%eax
+80101bac:	85 c0                	test   %eax,%eax
+80101bae:	7e 2f                	jle    80101bdf <iget+0x8f>
+      if(__sync_bool_compare_and_swap(&ip->ref, r, r+1)){
+80101bb0:	8d 50 01             	lea    0x1(%eax),%edx
+80101bb3:	f0 0f b1 57 08       	lock cmpxchg %edx,0x8(%edi)
+80101bb8:	75 ef                	jne    80101ba9 <iget+0x59>
+        releaseread(&icache.lock);
+80101bba:	83 ec 0c             	sub    $0xc,%esp
+80101bbd:	68 e0 93 20 80       	push   $0x802093e0
+80101bc2:	e8 59 68 00 00       	call   80108420 <releaseread>
+        return ip;
+80101bc7:	83 c4 10             	add    $0x10,%esp
+}
+80101bca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101bcd:	89 f8                	mov    %edi,%eax
+80101bcf:	5b                   	pop    %ebx
+80101bd0:	5e                   	pop    %esi
+80101bd1:	5f                   	pop    %edi
+80101bd2:	5d                   	pop    %ebp
+80101bd3:	c3                   	ret
+80101bd4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(ip = *IHASH(dev, inum); ip; ip = ip->hnext){
+80101bd8:	8b 7f 0c             	mov    0xc(%edi),%edi
+80101bdb:	85 ff                	test   %edi,%edi
+80101bdd:	75 c1                	jne    80101ba0 <iget+0x50>
+  releaseread(&icache.lock);
+80101bdf:	83 ec 0c             	sub    $0xc,%esp
+80101be2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80101be5:	68 e0 93 20 80       	push   $0x802093e0
+80101bea:	e8 31 68 00 00       	call   80108420 <releaseread>
+  acquirewrite(&icache.lock);
+80101bef:	c7 04 24 e0 93 20 80 	movl   $0x802093e0,(%esp)
+80101bf6:	e8 d5 66 00 00       	call   801082d0 <acquirewrite>
+  for(ip = *IHASH(dev, inum); ip; ip = ip->hnext){
+80101bfb:	8b 3c 9d ec 93 20 80 	mov    -0x7fdf6c14(,%ebx,4),%edi
+80101c02:	83 c4 10             	add    $0x10,%esp
+80101c05:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80101c08:	85 ff                	test   %edi,%edi
+80101c0a:	75 0b                	jne    80101c17 <iget+0xc7>
+80101c0c:	eb 52                	jmp    80101c60 <iget+0x110>
+80101c0e:	66 90                	xchg   %ax,%ax
+80101c10:	8b 7f 0c             	mov    0xc(%edi),%edi
+80101c13:	85 ff                	test   %edi,%edi
+80101c15:	74 49                	je     80101c60 <iget+0x110>
+    if(ip->dev == dev && ip->inum == inum){
+80101c17:	39 37                	cmp    %esi,(%edi)
+80101c19:	75 f5                	jne    80101c10 <iget+0xc0>
+80101c1b:	39 4f 04             	cmp    %ecx,0x4(%edi)
+80101c1e:	75 f0                	jne    80101c10 <iget+0xc0>
+      if(__sync_fetch_and_add(&ip->ref, 1) == 0){
+80101c20:	b8 01 00 00 00       	mov    $0x1,%eax
+80101c25:	f0 0f c1 47 08       	lock xadd %eax,0x8(%edi)
+80101c2a:	85 c0                	test   %eax,%eax
+80101c2c:	75 0f                	jne    80101c3d <iget+0xed>
+        ip->prev->next = ip->next;
+80101c2e:	8b 57 10             	mov    0x10(%edi),%edx
+80101c31:	8b 47 14             	mov    0x14(%edi),%eax
+80101c34:	89 42 14             	mov    %eax,0x14(%edx)
+        ip->next->prev = ip->prev;
+80101c37:	8b 57 10             	mov    0x10(%edi),%edx
+80101c3a:	89 50 10             	mov    %edx,0x10(%eax)
+  releasewrite(&icache.lock);
+80101c3d:	83 ec 0c             	sub    $0xc,%esp
+80101c40:	68 e0 93 20 80       	push   $0x802093e0
+80101c45:	e8 06 68 00 00       	call   80108450 <releasewrite>
+  return ip;
+80101c4a:	83 c4 10             	add    $0x10,%esp
+}
+80101c4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101c50:	89 f8                	mov    %edi,%eax
+80101c52:	5b                   	pop    %ebx
+80101c53:	5e                   	pop    %esi
+80101c54:	5f                   	pop    %edi
+80101c55:	5d                   	pop    %ebp
+80101c56:	c3                   	ret
+80101c57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101c5e:	66 90                	xchg   %ax,%ax
+  if((icache.ninode < NINODE || icache.lru.prev == &icache.lru) &&
+80101c60:	81 3d 9c 96 20 80 c7 	cmpl   $0xc7,0x8020969c
+80101c67:	00 00 00 
+80101c6a:	0f 8e b8 00 00 00    	jle    80101d28 <iget+0x1d8>
+80101c70:	8b 3d f8 95 20 80    	mov    0x802095f8,%edi
+80101c76:	81 ff e8 95 20 80    	cmp    $0x802095e8,%edi
+80101c7c:	0f 84 a6 00 00 00    	je     80101d28 <iget+0x1d8>
+  ip->prev->next = ip->next;
+80101c82:	8b 57 10             	mov    0x10(%edi),%edx
+80101c85:	8b 47 14             	mov    0x14(%edi),%eax
+80101c88:	89 42 14             	mov    %eax,0x14(%edx)
+  ip->next->prev = ip->prev;
+80101c8b:	8b 57 10             	mov    0x10(%edi),%edx
+80101c8e:	89 50 10             	mov    %edx,0x10(%eax)
+  if(ip->inum != 0){
+80101c91:	8b 57 04             	mov    0x4(%edi),%edx
+80101c94:	85 d2                	test   %edx,%edx
+80101c96:	74 51                	je     80101ce9 <iget+0x199>
+    for(pp = IHASH(ip->dev, ip->inum); *pp != ip; pp = &(*pp)->hnext)
+80101c98:	8b 07                	mov    (%edi),%eax
+80101c9a:	c1 e0 05             	shl    $0x5,%eax
+80101c9d:	2b 07                	sub    (%edi),%eax
+80101c9f:	01 d0                	add    %edx,%eax
+80101ca1:	ba 11 08 04 02       	mov    $0x2040811,%edx
+80101ca6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80101ca9:	f7 e2                	mul    %edx
+80101cab:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101cae:	29 d0                	sub    %edx,%eax
+80101cb0:	d1 e8                	shr    %eax
+80101cb2:	01 c2                	add    %eax,%edx
+80101cb4:	c1 ea 06             	shr    $0x6,%edx
+80101cb7:	89 d0                	mov    %edx,%eax
+80101cb9:	c1 e0 07             	shl    $0x7,%eax
+80101cbc:	29 d0                	sub    %edx,%eax
+80101cbe:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80101cc1:	29 c2                	sub    %eax,%edx
+80101cc3:	8b 04 95 ec 93 20 80 	mov    -0x7fdf6c14(,%edx,4),%eax
+80101cca:	39 c7                	cmp    %eax,%edi
+80101ccc:	0f 84 1e 01 00 00    	je     80101df0 <iget+0x2a0>
+80101cd2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80101cd8:	89 c2                	mov    %eax,%edx
+80101cda:	8b 40 0c             	mov    0xc(%eax),%eax
+80101cdd:	39 c7                	cmp    %eax,%edi
+80101cdf:	75 f7                	jne    80101cd8 <iget+0x188>
+80101ce1:	83 c2 0c             	add    $0xc,%edx
+    *pp = ip->hnext;
+80101ce4:	8b 47 0c             	mov    0xc(%edi),%eax
+80101ce7:	89 02                	mov    %eax,(%edx)
+  ip->dev = dev;
+80101ce9:	89 37                	mov    %esi,(%edi)
+  releasewrite(&icache.lock);
+80101ceb:	83 ec 0c             	sub    $0xc,%esp
+  ip->inum = inum;
+80101cee:	89 4f 04             	mov    %ecx,0x4(%edi)
+  ip->ref = 1;
+80101cf1:	c7 47 08 01 00 00 00 	movl   $0x1,0x8(%edi)
+  ip->valid = 0;
+80101cf8:	c7 47 6c 00 00 00 00 	movl   $0x0,0x6c(%edi)
+  ip->hnext = *pp;
+80101cff:	8b 04 9d ec 93 20 80 	mov    -0x7fdf6c14(,%ebx,4),%eax
+80101d06:	89 47 0c             	mov    %eax,0xc(%edi)
+  *pp = ip;
+80101d09:	89 3c 9d ec 93 20 80 	mov    %edi,-0x7fdf6c14(,%ebx,4)
+  releasewrite(&icache.lock);
+80101d10:	68 e0 93 20 80       	push   $0x802093e0
+80101d15:	e8 36 67 00 00       	call   80108450 <releasewrite>
+  return ip;
+80101d1a:	83 c4 10             	add    $0x10,%esp
+80101d1d:	e9 2b ff ff ff       	jmp    80101c4d <iget+0xfd>
+80101d22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80101d28:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  if((page = kalloc()) == 0)
+80101d2b:	e8 80 2e 00 00       	call   80104bb0 <kalloc>
+80101d30:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80101d33:	85 c0                	test   %eax,%eax
+80101d35:	0f 84 93 00 00 00    	je     80101dce <iget+0x27e>
+  memset(page, 0, PGSIZE);
+80101d3b:	83 ec 04             	sub    $0x4,%esp
+80101d3e:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+80101d41:	68 00 10 00 00       	push   $0x1000
+80101d46:	6a 00                	push   $0x0
+80101d48:	50                   	push   %eax
+80101d49:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80101d4c:	e8 3f 67 00 00       	call   80108490 <memset>
+  for(ip = (struct inode*)page; ip+1 <= (struct inode*)(page+PGSIZE); ip++){
+80101d51:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80101d54:	89 75 dc             	mov    %esi,-0x24(%ebp)
+80101d57:	83 c4 10             	add    $0x10,%esp
+80101d5a:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+80101d5d:	8d 7a 18             	lea    0x18(%edx),%edi
+80101d60:	8d 82 90 0f 00 00    	lea    0xf90(%edx),%eax
+80101d66:	89 fb                	mov    %edi,%ebx
+80101d68:	89 c7                	mov    %eax,%edi
+80101d6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    initsleeplock(&ip->lock, "inode");
+80101d70:	83 ec 08             	sub    $0x8,%esp
+80101d73:	8d 73 e8             	lea    -0x18(%ebx),%esi
+80101d76:	68 81 b7 10 80       	push   $0x8010b781
+80101d7b:	53                   	push   %ebx
+  for(ip = (struct inode*)page; ip+1 <= (struct inode*)(page+PGSIZE); ip++){
+80101d7c:	81 c3 b4 00 00 00    	add    $0xb4,%ebx
+    initsleeplock(&ip->lock, "inode");
+80101d82:	e8 b9 5f 00 00       	call   80107d40 <initsleeplock>
+    ip->next = icache.lru.next;
+80101d87:	8b 0d fc 95 20 80    	mov    0x802095fc,%ecx
+  for(ip = (struct inode*)page; ip+1 <= (struct inode*)(page+PGSIZE); ip++){
+80101d8d:	83 c4 10             	add    $0x10,%esp
+    ip->prev = &icache.lru;
+80101d90:	c7 83 44 ff ff ff e8 	movl   $0x802095e8,-0xbc(%ebx)
+80101d97:	95 20 80 
+    ip->next = icache.lru.next;
+80101d9a:	89 8b 48 ff ff ff    	mov    %ecx,-0xb8(%ebx)
+    icache.lru.next->prev = ip;
+80101da0:	8b 0d fc 95 20 80    	mov    0x802095fc,%ecx
+80101da6:	89 71 10             	mov    %esi,0x10(%ecx)
+    icache.lru.next = ip;
+80101da9:	89 35 fc 95 20 80    	mov    %esi,0x802095fc
+    icache.ninode++;
+80101daf:	83 05 9c 96 20 80 01 	addl   $0x1,0x8020969c
+  for(ip = (struct inode*)page; ip+1 <= (struct inode*)(page+PGSIZE); ip++){
+80101db6:	39 fb                	cmp    %edi,%ebx
+80101db8:	75 b6                	jne    80101d70 <iget+0x220>
+  ip = icache.lru.prev;
+80101dba:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80101dbd:	8b 75 dc             	mov    -0x24(%ebp),%esi
+80101dc0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80101dc3:	8b 3d f8 95 20 80    	mov    0x802095f8,%edi
+80101dc9:	e9 b4 fe ff ff       	jmp    80101c82 <iget+0x132>
+     !igrow() && icache.lru.prev == &icache.lru)
+80101dce:	8b 3d f8 95 20 80    	mov    0x802095f8,%edi
+80101dd4:	81 ff e8 95 20 80    	cmp    $0x802095e8,%edi
+80101dda:	0f 85 a2 fe ff ff    	jne    80101c82 <iget+0x132>
+    panic("iget: no inodes");
+80101de0:	83 ec 0c             	sub    $0xc,%esp
+80101de3:	68 87 b7 10 80       	push   $0x8010b787
+80101de8:	e8 73 e8 ff ff       	call   80100660 <panic>
+80101ded:	8d 76 00             	lea    0x0(%esi),%esi
+    for(pp = IHASH(ip->dev, ip->inum); *pp != ip; pp = &(*pp)->hnext)
+80101df0:	8d 14 95 ec 93 20 80 	lea    -0x7fdf6c14(,%edx,4),%edx
+80101df7:	e9 e8 fe ff ff       	jmp    80101ce4 <iget+0x194>
+80101dfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101e00 <ballocn>:
+{
+80101e00:	55                   	push   %ebp
+80101e01:	89 e5                	mov    %esp,%ebp
+80101e03:	57                   	push   %edi
+80101e04:	89 d7                	mov    %edx,%edi
+80101e06:	56                   	push   %esi
+80101e07:	53                   	push   %ebx
+80101e08:	83 ec 2c             	sub    $0x2c,%esp
+80101e0b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  if(goal >= sb.size)
+80101e0e:	a1 a0 96 20 80       	mov    0x802096a0,%eax
+{
+80101e13:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  nbmap = (sb.size + BPB - 1) / BPB;
+80101e16:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+{
+80101e1c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  nbmap = (sb.size + BPB - 1) / BPB;
+80101e1f:	c1 ea 0c             	shr    $0xc,%edx
+80101e22:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  if(goal >= sb.size)
+80101e25:	39 c7                	cmp    %eax,%edi
+80101e27:	0f 83 c3 01 00 00    	jae    80101ff0 <ballocn+0x1f0>
+    b = ((goal/BPB + i) % nbmap) * BPB;
+80101e2d:	c1 ef 0c             	shr    $0xc,%edi
+80101e30:	89 7d c8             	mov    %edi,-0x38(%ebp)
+  for(i = 0; i <= nbmap; i++){
+80101e33:	31 f6                	xor    %esi,%esi
+    b = ((goal/BPB + i) % nbmap) * BPB;
+80101e35:	8b 45 c8             	mov    -0x38(%ebp),%eax
+80101e38:	31 d2                	xor    %edx,%edx
+    bp = bread(dev, BBLOCK(b, sb));
+80101e3a:	83 ec 08             	sub    $0x8,%esp
+    b = ((goal/BPB + i) % nbmap) * BPB;
+80101e3d:	01 f0                	add    %esi,%eax
+80101e3f:	f7 75 d4             	divl   -0x2c(%ebp)
+80101e42:	89 d3                	mov    %edx,%ebx
+80101e44:	c1 e3 0c             	shl    $0xc,%ebx
+    bp = bread(dev, BBLOCK(b, sb));
+80101e47:	85 db                	test   %ebx,%ebx
+80101e49:	8d 83 ff 0f 00 00    	lea    0xfff(%ebx),%eax
+80101e4f:	0f 49 c3             	cmovns %ebx,%eax
+80101e52:	c1 f8 0c             	sar    $0xc,%eax
+80101e55:	03 05 b8 96 20 80    	add    0x802096b8,%eax
+80101e5b:	50                   	push   %eax
+80101e5c:	ff 75 dc             	push   -0x24(%ebp)
+80101e5f:	e8 fc e4 ff ff       	call   80100360 <bread>
+    for(bi = (i == 0 ? goal%BPB : 0); bi < BPB && b + bi < sb.size; bi++){
+80101e64:	31 d2                	xor    %edx,%edx
+80101e66:	83 c4 10             	add    $0x10,%esp
+80101e69:	89 75 d0             	mov    %esi,-0x30(%ebp)
+    bp = bread(dev, BBLOCK(b, sb));
+80101e6c:	89 c7                	mov    %eax,%edi
+    for(bi = (i == 0 ? goal%BPB : 0); bi < BPB && b + bi < sb.size; bi++){
+80101e6e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+80101e71:	25 ff 0f 00 00       	and    $0xfff,%eax
+80101e76:	85 f6                	test   %esi,%esi
+80101e78:	0f 45 c2             	cmovne %edx,%eax
+80101e7b:	8b 15 a0 96 20 80    	mov    0x802096a0,%edx
+80101e81:	01 c3                	add    %eax,%ebx
+80101e83:	89 55 d8             	mov    %edx,-0x28(%ebp)
+80101e86:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80101e89:	eb 2c                	jmp    80101eb7 <ballocn+0xb7>
+80101e8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101e8f:	90                   	nop
+      if((bp->data[bi/8] & m) == 0){  // Is block free?
+80101e90:	89 c6                	mov    %eax,%esi
+      m = 1 << (bi % 8);
+80101e92:	89 c1                	mov    %eax,%ecx
+80101e94:	ba 01 00 00 00       	mov    $0x1,%edx
+      if((bp->data[bi/8] & m) == 0){  // Is block free?
+80101e99:	c1 fe 03             	sar    $0x3,%esi
+      m = 1 << (bi % 8);
+80101e9c:	83 e1 07             	and    $0x7,%ecx
+      if((bp->data[bi/8] & m) == 0){  // Is block free?
+80101e9f:	0f b6 74 37 70       	movzbl 0x70(%edi,%esi,1),%esi
+      m = 1 << (bi % 8);
+80101ea4:	d3 e2                	shl    %cl,%edx
+      if((bp->data[bi/8] & m) == 0){  // Is block free?
+80101ea6:	85 d6                	test   %edx,%esi
+80101ea8:	74 46                	je     80101ef0 <ballocn+0xf0>
+    for(bi = (i == 0 ? goal%BPB : 0); bi < BPB && b + bi < sb.size; bi++){
+80101eaa:	83 c0 01             	add    $0x1,%eax
+80101ead:	83 c3 01             	add    $0x1,%ebx
+80101eb0:	3d 00 10 00 00       	cmp    $0x1000,%eax
+80101eb5:	74 07                	je     80101ebe <ballocn+0xbe>
+80101eb7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80101eba:	39 d3                	cmp    %edx,%ebx
+80101ebc:	72 d2                	jb     80101e90 <ballocn+0x90>
+    brelse(bp);
+80101ebe:	83 ec 0c             	sub    $0xc,%esp
+80101ec1:	8b 75 d0             	mov    -0x30(%ebp),%esi
+80101ec4:	57                   	push   %edi
+  for(i = 0; i <= nbmap; i++){
+80101ec5:	83 c6 01             	add    $0x1,%esi
+    brelse(bp);
+80101ec8:	e8 d3 e5 ff ff       	call   801004a0 <brelse>
+  for(i = 0; i <= nbmap; i++){
+80101ecd:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80101ed0:	83 c4 10             	add    $0x10,%esp
+80101ed3:	39 c6                	cmp    %eax,%esi
+80101ed5:	0f 8e 5a ff ff ff    	jle    80101e35 <ballocn+0x35>
+  panic("balloc: out of blocks");
+80101edb:	83 ec 0c             	sub    $0xc,%esp
+80101ede:	68 97 b7 10 80       	push   $0x8010b797
+80101ee3:	e8 78 e7 ff ff       	call   80100660 <panic>
+80101ee8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101eef:	90                   	nop
+        for(k = 0; k < *n && bi + k < BPB && b + bi + k < sb.size; k++){
+80101ef0:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80101ef3:	8b 0e                	mov    (%esi),%ecx
+80101ef5:	85 c9                	test   %ecx,%ecx
+80101ef7:	0f 84 06 01 00 00    	je     80102003 <ballocn+0x203>
+          if(bp->data[(bi + k)/8] & m)
+80101efd:	89 c1                	mov    %eax,%ecx
+          m = 1 << ((bi + k) % 8);
+80101eff:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+80101f02:	83 c0 01             	add    $0x1,%eax
+        for(k = 0; k < *n && bi + k < BPB && b + bi + k < sb.size; k++){
+80101f05:	31 f6                	xor    %esi,%esi
+          if(bp->data[(bi + k)/8] & m)
+80101f07:	c1 e9 03             	shr    $0x3,%ecx
+80101f0a:	0f b6 54 0f 70       	movzbl 0x70(%edi,%ecx,1),%edx
+80101f0f:	88 55 d0             	mov    %dl,-0x30(%ebp)
+80101f12:	85 55 d4             	test   %edx,-0x2c(%ebp)
+80101f15:	0f 85 e8 00 00 00    	jne    80102003 <ballocn+0x203>
+80101f1b:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+80101f1e:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80101f21:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+80101f24:	0f b6 5d d0          	movzbl -0x30(%ebp),%ebx
+80101f28:	eb 3c                	jmp    80101f66 <ballocn+0x166>
+80101f2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        for(k = 0; k < *n && bi + k < BPB && b + bi + k < sb.size; k++){
+80101f30:	3d 00 10 00 00       	cmp    $0x1000,%eax
+80101f35:	74 42                	je     80101f79 <ballocn+0x179>
+80101f37:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+80101f3a:	8d 14 1e             	lea    (%esi,%ebx,1),%edx
+80101f3d:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+80101f40:	39 da                	cmp    %ebx,%edx
+80101f42:	73 35                	jae    80101f79 <ballocn+0x179>
+          m = 1 << ((bi + k) % 8);
+80101f44:	89 c1                	mov    %eax,%ecx
+80101f46:	ba 01 00 00 00       	mov    $0x1,%edx
+          if(bp->data[(bi + k)/8] & m)
+80101f4b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+          m = 1 << ((bi + k) % 8);
+80101f4e:	83 e1 07             	and    $0x7,%ecx
+80101f51:	d3 e2                	shl    %cl,%edx
+          if(bp->data[(bi + k)/8] & m)
+80101f53:	89 c1                	mov    %eax,%ecx
+80101f55:	83 c0 01             	add    $0x1,%eax
+80101f58:	c1 e9 03             	shr    $0x3,%ecx
+80101f5b:	0f b6 7c 0f 70       	movzbl 0x70(%edi,%ecx,1),%edi
+80101f60:	89 fb                	mov    %edi,%ebx
+80101f62:	85 d7                	test   %edx,%edi
+80101f64:	75 13                	jne    80101f79 <ballocn+0x179>
+          bp->data[(bi + k)/8] |= m;  // Mark block in use.
+80101f66:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80101f69:	09 d3                	or     %edx,%ebx
+        for(k = 0; k < *n && bi + k < BPB && b + bi + k < sb.size; k++){
+80101f6b:	83 c6 01             	add    $0x1,%esi
+          bp->data[(bi + k)/8] |= m;  // Mark block in use.
+80101f6e:	88 5c 0f 70          	mov    %bl,0x70(%edi,%ecx,1)
+        for(k = 0; k < *n && bi + k < BPB && b + bi + k < sb.size; k++){
+80101f72:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80101f75:	3b 33                	cmp    (%ebx),%esi
+80101f77:	72 b7                	jb     80101f30 <ballocn+0x130>
+        log_write(bp);
+80101f79:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80101f7c:	83 ec 0c             	sub    $0xc,%esp
+80101f7f:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+80101f82:	57                   	push   %edi
+80101f83:	e8 68 3c 00 00       	call   80105bf0 <log_write>
+        brelse(bp);
+80101f88:	89 3c 24             	mov    %edi,(%esp)
+80101f8b:	e8 10 e5 ff ff       	call   801004a0 <brelse>
+        *n = k;
+80101f90:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80101f93:	83 c4 10             	add    $0x10,%esp
+80101f96:	89 30                	mov    %esi,(%eax)
+        for(k = 0; k < *n; k++)
+80101f98:	31 f6                	xor    %esi,%esi
+80101f9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  bp = bclaim(dev, bno);
+80101fa0:	83 ec 08             	sub    $0x8,%esp
+          bzero(dev, b + bi + k);
+80101fa3:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+        for(k = 0; k < *n; k++)
+80101fa6:	83 c6 01             	add    $0x1,%esi
+  bp = bclaim(dev, bno);
+80101fa9:	50                   	push   %eax
+80101faa:	ff 75 dc             	push   -0x24(%ebp)
+80101fad:	e8 ee e3 ff ff       	call   801003a0 <bclaim>
+  memset(bp->data, 0, BSIZE);
+80101fb2:	83 c4 0c             	add    $0xc,%esp
+  bp = bclaim(dev, bno);
+80101fb5:	89 c7                	mov    %eax,%edi
+  memset(bp->data, 0, BSIZE);
+80101fb7:	8d 40 70             	lea    0x70(%eax),%eax
+80101fba:	68 00 02 00 00       	push   $0x200
+80101fbf:	6a 00                	push   $0x0
+80101fc1:	50                   	push   %eax
+80101fc2:	e8 c9 64 00 00       	call   80108490 <memset>
+  log_write(bp);
+80101fc7:	89 3c 24             	mov    %edi,(%esp)
+80101fca:	e8 21 3c 00 00       	call   80105bf0 <log_write>
+  brelse(bp);
+80101fcf:	89 3c 24             	mov    %edi,(%esp)
+80101fd2:	e8 c9 e4 ff ff       	call   801004a0 <brelse>
+        for(k = 0; k < *n; k++)
+80101fd7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80101fda:	83 c4 10             	add    $0x10,%esp
+80101fdd:	3b 30                	cmp    (%eax),%esi
+80101fdf:	72 bf                	jb     80101fa0 <ballocn+0x1a0>
+}
+80101fe1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101fe4:	89 d8                	mov    %ebx,%eax
+80101fe6:	5b                   	pop    %ebx
+80101fe7:	5e                   	pop    %esi
+80101fe8:	5f                   	pop    %edi
+80101fe9:	5d                   	pop    %ebp
+80101fea:	c3                   	ret
+80101feb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101fef:	90                   	nop
+80101ff0:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%ebp)
+    goal = 0;
+80101ff7:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+80101ffe:	e9 30 fe ff ff       	jmp    80101e33 <ballocn+0x33>
+        log_write(bp);
+80102003:	83 ec 0c             	sub    $0xc,%esp
+80102006:	57                   	push   %edi
+80102007:	e8 e4 3b 00 00       	call   80105bf0 <log_write>
+        brelse(bp);
+8010200c:	89 3c 24             	mov    %edi,(%esp)
+8010200f:	e8 8c e4 ff ff       	call   801004a0 <brelse>
+        *n = k;
+80102014:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80102017:	83 c4 10             	add    $0x10,%esp
+8010201a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+        for(k = 0; k < *n; k++)
+80102020:	eb bf                	jmp    80101fe1 <ballocn+0x1e1>
+80102022:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102029:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80102030 <bmap>:
+{
+80102030:	55                   	push   %ebp
+80102031:	89 e5                	mov    %esp,%ebp
+80102033:	57                   	push   %edi
+80102034:	89 c7                	mov    %eax,%edi
+80102036:	56                   	push   %esi
+80102037:	53                   	push   %ebx
+80102038:	83 ec 2c             	sub    $0x2c,%esp
+  if(bn < NDIRECT){
+8010203b:	83 fa 09             	cmp    $0x9,%edx
+8010203e:	76 40                	jbe    80102080 <bmap+0x50>
+  bn -= NDIRECT;
+80102040:	8d 5a f6             	lea    -0xa(%edx),%ebx
+  for(level = 1, n = NINDIRECT; bn >= n; level++, n *= NINDIRECT){
+80102043:	83 fb 7f             	cmp    $0x7f,%ebx
+80102046:	76 78                	jbe    801020c0 <bmap+0x90>
+    bn -= n;
+80102048:	8d 9a 76 ff ff ff    	lea    -0x8a(%edx),%ebx
+  for(level = 1, n = NINDIRECT; bn >= n; level++, n *= NINDIRECT){
+8010204e:	81 fb ff 3f 00 00    	cmp    $0x3fff,%ebx
+80102054:	0f 86 06 01 00 00    	jbe    80102160 <bmap+0x130>
+    bn -= n;
+8010205a:	8d 9a 76 bf ff ff    	lea    -0x408a(%edx),%ebx
+  for(level = 1, n = NINDIRECT; bn >= n; level++, n *= NINDIRECT){
+80102060:	81 fb ff ff 1f 00    	cmp    $0x1fffff,%ebx
+80102066:	0f 86 34 01 00 00    	jbe    801021a0 <bmap+0x170>
+      panic("bmap: out of range");
+8010206c:	83 ec 0c             	sub    $0xc,%esp
+8010206f:	68 ad b7 10 80       	push   $0x8010b7ad
+80102074:	e8 e7 e5 ff ff       	call   80100660 <panic>
+80102079:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if((addr = ip->addrs[bn]) == 0)
+80102080:	8d 5a 20             	lea    0x20(%edx),%ebx
+80102083:	8b 0c 98             	mov    (%eax,%ebx,4),%ecx
+80102086:	85 c9                	test   %ecx,%ecx
+80102088:	74 0e                	je     80102098 <bmap+0x68>
+}
+8010208a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010208d:	89 c8                	mov    %ecx,%eax
+8010208f:	5b                   	pop    %ebx
+80102090:	5e                   	pop    %esi
+80102091:	5f                   	pop    %edi
+80102092:	5d                   	pop    %ebp
+80102093:	c3                   	ret
+80102094:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  uint n = 1;
+80102098:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+      ip->addrs[bn] = addr = balloc(ip->dev);
+8010209f:	8b 00                	mov    (%eax),%eax
+  return ballocn(dev, 0, &n);
+801020a1:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+801020a4:	31 d2                	xor    %edx,%edx
+801020a6:	e8 55 fd ff ff       	call   80101e00 <ballocn>
+      ip->addrs[bn] = addr = balloc(ip->dev);
+801020ab:	89 04 9f             	mov    %eax,(%edi,%ebx,4)
+  return ballocn(dev, 0, &n);
+801020ae:	89 c1                	mov    %eax,%ecx
+}
+801020b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801020b3:	5b                   	pop    %ebx
+801020b4:	89 c8                	mov    %ecx,%eax
+801020b6:	5e                   	pop    %esi
+801020b7:	5f                   	pop    %edi
+801020b8:	5d                   	pop    %ebp
+801020b9:	c3                   	ret
+801020ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(level = 1, n = NINDIRECT; bn >= n; level++, n *= NINDIRECT){
+801020c0:	c7 45 c8 01 00 00 00 	movl   $0x1,-0x38(%ebp)
+801020c7:	be 0a 00 00 00       	mov    $0xa,%esi
+801020cc:	c7 45 d4 80 00 00 00 	movl   $0x80,-0x2c(%ebp)
+  if((addr = ip->addrs[NDIRECT+level-1]) == 0)
+801020d3:	83 c6 20             	add    $0x20,%esi
+801020d6:	8b 0c b7             	mov    (%edi,%esi,4),%ecx
+801020d9:	85 c9                	test   %ecx,%ecx
+801020db:	0f 84 9f 00 00 00    	je     80102180 <bmap+0x150>
+  return ballocn(dev, 0, &n);
+801020e1:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+801020e4:	89 7d cc             	mov    %edi,-0x34(%ebp)
+801020e7:	89 cf                	mov    %ecx,%edi
+    bn %= n;
+801020e9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    n /= NINDIRECT;
+801020ec:	c1 6d d4 07          	shrl   $0x7,-0x2c(%ebp)
+    bn %= n;
+801020f0:	31 d2                	xor    %edx,%edx
+    bp = bread(ip->dev, addr);
+801020f2:	83 ec 08             	sub    $0x8,%esp
+    n /= NINDIRECT;
+801020f5:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    bn %= n;
+801020f8:	f7 f6                	div    %esi
+801020fa:	89 55 d0             	mov    %edx,-0x30(%ebp)
+801020fd:	89 c6                	mov    %eax,%esi
+    bp = bread(ip->dev, addr);
+801020ff:	57                   	push   %edi
+80102100:	8b 45 cc             	mov    -0x34(%ebp),%eax
+80102103:	ff 30                	push   (%eax)
+80102105:	e8 56 e2 ff ff       	call   80100360 <bread>
+    if((addr = a[i]) == 0){
+8010210a:	83 c4 10             	add    $0x10,%esp
+8010210d:	8d 74 b0 70          	lea    0x70(%eax,%esi,4),%esi
+    bp = bread(ip->dev, addr);
+80102111:	89 c3                	mov    %eax,%ebx
+    if((addr = a[i]) == 0){
+80102113:	8b 3e                	mov    (%esi),%edi
+80102115:	85 ff                	test   %edi,%edi
+80102117:	74 1f                	je     80102138 <bmap+0x108>
+    brelse(bp);
+80102119:	83 ec 0c             	sub    $0xc,%esp
+8010211c:	53                   	push   %ebx
+8010211d:	e8 7e e3 ff ff       	call   801004a0 <brelse>
+  for(; level > 0; level--){
+80102122:	83 c4 10             	add    $0x10,%esp
+80102125:	83 6d c8 01          	subl   $0x1,-0x38(%ebp)
+80102129:	75 be                	jne    801020e9 <bmap+0xb9>
+8010212b:	89 f9                	mov    %edi,%ecx
+8010212d:	e9 58 ff ff ff       	jmp    8010208a <bmap+0x5a>
+80102132:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      a[i] = addr = balloc(ip->dev);
+80102138:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  uint n = 1;
+8010213b:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+  return ballocn(dev, 0, &n);
+80102142:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+80102145:	31 d2                	xor    %edx,%edx
+      a[i] = addr = balloc(ip->dev);
+80102147:	8b 00                	mov    (%eax),%eax
+  return ballocn(dev, 0, &n);
+80102149:	e8 b2 fc ff ff       	call   80101e00 <ballocn>
+      log_write(bp);
+8010214e:	83 ec 0c             	sub    $0xc,%esp
+      a[i] = addr = balloc(ip->dev);
+80102151:	89 06                	mov    %eax,(%esi)
+  return ballocn(dev, 0, &n);
+80102153:	89 c7                	mov    %eax,%edi
+      log_write(bp);
+80102155:	53                   	push   %ebx
+80102156:	e8 95 3a 00 00       	call   80105bf0 <log_write>
+8010215b:	83 c4 10             	add    $0x10,%esp
+8010215e:	eb b9                	jmp    80102119 <bmap+0xe9>
+  for(level = 1, n = NINDIRECT; bn >= n; level++, n *= NINDIRECT){
+80102160:	c7 45 c8 02 00 00 00 	movl   $0x2,-0x38(%ebp)
+80102167:	be 0b 00 00 00       	mov    $0xb,%esi
+8010216c:	c7 45 d4 00 40 00 00 	movl   $0x4000,-0x2c(%ebp)
+80102173:	e9 5b ff ff ff       	jmp    801020d3 <bmap+0xa3>
+80102178:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010217f:	90                   	nop
+  uint n = 1;
+80102180:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+      ip->addrs[bn] = addr = balloc(ip->dev);
+80102187:	8b 07                	mov    (%edi),%eax
+  return ballocn(dev, 0, &n);
+80102189:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+8010218c:	31 d2                	xor    %edx,%edx
+8010218e:	e8 6d fc ff ff       	call   80101e00 <ballocn>
+    ip->addrs[NDIRECT+level-1] = addr = balloc(ip->dev);
+80102193:	89 04 b7             	mov    %eax,(%edi,%esi,4)
+  return ballocn(dev, 0, &n);
+80102196:	89 c1                	mov    %eax,%ecx
+  for(; level > 0; level--){
+80102198:	e9 44 ff ff ff       	jmp    801020e1 <bmap+0xb1>
+8010219d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(level = 1, n = NINDIRECT; bn >= n; level++, n *= NINDIRECT){
+801021a0:	c7 45 c8 03 00 00 00 	movl   $0x3,-0x38(%ebp)
+801021a7:	be 0c 00 00 00       	mov    $0xc,%esi
+801021ac:	c7 45 d4 00 00 20 00 	movl   $0x200000,-0x2c(%ebp)
+801021b3:	e9 1b ff ff ff       	jmp    801020d3 <bmap+0xa3>
+801021b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801021bf:	90                   	nop
+
+801021c0 <dcput>:
+{
+801021c0:	55                   	push   %ebp
+801021c1:	89 e5                	mov    %esp,%ebp
+801021c3:	57                   	push   %edi
+801021c4:	89 d7                	mov    %edx,%edi
+801021c6:	56                   	push   %esi
+801021c7:	53                   	push   %ebx
+801021c8:	89 c3                	mov    %eax,%ebx
+801021ca:	83 ec 38             	sub    $0x38,%esp
+801021cd:	8b 45 08             	mov    0x8(%ebp),%eax
+801021d0:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+801021d3:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+801021d6:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  acquirewrite(&dcache.lock);
+801021d9:	68 80 73 20 80       	push   $0x80207380
+801021de:	e8 ed 60 00 00       	call   801082d0 <acquirewrite>
+  h = dev*31 + dinum;
+801021e3:	8b 13                	mov    (%ebx),%edx
+  set = dcset(dp->dev, dp->inum, name);
+801021e5:	8b 73 04             	mov    0x4(%ebx),%esi
+  h = dev*31 + dinum;
+801021e8:	89 f9                	mov    %edi,%ecx
+801021ea:	83 c4 10             	add    $0x10,%esp
+801021ed:	83 c7 0e             	add    $0xe,%edi
+801021f0:	89 d0                	mov    %edx,%eax
+801021f2:	89 75 d8             	mov    %esi,-0x28(%ebp)
+801021f5:	c1 e0 05             	shl    $0x5,%eax
+801021f8:	29 d0                	sub    %edx,%eax
+801021fa:	01 f0                	add    %esi,%eax
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+801021fc:	89 de                	mov    %ebx,%esi
+801021fe:	66 90                	xchg   %ax,%ax
+80102200:	0f b6 19             	movzbl (%ecx),%ebx
+80102203:	84 db                	test   %bl,%bl
+80102205:	74 13                	je     8010221a <dcput+0x5a>
+    h = h*31 + (uchar)name[i];
+80102207:	89 c2                	mov    %eax,%edx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80102209:	83 c1 01             	add    $0x1,%ecx
+    h = h*31 + (uchar)name[i];
+8010220c:	c1 e2 05             	shl    $0x5,%edx
+8010220f:	29 c2                	sub    %eax,%edx
+80102211:	0f b6 c3             	movzbl %bl,%eax
+80102214:	01 d0                	add    %edx,%eax
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80102216:	39 f9                	cmp    %edi,%ecx
+80102218:	75 e6                	jne    80102200 <dcput+0x40>
+  return dcache.ent[h % NDCSET];
+8010221a:	83 e0 3f             	and    $0x3f,%eax
+8010221d:	89 f3                	mov    %esi,%ebx
+  e = 0;
+8010221f:	31 d2                	xor    %edx,%edx
+  return dcache.ent[h % NDCSET];
+80102221:	c1 e0 07             	shl    $0x7,%eax
+80102224:	05 8c 73 20 80       	add    $0x8020738c,%eax
+  for(i = 0; i < DCWAYS; i++){
+80102229:	89 c7                	mov    %eax,%edi
+8010222b:	8d 88 80 00 00 00    	lea    0x80(%eax),%ecx
+  e = 0;
+80102231:	89 c6                	mov    %eax,%esi
+80102233:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    if(set[i].dinum == dp->inum && set[i].dev == dp->dev &&
+80102236:	39 47 04             	cmp    %eax,0x4(%edi)
+80102239:	74 18                	je     80102253 <dcput+0x93>
+8010223b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010223f:	90                   	nop
+    if(e == 0 && set[i].dinum == 0)
+80102240:	85 d2                	test   %edx,%edx
+80102242:	74 44                	je     80102288 <dcput+0xc8>
+  for(i = 0; i < DCWAYS; i++){
+80102244:	83 c7 20             	add    $0x20,%edi
+80102247:	39 cf                	cmp    %ecx,%edi
+80102249:	74 4c                	je     80102297 <dcput+0xd7>
+    if(set[i].dinum == dp->inum && set[i].dev == dp->dev &&
+8010224b:	8b 43 04             	mov    0x4(%ebx),%eax
+8010224e:	39 47 04             	cmp    %eax,0x4(%edi)
+80102251:	75 ed                	jne    80102240 <dcput+0x80>
+80102253:	8b 03                	mov    (%ebx),%eax
+80102255:	39 07                	cmp    %eax,(%edi)
+80102257:	75 e7                	jne    80102240 <dcput+0x80>
+  return strncmp(s, t, DIRSIZ);
+80102259:	83 ec 04             	sub    $0x4,%esp
+       namecmp(set[i].name, name) == 0){
+8010225c:	8d 47 08             	lea    0x8(%edi),%eax
+8010225f:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+80102262:	89 55 d8             	mov    %edx,-0x28(%ebp)
+  return strncmp(s, t, DIRSIZ);
+80102265:	6a 0e                	push   $0xe
+80102267:	ff 75 e4             	push   -0x1c(%ebp)
+8010226a:	50                   	push   %eax
+8010226b:	e8 20 63 00 00       	call   80108590 <strncmp>
+    if(set[i].dinum == dp->inum && set[i].dev == dp->dev &&
+80102270:	83 c4 10             	add    $0x10,%esp
+80102273:	8b 55 d8             	mov    -0x28(%ebp),%edx
+80102276:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+80102279:	85 c0                	test   %eax,%eax
+8010227b:	75 c3                	jne    80102240 <dcput+0x80>
+8010227d:	89 fa                	mov    %edi,%edx
+8010227f:	eb 1c                	jmp    8010229d <dcput+0xdd>
+80102281:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102288:	8b 47 04             	mov    0x4(%edi),%eax
+8010228b:	85 c0                	test   %eax,%eax
+8010228d:	0f 44 d7             	cmove  %edi,%edx
+  for(i = 0; i < DCWAYS; i++){
+80102290:	83 c7 20             	add    $0x20,%edi
+80102293:	39 cf                	cmp    %ecx,%edi
+80102295:	75 b4                	jne    8010224b <dcput+0x8b>
+  if(e == 0){
+80102297:	89 f0                	mov    %esi,%eax
+80102299:	85 d2                	test   %edx,%edx
+8010229b:	74 43                	je     801022e0 <dcput+0x120>
+  e->dev = dp->dev;
+8010229d:	8b 03                	mov    (%ebx),%eax
+  strncpy(e->name, name, DIRSIZ);
+8010229f:	83 ec 04             	sub    $0x4,%esp
+  e->dev = dp->dev;
+801022a2:	89 02                	mov    %eax,(%edx)
+  e->dinum = dp->inum;
+801022a4:	8b 43 04             	mov    0x4(%ebx),%eax
+801022a7:	89 42 04             	mov    %eax,0x4(%edx)
+  strncpy(e->name, name, DIRSIZ);
+801022aa:	8d 42 08             	lea    0x8(%edx),%eax
+801022ad:	6a 0e                	push   $0xe
+801022af:	ff 75 e4             	push   -0x1c(%ebp)
+801022b2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+801022b5:	50                   	push   %eax
+801022b6:	e8 25 63 00 00       	call   801085e0 <strncpy>
+  e->inum = inum;
+801022bb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801022be:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  releasewrite(&dcache.lock);
+801022c1:	83 c4 10             	add    $0x10,%esp
+  e->inum = inum;
+801022c4:	89 42 18             	mov    %eax,0x18(%edx)
+  e->off = off;
+801022c7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801022ca:	89 42 1c             	mov    %eax,0x1c(%edx)
+  releasewrite(&dcache.lock);
+801022cd:	c7 45 08 80 73 20 80 	movl   $0x80207380,0x8(%ebp)
+}
+801022d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801022d7:	5b                   	pop    %ebx
+801022d8:	5e                   	pop    %esi
+801022d9:	5f                   	pop    %edi
+801022da:	5d                   	pop    %ebp
+  releasewrite(&dcache.lock);
+801022db:	e9 70 61 00 00       	jmp    80108450 <releasewrite>
+    i = dcache.victim[(set - dcache.ent[0]) / DCWAYS]++ % DCWAYS;
+801022e0:	89 f2                	mov    %esi,%edx
+801022e2:	81 ea 8c 73 20 80    	sub    $0x8020738c,%edx
+801022e8:	c1 fa 05             	sar    $0x5,%edx
+801022eb:	8d 4a 03             	lea    0x3(%edx),%ecx
+801022ee:	0f 49 ca             	cmovns %edx,%ecx
+801022f1:	c1 f9 02             	sar    $0x2,%ecx
+801022f4:	0f b6 b9 8c 93 20 80 	movzbl -0x7fdf6c74(%ecx),%edi
+801022fb:	8d 77 01             	lea    0x1(%edi),%esi
+801022fe:	89 f2                	mov    %esi,%edx
+80102300:	88 91 8c 93 20 80    	mov    %dl,-0x7fdf6c74(%ecx)
+    e = &set[i];
+80102306:	89 fa                	mov    %edi,%edx
+80102308:	83 e2 03             	and    $0x3,%edx
+8010230b:	c1 e2 05             	shl    $0x5,%edx
+8010230e:	01 c2                	add    %eax,%edx
+80102310:	eb 8b                	jmp    8010229d <dcput+0xdd>
+80102312:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80102320 <bfree>:
+{
+80102320:	55                   	push   %ebp
+80102321:	89 e5                	mov    %esp,%ebp
+80102323:	57                   	push   %edi
+80102324:	56                   	push   %esi
+80102325:	89 c6                	mov    %eax,%esi
+80102327:	53                   	push   %ebx
+80102328:	89 d3                	mov    %edx,%ebx
+8010232a:	83 ec 14             	sub    $0x14,%esp
+  bp = bread(dev, 1);
+8010232d:	6a 01                	push   $0x1
+8010232f:	50                   	push   %eax
+80102330:	e8 2b e0 ff ff       	call   80100360 <bread>
+  memmove(sb, bp->data, sizeof(*sb));
+80102335:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(dev, 1);
+80102338:	89 c7                	mov    %eax,%edi
+  memmove(sb, bp->data, sizeof(*sb));
+8010233a:	83 c0 70             	add    $0x70,%eax
+8010233d:	6a 1c                	push   $0x1c
+8010233f:	50                   	push   %eax
+80102340:	68 a0 96 20 80       	push   $0x802096a0
+80102345:	e8 d6 61 00 00       	call   80108520 <memmove>
+  brelse(bp);
+8010234a:	89 3c 24             	mov    %edi,(%esp)
+8010234d:	e8 4e e1 ff ff       	call   801004a0 <brelse>
+  bp = bread(dev, BBLOCK(b, sb));
+80102352:	58                   	pop    %eax
+80102353:	89 d8                	mov    %ebx,%eax
+80102355:	5a                   	pop    %edx
+80102356:	c1 e8 0c             	shr    $0xc,%eax
+80102359:	03 05 b8 96 20 80    	add    0x802096b8,%eax
+8010235f:	50                   	push   %eax
+80102360:	56                   	push   %esi
+80102361:	e8 fa df ff ff       	call   80100360 <bread>
+  m = 1 << (bi % 8);
+80102366:	89 d9                	mov    %ebx,%ecx
+  if((bp->data[bi/8] & m) == 0)
+80102368:	c1 fb 03             	sar    $0x3,%ebx
+8010236b:	83 c4 10             	add    $0x10,%esp
+  bp = bread(dev, BBLOCK(b, sb));
+8010236e:	89 c6                	mov    %eax,%esi
+  m = 1 << (bi % 8);
+80102370:	83 e1 07             	and    $0x7,%ecx
+80102373:	b8 01 00 00 00       	mov    $0x1,%eax
+  if((bp->data[bi/8] & m) == 0)
+80102378:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  m = 1 << (bi % 8);
+8010237e:	d3 e0                	shl    %cl,%eax
+  if((bp->data[bi/8] & m) == 0)
+80102380:	0f b6 4c 1e 70       	movzbl 0x70(%esi,%ebx,1),%ecx
+80102385:	85 c1                	test   %eax,%ecx
+80102387:	74 24                	je     801023ad <bfree+0x8d>
+  bp->data[bi/8] &= ~m;
+80102389:	f7 d0                	not    %eax
+  log_write(bp);
+8010238b:	83 ec 0c             	sub    $0xc,%esp
+  bp->data[bi/8] &= ~m;
+8010238e:	21 c8                	and    %ecx,%eax
+80102390:	88 44 1e 70          	mov    %al,0x70(%esi,%ebx,1)
+  log_write(bp);
+80102394:	56                   	push   %esi
+80102395:	e8 56 38 00 00       	call   80105bf0 <log_write>
+  brelse(bp);
+8010239a:	89 34 24             	mov    %esi,(%esp)
+8010239d:	e8 fe e0 ff ff       	call   801004a0 <brelse>
+}
+801023a2:	83 c4 10             	add    $0x10,%esp
+801023a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801023a8:	5b                   	pop    %ebx
+801023a9:	5e                   	pop    %esi
+801023aa:	5f                   	pop    %edi
+801023ab:	5d                   	pop    %ebp
+801023ac:	c3                   	ret
+    panic("freeing free block");
+801023ad:	83 ec 0c             	sub    $0xc,%esp
+801023b0:	68 c0 b7 10 80       	push   $0x8010b7c0
+801023b5:	e8 a6 e2 ff ff       	call   80100660 <panic>
+801023ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801023c0 <itruncind>:
+{
+801023c0:	55                   	push   %ebp
+801023c1:	89 e5                	mov    %esp,%ebp
+801023c3:	57                   	push   %edi
+801023c4:	89 c7                	mov    %eax,%edi
+801023c6:	56                   	push   %esi
+801023c7:	53                   	push   %ebx
+801023c8:	83 ec 1c             	sub    $0x1c,%esp
+  if(level > 0){
+801023cb:	85 c9                	test   %ecx,%ecx
+801023cd:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+801023d0:	75 0e                	jne    801023e0 <itruncind+0x20>
+}
+801023d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  bfree(dev, addr);
+801023d5:	89 f8                	mov    %edi,%eax
+}
+801023d7:	5b                   	pop    %ebx
+801023d8:	5e                   	pop    %esi
+801023d9:	5f                   	pop    %edi
+801023da:	5d                   	pop    %ebp
+  bfree(dev, addr);
+801023db:	e9 40 ff ff ff       	jmp    80102320 <bfree>
+    bp = bread(dev, addr);
+801023e0:	83 ec 08             	sub    $0x8,%esp
+801023e3:	52                   	push   %edx
+801023e4:	89 55 dc             	mov    %edx,-0x24(%ebp)
+801023e7:	50                   	push   %eax
+801023e8:	e8 73 df ff ff       	call   80100360 <bread>
+        itruncind(dev, a[j], level-1);
+801023ed:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+801023f0:	83 c4 10             	add    $0x10,%esp
+801023f3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801023f6:	8d 58 70             	lea    0x70(%eax),%ebx
+801023f9:	8d b0 70 02 00 00    	lea    0x270(%eax),%esi
+801023ff:	83 e9 01             	sub    $0x1,%ecx
+80102402:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80102405:	eb 10                	jmp    80102417 <itruncind+0x57>
+80102407:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010240e:	66 90                	xchg   %ax,%ax
+    for(j = 0; j < NINDIRECT; j++){
+80102410:	83 c3 04             	add    $0x4,%ebx
+80102413:	39 f3                	cmp    %esi,%ebx
+80102415:	74 17                	je     8010242e <itruncind+0x6e>
+      if(a[j])
+80102417:	8b 13                	mov    (%ebx),%edx
+80102419:	85 d2                	test   %edx,%edx
+8010241b:	74 f3                	je     80102410 <itruncind+0x50>
+        itruncind(dev, a[j], level-1);
+8010241d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80102420:	89 f8                	mov    %edi,%eax
+    for(j = 0; j < NINDIRECT; j++){
+80102422:	83 c3 04             	add    $0x4,%ebx
+        itruncind(dev, a[j], level-1);
+80102425:	e8 96 ff ff ff       	call   801023c0 <itruncind>
+    for(j = 0; j < NINDIRECT; j++){
+8010242a:	39 f3                	cmp    %esi,%ebx
+8010242c:	75 e9                	jne    80102417 <itruncind+0x57>
+    brelse(bp);
+8010242e:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80102431:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80102434:	83 ec 0c             	sub    $0xc,%esp
+80102437:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010243a:	50                   	push   %eax
+8010243b:	e8 60 e0 ff ff       	call   801004a0 <brelse>
+80102440:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80102443:	83 c4 10             	add    $0x10,%esp
+}
+80102446:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102449:	5b                   	pop    %ebx
+  bfree(dev, addr);
+8010244a:	89 f8                	mov    %edi,%eax
+}
+8010244c:	5e                   	pop    %esi
+8010244d:	5f                   	pop    %edi
+8010244e:	5d                   	pop    %ebp
+  bfree(dev, addr);
+8010244f:	e9 cc fe ff ff       	jmp    80102320 <bfree>
+80102454:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010245b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010245f:	90                   	nop
+
+80102460 <emap>:
+{
+80102460:	55                   	push   %ebp
+80102461:	89 e5                	mov    %esp,%ebp
+80102463:	57                   	push   %edi
+80102464:	56                   	push   %esi
+  last = 0;
+80102465:	31 f6                	xor    %esi,%esi
+{
+80102467:	53                   	push   %ebx
+  for(i = 0; i < NEXTENT + NIEXTENT; i++){
+80102468:	31 db                	xor    %ebx,%ebx
+{
+8010246a:	83 ec 3c             	sub    $0x3c,%esp
+8010246d:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+80102470:	83 e8 80             	sub    $0xffffff80,%eax
+80102473:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+80102476:	89 c7                	mov    %eax,%edi
+  lbn = 0;  // file block at the start of extent i
+80102478:	31 d2                	xor    %edx,%edx
+{
+8010247a:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+8010247d:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  bp = 0;
+80102480:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+80102487:	eb 3b                	jmp    801024c4 <emap+0x64>
+80102489:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return &direct[i];
+80102490:	89 f9                	mov    %edi,%ecx
+  if(i < NEXTENT)
+80102492:	83 fb 05             	cmp    $0x5,%ebx
+80102495:	7e 07                	jle    8010249e <emap+0x3e>
+  return (struct extent*)bp->data + (i - NEXTENT);
+80102497:	8b 45 d0             	mov    -0x30(%ebp),%eax
+8010249a:	8d 4c d8 40          	lea    0x40(%eax,%ebx,8),%ecx
+    if(ex->len == 0)
+8010249e:	8b 41 04             	mov    0x4(%ecx),%eax
+801024a1:	85 c0                	test   %eax,%eax
+801024a3:	74 53                	je     801024f8 <emap+0x98>
+    if(bn < lbn + ex->len){
+801024a5:	8d 14 30             	lea    (%eax,%esi,1),%edx
+801024a8:	39 55 d4             	cmp    %edx,-0x2c(%ebp)
+801024ab:	0f 82 3f 01 00 00    	jb     801025f0 <emap+0x190>
+  for(i = 0; i < NEXTENT + NIEXTENT; i++){
+801024b1:	83 c3 01             	add    $0x1,%ebx
+801024b4:	83 c7 08             	add    $0x8,%edi
+801024b7:	83 fb 46             	cmp    $0x46,%ebx
+801024ba:	0f 84 90 01 00 00    	je     80102650 <emap+0x1f0>
+    if(bn < lbn + ex->len){
+801024c0:	89 d6                	mov    %edx,%esi
+801024c2:	89 ca                	mov    %ecx,%edx
+801024c4:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+    if(i == NEXTENT){
+801024c7:	83 fb 06             	cmp    $0x6,%ebx
+801024ca:	75 c4                	jne    80102490 <emap+0x30>
+      if(ip->addrs[NDIRECT+2] == 0)
+801024cc:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+801024cf:	8b 81 b0 00 00 00    	mov    0xb0(%ecx),%eax
+801024d5:	85 c0                	test   %eax,%eax
+801024d7:	74 1f                	je     801024f8 <emap+0x98>
+      bp = bread(ip->dev, ip->addrs[NDIRECT+2]);
+801024d9:	83 ec 08             	sub    $0x8,%esp
+801024dc:	89 55 c8             	mov    %edx,-0x38(%ebp)
+801024df:	50                   	push   %eax
+801024e0:	ff 31                	push   (%ecx)
+801024e2:	e8 79 de ff ff       	call   80100360 <bread>
+801024e7:	8b 55 c8             	mov    -0x38(%ebp),%edx
+801024ea:	83 c4 10             	add    $0x10,%esp
+801024ed:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(i < NEXTENT)
+801024f0:	eb a5                	jmp    80102497 <emap+0x37>
+801024f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(bn != lbn)
+801024f8:	89 f0                	mov    %esi,%eax
+801024fa:	89 d6                	mov    %edx,%esi
+801024fc:	39 45 d4             	cmp    %eax,-0x2c(%ebp)
+801024ff:	0f 85 a7 01 00 00    	jne    801026ac <emap+0x24c>
+  n = max;
+80102505:	8b 45 c0             	mov    -0x40(%ebp),%eax
+80102508:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  addr = ballocn(ip->dev, last ? last->start + last->len : 0, &n);
+8010250b:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+8010250e:	8b 00                	mov    (%eax),%eax
+80102510:	85 f6                	test   %esi,%esi
+80102512:	74 74                	je     80102588 <emap+0x128>
+80102514:	8b 56 04             	mov    0x4(%esi),%edx
+80102517:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+8010251a:	03 16                	add    (%esi),%edx
+8010251c:	e8 df f8 ff ff       	call   80101e00 <ballocn>
+  if(last && addr == last->start + last->len){
+80102521:	8b 16                	mov    (%esi),%edx
+  addr = ballocn(ip->dev, last ? last->start + last->len : 0, &n);
+80102523:	89 c7                	mov    %eax,%edi
+80102525:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  if(last && addr == last->start + last->len){
+80102528:	8b 46 04             	mov    0x4(%esi),%eax
+8010252b:	01 c2                	add    %eax,%edx
+8010252d:	39 fa                	cmp    %edi,%edx
+    last->len += n;
+8010252f:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  if(last && addr == last->start + last->len){
+80102532:	0f 84 38 01 00 00    	je     80102670 <emap+0x210>
+  } else if(i == NEXTENT + NIEXTENT){
+80102538:	83 fb 46             	cmp    $0x46,%ebx
+8010253b:	75 5b                	jne    80102598 <emap+0x138>
+    for(; n > 0; n--)
+8010253d:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+80102540:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+80102543:	83 eb 01             	sub    $0x1,%ebx
+80102546:	85 ff                	test   %edi,%edi
+80102548:	74 18                	je     80102562 <emap+0x102>
+8010254a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      bfree(ip->dev, addr + n - 1);
+80102550:	8b 06                	mov    (%esi),%eax
+80102552:	8d 14 3b             	lea    (%ebx,%edi,1),%edx
+80102555:	e8 c6 fd ff ff       	call   80102320 <bfree>
+    for(; n > 0; n--)
+8010255a:	83 ef 01             	sub    $0x1,%edi
+8010255d:	89 7d e0             	mov    %edi,-0x20(%ebp)
+80102560:	75 ee                	jne    80102550 <emap+0xf0>
+    brelse(bp);
+80102562:	83 ec 0c             	sub    $0xc,%esp
+80102565:	ff 75 d0             	push   -0x30(%ebp)
+80102568:	e8 33 df ff ff       	call   801004a0 <brelse>
+    return 0;
+8010256d:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+80102574:	83 c4 10             	add    $0x10,%esp
+}
+80102577:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+8010257a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010257d:	5b                   	pop    %ebx
+8010257e:	5e                   	pop    %esi
+8010257f:	5f                   	pop    %edi
+80102580:	5d                   	pop    %ebp
+80102581:	c3                   	ret
+80102582:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  addr = ballocn(ip->dev, last ? last->start + last->len : 0, &n);
+80102588:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+8010258b:	31 d2                	xor    %edx,%edx
+8010258d:	e8 6e f8 ff ff       	call   80101e00 <ballocn>
+    for(; n > 0; n--)
+80102592:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  addr = ballocn(ip->dev, last ? last->start + last->len : 0, &n);
+80102595:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    if(i == NEXTENT){
+80102598:	83 fb 06             	cmp    $0x6,%ebx
+8010259b:	0f 84 d9 00 00 00    	je     8010267a <emap+0x21a>
+  if(i < NEXTENT)
+801025a1:	83 fb 05             	cmp    $0x5,%ebx
+801025a4:	0f 8e 96 00 00 00    	jle    80102640 <emap+0x1e0>
+  return (struct extent*)bp->data + (i - NEXTENT);
+801025aa:	8b 45 d0             	mov    -0x30(%ebp),%eax
+801025ad:	8b 75 cc             	mov    -0x34(%ebp),%esi
+801025b0:	8d 44 f0 40          	lea    0x40(%eax,%esi,8),%eax
+    ex->start = addr;
+801025b4:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    ex->len = n;
+801025b7:	89 78 04             	mov    %edi,0x4(%eax)
+    ex->start = addr;
+801025ba:	89 30                	mov    %esi,(%eax)
+  if(bp){
+801025bc:	8b 75 d0             	mov    -0x30(%ebp),%esi
+801025bf:	85 f6                	test   %esi,%esi
+801025c1:	74 14                	je     801025d7 <emap+0x177>
+    log_write(bp);
+801025c3:	83 ec 0c             	sub    $0xc,%esp
+801025c6:	56                   	push   %esi
+801025c7:	e8 24 36 00 00       	call   80105bf0 <log_write>
+    brelse(bp);
+801025cc:	89 34 24             	mov    %esi,(%esp)
+801025cf:	e8 cc de ff ff       	call   801004a0 <brelse>
+801025d4:	83 c4 10             	add    $0x10,%esp
+  *run = n;
+801025d7:	8b 45 08             	mov    0x8(%ebp),%eax
+801025da:	89 38                	mov    %edi,(%eax)
+}
+801025dc:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+801025df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801025e2:	5b                   	pop    %ebx
+801025e3:	5e                   	pop    %esi
+801025e4:	5f                   	pop    %edi
+801025e5:	5d                   	pop    %ebp
+801025e6:	c3                   	ret
+801025e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801025ee:	66 90                	xchg   %ax,%ax
+      *run = ex->len - (bn - lbn);
+801025f0:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      addr = ex->start + (bn - lbn);
+801025f3:	8b 19                	mov    (%ecx),%ebx
+      *run = ex->len - (bn - lbn);
+801025f5:	89 f1                	mov    %esi,%ecx
+      addr = ex->start + (bn - lbn);
+801025f7:	89 f2                	mov    %esi,%edx
+      *run = ex->len - (bn - lbn);
+801025f9:	29 f9                	sub    %edi,%ecx
+801025fb:	01 c1                	add    %eax,%ecx
+801025fd:	8b 45 c0             	mov    -0x40(%ebp),%eax
+80102600:	39 c1                	cmp    %eax,%ecx
+80102602:	0f 47 c8             	cmova  %eax,%ecx
+80102605:	8b 45 08             	mov    0x8(%ebp),%eax
+80102608:	89 08                	mov    %ecx,(%eax)
+      if(bp)
+8010260a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+8010260d:	85 c0                	test   %eax,%eax
+8010260f:	74 12                	je     80102623 <emap+0x1c3>
+        brelse(bp);
+80102611:	83 ec 0c             	sub    $0xc,%esp
+80102614:	89 75 d0             	mov    %esi,-0x30(%ebp)
+80102617:	50                   	push   %eax
+80102618:	e8 83 de ff ff       	call   801004a0 <brelse>
+8010261d:	8b 55 d0             	mov    -0x30(%ebp),%edx
+80102620:	83 c4 10             	add    $0x10,%esp
+      addr = ex->start + (bn - lbn);
+80102623:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80102626:	29 d0                	sub    %edx,%eax
+80102628:	01 d8                	add    %ebx,%eax
+8010262a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+8010262d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80102630:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102633:	5b                   	pop    %ebx
+80102634:	5e                   	pop    %esi
+80102635:	5f                   	pop    %edi
+80102636:	5d                   	pop    %ebp
+80102637:	c3                   	ret
+80102638:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010263f:	90                   	nop
+    return &direct[i];
+80102640:	8b 45 bc             	mov    -0x44(%ebp),%eax
+80102643:	8b 75 cc             	mov    -0x34(%ebp),%esi
+80102646:	8d 04 f0             	lea    (%eax,%esi,8),%eax
+80102649:	e9 66 ff ff ff       	jmp    801025b4 <emap+0x154>
+8010264e:	66 90                	xchg   %ax,%ax
+  if(bn != lbn)
+80102650:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80102653:	39 c2                	cmp    %eax,%edx
+80102655:	75 55                	jne    801026ac <emap+0x24c>
+  n = max;
+80102657:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  for(i = 0; i < NEXTENT + NIEXTENT; i++){
+8010265a:	c7 45 cc 46 00 00 00 	movl   $0x46,-0x34(%ebp)
+  addr = ballocn(ip->dev, last ? last->start + last->len : 0, &n);
+80102661:	89 ce                	mov    %ecx,%esi
+  n = max;
+80102663:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  addr = ballocn(ip->dev, last ? last->start + last->len : 0, &n);
+80102666:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+80102669:	8b 00                	mov    (%eax),%eax
+8010266b:	e9 a4 fe ff ff       	jmp    80102514 <emap+0xb4>
+    last->len += n;
+80102670:	01 f8                	add    %edi,%eax
+80102672:	89 46 04             	mov    %eax,0x4(%esi)
+80102675:	e9 42 ff ff ff       	jmp    801025bc <emap+0x15c>
+      ip->addrs[NDIRECT+2] = balloc(ip->dev);
+8010267a:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  return ballocn(dev, 0, &n);
+8010267d:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+80102680:	31 d2                	xor    %edx,%edx
+  uint n = 1;
+80102682:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+      ip->addrs[NDIRECT+2] = balloc(ip->dev);
+80102689:	8b 06                	mov    (%esi),%eax
+  return ballocn(dev, 0, &n);
+8010268b:	e8 70 f7 ff ff       	call   80101e00 <ballocn>
+      bp = bread(ip->dev, ip->addrs[NDIRECT+2]);
+80102690:	83 ec 08             	sub    $0x8,%esp
+      ip->addrs[NDIRECT+2] = balloc(ip->dev);
+80102693:	89 86 b0 00 00 00    	mov    %eax,0xb0(%esi)
+      bp = bread(ip->dev, ip->addrs[NDIRECT+2]);
+80102699:	50                   	push   %eax
+8010269a:	ff 36                	push   (%esi)
+8010269c:	e8 bf dc ff ff       	call   80100360 <bread>
+801026a1:	83 c4 10             	add    $0x10,%esp
+801026a4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(i < NEXTENT)
+801026a7:	e9 fe fe ff ff       	jmp    801025aa <emap+0x14a>
+    panic("emap: hole");
+801026ac:	83 ec 0c             	sub    $0xc,%esp
+801026af:	68 d3 b7 10 80       	push   $0x8010b7d3
+801026b4:	e8 a7 df ff ff       	call   80100660 <panic>
+801026b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801026c0 <readsb>:
+{
+801026c0:	55                   	push   %ebp
+801026c1:	89 e5                	mov    %esp,%ebp
+801026c3:	56                   	push   %esi
+801026c4:	53                   	push   %ebx
+801026c5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  bp = bread(dev, 1);
+801026c8:	83 ec 08             	sub    $0x8,%esp
+801026cb:	6a 01                	push   $0x1
+801026cd:	ff 75 08             	push   0x8(%ebp)
+801026d0:	e8 8b dc ff ff       	call   80100360 <bread>
+  memmove(sb, bp->data, sizeof(*sb));
+801026d5:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(dev, 1);
+801026d8:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+801026da:	8d 40 70             	lea    0x70(%eax),%eax
+801026dd:	6a 1c                	push   $0x1c
+801026df:	50                   	push   %eax
+801026e0:	56                   	push   %esi
+801026e1:	e8 3a 5e 00 00       	call   80108520 <memmove>
+  brelse(bp);
+801026e6:	89 5d 08             	mov    %ebx,0x8(%ebp)
+801026e9:	83 c4 10             	add    $0x10,%esp
+}
+801026ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801026ef:	5b                   	pop    %ebx
+801026f0:	5e                   	pop    %esi
+801026f1:	5d                   	pop    %ebp
+  brelse(bp);
+801026f2:	e9 a9 dd ff ff       	jmp    801004a0 <brelse>
+801026f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801026fe:	66 90                	xchg   %ax,%ax
+
+80102700 <iinit>:
+{
+80102700:	55                   	push   %ebp
+80102701:	89 e5                	mov    %esp,%ebp
+80102703:	53                   	push   %ebx
+80102704:	83 ec 0c             	sub    $0xc,%esp
+  initrwlock(&icache.lock, "icache");
+80102707:	68 de b7 10 80       	push   $0x8010b7de
+8010270c:	68 e0 93 20 80       	push   $0x802093e0
+80102711:	e8 da 59 00 00       	call   801080f0 <initrwlock>
+  icache.lru.prev = &icache.lru;
+80102716:	c7 05 f8 95 20 80 e8 	movl   $0x802095e8,0x802095f8
+8010271d:	95 20 80 
+  icache.lru.next = &icache.lru;
+80102720:	c7 05 fc 95 20 80 e8 	movl   $0x802095e8,0x802095fc
+80102727:	95 20 80 
+  initrwlock(&dcache.lock, "dcache");
+8010272a:	58                   	pop    %eax
+8010272b:	5a                   	pop    %edx
+8010272c:	68 e5 b7 10 80       	push   $0x8010b7e5
+80102731:	68 80 73 20 80       	push   $0x80207380
+80102736:	e8 b5 59 00 00       	call   801080f0 <initrwlock>
+  bp = bread(dev, 1);
+8010273b:	59                   	pop    %ecx
+8010273c:	5b                   	pop    %ebx
+8010273d:	6a 01                	push   $0x1
+8010273f:	ff 75 08             	push   0x8(%ebp)
+80102742:	e8 19 dc ff ff       	call   80100360 <bread>
+  memmove(sb, bp->data, sizeof(*sb));
+80102747:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(dev, 1);
+8010274a:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+8010274c:	8d 40 70             	lea    0x70(%eax),%eax
+8010274f:	6a 1c                	push   $0x1c
+80102751:	50                   	push   %eax
+80102752:	68 a0 96 20 80       	push   $0x802096a0
+80102757:	e8 c4 5d 00 00       	call   80108520 <memmove>
+  brelse(bp);
+8010275c:	89 1c 24             	mov    %ebx,(%esp)
+8010275f:	e8 3c dd ff ff       	call   801004a0 <brelse>
+  cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
+80102764:	ff 35 b8 96 20 80    	push   0x802096b8
+8010276a:	ff 35 b4 96 20 80    	push   0x802096b4
+80102770:	ff 35 b0 96 20 80    	push   0x802096b0
+80102776:	ff 35 ac 96 20 80    	push   0x802096ac
+8010277c:	ff 35 a8 96 20 80    	push   0x802096a8
+80102782:	ff 35 a4 96 20 80    	push   0x802096a4
+80102788:	ff 35 a0 96 20 80    	push   0x802096a0
+8010278e:	68 68 b8 10 80       	push   $0x8010b868
+80102793:	e8 f8 e1 ff ff       	call   80100990 <cprintf>
+}
+80102798:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010279b:	83 c4 30             	add    $0x30,%esp
+8010279e:	c9                   	leave
+8010279f:	c3                   	ret
+
+801027a0 <ialloc>:
+{
+801027a0:	55                   	push   %ebp
+801027a1:	89 e5                	mov    %esp,%ebp
+801027a3:	57                   	push   %edi
+801027a4:	56                   	push   %esi
+801027a5:	53                   	push   %ebx
+801027a6:	83 ec 1c             	sub    $0x1c,%esp
+801027a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(n = 0; n < sb.ninodes; n += m){
+801027ac:	8b 15 a8 96 20 80    	mov    0x802096a8,%edx
+{
+801027b2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+801027b5:	8b 45 0c             	mov    0xc(%ebp),%eax
+801027b8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for(n = 0; n < sb.ninodes; n += m){
+801027bb:	85 d2                	test   %edx,%edx
+801027bd:	0f 84 8d 00 00 00    	je     80102850 <ialloc+0xb0>
+801027c3:	31 ff                	xor    %edi,%edi
+    m = IPB - inum%IPB;
+801027c5:	89 d1                	mov    %edx,%ecx
+    inum = (inext + n) % sb.ninodes;
+801027c7:	a1 00 d0 10 80       	mov    0x8010d000,%eax
+801027cc:	31 d2                	xor    %edx,%edx
+    m = IPB - inum%IPB;
+801027ce:	be 08 00 00 00       	mov    $0x8,%esi
+    bp = bread(dev, IBLOCK(inum, sb));
+801027d3:	83 ec 08             	sub    $0x8,%esp
+    inum = (inext + n) % sb.ninodes;
+801027d6:	01 f8                	add    %edi,%eax
+801027d8:	f7 f1                	div    %ecx
+    m = IPB - inum%IPB;
+801027da:	89 d0                	mov    %edx,%eax
+    inum = (inext + n) % sb.ninodes;
+801027dc:	89 d3                	mov    %edx,%ebx
+    m = IPB - inum%IPB;
+801027de:	83 e0 07             	and    $0x7,%eax
+801027e1:	29 c6                	sub    %eax,%esi
+    bp = bread(dev, IBLOCK(inum, sb));
+801027e3:	89 d0                	mov    %edx,%eax
+801027e5:	c1 e8 03             	shr    $0x3,%eax
+801027e8:	03 05 b4 96 20 80    	add    0x802096b4,%eax
+    m = IPB - inum%IPB;
+801027ee:	89 75 e0             	mov    %esi,-0x20(%ebp)
+    bp = bread(dev, IBLOCK(inum, sb));
+801027f1:	50                   	push   %eax
+801027f2:	ff 75 dc             	push   -0x24(%ebp)
+801027f5:	e8 66 db ff ff       	call   80100360 <bread>
+      if(inum == 0 || inum >= sb.ninodes)
+801027fa:	8b 15 a8 96 20 80    	mov    0x802096a8,%edx
+80102800:	83 c4 10             	add    $0x10,%esp
+    bp = bread(dev, IBLOCK(inum, sb));
+80102803:	89 c1                	mov    %eax,%ecx
+80102805:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    for(i = 0; i < m; i++, inum++){
+80102808:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+      dip = (struct dinode*)bp->data + inum%IPB;
+8010280b:	83 c1 70             	add    $0x70,%ecx
+8010280e:	66 90                	xchg   %ax,%ax
+      if(inum == 0 || inum >= sb.ninodes)
+80102810:	85 db                	test   %ebx,%ebx
+80102812:	74 14                	je     80102828 <ialloc+0x88>
+80102814:	39 d3                	cmp    %edx,%ebx
+80102816:	73 10                	jae    80102828 <ialloc+0x88>
+      dip = (struct dinode*)bp->data + inum%IPB;
+80102818:	89 de                	mov    %ebx,%esi
+8010281a:	83 e6 07             	and    $0x7,%esi
+8010281d:	c1 e6 06             	shl    $0x6,%esi
+80102820:	01 ce                	add    %ecx,%esi
+      if(dip->type == 0){  // a free inode
+80102822:	66 83 3e 00          	cmpw   $0x0,(%esi)
+80102826:	74 38                	je     80102860 <ialloc+0xc0>
+    for(i = 0; i < m; i++, inum++){
+80102828:	83 c3 01             	add    $0x1,%ebx
+8010282b:	39 c3                	cmp    %eax,%ebx
+8010282d:	75 e1                	jne    80102810 <ialloc+0x70>
+    brelse(bp);
+8010282f:	83 ec 0c             	sub    $0xc,%esp
+80102832:	ff 75 e4             	push   -0x1c(%ebp)
+80102835:	e8 66 dc ff ff       	call   801004a0 <brelse>
+  for(n = 0; n < sb.ninodes; n += m){
+8010283a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010283d:	8b 0d a8 96 20 80    	mov    0x802096a8,%ecx
+80102843:	83 c4 10             	add    $0x10,%esp
+80102846:	01 c7                	add    %eax,%edi
+80102848:	39 cf                	cmp    %ecx,%edi
+8010284a:	0f 82 77 ff ff ff    	jb     801027c7 <ialloc+0x27>
+  panic("ialloc: no inodes");
+80102850:	83 ec 0c             	sub    $0xc,%esp
+80102853:	68 ec b7 10 80       	push   $0x8010b7ec
+80102858:	e8 03 de ff ff       	call   80100660 <panic>
+8010285d:	8d 76 00             	lea    0x0(%esi),%esi
+        memset(dip, 0, sizeof(*dip));
+80102860:	83 ec 04             	sub    $0x4,%esp
+80102863:	6a 40                	push   $0x40
+80102865:	6a 00                	push   $0x0
+80102867:	56                   	push   %esi
+80102868:	e8 23 5c 00 00       	call   80108490 <memset>
+        dip->type = type;
+8010286d:	0f b7 45 d8          	movzwl -0x28(%ebp),%eax
+        log_write(bp);   // mark it allocated on the disk
+80102871:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+        dip->type = type;
+80102874:	66 89 06             	mov    %ax,(%esi)
+        log_write(bp);   // mark it allocated on the disk
+80102877:	89 3c 24             	mov    %edi,(%esp)
+8010287a:	e8 71 33 00 00       	call   80105bf0 <log_write>
+        brelse(bp);
+8010287f:	89 3c 24             	mov    %edi,(%esp)
+80102882:	e8 19 dc ff ff       	call   801004a0 <brelse>
+        inext = inum + 1;
+80102887:	8d 43 01             	lea    0x1(%ebx),%eax
+        return iget(dev, inum);
+8010288a:	83 c4 10             	add    $0x10,%esp
+8010288d:	89 da                	mov    %ebx,%edx
+        inext = inum + 1;
+8010288f:	a3 00 d0 10 80       	mov    %eax,0x8010d000
+        return iget(dev, inum);
+80102894:	8b 45 dc             	mov    -0x24(%ebp),%eax
+}
+80102897:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010289a:	5b                   	pop    %ebx
+8010289b:	5e                   	pop    %esi
+8010289c:	5f                   	pop    %edi
+8010289d:	5d                   	pop    %ebp
+        return iget(dev, inum);
+8010289e:	e9 ad f2 ff ff       	jmp    80101b50 <iget>
+801028a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801028aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801028b0 <iupdate>:
+{
+801028b0:	55                   	push   %ebp
+801028b1:	89 e5                	mov    %esp,%ebp
+801028b3:	56                   	push   %esi
+801028b4:	53                   	push   %ebx
+801028b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+801028b8:	8b 43 04             	mov    0x4(%ebx),%eax
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+801028bb:	83 eb 80             	sub    $0xffffff80,%ebx
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+801028be:	83 ec 08             	sub    $0x8,%esp
+801028c1:	c1 e8 03             	shr    $0x3,%eax
+801028c4:	03 05 b4 96 20 80    	add    0x802096b4,%eax
+801028ca:	50                   	push   %eax
+801028cb:	ff 73 80             	push   -0x80(%ebx)
+801028ce:	e8 8d da ff ff       	call   80100360 <bread>
+  dip->type = ip->type;
+801028d3:	0f b7 53 f0          	movzwl -0x10(%ebx),%edx
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+801028d7:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+801028da:	89 c6                	mov    %eax,%esi
+  dip = (struct dinode*)bp->data + ip->inum%IPB;
+801028dc:	8b 43 84             	mov    -0x7c(%ebx),%eax
+801028df:	83 e0 07             	and    $0x7,%eax
+801028e2:	c1 e0 06             	shl    $0x6,%eax
+801028e5:	8d 44 06 70          	lea    0x70(%esi,%eax,1),%eax
+  dip->type = ip->type;
+801028e9:	66 89 10             	mov    %dx,(%eax)
+  dip->major = ip->major;
+801028ec:	0f b7 53 f2          	movzwl -0xe(%ebx),%edx
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+801028f0:	83 c0 0c             	add    $0xc,%eax
+  dip->major = ip->major;
+801028f3:	88 50 f6             	mov    %dl,-0xa(%eax)
+  dip->minor = ip->minor;
+801028f6:	0f b7 53 f4          	movzwl -0xc(%ebx),%edx
+801028fa:	88 50 f7             	mov    %dl,-0x9(%eax)
+  dip->flags = ip->flags;
+801028fd:	0f b7 53 f6          	movzwl -0xa(%ebx),%edx
+80102901:	66 89 50 f8          	mov    %dx,-0x8(%eax)
+  dip->nlink = ip->nlink;
+80102905:	0f b7 53 f8          	movzwl -0x8(%ebx),%edx
+80102909:	66 89 50 fa          	mov    %dx,-0x6(%eax)
+  dip->size = ip->size;
+8010290d:	8b 53 fc             	mov    -0x4(%ebx),%edx
+80102910:	89 50 fc             	mov    %edx,-0x4(%eax)
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+80102913:	6a 34                	push   $0x34
+80102915:	53                   	push   %ebx
+80102916:	50                   	push   %eax
+80102917:	e8 04 5c 00 00       	call   80108520 <memmove>
+  log_write(bp);
+8010291c:	89 34 24             	mov    %esi,(%esp)
+8010291f:	e8 cc 32 00 00       	call   80105bf0 <log_write>
+  brelse(bp);
+80102924:	89 75 08             	mov    %esi,0x8(%ebp)
+80102927:	83 c4 10             	add    $0x10,%esp
+}
+8010292a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010292d:	5b                   	pop    %ebx
+8010292e:	5e                   	pop    %esi
+8010292f:	5d                   	pop    %ebp
+  brelse(bp);
+80102930:	e9 6b db ff ff       	jmp    801004a0 <brelse>
+80102935:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010293c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80102940 <idup>:
+{
+80102940:	55                   	push   %ebp
+80102941:	89 e5                	mov    %esp,%ebp
+80102943:	53                   	push   %ebx
+80102944:	83 ec 10             	sub    $0x10,%esp
+80102947:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquireread(&icache.lock);
+8010294a:	68 e0 93 20 80       	push   $0x802093e0
+8010294f:	e8 2c 59 00 00       	call   80108280 <acquireread>
+  __sync_fetch_and_add(&ip->ref, 1);
+80102954:	f0 83 43 08 01       	lock addl $0x1,0x8(%ebx)
+  releaseread(&icache.lock);
+80102959:	c7 04 24 e0 93 20 80 	movl   $0x802093e0,(%esp)
+80102960:	e8 bb 5a 00 00       	call   80108420 <releaseread>
+}
+80102965:	89 d8                	mov    %ebx,%eax
+80102967:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010296a:	c9                   	leave
+8010296b:	c3                   	ret
+8010296c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80102970 <ilock>:
+{
+80102970:	55                   	push   %ebp
+80102971:	89 e5                	mov    %esp,%ebp
+80102973:	56                   	push   %esi
+80102974:	53                   	push   %ebx
+80102975:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || ip->ref < 1)
+80102978:	85 db                	test   %ebx,%ebx
+8010297a:	0f 84 c2 00 00 00    	je     80102a42 <ilock+0xd2>
+80102980:	8b 53 08             	mov    0x8(%ebx),%edx
+80102983:	85 d2                	test   %edx,%edx
+80102985:	0f 8e b7 00 00 00    	jle    80102a42 <ilock+0xd2>
+  acquiresleep(&ip->lock);
+8010298b:	83 ec 0c             	sub    $0xc,%esp
+8010298e:	8d 43 18             	lea    0x18(%ebx),%eax
+80102991:	50                   	push   %eax
+80102992:	e8 f9 53 00 00       	call   80107d90 <acquiresleep>
+  if(ip->valid == 0){
+80102997:	8b 43 6c             	mov    0x6c(%ebx),%eax
+8010299a:	83 c4 10             	add    $0x10,%esp
+8010299d:	85 c0                	test   %eax,%eax
+8010299f:	74 0f                	je     801029b0 <ilock+0x40>
+}
+801029a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801029a4:	5b                   	pop    %ebx
+801029a5:	5e                   	pop    %esi
+801029a6:	5d                   	pop    %ebp
+801029a7:	c3                   	ret
+801029a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801029af:	90                   	nop
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+801029b0:	8b 43 04             	mov    0x4(%ebx),%eax
+801029b3:	83 ec 08             	sub    $0x8,%esp
+801029b6:	c1 e8 03             	shr    $0x3,%eax
+801029b9:	03 05 b4 96 20 80    	add    0x802096b4,%eax
+801029bf:	50                   	push   %eax
+801029c0:	ff 33                	push   (%ebx)
+801029c2:	e8 99 d9 ff ff       	call   80100360 <bread>
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+801029c7:	83 c4 0c             	add    $0xc,%esp
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+801029ca:	89 c6                	mov    %eax,%esi
+    dip = (struct dinode*)bp->data + ip->inum%IPB;
+801029cc:	8b 43 04             	mov    0x4(%ebx),%eax
+801029cf:	83 e0 07             	and    $0x7,%eax
+801029d2:	c1 e0 06             	shl    $0x6,%eax
+801029d5:	8d 44 06 70          	lea    0x70(%esi,%eax,1),%eax
+    ip->type = dip->type;
+801029d9:	0f b7 10             	movzwl (%eax),%edx
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+801029dc:	83 c0 0c             	add    $0xc,%eax
+    ip->type = dip->type;
+801029df:	66 89 53 70          	mov    %dx,0x70(%ebx)
+    ip->major = dip->major;
+801029e3:	0f b6 50 f6          	movzbl -0xa(%eax),%edx
+801029e7:	66 89 53 72          	mov    %dx,0x72(%ebx)
+    ip->minor = dip->minor;
+801029eb:	0f b6 50 f7          	movzbl -0x9(%eax),%edx
+801029ef:	66 89 53 74          	mov    %dx,0x74(%ebx)
+    ip->flags = dip->flags;
+801029f3:	0f b7 50 f8          	movzwl -0x8(%eax),%edx
+801029f7:	66 89 53 76          	mov    %dx,0x76(%ebx)
+    ip->nlink = dip->nlink;
+801029fb:	0f b7 50 fa          	movzwl -0x6(%eax),%edx
+801029ff:	66 89 53 78          	mov    %dx,0x78(%ebx)
+    ip->size = dip->size;
+80102a03:	8b 50 fc             	mov    -0x4(%eax),%edx
+80102a06:	89 53 7c             	mov    %edx,0x7c(%ebx)
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+80102a09:	6a 34                	push   $0x34
+80102a0b:	50                   	push   %eax
+80102a0c:	8d 83 80 00 00 00    	lea    0x80(%ebx),%eax
+80102a12:	50                   	push   %eax
+80102a13:	e8 08 5b 00 00       	call   80108520 <memmove>
+    brelse(bp);
+80102a18:	89 34 24             	mov    %esi,(%esp)
+80102a1b:	e8 80 da ff ff       	call   801004a0 <brelse>
+    if(ip->type == 0)
+80102a20:	83 c4 10             	add    $0x10,%esp
+80102a23:	66 83 7b 70 00       	cmpw   $0x0,0x70(%ebx)
+    ip->valid = 1;
+80102a28:	c7 43 6c 01 00 00 00 	movl   $0x1,0x6c(%ebx)
+    if(ip->type == 0)
+80102a2f:	0f 85 6c ff ff ff    	jne    801029a1 <ilock+0x31>
+      panic("ilock: no type");
+80102a35:	83 ec 0c             	sub    $0xc,%esp
+80102a38:	68 04 b8 10 80       	push   $0x8010b804
+80102a3d:	e8 1e dc ff ff       	call   80100660 <panic>
+    panic("ilock");
+80102a42:	83 ec 0c             	sub    $0xc,%esp
+80102a45:	68 fe b7 10 80       	push   $0x8010b7fe
+80102a4a:	e8 11 dc ff ff       	call   80100660 <panic>
+80102a4f:	90                   	nop
+
+80102a50 <iunlock>:
+{
+80102a50:	55                   	push   %ebp
+80102a51:	89 e5                	mov    %esp,%ebp
+80102a53:	56                   	push   %esi
+80102a54:	53                   	push   %ebx
+80102a55:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80102a58:	85 db                	test   %ebx,%ebx
+80102a5a:	74 28                	je     80102a84 <iunlock+0x34>
+80102a5c:	83 ec 0c             	sub    $0xc,%esp
+80102a5f:	8d 73 18             	lea    0x18(%ebx),%esi
+80102a62:	56                   	push   %esi
+80102a63:	e8 78 54 00 00       	call   80107ee0 <holdingsleep>
+80102a68:	83 c4 10             	add    $0x10,%esp
+80102a6b:	85 c0                	test   %eax,%eax
+80102a6d:	74 15                	je     80102a84 <iunlock+0x34>
+80102a6f:	8b 43 08             	mov    0x8(%ebx),%eax
+80102a72:	85 c0                	test   %eax,%eax
+80102a74:	7e 0e                	jle    80102a84 <iunlock+0x34>
+  releasesleep(&ip->lock);
+80102a76:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80102a79:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102a7c:	5b                   	pop    %ebx
+80102a7d:	5e                   	pop    %esi
+80102a7e:	5d                   	pop    %ebp
+  releasesleep(&ip->lock);
+80102a7f:	e9 6c 53 00 00       	jmp    80107df0 <releasesleep>
+    panic("iunlock");
+80102a84:	83 ec 0c             	sub    $0xc,%esp
+80102a87:	68 13 b8 10 80       	push   $0x8010b813
+80102a8c:	e8 cf db ff ff       	call   80100660 <panic>
+80102a91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102a98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102a9f:	90                   	nop
+
+80102aa0 <ilockread>:
+{
+80102aa0:	55                   	push   %ebp
+80102aa1:	89 e5                	mov    %esp,%ebp
+80102aa3:	56                   	push   %esi
+80102aa4:	53                   	push   %ebx
+80102aa5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || ip->ref < 1)
+80102aa8:	85 db                	test   %ebx,%ebx
+80102aaa:	74 65                	je     80102b11 <ilockread+0x71>
+80102aac:	8b 4b 08             	mov    0x8(%ebx),%ecx
+80102aaf:	85 c9                	test   %ecx,%ecx
+80102ab1:	7e 5e                	jle    80102b11 <ilockread+0x71>
+  acquiresleepread(&ip->lock);
+80102ab3:	83 ec 0c             	sub    $0xc,%esp
+80102ab6:	8d 73 18             	lea    0x18(%ebx),%esi
+80102ab9:	56                   	push   %esi
+80102aba:	e8 71 53 00 00       	call   80107e30 <acquiresleepread>
+  if(ip->valid == 0){
+80102abf:	8b 53 6c             	mov    0x6c(%ebx),%edx
+80102ac2:	83 c4 10             	add    $0x10,%esp
+80102ac5:	85 d2                	test   %edx,%edx
+80102ac7:	74 07                	je     80102ad0 <ilockread+0x30>
+}
+80102ac9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102acc:	5b                   	pop    %ebx
+80102acd:	5e                   	pop    %esi
+80102ace:	5d                   	pop    %ebp
+80102acf:	c3                   	ret
+    releasesleepread(&ip->lock);
+80102ad0:	83 ec 0c             	sub    $0xc,%esp
+80102ad3:	56                   	push   %esi
+80102ad4:	e8 a7 53 00 00       	call   80107e80 <releasesleepread>
+    ilock(ip);
+80102ad9:	89 1c 24             	mov    %ebx,(%esp)
+80102adc:	e8 8f fe ff ff       	call   80102970 <ilock>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80102ae1:	89 34 24             	mov    %esi,(%esp)
+80102ae4:	e8 f7 53 00 00       	call   80107ee0 <holdingsleep>
+80102ae9:	83 c4 10             	add    $0x10,%esp
+80102aec:	85 c0                	test   %eax,%eax
+80102aee:	74 2e                	je     80102b1e <ilockread+0x7e>
+80102af0:	8b 43 08             	mov    0x8(%ebx),%eax
+80102af3:	85 c0                	test   %eax,%eax
+80102af5:	7e 27                	jle    80102b1e <ilockread+0x7e>
+  releasesleep(&ip->lock);
+80102af7:	83 ec 0c             	sub    $0xc,%esp
+80102afa:	56                   	push   %esi
+80102afb:	e8 f0 52 00 00       	call   80107df0 <releasesleep>
+    acquiresleepread(&ip->lock);
+80102b00:	89 75 08             	mov    %esi,0x8(%ebp)
+80102b03:	83 c4 10             	add    $0x10,%esp
+}
+80102b06:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102b09:	5b                   	pop    %ebx
+80102b0a:	5e                   	pop    %esi
+80102b0b:	5d                   	pop    %ebp
+    acquiresleepread(&ip->lock);
+80102b0c:	e9 1f 53 00 00       	jmp    80107e30 <acquiresleepread>
+    panic("ilockread");
+80102b11:	83 ec 0c             	sub    $0xc,%esp
+80102b14:	68 1b b8 10 80       	push   $0x8010b81b
+80102b19:	e8 42 db ff ff       	call   80100660 <panic>
+    panic("iunlock");
+80102b1e:	83 ec 0c             	sub    $0xc,%esp
+80102b21:	68 13 b8 10 80       	push   $0x8010b813
+80102b26:	e8 35 db ff ff       	call   80100660 <panic>
+80102b2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102b2f:	90                   	nop
+
+80102b30 <iunlockread>:
+{
+80102b30:	55                   	push   %ebp
+80102b31:	89 e5                	mov    %esp,%ebp
+80102b33:	83 ec 08             	sub    $0x8,%esp
+80102b36:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(ip == 0 || ip->lock.readers < 1 || ip->ref < 1)
+80102b39:	85 c0                	test   %eax,%eax
+80102b3b:	74 1a                	je     80102b57 <iunlockread+0x27>
+80102b3d:	8b 48 1c             	mov    0x1c(%eax),%ecx
+80102b40:	85 c9                	test   %ecx,%ecx
+80102b42:	74 13                	je     80102b57 <iunlockread+0x27>
+80102b44:	8b 50 08             	mov    0x8(%eax),%edx
+80102b47:	85 d2                	test   %edx,%edx
+80102b49:	7e 0c                	jle    80102b57 <iunlockread+0x27>
+  releasesleepread(&ip->lock);
+80102b4b:	83 c0 18             	add    $0x18,%eax
+80102b4e:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80102b51:	c9                   	leave
+  releasesleepread(&ip->lock);
+80102b52:	e9 29 53 00 00       	jmp    80107e80 <releasesleepread>
+    panic("iunlockread");
+80102b57:	83 ec 0c             	sub    $0xc,%esp
+80102b5a:	68 25 b8 10 80       	push   $0x8010b825
+80102b5f:	e8 fc da ff ff       	call   80100660 <panic>
+80102b64:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102b6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102b6f:	90                   	nop
+
+80102b70 <iput>:
+{
+80102b70:	55                   	push   %ebp
+80102b71:	89 e5                	mov    %esp,%ebp
+80102b73:	57                   	push   %edi
+80102b74:	56                   	push   %esi
+80102b75:	53                   	push   %ebx
+80102b76:	83 ec 38             	sub    $0x38,%esp
+80102b79:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquiresleep(&ip->lock);
+80102b7c:	8d 7b 18             	lea    0x18(%ebx),%edi
+80102b7f:	57                   	push   %edi
+80102b80:	e8 0b 52 00 00       	call   80107d90 <acquiresleep>
+  if(ip->valid && ip->nlink == 0){
+80102b85:	8b 73 6c             	mov    0x6c(%ebx),%esi
+80102b88:	83 c4 10             	add    $0x10,%esp
+80102b8b:	85 f6                	test   %esi,%esi
+80102b8d:	74 07                	je     80102b96 <iput+0x26>
+80102b8f:	66 83 7b 78 00       	cmpw   $0x0,0x78(%ebx)
+80102b94:	74 32                	je     80102bc8 <iput+0x58>
+  releasesleep(&ip->lock);
+80102b96:	83 ec 0c             	sub    $0xc,%esp
+80102b99:	8d 73 08             	lea    0x8(%ebx),%esi
+80102b9c:	57                   	push   %edi
+80102b9d:	e8 4e 52 00 00       	call   80107df0 <releasesleep>
+  while((r = ip->ref) > 1)
+80102ba2:	83 c4 10             	add    $0x10,%esp
+80102ba5:	8b 43 08             	mov    0x8(%ebx),%eax
+80102ba8:	83 f8 01             	cmp    $0x1,%eax
+80102bab:	0f 8e 8f 00 00 00    	jle    80102c40 <iput+0xd0>
+    if(__sync_bool_compare_and_swap(&ip->ref, r, r-1))
+80102bb1:	8d 50 ff             	lea    -0x1(%eax),%edx
+80102bb4:	f0 0f b1 16          	lock cmpxchg %edx,(%esi)
+80102bb8:	75 eb                	jne    80102ba5 <iput+0x35>
+}
+80102bba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102bbd:	5b                   	pop    %ebx
+80102bbe:	5e                   	pop    %esi
+80102bbf:	5f                   	pop    %edi
+80102bc0:	5d                   	pop    %ebp
+80102bc1:	c3                   	ret
+80102bc2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    acquireread(&icache.lock);
+80102bc8:	83 ec 0c             	sub    $0xc,%esp
+80102bcb:	68 e0 93 20 80       	push   $0x802093e0
+80102bd0:	e8 ab 56 00 00       	call   80108280 <acquireread>
+    r = ip->ref;
+80102bd5:	8b 73 08             	mov    0x8(%ebx),%esi
+    releaseread(&icache.lock);
+80102bd8:	c7 04 24 e0 93 20 80 	movl   $0x802093e0,(%esp)
+80102bdf:	e8 3c 58 00 00       	call   80108420 <releaseread>
+    if(r == 1){
+80102be4:	83 c4 10             	add    $0x10,%esp
+80102be7:	83 fe 01             	cmp    $0x1,%esi
+80102bea:	75 aa                	jne    80102b96 <iput+0x26>
+      if(ip->type == T_DIR)
+80102bec:	66 83 7b 70 01       	cmpw   $0x1,0x70(%ebx)
+80102bf1:	0f 84 94 00 00 00    	je     80102c8b <iput+0x11b>
+  if(ip->flags & I_EXTENT){
+80102bf7:	f6 43 76 01          	testb  $0x1,0x76(%ebx)
+80102bfb:	0f 85 35 01 00 00    	jne    80102d36 <iput+0x1c6>
+80102c01:	8d 8b a8 00 00 00    	lea    0xa8(%ebx),%ecx
+80102c07:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80102c0a:	8d b3 80 00 00 00    	lea    0x80(%ebx),%esi
+80102c10:	89 df                	mov    %ebx,%edi
+80102c12:	89 cb                	mov    %ecx,%ebx
+80102c14:	eb 15                	jmp    80102c2b <iput+0xbb>
+80102c16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102c1d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; i < NDIRECT; i++){
+80102c20:	83 c6 04             	add    $0x4,%esi
+80102c23:	39 de                	cmp    %ebx,%esi
+80102c25:	0f 84 a5 00 00 00    	je     80102cd0 <iput+0x160>
+    if(ip->addrs[i]){
+80102c2b:	8b 16                	mov    (%esi),%edx
+80102c2d:	85 d2                	test   %edx,%edx
+80102c2f:	74 ef                	je     80102c20 <iput+0xb0>
+      bfree(ip->dev, ip->addrs[i]);
+80102c31:	8b 07                	mov    (%edi),%eax
+80102c33:	e8 e8 f6 ff ff       	call   80102320 <bfree>
+      ip->addrs[i] = 0;
+80102c38:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+80102c3e:	eb e0                	jmp    80102c20 <iput+0xb0>
+  acquirewrite(&icache.lock);
+80102c40:	83 ec 0c             	sub    $0xc,%esp
+80102c43:	68 e0 93 20 80       	push   $0x802093e0
+80102c48:	e8 83 56 00 00       	call   801082d0 <acquirewrite>
+  if(__sync_sub_and_fetch(&ip->ref, 1) == 0){
+80102c4d:	f0 83 2e 01          	lock subl $0x1,(%esi)
+80102c51:	0f 94 c0             	sete   %al
+80102c54:	83 c4 10             	add    $0x10,%esp
+80102c57:	84 c0                	test   %al,%al
+80102c59:	74 1d                	je     80102c78 <iput+0x108>
+    ip->next = icache.lru.next;
+80102c5b:	a1 fc 95 20 80       	mov    0x802095fc,%eax
+    ip->prev = &icache.lru;
+80102c60:	c7 43 10 e8 95 20 80 	movl   $0x802095e8,0x10(%ebx)
+    ip->next = icache.lru.next;
+80102c67:	89 43 14             	mov    %eax,0x14(%ebx)
+    icache.lru.next->prev = ip;
+80102c6a:	a1 fc 95 20 80       	mov    0x802095fc,%eax
+80102c6f:	89 58 10             	mov    %ebx,0x10(%eax)
+    icache.lru.next = ip;
+80102c72:	89 1d fc 95 20 80    	mov    %ebx,0x802095fc
+  releasewrite(&icache.lock);
+80102c78:	c7 45 08 e0 93 20 80 	movl   $0x802093e0,0x8(%ebp)
+}
+80102c7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102c82:	5b                   	pop    %ebx
+80102c83:	5e                   	pop    %esi
+80102c84:	5f                   	pop    %edi
+80102c85:	5d                   	pop    %ebp
+  releasewrite(&icache.lock);
+80102c86:	e9 c5 57 00 00       	jmp    80108450 <releasewrite>
+        dcpurge(ip->dev, ip->inum);
+80102c8b:	8b 13                	mov    (%ebx),%edx
+  acquirewrite(&dcache.lock);
+80102c8d:	83 ec 0c             	sub    $0xc,%esp
+        dcpurge(ip->dev, ip->inum);
+80102c90:	8b 73 04             	mov    0x4(%ebx),%esi
+80102c93:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  acquirewrite(&dcache.lock);
+80102c96:	68 80 73 20 80       	push   $0x80207380
+80102c9b:	e8 30 56 00 00       	call   801082d0 <acquirewrite>
+  for(e = dcache.ent[0]; e < dcache.ent[NDCSET]; e++)
+80102ca0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  acquirewrite(&dcache.lock);
+80102ca3:	83 c4 10             	add    $0x10,%esp
+  for(e = dcache.ent[0]; e < dcache.ent[NDCSET]; e++)
+80102ca6:	b8 8c 73 20 80       	mov    $0x8020738c,%eax
+80102cab:	eb 11                	jmp    80102cbe <iput+0x14e>
+80102cad:	8d 76 00             	lea    0x0(%esi),%esi
+80102cb0:	83 c0 20             	add    $0x20,%eax
+80102cb3:	3d 8c 93 20 80       	cmp    $0x8020938c,%eax
+80102cb8:	0f 84 58 01 00 00    	je     80102e16 <iput+0x2a6>
+    if(e->dinum == inum && e->dev == dev)
+80102cbe:	3b 70 04             	cmp    0x4(%eax),%esi
+80102cc1:	75 ed                	jne    80102cb0 <iput+0x140>
+80102cc3:	3b 10                	cmp    (%eax),%edx
+80102cc5:	75 e9                	jne    80102cb0 <iput+0x140>
+      e->dinum = 0;
+80102cc7:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+80102cce:	eb e0                	jmp    80102cb0 <iput+0x140>
+  for(i = 0; i < 3; i++){
+80102cd0:	89 fb                	mov    %edi,%ebx
+80102cd2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80102cd5:	31 f6                	xor    %esi,%esi
+    if(ip->addrs[NDIRECT+i]){
+80102cd7:	8b 94 b3 a8 00 00 00 	mov    0xa8(%ebx,%esi,4),%edx
+      itruncind(ip->dev, ip->addrs[NDIRECT+i], i+1);
+80102cde:	83 c6 01             	add    $0x1,%esi
+    if(ip->addrs[NDIRECT+i]){
+80102ce1:	85 d2                	test   %edx,%edx
+80102ce3:	75 3b                	jne    80102d20 <iput+0x1b0>
+  for(i = 0; i < 3; i++){
+80102ce5:	83 fe 03             	cmp    $0x3,%esi
+80102ce8:	75 ed                	jne    80102cd7 <iput+0x167>
+  iupdate(ip);
+80102cea:	83 ec 0c             	sub    $0xc,%esp
+  ip->size = 0;
+80102ced:	c7 43 7c 00 00 00 00 	movl   $0x0,0x7c(%ebx)
+  iupdate(ip);
+80102cf4:	53                   	push   %ebx
+80102cf5:	e8 b6 fb ff ff       	call   801028b0 <iupdate>
+80102cfa:	83 c4 10             	add    $0x10,%esp
+      iupdate(ip);
+80102cfd:	83 ec 0c             	sub    $0xc,%esp
+      ip->type = 0;
+80102d00:	31 c0                	xor    %eax,%eax
+80102d02:	66 89 43 70          	mov    %ax,0x70(%ebx)
+      iupdate(ip);
+80102d06:	53                   	push   %ebx
+80102d07:	e8 a4 fb ff ff       	call   801028b0 <iupdate>
+      ip->valid = 0;
+80102d0c:	c7 43 6c 00 00 00 00 	movl   $0x0,0x6c(%ebx)
+80102d13:	83 c4 10             	add    $0x10,%esp
+80102d16:	e9 7b fe ff ff       	jmp    80102b96 <iput+0x26>
+80102d1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102d1f:	90                   	nop
+      itruncind(ip->dev, ip->addrs[NDIRECT+i], i+1);
+80102d20:	8b 03                	mov    (%ebx),%eax
+80102d22:	89 f1                	mov    %esi,%ecx
+80102d24:	e8 97 f6 ff ff       	call   801023c0 <itruncind>
+      ip->addrs[NDIRECT+i] = 0;
+80102d29:	c7 84 b3 a4 00 00 00 	movl   $0x0,0xa4(%ebx,%esi,4)
+80102d30:	00 00 00 00 
+80102d34:	eb af                	jmp    80102ce5 <iput+0x175>
+  for(i = 0; i < NEXTENT + NIEXTENT; i++){
+80102d36:	8d b3 80 00 00 00    	lea    0x80(%ebx),%esi
+  bp = 0;
+80102d3c:	31 c9                	xor    %ecx,%ecx
+  for(i = 0; i < NEXTENT + NIEXTENT; i++){
+80102d3e:	89 7d d8             	mov    %edi,-0x28(%ebp)
+80102d41:	31 d2                	xor    %edx,%edx
+80102d43:	89 75 e0             	mov    %esi,-0x20(%ebp)
+80102d46:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+80102d49:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+80102d4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(i == NEXTENT){
+80102d50:	83 fa 06             	cmp    $0x6,%edx
+80102d53:	0f 84 97 00 00 00    	je     80102df0 <iput+0x280>
+  if(i < NEXTENT)
+80102d59:	83 fa 05             	cmp    $0x5,%edx
+80102d5c:	0f 8e 86 00 00 00    	jle    80102de8 <iput+0x278>
+  return (struct extent*)bp->data + (i - NEXTENT);
+80102d62:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80102d65:	8d 7c d0 40          	lea    0x40(%eax,%edx,8),%edi
+    if(extent(e, bp, i)->len == 0)
+80102d69:	8b 4f 04             	mov    0x4(%edi),%ecx
+80102d6c:	85 c9                	test   %ecx,%ecx
+80102d6e:	74 2a                	je     80102d9a <iput+0x22a>
+    for(k = 0; k < extent(e, bp, i)->len; k++)
+80102d70:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80102d73:	31 f6                	xor    %esi,%esi
+80102d75:	8d 76 00             	lea    0x0(%esi),%esi
+      bfree(ip->dev, extent(e, bp, i)->start + k);
+80102d78:	8b 17                	mov    (%edi),%edx
+80102d7a:	8b 03                	mov    (%ebx),%eax
+80102d7c:	01 f2                	add    %esi,%edx
+    for(k = 0; k < extent(e, bp, i)->len; k++)
+80102d7e:	83 c6 01             	add    $0x1,%esi
+      bfree(ip->dev, extent(e, bp, i)->start + k);
+80102d81:	e8 9a f5 ff ff       	call   80102320 <bfree>
+    for(k = 0; k < extent(e, bp, i)->len; k++)
+80102d86:	3b 77 04             	cmp    0x4(%edi),%esi
+80102d89:	72 ed                	jb     80102d78 <iput+0x208>
+  for(i = 0; i < NEXTENT + NIEXTENT; i++){
+80102d8b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80102d8e:	83 45 e0 08          	addl   $0x8,-0x20(%ebp)
+80102d92:	83 c2 01             	add    $0x1,%edx
+80102d95:	83 fa 46             	cmp    $0x46,%edx
+80102d98:	75 b6                	jne    80102d50 <iput+0x1e0>
+  if(bp){
+80102d9a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+80102d9d:	8b 7d d8             	mov    -0x28(%ebp),%edi
+80102da0:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+80102da3:	85 c9                	test   %ecx,%ecx
+80102da5:	74 19                	je     80102dc0 <iput+0x250>
+    brelse(bp);
+80102da7:	83 ec 0c             	sub    $0xc,%esp
+80102daa:	51                   	push   %ecx
+80102dab:	e8 f0 d6 ff ff       	call   801004a0 <brelse>
+    bfree(ip->dev, ip->addrs[NDIRECT+2]);
+80102db0:	8b 93 b0 00 00 00    	mov    0xb0(%ebx),%edx
+80102db6:	8b 03                	mov    (%ebx),%eax
+80102db8:	e8 63 f5 ff ff       	call   80102320 <bfree>
+80102dbd:	83 c4 10             	add    $0x10,%esp
+  memset(ip->addrs, 0, sizeof(ip->addrs));
+80102dc0:	83 ec 04             	sub    $0x4,%esp
+80102dc3:	6a 34                	push   $0x34
+80102dc5:	6a 00                	push   $0x0
+80102dc7:	56                   	push   %esi
+80102dc8:	e8 c3 56 00 00       	call   80108490 <memset>
+    ip->size = 0;
+80102dcd:	c7 43 7c 00 00 00 00 	movl   $0x0,0x7c(%ebx)
+    iupdate(ip);
+80102dd4:	89 1c 24             	mov    %ebx,(%esp)
+80102dd7:	e8 d4 fa ff ff       	call   801028b0 <iupdate>
+    return;
+80102ddc:	83 c4 10             	add    $0x10,%esp
+80102ddf:	e9 19 ff ff ff       	jmp    80102cfd <iput+0x18d>
+80102de4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return &direct[i];
+80102de8:	8b 7d e0             	mov    -0x20(%ebp),%edi
+80102deb:	e9 79 ff ff ff       	jmp    80102d69 <iput+0x1f9>
+      if(ip->addrs[NDIRECT+2] == 0)
+80102df0:	8b 83 b0 00 00 00    	mov    0xb0(%ebx),%eax
+80102df6:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80102df9:	85 c0                	test   %eax,%eax
+80102dfb:	74 9d                	je     80102d9a <iput+0x22a>
+      bp = bread(ip->dev, ip->addrs[NDIRECT+2]);
+80102dfd:	83 ec 08             	sub    $0x8,%esp
+80102e00:	50                   	push   %eax
+80102e01:	ff 33                	push   (%ebx)
+80102e03:	e8 58 d5 ff ff       	call   80100360 <bread>
+80102e08:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80102e0b:	83 c4 10             	add    $0x10,%esp
+80102e0e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  if(i < NEXTENT)
+80102e11:	e9 4c ff ff ff       	jmp    80102d62 <iput+0x1f2>
+  releasewrite(&dcache.lock);
+80102e16:	83 ec 0c             	sub    $0xc,%esp
+80102e19:	68 80 73 20 80       	push   $0x80207380
+80102e1e:	e8 2d 56 00 00       	call   80108450 <releasewrite>
+  if(ip->flags & I_EXTENT){
+80102e23:	83 c4 10             	add    $0x10,%esp
+80102e26:	f6 43 76 01          	testb  $0x1,0x76(%ebx)
+80102e2a:	0f 85 06 ff ff ff    	jne    80102d36 <iput+0x1c6>
+  if(ip->type == T_DIR && ip->addrs[DXROOT])
+80102e30:	66 83 7b 70 01       	cmpw   $0x1,0x70(%ebx)
+80102e35:	0f 85 c6 fd ff ff    	jne    80102c01 <iput+0x91>
+80102e3b:	8b 83 b0 00 00 00    	mov    0xb0(%ebx),%eax
+80102e41:	85 c0                	test   %eax,%eax
+80102e43:	0f 84 b8 fd ff ff    	je     80102c01 <iput+0x91>
+  bp = bread(dp->dev, dp->addrs[DXROOT]);
+80102e49:	83 ec 08             	sub    $0x8,%esp
+80102e4c:	50                   	push   %eax
+80102e4d:	ff 33                	push   (%ebx)
+80102e4f:	e8 0c d5 ff ff       	call   80100360 <bread>
+  if(n->depth > 0)
+80102e54:	83 c4 10             	add    $0x10,%esp
+80102e57:	66 83 78 70 00       	cmpw   $0x0,0x70(%eax)
+  bp = bread(dp->dev, dp->addrs[DXROOT]);
+80102e5c:	89 c1                	mov    %eax,%ecx
+  if(n->depth > 0)
+80102e5e:	74 2d                	je     80102e8d <iput+0x31d>
+    for(i = 0; i < n->count; i++)
+80102e60:	66 83 78 72 00       	cmpw   $0x0,0x72(%eax)
+80102e65:	74 26                	je     80102e8d <iput+0x31d>
+80102e67:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80102e6a:	31 f6                	xor    %esi,%esi
+80102e6c:	89 df                	mov    %ebx,%edi
+80102e6e:	89 c3                	mov    %eax,%ebx
+      bfree(dp->dev, n->e[i].block);
+80102e70:	8b 54 f3 7c          	mov    0x7c(%ebx,%esi,8),%edx
+80102e74:	8b 07                	mov    (%edi),%eax
+    for(i = 0; i < n->count; i++)
+80102e76:	83 c6 01             	add    $0x1,%esi
+      bfree(dp->dev, n->e[i].block);
+80102e79:	e8 a2 f4 ff ff       	call   80102320 <bfree>
+    for(i = 0; i < n->count; i++)
+80102e7e:	0f b7 43 72          	movzwl 0x72(%ebx),%eax
+80102e82:	39 c6                	cmp    %eax,%esi
+80102e84:	7c ea                	jl     80102e70 <iput+0x300>
+80102e86:	89 d9                	mov    %ebx,%ecx
+80102e88:	89 fb                	mov    %edi,%ebx
+80102e8a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  brelse(bp);
+80102e8d:	83 ec 0c             	sub    $0xc,%esp
+80102e90:	51                   	push   %ecx
+80102e91:	e8 0a d6 ff ff       	call   801004a0 <brelse>
+  bfree(dp->dev, dp->addrs[DXROOT]);
+80102e96:	8b 93 b0 00 00 00    	mov    0xb0(%ebx),%edx
+80102e9c:	8b 03                	mov    (%ebx),%eax
+80102e9e:	e8 7d f4 ff ff       	call   80102320 <bfree>
+  dp->addrs[DXROOT] = 0;
+80102ea3:	83 c4 10             	add    $0x10,%esp
+80102ea6:	c7 83 b0 00 00 00 00 	movl   $0x0,0xb0(%ebx)
+80102ead:	00 00 00 
+  for(i = 0; i < NDIRECT; i++){
+80102eb0:	e9 4c fd ff ff       	jmp    80102c01 <iput+0x91>
+80102eb5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102ebc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80102ec0 <iunlockput>:
+{
+80102ec0:	55                   	push   %ebp
+80102ec1:	89 e5                	mov    %esp,%ebp
+80102ec3:	56                   	push   %esi
+80102ec4:	53                   	push   %ebx
+80102ec5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80102ec8:	85 db                	test   %ebx,%ebx
+80102eca:	74 34                	je     80102f00 <iunlockput+0x40>
+80102ecc:	83 ec 0c             	sub    $0xc,%esp
+80102ecf:	8d 73 18             	lea    0x18(%ebx),%esi
+80102ed2:	56                   	push   %esi
+80102ed3:	e8 08 50 00 00       	call   80107ee0 <holdingsleep>
+80102ed8:	83 c4 10             	add    $0x10,%esp
+80102edb:	85 c0                	test   %eax,%eax
+80102edd:	74 21                	je     80102f00 <iunlockput+0x40>
+80102edf:	8b 43 08             	mov    0x8(%ebx),%eax
+80102ee2:	85 c0                	test   %eax,%eax
+80102ee4:	7e 1a                	jle    80102f00 <iunlockput+0x40>
+  releasesleep(&ip->lock);
+80102ee6:	83 ec 0c             	sub    $0xc,%esp
+80102ee9:	56                   	push   %esi
+80102eea:	e8 01 4f 00 00       	call   80107df0 <releasesleep>
+  iput(ip);
+80102eef:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80102ef2:	83 c4 10             	add    $0x10,%esp
+}
+80102ef5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102ef8:	5b                   	pop    %ebx
+80102ef9:	5e                   	pop    %esi
+80102efa:	5d                   	pop    %ebp
+  iput(ip);
+80102efb:	e9 70 fc ff ff       	jmp    80102b70 <iput>
+    panic("iunlock");
+80102f00:	83 ec 0c             	sub    $0xc,%esp
+80102f03:	68 13 b8 10 80       	push   $0x8010b813
+80102f08:	e8 53 d7 ff ff       	call   80100660 <panic>
+80102f0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80102f10 <stati>:
+{
+80102f10:	55                   	push   %ebp
+80102f11:	89 e5                	mov    %esp,%ebp
+80102f13:	8b 55 08             	mov    0x8(%ebp),%edx
+80102f16:	8b 45 0c             	mov    0xc(%ebp),%eax
+  st->dev = ip->dev;
+80102f19:	8b 0a                	mov    (%edx),%ecx
+80102f1b:	89 48 04             	mov    %ecx,0x4(%eax)
+  st->ino = ip->inum;
+80102f1e:	8b 4a 04             	mov    0x4(%edx),%ecx
+80102f21:	89 48 08             	mov    %ecx,0x8(%eax)
+  st->type = ip->type;
+80102f24:	0f b7 4a 70          	movzwl 0x70(%edx),%ecx
+80102f28:	66 89 08             	mov    %cx,(%eax)
+  st->nlink = ip->nlink;
+80102f2b:	0f b7 4a 78          	movzwl 0x78(%edx),%ecx
+80102f2f:	66 89 48 0c          	mov    %cx,0xc(%eax)
+  st->size = ip->size;
+80102f33:	8b 52 7c             	mov    0x7c(%edx),%edx
+80102f36:	89 50 10             	mov    %edx,0x10(%eax)
+}
+80102f39:	5d                   	pop    %ebp
+80102f3a:	c3                   	ret
+80102f3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102f3f:	90                   	nop
+
+80102f40 <readi>:
+{
+80102f40:	55                   	push   %ebp
+80102f41:	89 e5                	mov    %esp,%ebp
+80102f43:	57                   	push   %edi
+80102f44:	56                   	push   %esi
+80102f45:	53                   	push   %ebx
+80102f46:	83 ec 7c             	sub    $0x7c,%esp
+80102f49:	8b 45 0c             	mov    0xc(%ebp),%eax
+80102f4c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80102f4f:	89 45 90             	mov    %eax,-0x70(%ebp)
+80102f52:	8b 45 10             	mov    0x10(%ebp),%eax
+  if(ip->type == T_DEV){
+80102f55:	66 83 7b 70 03       	cmpw   $0x3,0x70(%ebx)
+{
+80102f5a:	89 45 94             	mov    %eax,-0x6c(%ebp)
+80102f5d:	8b 45 14             	mov    0x14(%ebp),%eax
+80102f60:	89 45 8c             	mov    %eax,-0x74(%ebp)
+  if(ip->type == T_DEV){
+80102f63:	0f 84 48 01 00 00    	je     801030b1 <readi+0x171>
+  if(off > ip->size || off + n < off)
+80102f69:	8b 43 7c             	mov    0x7c(%ebx),%eax
+80102f6c:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+80102f6f:	39 f8                	cmp    %edi,%eax
+80102f71:	0f 82 5e 01 00 00    	jb     801030d5 <readi+0x195>
+80102f77:	8b 75 8c             	mov    -0x74(%ebp),%esi
+80102f7a:	89 f9                	mov    %edi,%ecx
+80102f7c:	01 f1                	add    %esi,%ecx
+80102f7e:	0f 82 51 01 00 00    	jb     801030d5 <readi+0x195>
+    n = ip->size - off;
+80102f84:	89 c2                	mov    %eax,%edx
+80102f86:	29 fa                	sub    %edi,%edx
+80102f88:	39 c8                	cmp    %ecx,%eax
+80102f8a:	0f 43 d6             	cmovae %esi,%edx
+80102f8d:	8d ba ff 01 00 00    	lea    0x1ff(%edx),%edi
+80102f93:	89 55 8c             	mov    %edx,-0x74(%ebp)
+  for(tot=0; tot<n; ){
+80102f96:	89 7d 80             	mov    %edi,-0x80(%ebp)
+80102f99:	31 ff                	xor    %edi,%edi
+80102f9b:	85 d2                	test   %edx,%edx
+80102f9d:	0f 84 ce 00 00 00    	je     80103071 <readi+0x131>
+80102fa3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102fa7:	90                   	nop
+    addr = bmaprun(ip, off/BSIZE, NBLOCKS(off, n-tot), &run);
+80102fa8:	8b 75 94             	mov    -0x6c(%ebp),%esi
+80102fab:	8b 55 80             	mov    -0x80(%ebp),%edx
+80102fae:	89 f0                	mov    %esi,%eax
+80102fb0:	25 ff 01 00 00       	and    $0x1ff,%eax
+80102fb5:	29 f8                	sub    %edi,%eax
+80102fb7:	01 d0                	add    %edx,%eax
+80102fb9:	89 c1                	mov    %eax,%ecx
+80102fbb:	c1 e9 09             	shr    $0x9,%ecx
+80102fbe:	3d 00 22 00 00       	cmp    $0x2200,%eax
+80102fc3:	b8 10 00 00 00       	mov    $0x10,%eax
+80102fc8:	0f 43 c8             	cmovae %eax,%ecx
+80102fcb:	c1 ee 09             	shr    $0x9,%esi
+80102fce:	89 f2                	mov    %esi,%edx
+  if(ip->flags & I_EXTENT)
+80102fd0:	f6 43 76 01          	testb  $0x1,0x76(%ebx)
+80102fd4:	0f 85 a6 00 00 00    	jne    80103080 <readi+0x140>
+  return bmap(ip, bn);
+80102fda:	89 d8                	mov    %ebx,%eax
+  *run = 1;
+80102fdc:	c7 45 a4 01 00 00 00 	movl   $0x1,-0x5c(%ebp)
+    breadn(ip->dev, addr, run, bp);
+80102fe3:	8d 75 a8             	lea    -0x58(%ebp),%esi
+  return bmap(ip, bn);
+80102fe6:	e8 45 f0 ff ff       	call   80102030 <bmap>
+    breadn(ip->dev, addr, run, bp);
+80102feb:	56                   	push   %esi
+80102fec:	6a 01                	push   $0x1
+80102fee:	50                   	push   %eax
+80102fef:	ff 33                	push   (%ebx)
+80102ff1:	e8 ca d3 ff ff       	call   801003c0 <breadn>
+80102ff6:	83 c4 10             	add    $0x10,%esp
+80102ff9:	ba 01 00 00 00       	mov    $0x1,%edx
+80102ffe:	89 5d 84             	mov    %ebx,-0x7c(%ebp)
+80103001:	31 f6                	xor    %esi,%esi
+80103003:	89 55 88             	mov    %edx,-0x78(%ebp)
+80103006:	89 fa                	mov    %edi,%edx
+80103008:	8b 7d 90             	mov    -0x70(%ebp),%edi
+8010300b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010300f:	90                   	nop
+      m = min(n - tot, BSIZE - off%BSIZE);
+80103010:	8b 45 94             	mov    -0x6c(%ebp),%eax
+80103013:	8b 4d 8c             	mov    -0x74(%ebp),%ecx
+80103016:	bb 00 02 00 00       	mov    $0x200,%ebx
+8010301b:	89 55 90             	mov    %edx,-0x70(%ebp)
+8010301e:	25 ff 01 00 00       	and    $0x1ff,%eax
+80103023:	29 d1                	sub    %edx,%ecx
+80103025:	29 c3                	sub    %eax,%ebx
+80103027:	39 cb                	cmp    %ecx,%ebx
+80103029:	0f 47 d9             	cmova  %ecx,%ebx
+      memmove(dst, bp[i]->data + off%BSIZE, m);
+8010302c:	83 ec 04             	sub    $0x4,%esp
+8010302f:	53                   	push   %ebx
+80103030:	8b 4c b5 a8          	mov    -0x58(%ebp,%esi,4),%ecx
+80103034:	8d 44 01 70          	lea    0x70(%ecx,%eax,1),%eax
+80103038:	50                   	push   %eax
+80103039:	57                   	push   %edi
+    for(i = 0; i < run; i++, tot+=m, off+=m, dst+=m){
+8010303a:	01 df                	add    %ebx,%edi
+      memmove(dst, bp[i]->data + off%BSIZE, m);
+8010303c:	e8 df 54 00 00       	call   80108520 <memmove>
+      brelse(bp[i]);
+80103041:	58                   	pop    %eax
+80103042:	ff 74 b5 a8          	push   -0x58(%ebp,%esi,4)
+    for(i = 0; i < run; i++, tot+=m, off+=m, dst+=m){
+80103046:	83 c6 01             	add    $0x1,%esi
+      brelse(bp[i]);
+80103049:	e8 52 d4 ff ff       	call   801004a0 <brelse>
+    for(i = 0; i < run; i++, tot+=m, off+=m, dst+=m){
+8010304e:	8b 55 90             	mov    -0x70(%ebp),%edx
+80103051:	01 5d 94             	add    %ebx,-0x6c(%ebp)
+80103054:	83 c4 10             	add    $0x10,%esp
+80103057:	01 da                	add    %ebx,%edx
+80103059:	39 75 88             	cmp    %esi,-0x78(%ebp)
+8010305c:	75 b2                	jne    80103010 <readi+0xd0>
+8010305e:	8b 5d 84             	mov    -0x7c(%ebp),%ebx
+80103061:	89 7d 90             	mov    %edi,-0x70(%ebp)
+80103064:	89 d7                	mov    %edx,%edi
+  for(tot=0; tot<n; ){
+80103066:	8b 45 8c             	mov    -0x74(%ebp),%eax
+80103069:	39 c7                	cmp    %eax,%edi
+8010306b:	0f 82 37 ff ff ff    	jb     80102fa8 <readi+0x68>
+  return n;
+80103071:	8b 45 8c             	mov    -0x74(%ebp),%eax
+}
+80103074:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103077:	5b                   	pop    %ebx
+80103078:	5e                   	pop    %esi
+80103079:	5f                   	pop    %edi
+8010307a:	5d                   	pop    %ebp
+8010307b:	c3                   	ret
+8010307c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return emap(ip, bn, max, run);
+80103080:	83 ec 0c             	sub    $0xc,%esp
+80103083:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    breadn(ip->dev, addr, run, bp);
+80103086:	8d 75 a8             	lea    -0x58(%ebp),%esi
+    return emap(ip, bn, max, run);
+80103089:	50                   	push   %eax
+8010308a:	89 d8                	mov    %ebx,%eax
+8010308c:	e8 cf f3 ff ff       	call   80102460 <emap>
+    breadn(ip->dev, addr, run, bp);
+80103091:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+80103094:	56                   	push   %esi
+80103095:	52                   	push   %edx
+80103096:	89 55 88             	mov    %edx,-0x78(%ebp)
+80103099:	50                   	push   %eax
+8010309a:	ff 33                	push   (%ebx)
+8010309c:	e8 1f d3 ff ff       	call   801003c0 <breadn>
+    for(i = 0; i < run; i++, tot+=m, off+=m, dst+=m){
+801030a1:	8b 55 88             	mov    -0x78(%ebp),%edx
+801030a4:	83 c4 20             	add    $0x20,%esp
+801030a7:	85 d2                	test   %edx,%edx
+801030a9:	0f 85 4f ff ff ff    	jne    80102ffe <readi+0xbe>
+801030af:	eb b5                	jmp    80103066 <readi+0x126>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+801030b1:	0f bf 43 72          	movswl 0x72(%ebx),%eax
+801030b5:	66 83 f8 09          	cmp    $0x9,%ax
+801030b9:	77 1a                	ja     801030d5 <readi+0x195>
+801030bb:	8b 04 c5 20 73 20 80 	mov    -0x7fdf8ce0(,%eax,8),%eax
+801030c2:	85 c0                	test   %eax,%eax
+801030c4:	74 0f                	je     801030d5 <readi+0x195>
+    return devsw[ip->major].read(ip, dst, n);
+801030c6:	8b 7d 8c             	mov    -0x74(%ebp),%edi
+801030c9:	89 7d 10             	mov    %edi,0x10(%ebp)
+}
+801030cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801030cf:	5b                   	pop    %ebx
+801030d0:	5e                   	pop    %esi
+801030d1:	5f                   	pop    %edi
+801030d2:	5d                   	pop    %ebp
+    return devsw[ip->major].read(ip, dst, n);
+801030d3:	ff e0                	jmp    *%eax
+      return -1;
+801030d5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801030da:	eb 98                	jmp    80103074 <readi+0x134>
+801030dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801030e0 <writei>:
+{
+801030e0:	55                   	push   %ebp
+801030e1:	89 e5                	mov    %esp,%ebp
+801030e3:	57                   	push   %edi
+801030e4:	56                   	push   %esi
+801030e5:	53                   	push   %ebx
+801030e6:	83 ec 3c             	sub    $0x3c,%esp
+801030e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+801030ec:	8b 45 08             	mov    0x8(%ebp),%eax
+801030ef:	89 75 cc             	mov    %esi,-0x34(%ebp)
+801030f2:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(ip->type == T_DEV){
+801030f5:	66 83 78 70 03       	cmpw   $0x3,0x70(%eax)
+{
+801030fa:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+801030fd:	89 75 d0             	mov    %esi,-0x30(%ebp)
+80103100:	8b 75 14             	mov    0x14(%ebp),%esi
+80103103:	89 75 c0             	mov    %esi,-0x40(%ebp)
+  if(ip->type == T_DEV){
+80103106:	0f 84 8f 01 00 00    	je     8010329b <writei+0x1bb>
+  if(off > ip->size || off + n < off)
+8010310c:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+8010310f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80103112:	39 46 7c             	cmp    %eax,0x7c(%esi)
+80103115:	0f 82 b8 01 00 00    	jb     801032d3 <writei+0x1f3>
+  if(off + n > MAXFILE*BSIZE)
+8010311b:	8b 75 c0             	mov    -0x40(%ebp),%esi
+8010311e:	01 f0                	add    %esi,%eax
+80103120:	0f 82 ad 01 00 00    	jb     801032d3 <writei+0x1f3>
+80103126:	3d 00 14 81 40       	cmp    $0x40811400,%eax
+8010312b:	0f 87 a2 01 00 00    	ja     801032d3 <writei+0x1f3>
+  for(tot=0; tot<n; ){
+80103131:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+80103138:	8d 9e ff 01 00 00    	lea    0x1ff(%esi),%ebx
+8010313e:	85 f6                	test   %esi,%esi
+80103140:	0f 84 4b 01 00 00    	je     80103291 <writei+0x1b1>
+80103146:	89 5d b8             	mov    %ebx,-0x48(%ebp)
+80103149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    addr = bmaprun(ip, off/BSIZE, NBLOCKS(off, n-tot), &run);
+80103150:	8b 75 d0             	mov    -0x30(%ebp),%esi
+80103153:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+80103156:	89 f0                	mov    %esi,%eax
+80103158:	25 ff 01 00 00       	and    $0x1ff,%eax
+8010315d:	29 d8                	sub    %ebx,%eax
+8010315f:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+80103162:	01 d8                	add    %ebx,%eax
+80103164:	89 c1                	mov    %eax,%ecx
+80103166:	c1 e9 09             	shr    $0x9,%ecx
+80103169:	3d 00 22 00 00       	cmp    $0x2200,%eax
+8010316e:	b8 10 00 00 00       	mov    $0x10,%eax
+80103173:	0f 43 c8             	cmovae %eax,%ecx
+  if(ip->flags & I_EXTENT)
+80103176:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    addr = bmaprun(ip, off/BSIZE, NBLOCKS(off, n-tot), &run);
+80103179:	c1 ee 09             	shr    $0x9,%esi
+8010317c:	89 f2                	mov    %esi,%edx
+  if(ip->flags & I_EXTENT)
+8010317e:	f6 40 76 01          	testb  $0x1,0x76(%eax)
+80103182:	0f 85 b8 00 00 00    	jne    80103240 <writei+0x160>
+  return bmap(ip, bn);
+80103188:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  *run = 1;
+8010318b:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+  return bmap(ip, bn);
+80103192:	e8 99 ee ff ff       	call   80102030 <bmap>
+80103197:	89 c6                	mov    %eax,%esi
+    if(addr == 0)
+80103199:	85 c0                	test   %eax,%eax
+8010319b:	0f 84 d3 00 00 00    	je     80103274 <writei+0x194>
+    for(i = 0; i < run; i++, tot+=m, off+=m, src+=m){
+801031a1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801031a4:	8d 04 16             	lea    (%esi,%edx,1),%eax
+801031a7:	89 45 bc             	mov    %eax,-0x44(%ebp)
+801031aa:	eb 4b                	jmp    801031f7 <writei+0x117>
+801031ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        bp = bread(ip->dev, addr + i);
+801031b0:	83 ec 08             	sub    $0x8,%esp
+801031b3:	56                   	push   %esi
+801031b4:	50                   	push   %eax
+801031b5:	e8 a6 d1 ff ff       	call   80100360 <bread>
+801031ba:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+801031bd:	83 c4 10             	add    $0x10,%esp
+801031c0:	89 c3                	mov    %eax,%ebx
+      memmove(bp->data + off%BSIZE, src, m);
+801031c2:	83 ec 04             	sub    $0x4,%esp
+801031c5:	8d 44 0b 70          	lea    0x70(%ebx,%ecx,1),%eax
+    for(i = 0; i < run; i++, tot+=m, off+=m, src+=m){
+801031c9:	83 c6 01             	add    $0x1,%esi
+      memmove(bp->data + off%BSIZE, src, m);
+801031cc:	57                   	push   %edi
+801031cd:	ff 75 cc             	push   -0x34(%ebp)
+801031d0:	50                   	push   %eax
+801031d1:	e8 4a 53 00 00       	call   80108520 <memmove>
+      log_write(bp);
+801031d6:	89 1c 24             	mov    %ebx,(%esp)
+801031d9:	e8 12 2a 00 00       	call   80105bf0 <log_write>
+      brelse(bp);
+801031de:	89 1c 24             	mov    %ebx,(%esp)
+801031e1:	e8 ba d2 ff ff       	call   801004a0 <brelse>
+    for(i = 0; i < run; i++, tot+=m, off+=m, src+=m){
+801031e6:	01 7d d4             	add    %edi,-0x2c(%ebp)
+801031e9:	83 c4 10             	add    $0x10,%esp
+801031ec:	01 7d d0             	add    %edi,-0x30(%ebp)
+801031ef:	01 7d cc             	add    %edi,-0x34(%ebp)
+801031f2:	39 75 bc             	cmp    %esi,-0x44(%ebp)
+801031f5:	74 71                	je     80103268 <writei+0x188>
+      m = min(n - tot, BSIZE - off%BSIZE);
+801031f7:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+801031fa:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+801031fd:	ba 00 02 00 00       	mov    $0x200,%edx
+80103202:	8b 45 c0             	mov    -0x40(%ebp),%eax
+80103205:	81 e1 ff 01 00 00    	and    $0x1ff,%ecx
+8010320b:	29 f8                	sub    %edi,%eax
+8010320d:	29 ca                	sub    %ecx,%edx
+8010320f:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+80103212:	39 c2                	cmp    %eax,%edx
+80103214:	0f 46 c2             	cmovbe %edx,%eax
+80103217:	89 c7                	mov    %eax,%edi
+        bp = bclaim(ip->dev, addr + i);
+80103219:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+8010321c:	8b 00                	mov    (%eax),%eax
+      if(m == BSIZE)
+8010321e:	81 ff 00 02 00 00    	cmp    $0x200,%edi
+80103224:	75 8a                	jne    801031b0 <writei+0xd0>
+        bp = bclaim(ip->dev, addr + i);
+80103226:	83 ec 08             	sub    $0x8,%esp
+80103229:	56                   	push   %esi
+8010322a:	50                   	push   %eax
+8010322b:	e8 70 d1 ff ff       	call   801003a0 <bclaim>
+80103230:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+80103233:	83 c4 10             	add    $0x10,%esp
+80103236:	89 c3                	mov    %eax,%ebx
+80103238:	eb 88                	jmp    801031c2 <writei+0xe2>
+8010323a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return emap(ip, bn, max, run);
+80103240:	83 ec 0c             	sub    $0xc,%esp
+80103243:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80103246:	50                   	push   %eax
+80103247:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+8010324a:	e8 11 f2 ff ff       	call   80102460 <emap>
+    if(addr == 0)
+8010324f:	83 c4 10             	add    $0x10,%esp
+    return emap(ip, bn, max, run);
+80103252:	89 c6                	mov    %eax,%esi
+    if(addr == 0)
+80103254:	85 c0                	test   %eax,%eax
+80103256:	74 1c                	je     80103274 <writei+0x194>
+    for(i = 0; i < run; i++, tot+=m, off+=m, src+=m){
+80103258:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010325b:	85 d2                	test   %edx,%edx
+8010325d:	0f 85 41 ff ff ff    	jne    801031a4 <writei+0xc4>
+80103263:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103267:	90                   	nop
+  for(tot=0; tot<n; ){
+80103268:	8b 75 c0             	mov    -0x40(%ebp),%esi
+8010326b:	39 75 d4             	cmp    %esi,-0x2c(%ebp)
+8010326e:	0f 82 dc fe ff ff    	jb     80103150 <writei+0x70>
+  if(tot > 0 && off > ip->size){
+80103274:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80103277:	85 c0                	test   %eax,%eax
+80103279:	74 16                	je     80103291 <writei+0x1b1>
+8010327b:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+8010327e:	8b 75 d0             	mov    -0x30(%ebp),%esi
+80103281:	39 70 7c             	cmp    %esi,0x7c(%eax)
+80103284:	72 36                	jb     801032bc <writei+0x1dc>
+  return tot;
+80103286:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+}
+80103289:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010328c:	5b                   	pop    %ebx
+8010328d:	5e                   	pop    %esi
+8010328e:	5f                   	pop    %edi
+8010328f:	5d                   	pop    %ebp
+80103290:	c3                   	ret
+80103291:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    addr = bmaprun(ip, off/BSIZE, NBLOCKS(off, n-tot), &run);
+80103294:	31 c0                	xor    %eax,%eax
+}
+80103296:	5b                   	pop    %ebx
+80103297:	5e                   	pop    %esi
+80103298:	5f                   	pop    %edi
+80103299:	5d                   	pop    %ebp
+8010329a:	c3                   	ret
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+8010329b:	0f bf 40 72          	movswl 0x72(%eax),%eax
+8010329f:	66 83 f8 09          	cmp    $0x9,%ax
+801032a3:	77 2e                	ja     801032d3 <writei+0x1f3>
+801032a5:	8b 04 c5 24 73 20 80 	mov    -0x7fdf8cdc(,%eax,8),%eax
+801032ac:	85 c0                	test   %eax,%eax
+801032ae:	74 23                	je     801032d3 <writei+0x1f3>
+    return devsw[ip->major].write(ip, src, n);
+801032b0:	89 75 10             	mov    %esi,0x10(%ebp)
+}
+801032b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801032b6:	5b                   	pop    %ebx
+801032b7:	5e                   	pop    %esi
+801032b8:	5f                   	pop    %edi
+801032b9:	5d                   	pop    %ebp
+    return devsw[ip->major].write(ip, src, n);
+801032ba:	ff e0                	jmp    *%eax
+    ip->size = off;
+801032bc:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+801032bf:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    iupdate(ip);
+801032c2:	83 ec 0c             	sub    $0xc,%esp
+    ip->size = off;
+801032c5:	89 70 7c             	mov    %esi,0x7c(%eax)
+    iupdate(ip);
+801032c8:	50                   	push   %eax
+801032c9:	e8 e2 f5 ff ff       	call   801028b0 <iupdate>
+801032ce:	83 c4 10             	add    $0x10,%esp
+801032d1:	eb b3                	jmp    80103286 <writei+0x1a6>
+      return -1;
+801032d3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801032d8:	eb af                	jmp    80103289 <writei+0x1a9>
+801032da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801032e0 <writeiblocks>:
+{
+801032e0:	55                   	push   %ebp
+801032e1:	89 e5                	mov    %esp,%ebp
+801032e3:	57                   	push   %edi
+801032e4:	56                   	push   %esi
+801032e5:	53                   	push   %ebx
+801032e6:	83 ec 1c             	sub    $0x1c,%esp
+  if(ip->type == T_DEV || n == 0)
+801032e9:	8b 55 08             	mov    0x8(%ebp),%edx
+{
+801032ec:	8b 45 10             	mov    0x10(%ebp),%eax
+  if(ip->type == T_DEV || n == 0)
+801032ef:	66 83 7a 70 03       	cmpw   $0x3,0x70(%edx)
+801032f4:	0f 84 86 00 00 00    	je     80103380 <writeiblocks+0xa0>
+801032fa:	85 c0                	test   %eax,%eax
+801032fc:	0f 84 7e 00 00 00    	je     80103380 <writeiblocks+0xa0>
+  b0 = off / BSIZE;
+80103302:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  b1 = (off + n - 1) / BSIZE;
+80103305:	8b 75 0c             	mov    0xc(%ebp),%esi
+  lo = NDIRECT;
+80103308:	ba 0a 00 00 00       	mov    $0xa,%edx
+  b0 = off / BSIZE;
+8010330d:	c1 ef 09             	shr    $0x9,%edi
+  b1 = (off + n - 1) / BSIZE;
+80103310:	8d 44 06 ff          	lea    -0x1(%esi,%eax,1),%eax
+80103314:	be 03 00 00 00       	mov    $0x3,%esi
+  b0 = off / BSIZE;
+80103319:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  nmap = 0;
+8010331c:	31 ff                	xor    %edi,%edi
+  b1 = (off + n - 1) / BSIZE;
+8010331e:	c1 e8 09             	shr    $0x9,%eax
+  lo = NDIRECT;
+80103321:	89 f1                	mov    %esi,%ecx
+80103323:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  b1 = (off + n - 1) / BSIZE;
+80103326:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(level = 1, span = NINDIRECT; level <= 3; level++, span *= NINDIRECT){
+80103329:	b8 80 00 00 00       	mov    $0x80,%eax
+  lo = NDIRECT;
+8010332e:	89 c6                	mov    %eax,%esi
+80103330:	89 c8                	mov    %ecx,%eax
+    if(b0 < lo + span && b1 >= lo)
+80103332:	89 d1                	mov    %edx,%ecx
+80103334:	01 f2                	add    %esi,%edx
+80103336:	39 4d f0             	cmp    %ecx,-0x10(%ebp)
+80103339:	72 05                	jb     80103340 <writeiblocks+0x60>
+8010333b:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+8010333e:	72 50                	jb     80103390 <writeiblocks+0xb0>
+  for(level = 1, span = NINDIRECT; level <= 3; level++, span *= NINDIRECT){
+80103340:	c1 e6 07             	shl    $0x7,%esi
+80103343:	83 e8 01             	sub    $0x1,%eax
+80103346:	75 ea                	jne    80103332 <writeiblocks+0x52>
+  nalloc = b1 - b0 + 1 + nmap;
+80103348:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+8010334b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+8010334e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+80103351:	29 c2                	sub    %eax,%edx
+80103353:	85 ff                	test   %edi,%edi
+80103355:	b8 01 00 00 00       	mov    $0x1,%eax
+8010335a:	0f 45 c7             	cmovne %edi,%eax
+8010335d:	8d 54 02 01          	lea    0x1(%edx,%eax,1),%edx
+  nbmap = (sb.size + BPB - 1) / BPB;
+80103361:	a1 a0 96 20 80       	mov    0x802096a0,%eax
+80103366:	05 ff 0f 00 00       	add    $0xfff,%eax
+8010336b:	c1 e8 0c             	shr    $0xc,%eax
+  return nalloc + min(nalloc, nbmap) + 1;
+8010336e:	39 d0                	cmp    %edx,%eax
+80103370:	0f 47 c2             	cmova  %edx,%eax
+}
+80103373:	83 c4 1c             	add    $0x1c,%esp
+80103376:	5b                   	pop    %ebx
+80103377:	5e                   	pop    %esi
+  return nalloc + min(nalloc, nbmap) + 1;
+80103378:	8d 44 02 01          	lea    0x1(%edx,%eax,1),%eax
+}
+8010337c:	5f                   	pop    %edi
+8010337d:	5d                   	pop    %ebp
+8010337e:	c3                   	ret
+8010337f:	90                   	nop
+80103380:	83 c4 1c             	add    $0x1c,%esp
+    return 0;
+80103383:	31 c0                	xor    %eax,%eax
+}
+80103385:	5b                   	pop    %ebx
+80103386:	5e                   	pop    %esi
+80103387:	5f                   	pop    %edi
+80103388:	5d                   	pop    %ebp
+80103389:	c3                   	ret
+8010338a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      for(s = span; s > 1; s /= NINDIRECT)
+80103390:	83 fe 01             	cmp    $0x1,%esi
+80103393:	76 ab                	jbe    80103340 <writeiblocks+0x60>
+        nmap += (min(b1, lo+span-1) - lo)/s - (b0 > lo ? b0 - lo : 0)/s + 1;
+80103395:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+80103398:	89 55 e0             	mov    %edx,-0x20(%ebp)
+8010339b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+8010339e:	89 df                	mov    %ebx,%edi
+801033a0:	89 75 dc             	mov    %esi,-0x24(%ebp)
+801033a3:	29 cf                	sub    %ecx,%edi
+801033a5:	39 d9                	cmp    %ebx,%ecx
+801033a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+801033ac:	0f 42 df             	cmovb  %edi,%ebx
+801033af:	8b 7d f0             	mov    -0x10(%ebp),%edi
+801033b2:	89 5d e8             	mov    %ebx,-0x18(%ebp)
+801033b5:	8d 5a ff             	lea    -0x1(%edx),%ebx
+801033b8:	39 fb                	cmp    %edi,%ebx
+801033ba:	0f 47 df             	cmova  %edi,%ebx
+801033bd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801033c0:	29 cb                	sub    %ecx,%ebx
+801033c2:	89 f1                	mov    %esi,%ecx
+801033c4:	89 de                	mov    %ebx,%esi
+801033c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801033cd:	8d 76 00             	lea    0x0(%esi),%esi
+801033d0:	89 f0                	mov    %esi,%eax
+801033d2:	31 d2                	xor    %edx,%edx
+801033d4:	f7 f1                	div    %ecx
+801033d6:	31 d2                	xor    %edx,%edx
+801033d8:	8d 58 01             	lea    0x1(%eax),%ebx
+801033db:	8b 45 e8             	mov    -0x18(%ebp),%eax
+801033de:	f7 f1                	div    %ecx
+      for(s = span; s > 1; s /= NINDIRECT)
+801033e0:	c1 e9 07             	shr    $0x7,%ecx
+        nmap += (min(b1, lo+span-1) - lo)/s - (b0 > lo ? b0 - lo : 0)/s + 1;
+801033e3:	29 c3                	sub    %eax,%ebx
+801033e5:	01 df                	add    %ebx,%edi
+      for(s = span; s > 1; s /= NINDIRECT)
+801033e7:	83 f9 01             	cmp    $0x1,%ecx
+801033ea:	77 e4                	ja     801033d0 <writeiblocks+0xf0>
+801033ec:	8b 55 e0             	mov    -0x20(%ebp),%edx
+801033ef:	8b 75 dc             	mov    -0x24(%ebp),%esi
+801033f2:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+801033f5:	8b 45 d8             	mov    -0x28(%ebp),%eax
+801033f8:	e9 43 ff ff ff       	jmp    80103340 <writeiblocks+0x60>
+801033fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80103400 <namecmp>:
+{
+80103400:	55                   	push   %ebp
+80103401:	89 e5                	mov    %esp,%ebp
+80103403:	83 ec 0c             	sub    $0xc,%esp
+  return strncmp(s, t, DIRSIZ);
+80103406:	6a 0e                	push   $0xe
+80103408:	ff 75 0c             	push   0xc(%ebp)
+8010340b:	ff 75 08             	push   0x8(%ebp)
+8010340e:	e8 7d 51 00 00       	call   80108590 <strncmp>
+}
+80103413:	c9                   	leave
+80103414:	c3                   	ret
+80103415:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010341c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80103420 <dcinvalidate>:
+{
+80103420:	55                   	push   %ebp
+80103421:	89 e5                	mov    %esp,%ebp
+80103423:	57                   	push   %edi
+80103424:	56                   	push   %esi
+80103425:	53                   	push   %ebx
+80103426:	83 ec 28             	sub    $0x28,%esp
+80103429:	8b 7d 08             	mov    0x8(%ebp),%edi
+8010342c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  acquirewrite(&dcache.lock);
+8010342f:	68 80 73 20 80       	push   $0x80207380
+80103434:	e8 97 4e 00 00       	call   801082d0 <acquirewrite>
+  h = dev*31 + dinum;
+80103439:	8b 17                	mov    (%edi),%edx
+  e = dcset(dp->dev, dp->inum, name);
+8010343b:	8b 77 04             	mov    0x4(%edi),%esi
+  h = dev*31 + dinum;
+8010343e:	89 7d e0             	mov    %edi,-0x20(%ebp)
+80103441:	89 d9                	mov    %ebx,%ecx
+80103443:	83 c4 10             	add    $0x10,%esp
+80103446:	89 df                	mov    %ebx,%edi
+80103448:	89 d0                	mov    %edx,%eax
+8010344a:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+8010344d:	c1 e0 05             	shl    $0x5,%eax
+80103450:	29 d0                	sub    %edx,%eax
+80103452:	8d 53 0e             	lea    0xe(%ebx),%edx
+80103455:	01 f0                	add    %esi,%eax
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80103457:	89 d6                	mov    %edx,%esi
+80103459:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103460:	0f b6 19             	movzbl (%ecx),%ebx
+80103463:	84 db                	test   %bl,%bl
+80103465:	74 13                	je     8010347a <dcinvalidate+0x5a>
+    h = h*31 + (uchar)name[i];
+80103467:	89 c2                	mov    %eax,%edx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80103469:	83 c1 01             	add    $0x1,%ecx
+    h = h*31 + (uchar)name[i];
+8010346c:	c1 e2 05             	shl    $0x5,%edx
+8010346f:	29 c2                	sub    %eax,%edx
+80103471:	0f b6 c3             	movzbl %bl,%eax
+80103474:	01 d0                	add    %edx,%eax
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80103476:	39 f1                	cmp    %esi,%ecx
+80103478:	75 e6                	jne    80103460 <dcinvalidate+0x40>
+  return dcache.ent[h % NDCSET];
+8010347a:	83 e0 3f             	and    $0x3f,%eax
+8010347d:	89 fb                	mov    %edi,%ebx
+8010347f:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80103482:	8b 7d e0             	mov    -0x20(%ebp),%edi
+80103485:	c1 e0 07             	shl    $0x7,%eax
+  for(i = 0; i < DCWAYS; i++, e++)
+80103488:	8d 88 94 73 20 80    	lea    -0x7fdf8c6c(%eax),%ecx
+8010348e:	8d 90 14 74 20 80    	lea    -0x7fdf8bec(%eax),%edx
+    if(e->dinum == dp->inum && e->dev == dp->dev &&
+80103494:	39 71 fc             	cmp    %esi,-0x4(%ecx)
+80103497:	74 16                	je     801034af <dcinvalidate+0x8f>
+80103499:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < DCWAYS; i++, e++)
+801034a0:	83 c1 20             	add    $0x20,%ecx
+801034a3:	39 ca                	cmp    %ecx,%edx
+801034a5:	74 3c                	je     801034e3 <dcinvalidate+0xc3>
+    if(e->dinum == dp->inum && e->dev == dp->dev &&
+801034a7:	8b 77 04             	mov    0x4(%edi),%esi
+801034aa:	39 71 fc             	cmp    %esi,-0x4(%ecx)
+801034ad:	75 f1                	jne    801034a0 <dcinvalidate+0x80>
+801034af:	8b 07                	mov    (%edi),%eax
+801034b1:	39 41 f8             	cmp    %eax,-0x8(%ecx)
+801034b4:	75 ea                	jne    801034a0 <dcinvalidate+0x80>
+  return strncmp(s, t, DIRSIZ);
+801034b6:	83 ec 04             	sub    $0x4,%esp
+801034b9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+801034bc:	6a 0e                	push   $0xe
+801034be:	53                   	push   %ebx
+801034bf:	51                   	push   %ecx
+801034c0:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+801034c3:	e8 c8 50 00 00       	call   80108590 <strncmp>
+    if(e->dinum == dp->inum && e->dev == dp->dev &&
+801034c8:	83 c4 10             	add    $0x10,%esp
+801034cb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+801034ce:	8b 55 e0             	mov    -0x20(%ebp),%edx
+801034d1:	85 c0                	test   %eax,%eax
+801034d3:	75 cb                	jne    801034a0 <dcinvalidate+0x80>
+      e->dinum = 0;
+801034d5:	c7 41 fc 00 00 00 00 	movl   $0x0,-0x4(%ecx)
+  for(i = 0; i < DCWAYS; i++, e++)
+801034dc:	83 c1 20             	add    $0x20,%ecx
+801034df:	39 ca                	cmp    %ecx,%edx
+801034e1:	75 c4                	jne    801034a7 <dcinvalidate+0x87>
+  releasewrite(&dcache.lock);
+801034e3:	c7 45 08 80 73 20 80 	movl   $0x80207380,0x8(%ebp)
+}
+801034ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801034ed:	5b                   	pop    %ebx
+801034ee:	5e                   	pop    %esi
+801034ef:	5f                   	pop    %edi
+801034f0:	5d                   	pop    %ebp
+  releasewrite(&dcache.lock);
+801034f1:	e9 5a 4f 00 00       	jmp    80108450 <releasewrite>
+801034f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801034fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80103500 <dxlink>:
+}
+
+// Add (name, inum) to the indexed directory dp.
+static int
+dxlink(struct inode *dp, char *name, uint inum)
+{
+80103500:	55                   	push   %ebp
+80103501:	89 e5                	mov    %esp,%ebp
+80103503:	57                   	push   %edi
+80103504:	56                   	push   %esi
+dxhash(char *name)
+{
+  uint h;
+  int i;
+
+  h = 2166136261U;
+80103505:	be c5 9d 1c 81       	mov    $0x811c9dc5,%esi
+8010350a:	53                   	push   %ebx
+8010350b:	89 d3                	mov    %edx,%ebx
+8010350d:	81 ec dc 00 00 00    	sub    $0xdc,%esp
+80103513:	89 85 44 ff ff ff    	mov    %eax,-0xbc(%ebp)
+80103519:	89 8d 3c ff ff ff    	mov    %ecx,-0xc4(%ebp)
+8010351f:	8d 4a 0e             	lea    0xe(%edx),%ecx
+80103522:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80103528:	0f b6 02             	movzbl (%edx),%eax
+8010352b:	84 c0                	test   %al,%al
+8010352d:	74 0f                	je     8010353e <dxlink+0x3e>
+    h = (h ^ (uchar)name[i]) * 16777619;
+8010352f:	31 c6                	xor    %eax,%esi
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80103531:	83 c2 01             	add    $0x1,%edx
+    h = (h ^ (uchar)name[i]) * 16777619;
+80103534:	69 f6 93 01 00 01    	imul   $0x1000193,%esi,%esi
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+8010353a:	39 ca                	cmp    %ecx,%edx
+8010353c:	75 ea                	jne    80103528 <dxlink+0x28>
+8010353e:	89 b5 40 ff ff ff    	mov    %esi,-0xc0(%ebp)
+80103544:	89 9d 38 ff ff ff    	mov    %ebx,-0xc8(%ebp)
+  uint h, leaf, path[2];
+  int i, r, slot[2], nlevel;
+
+  h = dxhash(name);
+  for(;;){
+    leaf = dxleaf(dp, h, path, slot, &nlevel);
+8010354a:	83 ec 08             	sub    $0x8,%esp
+8010354d:	8d 85 50 ff ff ff    	lea    -0xb0(%ebp),%eax
+80103553:	8d 8d 54 ff ff ff    	lea    -0xac(%ebp),%ecx
+80103559:	50                   	push   %eax
+8010355a:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+80103560:	50                   	push   %eax
+80103561:	8b bd 44 ff ff ff    	mov    -0xbc(%ebp),%edi
+80103567:	8b 95 40 ff ff ff    	mov    -0xc0(%ebp),%edx
+8010356d:	89 f8                	mov    %edi,%eax
+8010356f:	e8 ac e4 ff ff       	call   80101a20 <dxleaf>
+    bp = bread(dp->dev, bmap(dp, leaf));
+80103574:	89 c2                	mov    %eax,%edx
+    leaf = dxleaf(dp, h, path, slot, &nlevel);
+80103576:	89 85 34 ff ff ff    	mov    %eax,-0xcc(%ebp)
+    bp = bread(dp->dev, bmap(dp, leaf));
+8010357c:	89 f8                	mov    %edi,%eax
+8010357e:	e8 ad ea ff ff       	call   80102030 <bmap>
+80103583:	5e                   	pop    %esi
+80103584:	5a                   	pop    %edx
+80103585:	50                   	push   %eax
+80103586:	ff 37                	push   (%edi)
+80103588:	e8 d3 cd ff ff       	call   80100360 <bread>
+8010358d:	83 c4 10             	add    $0x10,%esp
+80103590:	89 c7                	mov    %eax,%edi
+    de = (struct dirent*)bp->data;
+    for(i = 0; i < DPB; i++){
+80103592:	8d 70 70             	lea    0x70(%eax),%esi
+80103595:	8d 90 70 02 00 00    	lea    0x270(%eax),%edx
+8010359b:	eb 0a                	jmp    801035a7 <dxlink+0xa7>
+8010359d:	8d 76 00             	lea    0x0(%esi),%esi
+801035a0:	83 c6 10             	add    $0x10,%esi
+801035a3:	39 d6                	cmp    %edx,%esi
+801035a5:	74 49                	je     801035f0 <dxlink+0xf0>
+      if(de[i].inum == 0){
+801035a7:	66 83 3e 00          	cmpw   $0x0,(%esi)
+801035ab:	75 f3                	jne    801035a0 <dxlink+0xa0>
+        strncpy(de[i].name, name, DIRSIZ);
+801035ad:	8b 9d 38 ff ff ff    	mov    -0xc8(%ebp),%ebx
+801035b3:	83 ec 04             	sub    $0x4,%esp
+801035b6:	8d 46 02             	lea    0x2(%esi),%eax
+801035b9:	6a 0e                	push   $0xe
+801035bb:	53                   	push   %ebx
+801035bc:	50                   	push   %eax
+801035bd:	e8 1e 50 00 00       	call   801085e0 <strncpy>
+        de[i].inum = inum;
+801035c2:	0f b7 85 3c ff ff ff 	movzwl -0xc4(%ebp),%eax
+801035c9:	66 89 06             	mov    %ax,(%esi)
+        log_write(bp);
+801035cc:	89 3c 24             	mov    %edi,(%esp)
+801035cf:	e8 1c 26 00 00       	call   80105bf0 <log_write>
+        brelse(bp);
+801035d4:	89 3c 24             	mov    %edi,(%esp)
+801035d7:	e8 c4 ce ff ff       	call   801004a0 <brelse>
+        return 0;
+801035dc:	83 c4 10             	add    $0x10,%esp
+801035df:	31 c0                	xor    %eax,%eax
+    if((r = dxroom(dp, path, slot, nlevel)) < 0)
+      return -1;
+    if(r == 0 && dxsplit(dp, leaf, h, path[nlevel-1], slot[nlevel-1]) < 0)
+      return -1;
+  }
+}
+801035e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801035e4:	5b                   	pop    %ebx
+801035e5:	5e                   	pop    %esi
+801035e6:	5f                   	pop    %edi
+801035e7:	5d                   	pop    %ebp
+801035e8:	c3                   	ret
+801035e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    brelse(bp);
+801035f0:	83 ec 0c             	sub    $0xc,%esp
+801035f3:	57                   	push   %edi
+801035f4:	e8 a7 ce ff ff       	call   801004a0 <brelse>
+    if((r = dxroom(dp, path, slot, nlevel)) < 0)
+801035f9:	8b b5 50 ff ff ff    	mov    -0xb0(%ebp),%esi
+  bp = bread(dp->dev, path[nlevel-1]);
+801035ff:	59                   	pop    %ecx
+80103600:	5b                   	pop    %ebx
+80103601:	ff b4 b5 50 ff ff ff 	push   -0xb0(%ebp,%esi,4)
+80103608:	8b bd 44 ff ff ff    	mov    -0xbc(%ebp),%edi
+8010360e:	ff 37                	push   (%edi)
+80103610:	e8 4b cd ff ff       	call   80100360 <bread>
+  full = ((struct dxnode*)bp->data)->count == NDXENTRY;
+80103615:	0f b7 58 72          	movzwl 0x72(%eax),%ebx
+  brelse(bp);
+80103619:	89 04 24             	mov    %eax,(%esp)
+8010361c:	e8 7f ce ff ff       	call   801004a0 <brelse>
+  if(!full)
+80103621:	83 c4 10             	add    $0x10,%esp
+80103624:	66 83 fb 3f          	cmp    $0x3f,%bx
+80103628:	0f 84 42 01 00 00    	je     80103770 <dxlink+0x270>
+    if(r == 0 && dxsplit(dp, leaf, h, path[nlevel-1], slot[nlevel-1]) < 0)
+8010362e:	83 ee 01             	sub    $0x1,%esi
+  bp = bread(dp->dev, bmap(dp, leaf));
+80103631:	8b 95 34 ff ff ff    	mov    -0xcc(%ebp),%edx
+    if(r == 0 && dxsplit(dp, leaf, h, path[nlevel-1], slot[nlevel-1]) < 0)
+80103637:	8b 84 b5 5c ff ff ff 	mov    -0xa4(%ebp,%esi,4),%eax
+8010363e:	89 85 2c ff ff ff    	mov    %eax,-0xd4(%ebp)
+80103644:	8b 84 b5 54 ff ff ff 	mov    -0xac(%ebp,%esi,4),%eax
+8010364b:	8d b5 64 ff ff ff    	lea    -0x9c(%ebp),%esi
+80103651:	89 85 28 ff ff ff    	mov    %eax,-0xd8(%ebp)
+  bp = bread(dp->dev, bmap(dp, leaf));
+80103657:	89 f8                	mov    %edi,%eax
+80103659:	e8 d2 e9 ff ff       	call   80102030 <bmap>
+8010365e:	83 ec 08             	sub    $0x8,%esp
+80103661:	50                   	push   %eax
+80103662:	ff 37                	push   (%edi)
+80103664:	e8 f7 cc ff ff       	call   80100360 <bread>
+  for(j = 0; j < DPB; j++)
+80103669:	83 c4 10             	add    $0x10,%esp
+8010366c:	89 85 30 ff ff ff    	mov    %eax,-0xd0(%ebp)
+80103672:	8d 78 72             	lea    0x72(%eax),%edi
+80103675:	8d 98 80 00 00 00    	lea    0x80(%eax),%ebx
+  h = 2166136261U;
+8010367b:	89 f9                	mov    %edi,%ecx
+8010367d:	ba c5 9d 1c 81       	mov    $0x811c9dc5,%edx
+80103682:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80103688:	0f b6 01             	movzbl (%ecx),%eax
+8010368b:	84 c0                	test   %al,%al
+8010368d:	74 12                	je     801036a1 <dxlink+0x1a1>
+    h = (h ^ (uchar)name[i]) * 16777619;
+8010368f:	0f b6 c0             	movzbl %al,%eax
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80103692:	83 c1 01             	add    $0x1,%ecx
+    h = (h ^ (uchar)name[i]) * 16777619;
+80103695:	31 d0                	xor    %edx,%eax
+80103697:	69 d0 93 01 00 01    	imul   $0x1000193,%eax,%edx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+8010369d:	39 cb                	cmp    %ecx,%ebx
+8010369f:	75 e7                	jne    80103688 <dxlink+0x188>
+    hash[j] = dxhash(de[j].name);
+801036a1:	89 16                	mov    %edx,(%esi)
+  for(j = 0; j < DPB; j++)
+801036a3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+801036a6:	83 c6 04             	add    $0x4,%esi
+801036a9:	83 c7 10             	add    $0x10,%edi
+801036ac:	83 c3 10             	add    $0x10,%ebx
+801036af:	39 c6                	cmp    %eax,%esi
+801036b1:	75 c8                	jne    8010367b <dxlink+0x17b>
+  hash[DPB] = h;
+801036b3:	8b bd 40 ff ff ff    	mov    -0xc0(%ebp),%edi
+801036b9:	8b 85 30 ff ff ff    	mov    -0xd0(%ebp),%eax
+  brelse(bp);
+801036bf:	83 ec 0c             	sub    $0xc,%esp
+  for(j = 1; j <= DPB; j++){
+801036c2:	be 01 00 00 00       	mov    $0x1,%esi
+  hash[DPB] = h;
+801036c7:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  brelse(bp);
+801036ca:	50                   	push   %eax
+801036cb:	e8 d0 cd ff ff       	call   801004a0 <brelse>
+801036d0:	83 c4 10             	add    $0x10,%esp
+801036d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801036d7:	90                   	nop
+    t = hash[j];
+801036d8:	8b 9c b5 64 ff ff ff 	mov    -0x9c(%ebp,%esi,4),%ebx
+801036df:	89 f0                	mov    %esi,%eax
+801036e1:	eb 14                	jmp    801036f7 <dxlink+0x1f7>
+801036e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801036e7:	90                   	nop
+      hash[k] = hash[k-1];
+801036e8:	89 94 85 68 ff ff ff 	mov    %edx,-0x98(%ebp,%eax,4)
+    for(k = j; k > 0 && hash[k-1] > t; k--)
+801036ef:	85 c0                	test   %eax,%eax
+801036f1:	0f 84 21 02 00 00    	je     80103918 <dxlink+0x418>
+801036f7:	89 c1                	mov    %eax,%ecx
+801036f9:	8d 40 ff             	lea    -0x1(%eax),%eax
+801036fc:	8b 94 85 64 ff ff ff 	mov    -0x9c(%ebp,%eax,4),%edx
+80103703:	39 d3                	cmp    %edx,%ebx
+80103705:	72 e1                	jb     801036e8 <dxlink+0x1e8>
+  for(j = 1; j <= DPB; j++){
+80103707:	83 c6 01             	add    $0x1,%esi
+    hash[k] = t;
+8010370a:	89 9c 8d 64 ff ff ff 	mov    %ebx,-0x9c(%ebp,%ecx,4)
+  for(j = 1; j <= DPB; j++){
+80103711:	83 fe 21             	cmp    $0x21,%esi
+80103714:	75 c2                	jne    801036d8 <dxlink+0x1d8>
+80103716:	8b 95 64 ff ff ff    	mov    -0x9c(%ebp),%edx
+  k = 0;
+8010371c:	31 c9                	xor    %ecx,%ecx
+  for(j = 1; j <= DPB; j++)
+8010371e:	b8 01 00 00 00       	mov    $0x1,%eax
+80103723:	eb 34                	jmp    80103759 <dxlink+0x259>
+80103725:	8d 76 00             	lea    0x0(%esi),%esi
+    if(hash[j-1] != hash[j] && (k == 0 || DIST(j, mid) < DIST(k, mid)))
+80103728:	be 10 00 00 00       	mov    $0x10,%esi
+8010372d:	8d 58 f0             	lea    -0x10(%eax),%ebx
+80103730:	8d 79 f0             	lea    -0x10(%ecx),%edi
+80103733:	29 c6                	sub    %eax,%esi
+80103735:	83 f8 11             	cmp    $0x11,%eax
+80103738:	0f 4d f3             	cmovge %ebx,%esi
+8010373b:	bb 10 00 00 00       	mov    $0x10,%ebx
+80103740:	29 cb                	sub    %ecx,%ebx
+80103742:	83 f9 11             	cmp    $0x11,%ecx
+80103745:	0f 4d df             	cmovge %edi,%ebx
+80103748:	39 de                	cmp    %ebx,%esi
+8010374a:	0f 4c c8             	cmovl  %eax,%ecx
+  for(j = 1; j <= DPB; j++)
+8010374d:	83 c0 01             	add    $0x1,%eax
+80103750:	83 f8 21             	cmp    $0x21,%eax
+80103753:	0f 84 c6 01 00 00    	je     8010391f <dxlink+0x41f>
+    if(hash[j-1] != hash[j] && (k == 0 || DIST(j, mid) < DIST(k, mid)))
+80103759:	89 d3                	mov    %edx,%ebx
+8010375b:	8b 94 85 64 ff ff ff 	mov    -0x9c(%ebp,%eax,4),%edx
+80103762:	39 d3                	cmp    %edx,%ebx
+80103764:	74 e7                	je     8010374d <dxlink+0x24d>
+80103766:	85 c9                	test   %ecx,%ecx
+80103768:	75 be                	jne    80103728 <dxlink+0x228>
+8010376a:	89 c1                	mov    %eax,%ecx
+8010376c:	eb df                	jmp    8010374d <dxlink+0x24d>
+8010376e:	66 90                	xchg   %ax,%ax
+    addr = balloc(dp->dev);
+80103770:	8b 85 44 ff ff ff    	mov    -0xbc(%ebp),%eax
+    bp = bread(dp->dev, path[0]);
+80103776:	8b bd 54 ff ff ff    	mov    -0xac(%ebp),%edi
+    addr = balloc(dp->dev);
+8010377c:	8b 00                	mov    (%eax),%eax
+  if(nlevel == 1){
+8010377e:	83 fe 01             	cmp    $0x1,%esi
+80103781:	0f 84 fe 00 00 00    	je     80103885 <dxlink+0x385>
+  bp = bread(dp->dev, path[0]);
+80103787:	83 ec 08             	sub    $0x8,%esp
+8010378a:	57                   	push   %edi
+8010378b:	50                   	push   %eax
+8010378c:	e8 cf cb ff ff       	call   80100360 <bread>
+  full = ((struct dxnode*)bp->data)->count == NDXENTRY;
+80103791:	0f b7 58 72          	movzwl 0x72(%eax),%ebx
+  brelse(bp);
+80103795:	89 04 24             	mov    %eax,(%esp)
+80103798:	e8 03 cd ff ff       	call   801004a0 <brelse>
+  if(full)
+8010379d:	83 c4 10             	add    $0x10,%esp
+801037a0:	66 83 fb 3f          	cmp    $0x3f,%bx
+801037a4:	0f 84 61 01 00 00    	je     8010390b <dxlink+0x40b>
+  addr = balloc(dp->dev);
+801037aa:	8b b5 44 ff ff ff    	mov    -0xbc(%ebp),%esi
+  return ballocn(dev, 0, &n);
+801037b0:	8d 8d 64 ff ff ff    	lea    -0x9c(%ebp),%ecx
+801037b6:	31 d2                	xor    %edx,%edx
+  uint n = 1;
+801037b8:	c7 85 64 ff ff ff 01 	movl   $0x1,-0x9c(%ebp)
+801037bf:	00 00 00 
+  addr = balloc(dp->dev);
+801037c2:	8b 06                	mov    (%esi),%eax
+  return ballocn(dev, 0, &n);
+801037c4:	e8 37 e6 ff ff       	call   80101e00 <ballocn>
+  bp = bread(dp->dev, path[1]);
+801037c9:	83 ec 08             	sub    $0x8,%esp
+  return ballocn(dev, 0, &n);
+801037cc:	89 85 34 ff ff ff    	mov    %eax,-0xcc(%ebp)
+  bp = bread(dp->dev, path[1]);
+801037d2:	ff b5 58 ff ff ff    	push   -0xa8(%ebp)
+801037d8:	ff 36                	push   (%esi)
+801037da:	e8 81 cb ff ff       	call   80100360 <bread>
+801037df:	89 c3                	mov    %eax,%ebx
+  nbp = bread(dp->dev, addr);
+801037e1:	58                   	pop    %eax
+801037e2:	5a                   	pop    %edx
+801037e3:	ff b5 34 ff ff ff    	push   -0xcc(%ebp)
+801037e9:	89 b5 44 ff ff ff    	mov    %esi,-0xbc(%ebp)
+801037ef:	ff 36                	push   (%esi)
+801037f1:	e8 6a cb ff ff       	call   80100360 <bread>
+  half = n->count / 2;
+801037f6:	0f b7 53 72          	movzwl 0x72(%ebx),%edx
+  nn->depth = 0;
+801037fa:	31 c9                	xor    %ecx,%ecx
+  memmove(nn->e, &n->e[half], nn->count * sizeof(n->e[0]));
+801037fc:	83 c4 0c             	add    $0xc,%esp
+  nn->depth = 0;
+801037ff:	66 89 48 70          	mov    %cx,0x70(%eax)
+  nbp = bread(dp->dev, addr);
+80103803:	89 c6                	mov    %eax,%esi
+  nn->count = n->count - half;
+80103805:	0f b7 43 72          	movzwl 0x72(%ebx),%eax
+  half = n->count / 2;
+80103809:	66 d1 ea             	shr    %dx
+  nn->count = n->count - half;
+8010380c:	29 d0                	sub    %edx,%eax
+8010380e:	66 89 46 72          	mov    %ax,0x72(%esi)
+  memmove(nn->e, &n->e[half], nn->count * sizeof(n->e[0]));
+80103812:	0f b7 c0             	movzwl %ax,%eax
+80103815:	c1 e0 03             	shl    $0x3,%eax
+80103818:	50                   	push   %eax
+80103819:	8d 42 01             	lea    0x1(%edx),%eax
+8010381c:	0f b7 c0             	movzwl %ax,%eax
+8010381f:	89 95 30 ff ff ff    	mov    %edx,-0xd0(%ebp)
+80103825:	8d 44 c3 70          	lea    0x70(%ebx,%eax,8),%eax
+80103829:	50                   	push   %eax
+8010382a:	8d 46 78             	lea    0x78(%esi),%eax
+8010382d:	50                   	push   %eax
+8010382e:	e8 ed 4c 00 00       	call   80108520 <memmove>
+  n->count = half;
+80103833:	8b 95 30 ff ff ff    	mov    -0xd0(%ebp),%edx
+80103839:	66 89 53 72          	mov    %dx,0x72(%ebx)
+  log_write(nbp);
+8010383d:	89 34 24             	mov    %esi,(%esp)
+80103840:	e8 ab 23 00 00       	call   80105bf0 <log_write>
+  log_write(bp);
+80103845:	89 1c 24             	mov    %ebx,(%esp)
+80103848:	e8 a3 23 00 00       	call   80105bf0 <log_write>
+  dxinsert(dp->dev, path[0], slot[0], nn->e[0].hash, addr);
+8010384d:	8b 85 44 ff ff ff    	mov    -0xbc(%ebp),%eax
+80103853:	5a                   	pop    %edx
+80103854:	89 fa                	mov    %edi,%edx
+80103856:	59                   	pop    %ecx
+80103857:	8b 00                	mov    (%eax),%eax
+80103859:	ff b5 34 ff ff ff    	push   -0xcc(%ebp)
+8010385f:	ff 76 78             	push   0x78(%esi)
+80103862:	8b 8d 5c ff ff ff    	mov    -0xa4(%ebp),%ecx
+80103868:	e8 63 e2 ff ff       	call   80101ad0 <dxinsert>
+  brelse(nbp);
+8010386d:	89 34 24             	mov    %esi,(%esp)
+80103870:	e8 2b cc ff ff       	call   801004a0 <brelse>
+  brelse(bp);
+80103875:	89 1c 24             	mov    %ebx,(%esp)
+80103878:	e8 23 cc ff ff       	call   801004a0 <brelse>
+8010387d:	83 c4 10             	add    $0x10,%esp
+    if(r == 0 && dxsplit(dp, leaf, h, path[nlevel-1], slot[nlevel-1]) < 0)
+80103880:	e9 c5 fc ff ff       	jmp    8010354a <dxlink+0x4a>
+  uint n = 1;
+80103885:	c7 85 64 ff ff ff 01 	movl   $0x1,-0x9c(%ebp)
+8010388c:	00 00 00 
+  return ballocn(dev, 0, &n);
+8010388f:	8d 8d 64 ff ff ff    	lea    -0x9c(%ebp),%ecx
+80103895:	31 d2                	xor    %edx,%edx
+80103897:	e8 64 e5 ff ff       	call   80101e00 <ballocn>
+    bp = bread(dp->dev, path[0]);
+8010389c:	83 ec 08             	sub    $0x8,%esp
+8010389f:	57                   	push   %edi
+801038a0:	8b bd 44 ff ff ff    	mov    -0xbc(%ebp),%edi
+  return ballocn(dev, 0, &n);
+801038a6:	89 c6                	mov    %eax,%esi
+    bp = bread(dp->dev, path[0]);
+801038a8:	ff 37                	push   (%edi)
+801038aa:	e8 b1 ca ff ff       	call   80100360 <bread>
+801038af:	89 c3                	mov    %eax,%ebx
+    nbp = bread(dp->dev, addr);
+801038b1:	58                   	pop    %eax
+801038b2:	5a                   	pop    %edx
+801038b3:	56                   	push   %esi
+801038b4:	ff 37                	push   (%edi)
+801038b6:	e8 a5 ca ff ff       	call   80100360 <bread>
+    memmove(nbp->data, bp->data, BSIZE);
+801038bb:	83 c4 0c             	add    $0xc,%esp
+    nbp = bread(dp->dev, addr);
+801038be:	89 c7                	mov    %eax,%edi
+    memmove(nbp->data, bp->data, BSIZE);
+801038c0:	8d 43 70             	lea    0x70(%ebx),%eax
+801038c3:	68 00 02 00 00       	push   $0x200
+801038c8:	50                   	push   %eax
+801038c9:	8d 47 70             	lea    0x70(%edi),%eax
+801038cc:	50                   	push   %eax
+801038cd:	e8 4e 4c 00 00       	call   80108520 <memmove>
+    n->depth = 1;
+801038d2:	c7 43 70 01 00 01 00 	movl   $0x10001,0x70(%ebx)
+    n->e[0].hash = 0;
+801038d9:	c7 43 78 00 00 00 00 	movl   $0x0,0x78(%ebx)
+    n->e[0].block = addr;
+801038e0:	89 73 7c             	mov    %esi,0x7c(%ebx)
+    log_write(nbp);
+801038e3:	89 3c 24             	mov    %edi,(%esp)
+801038e6:	e8 05 23 00 00       	call   80105bf0 <log_write>
+    log_write(bp);
+801038eb:	89 1c 24             	mov    %ebx,(%esp)
+801038ee:	e8 fd 22 00 00       	call   80105bf0 <log_write>
+    brelse(nbp);
+801038f3:	89 3c 24             	mov    %edi,(%esp)
+801038f6:	e8 a5 cb ff ff       	call   801004a0 <brelse>
+    brelse(bp);
+801038fb:	89 1c 24             	mov    %ebx,(%esp)
+801038fe:	e8 9d cb ff ff       	call   801004a0 <brelse>
+80103903:	83 c4 10             	add    $0x10,%esp
+80103906:	e9 3f fc ff ff       	jmp    8010354a <dxlink+0x4a>
+      return -1;
+8010390b:	83 c8 ff             	or     $0xffffffff,%eax
+8010390e:	e9 ce fc ff ff       	jmp    801035e1 <dxlink+0xe1>
+80103913:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103917:	90                   	nop
+80103918:	31 c9                	xor    %ecx,%ecx
+8010391a:	e9 e8 fd ff ff       	jmp    80103707 <dxlink+0x207>
+  if(k == 0)
+8010391f:	85 c9                	test   %ecx,%ecx
+80103921:	74 e8                	je     8010390b <dxlink+0x40b>
+  nleaf = dp->size / BSIZE;
+80103923:	8b b5 44 ff ff ff    	mov    -0xbc(%ebp),%esi
+  m = hash[k];
+80103929:	8b 84 8d 64 ff ff ff 	mov    -0x9c(%ebp,%ecx,4),%eax
+  nleaf = dp->size / BSIZE;
+80103930:	8b 7e 7c             	mov    0x7c(%esi),%edi
+  m = hash[k];
+80103933:	89 85 30 ff ff ff    	mov    %eax,-0xd0(%ebp)
+  nleaf = dp->size / BSIZE;
+80103939:	89 f0                	mov    %esi,%eax
+8010393b:	89 bd 24 ff ff ff    	mov    %edi,-0xdc(%ebp)
+80103941:	c1 ef 09             	shr    $0x9,%edi
+  addr = bmap(dp, nleaf);
+80103944:	89 fa                	mov    %edi,%edx
+  nleaf = dp->size / BSIZE;
+80103946:	89 bd 20 ff ff ff    	mov    %edi,-0xe0(%ebp)
+  addr = bmap(dp, nleaf);
+8010394c:	e8 df e6 ff ff       	call   80102030 <bmap>
+  iupdate(dp);
+80103951:	83 ec 0c             	sub    $0xc,%esp
+  dp->size += BSIZE;
+80103954:	81 46 7c 00 02 00 00 	addl   $0x200,0x7c(%esi)
+  iupdate(dp);
+8010395b:	56                   	push   %esi
+  addr = bmap(dp, nleaf);
+8010395c:	89 c3                	mov    %eax,%ebx
+  iupdate(dp);
+8010395e:	e8 4d ef ff ff       	call   801028b0 <iupdate>
+  bp = bread(dp->dev, bmap(dp, leaf));
+80103963:	8b 95 34 ff ff ff    	mov    -0xcc(%ebp),%edx
+80103969:	89 f0                	mov    %esi,%eax
+8010396b:	e8 c0 e6 ff ff       	call   80102030 <bmap>
+80103970:	5f                   	pop    %edi
+80103971:	5a                   	pop    %edx
+80103972:	50                   	push   %eax
+80103973:	ff 36                	push   (%esi)
+80103975:	e8 e6 c9 ff ff       	call   80100360 <bread>
+  nbp = bread(dp->dev, addr);
+8010397a:	59                   	pop    %ecx
+  bp = bread(dp->dev, bmap(dp, leaf));
+8010397b:	89 c7                	mov    %eax,%edi
+  nbp = bread(dp->dev, addr);
+8010397d:	58                   	pop    %eax
+8010397e:	53                   	push   %ebx
+8010397f:	ff 36                	push   (%esi)
+80103981:	8d 9f 80 00 00 00    	lea    0x80(%edi),%ebx
+  for(j = n = 0; j < DPB; j++){
+80103987:	31 f6                	xor    %esi,%esi
+  nbp = bread(dp->dev, addr);
+80103989:	e8 d2 c9 ff ff       	call   80100360 <bread>
+  for(j = n = 0; j < DPB; j++){
+8010398e:	89 bd 18 ff ff ff    	mov    %edi,-0xe8(%ebp)
+80103994:	83 c4 10             	add    $0x10,%esp
+  nbp = bread(dp->dev, addr);
+80103997:	89 85 1c ff ff ff    	mov    %eax,-0xe4(%ebp)
+  nde = (struct dirent*)nbp->data;
+8010399d:	83 c0 70             	add    $0x70,%eax
+801039a0:	89 85 24 ff ff ff    	mov    %eax,-0xdc(%ebp)
+  for(j = n = 0; j < DPB; j++){
+801039a6:	8d 87 80 02 00 00    	lea    0x280(%edi),%eax
+801039ac:	89 85 34 ff ff ff    	mov    %eax,-0xcc(%ebp)
+801039b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(dxhash(de[j].name) >= m){
+801039b8:	8d 7b f2             	lea    -0xe(%ebx),%edi
+  h = 2166136261U;
+801039bb:	ba c5 9d 1c 81       	mov    $0x811c9dc5,%edx
+  for(j = n = 0; j < DPB; j++){
+801039c0:	89 f9                	mov    %edi,%ecx
+801039c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+801039c8:	0f b6 01             	movzbl (%ecx),%eax
+801039cb:	84 c0                	test   %al,%al
+801039cd:	74 12                	je     801039e1 <dxlink+0x4e1>
+    h = (h ^ (uchar)name[i]) * 16777619;
+801039cf:	0f b6 c0             	movzbl %al,%eax
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+801039d2:	83 c1 01             	add    $0x1,%ecx
+    h = (h ^ (uchar)name[i]) * 16777619;
+801039d5:	31 d0                	xor    %edx,%eax
+801039d7:	69 d0 93 01 00 01    	imul   $0x1000193,%eax,%edx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+801039dd:	39 d9                	cmp    %ebx,%ecx
+801039df:	75 e7                	jne    801039c8 <dxlink+0x4c8>
+    if(dxhash(de[j].name) >= m){
+801039e1:	8b 85 30 ff ff ff    	mov    -0xd0(%ebp),%eax
+801039e7:	39 c2                	cmp    %eax,%edx
+801039e9:	73 6d                	jae    80103a58 <dxlink+0x558>
+  for(j = n = 0; j < DPB; j++){
+801039eb:	8b 85 34 ff ff ff    	mov    -0xcc(%ebp),%eax
+801039f1:	83 c3 10             	add    $0x10,%ebx
+801039f4:	39 c3                	cmp    %eax,%ebx
+801039f6:	75 c0                	jne    801039b8 <dxlink+0x4b8>
+  log_write(bp);
+801039f8:	8b bd 18 ff ff ff    	mov    -0xe8(%ebp),%edi
+801039fe:	83 ec 0c             	sub    $0xc,%esp
+80103a01:	57                   	push   %edi
+80103a02:	e8 e9 21 00 00       	call   80105bf0 <log_write>
+  log_write(nbp);
+80103a07:	8b 9d 1c ff ff ff    	mov    -0xe4(%ebp),%ebx
+80103a0d:	89 1c 24             	mov    %ebx,(%esp)
+80103a10:	e8 db 21 00 00       	call   80105bf0 <log_write>
+  brelse(nbp);
+80103a15:	89 1c 24             	mov    %ebx,(%esp)
+80103a18:	e8 83 ca ff ff       	call   801004a0 <brelse>
+  brelse(bp);
+80103a1d:	89 3c 24             	mov    %edi,(%esp)
+80103a20:	e8 7b ca ff ff       	call   801004a0 <brelse>
+  dxinsert(dp->dev, parent, i, m, nleaf);
+80103a25:	8b 85 44 ff ff ff    	mov    -0xbc(%ebp),%eax
+80103a2b:	5a                   	pop    %edx
+80103a2c:	59                   	pop    %ecx
+80103a2d:	8b 00                	mov    (%eax),%eax
+80103a2f:	ff b5 20 ff ff ff    	push   -0xe0(%ebp)
+80103a35:	ff b5 30 ff ff ff    	push   -0xd0(%ebp)
+80103a3b:	8b 8d 2c ff ff ff    	mov    -0xd4(%ebp),%ecx
+80103a41:	8b 95 28 ff ff ff    	mov    -0xd8(%ebp),%edx
+80103a47:	e8 84 e0 ff ff       	call   80101ad0 <dxinsert>
+  return 0;
+80103a4c:	83 c4 10             	add    $0x10,%esp
+80103a4f:	e9 f6 fa ff ff       	jmp    8010354a <dxlink+0x4a>
+80103a54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      dcinvalidate(dp, de[j].name);
+80103a58:	83 ec 08             	sub    $0x8,%esp
+80103a5b:	57                   	push   %edi
+      nde[n++] = de[j];
+80103a5c:	8d 7e 01             	lea    0x1(%esi),%edi
+80103a5f:	c1 e6 04             	shl    $0x4,%esi
+      dcinvalidate(dp, de[j].name);
+80103a62:	ff b5 44 ff ff ff    	push   -0xbc(%ebp)
+80103a68:	e8 b3 f9 ff ff       	call   80103420 <dcinvalidate>
+      nde[n++] = de[j];
+80103a6d:	8b 85 24 ff ff ff    	mov    -0xdc(%ebp),%eax
+80103a73:	8b 53 f0             	mov    -0x10(%ebx),%edx
+      memset(&de[j], 0, sizeof(de[j]));
+80103a76:	83 c4 0c             	add    $0xc,%esp
+      nde[n++] = de[j];
+80103a79:	01 f0                	add    %esi,%eax
+80103a7b:	89 fe                	mov    %edi,%esi
+80103a7d:	89 10                	mov    %edx,(%eax)
+80103a7f:	8b 53 f4             	mov    -0xc(%ebx),%edx
+80103a82:	89 50 04             	mov    %edx,0x4(%eax)
+80103a85:	8b 53 f8             	mov    -0x8(%ebx),%edx
+80103a88:	89 50 08             	mov    %edx,0x8(%eax)
+80103a8b:	8b 53 fc             	mov    -0x4(%ebx),%edx
+80103a8e:	89 50 0c             	mov    %edx,0xc(%eax)
+    if(dxhash(de[j].name) >= m){
+80103a91:	8d 43 f0             	lea    -0x10(%ebx),%eax
+      memset(&de[j], 0, sizeof(de[j]));
+80103a94:	6a 10                	push   $0x10
+80103a96:	6a 00                	push   $0x0
+80103a98:	50                   	push   %eax
+80103a99:	e8 f2 49 00 00       	call   80108490 <memset>
+80103a9e:	83 c4 10             	add    $0x10,%esp
+80103aa1:	e9 45 ff ff ff       	jmp    801039eb <dxlink+0x4eb>
+80103aa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103aad:	8d 76 00             	lea    0x0(%esi),%esi
+
+80103ab0 <dirlookup>:
+// Look for a directory entry in a directory.
+// If found, set *poff to byte offset of entry.
+// Caller must hold dp->lock, shared or exclusive.
+struct inode*
+dirlookup(struct inode *dp, char *name, uint *poff)
+{
+80103ab0:	55                   	push   %ebp
+80103ab1:	89 e5                	mov    %esp,%ebp
+80103ab3:	57                   	push   %edi
+80103ab4:	56                   	push   %esi
+80103ab5:	53                   	push   %ebx
+80103ab6:	83 ec 3c             	sub    $0x3c,%esp
+80103ab9:	8b 45 0c             	mov    0xc(%ebp),%eax
+80103abc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80103abf:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+80103ac2:	8b 45 10             	mov    0x10(%ebp),%eax
+  uint off, inum, leaf;
+  struct dirent de, *dep;
+  struct buf *bp;
+  int i;
+
+  if(dp->type != T_DIR)
+80103ac5:	66 83 7b 70 01       	cmpw   $0x1,0x70(%ebx)
+{
+80103aca:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  if(dp->type != T_DIR)
+80103acd:	0f 85 98 02 00 00    	jne    80103d6b <dirlookup+0x2bb>
+  acquireread(&dcache.lock);
+80103ad3:	83 ec 0c             	sub    $0xc,%esp
+80103ad6:	68 80 73 20 80       	push   $0x80207380
+80103adb:	e8 a0 47 00 00       	call   80108280 <acquireread>
+  h = dev*31 + dinum;
+80103ae0:	8b 13                	mov    (%ebx),%edx
+80103ae2:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+80103ae5:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  e = dcset(dp->dev, dp->inum, name);
+80103ae8:	8b 7b 04             	mov    0x4(%ebx),%edi
+  h = dev*31 + dinum;
+80103aeb:	83 c4 10             	add    $0x10,%esp
+80103aee:	89 d0                	mov    %edx,%eax
+80103af0:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+80103af3:	c1 e0 05             	shl    $0x5,%eax
+80103af6:	29 d0                	sub    %edx,%eax
+80103af8:	8d 51 0e             	lea    0xe(%ecx),%edx
+80103afb:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+80103afe:	01 f8                	add    %edi,%eax
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80103b00:	89 d6                	mov    %edx,%esi
+80103b02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80103b08:	0f b6 19             	movzbl (%ecx),%ebx
+80103b0b:	84 db                	test   %bl,%bl
+80103b0d:	74 13                	je     80103b22 <dirlookup+0x72>
+    h = h*31 + (uchar)name[i];
+80103b0f:	89 c2                	mov    %eax,%edx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80103b11:	83 c1 01             	add    $0x1,%ecx
+    h = h*31 + (uchar)name[i];
+80103b14:	c1 e2 05             	shl    $0x5,%edx
+80103b17:	29 c2                	sub    %eax,%edx
+80103b19:	0f b6 c3             	movzbl %bl,%eax
+80103b1c:	01 d0                	add    %edx,%eax
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80103b1e:	39 f1                	cmp    %esi,%ecx
+80103b20:	75 e6                	jne    80103b08 <dirlookup+0x58>
+  return dcache.ent[h % NDCSET];
+80103b22:	83 e0 3f             	and    $0x3f,%eax
+80103b25:	8b 75 d0             	mov    -0x30(%ebp),%esi
+80103b28:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+80103b2b:	c1 e0 07             	shl    $0x7,%eax
+80103b2e:	8d 88 8c 73 20 80    	lea    -0x7fdf8c74(%eax),%ecx
+  for(i = 0; i < DCWAYS; i++, e++){
+80103b34:	8d 90 0c 74 20 80    	lea    -0x7fdf8bf4(%eax),%edx
+    if(e->dinum == dp->inum && e->dev == dp->dev &&
+80103b3a:	3b 79 04             	cmp    0x4(%ecx),%edi
+80103b3d:	74 10                	je     80103b4f <dirlookup+0x9f>
+80103b3f:	90                   	nop
+  for(i = 0; i < DCWAYS; i++, e++){
+80103b40:	83 c1 20             	add    $0x20,%ecx
+80103b43:	39 ca                	cmp    %ecx,%edx
+80103b45:	74 69                	je     80103bb0 <dirlookup+0x100>
+    if(e->dinum == dp->inum && e->dev == dp->dev &&
+80103b47:	8b 7b 04             	mov    0x4(%ebx),%edi
+80103b4a:	3b 79 04             	cmp    0x4(%ecx),%edi
+80103b4d:	75 f1                	jne    80103b40 <dirlookup+0x90>
+80103b4f:	8b 03                	mov    (%ebx),%eax
+80103b51:	39 01                	cmp    %eax,(%ecx)
+80103b53:	75 eb                	jne    80103b40 <dirlookup+0x90>
+  return strncmp(s, t, DIRSIZ);
+80103b55:	83 ec 04             	sub    $0x4,%esp
+       namecmp(e->name, name) == 0){
+80103b58:	8d 41 08             	lea    0x8(%ecx),%eax
+80103b5b:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  return strncmp(s, t, DIRSIZ);
+80103b5e:	6a 0e                	push   $0xe
+80103b60:	ff 75 d4             	push   -0x2c(%ebp)
+       namecmp(e->name, name) == 0){
+80103b63:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  return strncmp(s, t, DIRSIZ);
+80103b66:	50                   	push   %eax
+80103b67:	e8 24 4a 00 00       	call   80108590 <strncmp>
+    if(e->dinum == dp->inum && e->dev == dp->dev &&
+80103b6c:	83 c4 10             	add    $0x10,%esp
+80103b6f:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+80103b72:	8b 55 cc             	mov    -0x34(%ebp),%edx
+80103b75:	85 c0                	test   %eax,%eax
+80103b77:	75 c7                	jne    80103b40 <dirlookup+0x90>
+      releaseread(&dcache.lock);
+80103b79:	83 ec 0c             	sub    $0xc,%esp
+      *inum = e->inum;
+80103b7c:	8b 79 18             	mov    0x18(%ecx),%edi
+      *off = e->off;
+80103b7f:	8b 71 1c             	mov    0x1c(%ecx),%esi
+      releaseread(&dcache.lock);
+80103b82:	68 80 73 20 80       	push   $0x80207380
+80103b87:	e8 94 48 00 00       	call   80108420 <releaseread>
+    panic("dirlookup not DIR");
+
+  if(dcget(dp, name, &inum, &off)){
+    if(inum == 0)
+80103b8c:	83 c4 10             	add    $0x10,%esp
+80103b8f:	85 ff                	test   %edi,%edi
+80103b91:	0f 84 96 00 00 00    	je     80103c2d <dirlookup+0x17d>
+    off = leaf*BSIZE + i*sizeof(de);
+    brelse(bp);
+    dcput(dp, name, inum, off);
+    if(inum == 0)
+      return 0;
+    if(poff)
+80103b97:	8b 45 c8             	mov    -0x38(%ebp),%eax
+80103b9a:	85 c0                	test   %eax,%eax
+80103b9c:	74 02                	je     80103ba0 <dirlookup+0xf0>
+      *poff = off;
+80103b9e:	89 30                	mov    %esi,(%eax)
+    return iget(dp->dev, inum);
+80103ba0:	8b 03                	mov    (%ebx),%eax
+    }
+  }
+
+  dcput(dp, name, 0, 0);
+  return 0;
+}
+80103ba2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return iget(dp->dev, inum);
+80103ba5:	89 fa                	mov    %edi,%edx
+}
+80103ba7:	5b                   	pop    %ebx
+80103ba8:	5e                   	pop    %esi
+80103ba9:	5f                   	pop    %edi
+80103baa:	5d                   	pop    %ebp
+    return iget(dp->dev, inum);
+80103bab:	e9 a0 df ff ff       	jmp    80101b50 <iget>
+  releaseread(&dcache.lock);
+80103bb0:	83 ec 0c             	sub    $0xc,%esp
+80103bb3:	68 80 73 20 80       	push   $0x80207380
+80103bb8:	e8 63 48 00 00       	call   80108420 <releaseread>
+  if(dp->addrs[DXROOT]){
+80103bbd:	8b bb b0 00 00 00    	mov    0xb0(%ebx),%edi
+80103bc3:	83 c4 10             	add    $0x10,%esp
+80103bc6:	85 ff                	test   %edi,%edi
+80103bc8:	75 76                	jne    80103c40 <dirlookup+0x190>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+80103bca:	8b 43 7c             	mov    0x7c(%ebx),%eax
+80103bcd:	8d 75 d8             	lea    -0x28(%ebp),%esi
+80103bd0:	85 c0                	test   %eax,%eax
+80103bd2:	74 45                	je     80103c19 <dirlookup+0x169>
+80103bd4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80103bd8:	6a 10                	push   $0x10
+80103bda:	57                   	push   %edi
+80103bdb:	56                   	push   %esi
+80103bdc:	53                   	push   %ebx
+80103bdd:	e8 5e f3 ff ff       	call   80102f40 <readi>
+80103be2:	83 c4 10             	add    $0x10,%esp
+80103be5:	83 f8 10             	cmp    $0x10,%eax
+80103be8:	0f 85 70 01 00 00    	jne    80103d5e <dirlookup+0x2ae>
+    if(de.inum == 0)
+80103bee:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+80103bf3:	74 1c                	je     80103c11 <dirlookup+0x161>
+  return strncmp(s, t, DIRSIZ);
+80103bf5:	83 ec 04             	sub    $0x4,%esp
+80103bf8:	8d 45 da             	lea    -0x26(%ebp),%eax
+80103bfb:	6a 0e                	push   $0xe
+80103bfd:	50                   	push   %eax
+80103bfe:	ff 75 d4             	push   -0x2c(%ebp)
+80103c01:	e8 8a 49 00 00       	call   80108590 <strncmp>
+    if(namecmp(name, de.name) == 0){
+80103c06:	83 c4 10             	add    $0x10,%esp
+80103c09:	85 c0                	test   %eax,%eax
+80103c0b:	0f 84 1f 01 00 00    	je     80103d30 <dirlookup+0x280>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+80103c11:	83 c7 10             	add    $0x10,%edi
+80103c14:	3b 7b 7c             	cmp    0x7c(%ebx),%edi
+80103c17:	72 bf                	jb     80103bd8 <dirlookup+0x128>
+  dcput(dp, name, 0, 0);
+80103c19:	83 ec 0c             	sub    $0xc,%esp
+80103c1c:	6a 00                	push   $0x0
+    dcput(dp, name, inum, off);
+80103c1e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+80103c21:	31 c9                	xor    %ecx,%ecx
+80103c23:	89 d8                	mov    %ebx,%eax
+80103c25:	e8 96 e5 ff ff       	call   801021c0 <dcput>
+80103c2a:	83 c4 10             	add    $0x10,%esp
+      return 0;
+80103c2d:	31 c0                	xor    %eax,%eax
+}
+80103c2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103c32:	5b                   	pop    %ebx
+80103c33:	5e                   	pop    %esi
+80103c34:	5f                   	pop    %edi
+80103c35:	5d                   	pop    %ebp
+80103c36:	c3                   	ret
+80103c37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103c3e:	66 90                	xchg   %ax,%ax
+  h = 2166136261U;
+80103c40:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+80103c43:	ba c5 9d 1c 81       	mov    $0x811c9dc5,%edx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80103c48:	0f b6 06             	movzbl (%esi),%eax
+80103c4b:	84 c0                	test   %al,%al
+80103c4d:	74 0f                	je     80103c5e <dirlookup+0x1ae>
+    h = (h ^ (uchar)name[i]) * 16777619;
+80103c4f:	31 c2                	xor    %eax,%edx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80103c51:	83 c6 01             	add    $0x1,%esi
+    h = (h ^ (uchar)name[i]) * 16777619;
+80103c54:	69 d2 93 01 00 01    	imul   $0x1000193,%edx,%edx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80103c5a:	39 ce                	cmp    %ecx,%esi
+80103c5c:	75 ea                	jne    80103c48 <dirlookup+0x198>
+    leaf = dxleaf(dp, dxhash(name), 0, 0, 0);
+80103c5e:	83 ec 08             	sub    $0x8,%esp
+80103c61:	31 c9                	xor    %ecx,%ecx
+80103c63:	89 d8                	mov    %ebx,%eax
+    for(i = 0; i < DPB; i++)
+80103c65:	31 ff                	xor    %edi,%edi
+    leaf = dxleaf(dp, dxhash(name), 0, 0, 0);
+80103c67:	6a 00                	push   $0x0
+80103c69:	6a 00                	push   $0x0
+80103c6b:	e8 b0 dd ff ff       	call   80101a20 <dxleaf>
+    bp = bread(dp->dev, bmap(dp, leaf));
+80103c70:	89 c2                	mov    %eax,%edx
+    leaf = dxleaf(dp, dxhash(name), 0, 0, 0);
+80103c72:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    bp = bread(dp->dev, bmap(dp, leaf));
+80103c75:	89 d8                	mov    %ebx,%eax
+80103c77:	e8 b4 e3 ff ff       	call   80102030 <bmap>
+80103c7c:	5a                   	pop    %edx
+80103c7d:	59                   	pop    %ecx
+80103c7e:	50                   	push   %eax
+80103c7f:	ff 33                	push   (%ebx)
+80103c81:	e8 da c6 ff ff       	call   80100360 <bread>
+    for(i = 0; i < DPB; i++)
+80103c86:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+80103c89:	83 c4 10             	add    $0x10,%esp
+80103c8c:	8d 70 72             	lea    0x72(%eax),%esi
+80103c8f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+80103c92:	89 f3                	mov    %esi,%ebx
+80103c94:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+80103c97:	eb 12                	jmp    80103cab <dirlookup+0x1fb>
+80103c99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103ca0:	83 c7 01             	add    $0x1,%edi
+80103ca3:	83 c3 10             	add    $0x10,%ebx
+80103ca6:	83 ff 20             	cmp    $0x20,%edi
+80103ca9:	74 65                	je     80103d10 <dirlookup+0x260>
+      if(dep[i].inum != 0 && namecmp(name, dep[i].name) == 0)
+80103cab:	66 83 7b fe 00       	cmpw   $0x0,-0x2(%ebx)
+80103cb0:	74 ee                	je     80103ca0 <dirlookup+0x1f0>
+  return strncmp(s, t, DIRSIZ);
+80103cb2:	83 ec 04             	sub    $0x4,%esp
+80103cb5:	6a 0e                	push   $0xe
+80103cb7:	53                   	push   %ebx
+80103cb8:	56                   	push   %esi
+80103cb9:	e8 d2 48 00 00       	call   80108590 <strncmp>
+      if(dep[i].inum != 0 && namecmp(name, dep[i].name) == 0)
+80103cbe:	83 c4 10             	add    $0x10,%esp
+80103cc1:	85 c0                	test   %eax,%eax
+80103cc3:	75 db                	jne    80103ca0 <dirlookup+0x1f0>
+    off = leaf*BSIZE + i*sizeof(de);
+80103cc5:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+80103cc8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    brelse(bp);
+80103ccb:	83 ec 0c             	sub    $0xc,%esp
+    off = leaf*BSIZE + i*sizeof(de);
+80103cce:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+80103cd1:	c1 e6 05             	shl    $0x5,%esi
+80103cd4:	01 fe                	add    %edi,%esi
+    inum = i < DPB ? dep[i].inum : 0;
+80103cd6:	c1 e7 04             	shl    $0x4,%edi
+80103cd9:	0f b7 7c 38 70       	movzwl 0x70(%eax,%edi,1),%edi
+    brelse(bp);
+80103cde:	50                   	push   %eax
+    off = leaf*BSIZE + i*sizeof(de);
+80103cdf:	c1 e6 04             	shl    $0x4,%esi
+    brelse(bp);
+80103ce2:	e8 b9 c7 ff ff       	call   801004a0 <brelse>
+    dcput(dp, name, inum, off);
+80103ce7:	89 34 24             	mov    %esi,(%esp)
+80103cea:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+80103ced:	89 f9                	mov    %edi,%ecx
+80103cef:	89 d8                	mov    %ebx,%eax
+80103cf1:	e8 ca e4 ff ff       	call   801021c0 <dcput>
+    if(inum == 0)
+80103cf6:	83 c4 10             	add    $0x10,%esp
+80103cf9:	85 ff                	test   %edi,%edi
+80103cfb:	0f 85 96 fe ff ff    	jne    80103b97 <dirlookup+0xe7>
+80103d01:	e9 27 ff ff ff       	jmp    80103c2d <dirlookup+0x17d>
+80103d06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103d0d:	8d 76 00             	lea    0x0(%esi),%esi
+80103d10:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    brelse(bp);
+80103d13:	83 ec 0c             	sub    $0xc,%esp
+80103d16:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+80103d19:	50                   	push   %eax
+80103d1a:	e8 81 c7 ff ff       	call   801004a0 <brelse>
+    off = leaf*BSIZE + i*sizeof(de);
+80103d1f:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+80103d22:	83 c0 01             	add    $0x1,%eax
+80103d25:	c1 e0 09             	shl    $0x9,%eax
+    dcput(dp, name, inum, off);
+80103d28:	89 04 24             	mov    %eax,(%esp)
+80103d2b:	e9 ee fe ff ff       	jmp    80103c1e <dirlookup+0x16e>
+      if(poff)
+80103d30:	8b 45 c8             	mov    -0x38(%ebp),%eax
+80103d33:	85 c0                	test   %eax,%eax
+80103d35:	74 02                	je     80103d39 <dirlookup+0x289>
+        *poff = off;
+80103d37:	89 38                	mov    %edi,(%eax)
+      dcput(dp, name, inum, off);
+80103d39:	83 ec 0c             	sub    $0xc,%esp
+      inum = de.inum;
+80103d3c:	0f b7 75 d8          	movzwl -0x28(%ebp),%esi
+      dcput(dp, name, inum, off);
+80103d40:	89 d8                	mov    %ebx,%eax
+80103d42:	57                   	push   %edi
+80103d43:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+80103d46:	89 f1                	mov    %esi,%ecx
+80103d48:	e8 73 e4 ff ff       	call   801021c0 <dcput>
+      return iget(dp->dev, inum);
+80103d4d:	8b 03                	mov    (%ebx),%eax
+80103d4f:	89 f2                	mov    %esi,%edx
+80103d51:	e8 fa dd ff ff       	call   80101b50 <iget>
+80103d56:	83 c4 10             	add    $0x10,%esp
+80103d59:	e9 d1 fe ff ff       	jmp    80103c2f <dirlookup+0x17f>
+      panic("dirlookup read");
+80103d5e:	83 ec 0c             	sub    $0xc,%esp
+80103d61:	68 43 b8 10 80       	push   $0x8010b843
+80103d66:	e8 f5 c8 ff ff       	call   80100660 <panic>
+    panic("dirlookup not DIR");
+80103d6b:	83 ec 0c             	sub    $0xc,%esp
+80103d6e:	68 31 b8 10 80       	push   $0x8010b831
+80103d73:	e8 e8 c8 ff ff       	call   80100660 <panic>
+80103d78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103d7f:	90                   	nop
+
+80103d80 <namex>:
+// If parent != 0, return the inode for the parent and copy the final
+// path element into name, which must have room for DIRSIZ bytes.
+// Must be called inside a transaction since it calls iput().
+static struct inode*
+namex(char *path, int nameiparent, char *name)
+{
+80103d80:	55                   	push   %ebp
+80103d81:	89 e5                	mov    %esp,%ebp
+80103d83:	57                   	push   %edi
+80103d84:	56                   	push   %esi
+80103d85:	53                   	push   %ebx
+80103d86:	89 c3                	mov    %eax,%ebx
+80103d88:	83 ec 1c             	sub    $0x1c,%esp
+  struct inode *ip, *next;
+
+  if(*path == '/')
+80103d8b:	80 38 2f             	cmpb   $0x2f,(%eax)
+{
+80103d8e:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80103d91:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  if(*path == '/')
+80103d94:	0f 84 64 01 00 00    	je     80103efe <namex+0x17e>
+    ip = iget(ROOTDEV, ROOTINO);
+  else
+    ip = idup(myproc()->cwd);
+80103d9a:	e8 d1 30 00 00       	call   80106e70 <myproc>
+  acquireread(&icache.lock);
+80103d9f:	83 ec 0c             	sub    $0xc,%esp
+    ip = idup(myproc()->cwd);
+80103da2:	8b 78 68             	mov    0x68(%eax),%edi
+  acquireread(&icache.lock);
+80103da5:	68 e0 93 20 80       	push   $0x802093e0
+80103daa:	e8 d1 44 00 00       	call   80108280 <acquireread>
+  __sync_fetch_and_add(&ip->ref, 1);
+80103daf:	f0 83 47 08 01       	lock addl $0x1,0x8(%edi)
+  releaseread(&icache.lock);
+80103db4:	c7 04 24 e0 93 20 80 	movl   $0x802093e0,(%esp)
+80103dbb:	e8 60 46 00 00       	call   80108420 <releaseread>
+80103dc0:	83 c4 10             	add    $0x10,%esp
+80103dc3:	eb 06                	jmp    80103dcb <namex+0x4b>
+80103dc5:	8d 76 00             	lea    0x0(%esi),%esi
+    path++;
+80103dc8:	83 c3 01             	add    $0x1,%ebx
+  while(*path == '/')
+80103dcb:	0f b6 03             	movzbl (%ebx),%eax
+80103dce:	3c 2f                	cmp    $0x2f,%al
+80103dd0:	74 f6                	je     80103dc8 <namex+0x48>
+  if(*path == 0)
+80103dd2:	84 c0                	test   %al,%al
+80103dd4:	0f 84 06 01 00 00    	je     80103ee0 <namex+0x160>
+  while(*path != '/' && *path != 0)
+80103dda:	0f b6 03             	movzbl (%ebx),%eax
+80103ddd:	3c 2f                	cmp    $0x2f,%al
+80103ddf:	0f 84 10 01 00 00    	je     80103ef5 <namex+0x175>
+80103de5:	89 de                	mov    %ebx,%esi
+80103de7:	84 c0                	test   %al,%al
+80103de9:	0f 84 06 01 00 00    	je     80103ef5 <namex+0x175>
+80103def:	90                   	nop
+80103df0:	0f b6 46 01          	movzbl 0x1(%esi),%eax
+    path++;
+80103df4:	83 c6 01             	add    $0x1,%esi
+  while(*path != '/' && *path != 0)
+80103df7:	3c 2f                	cmp    $0x2f,%al
+80103df9:	74 04                	je     80103dff <namex+0x7f>
+80103dfb:	84 c0                	test   %al,%al
+80103dfd:	75 f1                	jne    80103df0 <namex+0x70>
+  len = path - s;
+80103dff:	89 f0                	mov    %esi,%eax
+80103e01:	29 d8                	sub    %ebx,%eax
+  if(len >= DIRSIZ)
+80103e03:	83 f8 0d             	cmp    $0xd,%eax
+80103e06:	0f 8e a4 00 00 00    	jle    80103eb0 <namex+0x130>
+    memmove(name, s, DIRSIZ);
+80103e0c:	83 ec 04             	sub    $0x4,%esp
+80103e0f:	6a 0e                	push   $0xe
+80103e11:	53                   	push   %ebx
+    path++;
+80103e12:	89 f3                	mov    %esi,%ebx
+    memmove(name, s, DIRSIZ);
+80103e14:	ff 75 e4             	push   -0x1c(%ebp)
+80103e17:	e8 04 47 00 00       	call   80108520 <memmove>
+80103e1c:	83 c4 10             	add    $0x10,%esp
+  while(*path == '/')
+80103e1f:	80 3e 2f             	cmpb   $0x2f,(%esi)
+80103e22:	75 0c                	jne    80103e30 <namex+0xb0>
+80103e24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    path++;
+80103e28:	83 c3 01             	add    $0x1,%ebx
+  while(*path == '/')
+80103e2b:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+80103e2e:	74 f8                	je     80103e28 <namex+0xa8>
+
+  while((path = skipelem(path, name)) != 0){
+    // Only reading ip, so share it with other lookups.
+    ilockread(ip);
+80103e30:	83 ec 0c             	sub    $0xc,%esp
+80103e33:	57                   	push   %edi
+80103e34:	e8 67 ec ff ff       	call   80102aa0 <ilockread>
+    if(ip->type != T_DIR){
+80103e39:	83 c4 10             	add    $0x10,%esp
+80103e3c:	66 83 7f 70 01       	cmpw   $0x1,0x70(%edi)
+80103e41:	0f 85 cd 00 00 00    	jne    80103f14 <namex+0x194>
+      iunlockread(ip);
+      iput(ip);
+      return 0;
+    }
+    if(nameiparent && *path == '\0'){
+80103e47:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80103e4a:	85 c0                	test   %eax,%eax
+80103e4c:	74 09                	je     80103e57 <namex+0xd7>
+80103e4e:	80 3b 00             	cmpb   $0x0,(%ebx)
+80103e51:	0f 84 ee 00 00 00    	je     80103f45 <namex+0x1c5>
+      // Stop one level early.
+      iunlockread(ip);
+      return ip;
+    }
+    next = dirlookup(ip, name, 0);
+80103e57:	83 ec 04             	sub    $0x4,%esp
+80103e5a:	6a 00                	push   $0x0
+80103e5c:	ff 75 e4             	push   -0x1c(%ebp)
+80103e5f:	57                   	push   %edi
+80103e60:	e8 4b fc ff ff       	call   80103ab0 <dirlookup>
+  if(ip == 0 || ip->lock.readers < 1 || ip->ref < 1)
+80103e65:	8b 4f 1c             	mov    0x1c(%edi),%ecx
+    next = dirlookup(ip, name, 0);
+80103e68:	83 c4 10             	add    $0x10,%esp
+80103e6b:	89 c6                	mov    %eax,%esi
+  if(ip == 0 || ip->lock.readers < 1 || ip->ref < 1)
+80103e6d:	85 c9                	test   %ecx,%ecx
+80103e6f:	0f 84 07 01 00 00    	je     80103f7c <namex+0x1fc>
+80103e75:	8b 57 08             	mov    0x8(%edi),%edx
+80103e78:	85 d2                	test   %edx,%edx
+80103e7a:	0f 8e fc 00 00 00    	jle    80103f7c <namex+0x1fc>
+  releasesleepread(&ip->lock);
+80103e80:	83 ec 0c             	sub    $0xc,%esp
+80103e83:	8d 47 18             	lea    0x18(%edi),%eax
+80103e86:	50                   	push   %eax
+80103e87:	e8 f4 3f 00 00       	call   80107e80 <releasesleepread>
+    iunlockread(ip);
+    iput(ip);
+80103e8c:	89 3c 24             	mov    %edi,(%esp)
+80103e8f:	e8 dc ec ff ff       	call   80102b70 <iput>
+    if(next == 0)
+80103e94:	83 c4 10             	add    $0x10,%esp
+80103e97:	85 f6                	test   %esi,%esi
+80103e99:	0f 84 9a 00 00 00    	je     80103f39 <namex+0x1b9>
+80103e9f:	89 f7                	mov    %esi,%edi
+  while(*path == '/')
+80103ea1:	e9 25 ff ff ff       	jmp    80103dcb <namex+0x4b>
+80103ea6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103ead:	8d 76 00             	lea    0x0(%esi),%esi
+    name[len] = 0;
+80103eb0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80103eb3:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+    memmove(name, s, len);
+80103eb6:	83 ec 04             	sub    $0x4,%esp
+80103eb9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+80103ebc:	50                   	push   %eax
+80103ebd:	53                   	push   %ebx
+    name[len] = 0;
+80103ebe:	89 f3                	mov    %esi,%ebx
+    memmove(name, s, len);
+80103ec0:	ff 75 e4             	push   -0x1c(%ebp)
+80103ec3:	e8 58 46 00 00       	call   80108520 <memmove>
+    name[len] = 0;
+80103ec8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+80103ecb:	83 c4 10             	add    $0x10,%esp
+80103ece:	c6 01 00             	movb   $0x0,(%ecx)
+80103ed1:	e9 49 ff ff ff       	jmp    80103e1f <namex+0x9f>
+80103ed6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103edd:	8d 76 00             	lea    0x0(%esi),%esi
+      return 0;
+    ip = next;
+  }
+  if(nameiparent){
+80103ee0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80103ee3:	85 c0                	test   %eax,%eax
+80103ee5:	0f 85 81 00 00 00    	jne    80103f6c <namex+0x1ec>
+    iput(ip);
+    return 0;
+  }
+  return ip;
+}
+80103eeb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103eee:	89 f8                	mov    %edi,%eax
+80103ef0:	5b                   	pop    %ebx
+80103ef1:	5e                   	pop    %esi
+80103ef2:	5f                   	pop    %edi
+80103ef3:	5d                   	pop    %ebp
+80103ef4:	c3                   	ret
+  while(*path != '/' && *path != 0)
+80103ef5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80103ef8:	89 de                	mov    %ebx,%esi
+80103efa:	31 c0                	xor    %eax,%eax
+80103efc:	eb b8                	jmp    80103eb6 <namex+0x136>
+    ip = iget(ROOTDEV, ROOTINO);
+80103efe:	ba 01 00 00 00       	mov    $0x1,%edx
+80103f03:	b8 01 00 00 00       	mov    $0x1,%eax
+80103f08:	e8 43 dc ff ff       	call   80101b50 <iget>
+80103f0d:	89 c7                	mov    %eax,%edi
+80103f0f:	e9 b7 fe ff ff       	jmp    80103dcb <namex+0x4b>
+  if(ip == 0 || ip->lock.readers < 1 || ip->ref < 1)
+80103f14:	8b 47 1c             	mov    0x1c(%edi),%eax
+80103f17:	85 c0                	test   %eax,%eax
+80103f19:	74 61                	je     80103f7c <namex+0x1fc>
+80103f1b:	8b 47 08             	mov    0x8(%edi),%eax
+80103f1e:	85 c0                	test   %eax,%eax
+80103f20:	7e 5a                	jle    80103f7c <namex+0x1fc>
+  releasesleepread(&ip->lock);
+80103f22:	83 ec 0c             	sub    $0xc,%esp
+80103f25:	8d 47 18             	lea    0x18(%edi),%eax
+80103f28:	50                   	push   %eax
+80103f29:	e8 52 3f 00 00       	call   80107e80 <releasesleepread>
+      iput(ip);
+80103f2e:	89 3c 24             	mov    %edi,(%esp)
+80103f31:	e8 3a ec ff ff       	call   80102b70 <iput>
+      return 0;
+80103f36:	83 c4 10             	add    $0x10,%esp
+80103f39:	31 ff                	xor    %edi,%edi
+}
+80103f3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103f3e:	89 f8                	mov    %edi,%eax
+80103f40:	5b                   	pop    %ebx
+80103f41:	5e                   	pop    %esi
+80103f42:	5f                   	pop    %edi
+80103f43:	5d                   	pop    %ebp
+80103f44:	c3                   	ret
+  if(ip == 0 || ip->lock.readers < 1 || ip->ref < 1)
+80103f45:	8b 77 1c             	mov    0x1c(%edi),%esi
+80103f48:	85 f6                	test   %esi,%esi
+80103f4a:	74 30                	je     80103f7c <namex+0x1fc>
+80103f4c:	8b 5f 08             	mov    0x8(%edi),%ebx
+80103f4f:	85 db                	test   %ebx,%ebx
+80103f51:	7e 29                	jle    80103f7c <namex+0x1fc>
+  releasesleepread(&ip->lock);
+80103f53:	8d 47 18             	lea    0x18(%edi),%eax
+80103f56:	83 ec 0c             	sub    $0xc,%esp
+80103f59:	50                   	push   %eax
+80103f5a:	e8 21 3f 00 00       	call   80107e80 <releasesleepread>
+}
+80103f5f:	83 c4 10             	add    $0x10,%esp
+}
+80103f62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103f65:	89 f8                	mov    %edi,%eax
+80103f67:	5b                   	pop    %ebx
+80103f68:	5e                   	pop    %esi
+80103f69:	5f                   	pop    %edi
+80103f6a:	5d                   	pop    %ebp
+80103f6b:	c3                   	ret
+    iput(ip);
+80103f6c:	83 ec 0c             	sub    $0xc,%esp
+80103f6f:	57                   	push   %edi
+      return 0;
+80103f70:	31 ff                	xor    %edi,%edi
+    iput(ip);
+80103f72:	e8 f9 eb ff ff       	call   80102b70 <iput>
+    return 0;
+80103f77:	83 c4 10             	add    $0x10,%esp
+80103f7a:	eb bf                	jmp    80103f3b <namex+0x1bb>
+    panic("iunlockread");
+80103f7c:	83 ec 0c             	sub    $0xc,%esp
+80103f7f:	68 25 b8 10 80       	push   $0x8010b825
+80103f84:	e8 d7 c6 ff ff       	call   80100660 <panic>
+80103f89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80103f90 <dirlink>:
+{
+80103f90:	55                   	push   %ebp
+80103f91:	89 e5                	mov    %esp,%ebp
+80103f93:	57                   	push   %edi
+80103f94:	56                   	push   %esi
+80103f95:	53                   	push   %ebx
+80103f96:	83 ec 40             	sub    $0x40,%esp
+80103f99:	8b 45 0c             	mov    0xc(%ebp),%eax
+80103f9c:	8b 55 10             	mov    0x10(%ebp),%edx
+80103f9f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80103fa2:	89 45 c0             	mov    %eax,-0x40(%ebp)
+80103fa5:	89 55 bc             	mov    %edx,-0x44(%ebp)
+  if((ip = dirlookup(dp, name, 0)) != 0){
+80103fa8:	6a 00                	push   $0x0
+80103faa:	50                   	push   %eax
+80103fab:	53                   	push   %ebx
+80103fac:	e8 ff fa ff ff       	call   80103ab0 <dirlookup>
+80103fb1:	83 c4 10             	add    $0x10,%esp
+80103fb4:	85 c0                	test   %eax,%eax
+80103fb6:	0f 85 28 01 00 00    	jne    801040e4 <dirlink+0x154>
+  dcinvalidate(dp, name);
+80103fbc:	83 ec 08             	sub    $0x8,%esp
+80103fbf:	ff 75 c0             	push   -0x40(%ebp)
+80103fc2:	53                   	push   %ebx
+80103fc3:	e8 58 f4 ff ff       	call   80103420 <dcinvalidate>
+  if(dp->addrs[DXROOT])
+80103fc8:	8b bb b0 00 00 00    	mov    0xb0(%ebx),%edi
+80103fce:	83 c4 10             	add    $0x10,%esp
+80103fd1:	85 ff                	test   %edi,%edi
+80103fd3:	0f 85 8f 00 00 00    	jne    80104068 <dirlink+0xd8>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+80103fd9:	8b 43 7c             	mov    0x7c(%ebx),%eax
+80103fdc:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+80103fe3:	8d 75 d8             	lea    -0x28(%ebp),%esi
+80103fe6:	85 c0                	test   %eax,%eax
+80103fe8:	75 11                	jne    80103ffb <dirlink+0x6b>
+80103fea:	eb 3e                	jmp    8010402a <dirlink+0x9a>
+80103fec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103ff0:	83 c7 10             	add    $0x10,%edi
+80103ff3:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+80103ff6:	3b 7b 7c             	cmp    0x7c(%ebx),%edi
+80103ff9:	73 1d                	jae    80104018 <dirlink+0x88>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80103ffb:	6a 10                	push   $0x10
+80103ffd:	57                   	push   %edi
+80103ffe:	56                   	push   %esi
+80103fff:	53                   	push   %ebx
+80104000:	e8 3b ef ff ff       	call   80102f40 <readi>
+80104005:	83 c4 10             	add    $0x10,%esp
+80104008:	83 f8 10             	cmp    $0x10,%eax
+8010400b:	0f 85 e9 00 00 00    	jne    801040fa <dirlink+0x16a>
+    if(de.inum == 0)
+80104011:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+80104016:	75 d8                	jne    80103ff0 <dirlink+0x60>
+  if(off == BSIZE && dp->size == BSIZE){
+80104018:	81 7d c4 00 02 00 00 	cmpl   $0x200,-0x3c(%ebp)
+8010401f:	75 09                	jne    8010402a <dirlink+0x9a>
+80104021:	81 7b 7c 00 02 00 00 	cmpl   $0x200,0x7c(%ebx)
+80104028:	74 52                	je     8010407c <dirlink+0xec>
+  strncpy(de.name, name, DIRSIZ);
+8010402a:	83 ec 04             	sub    $0x4,%esp
+8010402d:	8d 45 da             	lea    -0x26(%ebp),%eax
+80104030:	6a 0e                	push   $0xe
+80104032:	ff 75 c0             	push   -0x40(%ebp)
+80104035:	50                   	push   %eax
+80104036:	e8 a5 45 00 00       	call   801085e0 <strncpy>
+  de.inum = inum;
+8010403b:	0f b7 45 bc          	movzwl -0x44(%ebp),%eax
+8010403f:	66 89 45 d8          	mov    %ax,-0x28(%ebp)
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80104043:	6a 10                	push   $0x10
+80104045:	57                   	push   %edi
+80104046:	56                   	push   %esi
+80104047:	53                   	push   %ebx
+80104048:	e8 93 f0 ff ff       	call   801030e0 <writei>
+8010404d:	83 c4 20             	add    $0x20,%esp
+80104050:	83 f8 10             	cmp    $0x10,%eax
+80104053:	0f 85 ae 00 00 00    	jne    80104107 <dirlink+0x177>
+  return 0;
+80104059:	31 c0                	xor    %eax,%eax
+}
+8010405b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010405e:	5b                   	pop    %ebx
+8010405f:	5e                   	pop    %esi
+80104060:	5f                   	pop    %edi
+80104061:	5d                   	pop    %ebp
+80104062:	c3                   	ret
+80104063:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104067:	90                   	nop
+    return dxlink(dp, name, inum);
+80104068:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+8010406b:	8b 55 c0             	mov    -0x40(%ebp),%edx
+}
+8010406e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return dxlink(dp, name, inum);
+80104071:	89 d8                	mov    %ebx,%eax
+}
+80104073:	5b                   	pop    %ebx
+80104074:	5e                   	pop    %esi
+80104075:	5f                   	pop    %edi
+80104076:	5d                   	pop    %ebp
+    return dxlink(dp, name, inum);
+80104077:	e9 84 f4 ff ff       	jmp    80103500 <dxlink>
+  dp->addrs[DXROOT] = balloc(dp->dev);
+8010407c:	8b 03                	mov    (%ebx),%eax
+  return ballocn(dev, 0, &n);
+8010407e:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+80104081:	31 d2                	xor    %edx,%edx
+  uint n = 1;
+80104083:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  return ballocn(dev, 0, &n);
+8010408a:	e8 71 dd ff ff       	call   80101e00 <ballocn>
+  bp = bread(dp->dev, dp->addrs[DXROOT]);
+8010408f:	83 ec 08             	sub    $0x8,%esp
+  dp->addrs[DXROOT] = balloc(dp->dev);
+80104092:	89 83 b0 00 00 00    	mov    %eax,0xb0(%ebx)
+  bp = bread(dp->dev, dp->addrs[DXROOT]);
+80104098:	50                   	push   %eax
+80104099:	ff 33                	push   (%ebx)
+8010409b:	e8 c0 c2 ff ff       	call   80100360 <bread>
+  n->depth = 0;
+801040a0:	c7 40 70 00 00 01 00 	movl   $0x10000,0x70(%eax)
+  bp = bread(dp->dev, dp->addrs[DXROOT]);
+801040a7:	89 c6                	mov    %eax,%esi
+  n->e[0].hash = 0;
+801040a9:	c7 40 78 00 00 00 00 	movl   $0x0,0x78(%eax)
+  n->e[0].block = 0;
+801040b0:	c7 40 7c 00 00 00 00 	movl   $0x0,0x7c(%eax)
+  log_write(bp);
+801040b7:	89 04 24             	mov    %eax,(%esp)
+801040ba:	e8 31 1b 00 00       	call   80105bf0 <log_write>
+  brelse(bp);
+801040bf:	89 34 24             	mov    %esi,(%esp)
+801040c2:	e8 d9 c3 ff ff       	call   801004a0 <brelse>
+  iupdate(dp);
+801040c7:	89 1c 24             	mov    %ebx,(%esp)
+801040ca:	e8 e1 e7 ff ff       	call   801028b0 <iupdate>
+    return dxlink(dp, name, inum);
+801040cf:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+801040d2:	8b 55 c0             	mov    -0x40(%ebp),%edx
+801040d5:	89 d8                	mov    %ebx,%eax
+801040d7:	e8 24 f4 ff ff       	call   80103500 <dxlink>
+801040dc:	83 c4 10             	add    $0x10,%esp
+801040df:	e9 77 ff ff ff       	jmp    8010405b <dirlink+0xcb>
+    iput(ip);
+801040e4:	83 ec 0c             	sub    $0xc,%esp
+801040e7:	50                   	push   %eax
+801040e8:	e8 83 ea ff ff       	call   80102b70 <iput>
+    return -1;
+801040ed:	83 c4 10             	add    $0x10,%esp
+801040f0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801040f5:	e9 61 ff ff ff       	jmp    8010405b <dirlink+0xcb>
+      panic("dirlink read");
+801040fa:	83 ec 0c             	sub    $0xc,%esp
+801040fd:	68 52 b8 10 80       	push   $0x8010b852
+80104102:	e8 59 c5 ff ff       	call   80100660 <panic>
+    panic("dirlink");
+80104107:	83 ec 0c             	sub    $0xc,%esp
+8010410a:	68 5f b8 10 80       	push   $0x8010b85f
+8010410f:	e8 4c c5 ff ff       	call   80100660 <panic>
+80104114:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010411b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010411f:	90                   	nop
+
+80104120 <namei>:
+
+struct inode*
+namei(char *path)
+{
+80104120:	55                   	push   %ebp
+  char name[DIRSIZ];
+  return namex(path, 0, name);
+80104121:	31 d2                	xor    %edx,%edx
+{
+80104123:	89 e5                	mov    %esp,%ebp
+80104125:	83 ec 18             	sub    $0x18,%esp
+  return namex(path, 0, name);
+80104128:	8b 45 08             	mov    0x8(%ebp),%eax
+8010412b:	8d 4d ea             	lea    -0x16(%ebp),%ecx
+8010412e:	e8 4d fc ff ff       	call   80103d80 <namex>
+}
+80104133:	c9                   	leave
+80104134:	c3                   	ret
+80104135:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010413c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80104140 <nameiparent>:
+
+struct inode*
+nameiparent(char *path, char *name)
+{
+80104140:	55                   	push   %ebp
+  return namex(path, 1, name);
+80104141:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+80104146:	89 e5                	mov    %esp,%ebp
+  return namex(path, 1, name);
+80104148:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010414b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+8010414e:	5d                   	pop    %ebp
+  return namex(path, 1, name);
+8010414f:	e9 2c fc ff ff       	jmp    80103d80 <namex>
+80104154:	66 90                	xchg   %ax,%ax
+80104156:	66 90                	xchg   %ax,%ax
+80104158:	66 90                	xchg   %ax,%ax
+8010415a:	66 90                	xchg   %ax,%ax
+8010415c:	66 90                	xchg   %ax,%ax
+8010415e:	66 90                	xchg   %ax,%ax
+
+80104160 <idestart>:
+// disk in the same direction join the same command; PIO moves
+// one buf per command, since it interrupts for every sector.
+// Caller must hold idelock.
+static void
+idestart(struct buf *b)
+{
+80104160:	55                   	push   %ebp
+80104161:	89 e5                	mov    %esp,%ebp
+80104163:	57                   	push   %edi
+80104164:	56                   	push   %esi
+80104165:	53                   	push   %ebx
+80104166:	83 ec 2c             	sub    $0x2c,%esp
+  struct buf *last;
+  struct prd *p;
+  int i;
+
+  if(b == 0)
+80104169:	85 c0                	test   %eax,%eax
+8010416b:	0f 84 6f 02 00 00    	je     801043e0 <idestart+0x280>
+  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
+  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+
+  if (sector_per_block > 7) panic("idestart");
+
+  idenbuf = 1;
+80104171:	c7 05 c8 97 20 80 01 	movl   $0x1,0x802097c8
+80104178:	00 00 00 
+8010417b:	89 c3                	mov    %eax,%ebx
+  int sector = b->blockno * sector_per_block;
+8010417d:	8b 40 08             	mov    0x8(%eax),%eax
+80104180:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  last = b;
+  while(idebm && idenbuf < IDE_MAXMERGE && last->qnext &&
+80104183:	0f b7 05 c0 97 20 80 	movzwl 0x802097c0,%eax
+8010418a:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+        last->qnext->dev == b->dev &&
+        last->qnext->blockno == last->blockno + 1 &&
+8010418e:	66 85 c0             	test   %ax,%ax
+80104191:	0f 84 3d 02 00 00    	je     801043d4 <idestart+0x274>
+80104197:	89 d9                	mov    %ebx,%ecx
+80104199:	ba 01 00 00 00       	mov    $0x1,%edx
+8010419e:	31 f6                	xor    %esi,%esi
+801041a0:	eb 37                	jmp    801041d9 <idestart+0x79>
+801041a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  while(idebm && idenbuf < IDE_MAXMERGE && last->qnext &&
+801041a8:	8b 41 6c             	mov    0x6c(%ecx),%eax
+801041ab:	85 c0                	test   %eax,%eax
+801041ad:	74 52                	je     80104201 <idestart+0xa1>
+801041af:	8b 7b 04             	mov    0x4(%ebx),%edi
+801041b2:	39 78 04             	cmp    %edi,0x4(%eax)
+801041b5:	75 4a                	jne    80104201 <idestart+0xa1>
+        last->qnext->blockno == last->blockno + 1 &&
+801041b7:	8b 49 08             	mov    0x8(%ecx),%ecx
+801041ba:	83 c1 01             	add    $0x1,%ecx
+        last->qnext->dev == b->dev &&
+801041bd:	39 48 08             	cmp    %ecx,0x8(%eax)
+801041c0:	75 3f                	jne    80104201 <idestart+0xa1>
+        (last->qnext->flags & B_DIRTY) == (b->flags & B_DIRTY)){
+801041c2:	8b 08                	mov    (%eax),%ecx
+801041c4:	33 0b                	xor    (%ebx),%ecx
+        last->qnext->blockno == last->blockno + 1 &&
+801041c6:	83 c2 01             	add    $0x1,%edx
+801041c9:	83 e1 04             	and    $0x4,%ecx
+801041cc:	0f 85 d3 01 00 00    	jne    801043a5 <idestart+0x245>
+801041d2:	be 01 00 00 00       	mov    $0x1,%esi
+801041d7:	89 c1                	mov    %eax,%ecx
+801041d9:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  while(idebm && idenbuf < IDE_MAXMERGE && last->qnext &&
+801041dc:	83 fa 10             	cmp    $0x10,%edx
+801041df:	75 c7                	jne    801041a8 <idestart+0x48>
+801041e1:	89 f0                	mov    %esi,%eax
+801041e3:	c7 45 dc 01 00 00 00 	movl   $0x1,-0x24(%ebp)
+801041ea:	84 c0                	test   %al,%al
+801041ec:	74 27                	je     80104215 <idestart+0xb5>
+801041ee:	c7 05 c8 97 20 80 10 	movl   $0x10,0x802097c8
+801041f5:	00 00 00 
+801041f8:	c7 45 dc 10 00 00 00 	movl   $0x10,-0x24(%ebp)
+801041ff:	eb 14                	jmp    80104215 <idestart+0xb5>
+80104201:	89 f0                	mov    %esi,%eax
+80104203:	84 c0                	test   %al,%al
+80104205:	74 06                	je     8010420d <idestart+0xad>
+80104207:	89 15 c8 97 20 80    	mov    %edx,0x802097c8
+
+  idewait(0);
+  if(idebm){
+    // Point the bus master at the bufs' data; clear old status.
+    p = prdt;
+    for(i = 0, last = b; i < idenbuf; i++, last = last->qnext)
+8010420d:	a1 c8 97 20 80       	mov    0x802097c8,%eax
+80104212:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104215:	ba f7 01 00 00       	mov    $0x1f7,%edx
+8010421a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80104220:	ec                   	in     (%dx),%al
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+80104221:	83 e0 c0             	and    $0xffffffc0,%eax
+80104224:	3c 40                	cmp    $0x40,%al
+80104226:	75 f8                	jne    80104220 <idestart+0xc0>
+  if(idebm){
+80104228:	66 83 7d da 00       	cmpw   $0x0,-0x26(%ebp)
+8010422d:	0f 85 82 00 00 00    	jne    801042b5 <idestart+0x155>
+  outb(0x1f4, (sector >> 8) & 0xff);
+  outb(0x1f5, (sector >> 16) & 0xff);
+  outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
+  if(idebm){
+    // The controller moves the data; ideintr() runs when it is done.
+    outb(0x1f7, (b->flags & B_DIRTY) ? IDE_CMD_WRDMA : IDE_CMD_RDDMA);
+80104233:	8b 0b                	mov    (%ebx),%ecx
+80104235:	83 e1 04             	and    $0x4,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104238:	31 c0                	xor    %eax,%eax
+8010423a:	ba f6 03 00 00       	mov    $0x3f6,%edx
+8010423f:	ee                   	out    %al,(%dx)
+80104240:	ba f2 01 00 00       	mov    $0x1f2,%edx
+80104245:	0f b6 45 dc          	movzbl -0x24(%ebp),%eax
+80104249:	ee                   	out    %al,(%dx)
+8010424a:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+8010424d:	ba f3 01 00 00       	mov    $0x1f3,%edx
+80104252:	89 f8                	mov    %edi,%eax
+80104254:	ee                   	out    %al,(%dx)
+  outb(0x1f4, (sector >> 8) & 0xff);
+80104255:	89 f8                	mov    %edi,%eax
+80104257:	ba f4 01 00 00       	mov    $0x1f4,%edx
+8010425c:	c1 f8 08             	sar    $0x8,%eax
+8010425f:	ee                   	out    %al,(%dx)
+  outb(0x1f5, (sector >> 16) & 0xff);
+80104260:	89 f8                	mov    %edi,%eax
+80104262:	ba f5 01 00 00       	mov    $0x1f5,%edx
+80104267:	c1 f8 10             	sar    $0x10,%eax
+8010426a:	ee                   	out    %al,(%dx)
+  outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
+8010426b:	0f b6 43 04          	movzbl 0x4(%ebx),%eax
+8010426f:	c1 ff 18             	sar    $0x18,%edi
+80104272:	89 fa                	mov    %edi,%edx
+80104274:	c1 e0 04             	shl    $0x4,%eax
+80104277:	83 e2 0f             	and    $0xf,%edx
+8010427a:	83 e0 10             	and    $0x10,%eax
+8010427d:	09 d0                	or     %edx,%eax
+8010427f:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80104284:	83 c8 e0             	or     $0xffffffe0,%eax
+80104287:	ee                   	out    %al,(%dx)
+  if(idebm){
+80104288:	0f b7 7d da          	movzwl -0x26(%ebp),%edi
+8010428c:	66 85 ff             	test   %di,%di
+8010428f:	0f 84 d6 00 00 00    	je     8010436b <idestart+0x20b>
+    outb(0x1f7, (b->flags & B_DIRTY) ? IDE_CMD_WRDMA : IDE_CMD_RDDMA);
+80104295:	83 f9 01             	cmp    $0x1,%ecx
+80104298:	ba f7 01 00 00       	mov    $0x1f7,%edx
+8010429d:	19 c0                	sbb    %eax,%eax
+8010429f:	83 e0 fe             	and    $0xfffffffe,%eax
+801042a2:	83 e8 36             	sub    $0x36,%eax
+801042a5:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801042a6:	89 fa                	mov    %edi,%edx
+801042a8:	ec                   	in     (%dx),%al
+    outb(idebm + BM_CMD, inb(idebm + BM_CMD) | BM_START);
+801042a9:	83 c8 01             	or     $0x1,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801042ac:	ee                   	out    %al,(%dx)
+    outb(0x1f7, write_cmd);
+    outsl(0x1f0, b->data, BSIZE/4);
+  } else {
+    outb(0x1f7, read_cmd);
+  }
+}
+801042ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801042b0:	5b                   	pop    %ebx
+801042b1:	5e                   	pop    %esi
+801042b2:	5f                   	pop    %edi
+801042b3:	5d                   	pop    %ebp
+801042b4:	c3                   	ret
+    for(i = 0, last = b; i < idenbuf; i++, last = last->qnext)
+801042b5:	8b 7d dc             	mov    -0x24(%ebp),%edi
+801042b8:	85 ff                	test   %edi,%edi
+801042ba:	0f 8e fd 00 00 00    	jle    801043bd <idestart+0x25d>
+    m = 0x10000 - (pa & 0xffff);
+801042c0:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    for(i = 0, last = b; i < idenbuf; i++, last = last->qnext)
+801042c3:	89 de                	mov    %ebx,%esi
+801042c5:	31 c0                	xor    %eax,%eax
+    p = prdt;
+801042c7:	ba c0 96 20 80       	mov    $0x802096c0,%edx
+    m = 0x10000 - (pa & 0xffff);
+801042cc:	bf 00 00 01 00       	mov    $0x10000,%edi
+801042d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  pa = V2P(data);
+801042d8:	8d 9e 70 00 00 80    	lea    -0x7fffff90(%esi),%ebx
+    if(p >= prdt+NPRD)
+801042de:	81 fa c0 97 20 80    	cmp    $0x802097c0,%edx
+801042e4:	0f 83 dd 00 00 00    	jae    801043c7 <idestart+0x267>
+801042ea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801042ed:	b9 00 02 00 00       	mov    $0x200,%ecx
+801042f2:	89 75 e0             	mov    %esi,-0x20(%ebp)
+801042f5:	eb 15                	jmp    8010430c <idestart+0x1ac>
+801042f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801042fe:	66 90                	xchg   %ax,%ax
+80104300:	81 fa c0 97 20 80    	cmp    $0x802097c0,%edx
+80104306:	0f 83 bb 00 00 00    	jae    801043c7 <idestart+0x267>
+    m = 0x10000 - (pa & 0xffff);
+8010430c:	0f b7 f3             	movzwl %bx,%esi
+8010430f:	89 f8                	mov    %edi,%eax
+    p->addr = pa;
+80104311:	89 1a                	mov    %ebx,(%edx)
+    m = 0x10000 - (pa & 0xffff);
+80104313:	29 f0                	sub    %esi,%eax
+80104315:	39 c8                	cmp    %ecx,%eax
+80104317:	0f 47 c1             	cmova  %ecx,%eax
+    p->flags = 0;
+8010431a:	31 f6                	xor    %esi,%esi
+  for(; n > 0; p++){
+8010431c:	83 c2 08             	add    $0x8,%edx
+    p->flags = 0;
+8010431f:	66 89 72 fe          	mov    %si,-0x2(%edx)
+    p->nbytes = m;
+80104323:	66 89 42 fc          	mov    %ax,-0x4(%edx)
+    pa += m;
+80104327:	01 c3                	add    %eax,%ebx
+  for(; n > 0; p++){
+80104329:	29 c1                	sub    %eax,%ecx
+8010432b:	75 d3                	jne    80104300 <idestart+0x1a0>
+    for(i = 0, last = b; i < idenbuf; i++, last = last->qnext)
+8010432d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80104330:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80104333:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+80104336:	83 c0 01             	add    $0x1,%eax
+80104339:	8b 76 6c             	mov    0x6c(%esi),%esi
+8010433c:	39 d8                	cmp    %ebx,%eax
+8010433e:	75 98                	jne    801042d8 <idestart+0x178>
+80104340:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    (p-1)->flags = PRD_EOT;
+80104343:	b8 00 80 ff ff       	mov    $0xffff8000,%eax
+80104348:	66 89 42 fe          	mov    %ax,-0x2(%edx)
+    outb(idebm + BM_CMD, (b->flags & B_DIRTY) ? 0 : BM_READ);
+8010434c:	8b 0b                	mov    (%ebx),%ecx
+8010434e:	31 c0                	xor    %eax,%eax
+80104350:	0f b7 55 da          	movzwl -0x26(%ebp),%edx
+80104354:	83 e1 04             	and    $0x4,%ecx
+80104357:	0f 94 c0             	sete   %al
+8010435a:	c1 e0 03             	shl    $0x3,%eax
+8010435d:	ee                   	out    %al,(%dx)
+    outb(idebm + BM_STATUS, inb(idebm + BM_STATUS) | BM_ERR | BM_INTR);
+8010435e:	83 c2 02             	add    $0x2,%edx
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104361:	ec                   	in     (%dx),%al
+80104362:	83 c8 06             	or     $0x6,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104365:	ee                   	out    %al,(%dx)
+}
+80104366:	e9 cd fe ff ff       	jmp    80104238 <idestart+0xd8>
+  } else if(b->flags & B_DIRTY){
+8010436b:	85 c9                	test   %ecx,%ecx
+8010436d:	74 23                	je     80104392 <idestart+0x232>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010436f:	b8 30 00 00 00       	mov    $0x30,%eax
+80104374:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80104379:	ee                   	out    %al,(%dx)
+  asm volatile("cld; rep outsl" :
+8010437a:	b9 80 00 00 00       	mov    $0x80,%ecx
+    outsl(0x1f0, b->data, BSIZE/4);
+8010437f:	8d 73 70             	lea    0x70(%ebx),%esi
+80104382:	ba f0 01 00 00       	mov    $0x1f0,%edx
+80104387:	fc                   	cld
+80104388:	f3 6f                	rep outsl %ds:(%esi),(%dx)
+}
+8010438a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010438d:	5b                   	pop    %ebx
+8010438e:	5e                   	pop    %esi
+8010438f:	5f                   	pop    %edi
+80104390:	5d                   	pop    %ebp
+80104391:	c3                   	ret
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104392:	b8 20 00 00 00       	mov    $0x20,%eax
+80104397:	ba f7 01 00 00       	mov    $0x1f7,%edx
+8010439c:	ee                   	out    %al,(%dx)
+8010439d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801043a0:	5b                   	pop    %ebx
+801043a1:	5e                   	pop    %esi
+801043a2:	5f                   	pop    %edi
+801043a3:	5d                   	pop    %ebp
+801043a4:	c3                   	ret
+801043a5:	89 f0                	mov    %esi,%eax
+801043a7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801043aa:	84 c0                	test   %al,%al
+801043ac:	0f 84 5b fe ff ff    	je     8010420d <idestart+0xad>
+801043b2:	89 3d c8 97 20 80    	mov    %edi,0x802097c8
+801043b8:	e9 50 fe ff ff       	jmp    8010420d <idestart+0xad>
+    p = prdt;
+801043bd:	ba c0 96 20 80       	mov    $0x802096c0,%edx
+801043c2:	e9 7c ff ff ff       	jmp    80104343 <idestart+0x1e3>
+      panic("idesetprd");
+801043c7:	83 ec 0c             	sub    $0xc,%esp
+801043ca:	68 c4 b8 10 80       	push   $0x8010b8c4
+801043cf:	e8 8c c2 ff ff       	call   80100660 <panic>
+        last->qnext->blockno == last->blockno + 1 &&
+801043d4:	c7 45 dc 01 00 00 00 	movl   $0x1,-0x24(%ebp)
+801043db:	e9 35 fe ff ff       	jmp    80104215 <idestart+0xb5>
+    panic("idestart");
+801043e0:	83 ec 0c             	sub    $0xc,%esp
+801043e3:	68 bb b8 10 80       	push   $0x8010b8bb
+801043e8:	e8 73 c2 ff ff       	call   80100660 <panic>
+801043ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+801043f0 <ideinit>:
+{
+801043f0:	55                   	push   %ebp
+801043f1:	89 e5                	mov    %esp,%ebp
+801043f3:	57                   	push   %edi
+801043f4:	56                   	push   %esi
+801043f5:	53                   	push   %ebx
+801043f6:	83 ec 24             	sub    $0x24,%esp
+  initlock(&idelock, "ide");
+801043f9:	68 ce b8 10 80       	push   $0x8010b8ce
+801043fe:	68 e0 97 20 80       	push   $0x802097e0
+80104403:	e8 08 3b 00 00       	call   80107f10 <initlock>
+  ioapicenable(IRQ_IDE, ncpu - 1);
+80104408:	58                   	pop    %eax
+80104409:	a1 64 71 22 80       	mov    0x80227164,%eax
+8010440e:	5a                   	pop    %edx
+8010440f:	83 e8 01             	sub    $0x1,%eax
+80104412:	50                   	push   %eax
+80104413:	6a 0e                	push   $0xe
+80104415:	e8 d6 04 00 00       	call   801048f0 <ioapicenable>
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+8010441a:	83 c4 10             	add    $0x10,%esp
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010441d:	b9 f7 01 00 00       	mov    $0x1f7,%ecx
+80104422:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80104428:	89 ca                	mov    %ecx,%edx
+8010442a:	ec                   	in     (%dx),%al
+8010442b:	83 e0 c0             	and    $0xffffffc0,%eax
+8010442e:	3c 40                	cmp    $0x40,%al
+80104430:	75 f6                	jne    80104428 <ideinit+0x38>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104432:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+80104437:	ba f6 01 00 00       	mov    $0x1f6,%edx
+8010443c:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010443d:	89 ca                	mov    %ecx,%edx
+8010443f:	ec                   	in     (%dx),%al
+    if(inb(0x1f7) != 0){
+80104440:	84 c0                	test   %al,%al
+80104442:	75 16                	jne    8010445a <ideinit+0x6a>
+80104444:	b9 e8 03 00 00       	mov    $0x3e8,%ecx
+80104449:	ba f7 01 00 00       	mov    $0x1f7,%edx
+8010444e:	66 90                	xchg   %ax,%ax
+  for(i=0; i<1000; i++){
+80104450:	83 e9 01             	sub    $0x1,%ecx
+80104453:	74 0f                	je     80104464 <ideinit+0x74>
+80104455:	ec                   	in     (%dx),%al
+    if(inb(0x1f7) != 0){
+80104456:	84 c0                	test   %al,%al
+80104458:	74 f6                	je     80104450 <ideinit+0x60>
+      havedisk1 = 1;
+8010445a:	c7 05 c4 97 20 80 01 	movl   $0x1,0x802097c4
+80104461:	00 00 00 
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104464:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+80104469:	ba f6 01 00 00       	mov    $0x1f6,%edx
+8010446e:	ee                   	out    %al,(%dx)
+8010446f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104476:	bf f8 0c 00 00       	mov    $0xcf8,%edi
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010447b:	be fc 0c 00 00       	mov    $0xcfc,%esi
+    if(inb(0x1f7) != 0){
+80104480:	31 c9                	xor    %ecx,%ecx
+  outl(PCI_CONFADDR, 0x80000000 | (dev<<11) | (func<<8) | (off&0xfc));
+80104482:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104485:	89 fa                	mov    %edi,%edx
+80104487:	09 cb                	or     %ecx,%ebx
+80104489:	89 d8                	mov    %ebx,%eax
+8010448b:	0d 00 00 00 80       	or     $0x80000000,%eax
+80104490:	ef                   	out    %eax,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104491:	89 f2                	mov    %esi,%edx
+80104493:	ed                   	in     (%dx),%eax
+      if((pciconfread(dev, func, 0x00) & 0xffff) == 0xffff)
+80104494:	0f b7 c0             	movzwl %ax,%eax
+80104497:	3d ff ff 00 00       	cmp    $0xffff,%eax
+8010449c:	0f 84 7e 00 00 00    	je     80104520 <ideinit+0x130>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801044a2:	89 d8                	mov    %ebx,%eax
+801044a4:	89 fa                	mov    %edi,%edx
+801044a6:	0d 08 00 00 80       	or     $0x80000008,%eax
+801044ab:	ef                   	out    %eax,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801044ac:	89 f2                	mov    %esi,%edx
+801044ae:	ed                   	in     (%dx),%eax
+      if((class >> 16) != 0x0101 || (class & 0x8000) == 0)
+801044af:	89 c2                	mov    %eax,%edx
+801044b1:	c1 ea 10             	shr    $0x10,%edx
+801044b4:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+801044ba:	75 64                	jne    80104520 <ideinit+0x130>
+801044bc:	f6 c4 80             	test   $0x80,%ah
+801044bf:	74 5f                	je     80104520 <ideinit+0x130>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801044c1:	89 d8                	mov    %ebx,%eax
+801044c3:	89 fa                	mov    %edi,%edx
+801044c5:	0d 20 00 00 80       	or     $0x80000020,%eax
+801044ca:	ef                   	out    %eax,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801044cb:	89 f2                	mov    %esi,%edx
+801044cd:	ed                   	in     (%dx),%eax
+      if((bar4 & 1) == 0 || (bar4 & ~3) == 0)
+801044ce:	83 f8 03             	cmp    $0x3,%eax
+801044d1:	76 4d                	jbe    80104520 <ideinit+0x130>
+801044d3:	a8 01                	test   $0x1,%al
+801044d5:	74 49                	je     80104520 <ideinit+0x130>
+  outl(PCI_CONFADDR, 0x80000000 | (dev<<11) | (func<<8) | (off&0xfc));
+801044d7:	81 cb 04 00 00 80    	or     $0x80000004,%ebx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801044dd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801044e0:	89 fa                	mov    %edi,%edx
+801044e2:	89 d8                	mov    %ebx,%eax
+801044e4:	ef                   	out    %eax,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801044e5:	89 f2                	mov    %esi,%edx
+801044e7:	ed                   	in     (%dx),%eax
+801044e8:	89 c1                	mov    %eax,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801044ea:	89 fa                	mov    %edi,%edx
+801044ec:	89 d8                	mov    %ebx,%eax
+801044ee:	ef                   	out    %eax,(%dx)
+      pciconfwrite(dev, func, 0x04, (cmd & 0xffff) | 0x5);
+801044ef:	0f b7 c1             	movzwl %cx,%eax
+801044f2:	89 f2                	mov    %esi,%edx
+801044f4:	83 c8 05             	or     $0x5,%eax
+801044f7:	ef                   	out    %eax,(%dx)
+  if(idebm)
+801044f8:	0f b7 4d e4          	movzwl -0x1c(%ebp),%ecx
+801044fc:	66 83 e1 fc          	and    $0xfffc,%cx
+80104500:	74 09                	je     8010450b <ideinit+0x11b>
+    outl(idebm + BM_PRDT, V2P(prdt));
+80104502:	8d 51 04             	lea    0x4(%ecx),%edx
+80104505:	b8 c0 96 20 00       	mov    $0x2096c0,%eax
+8010450a:	ef                   	out    %eax,(%dx)
+  idebm = idebminit();
+8010450b:	66 89 0d c0 97 20 80 	mov    %cx,0x802097c0
+}
+80104512:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104515:	5b                   	pop    %ebx
+80104516:	5e                   	pop    %esi
+80104517:	5f                   	pop    %edi
+80104518:	5d                   	pop    %ebp
+80104519:	c3                   	ret
+8010451a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    for(func = 0; func < 8; func++){
+80104520:	81 c1 00 01 00 00    	add    $0x100,%ecx
+80104526:	81 f9 00 08 00 00    	cmp    $0x800,%ecx
+8010452c:	0f 85 50 ff ff ff    	jne    80104482 <ideinit+0x92>
+  for(dev = 0; dev < 32; dev++){
+80104532:	81 45 e4 00 08 00 00 	addl   $0x800,-0x1c(%ebp)
+80104539:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010453c:	3d 00 00 01 00       	cmp    $0x10000,%eax
+80104541:	0f 85 39 ff ff ff    	jne    80104480 <ideinit+0x90>
+80104547:	31 c9                	xor    %ecx,%ecx
+80104549:	eb c0                	jmp    8010450b <ideinit+0x11b>
+8010454b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010454f:	90                   	nop
+
+80104550 <ideintr>:
+
+// Interrupt handler.
+void
+ideintr(void)
+{
+80104550:	55                   	push   %ebp
+80104551:	89 e5                	mov    %esp,%ebp
+80104553:	57                   	push   %edi
+80104554:	56                   	push   %esi
+80104555:	53                   	push   %ebx
+80104556:	83 ec 28             	sub    $0x28,%esp
+  struct buf *b;
+  uchar st;
+
+  // First queued buffer is the active request.
+  acquire(&idelock);
+80104559:	68 e0 97 20 80       	push   $0x802097e0
+8010455e:	e8 fd 3b 00 00       	call   80108160 <acquire>
+
+  if((b = idequeue) == 0){
+80104563:	8b 0d cc 97 20 80    	mov    0x802097cc,%ecx
+80104569:	83 c4 10             	add    $0x10,%esp
+8010456c:	85 c9                	test   %ecx,%ecx
+8010456e:	0f 84 9c 00 00 00    	je     80104610 <ideintr+0xc0>
+    release(&idelock);
+    return;
+  }
+
+  if(idebm){
+80104574:	0f b7 35 c0 97 20 80 	movzwl 0x802097c0,%esi
+8010457b:	66 85 f6             	test   %si,%si
+8010457e:	0f 84 a4 00 00 00    	je     80104628 <ideintr+0xd8>
+    // Stop the bus master and acknowledge the interrupt.
+    // The data is already in (or out of) the bufs.
+    st = inb(idebm + BM_STATUS);
+80104584:	8d 7e 02             	lea    0x2(%esi),%edi
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104587:	89 fa                	mov    %edi,%edx
+80104589:	ec                   	in     (%dx),%al
+8010458a:	88 45 e7             	mov    %al,-0x19(%ebp)
+    if((st & BM_INTR) == 0){
+8010458d:	89 c3                	mov    %eax,%ebx
+8010458f:	a8 04                	test   $0x4,%al
+80104591:	74 7d                	je     80104610 <ideintr+0xc0>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104593:	31 c0                	xor    %eax,%eax
+80104595:	89 f2                	mov    %esi,%edx
+80104597:	ee                   	out    %al,(%dx)
+      // Not from the command in progress.
+      release(&idelock);
+      return;
+    }
+    outb(idebm + BM_CMD, 0);
+    outb(idebm + BM_STATUS, st | BM_ERR | BM_INTR);
+80104598:	89 d8                	mov    %ebx,%eax
+8010459a:	89 fa                	mov    %edi,%edx
+8010459c:	83 c8 06             	or     $0x6,%eax
+8010459f:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801045a0:	ba f7 01 00 00       	mov    $0x1f7,%edx
+801045a5:	8d 76 00             	lea    0x0(%esi),%esi
+801045a8:	ec                   	in     (%dx),%al
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+801045a9:	89 c6                	mov    %eax,%esi
+801045ab:	83 e6 c0             	and    $0xffffffc0,%esi
+801045ae:	89 f3                	mov    %esi,%ebx
+801045b0:	80 fb 40             	cmp    $0x40,%bl
+801045b3:	75 f3                	jne    801045a8 <ideintr+0x58>
+    if(idewait(1) < 0 || (st & BM_ERR))
+801045b5:	0f b6 5d e7          	movzbl -0x19(%ebp),%ebx
+801045b9:	83 e0 21             	and    $0x21,%eax
+801045bc:	83 e3 02             	and    $0x2,%ebx
+801045bf:	08 d8                	or     %bl,%al
+801045c1:	0f 85 aa 00 00 00    	jne    80104671 <ideintr+0x121>
+    // Read data if needed.
+    insl(0x1f0, b->data, BSIZE/4);
+  }
+
+  // Wake processes waiting for the bufs of this command.
+  for(; idenbuf > 0; idenbuf--){
+801045c7:	a1 c8 97 20 80       	mov    0x802097c8,%eax
+801045cc:	85 c0                	test   %eax,%eax
+801045ce:	7e 39                	jle    80104609 <ideintr+0xb9>
+    b = idequeue;
+    idequeue = b->qnext;
+801045d0:	8b 41 6c             	mov    0x6c(%ecx),%eax
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    wakeup(b);
+801045d3:	83 ec 0c             	sub    $0xc,%esp
+    idequeue = b->qnext;
+801045d6:	a3 cc 97 20 80       	mov    %eax,0x802097cc
+    b->flags &= ~B_DIRTY;
+801045db:	8b 01                	mov    (%ecx),%eax
+801045dd:	83 e0 fb             	and    $0xfffffffb,%eax
+801045e0:	83 c8 02             	or     $0x2,%eax
+801045e3:	89 01                	mov    %eax,(%ecx)
+    wakeup(b);
+801045e5:	51                   	push   %ecx
+801045e6:	e8 a5 32 00 00       	call   80107890 <wakeup>
+  for(; idenbuf > 0; idenbuf--){
+801045eb:	a1 c8 97 20 80       	mov    0x802097c8,%eax
+  }
+
+  // Start disk on next buf in queue.
+  if(idequeue != 0)
+801045f0:	8b 0d cc 97 20 80    	mov    0x802097cc,%ecx
+  for(; idenbuf > 0; idenbuf--){
+801045f6:	83 c4 10             	add    $0x10,%esp
+801045f9:	83 e8 01             	sub    $0x1,%eax
+801045fc:	a3 c8 97 20 80       	mov    %eax,0x802097c8
+80104601:	85 c0                	test   %eax,%eax
+80104603:	7f cb                	jg     801045d0 <ideintr+0x80>
+  if(idequeue != 0)
+80104605:	85 c9                	test   %ecx,%ecx
+80104607:	74 07                	je     80104610 <ideintr+0xc0>
+    idestart(idequeue);
+80104609:	89 c8                	mov    %ecx,%eax
+8010460b:	e8 50 fb ff ff       	call   80104160 <idestart>
+    release(&idelock);
+80104610:	83 ec 0c             	sub    $0xc,%esp
+80104613:	68 e0 97 20 80       	push   $0x802097e0
+80104618:	e8 83 3d 00 00       	call   801083a0 <release>
+
+  release(&idelock);
+}
+8010461d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104620:	5b                   	pop    %ebx
+80104621:	5e                   	pop    %esi
+80104622:	5f                   	pop    %edi
+80104623:	5d                   	pop    %ebp
+80104624:	c3                   	ret
+80104625:	8d 76 00             	lea    0x0(%esi),%esi
+  } else if(!(b->flags & B_DIRTY) && idewait(1) >= 0){
+80104628:	f6 01 04             	testb  $0x4,(%ecx)
+8010462b:	75 9a                	jne    801045c7 <ideintr+0x77>
+8010462d:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80104632:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80104638:	ec                   	in     (%dx),%al
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+80104639:	89 c3                	mov    %eax,%ebx
+8010463b:	83 e3 c0             	and    $0xffffffc0,%ebx
+8010463e:	80 fb 40             	cmp    $0x40,%bl
+80104641:	75 f5                	jne    80104638 <ideintr+0xe8>
+  if(checkerr && (r & (IDE_DF|IDE_ERR)) != 0)
+80104643:	a8 21                	test   $0x21,%al
+80104645:	0f 85 7c ff ff ff    	jne    801045c7 <ideintr+0x77>
+    insl(0x1f0, b->data, BSIZE/4);
+8010464b:	8d 79 70             	lea    0x70(%ecx),%edi
+  asm volatile("cld; rep insl" :
+8010464e:	ba f0 01 00 00       	mov    $0x1f0,%edx
+80104653:	b9 80 00 00 00       	mov    $0x80,%ecx
+80104658:	fc                   	cld
+80104659:	f3 6d                	rep insl (%dx),%es:(%edi)
+  for(; idenbuf > 0; idenbuf--){
+8010465b:	8b 15 c8 97 20 80    	mov    0x802097c8,%edx
+  if(idequeue != 0)
+80104661:	8b 0d cc 97 20 80    	mov    0x802097cc,%ecx
+  for(; idenbuf > 0; idenbuf--){
+80104667:	85 d2                	test   %edx,%edx
+80104669:	0f 8f 61 ff ff ff    	jg     801045d0 <ideintr+0x80>
+8010466f:	eb 94                	jmp    80104605 <ideintr+0xb5>
+      panic("ideintr: dma error");
+80104671:	83 ec 0c             	sub    $0xc,%esp
+80104674:	68 d2 b8 10 80       	push   $0x8010b8d2
+80104679:	e8 e2 bf ff ff       	call   80100660 <panic>
+8010467e:	66 90                	xchg   %ax,%ax
+
+80104680 <iderwv>:
+// so that idestart can merge adjacent blocks into one command.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderwv(struct buf **bs, int n)
+{
+80104680:	55                   	push   %ebp
+80104681:	89 e5                	mov    %esp,%ebp
+80104683:	57                   	push   %edi
+80104684:	56                   	push   %esi
+80104685:	53                   	push   %ebx
+80104686:	83 ec 28             	sub    $0x28,%esp
+80104689:	8b 45 08             	mov    0x8(%ebp),%eax
+8010468c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+8010468f:	8b 45 0c             	mov    0xc(%ebp),%eax
+80104692:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80104695:	89 c6                	mov    %eax,%esi
+  int i, idle;
+
+  acquire(&idelock);  //DOC:acquire-lock
+80104697:	68 e0 97 20 80       	push   $0x802097e0
+8010469c:	e8 bf 3a 00 00       	call   80108160 <acquire>
+
+  idle = (idequeue == 0);
+801046a1:	8b 1d cc 97 20 80    	mov    0x802097cc,%ebx
+  for(i = 0; i < n; i++)
+801046a7:	83 c4 10             	add    $0x10,%esp
+801046aa:	85 f6                	test   %esi,%esi
+801046ac:	0f 8e ce 00 00 00    	jle    80104780 <iderwv+0x100>
+801046b2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+801046b9:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+801046bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    ideinsert(bs[i]);
+801046c0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801046c3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  if(!holdingsleep(&b->lock))
+801046c6:	83 ec 0c             	sub    $0xc,%esp
+    ideinsert(bs[i]);
+801046c9:	8b 34 b8             	mov    (%eax,%edi,4),%esi
+  if(!holdingsleep(&b->lock))
+801046cc:	8d 46 0c             	lea    0xc(%esi),%eax
+801046cf:	50                   	push   %eax
+801046d0:	e8 0b 38 00 00       	call   80107ee0 <holdingsleep>
+801046d5:	83 c4 10             	add    $0x10,%esp
+801046d8:	85 c0                	test   %eax,%eax
+801046da:	0f 84 3a 01 00 00    	je     8010481a <iderwv+0x19a>
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+801046e0:	8b 06                	mov    (%esi),%eax
+801046e2:	83 e0 06             	and    $0x6,%eax
+801046e5:	83 f8 02             	cmp    $0x2,%eax
+801046e8:	0f 84 1f 01 00 00    	je     8010480d <iderwv+0x18d>
+  if(b->dev != 0 && !havedisk1)
+801046ee:	8b 56 04             	mov    0x4(%esi),%edx
+801046f1:	85 d2                	test   %edx,%edx
+801046f3:	74 0d                	je     80104702 <iderwv+0x82>
+801046f5:	a1 c4 97 20 80       	mov    0x802097c4,%eax
+801046fa:	85 c0                	test   %eax,%eax
+801046fc:	0f 84 fe 00 00 00    	je     80104800 <iderwv+0x180>
+  if(b->blockno >= FSSIZE)
+80104702:	8b 5e 08             	mov    0x8(%esi),%ebx
+80104705:	81 fb 1f 4e 00 00    	cmp    $0x4e1f,%ebx
+8010470b:	0f 87 e2 00 00 00    	ja     801047f3 <iderwv+0x173>
+  for(i = 0; i < idenbuf; i++)
+80104711:	8b 0d c8 97 20 80    	mov    0x802097c8,%ecx
+80104717:	31 c0                	xor    %eax,%eax
+  pp = &idequeue;
+80104719:	ba cc 97 20 80       	mov    $0x802097cc,%edx
+  for(i = 0; i < idenbuf; i++)
+8010471e:	85 c9                	test   %ecx,%ecx
+80104720:	7e 12                	jle    80104734 <iderwv+0xb4>
+80104722:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pp = &(*pp)->qnext;
+80104728:	8b 12                	mov    (%edx),%edx
+  for(i = 0; i < idenbuf; i++)
+8010472a:	83 c0 01             	add    $0x1,%eax
+    pp = &(*pp)->qnext;
+8010472d:	83 c2 6c             	add    $0x6c,%edx
+  for(i = 0; i < idenbuf; i++)
+80104730:	39 c8                	cmp    %ecx,%eax
+80104732:	75 f4                	jne    80104728 <iderwv+0xa8>
+  base = idequeue ? idequeue->blockno : b->blockno;
+80104734:	a1 cc 97 20 80       	mov    0x802097cc,%eax
+80104739:	89 df                	mov    %ebx,%edi
+8010473b:	85 c0                	test   %eax,%eax
+8010473d:	74 03                	je     80104742 <iderwv+0xc2>
+8010473f:	8b 78 08             	mov    0x8(%eax),%edi
+  for(; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+80104742:	8b 02                	mov    (%edx),%eax
+80104744:	85 c0                	test   %eax,%eax
+80104746:	74 1b                	je     80104763 <iderwv+0xe3>
+    if((*pp)->blockno - base > b->blockno - base)
+80104748:	29 fb                	sub    %edi,%ebx
+8010474a:	eb 0e                	jmp    8010475a <iderwv+0xda>
+8010474c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+80104750:	8d 50 6c             	lea    0x6c(%eax),%edx
+80104753:	8b 40 6c             	mov    0x6c(%eax),%eax
+80104756:	85 c0                	test   %eax,%eax
+80104758:	74 09                	je     80104763 <iderwv+0xe3>
+    if((*pp)->blockno - base > b->blockno - base)
+8010475a:	8b 48 08             	mov    0x8(%eax),%ecx
+8010475d:	29 f9                	sub    %edi,%ecx
+8010475f:	39 cb                	cmp    %ecx,%ebx
+80104761:	73 ed                	jae    80104750 <iderwv+0xd0>
+  b->qnext = *pp;
+80104763:	89 46 6c             	mov    %eax,0x6c(%esi)
+  for(i = 0; i < n; i++)
+80104766:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  *pp = b;
+80104769:	89 32                	mov    %esi,(%edx)
+  for(i = 0; i < n; i++)
+8010476b:	83 c0 01             	add    $0x1,%eax
+8010476e:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+80104771:	74 25                	je     80104798 <iderwv+0x118>
+80104773:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80104776:	e9 45 ff ff ff       	jmp    801046c0 <iderwv+0x40>
+8010477b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010477f:	90                   	nop
+  // Wait for requests to finish.
+  for(i = 0; i < n; i++)
+    while((bs[i]->flags & (B_VALID|B_DIRTY)) != B_VALID)
+      sleep(bs[i], &idelock);
+
+  release(&idelock);
+80104780:	c7 45 08 e0 97 20 80 	movl   $0x802097e0,0x8(%ebp)
+}
+80104787:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010478a:	5b                   	pop    %ebx
+8010478b:	5e                   	pop    %esi
+8010478c:	5f                   	pop    %edi
+8010478d:	5d                   	pop    %ebp
+  release(&idelock);
+8010478e:	e9 0d 3c 00 00       	jmp    801083a0 <release>
+80104793:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104797:	90                   	nop
+  if(idle && n > 0)
+80104798:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+8010479b:	85 db                	test   %ebx,%ebx
+8010479d:	75 0a                	jne    801047a9 <iderwv+0x129>
+    idestart(idequeue);
+8010479f:	a1 cc 97 20 80       	mov    0x802097cc,%eax
+801047a4:	e8 b7 f9 ff ff       	call   80104160 <idestart>
+  for(i = 0; i < n; i++)
+801047a9:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+801047ac:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801047af:	31 f6                	xor    %esi,%esi
+801047b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    while((bs[i]->flags & (B_VALID|B_DIRTY)) != B_VALID)
+801047b8:	8b 13                	mov    (%ebx),%edx
+801047ba:	8b 02                	mov    (%edx),%eax
+801047bc:	83 e0 06             	and    $0x6,%eax
+801047bf:	83 f8 02             	cmp    $0x2,%eax
+801047c2:	74 21                	je     801047e5 <iderwv+0x165>
+801047c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      sleep(bs[i], &idelock);
+801047c8:	83 ec 08             	sub    $0x8,%esp
+801047cb:	68 e0 97 20 80       	push   $0x802097e0
+801047d0:	52                   	push   %edx
+801047d1:	e8 6a 2e 00 00       	call   80107640 <sleep>
+    while((bs[i]->flags & (B_VALID|B_DIRTY)) != B_VALID)
+801047d6:	8b 13                	mov    (%ebx),%edx
+801047d8:	83 c4 10             	add    $0x10,%esp
+801047db:	8b 02                	mov    (%edx),%eax
+801047dd:	83 e0 06             	and    $0x6,%eax
+801047e0:	83 f8 02             	cmp    $0x2,%eax
+801047e3:	75 e3                	jne    801047c8 <iderwv+0x148>
+  for(i = 0; i < n; i++)
+801047e5:	8d 46 01             	lea    0x1(%esi),%eax
+801047e8:	83 c3 04             	add    $0x4,%ebx
+801047eb:	39 f7                	cmp    %esi,%edi
+801047ed:	74 91                	je     80104780 <iderwv+0x100>
+801047ef:	89 c6                	mov    %eax,%esi
+801047f1:	eb c5                	jmp    801047b8 <iderwv+0x138>
+    panic("incorrect blockno");
+801047f3:	83 ec 0c             	sub    $0xc,%esp
+801047f6:	68 2e b9 10 80       	push   $0x8010b92e
+801047fb:	e8 60 be ff ff       	call   80100660 <panic>
+    panic("iderw: ide disk 1 not present");
+80104800:	83 ec 0c             	sub    $0xc,%esp
+80104803:	68 10 b9 10 80       	push   $0x8010b910
+80104808:	e8 53 be ff ff       	call   80100660 <panic>
+    panic("iderw: nothing to do");
+8010480d:	83 ec 0c             	sub    $0xc,%esp
+80104810:	68 fb b8 10 80       	push   $0x8010b8fb
+80104815:	e8 46 be ff ff       	call   80100660 <panic>
+    panic("iderw: buf not locked");
+8010481a:	83 ec 0c             	sub    $0xc,%esp
+8010481d:	68 e5 b8 10 80       	push   $0x8010b8e5
+80104822:	e8 39 be ff ff       	call   80100660 <panic>
+80104827:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010482e:	66 90                	xchg   %ax,%ax
+
+80104830 <iderw>:
+
+// Sync buf with disk.
+void
+iderw(struct buf *b)
+{
+80104830:	55                   	push   %ebp
+80104831:	89 e5                	mov    %esp,%ebp
+80104833:	83 ec 10             	sub    $0x10,%esp
+  iderwv(&b, 1);
+80104836:	8d 45 08             	lea    0x8(%ebp),%eax
+80104839:	6a 01                	push   $0x1
+8010483b:	50                   	push   %eax
+8010483c:	e8 3f fe ff ff       	call   80104680 <iderwv>
+}
+80104841:	83 c4 10             	add    $0x10,%esp
+80104844:	c9                   	leave
+80104845:	c3                   	ret
+80104846:	66 90                	xchg   %ax,%ax
+80104848:	66 90                	xchg   %ax,%ax
+8010484a:	66 90                	xchg   %ax,%ax
+8010484c:	66 90                	xchg   %ax,%ax
+8010484e:	66 90                	xchg   %ax,%ax
+
+80104850 <ioapicinit>:
+  ioapic->data = data;
+}
+
+void
+ioapicinit(void)
+{
+80104850:	55                   	push   %ebp
+80104851:	89 e5                	mov    %esp,%ebp
+80104853:	56                   	push   %esi
+80104854:	53                   	push   %ebx
+  int i, id, maxintr;
+
+  ioapic = (volatile struct ioapic*)IOAPIC;
+80104855:	c7 05 20 98 20 80 00 	movl   $0xfec00000,0x80209820
+8010485c:	00 c0 fe 
+  ioapic->reg = reg;
+8010485f:	c7 05 00 00 c0 fe 01 	movl   $0x1,0xfec00000
+80104866:	00 00 00 
+  return ioapic->data;
+80104869:	8b 15 20 98 20 80    	mov    0x80209820,%edx
+8010486f:	8b 72 10             	mov    0x10(%edx),%esi
+  ioapic->reg = reg;
+80104872:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+  return ioapic->data;
+80104878:	8b 1d 20 98 20 80    	mov    0x80209820,%ebx
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+  id = ioapicread(REG_ID) >> 24;
+  if(id != ioapicid)
+8010487e:	0f b6 15 60 71 22 80 	movzbl 0x80227160,%edx
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+80104885:	c1 ee 10             	shr    $0x10,%esi
+80104888:	89 f0                	mov    %esi,%eax
+8010488a:	0f b6 f0             	movzbl %al,%esi
+  return ioapic->data;
+8010488d:	8b 43 10             	mov    0x10(%ebx),%eax
+  id = ioapicread(REG_ID) >> 24;
+80104890:	c1 e8 18             	shr    $0x18,%eax
+  if(id != ioapicid)
+80104893:	39 c2                	cmp    %eax,%edx
+80104895:	74 16                	je     801048ad <ioapicinit+0x5d>
+    cprintf("ioapicinit: id isn't equal to ioapicid; not a MP\n");
+80104897:	83 ec 0c             	sub    $0xc,%esp
+8010489a:	68 40 b9 10 80       	push   $0x8010b940
+8010489f:	e8 ec c0 ff ff       	call   80100990 <cprintf>
+  ioapic->reg = reg;
+801048a4:	8b 1d 20 98 20 80    	mov    0x80209820,%ebx
+801048aa:	83 c4 10             	add    $0x10,%esp
+{
+801048ad:	ba 10 00 00 00       	mov    $0x10,%edx
+801048b2:	31 c0                	xor    %eax,%eax
+801048b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ioapic->reg = reg;
+801048b8:	89 13                	mov    %edx,(%ebx)
+801048ba:	8d 48 20             	lea    0x20(%eax),%ecx
+  ioapic->data = data;
+801048bd:	8b 1d 20 98 20 80    	mov    0x80209820,%ebx
+
+  // Mark all interrupts edge-triggered, active high, disabled,
+  // and not routed to any CPUs.
+  for(i = 0; i <= maxintr; i++){
+801048c3:	83 c0 01             	add    $0x1,%eax
+801048c6:	81 c9 00 00 01 00    	or     $0x10000,%ecx
+  ioapic->data = data;
+801048cc:	89 4b 10             	mov    %ecx,0x10(%ebx)
+  ioapic->reg = reg;
+801048cf:	8d 4a 01             	lea    0x1(%edx),%ecx
+  for(i = 0; i <= maxintr; i++){
+801048d2:	83 c2 02             	add    $0x2,%edx
+  ioapic->reg = reg;
+801048d5:	89 0b                	mov    %ecx,(%ebx)
+  ioapic->data = data;
+801048d7:	8b 1d 20 98 20 80    	mov    0x80209820,%ebx
+801048dd:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  for(i = 0; i <= maxintr; i++){
+801048e4:	39 c6                	cmp    %eax,%esi
+801048e6:	7d d0                	jge    801048b8 <ioapicinit+0x68>
+    ioapicwrite(REG_TABLE+2*i, INT_DISABLED | (T_IRQ0 + i));
+    ioapicwrite(REG_TABLE+2*i+1, 0);
+  }
+}
+801048e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801048eb:	5b                   	pop    %ebx
+801048ec:	5e                   	pop    %esi
+801048ed:	5d                   	pop    %ebp
+801048ee:	c3                   	ret
+801048ef:	90                   	nop
+
+801048f0 <ioapicenable>:
+
+void
+ioapicenable(int irq, int cpunum)
+{
+801048f0:	55                   	push   %ebp
+  ioapic->reg = reg;
+801048f1:	8b 0d 20 98 20 80    	mov    0x80209820,%ecx
+{
+801048f7:	89 e5                	mov    %esp,%ebp
+801048f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  // Mark interrupt edge-triggered, active high,
+  // enabled, and routed to the given cpunum,
+  // which happens to be that cpu's APIC ID.
+  ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
+801048fc:	8d 50 20             	lea    0x20(%eax),%edx
+801048ff:	8d 44 00 10          	lea    0x10(%eax,%eax,1),%eax
+  ioapic->reg = reg;
+80104903:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+80104905:	8b 0d 20 98 20 80    	mov    0x80209820,%ecx
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+8010490b:	83 c0 01             	add    $0x1,%eax
+  ioapic->data = data;
+8010490e:	89 51 10             	mov    %edx,0x10(%ecx)
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+80104911:	8b 55 0c             	mov    0xc(%ebp),%edx
+  ioapic->reg = reg;
+80104914:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+80104916:	a1 20 98 20 80       	mov    0x80209820,%eax
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+8010491b:	c1 e2 18             	shl    $0x18,%edx
+  ioapic->data = data;
+8010491e:	89 50 10             	mov    %edx,0x10(%eax)
+}
+80104921:	5d                   	pop    %ebp
+80104922:	c3                   	ret
+80104923:	66 90                	xchg   %ax,%ax
+80104925:	66 90                	xchg   %ax,%ax
+80104927:	66 90                	xchg   %ax,%ax
+80104929:	66 90                	xchg   %ax,%ax
+8010492b:	66 90                	xchg   %ax,%ax
+8010492d:	66 90                	xchg   %ax,%ax
+8010492f:	90                   	nop
+
+80104930 <kfree>:
+// call to kalloc().  (The exception is when
+// initializing the allocator; see kinit above.)
+// The page is freed when its last reference goes away.
+void
+kfree(char *v)
+{
+80104930:	55                   	push   %ebp
+80104931:	89 e5                	mov    %esp,%ebp
+80104933:	56                   	push   %esi
+80104934:	53                   	push   %ebx
+80104935:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct run *r;
+  struct freelist *fl;
+
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+80104938:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+8010493e:	0f 85 d3 00 00 00    	jne    80104a17 <kfree+0xe7>
+80104944:	81 fb f0 78 23 80    	cmp    $0x802378f0,%ebx
+8010494a:	0f 82 c7 00 00 00    	jb     80104a17 <kfree+0xe7>
+80104950:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+80104956:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+8010495b:	0f 87 b6 00 00 00    	ja     80104a17 <kfree+0xe7>
+    panic("kfree");
+  if(PAGEREF(v) == 0)
+80104961:	c1 e8 0c             	shr    $0xc,%eax
+80104964:	66 83 bc 00 84 9a 20 	cmpw   $0x0,-0x7fdf657c(%eax,%eax,1)
+8010496b:	80 00 
+8010496d:	0f 84 b1 00 00 00    	je     80104a24 <kfree+0xf4>
+    panic("kfree: ref");
+  if(__sync_sub_and_fetch(&PAGEREF(v), 1) > 0)
+80104973:	05 22 01 00 00       	add    $0x122,%eax
+80104978:	66 f0 83 ac 00 40 98 	lock subw $0x1,-0x7fdf67c0(%eax,%eax,1)
+8010497f:	20 80 01 
+80104982:	74 0c                	je     80104990 <kfree+0x60>
+  fl->head = r;
+  fl->nfree++;
+  if(kmem.use_lock)
+    release(&fl->lock);
+  popcli();
+}
+80104984:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104987:	5b                   	pop    %ebx
+80104988:	5e                   	pop    %esi
+80104989:	5d                   	pop    %ebp
+8010498a:	c3                   	ret
+8010498b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010498f:	90                   	nop
+  memset(v, 1, PGSIZE);
+80104990:	83 ec 04             	sub    $0x4,%esp
+    return &kmem.list[0];
+80104993:	be 44 98 20 80       	mov    $0x80209844,%esi
+  memset(v, 1, PGSIZE);
+80104998:	68 00 10 00 00       	push   $0x1000
+8010499d:	6a 01                	push   $0x1
+8010499f:	53                   	push   %ebx
+801049a0:	e8 eb 3a 00 00       	call   80108490 <memset>
+  pushcli();
+801049a5:	e8 66 37 00 00       	call   80108110 <pushcli>
+  if(!kmem.use_lock)
+801049aa:	8b 0d 40 98 20 80    	mov    0x80209840,%ecx
+801049b0:	83 c4 10             	add    $0x10,%esp
+801049b3:	85 c9                	test   %ecx,%ecx
+801049b5:	74 25                	je     801049dc <kfree+0xac>
+  return &kmem.list[cpuid()];
+801049b7:	e8 e4 22 00 00       	call   80106ca0 <cpuid>
+  if(kmem.use_lock)
+801049bc:	8b 15 40 98 20 80    	mov    0x80209840,%edx
+  return &kmem.list[cpuid()];
+801049c2:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+801049c5:	8d 34 c5 44 98 20 80 	lea    -0x7fdf67bc(,%eax,8),%esi
+  if(kmem.use_lock)
+801049cc:	85 d2                	test   %edx,%edx
+801049ce:	74 0c                	je     801049dc <kfree+0xac>
+    acquire(&fl->lock);
+801049d0:	83 ec 0c             	sub    $0xc,%esp
+801049d3:	56                   	push   %esi
+801049d4:	e8 87 37 00 00       	call   80108160 <acquire>
+801049d9:	83 c4 10             	add    $0x10,%esp
+  r->next = fl->head;
+801049dc:	8b 46 40             	mov    0x40(%esi),%eax
+801049df:	89 03                	mov    %eax,(%ebx)
+  if(kmem.use_lock)
+801049e1:	a1 40 98 20 80       	mov    0x80209840,%eax
+  fl->nfree++;
+801049e6:	83 46 44 01          	addl   $0x1,0x44(%esi)
+  fl->head = r;
+801049ea:	89 5e 40             	mov    %ebx,0x40(%esi)
+  if(kmem.use_lock)
+801049ed:	85 c0                	test   %eax,%eax
+801049ef:	75 0f                	jne    80104a00 <kfree+0xd0>
+}
+801049f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801049f4:	5b                   	pop    %ebx
+801049f5:	5e                   	pop    %esi
+801049f6:	5d                   	pop    %ebp
+  popcli();
+801049f7:	e9 44 39 00 00       	jmp    80108340 <popcli>
+801049fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    release(&fl->lock);
+80104a00:	83 ec 0c             	sub    $0xc,%esp
+80104a03:	56                   	push   %esi
+80104a04:	e8 97 39 00 00       	call   801083a0 <release>
+80104a09:	83 c4 10             	add    $0x10,%esp
+}
+80104a0c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104a0f:	5b                   	pop    %ebx
+80104a10:	5e                   	pop    %esi
+80104a11:	5d                   	pop    %ebp
+  popcli();
+80104a12:	e9 29 39 00 00       	jmp    80108340 <popcli>
+    panic("kfree");
+80104a17:	83 ec 0c             	sub    $0xc,%esp
+80104a1a:	68 72 b9 10 80       	push   $0x8010b972
+80104a1f:	e8 3c bc ff ff       	call   80100660 <panic>
+    panic("kfree: ref");
+80104a24:	83 ec 0c             	sub    $0xc,%esp
+80104a27:	68 78 b9 10 80       	push   $0x8010b978
+80104a2c:	e8 2f bc ff ff       	call   80100660 <panic>
+80104a31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104a38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104a3f:	90                   	nop
+
+80104a40 <freerange>:
+{
+80104a40:	55                   	push   %ebp
+80104a41:	89 e5                	mov    %esp,%ebp
+80104a43:	56                   	push   %esi
+80104a44:	53                   	push   %ebx
+  p = (char*)PGROUNDUP((uint)vstart);
+80104a45:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+80104a48:	8b 75 0c             	mov    0xc(%ebp),%esi
+  p = (char*)PGROUNDUP((uint)vstart);
+80104a4b:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80104a51:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80104a57:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+80104a5d:	39 de                	cmp    %ebx,%esi
+80104a5f:	72 39                	jb     80104a9a <freerange+0x5a>
+80104a61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    PAGEREF(p) = 1;
+80104a68:	8d 83 00 f0 ff 7f    	lea    0x7ffff000(%ebx),%eax
+80104a6e:	ba 01 00 00 00       	mov    $0x1,%edx
+    kfree(p);
+80104a73:	83 ec 0c             	sub    $0xc,%esp
+    PAGEREF(p) = 1;
+80104a76:	c1 e8 0c             	shr    $0xc,%eax
+80104a79:	66 89 94 00 84 9a 20 	mov    %dx,-0x7fdf657c(%eax,%eax,1)
+80104a80:	80 
+    kfree(p);
+80104a81:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80104a87:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+80104a8d:	50                   	push   %eax
+80104a8e:	e8 9d fe ff ff       	call   80104930 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80104a93:	83 c4 10             	add    $0x10,%esp
+80104a96:	39 de                	cmp    %ebx,%esi
+80104a98:	73 ce                	jae    80104a68 <freerange+0x28>
+}
+80104a9a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104a9d:	5b                   	pop    %ebx
+80104a9e:	5e                   	pop    %esi
+80104a9f:	5d                   	pop    %ebp
+80104aa0:	c3                   	ret
+80104aa1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104aa8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104aaf:	90                   	nop
+
+80104ab0 <kinit2>:
+{
+80104ab0:	55                   	push   %ebp
+80104ab1:	89 e5                	mov    %esp,%ebp
+80104ab3:	56                   	push   %esi
+80104ab4:	53                   	push   %ebx
+  p = (char*)PGROUNDUP((uint)vstart);
+80104ab5:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+80104ab8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  p = (char*)PGROUNDUP((uint)vstart);
+80104abb:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80104ac1:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80104ac7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+80104acd:	39 de                	cmp    %ebx,%esi
+80104acf:	72 39                	jb     80104b0a <kinit2+0x5a>
+80104ad1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    PAGEREF(p) = 1;
+80104ad8:	8d 83 00 f0 ff 7f    	lea    0x7ffff000(%ebx),%eax
+80104ade:	ba 01 00 00 00       	mov    $0x1,%edx
+    kfree(p);
+80104ae3:	83 ec 0c             	sub    $0xc,%esp
+    PAGEREF(p) = 1;
+80104ae6:	c1 e8 0c             	shr    $0xc,%eax
+80104ae9:	66 89 94 00 84 9a 20 	mov    %dx,-0x7fdf657c(%eax,%eax,1)
+80104af0:	80 
+    kfree(p);
+80104af1:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80104af7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+80104afd:	50                   	push   %eax
+80104afe:	e8 2d fe ff ff       	call   80104930 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80104b03:	83 c4 10             	add    $0x10,%esp
+80104b06:	39 de                	cmp    %ebx,%esi
+80104b08:	73 ce                	jae    80104ad8 <kinit2+0x28>
+  kmem.use_lock = 1;
+80104b0a:	c7 05 40 98 20 80 01 	movl   $0x1,0x80209840
+80104b11:	00 00 00 
+}
+80104b14:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104b17:	5b                   	pop    %ebx
+80104b18:	5e                   	pop    %esi
+80104b19:	5d                   	pop    %ebp
+80104b1a:	c3                   	ret
+80104b1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104b1f:	90                   	nop
+
+80104b20 <kinit1>:
+{
+80104b20:	55                   	push   %ebp
+80104b21:	89 e5                	mov    %esp,%ebp
+80104b23:	56                   	push   %esi
+80104b24:	53                   	push   %ebx
+80104b25:	8b 75 0c             	mov    0xc(%ebp),%esi
+80104b28:	bb 44 98 20 80       	mov    $0x80209844,%ebx
+80104b2d:	8d 76 00             	lea    0x0(%esi),%esi
+    initlock(&kmem.list[i].lock, "kmem");
+80104b30:	83 ec 08             	sub    $0x8,%esp
+80104b33:	68 83 b9 10 80       	push   $0x8010b983
+80104b38:	53                   	push   %ebx
+  for(i = 0; i < NCPU; i++)
+80104b39:	83 c3 48             	add    $0x48,%ebx
+    initlock(&kmem.list[i].lock, "kmem");
+80104b3c:	e8 cf 33 00 00       	call   80107f10 <initlock>
+  for(i = 0; i < NCPU; i++)
+80104b41:	83 c4 10             	add    $0x10,%esp
+80104b44:	81 fb 84 9a 20 80    	cmp    $0x80209a84,%ebx
+80104b4a:	75 e4                	jne    80104b30 <kinit1+0x10>
+  kmem.use_lock = 0;
+80104b4c:	c7 05 40 98 20 80 00 	movl   $0x0,0x80209840
+80104b53:	00 00 00 
+  p = (char*)PGROUNDUP((uint)vstart);
+80104b56:	8b 45 08             	mov    0x8(%ebp),%eax
+80104b59:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80104b5f:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80104b65:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+80104b6b:	39 de                	cmp    %ebx,%esi
+80104b6d:	72 33                	jb     80104ba2 <kinit1+0x82>
+80104b6f:	90                   	nop
+    PAGEREF(p) = 1;
+80104b70:	8d 83 00 f0 ff 7f    	lea    0x7ffff000(%ebx),%eax
+80104b76:	ba 01 00 00 00       	mov    $0x1,%edx
+    kfree(p);
+80104b7b:	83 ec 0c             	sub    $0xc,%esp
+    PAGEREF(p) = 1;
+80104b7e:	c1 e8 0c             	shr    $0xc,%eax
+80104b81:	66 89 94 00 84 9a 20 	mov    %dx,-0x7fdf657c(%eax,%eax,1)
+80104b88:	80 
+    kfree(p);
+80104b89:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80104b8f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+80104b95:	50                   	push   %eax
+80104b96:	e8 95 fd ff ff       	call   80104930 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80104b9b:	83 c4 10             	add    $0x10,%esp
+80104b9e:	39 de                	cmp    %ebx,%esi
+80104ba0:	73 ce                	jae    80104b70 <kinit1+0x50>
+}
+80104ba2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104ba5:	5b                   	pop    %ebx
+80104ba6:	5e                   	pop    %esi
+80104ba7:	5d                   	pop    %ebp
+80104ba8:	c3                   	ret
+80104ba9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80104bb0 <kalloc>:
+// Allocate one 4096-byte page of physical memory.
+// Returns a pointer that the kernel can use.
+// Returns 0 if the memory cannot be allocated.
+char*
+kalloc(void)
+{
+80104bb0:	55                   	push   %ebp
+80104bb1:	89 e5                	mov    %esp,%ebp
+80104bb3:	57                   	push   %edi
+    return &kmem.list[0];
+80104bb4:	bf 44 98 20 80       	mov    $0x80209844,%edi
+{
+80104bb9:	56                   	push   %esi
+80104bba:	53                   	push   %ebx
+80104bbb:	83 ec 1c             	sub    $0x1c,%esp
+  struct run *r, *tail;
+  struct freelist *fl;
+  int n;
+
+  pushcli();
+80104bbe:	e8 4d 35 00 00       	call   80108110 <pushcli>
+  if(!kmem.use_lock)
+80104bc3:	a1 40 98 20 80       	mov    0x80209840,%eax
+80104bc8:	85 c0                	test   %eax,%eax
+80104bca:	75 3c                	jne    80104c08 <kalloc+0x58>
+  fl = mylist();
+  if(!kmem.use_lock){
+    r = fl->head;
+80104bcc:	8b 77 40             	mov    0x40(%edi),%esi
+    if(r){
+80104bcf:	85 f6                	test   %esi,%esi
+80104bd1:	0f 84 cb 00 00 00    	je     80104ca2 <kalloc+0xf2>
+      fl->head = r->next;
+80104bd7:	8b 06                	mov    (%esi),%eax
+      fl->nfree--;
+80104bd9:	83 6f 44 01          	subl   $0x1,0x44(%edi)
+    }
+    popcli();
+    if(r)
+      PAGEREF(r) = 1;
+80104bdd:	bb 01 00 00 00       	mov    $0x1,%ebx
+      fl->head = r->next;
+80104be2:	89 47 40             	mov    %eax,0x40(%edi)
+    popcli();
+80104be5:	e8 56 37 00 00       	call   80108340 <popcli>
+      PAGEREF(r) = 1;
+80104bea:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+80104bf0:	c1 e8 0c             	shr    $0xc,%eax
+80104bf3:	66 89 9c 00 84 9a 20 	mov    %bx,-0x7fdf657c(%eax,%eax,1)
+80104bfa:	80 
+  }
+  popcli();
+  if(r)
+    PAGEREF(r) = 1;
+  return (char*)r;
+}
+80104bfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104bfe:	89 f0                	mov    %esi,%eax
+80104c00:	5b                   	pop    %ebx
+80104c01:	5e                   	pop    %esi
+80104c02:	5f                   	pop    %edi
+80104c03:	5d                   	pop    %ebp
+80104c04:	c3                   	ret
+80104c05:	8d 76 00             	lea    0x0(%esi),%esi
+  return &kmem.list[cpuid()];
+80104c08:	e8 93 20 00 00       	call   80106ca0 <cpuid>
+  if(!kmem.use_lock){
+80104c0d:	8b 35 40 98 20 80    	mov    0x80209840,%esi
+  return &kmem.list[cpuid()];
+80104c13:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+80104c1a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80104c1d:	01 d0                	add    %edx,%eax
+80104c1f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80104c22:	8d 1c c5 00 00 00 00 	lea    0x0(,%eax,8),%ebx
+80104c29:	01 df                	add    %ebx,%edi
+  if(!kmem.use_lock){
+80104c2b:	85 f6                	test   %esi,%esi
+80104c2d:	74 9d                	je     80104bcc <kalloc+0x1c>
+  acquire(&fl->lock);
+80104c2f:	83 ec 0c             	sub    $0xc,%esp
+80104c32:	57                   	push   %edi
+80104c33:	e8 28 35 00 00       	call   80108160 <acquire>
+  r = fl->head;
+80104c38:	8d 83 40 98 20 80    	lea    -0x7fdf67c0(%ebx),%eax
+  if(r){
+80104c3e:	83 c4 10             	add    $0x10,%esp
+  r = fl->head;
+80104c41:	8b 70 44             	mov    0x44(%eax),%esi
+  if(r){
+80104c44:	85 f6                	test   %esi,%esi
+80104c46:	74 70                	je     80104cb8 <kalloc+0x108>
+    fl->head = r->next;
+80104c48:	8b 0e                	mov    (%esi),%ecx
+  release(&fl->lock);
+80104c4a:	83 ec 0c             	sub    $0xc,%esp
+    fl->nfree--;
+80104c4d:	83 68 48 01          	subl   $0x1,0x48(%eax)
+    fl->head = r->next;
+80104c51:	89 48 44             	mov    %ecx,0x44(%eax)
+  release(&fl->lock);
+80104c54:	57                   	push   %edi
+80104c55:	e8 46 37 00 00       	call   801083a0 <release>
+  popcli();
+80104c5a:	e8 e1 36 00 00       	call   80108340 <popcli>
+80104c5f:	83 c4 10             	add    $0x10,%esp
+    PAGEREF(r) = 1;
+80104c62:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+80104c68:	ba 01 00 00 00       	mov    $0x1,%edx
+80104c6d:	c1 e8 0c             	shr    $0xc,%eax
+80104c70:	66 89 94 00 84 9a 20 	mov    %dx,-0x7fdf657c(%eax,%eax,1)
+80104c77:	80 
+}
+80104c78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104c7b:	89 f0                	mov    %esi,%eax
+80104c7d:	5b                   	pop    %ebx
+80104c7e:	5e                   	pop    %esi
+80104c7f:	5f                   	pop    %edi
+80104c80:	5d                   	pop    %ebp
+80104c81:	c3                   	ret
+      release(&fl->lock);
+80104c82:	83 ec 0c             	sub    $0xc,%esp
+80104c85:	53                   	push   %ebx
+80104c86:	e8 15 37 00 00       	call   801083a0 <release>
+      continue;
+80104c8b:	83 c4 10             	add    $0x10,%esp
+80104c8e:	66 90                	xchg   %ax,%ax
+  for(i = 0; i < ncpu; i++){
+80104c90:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+80104c94:	83 c3 48             	add    $0x48,%ebx
+80104c97:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80104c9a:	3b 05 64 71 22 80    	cmp    0x80227164,%eax
+80104ca0:	7c 3a                	jl     80104cdc <kalloc+0x12c>
+    popcli();
+80104ca2:	e8 99 36 00 00       	call   80108340 <popcli>
+80104ca7:	31 f6                	xor    %esi,%esi
+}
+80104ca9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104cac:	5b                   	pop    %ebx
+80104cad:	89 f0                	mov    %esi,%eax
+80104caf:	5e                   	pop    %esi
+80104cb0:	5f                   	pop    %edi
+80104cb1:	5d                   	pop    %ebp
+80104cb2:	c3                   	ret
+80104cb3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104cb7:	90                   	nop
+  release(&fl->lock);
+80104cb8:	83 ec 0c             	sub    $0xc,%esp
+80104cbb:	57                   	push   %edi
+80104cbc:	e8 df 36 00 00       	call   801083a0 <release>
+  for(i = 0; i < ncpu; i++){
+80104cc1:	8b 0d 64 71 22 80    	mov    0x80227164,%ecx
+80104cc7:	ba 44 98 20 80       	mov    $0x80209844,%edx
+80104ccc:	83 c4 10             	add    $0x10,%esp
+80104ccf:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+80104cd6:	89 d3                	mov    %edx,%ebx
+80104cd8:	85 c9                	test   %ecx,%ecx
+80104cda:	7e c6                	jle    80104ca2 <kalloc+0xf2>
+    if(fl == self)
+80104cdc:	39 df                	cmp    %ebx,%edi
+80104cde:	74 b0                	je     80104c90 <kalloc+0xe0>
+    acquire(&fl->lock);
+80104ce0:	83 ec 0c             	sub    $0xc,%esp
+80104ce3:	53                   	push   %ebx
+80104ce4:	e8 77 34 00 00       	call   80108160 <acquire>
+    head = fl->head;
+80104ce9:	8b 73 40             	mov    0x40(%ebx),%esi
+    if(head == 0){
+80104cec:	83 c4 10             	add    $0x10,%esp
+80104cef:	85 f6                	test   %esi,%esi
+80104cf1:	74 8f                	je     80104c82 <kalloc+0xd2>
+    head = fl->head;
+80104cf3:	89 da                	mov    %ebx,%edx
+    for(n = 1; n < NSTEAL && tail->next; n++)
+80104cf5:	b8 01 00 00 00       	mov    $0x1,%eax
+    head = fl->head;
+80104cfa:	89 f3                	mov    %esi,%ebx
+80104cfc:	eb 0e                	jmp    80104d0c <kalloc+0x15c>
+80104cfe:	66 90                	xchg   %ax,%ax
+    for(n = 1; n < NSTEAL && tail->next; n++)
+80104d00:	83 c0 01             	add    $0x1,%eax
+80104d03:	83 f8 20             	cmp    $0x20,%eax
+80104d06:	0f 84 a4 00 00 00    	je     80104db0 <kalloc+0x200>
+80104d0c:	89 d9                	mov    %ebx,%ecx
+80104d0e:	8b 1b                	mov    (%ebx),%ebx
+80104d10:	85 db                	test   %ebx,%ebx
+80104d12:	75 ec                	jne    80104d00 <kalloc+0x150>
+    fl->head = tail->next;
+80104d14:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+80104d17:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+    release(&fl->lock);
+80104d1a:	83 ec 0c             	sub    $0xc,%esp
+    fl->nfree -= n;
+80104d1d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    fl->head = tail->next;
+80104d20:	8d 1c c9             	lea    (%ecx,%ecx,8),%ebx
+80104d23:	8d 1c dd 40 98 20 80 	lea    -0x7fdf67c0(,%ebx,8),%ebx
+    fl->nfree -= n;
+80104d2a:	29 43 48             	sub    %eax,0x48(%ebx)
+    fl->head = tail->next;
+80104d2d:	c7 43 44 00 00 00 00 	movl   $0x0,0x44(%ebx)
+    release(&fl->lock);
+80104d34:	52                   	push   %edx
+80104d35:	e8 66 36 00 00       	call   801083a0 <release>
+    tail->next = 0;
+80104d3a:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  if(r == 0 && (r = steal(fl, &n)) != 0 && n > 1){
+80104d3d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80104d40:	83 c4 10             	add    $0x10,%esp
+    tail->next = 0;
+80104d43:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+  if(r == 0 && (r = steal(fl, &n)) != 0 && n > 1){
+80104d49:	83 f8 01             	cmp    $0x1,%eax
+80104d4c:	74 52                	je     80104da0 <kalloc+0x1f0>
+    for(tail = r->next; tail->next; tail = tail->next)
+80104d4e:	8b 0e                	mov    (%esi),%ecx
+80104d50:	89 cb                	mov    %ecx,%ebx
+80104d52:	8b 09                	mov    (%ecx),%ecx
+80104d54:	85 c9                	test   %ecx,%ecx
+80104d56:	75 f8                	jne    80104d50 <kalloc+0x1a0>
+    acquire(&fl->lock);
+80104d58:	83 ec 0c             	sub    $0xc,%esp
+80104d5b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80104d5e:	57                   	push   %edi
+80104d5f:	e8 fc 33 00 00       	call   80108160 <acquire>
+    tail->next = fl->head;
+80104d64:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80104d67:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80104d6a:	01 c1                	add    %eax,%ecx
+    fl->nfree += n - 1;
+80104d6c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    tail->next = fl->head;
+80104d6f:	8d 0c cd 40 98 20 80 	lea    -0x7fdf67c0(,%ecx,8),%ecx
+80104d76:	8b 51 44             	mov    0x44(%ecx),%edx
+80104d79:	89 13                	mov    %edx,(%ebx)
+    fl->head = r->next;
+80104d7b:	8b 1e                	mov    (%esi),%ebx
+80104d7d:	89 59 44             	mov    %ebx,0x44(%ecx)
+    fl->nfree += n - 1;
+80104d80:	8b 59 48             	mov    0x48(%ecx),%ebx
+80104d83:	8d 44 18 ff          	lea    -0x1(%eax,%ebx,1),%eax
+80104d87:	89 41 48             	mov    %eax,0x48(%ecx)
+    release(&fl->lock);
+80104d8a:	89 3c 24             	mov    %edi,(%esp)
+80104d8d:	e8 0e 36 00 00       	call   801083a0 <release>
+  popcli();
+80104d92:	e8 a9 35 00 00       	call   80108340 <popcli>
+80104d97:	83 c4 10             	add    $0x10,%esp
+80104d9a:	e9 c3 fe ff ff       	jmp    80104c62 <kalloc+0xb2>
+80104d9f:	90                   	nop
+80104da0:	e8 9b 35 00 00       	call   80108340 <popcli>
+  if(r)
+80104da5:	e9 b8 fe ff ff       	jmp    80104c62 <kalloc+0xb2>
+80104daa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fl->head = tail->next;
+80104db0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80104db3:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    release(&fl->lock);
+80104db6:	83 ec 0c             	sub    $0xc,%esp
+    fl->head = tail->next;
+80104db9:	8d 0c c0             	lea    (%eax,%eax,8),%ecx
+80104dbc:	8b 03                	mov    (%ebx),%eax
+80104dbe:	8d 0c cd 40 98 20 80 	lea    -0x7fdf67c0(,%ecx,8),%ecx
+80104dc5:	89 41 44             	mov    %eax,0x44(%ecx)
+    fl->nfree -= n;
+80104dc8:	83 69 48 20          	subl   $0x20,0x48(%ecx)
+    release(&fl->lock);
+80104dcc:	52                   	push   %edx
+80104dcd:	e8 ce 35 00 00       	call   801083a0 <release>
+    tail->next = 0;
+80104dd2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return head;
+80104dd8:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    tail->next = 0;
+80104ddb:	83 c4 10             	add    $0x10,%esp
+80104dde:	e9 6b ff ff ff       	jmp    80104d4e <kalloc+0x19e>
+80104de3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104dea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80104df0 <kaddref>:
+
+// Add a reference to the allocated page pointed at by v.
+void
+kaddref(char *v)
+{
+80104df0:	55                   	push   %ebp
+80104df1:	89 e5                	mov    %esp,%ebp
+80104df3:	83 ec 08             	sub    $0x8,%esp
+80104df6:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP || PAGEREF(v) == 0)
+80104df9:	a9 ff 0f 00 00       	test   $0xfff,%eax
+80104dfe:	75 32                	jne    80104e32 <kaddref+0x42>
+80104e00:	3d f0 78 23 80       	cmp    $0x802378f0,%eax
+80104e05:	72 2b                	jb     80104e32 <kaddref+0x42>
+80104e07:	05 00 00 00 80       	add    $0x80000000,%eax
+80104e0c:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+80104e11:	77 1f                	ja     80104e32 <kaddref+0x42>
+80104e13:	c1 e8 0c             	shr    $0xc,%eax
+80104e16:	66 83 bc 00 84 9a 20 	cmpw   $0x0,-0x7fdf657c(%eax,%eax,1)
+80104e1d:	80 00 
+80104e1f:	74 11                	je     80104e32 <kaddref+0x42>
+    panic("kaddref");
+  __sync_add_and_fetch(&PAGEREF(v), 1);
+80104e21:	05 22 01 00 00       	add    $0x122,%eax
+80104e26:	66 f0 83 84 00 40 98 	lock addw $0x1,-0x7fdf67c0(%eax,%eax,1)
+80104e2d:	20 80 01 
+}
+80104e30:	c9                   	leave
+80104e31:	c3                   	ret
+    panic("kaddref");
+80104e32:	83 ec 0c             	sub    $0xc,%esp
+80104e35:	68 88 b9 10 80       	push   $0x8010b988
+80104e3a:	e8 21 b8 ff ff       	call   80100660 <panic>
+80104e3f:	90                   	nop
+
+80104e40 <krefcnt>:
+
+// Return the number of references to the page pointed at by v.
+int
+krefcnt(char *v)
+{
+80104e40:	55                   	push   %ebp
+80104e41:	89 e5                	mov    %esp,%ebp
+  return PAGEREF(v);
+80104e43:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+80104e46:	5d                   	pop    %ebp
+  return PAGEREF(v);
+80104e47:	05 00 00 00 80       	add    $0x80000000,%eax
+80104e4c:	c1 e8 0c             	shr    $0xc,%eax
+80104e4f:	0f b7 84 00 84 9a 20 	movzwl -0x7fdf657c(%eax,%eax,1),%eax
+80104e56:	80 
+}
+80104e57:	c3                   	ret
+80104e58:	66 90                	xchg   %ax,%ax
+80104e5a:	66 90                	xchg   %ax,%ax
+80104e5c:	66 90                	xchg   %ax,%ax
+80104e5e:	66 90                	xchg   %ax,%ax
+
+80104e60 <kbdgetc>:
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104e60:	ba 64 00 00 00       	mov    $0x64,%edx
+80104e65:	ec                   	in     (%dx),%al
+    normalmap, shiftmap, ctlmap, ctlmap
+  };
+  uint st, data, c;
+
+  st = inb(KBSTATP);
+  if((st & KBS_DIB) == 0)
+80104e66:	a8 01                	test   $0x1,%al
+80104e68:	0f 84 c2 00 00 00    	je     80104f30 <kbdgetc+0xd0>
+{
+80104e6e:	55                   	push   %ebp
+80104e6f:	ba 60 00 00 00       	mov    $0x60,%edx
+80104e74:	89 e5                	mov    %esp,%ebp
+80104e76:	53                   	push   %ebx
+80104e77:	ec                   	in     (%dx),%al
+    return -1;
+  data = inb(KBDATAP);
+
+  if(data == 0xE0){
+    shift |= E0ESC;
+80104e78:	8b 1d 84 5a 22 80    	mov    0x80225a84,%ebx
+  data = inb(KBDATAP);
+80104e7e:	0f b6 c8             	movzbl %al,%ecx
+  if(data == 0xE0){
+80104e81:	3c e0                	cmp    $0xe0,%al
+80104e83:	74 5b                	je     80104ee0 <kbdgetc+0x80>
+    return 0;
+  } else if(data & 0x80){
+    // Key released
+    data = (shift & E0ESC ? data : data & 0x7F);
+80104e85:	89 da                	mov    %ebx,%edx
+80104e87:	83 e2 40             	and    $0x40,%edx
+  } else if(data & 0x80){
+80104e8a:	84 c0                	test   %al,%al
+80104e8c:	78 6a                	js     80104ef8 <kbdgetc+0x98>
+    shift &= ~(shiftcode[data] | E0ESC);
+    return 0;
+  } else if(shift & E0ESC){
+80104e8e:	85 d2                	test   %edx,%edx
+80104e90:	74 09                	je     80104e9b <kbdgetc+0x3b>
+    // Last character was an E0 escape; or with 0x80
+    data |= 0x80;
+80104e92:	83 c8 80             	or     $0xffffff80,%eax
+    shift &= ~E0ESC;
+80104e95:	83 e3 bf             	and    $0xffffffbf,%ebx
+    data |= 0x80;
+80104e98:	0f b6 c8             	movzbl %al,%ecx
+  }
+
+  shift |= shiftcode[data];
+80104e9b:	0f b6 91 c0 ba 10 80 	movzbl -0x7fef4540(%ecx),%edx
+  shift ^= togglecode[data];
+80104ea2:	0f b6 81 c0 b9 10 80 	movzbl -0x7fef4640(%ecx),%eax
+  shift |= shiftcode[data];
+80104ea9:	09 da                	or     %ebx,%edx
+  shift ^= togglecode[data];
+80104eab:	31 c2                	xor    %eax,%edx
+  c = charcode[shift & (CTL | SHIFT)][data];
+80104ead:	89 d0                	mov    %edx,%eax
+  shift ^= togglecode[data];
+80104eaf:	89 15 84 5a 22 80    	mov    %edx,0x80225a84
+  c = charcode[shift & (CTL | SHIFT)][data];
+80104eb5:	83 e0 03             	and    $0x3,%eax
+  if(shift & CAPSLOCK){
+80104eb8:	83 e2 08             	and    $0x8,%edx
+  c = charcode[shift & (CTL | SHIFT)][data];
+80104ebb:	8b 04 85 a0 b9 10 80 	mov    -0x7fef4660(,%eax,4),%eax
+80104ec2:	0f b6 04 08          	movzbl (%eax,%ecx,1),%eax
+  if(shift & CAPSLOCK){
+80104ec6:	74 0b                	je     80104ed3 <kbdgetc+0x73>
+    if('a' <= c && c <= 'z')
+80104ec8:	8d 50 9f             	lea    -0x61(%eax),%edx
+80104ecb:	83 fa 19             	cmp    $0x19,%edx
+80104ece:	77 48                	ja     80104f18 <kbdgetc+0xb8>
+      c += 'A' - 'a';
+80104ed0:	83 e8 20             	sub    $0x20,%eax
+    else if('A' <= c && c <= 'Z')
+      c += 'a' - 'A';
+  }
+  return c;
+}
+80104ed3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104ed6:	c9                   	leave
+80104ed7:	c3                   	ret
+80104ed8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104edf:	90                   	nop
+    shift |= E0ESC;
+80104ee0:	89 d8                	mov    %ebx,%eax
+80104ee2:	83 c8 40             	or     $0x40,%eax
+    shift &= ~(shiftcode[data] | E0ESC);
+80104ee5:	a3 84 5a 22 80       	mov    %eax,0x80225a84
+    return 0;
+80104eea:	31 c0                	xor    %eax,%eax
+}
+80104eec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104eef:	c9                   	leave
+80104ef0:	c3                   	ret
+80104ef1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    data = (shift & E0ESC ? data : data & 0x7F);
+80104ef8:	83 e0 7f             	and    $0x7f,%eax
+80104efb:	85 d2                	test   %edx,%edx
+80104efd:	0f 44 c8             	cmove  %eax,%ecx
+    shift &= ~(shiftcode[data] | E0ESC);
+80104f00:	0f b6 81 c0 ba 10 80 	movzbl -0x7fef4540(%ecx),%eax
+80104f07:	83 c8 40             	or     $0x40,%eax
+80104f0a:	0f b6 c0             	movzbl %al,%eax
+80104f0d:	f7 d0                	not    %eax
+80104f0f:	21 d8                	and    %ebx,%eax
+    return 0;
+80104f11:	eb d2                	jmp    80104ee5 <kbdgetc+0x85>
+80104f13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104f17:	90                   	nop
+    else if('A' <= c && c <= 'Z')
+80104f18:	8d 48 bf             	lea    -0x41(%eax),%ecx
+      c += 'a' - 'A';
+80104f1b:	8d 50 20             	lea    0x20(%eax),%edx
+}
+80104f1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104f21:	c9                   	leave
+      c += 'a' - 'A';
+80104f22:	83 f9 1a             	cmp    $0x1a,%ecx
+80104f25:	0f 42 c2             	cmovb  %edx,%eax
+}
+80104f28:	c3                   	ret
+80104f29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+80104f30:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80104f35:	c3                   	ret
+80104f36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104f3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80104f40 <kbdintr>:
+
+void
+kbdintr(void)
+{
+80104f40:	55                   	push   %ebp
+80104f41:	89 e5                	mov    %esp,%ebp
+80104f43:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(kbdgetc);
+80104f46:	68 60 4e 10 80       	push   $0x80104e60
+80104f4b:	e8 50 bc ff ff       	call   80100ba0 <consoleintr>
+}
+80104f50:	83 c4 10             	add    $0x10,%esp
+80104f53:	c9                   	leave
+80104f54:	c3                   	ret
+80104f55:	66 90                	xchg   %ax,%ax
+80104f57:	66 90                	xchg   %ax,%ax
+80104f59:	66 90                	xchg   %ax,%ax
+80104f5b:	66 90                	xchg   %ax,%ax
+80104f5d:	66 90                	xchg   %ax,%ax
+80104f5f:	90                   	nop
+
+80104f60 <lapicinit>:
+}
+
+void
+lapicinit(void)
+{
+  if(!lapic)
+80104f60:	a1 88 5a 22 80       	mov    0x80225a88,%eax
+80104f65:	85 c0                	test   %eax,%eax
+80104f67:	0f 84 cb 00 00 00    	je     80105038 <lapicinit+0xd8>
+  lapic[index] = value;
+80104f6d:	c7 80 f0 00 00 00 3f 	movl   $0x13f,0xf0(%eax)
+80104f74:	01 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104f77:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80104f7a:	c7 80 e0 03 00 00 0b 	movl   $0xb,0x3e0(%eax)
+80104f81:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104f84:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80104f87:	c7 80 20 03 00 00 20 	movl   $0x20020,0x320(%eax)
+80104f8e:	00 02 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104f91:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80104f94:	c7 80 80 03 00 00 80 	movl   $0x989680,0x380(%eax)
+80104f9b:	96 98 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104f9e:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80104fa1:	c7 80 50 03 00 00 00 	movl   $0x10000,0x350(%eax)
+80104fa8:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104fab:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80104fae:	c7 80 60 03 00 00 00 	movl   $0x10000,0x360(%eax)
+80104fb5:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104fb8:	8b 50 20             	mov    0x20(%eax),%edx
+  lapicw(LINT0, MASKED);
+  lapicw(LINT1, MASKED);
+
+  // Disable performance counter overflow interrupts
+  // on machines that provide that interrupt entry.
+  if(((lapic[VER]>>16) & 0xFF) >= 4)
+80104fbb:	8b 50 30             	mov    0x30(%eax),%edx
+80104fbe:	c1 ea 10             	shr    $0x10,%edx
+80104fc1:	81 e2 fc 00 00 00    	and    $0xfc,%edx
+80104fc7:	75 77                	jne    80105040 <lapicinit+0xe0>
+  lapic[index] = value;
+80104fc9:	c7 80 70 03 00 00 33 	movl   $0x33,0x370(%eax)
+80104fd0:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104fd3:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80104fd6:	c7 80 80 02 00 00 00 	movl   $0x0,0x280(%eax)
+80104fdd:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104fe0:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80104fe3:	c7 80 80 02 00 00 00 	movl   $0x0,0x280(%eax)
+80104fea:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104fed:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80104ff0:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+80104ff7:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104ffa:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80104ffd:	c7 80 10 03 00 00 00 	movl   $0x0,0x310(%eax)
+80105004:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80105007:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+8010500a:	c7 80 00 03 00 00 00 	movl   $0x88500,0x300(%eax)
+80105011:	85 08 00 
+  lapic[ID];  // wait for write to finish, by reading
+80105014:	8b 50 20             	mov    0x20(%eax),%edx
+80105017:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010501e:	66 90                	xchg   %ax,%ax
+  lapicw(EOI, 0);
+
+  // Send an Init Level De-Assert to synchronise arbitration ID's.
+  lapicw(ICRHI, 0);
+  lapicw(ICRLO, BCAST | INIT | LEVEL);
+  while(lapic[ICRLO] & DELIVS)
+80105020:	8b 90 00 03 00 00    	mov    0x300(%eax),%edx
+80105026:	80 e6 10             	and    $0x10,%dh
+80105029:	75 f5                	jne    80105020 <lapicinit+0xc0>
+  lapic[index] = value;
+8010502b:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%eax)
+80105032:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80105035:	8b 40 20             	mov    0x20(%eax),%eax
+    ;
+
+  // Enable interrupts on the APIC (but not on the processor).
+  lapicw(TPR, 0);
+}
+80105038:	c3                   	ret
+80105039:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  lapic[index] = value;
+80105040:	c7 80 40 03 00 00 00 	movl   $0x10000,0x340(%eax)
+80105047:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+8010504a:	8b 50 20             	mov    0x20(%eax),%edx
+}
+8010504d:	e9 77 ff ff ff       	jmp    80104fc9 <lapicinit+0x69>
+80105052:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105059:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80105060 <lapicid>:
+
+int
+lapicid(void)
+{
+  if (!lapic)
+80105060:	a1 88 5a 22 80       	mov    0x80225a88,%eax
+80105065:	85 c0                	test   %eax,%eax
+80105067:	74 07                	je     80105070 <lapicid+0x10>
+    return 0;
+  return lapic[ID] >> 24;
+80105069:	8b 40 20             	mov    0x20(%eax),%eax
+8010506c:	c1 e8 18             	shr    $0x18,%eax
+8010506f:	c3                   	ret
+    return 0;
+80105070:	31 c0                	xor    %eax,%eax
+}
+80105072:	c3                   	ret
+80105073:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010507a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80105080 <lapiceoi>:
+
+// Acknowledge interrupt.
+void
+lapiceoi(void)
+{
+  if(lapic)
+80105080:	a1 88 5a 22 80       	mov    0x80225a88,%eax
+80105085:	85 c0                	test   %eax,%eax
+80105087:	74 0d                	je     80105096 <lapiceoi+0x16>
+  lapic[index] = value;
+80105089:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+80105090:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80105093:	8b 40 20             	mov    0x20(%eax),%eax
+    lapicw(EOI, 0);
+}
+80105096:	c3                   	ret
+80105097:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010509e:	66 90                	xchg   %ax,%ax
+
+801050a0 <lapicipi>:
+
+// Send interrupt vector to the CPU with the given APIC ID.
+void
+lapicipi(uchar apicid, int vector)
+{
+801050a0:	55                   	push   %ebp
+  if(!lapic)
+801050a1:	8b 15 88 5a 22 80    	mov    0x80225a88,%edx
+{
+801050a7:	89 e5                	mov    %esp,%ebp
+801050a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(!lapic)
+801050ac:	85 d2                	test   %edx,%edx
+801050ae:	74 2b                	je     801050db <lapicipi+0x3b>
+  lapic[index] = value;
+801050b0:	c1 e0 18             	shl    $0x18,%eax
+801050b3:	89 82 10 03 00 00    	mov    %eax,0x310(%edx)
+  lapic[ID];  // wait for write to finish, by reading
+801050b9:	8b 42 20             	mov    0x20(%edx),%eax
+  lapic[index] = value;
+801050bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+801050bf:	89 82 00 03 00 00    	mov    %eax,0x300(%edx)
+  lapic[ID];  // wait for write to finish, by reading
+801050c5:	8b 42 20             	mov    0x20(%edx),%eax
+801050c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801050cf:	90                   	nop
+    return;
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | vector);
+  while(lapic[ICRLO] & DELIVS)
+801050d0:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+801050d6:	f6 c4 10             	test   $0x10,%ah
+801050d9:	75 f5                	jne    801050d0 <lapicipi+0x30>
+    ;
+}
+801050db:	5d                   	pop    %ebp
+801050dc:	c3                   	ret
+801050dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+801050e0 <microdelay>:
+// Spin for a given number of microseconds.
+// On real hardware would want to tune this dynamically.
+void
+microdelay(int us)
+{
+}
+801050e0:	c3                   	ret
+801050e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801050e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801050ef:	90                   	nop
+
+801050f0 <lapicstartap>:
+
+// Start additional processor running entry code at addr.
+// See Appendix B of MultiProcessor Specification.
+void
+lapicstartap(uchar apicid, uint addr)
+{
+801050f0:	55                   	push   %ebp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801050f1:	b8 0f 00 00 00       	mov    $0xf,%eax
+801050f6:	ba 70 00 00 00       	mov    $0x70,%edx
+801050fb:	89 e5                	mov    %esp,%ebp
+801050fd:	53                   	push   %ebx
+801050fe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80105101:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80105104:	ee                   	out    %al,(%dx)
+80105105:	b8 0a 00 00 00       	mov    $0xa,%eax
+8010510a:	ba 71 00 00 00       	mov    $0x71,%edx
+8010510f:	ee                   	out    %al,(%dx)
+  // and the warm reset vector (DWORD based at 40:67) to point at
+  // the AP startup code prior to the [universal startup algorithm]."
+  outb(CMOS_PORT, 0xF);  // offset 0xF is shutdown code
+  outb(CMOS_PORT+1, 0x0A);
+  wrv = (ushort*)P2V((0x40<<4 | 0x67));  // Warm reset vector
+  wrv[0] = 0;
+80105110:	31 c0                	xor    %eax,%eax
+  lapic[index] = value;
+80105112:	c1 e3 18             	shl    $0x18,%ebx
+  wrv[0] = 0;
+80105115:	66 a3 67 04 00 80    	mov    %ax,0x80000467
+  wrv[1] = addr >> 4;
+8010511b:	89 c8                	mov    %ecx,%eax
+  // when it is in the halted state due to an INIT.  So the second
+  // should be ignored, but it is part of the official Intel algorithm.
+  // Bochs complains about the second one.  Too bad for Bochs.
+  for(i = 0; i < 2; i++){
+    lapicw(ICRHI, apicid<<24);
+    lapicw(ICRLO, STARTUP | (addr>>12));
+8010511d:	c1 e9 0c             	shr    $0xc,%ecx
+  lapic[index] = value;
+80105120:	89 da                	mov    %ebx,%edx
+  wrv[1] = addr >> 4;
+80105122:	c1 e8 04             	shr    $0x4,%eax
+    lapicw(ICRLO, STARTUP | (addr>>12));
+80105125:	80 cd 06             	or     $0x6,%ch
+  wrv[1] = addr >> 4;
+80105128:	66 a3 69 04 00 80    	mov    %ax,0x80000469
+  lapic[index] = value;
+8010512e:	a1 88 5a 22 80       	mov    0x80225a88,%eax
+80105133:	89 98 10 03 00 00    	mov    %ebx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80105139:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+8010513c:	c7 80 00 03 00 00 00 	movl   $0xc500,0x300(%eax)
+80105143:	c5 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80105146:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80105149:	c7 80 00 03 00 00 00 	movl   $0x8500,0x300(%eax)
+80105150:	85 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80105153:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80105156:	89 90 10 03 00 00    	mov    %edx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+8010515c:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+8010515f:	89 88 00 03 00 00    	mov    %ecx,0x300(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80105165:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80105168:	89 90 10 03 00 00    	mov    %edx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+8010516e:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80105171:	89 88 00 03 00 00    	mov    %ecx,0x300(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80105177:	8b 40 20             	mov    0x20(%eax),%eax
+    microdelay(200);
+  }
+}
+8010517a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010517d:	c9                   	leave
+8010517e:	c3                   	ret
+8010517f:	90                   	nop
+
+80105180 <cmostime>:
+  r->year   = cmos_read(YEAR);
+}
+
+// qemu seems to use 24-hour GWT and the values are BCD encoded
+void cmostime(struct rtcdate *r)
+{
+80105180:	55                   	push   %ebp
+80105181:	b8 0b 00 00 00       	mov    $0xb,%eax
+80105186:	ba 70 00 00 00       	mov    $0x70,%edx
+8010518b:	89 e5                	mov    %esp,%ebp
+8010518d:	57                   	push   %edi
+8010518e:	56                   	push   %esi
+8010518f:	53                   	push   %ebx
+80105190:	83 ec 4c             	sub    $0x4c,%esp
+80105193:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80105194:	ba 71 00 00 00       	mov    $0x71,%edx
+80105199:	ec                   	in     (%dx),%al
+  struct rtcdate t1, t2;
+  int sb, bcd;
+
+  sb = cmos_read(CMOS_STATB);
+
+  bcd = (sb & (1 << 2)) == 0;
+8010519a:	83 e0 04             	and    $0x4,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010519d:	bf 70 00 00 00       	mov    $0x70,%edi
+801051a2:	88 45 b3             	mov    %al,-0x4d(%ebp)
+801051a5:	8d 76 00             	lea    0x0(%esi),%esi
+801051a8:	31 c0                	xor    %eax,%eax
+801051aa:	89 fa                	mov    %edi,%edx
+801051ac:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801051ad:	b9 71 00 00 00       	mov    $0x71,%ecx
+801051b2:	89 ca                	mov    %ecx,%edx
+801051b4:	ec                   	in     (%dx),%al
+801051b5:	88 45 b7             	mov    %al,-0x49(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801051b8:	89 fa                	mov    %edi,%edx
+801051ba:	b8 02 00 00 00       	mov    $0x2,%eax
+801051bf:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801051c0:	89 ca                	mov    %ecx,%edx
+801051c2:	ec                   	in     (%dx),%al
+801051c3:	88 45 b6             	mov    %al,-0x4a(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801051c6:	89 fa                	mov    %edi,%edx
+801051c8:	b8 04 00 00 00       	mov    $0x4,%eax
+801051cd:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801051ce:	89 ca                	mov    %ecx,%edx
+801051d0:	ec                   	in     (%dx),%al
+801051d1:	88 45 b5             	mov    %al,-0x4b(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801051d4:	89 fa                	mov    %edi,%edx
+801051d6:	b8 07 00 00 00       	mov    $0x7,%eax
+801051db:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801051dc:	89 ca                	mov    %ecx,%edx
+801051de:	ec                   	in     (%dx),%al
+801051df:	88 45 b4             	mov    %al,-0x4c(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801051e2:	89 fa                	mov    %edi,%edx
+801051e4:	b8 08 00 00 00       	mov    $0x8,%eax
+801051e9:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801051ea:	89 ca                	mov    %ecx,%edx
+801051ec:	ec                   	in     (%dx),%al
+801051ed:	89 c6                	mov    %eax,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801051ef:	89 fa                	mov    %edi,%edx
+801051f1:	b8 09 00 00 00       	mov    $0x9,%eax
+801051f6:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801051f7:	89 ca                	mov    %ecx,%edx
+801051f9:	ec                   	in     (%dx),%al
+801051fa:	0f b6 d8             	movzbl %al,%ebx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801051fd:	89 fa                	mov    %edi,%edx
+801051ff:	b8 0a 00 00 00       	mov    $0xa,%eax
+80105204:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80105205:	89 ca                	mov    %ecx,%edx
+80105207:	ec                   	in     (%dx),%al
+
+  // make sure CMOS doesn't modify time while we read it
+  for(;;) {
+    fill_rtcdate(&t1);
+    if(cmos_read(CMOS_STATA) & CMOS_UIP)
+80105208:	84 c0                	test   %al,%al
+8010520a:	78 9c                	js     801051a8 <cmostime+0x28>
+  return inb(CMOS_RETURN);
+8010520c:	0f b6 45 b7          	movzbl -0x49(%ebp),%eax
+80105210:	89 f2                	mov    %esi,%edx
+80105212:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+80105215:	0f b6 f2             	movzbl %dl,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80105218:	89 fa                	mov    %edi,%edx
+8010521a:	89 45 b8             	mov    %eax,-0x48(%ebp)
+8010521d:	0f b6 45 b6          	movzbl -0x4a(%ebp),%eax
+80105221:	89 75 c8             	mov    %esi,-0x38(%ebp)
+80105224:	89 45 bc             	mov    %eax,-0x44(%ebp)
+80105227:	0f b6 45 b5          	movzbl -0x4b(%ebp),%eax
+8010522b:	89 45 c0             	mov    %eax,-0x40(%ebp)
+8010522e:	0f b6 45 b4          	movzbl -0x4c(%ebp),%eax
+80105232:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+80105235:	31 c0                	xor    %eax,%eax
+80105237:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80105238:	89 ca                	mov    %ecx,%edx
+8010523a:	ec                   	in     (%dx),%al
+8010523b:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010523e:	89 fa                	mov    %edi,%edx
+80105240:	89 45 d0             	mov    %eax,-0x30(%ebp)
+80105243:	b8 02 00 00 00       	mov    $0x2,%eax
+80105248:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80105249:	89 ca                	mov    %ecx,%edx
+8010524b:	ec                   	in     (%dx),%al
+8010524c:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010524f:	89 fa                	mov    %edi,%edx
+80105251:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+80105254:	b8 04 00 00 00       	mov    $0x4,%eax
+80105259:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010525a:	89 ca                	mov    %ecx,%edx
+8010525c:	ec                   	in     (%dx),%al
+8010525d:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80105260:	89 fa                	mov    %edi,%edx
+80105262:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80105265:	b8 07 00 00 00       	mov    $0x7,%eax
+8010526a:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010526b:	89 ca                	mov    %ecx,%edx
+8010526d:	ec                   	in     (%dx),%al
+8010526e:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80105271:	89 fa                	mov    %edi,%edx
+80105273:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80105276:	b8 08 00 00 00       	mov    $0x8,%eax
+8010527b:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010527c:	89 ca                	mov    %ecx,%edx
+8010527e:	ec                   	in     (%dx),%al
+8010527f:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80105282:	89 fa                	mov    %edi,%edx
+80105284:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80105287:	b8 09 00 00 00       	mov    $0x9,%eax
+8010528c:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010528d:	89 ca                	mov    %ecx,%edx
+8010528f:	ec                   	in     (%dx),%al
+80105290:	0f b6 c0             	movzbl %al,%eax
+        continue;
+    fill_rtcdate(&t2);
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+80105293:	83 ec 04             	sub    $0x4,%esp
+  return inb(CMOS_RETURN);
+80105296:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+80105299:	8d 45 d0             	lea    -0x30(%ebp),%eax
+8010529c:	6a 18                	push   $0x18
+8010529e:	50                   	push   %eax
+8010529f:	8d 45 b8             	lea    -0x48(%ebp),%eax
+801052a2:	50                   	push   %eax
+801052a3:	e8 28 32 00 00       	call   801084d0 <memcmp>
+801052a8:	83 c4 10             	add    $0x10,%esp
+801052ab:	85 c0                	test   %eax,%eax
+801052ad:	0f 85 f5 fe ff ff    	jne    801051a8 <cmostime+0x28>
+      break;
+  }
+
+  // convert
+  if(bcd) {
+801052b3:	0f b6 75 b3          	movzbl -0x4d(%ebp),%esi
+801052b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801052ba:	89 f0                	mov    %esi,%eax
+801052bc:	84 c0                	test   %al,%al
+801052be:	75 78                	jne    80105338 <cmostime+0x1b8>
+#define    CONV(x)     (t1.x = ((t1.x >> 4) * 10) + (t1.x & 0xf))
+    CONV(second);
+801052c0:	8b 45 b8             	mov    -0x48(%ebp),%eax
+801052c3:	89 c2                	mov    %eax,%edx
+801052c5:	83 e0 0f             	and    $0xf,%eax
+801052c8:	c1 ea 04             	shr    $0x4,%edx
+801052cb:	8d 14 92             	lea    (%edx,%edx,4),%edx
+801052ce:	8d 04 50             	lea    (%eax,%edx,2),%eax
+801052d1:	89 45 b8             	mov    %eax,-0x48(%ebp)
+    CONV(minute);
+801052d4:	8b 45 bc             	mov    -0x44(%ebp),%eax
+801052d7:	89 c2                	mov    %eax,%edx
+801052d9:	83 e0 0f             	and    $0xf,%eax
+801052dc:	c1 ea 04             	shr    $0x4,%edx
+801052df:	8d 14 92             	lea    (%edx,%edx,4),%edx
+801052e2:	8d 04 50             	lea    (%eax,%edx,2),%eax
+801052e5:	89 45 bc             	mov    %eax,-0x44(%ebp)
+    CONV(hour  );
+801052e8:	8b 45 c0             	mov    -0x40(%ebp),%eax
+801052eb:	89 c2                	mov    %eax,%edx
+801052ed:	83 e0 0f             	and    $0xf,%eax
+801052f0:	c1 ea 04             	shr    $0x4,%edx
+801052f3:	8d 14 92             	lea    (%edx,%edx,4),%edx
+801052f6:	8d 04 50             	lea    (%eax,%edx,2),%eax
+801052f9:	89 45 c0             	mov    %eax,-0x40(%ebp)
+    CONV(day   );
+801052fc:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+801052ff:	89 c2                	mov    %eax,%edx
+80105301:	83 e0 0f             	and    $0xf,%eax
+80105304:	c1 ea 04             	shr    $0x4,%edx
+80105307:	8d 14 92             	lea    (%edx,%edx,4),%edx
+8010530a:	8d 04 50             	lea    (%eax,%edx,2),%eax
+8010530d:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    CONV(month );
+80105310:	8b 45 c8             	mov    -0x38(%ebp),%eax
+80105313:	89 c2                	mov    %eax,%edx
+80105315:	83 e0 0f             	and    $0xf,%eax
+80105318:	c1 ea 04             	shr    $0x4,%edx
+8010531b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+8010531e:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80105321:	89 45 c8             	mov    %eax,-0x38(%ebp)
+    CONV(year  );
+80105324:	8b 45 cc             	mov    -0x34(%ebp),%eax
+80105327:	89 c2                	mov    %eax,%edx
+80105329:	83 e0 0f             	and    $0xf,%eax
+8010532c:	c1 ea 04             	shr    $0x4,%edx
+8010532f:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80105332:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80105335:	89 45 cc             	mov    %eax,-0x34(%ebp)
+#undef     CONV
+  }
+
+  *r = t1;
+80105338:	8b 45 b8             	mov    -0x48(%ebp),%eax
+8010533b:	89 03                	mov    %eax,(%ebx)
+8010533d:	8b 45 bc             	mov    -0x44(%ebp),%eax
+80105340:	89 43 04             	mov    %eax,0x4(%ebx)
+80105343:	8b 45 c0             	mov    -0x40(%ebp),%eax
+80105346:	89 43 08             	mov    %eax,0x8(%ebx)
+80105349:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+8010534c:	89 43 0c             	mov    %eax,0xc(%ebx)
+8010534f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+80105352:	89 43 10             	mov    %eax,0x10(%ebx)
+80105355:	8b 45 cc             	mov    -0x34(%ebp),%eax
+80105358:	89 43 14             	mov    %eax,0x14(%ebx)
+  r->year += 2000;
+8010535b:	81 43 14 d0 07 00 00 	addl   $0x7d0,0x14(%ebx)
+}
+80105362:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105365:	5b                   	pop    %ebx
+80105366:	5e                   	pop    %esi
+80105367:	5f                   	pop    %edi
+80105368:	5d                   	pop    %ebp
+80105369:	c3                   	ret
+8010536a:	66 90                	xchg   %ax,%ax
+8010536c:	66 90                	xchg   %ax,%ax
+8010536e:	66 90                	xchg   %ax,%ax
+
+80105370 <write_head.constprop.0>:
+// Write in-memory log header to disk.
+// Writing the first header block, which holds the count,
+// is the true point at which the current transaction
+// commits, so it goes last.
+static void
+write_head(struct logheader *h)
+80105370:	55                   	push   %ebp
+80105371:	89 e5                	mov    %esp,%ebp
+80105373:	56                   	push   %esi
+80105374:	53                   	push   %ebx
+{
+  struct buf *buf;
+  uint off, m;
+
+  for(off = BSIZE; off < HDRBYTES(h->n); off += BSIZE){
+80105375:	a1 a4 61 22 80       	mov    0x802261a4,%eax
+8010537a:	8d 34 85 04 00 00 00 	lea    0x4(,%eax,4),%esi
+80105381:	81 fe 00 02 00 00    	cmp    $0x200,%esi
+80105387:	76 78                	jbe    80105401 <write_head.constprop.0+0x91>
+80105389:	bb 00 02 00 00       	mov    $0x200,%ebx
+8010538e:	66 90                	xchg   %ax,%ax
+    buf = bread(log.dev, log.start + off/BSIZE);
+80105390:	89 d8                	mov    %ebx,%eax
+80105392:	83 ec 08             	sub    $0x8,%esp
+80105395:	c1 e8 09             	shr    $0x9,%eax
+80105398:	03 05 e0 5a 22 80    	add    0x80225ae0,%eax
+8010539e:	50                   	push   %eax
+8010539f:	ff 35 f8 5a 22 80    	push   0x80225af8
+801053a5:	e8 b6 af ff ff       	call   80100360 <bread>
+    m = HDRBYTES(h->n) - off;
+    if(m > BSIZE)
+801053aa:	ba 00 02 00 00       	mov    $0x200,%edx
+      m = BSIZE;
+    memmove(buf->data, (char*)h + off, m);
+801053af:	83 c4 0c             	add    $0xc,%esp
+    buf = bread(log.dev, log.start + off/BSIZE);
+801053b2:	89 c6                	mov    %eax,%esi
+    m = HDRBYTES(h->n) - off;
+801053b4:	a1 a4 61 22 80       	mov    0x802261a4,%eax
+801053b9:	8d 04 85 04 00 00 00 	lea    0x4(,%eax,4),%eax
+801053c0:	29 d8                	sub    %ebx,%eax
+    if(m > BSIZE)
+801053c2:	39 d0                	cmp    %edx,%eax
+801053c4:	0f 47 c2             	cmova  %edx,%eax
+    memmove(buf->data, (char*)h + off, m);
+801053c7:	50                   	push   %eax
+801053c8:	8d 83 a4 61 22 80    	lea    -0x7fdd9e5c(%ebx),%eax
+  for(off = BSIZE; off < HDRBYTES(h->n); off += BSIZE){
+801053ce:	81 c3 00 02 00 00    	add    $0x200,%ebx
+    memmove(buf->data, (char*)h + off, m);
+801053d4:	50                   	push   %eax
+801053d5:	8d 46 70             	lea    0x70(%esi),%eax
+801053d8:	50                   	push   %eax
+801053d9:	e8 42 31 00 00       	call   80108520 <memmove>
+    bwrite(buf);
+801053de:	89 34 24             	mov    %esi,(%esp)
+801053e1:	e8 7a b0 ff ff       	call   80100460 <bwrite>
+    brelse(buf);
+801053e6:	89 34 24             	mov    %esi,(%esp)
+801053e9:	e8 b2 b0 ff ff       	call   801004a0 <brelse>
+  for(off = BSIZE; off < HDRBYTES(h->n); off += BSIZE){
+801053ee:	a1 a4 61 22 80       	mov    0x802261a4,%eax
+801053f3:	83 c4 10             	add    $0x10,%esp
+801053f6:	8d 34 85 04 00 00 00 	lea    0x4(,%eax,4),%esi
+801053fd:	39 f3                	cmp    %esi,%ebx
+801053ff:	72 8f                	jb     80105390 <write_head.constprop.0+0x20>
+  }
+  m = HDRBYTES(h->n) < BSIZE ? HDRBYTES(h->n) : BSIZE;
+  buf = bread(log.dev, log.start);
+80105401:	83 ec 08             	sub    $0x8,%esp
+80105404:	ff 35 e0 5a 22 80    	push   0x80225ae0
+8010540a:	ff 35 f8 5a 22 80    	push   0x80225af8
+80105410:	e8 4b af ff ff       	call   80100360 <bread>
+  memmove(buf->data, h, m);
+80105415:	83 c4 0c             	add    $0xc,%esp
+  buf = bread(log.dev, log.start);
+80105418:	89 c3                	mov    %eax,%ebx
+  m = HDRBYTES(h->n) < BSIZE ? HDRBYTES(h->n) : BSIZE;
+8010541a:	b8 00 02 00 00       	mov    $0x200,%eax
+8010541f:	39 c6                	cmp    %eax,%esi
+80105421:	0f 47 f0             	cmova  %eax,%esi
+  memmove(buf->data, h, m);
+80105424:	8d 43 70             	lea    0x70(%ebx),%eax
+80105427:	56                   	push   %esi
+80105428:	68 a4 61 22 80       	push   $0x802261a4
+8010542d:	50                   	push   %eax
+8010542e:	e8 ed 30 00 00       	call   80108520 <memmove>
+  bwrite(buf);
+80105433:	89 1c 24             	mov    %ebx,(%esp)
+80105436:	e8 25 b0 ff ff       	call   80100460 <bwrite>
+  brelse(buf);
+8010543b:	89 1c 24             	mov    %ebx,(%esp)
+8010543e:	e8 5d b0 ff ff       	call   801004a0 <brelse>
+}
+80105443:	83 c4 10             	add    $0x10,%esp
+80105446:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105449:	5b                   	pop    %ebx
+8010544a:	5e                   	pop    %esi
+8010544b:	5d                   	pop    %ebp
+8010544c:	c3                   	ret
+8010544d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80105450 <install_trans.constprop.0>:
+install_trans(struct logheader *lh, int unpin)
+80105450:	55                   	push   %ebp
+80105451:	89 e5                	mov    %esp,%ebp
+80105453:	57                   	push   %edi
+80105454:	56                   	push   %esi
+80105455:	53                   	push   %ebx
+80105456:	83 ec 28             	sub    $0x28,%esp
+80105459:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  acquiresleep(&installbuf.lock);
+8010545c:	68 ec 6e 22 80       	push   $0x80226eec
+80105461:	e8 2a 29 00 00       	call   80107d90 <acquiresleep>
+  for (tail = 0; tail < lh->n; tail++) {
+80105466:	8b 15 a4 61 22 80    	mov    0x802261a4,%edx
+8010546c:	83 c4 10             	add    $0x10,%esp
+8010546f:	85 d2                	test   %edx,%edx
+80105471:	0f 8e 3d 01 00 00    	jle    801055b4 <install_trans.constprop.0+0x164>
+80105477:	31 db                	xor    %ebx,%ebx
+80105479:	eb 14                	jmp    8010548f <install_trans.constprop.0+0x3f>
+8010547b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010547f:	90                   	nop
+80105480:	83 c3 01             	add    $0x1,%ebx
+80105483:	3b 1d a4 61 22 80    	cmp    0x802261a4,%ebx
+80105489:	0f 8d 25 01 00 00    	jge    801055b4 <install_trans.constprop.0+0x164>
+    struct buf *lbuf = bread(log.dev, log.start+LOGHDRBLOCKS+tail); // read log block
+8010548f:	a1 e0 5a 22 80       	mov    0x80225ae0,%eax
+80105494:	83 ec 08             	sub    $0x8,%esp
+80105497:	8d 44 03 04          	lea    0x4(%ebx,%eax,1),%eax
+8010549b:	50                   	push   %eax
+8010549c:	ff 35 f8 5a 22 80    	push   0x80225af8
+801054a2:	e8 b9 ae ff ff       	call   80100360 <bread>
+    memmove(installbuf.data, lbuf->data, BSIZE);
+801054a7:	83 c4 0c             	add    $0xc,%esp
+    installbuf.flags = B_DIRTY;
+801054aa:	c7 05 e0 6e 22 80 04 	movl   $0x4,0x80226ee0
+801054b1:	00 00 00 
+    struct buf *lbuf = bread(log.dev, log.start+LOGHDRBLOCKS+tail); // read log block
+801054b4:	89 c6                	mov    %eax,%esi
+    installbuf.dev = log.dev;
+801054b6:	a1 f8 5a 22 80       	mov    0x80225af8,%eax
+801054bb:	a3 e4 6e 22 80       	mov    %eax,0x80226ee4
+    installbuf.blockno = lh->block[tail];
+801054c0:	8b 04 9d a8 61 22 80 	mov    -0x7fdd9e58(,%ebx,4),%eax
+801054c7:	a3 e8 6e 22 80       	mov    %eax,0x80226ee8
+    memmove(installbuf.data, lbuf->data, BSIZE);
+801054cc:	8d 46 70             	lea    0x70(%esi),%eax
+801054cf:	68 00 02 00 00       	push   $0x200
+801054d4:	50                   	push   %eax
+801054d5:	68 50 6f 22 80       	push   $0x80226f50
+801054da:	e8 41 30 00 00       	call   80108520 <memmove>
+    iderw(&installbuf);  // write dst to disk
+801054df:	c7 04 24 e0 6e 22 80 	movl   $0x80226ee0,(%esp)
+801054e6:	e8 45 f3 ff ff       	call   80104830 <iderw>
+    brelse(lbuf);
+801054eb:	89 34 24             	mov    %esi,(%esp)
+801054ee:	e8 ad af ff ff       	call   801004a0 <brelse>
+    if(unpin){
+801054f3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801054f6:	83 c4 10             	add    $0x10,%esp
+801054f9:	85 c0                	test   %eax,%eax
+801054fb:	74 83                	je     80105480 <install_trans.constprop.0+0x30>
+      struct buf *dbuf = bread(log.dev, lh->block[tail]);
+801054fd:	83 ec 08             	sub    $0x8,%esp
+80105500:	ff 34 9d a8 61 22 80 	push   -0x7fdd9e58(,%ebx,4)
+80105507:	ff 35 f8 5a 22 80    	push   0x80225af8
+8010550d:	e8 4e ae ff ff       	call   80100360 <bread>
+      acquire(&log.lock);
+80105512:	c7 04 24 a0 5a 22 80 	movl   $0x80225aa0,(%esp)
+      struct buf *dbuf = bread(log.dev, lh->block[tail]);
+80105519:	89 c6                	mov    %eax,%esi
+      acquire(&log.lock);
+8010551b:	e8 40 2c 00 00       	call   80108160 <acquire>
+      if (loglookup(dbuf->blockno) < 0)
+80105520:	8b 7e 08             	mov    0x8(%esi),%edi
+  for(h = blockno % LOGHASHSIZE; log.hash[h]; h = (h+1) % LOGHASHSIZE){
+80105523:	b8 49 82 b4 37       	mov    $0x37b48249,%eax
+80105528:	83 c4 10             	add    $0x10,%esp
+8010552b:	f7 e7                	mul    %edi
+8010552d:	89 f8                	mov    %edi,%eax
+8010552f:	29 d0                	sub    %edx,%eax
+80105531:	d1 e8                	shr    %eax
+80105533:	01 c2                	add    %eax,%edx
+80105535:	c1 ea 09             	shr    $0x9,%edx
+80105538:	69 c2 49 03 00 00    	imul   $0x349,%edx,%eax
+8010553e:	89 fa                	mov    %edi,%edx
+80105540:	29 c2                	sub    %eax,%edx
+80105542:	0f b7 84 12 38 68 22 	movzwl -0x7fdd97c8(%edx,%edx,1),%eax
+80105549:	80 
+8010554a:	66 85 c0             	test   %ax,%ax
+8010554d:	75 35                	jne    80105584 <install_trans.constprop.0+0x134>
+8010554f:	eb 7f                	jmp    801055d0 <install_trans.constprop.0+0x180>
+80105551:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105558:	8d 4a 01             	lea    0x1(%edx),%ecx
+8010555b:	b8 49 82 b4 37       	mov    $0x37b48249,%eax
+80105560:	f7 e1                	mul    %ecx
+80105562:	89 c8                	mov    %ecx,%eax
+80105564:	29 d0                	sub    %edx,%eax
+80105566:	d1 e8                	shr    %eax
+80105568:	01 c2                	add    %eax,%edx
+8010556a:	c1 ea 09             	shr    $0x9,%edx
+8010556d:	69 c2 49 03 00 00    	imul   $0x349,%edx,%eax
+80105573:	29 c1                	sub    %eax,%ecx
+80105575:	0f b7 84 09 38 68 22 	movzwl -0x7fdd97c8(%ecx,%ecx,1),%eax
+8010557c:	80 
+8010557d:	89 ca                	mov    %ecx,%edx
+8010557f:	66 85 c0             	test   %ax,%ax
+80105582:	74 4c                	je     801055d0 <install_trans.constprop.0+0x180>
+    if(log.lh.block[i] == blockno)
+80105584:	3b 3c 85 10 5b 22 80 	cmp    -0x7fdda4f0(,%eax,4),%edi
+8010558b:	75 cb                	jne    80105558 <install_trans.constprop.0+0x108>
+      release(&log.lock);
+8010558d:	83 ec 0c             	sub    $0xc,%esp
+  for (tail = 0; tail < lh->n; tail++) {
+80105590:	83 c3 01             	add    $0x1,%ebx
+      release(&log.lock);
+80105593:	68 a0 5a 22 80       	push   $0x80225aa0
+80105598:	e8 03 2e 00 00       	call   801083a0 <release>
+      brelse(dbuf);
+8010559d:	89 34 24             	mov    %esi,(%esp)
+801055a0:	e8 fb ae ff ff       	call   801004a0 <brelse>
+801055a5:	83 c4 10             	add    $0x10,%esp
+  for (tail = 0; tail < lh->n; tail++) {
+801055a8:	3b 1d a4 61 22 80    	cmp    0x802261a4,%ebx
+801055ae:	0f 8c db fe ff ff    	jl     8010548f <install_trans.constprop.0+0x3f>
+  releasesleep(&installbuf.lock);
+801055b4:	83 ec 0c             	sub    $0xc,%esp
+801055b7:	68 ec 6e 22 80       	push   $0x80226eec
+801055bc:	e8 2f 28 00 00       	call   80107df0 <releasesleep>
+}
+801055c1:	83 c4 10             	add    $0x10,%esp
+801055c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801055c7:	5b                   	pop    %ebx
+801055c8:	5e                   	pop    %esi
+801055c9:	5f                   	pop    %edi
+801055ca:	5d                   	pop    %ebp
+801055cb:	c3                   	ret
+801055cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        dbuf->flags &= ~B_DIRTY;
+801055d0:	83 26 fb             	andl   $0xfffffffb,(%esi)
+801055d3:	eb b8                	jmp    8010558d <install_trans.constprop.0+0x13d>
+801055d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801055dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801055e0 <logdaemon>:
+//PAGEBREAK!
+// Kernel process that commits transactions and installs
+// them.  Never returns.
+static void
+logdaemon(void)
+{
+801055e0:	55                   	push   %ebp
+801055e1:	89 e5                	mov    %esp,%ebp
+801055e3:	57                   	push   %edi
+801055e4:	56                   	push   %esi
+801055e5:	53                   	push   %ebx
+801055e6:	83 ec 18             	sub    $0x18,%esp
+  acquire(&log.lock);
+801055e9:	68 a0 5a 22 80       	push   $0x80225aa0
+801055ee:	e8 6d 2b 00 00       	call   80108160 <acquire>
+801055f3:	83 c4 10             	add    $0x10,%esp
+801055f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801055fd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(log.outstanding > 0 || log.lh.n == 0)
+80105600:	a1 ec 5a 22 80       	mov    0x80225aec,%eax
+80105605:	85 c0                	test   %eax,%eax
+80105607:	0f 8f 93 01 00 00    	jg     801057a0 <logdaemon+0x1c0>
+8010560d:	8b 15 10 5b 22 80    	mov    0x80225b10,%edx
+80105613:	85 d2                	test   %edx,%edx
+80105615:	0f 84 85 01 00 00    	je     801057a0 <logdaemon+0x1c0>
+  return log.nops <= 1 || log.full || ticks - log.opened >= LOGDELAY;
+8010561b:	83 3d 04 5b 22 80 01 	cmpl   $0x1,0x80225b04
+80105622:	7e 1c                	jle    80105640 <logdaemon+0x60>
+80105624:	8b 1d 0c 5b 22 80    	mov    0x80225b0c,%ebx
+8010562a:	85 db                	test   %ebx,%ebx
+8010562c:	75 12                	jne    80105640 <logdaemon+0x60>
+8010562e:	8b 0d 80 5f 23 80    	mov    0x80235f80,%ecx
+80105634:	39 0d 08 5b 22 80    	cmp    %ecx,0x80225b08
+8010563a:	0f 84 80 01 00 00    	je     801057c0 <logdaemon+0x1e0>
+
+    // Commit.  No FS calls may run while the cached blocks
+    // are copied to the log.
+    log.committing = 1;
+    log.clh = log.lh;
+    release(&log.lock);
+80105640:	83 ec 0c             	sub    $0xc,%esp
+    log.clh = log.lh;
+80105643:	b9 a5 01 00 00       	mov    $0x1a5,%ecx
+80105648:	bf a4 61 22 80       	mov    $0x802261a4,%edi
+8010564d:	be 10 5b 22 80       	mov    $0x80225b10,%esi
+80105652:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    release(&log.lock);
+80105654:	68 a0 5a 22 80       	push   $0x80225aa0
+  for (tail = 0; tail < lh->n; tail++) {
+80105659:	31 ff                	xor    %edi,%edi
+    log.committing = 1;
+8010565b:	c7 05 f4 5a 22 80 01 	movl   $0x1,0x80225af4
+80105662:	00 00 00 
+    release(&log.lock);
+80105665:	e8 36 2d 00 00       	call   801083a0 <release>
+  for (tail = 0; tail < lh->n; tail++) {
+8010566a:	8b 0d a4 61 22 80    	mov    0x802261a4,%ecx
+80105670:	83 c4 10             	add    $0x10,%esp
+80105673:	85 c9                	test   %ecx,%ecx
+80105675:	7e 74                	jle    801056eb <logdaemon+0x10b>
+80105677:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010567e:	66 90                	xchg   %ax,%ax
+    struct buf *to = bclaim(log.dev, log.start+LOGHDRBLOCKS+tail); // log block
+80105680:	a1 e0 5a 22 80       	mov    0x80225ae0,%eax
+80105685:	83 ec 08             	sub    $0x8,%esp
+80105688:	8d 44 07 04          	lea    0x4(%edi,%eax,1),%eax
+8010568c:	50                   	push   %eax
+8010568d:	ff 35 f8 5a 22 80    	push   0x80225af8
+80105693:	e8 08 ad ff ff       	call   801003a0 <bclaim>
+80105698:	89 c6                	mov    %eax,%esi
+    struct buf *from = bread(log.dev, lh->block[tail]); // cache block
+8010569a:	58                   	pop    %eax
+8010569b:	5a                   	pop    %edx
+8010569c:	ff 34 bd a8 61 22 80 	push   -0x7fdd9e58(,%edi,4)
+801056a3:	ff 35 f8 5a 22 80    	push   0x80225af8
+  for (tail = 0; tail < lh->n; tail++) {
+801056a9:	83 c7 01             	add    $0x1,%edi
+    struct buf *from = bread(log.dev, lh->block[tail]); // cache block
+801056ac:	e8 af ac ff ff       	call   80100360 <bread>
+    memmove(to->data, from->data, BSIZE);
+801056b1:	83 c4 0c             	add    $0xc,%esp
+    struct buf *from = bread(log.dev, lh->block[tail]); // cache block
+801056b4:	89 c3                	mov    %eax,%ebx
+    memmove(to->data, from->data, BSIZE);
+801056b6:	8d 40 70             	lea    0x70(%eax),%eax
+801056b9:	68 00 02 00 00       	push   $0x200
+801056be:	50                   	push   %eax
+801056bf:	8d 46 70             	lea    0x70(%esi),%eax
+801056c2:	50                   	push   %eax
+801056c3:	e8 58 2e 00 00       	call   80108520 <memmove>
+    bwrite(to);  // write the log
+801056c8:	89 34 24             	mov    %esi,(%esp)
+801056cb:	e8 90 ad ff ff       	call   80100460 <bwrite>
+    brelse(from);
+801056d0:	89 1c 24             	mov    %ebx,(%esp)
+801056d3:	e8 c8 ad ff ff       	call   801004a0 <brelse>
+    brelse(to);
+801056d8:	89 34 24             	mov    %esi,(%esp)
+801056db:	e8 c0 ad ff ff       	call   801004a0 <brelse>
+  for (tail = 0; tail < lh->n; tail++) {
+801056e0:	83 c4 10             	add    $0x10,%esp
+801056e3:	3b 3d a4 61 22 80    	cmp    0x802261a4,%edi
+801056e9:	7c 95                	jl     80105680 <logdaemon+0xa0>
+
+    write_log(&log.clh);     // Write modified blocks from cache to log
+    write_head(&log.clh);    // Write header to disk -- the real commit
+801056eb:	e8 80 fc ff ff       	call   80105370 <write_head.constprop.0>
+
+    acquire(&log.lock);
+801056f0:	83 ec 0c             	sub    $0xc,%esp
+801056f3:	68 a0 5a 22 80       	push   $0x80225aa0
+801056f8:	e8 63 2a 00 00       	call   80108160 <acquire>
+    log.done = log.seq++;
+    log.lh.n = 0;
+    memset(log.hash, 0, sizeof(log.hash));
+801056fd:	83 c4 0c             	add    $0xc,%esp
+    log.done = log.seq++;
+80105700:	a1 fc 5a 22 80       	mov    0x80225afc,%eax
+    log.lh.n = 0;
+80105705:	c7 05 10 5b 22 80 00 	movl   $0x0,0x80225b10
+8010570c:	00 00 00 
+    memset(log.hash, 0, sizeof(log.hash));
+8010570f:	68 92 06 00 00       	push   $0x692
+80105714:	6a 00                	push   $0x0
+    log.done = log.seq++;
+80105716:	8d 50 01             	lea    0x1(%eax),%edx
+    memset(log.hash, 0, sizeof(log.hash));
+80105719:	68 38 68 22 80       	push   $0x80226838
+    log.done = log.seq++;
+8010571e:	89 15 fc 5a 22 80    	mov    %edx,0x80225afc
+80105724:	a3 00 5b 22 80       	mov    %eax,0x80225b00
+    memset(log.hash, 0, sizeof(log.hash));
+80105729:	e8 62 2d 00 00       	call   80108490 <memset>
+    log.nops = 0;
+    log.full = 0;
+    log.committing = 0;
+    wakeup(&log);
+8010572e:	c7 04 24 a0 5a 22 80 	movl   $0x80225aa0,(%esp)
+    log.nops = 0;
+80105735:	c7 05 04 5b 22 80 00 	movl   $0x0,0x80225b04
+8010573c:	00 00 00 
+    log.full = 0;
+8010573f:	c7 05 0c 5b 22 80 00 	movl   $0x0,0x80225b0c
+80105746:	00 00 00 
+    log.committing = 0;
+80105749:	c7 05 f4 5a 22 80 00 	movl   $0x0,0x80225af4
+80105750:	00 00 00 
+    wakeup(&log);
+80105753:	e8 38 21 00 00       	call   80107890 <wakeup>
+    release(&log.lock);
+80105758:	c7 04 24 a0 5a 22 80 	movl   $0x80225aa0,(%esp)
+8010575f:	e8 3c 2c 00 00       	call   801083a0 <release>
+
+    // The calls of the committed transaction have returned and
+    // the next transaction is open; install in the background.
+    install_trans(&log.clh, 1); // Now install writes to home locations
+80105764:	b8 01 00 00 00       	mov    $0x1,%eax
+80105769:	e8 e2 fc ff ff       	call   80105450 <install_trans.constprop.0>
+    log.clh.n = 0;
+8010576e:	c7 05 a4 61 22 80 00 	movl   $0x0,0x802261a4
+80105775:	00 00 00 
+    write_head(&log.clh);    // Erase the transaction from the log
+80105778:	e8 f3 fb ff ff       	call   80105370 <write_head.constprop.0>
+
+    acquire(&log.lock);
+8010577d:	c7 04 24 a0 5a 22 80 	movl   $0x80225aa0,(%esp)
+80105784:	e8 d7 29 00 00       	call   80108160 <acquire>
+  if(log.outstanding > 0 || log.lh.n == 0)
+80105789:	a1 ec 5a 22 80       	mov    0x80225aec,%eax
+    acquire(&log.lock);
+8010578e:	83 c4 10             	add    $0x10,%esp
+  if(log.outstanding > 0 || log.lh.n == 0)
+80105791:	85 c0                	test   %eax,%eax
+80105793:	0f 8e 74 fe ff ff    	jle    8010560d <logdaemon+0x2d>
+80105799:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        sleep(&log, &log.lock);
+801057a0:	83 ec 08             	sub    $0x8,%esp
+801057a3:	68 a0 5a 22 80       	push   $0x80225aa0
+801057a8:	68 a0 5a 22 80       	push   $0x80225aa0
+801057ad:	e8 8e 1e 00 00       	call   80107640 <sleep>
+801057b2:	83 c4 10             	add    $0x10,%esp
+801057b5:	e9 46 fe ff ff       	jmp    80105600 <logdaemon+0x20>
+801057ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(log.outstanding == 0 && log.lh.n > 0){
+801057c0:	85 c0                	test   %eax,%eax
+801057c2:	75 dc                	jne    801057a0 <logdaemon+0x1c0>
+801057c4:	85 d2                	test   %edx,%edx
+801057c6:	7e d8                	jle    801057a0 <logdaemon+0x1c0>
+        release(&log.lock);
+801057c8:	83 ec 0c             	sub    $0xc,%esp
+801057cb:	68 a0 5a 22 80       	push   $0x80225aa0
+801057d0:	e8 cb 2b 00 00       	call   801083a0 <release>
+        acquire(&tickslock);
+801057d5:	c7 04 24 a0 5f 23 80 	movl   $0x80235fa0,(%esp)
+801057dc:	e8 7f 29 00 00       	call   80108160 <acquire>
+        sleepticks(1);
+801057e1:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+801057e8:	e8 23 42 00 00       	call   80109a10 <sleepticks>
+        release(&tickslock);
+801057ed:	c7 04 24 a0 5f 23 80 	movl   $0x80235fa0,(%esp)
+801057f4:	e8 a7 2b 00 00       	call   801083a0 <release>
+        acquire(&log.lock);
+801057f9:	c7 04 24 a0 5a 22 80 	movl   $0x80225aa0,(%esp)
+80105800:	e8 5b 29 00 00       	call   80108160 <acquire>
+80105805:	83 c4 10             	add    $0x10,%esp
+80105808:	e9 f3 fd ff ff       	jmp    80105600 <logdaemon+0x20>
+8010580d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80105810 <initlog>:
+{
+80105810:	55                   	push   %ebp
+80105811:	89 e5                	mov    %esp,%ebp
+80105813:	57                   	push   %edi
+80105814:	56                   	push   %esi
+80105815:	53                   	push   %ebx
+80105816:	83 ec 34             	sub    $0x34,%esp
+80105819:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&log.lock, "log");
+8010581c:	68 c0 bb 10 80       	push   $0x8010bbc0
+80105821:	68 a0 5a 22 80       	push   $0x80225aa0
+80105826:	e8 e5 26 00 00       	call   80107f10 <initlock>
+  initsleeplock(&installbuf.lock, "installbuf");
+8010582b:	58                   	pop    %eax
+8010582c:	5a                   	pop    %edx
+8010582d:	68 c4 bb 10 80       	push   $0x8010bbc4
+80105832:	68 ec 6e 22 80       	push   $0x80226eec
+80105837:	e8 04 25 00 00       	call   80107d40 <initsleeplock>
+  readsb(dev, &sb);
+8010583c:	8d 45 cc             	lea    -0x34(%ebp),%eax
+8010583f:	59                   	pop    %ecx
+80105840:	5e                   	pop    %esi
+80105841:	50                   	push   %eax
+80105842:	53                   	push   %ebx
+80105843:	e8 78 ce ff ff       	call   801026c0 <readsb>
+  log.size = sb.nlog;
+80105848:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  log.start = sb.logstart;
+8010584b:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  if(log.cap > LOGSIZE)
+8010584e:	83 c4 10             	add    $0x10,%esp
+  log.dev = dev;
+80105851:	89 1d f8 5a 22 80    	mov    %ebx,0x80225af8
+  log.size = sb.nlog;
+80105857:	a3 e4 5a 22 80       	mov    %eax,0x80225ae4
+  log.cap = log.size - LOGHDRBLOCKS;
+8010585c:	83 e8 04             	sub    $0x4,%eax
+  log.start = sb.logstart;
+8010585f:	89 15 e0 5a 22 80    	mov    %edx,0x80225ae0
+  log.cap = log.size - LOGHDRBLOCKS;
+80105865:	a3 e8 5a 22 80       	mov    %eax,0x80225ae8
+  if(log.cap > LOGSIZE)
+8010586a:	3d a4 01 00 00       	cmp    $0x1a4,%eax
+8010586f:	0f 8f 0b 01 00 00    	jg     80105980 <initlog+0x170>
+  if(log.cap < MAXOPBLOCKS)
+80105875:	83 f8 0d             	cmp    $0xd,%eax
+80105878:	0f 8e 1e 01 00 00    	jle    8010599c <initlog+0x18c>
+  log.seq = 1;
+8010587e:	c7 05 fc 5a 22 80 01 	movl   $0x1,0x80225afc
+80105885:	00 00 00 
+  buf = bread(log.dev, log.start);
+80105888:	83 ec 08             	sub    $0x8,%esp
+8010588b:	52                   	push   %edx
+8010588c:	53                   	push   %ebx
+8010588d:	e8 ce aa ff ff       	call   80100360 <bread>
+  if(h->n < 0 || h->n > log.cap)
+80105892:	83 c4 10             	add    $0x10,%esp
+  buf = bread(log.dev, log.start);
+80105895:	89 c3                	mov    %eax,%ebx
+  h->n = ((struct logheader *) (buf->data))->n;
+80105897:	8b 40 70             	mov    0x70(%eax),%eax
+8010589a:	a3 a4 61 22 80       	mov    %eax,0x802261a4
+  if(h->n < 0 || h->n > log.cap)
+8010589f:	85 c0                	test   %eax,%eax
+801058a1:	0f 88 e8 00 00 00    	js     8010598f <initlog+0x17f>
+801058a7:	3b 05 e8 5a 22 80    	cmp    0x80225ae8,%eax
+801058ad:	0f 8f dc 00 00 00    	jg     8010598f <initlog+0x17f>
+  for(off = 0; off < HDRBYTES(h->n); off += BSIZE){
+801058b3:	8d 14 85 04 00 00 00 	lea    0x4(,%eax,4),%edx
+801058ba:	31 ff                	xor    %edi,%edi
+801058bc:	8d 73 70             	lea    0x70(%ebx),%esi
+801058bf:	85 d2                	test   %edx,%edx
+801058c1:	74 7d                	je     80105940 <initlog+0x130>
+801058c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801058c7:	90                   	nop
+    m = HDRBYTES(h->n) - off;
+801058c8:	8d 04 85 04 00 00 00 	lea    0x4(,%eax,4),%eax
+    if(m > BSIZE)
+801058cf:	ba 00 02 00 00       	mov    $0x200,%edx
+    memmove((char*)h + off, buf->data, m);
+801058d4:	83 ec 04             	sub    $0x4,%esp
+    m = HDRBYTES(h->n) - off;
+801058d7:	29 f8                	sub    %edi,%eax
+    if(m > BSIZE)
+801058d9:	39 d0                	cmp    %edx,%eax
+801058db:	0f 47 c2             	cmova  %edx,%eax
+    memmove((char*)h + off, buf->data, m);
+801058de:	50                   	push   %eax
+801058df:	8d 87 a4 61 22 80    	lea    -0x7fdd9e5c(%edi),%eax
+  for(off = 0; off < HDRBYTES(h->n); off += BSIZE){
+801058e5:	81 c7 00 02 00 00    	add    $0x200,%edi
+    memmove((char*)h + off, buf->data, m);
+801058eb:	56                   	push   %esi
+801058ec:	50                   	push   %eax
+801058ed:	e8 2e 2c 00 00       	call   80108520 <memmove>
+    brelse(buf);
+801058f2:	89 1c 24             	mov    %ebx,(%esp)
+801058f5:	e8 a6 ab ff ff       	call   801004a0 <brelse>
+  for(off = 0; off < HDRBYTES(h->n); off += BSIZE){
+801058fa:	a1 a4 61 22 80       	mov    0x802261a4,%eax
+801058ff:	83 c4 10             	add    $0x10,%esp
+80105902:	8d 14 85 04 00 00 00 	lea    0x4(,%eax,4),%edx
+80105909:	39 d7                	cmp    %edx,%edi
+8010590b:	73 33                	jae    80105940 <initlog+0x130>
+    if(off > 0)
+8010590d:	85 ff                	test   %edi,%edi
+8010590f:	74 b7                	je     801058c8 <initlog+0xb8>
+      buf = bread(log.dev, log.start + off/BSIZE);
+80105911:	89 f8                	mov    %edi,%eax
+80105913:	83 ec 08             	sub    $0x8,%esp
+80105916:	c1 e8 09             	shr    $0x9,%eax
+80105919:	03 05 e0 5a 22 80    	add    0x80225ae0,%eax
+8010591f:	50                   	push   %eax
+80105920:	ff 35 f8 5a 22 80    	push   0x80225af8
+80105926:	e8 35 aa ff ff       	call   80100360 <bread>
+8010592b:	83 c4 10             	add    $0x10,%esp
+8010592e:	89 c3                	mov    %eax,%ebx
+80105930:	a1 a4 61 22 80       	mov    0x802261a4,%eax
+80105935:	8d 73 70             	lea    0x70(%ebx),%esi
+80105938:	eb 8e                	jmp    801058c8 <initlog+0xb8>
+8010593a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  install_trans(&log.clh, 0); // if committed, copy from log to disk
+80105940:	31 c0                	xor    %eax,%eax
+80105942:	e8 09 fb ff ff       	call   80105450 <install_trans.constprop.0>
+  log.clh.n = 0;
+80105947:	c7 05 a4 61 22 80 00 	movl   $0x0,0x802261a4
+8010594e:	00 00 00 
+  write_head(&log.clh); // clear the log
+80105951:	e8 1a fa ff ff       	call   80105370 <write_head.constprop.0>
+  if(kproc("logd", logdaemon) < 0)
+80105956:	83 ec 08             	sub    $0x8,%esp
+80105959:	68 e0 55 10 80       	push   $0x801055e0
+8010595e:	68 09 bc 10 80       	push   $0x8010bc09
+80105963:	e8 98 17 00 00       	call   80107100 <kproc>
+80105968:	83 c4 10             	add    $0x10,%esp
+8010596b:	85 c0                	test   %eax,%eax
+8010596d:	78 3a                	js     801059a9 <initlog+0x199>
+}
+8010596f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105972:	5b                   	pop    %ebx
+80105973:	5e                   	pop    %esi
+80105974:	5f                   	pop    %edi
+80105975:	5d                   	pop    %ebp
+80105976:	c3                   	ret
+80105977:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010597e:	66 90                	xchg   %ax,%ax
+80105980:	c7 05 e8 5a 22 80 a4 	movl   $0x1a4,0x80225ae8
+80105987:	01 00 00 
+  if(log.cap < MAXOPBLOCKS)
+8010598a:	e9 ef fe ff ff       	jmp    8010587e <initlog+0x6e>
+    panic("read_head: bad log header");
+8010598f:	83 ec 0c             	sub    $0xc,%esp
+80105992:	68 e6 bb 10 80       	push   $0x8010bbe6
+80105997:	e8 c4 ac ff ff       	call   80100660 <panic>
+    panic("initlog: log too small");
+8010599c:	83 ec 0c             	sub    $0xc,%esp
+8010599f:	68 cf bb 10 80       	push   $0x8010bbcf
+801059a4:	e8 b7 ac ff ff       	call   80100660 <panic>
+    panic("initlog: logd");
+801059a9:	83 ec 0c             	sub    $0xc,%esp
+801059ac:	68 00 bc 10 80       	push   $0x8010bc00
+801059b1:	e8 aa ac ff ff       	call   80100660 <panic>
+801059b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801059bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+801059c0 <begin_opn>:
+{
+801059c0:	55                   	push   %ebp
+801059c1:	89 e5                	mov    %esp,%ebp
+801059c3:	53                   	push   %ebx
+801059c4:	83 ec 04             	sub    $0x4,%esp
+801059c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(n > log.cap)
+801059ca:	39 1d e8 5a 22 80    	cmp    %ebx,0x80225ae8
+801059d0:	0f 8c d9 00 00 00    	jl     80105aaf <begin_opn+0xef>
+  acquire(&log.lock);
+801059d6:	83 ec 0c             	sub    $0xc,%esp
+801059d9:	68 a0 5a 22 80       	push   $0x80225aa0
+801059de:	e8 7d 27 00 00       	call   80108160 <acquire>
+801059e3:	83 c4 10             	add    $0x10,%esp
+801059e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801059ed:	8d 76 00             	lea    0x0(%esi),%esi
+    if(log.committing){
+801059f0:	a1 f4 5a 22 80       	mov    0x80225af4,%eax
+801059f5:	85 c0                	test   %eax,%eax
+801059f7:	75 55                	jne    80105a4e <begin_opn+0x8e>
+    } else if(log.full || log.lh.n + log.reserved + n > log.cap){
+801059f9:	8b 0d 0c 5b 22 80    	mov    0x80225b0c,%ecx
+801059ff:	85 c9                	test   %ecx,%ecx
+80105a01:	75 17                	jne    80105a1a <begin_opn+0x5a>
+80105a03:	8b 15 f0 5a 22 80    	mov    0x80225af0,%edx
+80105a09:	a1 10 5b 22 80       	mov    0x80225b10,%eax
+80105a0e:	01 d0                	add    %edx,%eax
+80105a10:	01 d8                	add    %ebx,%eax
+80105a12:	3b 05 e8 5a 22 80    	cmp    0x80225ae8,%eax
+80105a18:	7e 4e                	jle    80105a68 <begin_opn+0xa8>
+      log.full = 1;
+80105a1a:	c7 05 0c 5b 22 80 01 	movl   $0x1,0x80225b0c
+80105a21:	00 00 00 
+      wakeup(&log);
+80105a24:	83 ec 0c             	sub    $0xc,%esp
+80105a27:	68 a0 5a 22 80       	push   $0x80225aa0
+80105a2c:	e8 5f 1e 00 00       	call   80107890 <wakeup>
+      sleep(&log, &log.lock);
+80105a31:	58                   	pop    %eax
+80105a32:	5a                   	pop    %edx
+80105a33:	68 a0 5a 22 80       	push   $0x80225aa0
+80105a38:	68 a0 5a 22 80       	push   $0x80225aa0
+80105a3d:	e8 fe 1b 00 00       	call   80107640 <sleep>
+    if(log.committing){
+80105a42:	a1 f4 5a 22 80       	mov    0x80225af4,%eax
+      sleep(&log, &log.lock);
+80105a47:	83 c4 10             	add    $0x10,%esp
+    if(log.committing){
+80105a4a:	85 c0                	test   %eax,%eax
+80105a4c:	74 ab                	je     801059f9 <begin_opn+0x39>
+      sleep(&log, &log.lock);
+80105a4e:	83 ec 08             	sub    $0x8,%esp
+80105a51:	68 a0 5a 22 80       	push   $0x80225aa0
+80105a56:	68 a0 5a 22 80       	push   $0x80225aa0
+80105a5b:	e8 e0 1b 00 00       	call   80107640 <sleep>
+80105a60:	83 c4 10             	add    $0x10,%esp
+80105a63:	eb 8b                	jmp    801059f0 <begin_opn+0x30>
+80105a65:	8d 76 00             	lea    0x0(%esi),%esi
+      if(log.nops == 0)
+80105a68:	a1 04 5b 22 80       	mov    0x80225b04,%eax
+80105a6d:	85 c0                	test   %eax,%eax
+80105a6f:	75 0c                	jne    80105a7d <begin_opn+0xbd>
+        log.opened = ticks;
+80105a71:	8b 0d 80 5f 23 80    	mov    0x80235f80,%ecx
+80105a77:	89 0d 08 5b 22 80    	mov    %ecx,0x80225b08
+      log.reserved += n;
+80105a7d:	01 da                	add    %ebx,%edx
+      log.nops += 1;
+80105a7f:	83 c0 01             	add    $0x1,%eax
+      log.outstanding += 1;
+80105a82:	83 05 ec 5a 22 80 01 	addl   $0x1,0x80225aec
+      log.nops += 1;
+80105a89:	a3 04 5b 22 80       	mov    %eax,0x80225b04
+      log.reserved += n;
+80105a8e:	89 15 f0 5a 22 80    	mov    %edx,0x80225af0
+      myproc()->logblocks = n;
+80105a94:	e8 d7 13 00 00       	call   80106e70 <myproc>
+80105a99:	89 98 b0 00 00 00    	mov    %ebx,0xb0(%eax)
+}
+80105a9f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      release(&log.lock);
+80105aa2:	c7 45 08 a0 5a 22 80 	movl   $0x80225aa0,0x8(%ebp)
+}
+80105aa9:	c9                   	leave
+      release(&log.lock);
+80105aaa:	e9 f1 28 00 00       	jmp    801083a0 <release>
+    panic("begin_opn: too big");
+80105aaf:	83 ec 0c             	sub    $0xc,%esp
+80105ab2:	68 0e bc 10 80       	push   $0x8010bc0e
+80105ab7:	e8 a4 ab ff ff       	call   80100660 <panic>
+80105abc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80105ac0 <begin_op>:
+{
+80105ac0:	55                   	push   %ebp
+80105ac1:	89 e5                	mov    %esp,%ebp
+80105ac3:	83 ec 14             	sub    $0x14,%esp
+  begin_opn(MAXOPBLOCKS);
+80105ac6:	6a 0e                	push   $0xe
+80105ac8:	e8 f3 fe ff ff       	call   801059c0 <begin_opn>
+}
+80105acd:	83 c4 10             	add    $0x10,%esp
+80105ad0:	c9                   	leave
+80105ad1:	c3                   	ret
+80105ad2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105ad9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80105ae0 <log_opmax>:
+  return log.cap / 2;
+80105ae0:	8b 15 e8 5a 22 80    	mov    0x80225ae8,%edx
+80105ae6:	89 d0                	mov    %edx,%eax
+80105ae8:	c1 e8 1f             	shr    $0x1f,%eax
+80105aeb:	01 d0                	add    %edx,%eax
+80105aed:	d1 f8                	sar    %eax
+}
+80105aef:	c3                   	ret
+
+80105af0 <end_op>:
+{
+80105af0:	55                   	push   %ebp
+80105af1:	89 e5                	mov    %esp,%ebp
+80105af3:	53                   	push   %ebx
+80105af4:	83 ec 10             	sub    $0x10,%esp
+  acquire(&log.lock);
+80105af7:	68 a0 5a 22 80       	push   $0x80225aa0
+80105afc:	e8 5f 26 00 00       	call   80108160 <acquire>
+  log.outstanding -= 1;
+80105b01:	83 2d ec 5a 22 80 01 	subl   $0x1,0x80225aec
+  log.reserved -= myproc()->logblocks;
+80105b08:	e8 63 13 00 00       	call   80106e70 <myproc>
+80105b0d:	8b 15 f0 5a 22 80    	mov    0x80225af0,%edx
+  if(log.committing)
+80105b13:	83 c4 10             	add    $0x10,%esp
+  log.reserved -= myproc()->logblocks;
+80105b16:	2b 90 b0 00 00 00    	sub    0xb0(%eax),%edx
+  if(log.committing)
+80105b1c:	a1 f4 5a 22 80       	mov    0x80225af4,%eax
+  log.reserved -= myproc()->logblocks;
+80105b21:	89 15 f0 5a 22 80    	mov    %edx,0x80225af0
+  if(log.committing)
+80105b27:	85 c0                	test   %eax,%eax
+80105b29:	0f 85 b1 00 00 00    	jne    80105be0 <end_op+0xf0>
+  if(log.outstanding == 0 && log.lh.n == 0){
+80105b2f:	a1 ec 5a 22 80       	mov    0x80225aec,%eax
+80105b34:	0b 05 10 5b 22 80    	or     0x80225b10,%eax
+80105b3a:	74 5c                	je     80105b98 <end_op+0xa8>
+  wakeup(&log);
+80105b3c:	83 ec 0c             	sub    $0xc,%esp
+80105b3f:	68 a0 5a 22 80       	push   $0x80225aa0
+80105b44:	e8 47 1d 00 00       	call   80107890 <wakeup>
+  seq = log.seq;
+80105b49:	8b 1d fc 5a 22 80    	mov    0x80225afc,%ebx
+  while((int)(log.done - seq) < 0)
+80105b4f:	83 c4 10             	add    $0x10,%esp
+80105b52:	39 1d 00 5b 22 80    	cmp    %ebx,0x80225b00
+80105b58:	79 23                	jns    80105b7d <end_op+0x8d>
+80105b5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    sleep(&log, &log.lock);
+80105b60:	83 ec 08             	sub    $0x8,%esp
+80105b63:	68 a0 5a 22 80       	push   $0x80225aa0
+80105b68:	68 a0 5a 22 80       	push   $0x80225aa0
+80105b6d:	e8 ce 1a 00 00       	call   80107640 <sleep>
+  while((int)(log.done - seq) < 0)
+80105b72:	83 c4 10             	add    $0x10,%esp
+80105b75:	39 1d 00 5b 22 80    	cmp    %ebx,0x80225b00
+80105b7b:	78 e3                	js     80105b60 <end_op+0x70>
+  release(&log.lock);
+80105b7d:	83 ec 0c             	sub    $0xc,%esp
+80105b80:	68 a0 5a 22 80       	push   $0x80225aa0
+80105b85:	e8 16 28 00 00       	call   801083a0 <release>
+}
+80105b8a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  release(&log.lock);
+80105b8d:	83 c4 10             	add    $0x10,%esp
+}
+80105b90:	c9                   	leave
+80105b91:	c3                   	ret
+80105b92:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    log.done = log.seq++;
+80105b98:	a1 fc 5a 22 80       	mov    0x80225afc,%eax
+    wakeup(&log);
+80105b9d:	83 ec 0c             	sub    $0xc,%esp
+    log.nops = 0;
+80105ba0:	c7 05 04 5b 22 80 00 	movl   $0x0,0x80225b04
+80105ba7:	00 00 00 
+    log.full = 0;
+80105baa:	c7 05 0c 5b 22 80 00 	movl   $0x0,0x80225b0c
+80105bb1:	00 00 00 
+    log.done = log.seq++;
+80105bb4:	8d 50 01             	lea    0x1(%eax),%edx
+80105bb7:	a3 00 5b 22 80       	mov    %eax,0x80225b00
+80105bbc:	89 15 fc 5a 22 80    	mov    %edx,0x80225afc
+    wakeup(&log);
+80105bc2:	68 a0 5a 22 80       	push   $0x80225aa0
+80105bc7:	e8 c4 1c 00 00       	call   80107890 <wakeup>
+    release(&log.lock);
+80105bcc:	c7 04 24 a0 5a 22 80 	movl   $0x80225aa0,(%esp)
+80105bd3:	e8 c8 27 00 00       	call   801083a0 <release>
+}
+80105bd8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return;
+80105bdb:	83 c4 10             	add    $0x10,%esp
+}
+80105bde:	c9                   	leave
+80105bdf:	c3                   	ret
+    panic("log.committing");
+80105be0:	83 ec 0c             	sub    $0xc,%esp
+80105be3:	68 21 bc 10 80       	push   $0x8010bc21
+80105be8:	e8 73 aa ff ff       	call   80100660 <panic>
+80105bed:	8d 76 00             	lea    0x0(%esi),%esi
+
+80105bf0 <log_write>:
+//   modify bp->data[]
+//   log_write(bp)
+//   brelse(bp)
+void
+log_write(struct buf *b)
+{
+80105bf0:	55                   	push   %ebp
+80105bf1:	89 e5                	mov    %esp,%ebp
+80105bf3:	57                   	push   %edi
+80105bf4:	56                   	push   %esi
+80105bf5:	53                   	push   %ebx
+80105bf6:	83 ec 1c             	sub    $0x1c,%esp
+80105bf9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  uint h;
+
+  if (log.lh.n >= log.cap)
+80105bfc:	a1 e8 5a 22 80       	mov    0x80225ae8,%eax
+80105c01:	39 05 10 5b 22 80    	cmp    %eax,0x80225b10
+80105c07:	0f 8d 1c 01 00 00    	jge    80105d29 <log_write+0x139>
+    panic("too big a transaction");
+  if (log.outstanding < 1)
+80105c0d:	a1 ec 5a 22 80       	mov    0x80225aec,%eax
+80105c12:	85 c0                	test   %eax,%eax
+80105c14:	0f 8e 02 01 00 00    	jle    80105d1c <log_write+0x12c>
+    panic("log_write outside of trans");
+
+  acquire(&log.lock);
+80105c1a:	83 ec 0c             	sub    $0xc,%esp
+80105c1d:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80105c20:	68 a0 5a 22 80       	push   $0x80225aa0
+80105c25:	e8 36 25 00 00       	call   80108160 <acquire>
+  if (loglookup(b->blockno) < 0) {   // else log absorbtion
+80105c2a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(h = blockno % LOGHASHSIZE; log.hash[h]; h = (h+1) % LOGHASHSIZE){
+80105c2d:	b8 49 82 b4 37       	mov    $0x37b48249,%eax
+80105c32:	83 c4 10             	add    $0x10,%esp
+  if (loglookup(b->blockno) < 0) {   // else log absorbtion
+80105c35:	8b 59 08             	mov    0x8(%ecx),%ebx
+  for(h = blockno % LOGHASHSIZE; log.hash[h]; h = (h+1) % LOGHASHSIZE){
+80105c38:	f7 e3                	mul    %ebx
+80105c3a:	89 d8                	mov    %ebx,%eax
+80105c3c:	29 d0                	sub    %edx,%eax
+80105c3e:	d1 e8                	shr    %eax
+80105c40:	8d 3c 02             	lea    (%edx,%eax,1),%edi
+80105c43:	c1 ef 09             	shr    $0x9,%edi
+80105c46:	69 c7 49 03 00 00    	imul   $0x349,%edi,%eax
+80105c4c:	89 df                	mov    %ebx,%edi
+80105c4e:	29 c7                	sub    %eax,%edi
+80105c50:	8d 97 c8 06 00 00    	lea    0x6c8(%edi),%edx
+80105c56:	0f b7 84 12 a8 5a 22 	movzwl -0x7fdda558(%edx,%edx,1),%eax
+80105c5d:	80 
+80105c5e:	66 85 c0             	test   %ax,%ax
+80105c61:	0f 84 96 00 00 00    	je     80105cfd <log_write+0x10d>
+80105c67:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80105c6a:	89 fa                	mov    %edi,%edx
+80105c6c:	be 49 82 b4 37       	mov    $0x37b48249,%esi
+80105c71:	eb 2e                	jmp    80105ca1 <log_write+0xb1>
+80105c73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105c77:	90                   	nop
+80105c78:	8d 7a 01             	lea    0x1(%edx),%edi
+80105c7b:	89 f8                	mov    %edi,%eax
+80105c7d:	f7 e6                	mul    %esi
+80105c7f:	89 f8                	mov    %edi,%eax
+80105c81:	29 d0                	sub    %edx,%eax
+80105c83:	d1 e8                	shr    %eax
+80105c85:	01 c2                	add    %eax,%edx
+80105c87:	c1 ea 09             	shr    $0x9,%edx
+80105c8a:	69 c2 49 03 00 00    	imul   $0x349,%edx,%eax
+80105c90:	29 c7                	sub    %eax,%edi
+80105c92:	0f b7 84 3f 38 68 22 	movzwl -0x7fdd97c8(%edi,%edi,1),%eax
+80105c99:	80 
+80105c9a:	89 fa                	mov    %edi,%edx
+80105c9c:	66 85 c0             	test   %ax,%ax
+80105c9f:	74 1f                	je     80105cc0 <log_write+0xd0>
+    if(log.lh.block[i] == blockno)
+80105ca1:	3b 1c 85 10 5b 22 80 	cmp    -0x7fdda4f0(,%eax,4),%ebx
+80105ca8:	75 ce                	jne    80105c78 <log_write+0x88>
+    for (h = b->blockno % LOGHASHSIZE; log.hash[h]; h = (h+1) % LOGHASHSIZE)
+      ;
+    log.lh.block[log.lh.n++] = b->blockno;
+    log.hash[h] = log.lh.n;
+  }
+  b->flags |= B_DIRTY; // prevent eviction
+80105caa:	83 09 04             	orl    $0x4,(%ecx)
+  release(&log.lock);
+80105cad:	c7 45 08 a0 5a 22 80 	movl   $0x80225aa0,0x8(%ebp)
+}
+80105cb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105cb7:	5b                   	pop    %ebx
+80105cb8:	5e                   	pop    %esi
+80105cb9:	5f                   	pop    %edi
+80105cba:	5d                   	pop    %ebp
+  release(&log.lock);
+80105cbb:	e9 e0 26 00 00       	jmp    801083a0 <release>
+    for (h = b->blockno % LOGHASHSIZE; log.hash[h]; h = (h+1) % LOGHASHSIZE)
+80105cc0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80105cc3:	be 49 82 b4 37       	mov    $0x37b48249,%esi
+80105cc8:	89 f8                	mov    %edi,%eax
+80105cca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80105cd0:	8d 78 01             	lea    0x1(%eax),%edi
+80105cd3:	89 f8                	mov    %edi,%eax
+80105cd5:	f7 e6                	mul    %esi
+80105cd7:	89 f8                	mov    %edi,%eax
+80105cd9:	29 d0                	sub    %edx,%eax
+80105cdb:	d1 e8                	shr    %eax
+80105cdd:	01 d0                	add    %edx,%eax
+80105cdf:	c1 e8 09             	shr    $0x9,%eax
+80105ce2:	69 d0 49 03 00 00    	imul   $0x349,%eax,%edx
+80105ce8:	89 f8                	mov    %edi,%eax
+80105cea:	29 d0                	sub    %edx,%eax
+80105cec:	66 83 bc 00 38 68 22 	cmpw   $0x0,-0x7fdd97c8(%eax,%eax,1)
+80105cf3:	80 00 
+80105cf5:	8d 90 c8 06 00 00    	lea    0x6c8(%eax),%edx
+80105cfb:	75 d3                	jne    80105cd0 <log_write+0xe0>
+    log.lh.block[log.lh.n++] = b->blockno;
+80105cfd:	8b 35 10 5b 22 80    	mov    0x80225b10,%esi
+80105d03:	8d 46 01             	lea    0x1(%esi),%eax
+80105d06:	89 1c b5 14 5b 22 80 	mov    %ebx,-0x7fdda4ec(,%esi,4)
+80105d0d:	a3 10 5b 22 80       	mov    %eax,0x80225b10
+    log.hash[h] = log.lh.n;
+80105d12:	66 89 84 12 a8 5a 22 	mov    %ax,-0x7fdda558(%edx,%edx,1)
+80105d19:	80 
+80105d1a:	eb 8e                	jmp    80105caa <log_write+0xba>
+    panic("log_write outside of trans");
+80105d1c:	83 ec 0c             	sub    $0xc,%esp
+80105d1f:	68 46 bc 10 80       	push   $0x8010bc46
+80105d24:	e8 37 a9 ff ff       	call   80100660 <panic>
+    panic("too big a transaction");
+80105d29:	83 ec 0c             	sub    $0xc,%esp
+80105d2c:	68 30 bc 10 80       	push   $0x8010bc30
+80105d31:	e8 2a a9 ff ff       	call   80100660 <panic>
+80105d36:	66 90                	xchg   %ax,%ax
+80105d38:	66 90                	xchg   %ax,%ax
+80105d3a:	66 90                	xchg   %ax,%ax
+80105d3c:	66 90                	xchg   %ax,%ax
+80105d3e:	66 90                	xchg   %ax,%ax
+
+80105d40 <mpmain>:
+}
+
+// Common CPU setup code.
+static void
+mpmain(void)
+{
+80105d40:	55                   	push   %ebp
+80105d41:	89 e5                	mov    %esp,%ebp
+80105d43:	53                   	push   %ebx
+80105d44:	83 ec 04             	sub    $0x4,%esp
+  cprintf("cpu%d: starting %d\n", cpuid(), cpuid());
+80105d47:	e8 54 0f 00 00       	call   80106ca0 <cpuid>
+80105d4c:	89 c3                	mov    %eax,%ebx
+80105d4e:	e8 4d 0f 00 00       	call   80106ca0 <cpuid>
+80105d53:	83 ec 04             	sub    $0x4,%esp
+80105d56:	53                   	push   %ebx
+80105d57:	50                   	push   %eax
+80105d58:	68 61 bc 10 80       	push   $0x8010bc61
+80105d5d:	e8 2e ac ff ff       	call   80100990 <cprintf>
+  idtinit();       // load idt register
+80105d62:	e8 79 3c 00 00       	call   801099e0 <idtinit>
+  xchg(&(mycpu()->started), 1); // tell startothers() we're up
+80105d67:	e8 d4 0e 00 00       	call   80106c40 <mycpu>
+80105d6c:	89 c2                	mov    %eax,%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+80105d6e:	b8 01 00 00 00       	mov    $0x1,%eax
+80105d73:	f0 87 82 a0 00 00 00 	lock xchg %eax,0xa0(%edx)
+  scheduler();     // start running processes
+80105d7a:	e8 01 14 00 00       	call   80107180 <scheduler>
+80105d7f:	90                   	nop
+
+80105d80 <mpenter>:
+{
+80105d80:	55                   	push   %ebp
+80105d81:	89 e5                	mov    %esp,%ebp
+80105d83:	83 ec 08             	sub    $0x8,%esp
+  switchkvm();
+80105d86:	e8 15 4f 00 00       	call   8010aca0 <switchkvm>
+  seginit();
+80105d8b:	e8 80 4e 00 00       	call   8010ac10 <seginit>
+  lapicinit();
+80105d90:	e8 cb f1 ff ff       	call   80104f60 <lapicinit>
+  mpmain();
+80105d95:	e8 a6 ff ff ff       	call   80105d40 <mpmain>
+80105d9a:	66 90                	xchg   %ax,%ax
+80105d9c:	66 90                	xchg   %ax,%ax
+80105d9e:	66 90                	xchg   %ax,%ax
+
+80105da0 <main>:
+{
+80105da0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+80105da4:	83 e4 f0             	and    $0xfffffff0,%esp
+80105da7:	ff 71 fc             	push   -0x4(%ecx)
+80105daa:	55                   	push   %ebp
+80105dab:	89 e5                	mov    %esp,%ebp
+80105dad:	53                   	push   %ebx
+80105dae:	51                   	push   %ecx
+  kinit1(end, P2V(4*1024*1024)); // phys page allocator
+80105daf:	83 ec 08             	sub    $0x8,%esp
+80105db2:	68 00 00 40 80       	push   $0x80400000
+80105db7:	68 f0 78 23 80       	push   $0x802378f0
+80105dbc:	e8 5f ed ff ff       	call   80104b20 <kinit1>
+  kvmalloc();      // kernel page table
+80105dc1:	e8 9a 53 00 00       	call   8010b160 <kvmalloc>
+  mpinit();        // detect other processors
+80105dc6:	e8 85 01 00 00       	call   80105f50 <mpinit>
+  lapicinit();     // interrupt controller
+80105dcb:	e8 90 f1 ff ff       	call   80104f60 <lapicinit>
+  seginit();       // segment descriptors
+80105dd0:	e8 3b 4e 00 00       	call   8010ac10 <seginit>
+  picinit();       // disable pic
+80105dd5:	e8 86 03 00 00       	call   80106160 <picinit>
+  ioapicinit();    // another interrupt controller
+80105dda:	e8 71 ea ff ff       	call   80104850 <ioapicinit>
+  consoleinit();   // console hardware
+80105ddf:	e8 bc af ff ff       	call   80100da0 <consoleinit>
+  uartinit();      // serial port
+80105de4:	e8 97 40 00 00       	call   80109e80 <uartinit>
+  pinit();         // process table
+80105de9:	e8 e2 0d 00 00       	call   80106bd0 <pinit>
+  tvinit();        // trap vectors
+80105dee:	e8 6d 3b 00 00       	call   80109960 <tvinit>
+  binit();         // buffer cache
+80105df3:	e8 98 a4 ff ff       	call   80100290 <binit>
+  fileinit();      // file table
+80105df8:	e8 43 b5 ff ff       	call   80101340 <fileinit>
+  ideinit();       // disk 
+80105dfd:	e8 ee e5 ff ff       	call   801043f0 <ideinit>
+
+  // Write entry code to unused memory at 0x7000.
+  // The linker has placed the image of entryother.S in
+  // _binary_entryother_start.
+  code = P2V(0x7000);
+  memmove(code, _binary_entryother_start, (uint)_binary_entryother_size);
+80105e02:	83 c4 0c             	add    $0xc,%esp
+80105e05:	68 8a 00 00 00       	push   $0x8a
+80105e0a:	68 8c f4 10 80       	push   $0x8010f48c
+80105e0f:	68 00 70 00 80       	push   $0x80007000
+80105e14:	e8 07 27 00 00       	call   80108520 <memmove>
+
+  for(c = cpus; c < cpus+ncpu; c++){
+80105e19:	83 c4 10             	add    $0x10,%esp
+80105e1c:	69 05 64 71 22 80 bc 	imul   $0xbc,0x80227164,%eax
+80105e23:	00 00 00 
+80105e26:	05 80 71 22 80       	add    $0x80227180,%eax
+80105e2b:	3d 80 71 22 80       	cmp    $0x80227180,%eax
+80105e30:	76 7e                	jbe    80105eb0 <main+0x110>
+80105e32:	bb 80 71 22 80       	mov    $0x80227180,%ebx
+80105e37:	eb 20                	jmp    80105e59 <main+0xb9>
+80105e39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105e40:	69 05 64 71 22 80 bc 	imul   $0xbc,0x80227164,%eax
+80105e47:	00 00 00 
+80105e4a:	81 c3 bc 00 00 00    	add    $0xbc,%ebx
+80105e50:	05 80 71 22 80       	add    $0x80227180,%eax
+80105e55:	39 c3                	cmp    %eax,%ebx
+80105e57:	73 57                	jae    80105eb0 <main+0x110>
+    if(c == mycpu())  // We've started already.
+80105e59:	e8 e2 0d 00 00       	call   80106c40 <mycpu>
+80105e5e:	39 c3                	cmp    %eax,%ebx
+80105e60:	74 de                	je     80105e40 <main+0xa0>
+      continue;
+
+    // Tell entryother.S what stack to use, where to enter, and what
+    // pgdir to use. We cannot use kpgdir yet, because the AP processor
+    // is running in low  memory, so we use entrypgdir for the APs too.
+    stack = kalloc();
+80105e62:	e8 49 ed ff ff       	call   80104bb0 <kalloc>
+    *(void**)(code-4) = stack + KSTACKSIZE;
+    *(void**)(code-8) = mpenter;
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+
+    lapicstartap(c->apicid, V2P(code));
+80105e67:	83 ec 08             	sub    $0x8,%esp
+    *(void**)(code-8) = mpenter;
+80105e6a:	c7 05 f8 6f 00 80 80 	movl   $0x80105d80,0x80006ff8
+80105e71:	5d 10 80 
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+80105e74:	c7 05 f4 6f 00 80 00 	movl   $0x10e000,0x80006ff4
+80105e7b:	e0 10 00 
+    *(void**)(code-4) = stack + KSTACKSIZE;
+80105e7e:	05 00 10 00 00       	add    $0x1000,%eax
+80105e83:	a3 fc 6f 00 80       	mov    %eax,0x80006ffc
+    lapicstartap(c->apicid, V2P(code));
+80105e88:	0f b6 03             	movzbl (%ebx),%eax
+80105e8b:	68 00 70 00 00       	push   $0x7000
+80105e90:	50                   	push   %eax
+80105e91:	e8 5a f2 ff ff       	call   801050f0 <lapicstartap>
+
+    // wait for cpu to finish mpmain()
+    while(c->started == 0)
+80105e96:	83 c4 10             	add    $0x10,%esp
+80105e99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105ea0:	8b 83 a0 00 00 00    	mov    0xa0(%ebx),%eax
+80105ea6:	85 c0                	test   %eax,%eax
+80105ea8:	74 f6                	je     80105ea0 <main+0x100>
+80105eaa:	eb 94                	jmp    80105e40 <main+0xa0>
+80105eac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+80105eb0:	83 ec 08             	sub    $0x8,%esp
+80105eb3:	68 00 00 00 8e       	push   $0x8e000000
+80105eb8:	68 00 00 40 80       	push   $0x80400000
+80105ebd:	e8 ee eb ff ff       	call   80104ab0 <kinit2>
+  userinit();      // first user process
+80105ec2:	e8 d9 0f 00 00       	call   80106ea0 <userinit>
+  mpmain();        // finish this processor's setup
+80105ec7:	e8 74 fe ff ff       	call   80105d40 <mpmain>
+80105ecc:	66 90                	xchg   %ax,%ax
+80105ece:	66 90                	xchg   %ax,%ax
+
+80105ed0 <mpsearch1>:
+}
+
+// Look for an MP structure in the len bytes at addr.
+static struct mp*
+mpsearch1(uint a, int len)
+{
+80105ed0:	55                   	push   %ebp
+80105ed1:	89 e5                	mov    %esp,%ebp
+80105ed3:	57                   	push   %edi
+80105ed4:	56                   	push   %esi
+  uchar *e, *p, *addr;
+
+  addr = P2V(a);
+80105ed5:	8d b0 00 00 00 80    	lea    -0x80000000(%eax),%esi
+{
+80105edb:	53                   	push   %ebx
+  e = addr+len;
+80105edc:	8d 1c 16             	lea    (%esi,%edx,1),%ebx
+{
+80105edf:	83 ec 0c             	sub    $0xc,%esp
+  for(p = addr; p < e; p += sizeof(struct mp))
+80105ee2:	39 de                	cmp    %ebx,%esi
+80105ee4:	72 10                	jb     80105ef6 <mpsearch1+0x26>
+80105ee6:	eb 50                	jmp    80105f38 <mpsearch1+0x68>
+80105ee8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105eef:	90                   	nop
+80105ef0:	89 fe                	mov    %edi,%esi
+80105ef2:	39 df                	cmp    %ebx,%edi
+80105ef4:	73 42                	jae    80105f38 <mpsearch1+0x68>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80105ef6:	83 ec 04             	sub    $0x4,%esp
+80105ef9:	8d 7e 10             	lea    0x10(%esi),%edi
+80105efc:	6a 04                	push   $0x4
+80105efe:	68 75 bc 10 80       	push   $0x8010bc75
+80105f03:	56                   	push   %esi
+80105f04:	e8 c7 25 00 00       	call   801084d0 <memcmp>
+80105f09:	83 c4 10             	add    $0x10,%esp
+80105f0c:	85 c0                	test   %eax,%eax
+80105f0e:	75 e0                	jne    80105ef0 <mpsearch1+0x20>
+80105f10:	89 f2                	mov    %esi,%edx
+80105f12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    sum += addr[i];
+80105f18:	0f b6 0a             	movzbl (%edx),%ecx
+  for(i=0; i<len; i++)
+80105f1b:	83 c2 01             	add    $0x1,%edx
+    sum += addr[i];
+80105f1e:	01 c8                	add    %ecx,%eax
+  for(i=0; i<len; i++)
+80105f20:	39 fa                	cmp    %edi,%edx
+80105f22:	75 f4                	jne    80105f18 <mpsearch1+0x48>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80105f24:	84 c0                	test   %al,%al
+80105f26:	75 c8                	jne    80105ef0 <mpsearch1+0x20>
+      return (struct mp*)p;
+  return 0;
+}
+80105f28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105f2b:	89 f0                	mov    %esi,%eax
+80105f2d:	5b                   	pop    %ebx
+80105f2e:	5e                   	pop    %esi
+80105f2f:	5f                   	pop    %edi
+80105f30:	5d                   	pop    %ebp
+80105f31:	c3                   	ret
+80105f32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80105f38:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+80105f3b:	31 f6                	xor    %esi,%esi
+}
+80105f3d:	5b                   	pop    %ebx
+80105f3e:	89 f0                	mov    %esi,%eax
+80105f40:	5e                   	pop    %esi
+80105f41:	5f                   	pop    %edi
+80105f42:	5d                   	pop    %ebp
+80105f43:	c3                   	ret
+80105f44:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105f4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105f4f:	90                   	nop
+
+80105f50 <mpinit>:
+  return conf;
+}
+
+void
+mpinit(void)
+{
+80105f50:	55                   	push   %ebp
+80105f51:	89 e5                	mov    %esp,%ebp
+80105f53:	57                   	push   %edi
+80105f54:	56                   	push   %esi
+80105f55:	53                   	push   %ebx
+80105f56:	83 ec 1c             	sub    $0x1c,%esp
+  if((p = ((bda[0x0F]<<8)| bda[0x0E]) << 4)){
+80105f59:	0f b6 05 0f 04 00 80 	movzbl 0x8000040f,%eax
+80105f60:	0f b6 15 0e 04 00 80 	movzbl 0x8000040e,%edx
+80105f67:	c1 e0 08             	shl    $0x8,%eax
+80105f6a:	09 d0                	or     %edx,%eax
+80105f6c:	c1 e0 04             	shl    $0x4,%eax
+80105f6f:	75 1b                	jne    80105f8c <mpinit+0x3c>
+    p = ((bda[0x14]<<8)|bda[0x13])*1024;
+80105f71:	0f b6 05 14 04 00 80 	movzbl 0x80000414,%eax
+80105f78:	0f b6 15 13 04 00 80 	movzbl 0x80000413,%edx
+80105f7f:	c1 e0 08             	shl    $0x8,%eax
+80105f82:	09 d0                	or     %edx,%eax
+80105f84:	c1 e0 0a             	shl    $0xa,%eax
+    if((mp = mpsearch1(p-1024, 1024)))
+80105f87:	2d 00 04 00 00       	sub    $0x400,%eax
+    if((mp = mpsearch1(p, 1024)))
+80105f8c:	ba 00 04 00 00       	mov    $0x400,%edx
+80105f91:	e8 3a ff ff ff       	call   80105ed0 <mpsearch1>
+80105f96:	89 c3                	mov    %eax,%ebx
+80105f98:	85 c0                	test   %eax,%eax
+80105f9a:	0f 84 50 01 00 00    	je     801060f0 <mpinit+0x1a0>
+  if((mp = mpsearch()) == 0 || mp->physaddr == 0)
+80105fa0:	8b 73 04             	mov    0x4(%ebx),%esi
+80105fa3:	85 f6                	test   %esi,%esi
+80105fa5:	0f 84 35 01 00 00    	je     801060e0 <mpinit+0x190>
+  if(memcmp(conf, "PCMP", 4) != 0)
+80105fab:	83 ec 04             	sub    $0x4,%esp
+  conf = (struct mpconf*) P2V((uint) mp->physaddr);
+80105fae:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+80105fb4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(memcmp(conf, "PCMP", 4) != 0)
+80105fb7:	6a 04                	push   $0x4
+80105fb9:	68 7a bc 10 80       	push   $0x8010bc7a
+80105fbe:	50                   	push   %eax
+80105fbf:	e8 0c 25 00 00       	call   801084d0 <memcmp>
+80105fc4:	83 c4 10             	add    $0x10,%esp
+80105fc7:	85 c0                	test   %eax,%eax
+80105fc9:	0f 85 11 01 00 00    	jne    801060e0 <mpinit+0x190>
+  if(conf->version != 1 && conf->version != 4)
+80105fcf:	0f b6 86 06 00 00 80 	movzbl -0x7ffffffa(%esi),%eax
+80105fd6:	3c 01                	cmp    $0x1,%al
+80105fd8:	74 08                	je     80105fe2 <mpinit+0x92>
+80105fda:	3c 04                	cmp    $0x4,%al
+80105fdc:	0f 85 fe 00 00 00    	jne    801060e0 <mpinit+0x190>
+  if(sum((uchar*)conf, conf->length) != 0)
+80105fe2:	0f b7 96 04 00 00 80 	movzwl -0x7ffffffc(%esi),%edx
+  for(i=0; i<len; i++)
+80105fe9:	66 85 d2             	test   %dx,%dx
+80105fec:	74 22                	je     80106010 <mpinit+0xc0>
+80105fee:	8d 3c 32             	lea    (%edx,%esi,1),%edi
+80105ff1:	89 f0                	mov    %esi,%eax
+  sum = 0;
+80105ff3:	31 d2                	xor    %edx,%edx
+80105ff5:	8d 76 00             	lea    0x0(%esi),%esi
+    sum += addr[i];
+80105ff8:	0f b6 88 00 00 00 80 	movzbl -0x80000000(%eax),%ecx
+  for(i=0; i<len; i++)
+80105fff:	83 c0 01             	add    $0x1,%eax
+    sum += addr[i];
+80106002:	01 ca                	add    %ecx,%edx
+  for(i=0; i<len; i++)
+80106004:	39 c7                	cmp    %eax,%edi
+80106006:	75 f0                	jne    80105ff8 <mpinit+0xa8>
+  if(sum((uchar*)conf, conf->length) != 0)
+80106008:	84 d2                	test   %dl,%dl
+8010600a:	0f 85 d0 00 00 00    	jne    801060e0 <mpinit+0x190>
+  struct mpioapic *ioapic;
+
+  if((conf = mpconfig(&mp)) == 0)
+    panic("Expect to run on an SMP");
+  ismp = 1;
+  lapic = (uint*)conf->lapicaddr;
+80106010:	8b 86 24 00 00 80    	mov    -0x7fffffdc(%esi),%eax
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80106016:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80106019:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  lapic = (uint*)conf->lapicaddr;
+8010601c:	a3 88 5a 22 80       	mov    %eax,0x80225a88
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80106021:	0f b7 96 04 00 00 80 	movzwl -0x7ffffffc(%esi),%edx
+80106028:	8d 86 2c 00 00 80    	lea    -0x7fffffd4(%esi),%eax
+  ismp = 1;
+8010602e:	be 01 00 00 00       	mov    $0x1,%esi
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80106033:	01 d7                	add    %edx,%edi
+80106035:	89 fa                	mov    %edi,%edx
+80106037:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010603e:	66 90                	xchg   %ax,%ax
+80106040:	39 d0                	cmp    %edx,%eax
+80106042:	73 15                	jae    80106059 <mpinit+0x109>
+    switch(*p){
+80106044:	0f b6 08             	movzbl (%eax),%ecx
+80106047:	80 f9 02             	cmp    $0x2,%cl
+8010604a:	74 54                	je     801060a0 <mpinit+0x150>
+8010604c:	77 42                	ja     80106090 <mpinit+0x140>
+8010604e:	84 c9                	test   %cl,%cl
+80106050:	74 5e                	je     801060b0 <mpinit+0x160>
+      p += sizeof(struct mpioapic);
+      continue;
+    case MPBUS:
+    case MPIOINTR:
+    case MPLINTR:
+      p += 8;
+80106052:	83 c0 08             	add    $0x8,%eax
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80106055:	39 d0                	cmp    %edx,%eax
+80106057:	72 eb                	jb     80106044 <mpinit+0xf4>
+    default:
+      ismp = 0;
+      break;
+    }
+  }
+  if(!ismp)
+80106059:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+8010605c:	85 f6                	test   %esi,%esi
+8010605e:	0f 84 e1 00 00 00    	je     80106145 <mpinit+0x1f5>
+    panic("Didn't find a suitable machine");
+
+  if(mp->imcrp){
+80106064:	80 7b 0c 00          	cmpb   $0x0,0xc(%ebx)
+80106068:	74 15                	je     8010607f <mpinit+0x12f>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010606a:	b8 70 00 00 00       	mov    $0x70,%eax
+8010606f:	ba 22 00 00 00       	mov    $0x22,%edx
+80106074:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80106075:	ba 23 00 00 00       	mov    $0x23,%edx
+8010607a:	ec                   	in     (%dx),%al
+    // Bochs doesn't support IMCR, so this doesn't run on Bochs.
+    // But it would on real hardware.
+    outb(0x22, 0x70);   // Select IMCR
+    outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+8010607b:	83 c8 01             	or     $0x1,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010607e:	ee                   	out    %al,(%dx)
+  }
+}
+8010607f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106082:	5b                   	pop    %ebx
+80106083:	5e                   	pop    %esi
+80106084:	5f                   	pop    %edi
+80106085:	5d                   	pop    %ebp
+80106086:	c3                   	ret
+80106087:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010608e:	66 90                	xchg   %ax,%ax
+    switch(*p){
+80106090:	83 e9 03             	sub    $0x3,%ecx
+80106093:	80 f9 01             	cmp    $0x1,%cl
+80106096:	76 ba                	jbe    80106052 <mpinit+0x102>
+80106098:	31 f6                	xor    %esi,%esi
+8010609a:	eb a4                	jmp    80106040 <mpinit+0xf0>
+8010609c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      ioapicid = ioapic->apicno;
+801060a0:	0f b6 48 01          	movzbl 0x1(%eax),%ecx
+      p += sizeof(struct mpioapic);
+801060a4:	83 c0 08             	add    $0x8,%eax
+      ioapicid = ioapic->apicno;
+801060a7:	88 0d 60 71 22 80    	mov    %cl,0x80227160
+      continue;
+801060ad:	eb 91                	jmp    80106040 <mpinit+0xf0>
+801060af:	90                   	nop
+      if(ncpu < NCPU) {
+801060b0:	8b 0d 64 71 22 80    	mov    0x80227164,%ecx
+801060b6:	83 f9 07             	cmp    $0x7,%ecx
+801060b9:	7f 19                	jg     801060d4 <mpinit+0x184>
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+801060bb:	69 f9 bc 00 00 00    	imul   $0xbc,%ecx,%edi
+801060c1:	0f b6 58 01          	movzbl 0x1(%eax),%ebx
+        ncpu++;
+801060c5:	83 c1 01             	add    $0x1,%ecx
+801060c8:	89 0d 64 71 22 80    	mov    %ecx,0x80227164
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+801060ce:	88 9f 80 71 22 80    	mov    %bl,-0x7fdd8e80(%edi)
+      p += sizeof(struct mpproc);
+801060d4:	83 c0 14             	add    $0x14,%eax
+      continue;
+801060d7:	e9 64 ff ff ff       	jmp    80106040 <mpinit+0xf0>
+801060dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    panic("Expect to run on an SMP");
+801060e0:	83 ec 0c             	sub    $0xc,%esp
+801060e3:	68 7f bc 10 80       	push   $0x8010bc7f
+801060e8:	e8 73 a5 ff ff       	call   80100660 <panic>
+801060ed:	8d 76 00             	lea    0x0(%esi),%esi
+{
+801060f0:	bb 00 00 0f 80       	mov    $0x800f0000,%ebx
+801060f5:	eb 13                	jmp    8010610a <mpinit+0x1ba>
+801060f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801060fe:	66 90                	xchg   %ax,%ax
+  for(p = addr; p < e; p += sizeof(struct mp))
+80106100:	89 f3                	mov    %esi,%ebx
+80106102:	81 fe 00 00 10 80    	cmp    $0x80100000,%esi
+80106108:	74 d6                	je     801060e0 <mpinit+0x190>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+8010610a:	83 ec 04             	sub    $0x4,%esp
+8010610d:	8d 73 10             	lea    0x10(%ebx),%esi
+80106110:	6a 04                	push   $0x4
+80106112:	68 75 bc 10 80       	push   $0x8010bc75
+80106117:	53                   	push   %ebx
+80106118:	e8 b3 23 00 00       	call   801084d0 <memcmp>
+8010611d:	83 c4 10             	add    $0x10,%esp
+80106120:	85 c0                	test   %eax,%eax
+80106122:	75 dc                	jne    80106100 <mpinit+0x1b0>
+80106124:	89 da                	mov    %ebx,%edx
+80106126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010612d:	8d 76 00             	lea    0x0(%esi),%esi
+    sum += addr[i];
+80106130:	0f b6 0a             	movzbl (%edx),%ecx
+  for(i=0; i<len; i++)
+80106133:	83 c2 01             	add    $0x1,%edx
+    sum += addr[i];
+80106136:	01 c8                	add    %ecx,%eax
+  for(i=0; i<len; i++)
+80106138:	39 f2                	cmp    %esi,%edx
+8010613a:	75 f4                	jne    80106130 <mpinit+0x1e0>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+8010613c:	84 c0                	test   %al,%al
+8010613e:	75 c0                	jne    80106100 <mpinit+0x1b0>
+80106140:	e9 5b fe ff ff       	jmp    80105fa0 <mpinit+0x50>
+    panic("Didn't find a suitable machine");
+80106145:	83 ec 0c             	sub    $0xc,%esp
+80106148:	68 98 bc 10 80       	push   $0x8010bc98
+8010614d:	e8 0e a5 ff ff       	call   80100660 <panic>
+80106152:	66 90                	xchg   %ax,%ax
+80106154:	66 90                	xchg   %ax,%ax
+80106156:	66 90                	xchg   %ax,%ax
+80106158:	66 90                	xchg   %ax,%ax
+8010615a:	66 90                	xchg   %ax,%ax
+8010615c:	66 90                	xchg   %ax,%ax
+8010615e:	66 90                	xchg   %ax,%ax
+
+80106160 <picinit>:
+80106160:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106165:	ba 21 00 00 00       	mov    $0x21,%edx
+8010616a:	ee                   	out    %al,(%dx)
+8010616b:	ba a1 00 00 00       	mov    $0xa1,%edx
+80106170:	ee                   	out    %al,(%dx)
+picinit(void)
+{
+  // mask all interrupts
+  outb(IO_PIC1+1, 0xFF);
+  outb(IO_PIC2+1, 0xFF);
+}
+80106171:	c3                   	ret
+80106172:	66 90                	xchg   %ax,%ax
+80106174:	66 90                	xchg   %ax,%ax
+80106176:	66 90                	xchg   %ax,%ax
+80106178:	66 90                	xchg   %ax,%ax
+8010617a:	66 90                	xchg   %ax,%ax
+8010617c:	66 90                	xchg   %ax,%ax
+8010617e:	66 90                	xchg   %ax,%ax
+
+80106180 <pipealloc>:
+  return 0;
+}
+
+int
+pipealloc(struct file **f0, struct file **f1)
+{
+80106180:	55                   	push   %ebp
+80106181:	89 e5                	mov    %esp,%ebp
+80106183:	57                   	push   %edi
+80106184:	56                   	push   %esi
+80106185:	53                   	push   %ebx
+80106186:	83 ec 0c             	sub    $0xc,%esp
+80106189:	8b 75 08             	mov    0x8(%ebp),%esi
+8010618c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  struct pipe *p;
+
+  p = 0;
+  *f0 = *f1 = 0;
+8010618f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+80106195:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if((*f0 = filealloc()) == 0 || (*f1 = filealloc()) == 0)
+8010619b:	e8 c0 b1 ff ff       	call   80101360 <filealloc>
+801061a0:	89 06                	mov    %eax,(%esi)
+801061a2:	85 c0                	test   %eax,%eax
+801061a4:	0f 84 da 00 00 00    	je     80106284 <pipealloc+0x104>
+801061aa:	e8 b1 b1 ff ff       	call   80101360 <filealloc>
+801061af:	89 07                	mov    %eax,(%edi)
+801061b1:	85 c0                	test   %eax,%eax
+801061b3:	0f 84 e4 00 00 00    	je     8010629d <pipealloc+0x11d>
+    goto bad;
+  if((p = (struct pipe*)kalloc()) == 0)
+801061b9:	e8 f2 e9 ff ff       	call   80104bb0 <kalloc>
+801061be:	89 c3                	mov    %eax,%ebx
+801061c0:	85 c0                	test   %eax,%eax
+801061c2:	0f 84 aa 00 00 00    	je     80106272 <pipealloc+0xf2>
+    goto bad;
+  memset(p, 0, sizeof(*p));
+801061c8:	83 ec 04             	sub    $0x4,%esp
+801061cb:	68 9c 00 00 00       	push   $0x9c
+801061d0:	6a 00                	push   $0x0
+801061d2:	50                   	push   %eax
+801061d3:	e8 b8 22 00 00       	call   80108490 <memset>
+    if((pg[i] = kalloc()) == 0){
+801061d8:	e8 d3 e9 ff ff       	call   80104bb0 <kalloc>
+801061dd:	83 c4 10             	add    $0x10,%esp
+801061e0:	89 43 40             	mov    %eax,0x40(%ebx)
+801061e3:	85 c0                	test   %eax,%eax
+801061e5:	74 7f                	je     80106266 <pipealloc+0xe6>
+  if(pipepages(p->page, PIPEPAGES) < 0)
+    goto bad;
+  p->size = PIPEPAGES*PGSIZE;
+801061e7:	c7 83 80 00 00 00 00 	movl   $0x1000,0x80(%ebx)
+801061ee:	10 00 00 
+  p->readopen = 1;
+  p->writeopen = 1;
+  p->nwrite = 0;
+  p->nread = 0;
+  initlock(&p->lock, "pipe");
+801061f1:	83 ec 08             	sub    $0x8,%esp
+  p->readopen = 1;
+801061f4:	c7 83 8c 00 00 00 01 	movl   $0x1,0x8c(%ebx)
+801061fb:	00 00 00 
+  p->writeopen = 1;
+801061fe:	c7 83 90 00 00 00 01 	movl   $0x1,0x90(%ebx)
+80106205:	00 00 00 
+  p->nwrite = 0;
+80106208:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+8010620f:	00 00 00 
+  p->nread = 0;
+80106212:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+80106219:	00 00 00 
+  initlock(&p->lock, "pipe");
+8010621c:	68 b7 bc 10 80       	push   $0x8010bcb7
+80106221:	53                   	push   %ebx
+80106222:	e8 e9 1c 00 00       	call   80107f10 <initlock>
+  (*f0)->type = FD_PIPE;
+80106227:	8b 06                	mov    (%esi),%eax
+  (*f0)->pipe = p;
+  (*f1)->type = FD_PIPE;
+  (*f1)->readable = 0;
+  (*f1)->writable = 1;
+  (*f1)->pipe = p;
+  return 0;
+80106229:	83 c4 10             	add    $0x10,%esp
+  (*f0)->type = FD_PIPE;
+8010622c:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f0)->readable = 1;
+80106232:	8b 06                	mov    (%esi),%eax
+80106234:	c6 40 08 01          	movb   $0x1,0x8(%eax)
+  (*f0)->writable = 0;
+80106238:	8b 06                	mov    (%esi),%eax
+8010623a:	c6 40 09 00          	movb   $0x0,0x9(%eax)
+  (*f0)->pipe = p;
+8010623e:	8b 06                	mov    (%esi),%eax
+80106240:	89 58 0c             	mov    %ebx,0xc(%eax)
+  (*f1)->type = FD_PIPE;
+80106243:	8b 07                	mov    (%edi),%eax
+80106245:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f1)->readable = 0;
+8010624b:	8b 07                	mov    (%edi),%eax
+8010624d:	c6 40 08 00          	movb   $0x0,0x8(%eax)
+  (*f1)->writable = 1;
+80106251:	8b 07                	mov    (%edi),%eax
+80106253:	c6 40 09 01          	movb   $0x1,0x9(%eax)
+  (*f1)->pipe = p;
+80106257:	8b 07                	mov    (%edi),%eax
+80106259:	89 58 0c             	mov    %ebx,0xc(%eax)
+  return 0;
+8010625c:	31 c0                	xor    %eax,%eax
+  if(*f0)
+    fileclose(*f0);
+  if(*f1)
+    fileclose(*f1);
+  return -1;
+}
+8010625e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106261:	5b                   	pop    %ebx
+80106262:	5e                   	pop    %esi
+80106263:	5f                   	pop    %edi
+80106264:	5d                   	pop    %ebp
+80106265:	c3                   	ret
+    kfree((char*)p);
+80106266:	83 ec 0c             	sub    $0xc,%esp
+80106269:	53                   	push   %ebx
+8010626a:	e8 c1 e6 ff ff       	call   80104930 <kfree>
+8010626f:	83 c4 10             	add    $0x10,%esp
+  if(*f0)
+80106272:	8b 06                	mov    (%esi),%eax
+80106274:	85 c0                	test   %eax,%eax
+80106276:	74 0c                	je     80106284 <pipealloc+0x104>
+    fileclose(*f0);
+80106278:	83 ec 0c             	sub    $0xc,%esp
+8010627b:	50                   	push   %eax
+8010627c:	e8 9f b1 ff ff       	call   80101420 <fileclose>
+80106281:	83 c4 10             	add    $0x10,%esp
+  if(*f1)
+80106284:	8b 07                	mov    (%edi),%eax
+80106286:	85 c0                	test   %eax,%eax
+80106288:	74 0c                	je     80106296 <pipealloc+0x116>
+    fileclose(*f1);
+8010628a:	83 ec 0c             	sub    $0xc,%esp
+8010628d:	50                   	push   %eax
+8010628e:	e8 8d b1 ff ff       	call   80101420 <fileclose>
+80106293:	83 c4 10             	add    $0x10,%esp
+  return -1;
+80106296:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010629b:	eb c1                	jmp    8010625e <pipealloc+0xde>
+  if(*f0)
+8010629d:	8b 06                	mov    (%esi),%eax
+8010629f:	85 c0                	test   %eax,%eax
+801062a1:	75 d5                	jne    80106278 <pipealloc+0xf8>
+801062a3:	eb f1                	jmp    80106296 <pipealloc+0x116>
+801062a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801062ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801062b0 <pipeclose>:
+
+void
+pipeclose(struct pipe *p, int writable)
+{
+801062b0:	55                   	push   %ebp
+801062b1:	89 e5                	mov    %esp,%ebp
+801062b3:	56                   	push   %esi
+801062b4:	53                   	push   %ebx
+801062b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801062b8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int i;
+
+  acquire(&p->lock);
+801062bb:	83 ec 0c             	sub    $0xc,%esp
+801062be:	53                   	push   %ebx
+801062bf:	e8 9c 1e 00 00       	call   80108160 <acquire>
+  if(writable){
+801062c4:	83 c4 10             	add    $0x10,%esp
+801062c7:	85 f6                	test   %esi,%esi
+801062c9:	74 45                	je     80106310 <pipeclose+0x60>
+    p->writeopen = 0;
+    wakeup(&p->nread);
+801062cb:	83 ec 0c             	sub    $0xc,%esp
+801062ce:	8d 83 84 00 00 00    	lea    0x84(%ebx),%eax
+    p->writeopen = 0;
+801062d4:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%ebx)
+801062db:	00 00 00 
+    wakeup(&p->nread);
+801062de:	50                   	push   %eax
+801062df:	e8 ac 15 00 00       	call   80107890 <wakeup>
+801062e4:	83 c4 10             	add    $0x10,%esp
+  } else {
+    p->readopen = 0;
+    wakeup(&p->nwrite);
+  }
+  if(p->readopen == 0 && p->writeopen == 0){
+801062e7:	8b 83 8c 00 00 00    	mov    0x8c(%ebx),%eax
+801062ed:	85 c0                	test   %eax,%eax
+801062ef:	75 0a                	jne    801062fb <pipeclose+0x4b>
+801062f1:	8b b3 90 00 00 00    	mov    0x90(%ebx),%esi
+801062f7:	85 f6                	test   %esi,%esi
+801062f9:	74 35                	je     80106330 <pipeclose+0x80>
+    release(&p->lock);
+    for(i = 0; i < p->size/PGSIZE; i++)
+      kfree(p->page[i]);
+    kfree((char*)p);
+  } else
+    release(&p->lock);
+801062fb:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+801062fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106301:	5b                   	pop    %ebx
+80106302:	5e                   	pop    %esi
+80106303:	5d                   	pop    %ebp
+    release(&p->lock);
+80106304:	e9 97 20 00 00       	jmp    801083a0 <release>
+80106309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    wakeup(&p->nwrite);
+80106310:	83 ec 0c             	sub    $0xc,%esp
+80106313:	8d 83 88 00 00 00    	lea    0x88(%ebx),%eax
+    p->readopen = 0;
+80106319:	c7 83 8c 00 00 00 00 	movl   $0x0,0x8c(%ebx)
+80106320:	00 00 00 
+    wakeup(&p->nwrite);
+80106323:	50                   	push   %eax
+80106324:	e8 67 15 00 00       	call   80107890 <wakeup>
+80106329:	83 c4 10             	add    $0x10,%esp
+8010632c:	eb b9                	jmp    801062e7 <pipeclose+0x37>
+8010632e:	66 90                	xchg   %ax,%ax
+    release(&p->lock);
+80106330:	83 ec 0c             	sub    $0xc,%esp
+80106333:	53                   	push   %ebx
+80106334:	e8 67 20 00 00       	call   801083a0 <release>
+    for(i = 0; i < p->size/PGSIZE; i++)
+80106339:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+8010633f:	83 c4 10             	add    $0x10,%esp
+80106342:	c1 e8 0c             	shr    $0xc,%eax
+80106345:	74 28                	je     8010636f <pipeclose+0xbf>
+80106347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010634e:	66 90                	xchg   %ax,%ax
+      kfree(p->page[i]);
+80106350:	83 ec 0c             	sub    $0xc,%esp
+80106353:	ff 74 b3 40          	push   0x40(%ebx,%esi,4)
+    for(i = 0; i < p->size/PGSIZE; i++)
+80106357:	83 c6 01             	add    $0x1,%esi
+      kfree(p->page[i]);
+8010635a:	e8 d1 e5 ff ff       	call   80104930 <kfree>
+    for(i = 0; i < p->size/PGSIZE; i++)
+8010635f:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+80106365:	83 c4 10             	add    $0x10,%esp
+80106368:	c1 e8 0c             	shr    $0xc,%eax
+8010636b:	39 c6                	cmp    %eax,%esi
+8010636d:	72 e1                	jb     80106350 <pipeclose+0xa0>
+    kfree((char*)p);
+8010636f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+80106372:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106375:	5b                   	pop    %ebx
+80106376:	5e                   	pop    %esi
+80106377:	5d                   	pop    %ebp
+    kfree((char*)p);
+80106378:	e9 b3 e5 ff ff       	jmp    80104930 <kfree>
+8010637d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80106380 <pipesize>:
+// power of two pages.  Returns the new capacity, or -1 if n is
+// too big, or too small for the data in the pipe, or there is
+// no memory.  n of 0 just returns the capacity.
+int
+pipesize(struct pipe *p, int n)
+{
+80106380:	55                   	push   %ebp
+80106381:	89 e5                	mov    %esp,%ebp
+80106383:	57                   	push   %edi
+80106384:	56                   	push   %esi
+80106385:	53                   	push   %ebx
+80106386:	83 ec 5c             	sub    $0x5c,%esp
+80106389:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010638c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  char *pg[PIPEMAXPAGES];
+  uint size, off, m, i;
+
+  if(n < 0 || n > PIPEMAXPAGES*PGSIZE)
+8010638f:	3d 00 00 01 00       	cmp    $0x10000,%eax
+80106394:	77 71                	ja     80106407 <pipesize+0x87>
+    return -1;
+  if(n == 0)
+80106396:	85 c0                	test   %eax,%eax
+80106398:	74 76                	je     80106410 <pipesize+0x90>
+    return p->size;
+  for(size = PGSIZE; size < n; size *= 2)
+8010639a:	bf 00 10 00 00       	mov    $0x1000,%edi
+8010639f:	3d 00 10 00 00       	cmp    $0x1000,%eax
+801063a4:	0f 86 03 02 00 00    	jbe    801065ad <pipesize+0x22d>
+801063aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+801063b0:	01 ff                	add    %edi,%edi
+801063b2:	39 c7                	cmp    %eax,%edi
+801063b4:	72 fa                	jb     801063b0 <pipesize+0x30>
+    ;
+  if(pipepages(pg, size/PGSIZE) < 0)
+801063b6:	89 f8                	mov    %edi,%eax
+801063b8:	c1 e8 0c             	shr    $0xc,%eax
+801063bb:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+801063be:	89 c2                	mov    %eax,%edx
+  for(i = 0; i < n; i++){
+801063c0:	89 5d 08             	mov    %ebx,0x8(%ebp)
+801063c3:	31 f6                	xor    %esi,%esi
+801063c5:	89 d3                	mov    %edx,%ebx
+801063c7:	eb 0e                	jmp    801063d7 <pipesize+0x57>
+801063c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801063d0:	83 c6 01             	add    $0x1,%esi
+801063d3:	39 de                	cmp    %ebx,%esi
+801063d5:	74 49                	je     80106420 <pipesize+0xa0>
+    if((pg[i] = kalloc()) == 0){
+801063d7:	e8 d4 e7 ff ff       	call   80104bb0 <kalloc>
+801063dc:	89 44 b5 a8          	mov    %eax,-0x58(%ebp,%esi,4)
+801063e0:	85 c0                	test   %eax,%eax
+801063e2:	75 ec                	jne    801063d0 <pipesize+0x50>
+      while(--i >= 0)
+801063e4:	8d 5e ff             	lea    -0x1(%esi),%ebx
+801063e7:	85 f6                	test   %esi,%esi
+801063e9:	74 1c                	je     80106407 <pipesize+0x87>
+801063eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801063ef:	90                   	nop
+        kfree(pg[i]);
+801063f0:	83 ec 0c             	sub    $0xc,%esp
+801063f3:	ff 74 9d a8          	push   -0x58(%ebp,%ebx,4)
+      while(--i >= 0)
+801063f7:	83 eb 01             	sub    $0x1,%ebx
+        kfree(pg[i]);
+801063fa:	e8 31 e5 ff ff       	call   80104930 <kfree>
+      while(--i >= 0)
+801063ff:	83 c4 10             	add    $0x10,%esp
+80106402:	83 fb ff             	cmp    $0xffffffff,%ebx
+80106405:	75 e9                	jne    801063f0 <pipesize+0x70>
+    return -1;
+80106407:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010640c:	eb 08                	jmp    80106416 <pipesize+0x96>
+8010640e:	66 90                	xchg   %ax,%ax
+    return p->size;
+80106410:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  p->nread = 0;
+  p->nwrite = off;
+  wakeup(&p->nwrite);
+  release(&p->lock);
+  return size;
+}
+80106416:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106419:	5b                   	pop    %ebx
+8010641a:	5e                   	pop    %esi
+8010641b:	5f                   	pop    %edi
+8010641c:	5d                   	pop    %ebp
+8010641d:	c3                   	ret
+8010641e:	66 90                	xchg   %ax,%ax
+80106420:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&p->lock);
+80106423:	83 ec 0c             	sub    $0xc,%esp
+80106426:	53                   	push   %ebx
+    sleep(&p->nwrite, &p->lock);
+80106427:	8d b3 88 00 00 00    	lea    0x88(%ebx),%esi
+  acquire(&p->lock);
+8010642d:	e8 2e 1d 00 00       	call   80108160 <acquire>
+  while(p->wsplice || p->rsplice)
+80106432:	83 c4 10             	add    $0x10,%esp
+80106435:	eb 16                	jmp    8010644d <pipesize+0xcd>
+80106437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010643e:	66 90                	xchg   %ax,%ax
+    sleep(&p->nwrite, &p->lock);
+80106440:	83 ec 08             	sub    $0x8,%esp
+80106443:	53                   	push   %ebx
+80106444:	56                   	push   %esi
+80106445:	e8 f6 11 00 00       	call   80107640 <sleep>
+8010644a:	83 c4 10             	add    $0x10,%esp
+  while(p->wsplice || p->rsplice)
+8010644d:	8b 93 94 00 00 00    	mov    0x94(%ebx),%edx
+80106453:	85 d2                	test   %edx,%edx
+80106455:	75 e9                	jne    80106440 <pipesize+0xc0>
+80106457:	8b 83 98 00 00 00    	mov    0x98(%ebx),%eax
+8010645d:	85 c0                	test   %eax,%eax
+8010645f:	75 df                	jne    80106440 <pipesize+0xc0>
+  if(p->nwrite - p->nread > size){
+80106461:	8b 8b 88 00 00 00    	mov    0x88(%ebx),%ecx
+80106467:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+8010646d:	89 ca                	mov    %ecx,%edx
+8010646f:	29 c2                	sub    %eax,%edx
+80106471:	39 d7                	cmp    %edx,%edi
+80106473:	0f 82 45 01 00 00    	jb     801065be <pipesize+0x23e>
+  for(off = 0; p->nread + off != p->nwrite; off += m){
+80106479:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+8010647c:	89 c6                	mov    %eax,%esi
+8010647e:	c7 45 a0 00 00 00 00 	movl   $0x0,-0x60(%ebp)
+80106485:	39 c1                	cmp    %eax,%ecx
+80106487:	0f 84 a3 00 00 00    	je     80106530 <pipesize+0x1b0>
+8010648d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80106490:	89 c8                	mov    %ecx,%eax
+80106492:	89 7d 9c             	mov    %edi,-0x64(%ebp)
+80106495:	31 ff                	xor    %edi,%edi
+80106497:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010649e:	66 90                	xchg   %ax,%ax
+    m = min(p->nwrite - p->nread - off, PGSIZE - (p->nread + off)%PGSIZE);
+801064a0:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+    m = min(m, PGSIZE - off%PGSIZE);
+801064a3:	89 f9                	mov    %edi,%ecx
+801064a5:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+    m = min(p->nwrite - p->nread - off, PGSIZE - (p->nread + off)%PGSIZE);
+801064ab:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+    m = min(m, PGSIZE - off%PGSIZE);
+801064b1:	89 cb                	mov    %ecx,%ebx
+    m = min(p->nwrite - p->nread - off, PGSIZE - (p->nread + off)%PGSIZE);
+801064b3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+801064b8:	89 55 a0             	mov    %edx,-0x60(%ebp)
+801064bb:	29 d1                	sub    %edx,%ecx
+    m = min(m, PGSIZE - off%PGSIZE);
+801064bd:	ba 00 10 00 00       	mov    $0x1000,%edx
+801064c2:	29 da                	sub    %ebx,%edx
+801064c4:	39 d1                	cmp    %edx,%ecx
+801064c6:	0f 46 d1             	cmovbe %ecx,%edx
+    m = min(p->nwrite - p->nread - off, PGSIZE - (p->nread + off)%PGSIZE);
+801064c9:	29 f0                	sub    %esi,%eax
+    m = min(m, PGSIZE - off%PGSIZE);
+801064cb:	39 c2                	cmp    %eax,%edx
+801064cd:	0f 46 c2             	cmovbe %edx,%eax
+    memmove(pg[off/PGSIZE] + off%PGSIZE,
+801064d0:	83 ec 04             	sub    $0x4,%esp
+801064d3:	50                   	push   %eax
+    m = min(m, PGSIZE - off%PGSIZE);
+801064d4:	89 c6                	mov    %eax,%esi
+            p->page[((p->nread + off) & (p->size-1)) / PGSIZE] +
+801064d6:	8b 45 08             	mov    0x8(%ebp),%eax
+801064d9:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+801064dc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+801064df:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+801064e5:	83 e8 01             	sub    $0x1,%eax
+801064e8:	21 d0                	and    %edx,%eax
+801064ea:	8b 55 a0             	mov    -0x60(%ebp),%edx
+801064ed:	c1 e8 0c             	shr    $0xc,%eax
+801064f0:	03 54 81 40          	add    0x40(%ecx,%eax,4),%edx
+    memmove(pg[off/PGSIZE] + off%PGSIZE,
+801064f4:	89 f8                	mov    %edi,%eax
+  for(off = 0; p->nread + off != p->nwrite; off += m){
+801064f6:	01 f7                	add    %esi,%edi
+    memmove(pg[off/PGSIZE] + off%PGSIZE,
+801064f8:	c1 e8 0c             	shr    $0xc,%eax
+801064fb:	52                   	push   %edx
+  for(off = 0; p->nread + off != p->nwrite; off += m){
+801064fc:	89 fe                	mov    %edi,%esi
+    memmove(pg[off/PGSIZE] + off%PGSIZE,
+801064fe:	8b 4c 85 a8          	mov    -0x58(%ebp,%eax,4),%ecx
+80106502:	01 d9                	add    %ebx,%ecx
+80106504:	51                   	push   %ecx
+80106505:	e8 16 20 00 00       	call   80108520 <memmove>
+  for(off = 0; p->nread + off != p->nwrite; off += m){
+8010650a:	8b 45 08             	mov    0x8(%ebp),%eax
+8010650d:	83 c4 10             	add    $0x10,%esp
+80106510:	03 b0 84 00 00 00    	add    0x84(%eax),%esi
+80106516:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+8010651c:	89 75 a4             	mov    %esi,-0x5c(%ebp)
+8010651f:	39 c6                	cmp    %eax,%esi
+80106521:	0f 85 79 ff ff ff    	jne    801064a0 <pipesize+0x120>
+80106527:	89 7d a0             	mov    %edi,-0x60(%ebp)
+8010652a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010652d:	8b 7d 9c             	mov    -0x64(%ebp),%edi
+  for(i = 0; i < p->size/PGSIZE; i++)
+80106530:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+80106536:	c1 e8 0c             	shr    $0xc,%eax
+80106539:	74 24                	je     8010655f <pipesize+0x1df>
+8010653b:	31 f6                	xor    %esi,%esi
+8010653d:	8d 76 00             	lea    0x0(%esi),%esi
+    kfree(p->page[i]);
+80106540:	83 ec 0c             	sub    $0xc,%esp
+80106543:	ff 74 b3 40          	push   0x40(%ebx,%esi,4)
+  for(i = 0; i < p->size/PGSIZE; i++)
+80106547:	83 c6 01             	add    $0x1,%esi
+    kfree(p->page[i]);
+8010654a:	e8 e1 e3 ff ff       	call   80104930 <kfree>
+  for(i = 0; i < p->size/PGSIZE; i++)
+8010654f:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+80106555:	83 c4 10             	add    $0x10,%esp
+80106558:	c1 e8 0c             	shr    $0xc,%eax
+8010655b:	39 c6                	cmp    %eax,%esi
+8010655d:	72 e1                	jb     80106540 <pipesize+0x1c0>
+  memmove(p->page, pg, sizeof(pg));
+8010655f:	83 ec 04             	sub    $0x4,%esp
+80106562:	8d 45 a8             	lea    -0x58(%ebp),%eax
+80106565:	6a 40                	push   $0x40
+80106567:	50                   	push   %eax
+80106568:	8d 43 40             	lea    0x40(%ebx),%eax
+8010656b:	50                   	push   %eax
+8010656c:	e8 af 1f 00 00       	call   80108520 <memmove>
+  p->nwrite = off;
+80106571:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  p->size = size;
+80106574:	89 bb 80 00 00 00    	mov    %edi,0x80(%ebx)
+  p->nread = 0;
+8010657a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+80106581:	00 00 00 
+  p->nwrite = off;
+80106584:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  wakeup(&p->nwrite);
+8010658a:	8d 83 88 00 00 00    	lea    0x88(%ebx),%eax
+80106590:	89 04 24             	mov    %eax,(%esp)
+80106593:	e8 f8 12 00 00       	call   80107890 <wakeup>
+  release(&p->lock);
+80106598:	89 1c 24             	mov    %ebx,(%esp)
+8010659b:	e8 00 1e 00 00       	call   801083a0 <release>
+  return size;
+801065a0:	83 c4 10             	add    $0x10,%esp
+}
+801065a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return size;
+801065a6:	89 f8                	mov    %edi,%eax
+}
+801065a8:	5b                   	pop    %ebx
+801065a9:	5e                   	pop    %esi
+801065aa:	5f                   	pop    %edi
+801065ab:	5d                   	pop    %ebp
+801065ac:	c3                   	ret
+  if(pipepages(pg, size/PGSIZE) < 0)
+801065ad:	c7 45 a4 01 00 00 00 	movl   $0x1,-0x5c(%ebp)
+801065b4:	ba 01 00 00 00       	mov    $0x1,%edx
+801065b9:	e9 02 fe ff ff       	jmp    801063c0 <pipesize+0x40>
+    release(&p->lock);
+801065be:	83 ec 0c             	sub    $0xc,%esp
+801065c1:	53                   	push   %ebx
+801065c2:	8d 5d a8             	lea    -0x58(%ebp),%ebx
+801065c5:	e8 d6 1d 00 00       	call   801083a0 <release>
+    for(i = 0; i < size/PGSIZE; i++)
+801065ca:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+801065cd:	83 c4 10             	add    $0x10,%esp
+801065d0:	8d 34 83             	lea    (%ebx,%eax,4),%esi
+      kfree(pg[i]);
+801065d3:	83 ec 0c             	sub    $0xc,%esp
+801065d6:	ff 33                	push   (%ebx)
+    for(i = 0; i < size/PGSIZE; i++)
+801065d8:	83 c3 04             	add    $0x4,%ebx
+      kfree(pg[i]);
+801065db:	e8 50 e3 ff ff       	call   80104930 <kfree>
+    for(i = 0; i < size/PGSIZE; i++)
+801065e0:	83 c4 10             	add    $0x10,%esp
+801065e3:	39 de                	cmp    %ebx,%esi
+801065e5:	75 ec                	jne    801065d3 <pipesize+0x253>
+801065e7:	e9 1b fe ff ff       	jmp    80106407 <pipesize+0x87>
+801065ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801065f0 <pipewrite>:
+
+//PAGEBREAK: 40
+int
+pipewrite(struct pipe *p, char *addr, int n)
+{
+801065f0:	55                   	push   %ebp
+801065f1:	89 e5                	mov    %esp,%ebp
+801065f3:	57                   	push   %edi
+801065f4:	56                   	push   %esi
+801065f5:	53                   	push   %ebx
+801065f6:	83 ec 28             	sub    $0x28,%esp
+801065f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int i, m;
+  uint off;
+
+  acquire(&p->lock);
+801065fc:	53                   	push   %ebx
+801065fd:	e8 5e 1b 00 00       	call   80108160 <acquire>
+  for(i = 0; i < n; i += m){
+80106602:	8b 45 10             	mov    0x10(%ebp),%eax
+80106605:	83 c4 10             	add    $0x10,%esp
+80106608:	85 c0                	test   %eax,%eax
+8010660a:	0f 8e ee 00 00 00    	jle    801066fe <pipewrite+0x10e>
+80106610:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    while(p->nwrite == p->nread + p->size || p->wsplice){  //DOC: pipewrite-full
+80106617:	8b 8b 88 00 00 00    	mov    0x88(%ebx),%ecx
+      if(p->readopen == 0 || myproc()->killed){
+        release(&p->lock);
+        return -1;
+      }
+      wakeup(&p->nread);
+8010661d:	8d bb 84 00 00 00    	lea    0x84(%ebx),%edi
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+80106623:	8d b3 88 00 00 00    	lea    0x88(%ebx),%esi
+80106629:	eb 2c                	jmp    80106657 <pipewrite+0x67>
+8010662b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010662f:	90                   	nop
+      if(p->readopen == 0 || myproc()->killed){
+80106630:	e8 3b 08 00 00       	call   80106e70 <myproc>
+80106635:	8b 48 24             	mov    0x24(%eax),%ecx
+80106638:	85 c9                	test   %ecx,%ecx
+8010663a:	75 40                	jne    8010667c <pipewrite+0x8c>
+      wakeup(&p->nread);
+8010663c:	83 ec 0c             	sub    $0xc,%esp
+8010663f:	57                   	push   %edi
+80106640:	e8 4b 12 00 00       	call   80107890 <wakeup>
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+80106645:	58                   	pop    %eax
+80106646:	5a                   	pop    %edx
+80106647:	53                   	push   %ebx
+80106648:	56                   	push   %esi
+80106649:	e8 f2 0f 00 00       	call   80107640 <sleep>
+    while(p->nwrite == p->nread + p->size || p->wsplice){  //DOC: pipewrite-full
+8010664e:	8b 8b 88 00 00 00    	mov    0x88(%ebx),%ecx
+80106654:	83 c4 10             	add    $0x10,%esp
+80106657:	8b 93 80 00 00 00    	mov    0x80(%ebx),%edx
+8010665d:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+80106663:	01 d0                	add    %edx,%eax
+80106665:	39 c8                	cmp    %ecx,%eax
+80106667:	74 09                	je     80106672 <pipewrite+0x82>
+80106669:	83 bb 94 00 00 00 00 	cmpl   $0x0,0x94(%ebx)
+80106670:	74 26                	je     80106698 <pipewrite+0xa8>
+      if(p->readopen == 0 || myproc()->killed){
+80106672:	8b 83 8c 00 00 00    	mov    0x8c(%ebx),%eax
+80106678:	85 c0                	test   %eax,%eax
+8010667a:	75 b4                	jne    80106630 <pipewrite+0x40>
+        release(&p->lock);
+8010667c:	83 ec 0c             	sub    $0xc,%esp
+8010667f:	53                   	push   %ebx
+80106680:	e8 1b 1d 00 00       	call   801083a0 <release>
+        return -1;
+80106685:	83 c4 10             	add    $0x10,%esp
+80106688:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    p->nwrite += m;
+  }
+  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+  release(&p->lock);
+  return n;
+}
+8010668d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106690:	5b                   	pop    %ebx
+80106691:	5e                   	pop    %esi
+80106692:	5f                   	pop    %edi
+80106693:	5d                   	pop    %ebp
+80106694:	c3                   	ret
+80106695:	8d 76 00             	lea    0x0(%esi),%esi
+    off = p->nwrite & (p->size-1);
+80106698:	83 ea 01             	sub    $0x1,%edx
+    m = min(n - i, p->nread + p->size - p->nwrite);
+8010669b:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+8010669e:	29 c8                	sub    %ecx,%eax
+    off = p->nwrite & (p->size-1);
+801066a0:	21 ca                	and    %ecx,%edx
+    m = min(n - i, p->nread + p->size - p->nwrite);
+801066a2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    m = min(m, PGSIZE - off%PGSIZE);
+801066a5:	89 55 e0             	mov    %edx,-0x20(%ebp)
+801066a8:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+    m = min(n - i, p->nread + p->size - p->nwrite);
+801066ae:	29 f1                	sub    %esi,%ecx
+    m = min(m, PGSIZE - off%PGSIZE);
+801066b0:	39 c8                	cmp    %ecx,%eax
+801066b2:	89 ce                	mov    %ecx,%esi
+801066b4:	0f 46 f0             	cmovbe %eax,%esi
+801066b7:	b8 00 10 00 00       	mov    $0x1000,%eax
+801066bc:	29 d0                	sub    %edx,%eax
+801066be:	39 c6                	cmp    %eax,%esi
+801066c0:	0f 47 f0             	cmova  %eax,%esi
+    memmove(p->page[off/PGSIZE] + off%PGSIZE, addr + i, m);
+801066c3:	83 ec 04             	sub    $0x4,%esp
+801066c6:	56                   	push   %esi
+801066c7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801066ca:	03 45 0c             	add    0xc(%ebp),%eax
+801066cd:	50                   	push   %eax
+801066ce:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+801066d1:	c1 e9 0c             	shr    $0xc,%ecx
+801066d4:	03 54 8b 40          	add    0x40(%ebx,%ecx,4),%edx
+801066d8:	52                   	push   %edx
+801066d9:	e8 42 1e 00 00       	call   80108520 <memmove>
+    p->nwrite += m;
+801066de:	8b 8b 88 00 00 00    	mov    0x88(%ebx),%ecx
+  for(i = 0; i < n; i += m){
+801066e4:	01 75 e4             	add    %esi,-0x1c(%ebp)
+801066e7:	83 c4 10             	add    $0x10,%esp
+801066ea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    p->nwrite += m;
+801066ed:	01 f1                	add    %esi,%ecx
+801066ef:	89 8b 88 00 00 00    	mov    %ecx,0x88(%ebx)
+  for(i = 0; i < n; i += m){
+801066f5:	39 45 10             	cmp    %eax,0x10(%ebp)
+801066f8:	0f 8f 25 ff ff ff    	jg     80106623 <pipewrite+0x33>
+  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+801066fe:	83 ec 0c             	sub    $0xc,%esp
+80106701:	8d 83 84 00 00 00    	lea    0x84(%ebx),%eax
+80106707:	50                   	push   %eax
+80106708:	e8 83 11 00 00       	call   80107890 <wakeup>
+  release(&p->lock);
+8010670d:	89 1c 24             	mov    %ebx,(%esp)
+80106710:	e8 8b 1c 00 00       	call   801083a0 <release>
+  return n;
+80106715:	8b 45 10             	mov    0x10(%ebp),%eax
+80106718:	83 c4 10             	add    $0x10,%esp
+8010671b:	e9 6d ff ff ff       	jmp    8010668d <pipewrite+0x9d>
+
+80106720 <piperead>:
+
+int
+piperead(struct pipe *p, char *addr, int n)
+{
+80106720:	55                   	push   %ebp
+80106721:	89 e5                	mov    %esp,%ebp
+80106723:	57                   	push   %edi
+80106724:	56                   	push   %esi
+80106725:	53                   	push   %ebx
+80106726:	83 ec 18             	sub    $0x18,%esp
+80106729:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int i, m;
+  uint off;
+
+  acquire(&p->lock);
+8010672c:	53                   	push   %ebx
+  while((p->nread == p->nwrite && p->writeopen) || p->rsplice){  //DOC: pipe-empty
+    if(myproc()->killed){
+      release(&p->lock);
+      return -1;
+    }
+    sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+8010672d:	8d b3 84 00 00 00    	lea    0x84(%ebx),%esi
+  acquire(&p->lock);
+80106733:	e8 28 1a 00 00       	call   80108160 <acquire>
+  while((p->nread == p->nwrite && p->writeopen) || p->rsplice){  //DOC: pipe-empty
+80106738:	83 c4 10             	add    $0x10,%esp
+8010673b:	eb 26                	jmp    80106763 <piperead+0x43>
+8010673d:	8d 76 00             	lea    0x0(%esi),%esi
+80106740:	8b bb 98 00 00 00    	mov    0x98(%ebx),%edi
+80106746:	85 ff                	test   %edi,%edi
+80106748:	74 5e                	je     801067a8 <piperead+0x88>
+    if(myproc()->killed){
+8010674a:	e8 21 07 00 00       	call   80106e70 <myproc>
+8010674f:	8b 40 24             	mov    0x24(%eax),%eax
+80106752:	85 c0                	test   %eax,%eax
+80106754:	75 33                	jne    80106789 <piperead+0x69>
+    sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+80106756:	83 ec 08             	sub    $0x8,%esp
+80106759:	53                   	push   %ebx
+8010675a:	56                   	push   %esi
+8010675b:	e8 e0 0e 00 00       	call   80107640 <sleep>
+80106760:	83 c4 10             	add    $0x10,%esp
+  while((p->nread == p->nwrite && p->writeopen) || p->rsplice){  //DOC: pipe-empty
+80106763:	8b 93 84 00 00 00    	mov    0x84(%ebx),%edx
+80106769:	8b 83 88 00 00 00    	mov    0x88(%ebx),%eax
+8010676f:	39 c2                	cmp    %eax,%edx
+80106771:	75 cd                	jne    80106740 <piperead+0x20>
+80106773:	8b bb 90 00 00 00    	mov    0x90(%ebx),%edi
+80106779:	85 ff                	test   %edi,%edi
+8010677b:	74 c3                	je     80106740 <piperead+0x20>
+    if(myproc()->killed){
+8010677d:	e8 ee 06 00 00       	call   80106e70 <myproc>
+80106782:	8b 40 24             	mov    0x24(%eax),%eax
+80106785:	85 c0                	test   %eax,%eax
+80106787:	74 cd                	je     80106756 <piperead+0x36>
+      release(&p->lock);
+80106789:	83 ec 0c             	sub    $0xc,%esp
+      return -1;
+8010678c:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+      release(&p->lock);
+80106791:	53                   	push   %ebx
+80106792:	e8 09 1c 00 00       	call   801083a0 <release>
+      return -1;
+80106797:	83 c4 10             	add    $0x10,%esp
+    p->nread += m;
+  }
+  wakeup(&p->nwrite);  //DOC: piperead-wakeup
+  release(&p->lock);
+  return i;
+}
+8010679a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010679d:	89 f8                	mov    %edi,%eax
+8010679f:	5b                   	pop    %ebx
+801067a0:	5e                   	pop    %esi
+801067a1:	5f                   	pop    %edi
+801067a2:	5d                   	pop    %ebp
+801067a3:	c3                   	ret
+801067a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < n && p->nread != p->nwrite; i += m){  //DOC: piperead-copy
+801067a8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+801067ab:	89 c6                	mov    %eax,%esi
+801067ad:	85 c9                	test   %ecx,%ecx
+801067af:	7f 66                	jg     80106817 <piperead+0xf7>
+801067b1:	eb 68                	jmp    8010681b <piperead+0xfb>
+801067b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801067b7:	90                   	nop
+    off = p->nread & (p->size-1);
+801067b8:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+    m = min(n - i, p->nwrite - p->nread);
+801067be:	29 d6                	sub    %edx,%esi
+    off = p->nread & (p->size-1);
+801067c0:	8d 48 ff             	lea    -0x1(%eax),%ecx
+801067c3:	21 d1                	and    %edx,%ecx
+    m = min(n - i, p->nwrite - p->nread);
+801067c5:	8b 55 10             	mov    0x10(%ebp),%edx
+    m = min(m, PGSIZE - off%PGSIZE);
+801067c8:	89 c8                	mov    %ecx,%eax
+    m = min(n - i, p->nwrite - p->nread);
+801067ca:	29 fa                	sub    %edi,%edx
+    m = min(m, PGSIZE - off%PGSIZE);
+801067cc:	25 ff 0f 00 00       	and    $0xfff,%eax
+801067d1:	39 d6                	cmp    %edx,%esi
+801067d3:	0f 47 f2             	cmova  %edx,%esi
+801067d6:	ba 00 10 00 00       	mov    $0x1000,%edx
+801067db:	29 c2                	sub    %eax,%edx
+801067dd:	39 d6                	cmp    %edx,%esi
+801067df:	0f 47 f2             	cmova  %edx,%esi
+    memmove(addr + i, p->page[off/PGSIZE] + off%PGSIZE, m);
+801067e2:	83 ec 04             	sub    $0x4,%esp
+801067e5:	c1 e9 0c             	shr    $0xc,%ecx
+801067e8:	56                   	push   %esi
+801067e9:	03 44 8b 40          	add    0x40(%ebx,%ecx,4),%eax
+801067ed:	50                   	push   %eax
+801067ee:	8b 45 0c             	mov    0xc(%ebp),%eax
+801067f1:	01 f8                	add    %edi,%eax
+  for(i = 0; i < n && p->nread != p->nwrite; i += m){  //DOC: piperead-copy
+801067f3:	01 f7                	add    %esi,%edi
+    memmove(addr + i, p->page[off/PGSIZE] + off%PGSIZE, m);
+801067f5:	50                   	push   %eax
+801067f6:	e8 25 1d 00 00       	call   80108520 <memmove>
+    p->nread += m;
+801067fb:	8b 93 84 00 00 00    	mov    0x84(%ebx),%edx
+  for(i = 0; i < n && p->nread != p->nwrite; i += m){  //DOC: piperead-copy
+80106801:	83 c4 10             	add    $0x10,%esp
+    p->nread += m;
+80106804:	01 f2                	add    %esi,%edx
+80106806:	89 93 84 00 00 00    	mov    %edx,0x84(%ebx)
+  for(i = 0; i < n && p->nread != p->nwrite; i += m){  //DOC: piperead-copy
+8010680c:	39 7d 10             	cmp    %edi,0x10(%ebp)
+8010680f:	7e 0a                	jle    8010681b <piperead+0xfb>
+80106811:	8b b3 88 00 00 00    	mov    0x88(%ebx),%esi
+80106817:	39 f2                	cmp    %esi,%edx
+80106819:	75 9d                	jne    801067b8 <piperead+0x98>
+  wakeup(&p->nwrite);  //DOC: piperead-wakeup
+8010681b:	83 ec 0c             	sub    $0xc,%esp
+8010681e:	8d 83 88 00 00 00    	lea    0x88(%ebx),%eax
+80106824:	50                   	push   %eax
+80106825:	e8 66 10 00 00       	call   80107890 <wakeup>
+  release(&p->lock);
+8010682a:	89 1c 24             	mov    %ebx,(%esp)
+8010682d:	e8 6e 1b 00 00       	call   801083a0 <release>
+  return i;
+80106832:	83 c4 10             	add    $0x10,%esp
+}
+80106835:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106838:	89 f8                	mov    %edi,%eax
+8010683a:	5b                   	pop    %ebx
+8010683b:	5e                   	pop    %esi
+8010683c:	5f                   	pop    %edi
+8010683d:	5d                   	pop    %ebp
+8010683e:	c3                   	ret
+8010683f:	90                   	nop
+
+80106840 <pipewbegin>:
+// Wait for room in p, then claim up to *n bytes of it and
+// return where they start, setting *n to how many were claimed.
+// Returns 0 if the reader has gone away.
+char*
+pipewbegin(struct pipe *p, int *n)
+{
+80106840:	55                   	push   %ebp
+80106841:	89 e5                	mov    %esp,%ebp
+80106843:	57                   	push   %edi
+80106844:	56                   	push   %esi
+80106845:	53                   	push   %ebx
+80106846:	83 ec 18             	sub    $0x18,%esp
+80106849:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint off;
+
+  acquire(&p->lock);
+8010684c:	53                   	push   %ebx
+  while(p->nwrite == p->nread + p->size || p->wsplice){
+    if(p->readopen == 0 || myproc()->killed){
+      release(&p->lock);
+      return 0;
+    }
+    wakeup(&p->nread);
+8010684d:	8d bb 84 00 00 00    	lea    0x84(%ebx),%edi
+    sleep(&p->nwrite, &p->lock);
+80106853:	8d b3 88 00 00 00    	lea    0x88(%ebx),%esi
+  acquire(&p->lock);
+80106859:	e8 02 19 00 00       	call   80108160 <acquire>
+  while(p->nwrite == p->nread + p->size || p->wsplice){
+8010685e:	83 c4 10             	add    $0x10,%esp
+80106861:	eb 26                	jmp    80106889 <pipewbegin+0x49>
+80106863:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106867:	90                   	nop
+    if(p->readopen == 0 || myproc()->killed){
+80106868:	e8 03 06 00 00       	call   80106e70 <myproc>
+8010686d:	8b 48 24             	mov    0x24(%eax),%ecx
+80106870:	85 c9                	test   %ecx,%ecx
+80106872:	75 40                	jne    801068b4 <pipewbegin+0x74>
+    wakeup(&p->nread);
+80106874:	83 ec 0c             	sub    $0xc,%esp
+80106877:	57                   	push   %edi
+80106878:	e8 13 10 00 00       	call   80107890 <wakeup>
+    sleep(&p->nwrite, &p->lock);
+8010687d:	58                   	pop    %eax
+8010687e:	5a                   	pop    %edx
+8010687f:	53                   	push   %ebx
+80106880:	56                   	push   %esi
+80106881:	e8 ba 0d 00 00       	call   80107640 <sleep>
+80106886:	83 c4 10             	add    $0x10,%esp
+  while(p->nwrite == p->nread + p->size || p->wsplice){
+80106889:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+8010688f:	8b 93 84 00 00 00    	mov    0x84(%ebx),%edx
+80106895:	8b 8b 88 00 00 00    	mov    0x88(%ebx),%ecx
+8010689b:	01 c2                	add    %eax,%edx
+8010689d:	39 d1                	cmp    %edx,%ecx
+8010689f:	74 09                	je     801068aa <pipewbegin+0x6a>
+801068a1:	83 bb 94 00 00 00 00 	cmpl   $0x0,0x94(%ebx)
+801068a8:	74 26                	je     801068d0 <pipewbegin+0x90>
+    if(p->readopen == 0 || myproc()->killed){
+801068aa:	8b 83 8c 00 00 00    	mov    0x8c(%ebx),%eax
+801068b0:	85 c0                	test   %eax,%eax
+801068b2:	75 b4                	jne    80106868 <pipewbegin+0x28>
+      release(&p->lock);
+801068b4:	83 ec 0c             	sub    $0xc,%esp
+801068b7:	53                   	push   %ebx
+801068b8:	e8 e3 1a 00 00       	call   801083a0 <release>
+      return 0;
+801068bd:	83 c4 10             	add    $0x10,%esp
+  *n = min(*n, p->nread + p->size - p->nwrite);
+  *n = min(*n, PGSIZE - off%PGSIZE);
+  p->wsplice = 1;
+  release(&p->lock);
+  return p->page[off/PGSIZE] + off%PGSIZE;
+}
+801068c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+801068c3:	31 c0                	xor    %eax,%eax
+}
+801068c5:	5b                   	pop    %ebx
+801068c6:	5e                   	pop    %esi
+801068c7:	5f                   	pop    %edi
+801068c8:	5d                   	pop    %ebp
+801068c9:	c3                   	ret
+801068ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  off = p->nwrite & (p->size-1);
+801068d0:	8d 70 ff             	lea    -0x1(%eax),%esi
+  *n = min(*n, p->nread + p->size - p->nwrite);
+801068d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+801068d6:	29 ca                	sub    %ecx,%edx
+  off = p->nwrite & (p->size-1);
+801068d8:	21 ce                	and    %ecx,%esi
+  *n = min(*n, p->nread + p->size - p->nwrite);
+801068da:	8b 00                	mov    (%eax),%eax
+  *n = min(*n, PGSIZE - off%PGSIZE);
+801068dc:	89 f7                	mov    %esi,%edi
+801068de:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  *n = min(*n, p->nread + p->size - p->nwrite);
+801068e4:	39 c2                	cmp    %eax,%edx
+801068e6:	0f 47 d0             	cmova  %eax,%edx
+  *n = min(*n, PGSIZE - off%PGSIZE);
+801068e9:	b8 00 10 00 00       	mov    $0x1000,%eax
+801068ee:	29 f8                	sub    %edi,%eax
+801068f0:	39 c2                	cmp    %eax,%edx
+801068f2:	0f 47 d0             	cmova  %eax,%edx
+801068f5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  release(&p->lock);
+801068f8:	83 ec 0c             	sub    $0xc,%esp
+  return p->page[off/PGSIZE] + off%PGSIZE;
+801068fb:	c1 ee 0c             	shr    $0xc,%esi
+  *n = min(*n, PGSIZE - off%PGSIZE);
+801068fe:	89 10                	mov    %edx,(%eax)
+  p->wsplice = 1;
+80106900:	c7 83 94 00 00 00 01 	movl   $0x1,0x94(%ebx)
+80106907:	00 00 00 
+  release(&p->lock);
+8010690a:	53                   	push   %ebx
+8010690b:	e8 90 1a 00 00       	call   801083a0 <release>
+  return p->page[off/PGSIZE] + off%PGSIZE;
+80106910:	8b 44 b3 40          	mov    0x40(%ebx,%esi,4),%eax
+80106914:	83 c4 10             	add    $0x10,%esp
+}
+80106917:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010691a:	5b                   	pop    %ebx
+8010691b:	5e                   	pop    %esi
+  return p->page[off/PGSIZE] + off%PGSIZE;
+8010691c:	01 f8                	add    %edi,%eax
+}
+8010691e:	5f                   	pop    %edi
+8010691f:	5d                   	pop    %ebp
+80106920:	c3                   	ret
+80106921:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106928:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010692f:	90                   	nop
+
+80106930 <pipewend>:
+
+// Finish a pipewbegin(), having written n bytes.
+void
+pipewend(struct pipe *p, int n)
+{
+80106930:	55                   	push   %ebp
+80106931:	89 e5                	mov    %esp,%ebp
+80106933:	56                   	push   %esi
+80106934:	53                   	push   %ebx
+80106935:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80106938:	8b 75 0c             	mov    0xc(%ebp),%esi
+  acquire(&p->lock);
+8010693b:	83 ec 0c             	sub    $0xc,%esp
+8010693e:	53                   	push   %ebx
+8010693f:	e8 1c 18 00 00       	call   80108160 <acquire>
+  p->nwrite += n;
+80106944:	01 b3 88 00 00 00    	add    %esi,0x88(%ebx)
+  p->wsplice = 0;
+  wakeup(&p->nread);
+8010694a:	8d 83 84 00 00 00    	lea    0x84(%ebx),%eax
+  p->wsplice = 0;
+80106950:	c7 83 94 00 00 00 00 	movl   $0x0,0x94(%ebx)
+80106957:	00 00 00 
+  wakeup(&p->nread);
+8010695a:	89 04 24             	mov    %eax,(%esp)
+8010695d:	e8 2e 0f 00 00       	call   80107890 <wakeup>
+  wakeup(&p->nwrite);
+80106962:	8d 83 88 00 00 00    	lea    0x88(%ebx),%eax
+80106968:	89 04 24             	mov    %eax,(%esp)
+8010696b:	e8 20 0f 00 00       	call   80107890 <wakeup>
+  release(&p->lock);
+80106970:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80106973:	83 c4 10             	add    $0x10,%esp
+}
+80106976:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106979:	5b                   	pop    %ebx
+8010697a:	5e                   	pop    %esi
+8010697b:	5d                   	pop    %ebp
+  release(&p->lock);
+8010697c:	e9 1f 1a 00 00       	jmp    801083a0 <release>
+80106981:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106988:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010698f:	90                   	nop
+
+80106990 <piperbegin>:
+// Wait for data in p, then claim up to *n bytes of it and
+// return where they start, setting *n to how many were claimed,
+// or to 0 at end of file.  Returns 0 if killed.
+char*
+piperbegin(struct pipe *p, int *n)
+{
+80106990:	55                   	push   %ebp
+80106991:	89 e5                	mov    %esp,%ebp
+80106993:	57                   	push   %edi
+80106994:	56                   	push   %esi
+80106995:	53                   	push   %ebx
+80106996:	83 ec 18             	sub    $0x18,%esp
+80106999:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint off;
+
+  acquire(&p->lock);
+8010699c:	53                   	push   %ebx
+  while((p->nread == p->nwrite && p->writeopen) || p->rsplice){
+    if(myproc()->killed){
+      release(&p->lock);
+      return 0;
+    }
+    sleep(&p->nread, &p->lock);
+8010699d:	8d b3 84 00 00 00    	lea    0x84(%ebx),%esi
+  acquire(&p->lock);
+801069a3:	e8 b8 17 00 00       	call   80108160 <acquire>
+  while((p->nread == p->nwrite && p->writeopen) || p->rsplice){
+801069a8:	83 c4 10             	add    $0x10,%esp
+801069ab:	eb 26                	jmp    801069d3 <piperbegin+0x43>
+801069ad:	8d 76 00             	lea    0x0(%esi),%esi
+801069b0:	8b 83 98 00 00 00    	mov    0x98(%ebx),%eax
+801069b6:	85 c0                	test   %eax,%eax
+801069b8:	74 56                	je     80106a10 <piperbegin+0x80>
+    if(myproc()->killed){
+801069ba:	e8 b1 04 00 00       	call   80106e70 <myproc>
+801069bf:	8b 40 24             	mov    0x24(%eax),%eax
+801069c2:	85 c0                	test   %eax,%eax
+801069c4:	75 33                	jne    801069f9 <piperbegin+0x69>
+    sleep(&p->nread, &p->lock);
+801069c6:	83 ec 08             	sub    $0x8,%esp
+801069c9:	53                   	push   %ebx
+801069ca:	56                   	push   %esi
+801069cb:	e8 70 0c 00 00       	call   80107640 <sleep>
+801069d0:	83 c4 10             	add    $0x10,%esp
+  while((p->nread == p->nwrite && p->writeopen) || p->rsplice){
+801069d3:	8b 8b 84 00 00 00    	mov    0x84(%ebx),%ecx
+801069d9:	8b 93 88 00 00 00    	mov    0x88(%ebx),%edx
+801069df:	39 d1                	cmp    %edx,%ecx
+801069e1:	75 cd                	jne    801069b0 <piperbegin+0x20>
+801069e3:	8b bb 90 00 00 00    	mov    0x90(%ebx),%edi
+801069e9:	85 ff                	test   %edi,%edi
+801069eb:	74 c3                	je     801069b0 <piperbegin+0x20>
+    if(myproc()->killed){
+801069ed:	e8 7e 04 00 00       	call   80106e70 <myproc>
+801069f2:	8b 40 24             	mov    0x24(%eax),%eax
+801069f5:	85 c0                	test   %eax,%eax
+801069f7:	74 cd                	je     801069c6 <piperbegin+0x36>
+      release(&p->lock);
+801069f9:	83 ec 0c             	sub    $0xc,%esp
+801069fc:	53                   	push   %ebx
+801069fd:	e8 9e 19 00 00       	call   801083a0 <release>
+      return 0;
+80106a02:	83 c4 10             	add    $0x10,%esp
+  *n = min(*n, p->nwrite - p->nread);
+  *n = min(*n, PGSIZE - off%PGSIZE);
+  p->rsplice = 1;
+  release(&p->lock);
+  return p->page[off/PGSIZE] + off%PGSIZE;
+}
+80106a05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+80106a08:	31 c0                	xor    %eax,%eax
+}
+80106a0a:	5b                   	pop    %ebx
+80106a0b:	5e                   	pop    %esi
+80106a0c:	5f                   	pop    %edi
+80106a0d:	5d                   	pop    %ebp
+80106a0e:	c3                   	ret
+80106a0f:	90                   	nop
+  off = p->nread & (p->size-1);
+80106a10:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  *n = min(*n, p->nwrite - p->nread);
+80106a16:	29 ca                	sub    %ecx,%edx
+  off = p->nread & (p->size-1);
+80106a18:	8d 70 ff             	lea    -0x1(%eax),%esi
+  *n = min(*n, p->nwrite - p->nread);
+80106a1b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  off = p->nread & (p->size-1);
+80106a1e:	21 ce                	and    %ecx,%esi
+  *n = min(*n, p->nwrite - p->nread);
+80106a20:	8b 08                	mov    (%eax),%ecx
+  *n = min(*n, PGSIZE - off%PGSIZE);
+80106a22:	89 f7                	mov    %esi,%edi
+80106a24:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  *n = min(*n, p->nwrite - p->nread);
+80106a2a:	39 ca                	cmp    %ecx,%edx
+80106a2c:	0f 47 d1             	cmova  %ecx,%edx
+  *n = min(*n, PGSIZE - off%PGSIZE);
+80106a2f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+80106a34:	29 f9                	sub    %edi,%ecx
+80106a36:	39 ca                	cmp    %ecx,%edx
+80106a38:	0f 47 d1             	cmova  %ecx,%edx
+  release(&p->lock);
+80106a3b:	83 ec 0c             	sub    $0xc,%esp
+  return p->page[off/PGSIZE] + off%PGSIZE;
+80106a3e:	c1 ee 0c             	shr    $0xc,%esi
+  *n = min(*n, PGSIZE - off%PGSIZE);
+80106a41:	89 10                	mov    %edx,(%eax)
+  p->rsplice = 1;
+80106a43:	c7 83 98 00 00 00 01 	movl   $0x1,0x98(%ebx)
+80106a4a:	00 00 00 
+  release(&p->lock);
+80106a4d:	53                   	push   %ebx
+80106a4e:	e8 4d 19 00 00       	call   801083a0 <release>
+  return p->page[off/PGSIZE] + off%PGSIZE;
+80106a53:	8b 44 b3 40          	mov    0x40(%ebx,%esi,4),%eax
+80106a57:	83 c4 10             	add    $0x10,%esp
+}
+80106a5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106a5d:	5b                   	pop    %ebx
+80106a5e:	5e                   	pop    %esi
+  return p->page[off/PGSIZE] + off%PGSIZE;
+80106a5f:	01 f8                	add    %edi,%eax
+}
+80106a61:	5f                   	pop    %edi
+80106a62:	5d                   	pop    %ebp
+80106a63:	c3                   	ret
+80106a64:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106a6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106a6f:	90                   	nop
+
+80106a70 <piperend>:
+
+// Finish a piperbegin(), having read n bytes.
+void
+piperend(struct pipe *p, int n)
+{
+80106a70:	55                   	push   %ebp
+80106a71:	89 e5                	mov    %esp,%ebp
+80106a73:	56                   	push   %esi
+80106a74:	53                   	push   %ebx
+80106a75:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80106a78:	8b 75 0c             	mov    0xc(%ebp),%esi
+  acquire(&p->lock);
+80106a7b:	83 ec 0c             	sub    $0xc,%esp
+80106a7e:	53                   	push   %ebx
+80106a7f:	e8 dc 16 00 00       	call   80108160 <acquire>
+  p->nread += n;
+80106a84:	01 b3 84 00 00 00    	add    %esi,0x84(%ebx)
+  p->rsplice = 0;
+  wakeup(&p->nwrite);
+80106a8a:	8d 83 88 00 00 00    	lea    0x88(%ebx),%eax
+  p->rsplice = 0;
+80106a90:	c7 83 98 00 00 00 00 	movl   $0x0,0x98(%ebx)
+80106a97:	00 00 00 
+  wakeup(&p->nwrite);
+80106a9a:	89 04 24             	mov    %eax,(%esp)
+80106a9d:	e8 ee 0d 00 00       	call   80107890 <wakeup>
+  wakeup(&p->nread);
+80106aa2:	8d 83 84 00 00 00    	lea    0x84(%ebx),%eax
+80106aa8:	89 04 24             	mov    %eax,(%esp)
+80106aab:	e8 e0 0d 00 00       	call   80107890 <wakeup>
+  release(&p->lock);
+80106ab0:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80106ab3:	83 c4 10             	add    $0x10,%esp
+}
+80106ab6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106ab9:	5b                   	pop    %ebx
+80106aba:	5e                   	pop    %esi
+80106abb:	5d                   	pop    %ebp
+  release(&p->lock);
+80106abc:	e9 df 18 00 00       	jmp    801083a0 <release>
+80106ac1:	66 90                	xchg   %ax,%ax
+80106ac3:	66 90                	xchg   %ax,%ax
+80106ac5:	66 90                	xchg   %ax,%ax
+80106ac7:	66 90                	xchg   %ax,%ax
+80106ac9:	66 90                	xchg   %ax,%ax
+80106acb:	66 90                	xchg   %ax,%ax
+80106acd:	66 90                	xchg   %ax,%ax
+80106acf:	90                   	nop
+
+80106ad0 <enqueue>:
+
+// Make p RUNNABLE on the run queue of the CPU it last ran on.
+// p must not be on a run queue.
+static void
+enqueue(struct proc *p)
+{
+80106ad0:	55                   	push   %ebp
+80106ad1:	89 e5                	mov    %esp,%ebp
+80106ad3:	57                   	push   %edi
+80106ad4:	56                   	push   %esi
+80106ad5:	53                   	push   %ebx
+80106ad6:	89 c3                	mov    %eax,%ebx
+80106ad8:	83 ec 28             	sub    $0x28,%esp
+  struct runq *rq = &runq[p->cpu];
+80106adb:	8b 50 7c             	mov    0x7c(%eax),%edx
+80106ade:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+80106ae5:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80106ae8:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+80106aeb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80106aee:	89 fe                	mov    %edi,%esi
+80106af0:	c1 e6 04             	shl    $0x4,%esi
+80106af3:	81 c6 a0 87 22 80    	add    $0x802287a0,%esi
+
+  acquire(&rq->lock);
+80106af9:	56                   	push   %esi
+80106afa:	e8 61 16 00 00       	call   80108160 <acquire>
+  if(rq->tail[p->level])
+80106aff:	8b 83 90 00 00 00    	mov    0x90(%ebx),%eax
+80106b05:	83 c4 10             	add    $0x10,%esp
+80106b08:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  p->state = RUNNABLE;
+80106b0b:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+  p->rqnext = 0;
+80106b12:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+80106b19:	00 00 00 
+  if(rq->tail[p->level])
+80106b1c:	8d 3c b8             	lea    (%eax,%edi,4),%edi
+80106b1f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80106b22:	83 c7 10             	add    $0x10,%edi
+80106b25:	8b 0c bd a4 87 22 80 	mov    -0x7fdd785c(,%edi,4),%ecx
+80106b2c:	85 c9                	test   %ecx,%ecx
+80106b2e:	0f 84 8c 00 00 00    	je     80106bc0 <enqueue+0xf0>
+    rq->tail[p->level]->rqnext = p;
+80106b34:	89 99 80 00 00 00    	mov    %ebx,0x80(%ecx)
+  rq->tail[p->level] = p;
+80106b3a:	01 d0                	add    %edx,%eax
+80106b3c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  rq->n++;
+80106b43:	c1 e0 04             	shl    $0x4,%eax
+  rq->tail[p->level] = p;
+80106b46:	03 93 90 00 00 00    	add    0x90(%ebx),%edx
+  rq->n++;
+80106b4c:	83 80 e8 87 22 80 01 	addl   $0x1,-0x7fdd7818(%eax)
+  rq->tail[p->level] = p;
+80106b53:	89 1c 95 e4 87 22 80 	mov    %ebx,-0x7fdd781c(,%edx,4)
+  runqput(rq, p);
+  kick(p->cpu);
+80106b5a:	8b 4b 7c             	mov    0x7c(%ebx),%ecx
+  __sync_synchronize();  // order the enqueue before reading idle
+80106b5d:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  for(i = 0; i < ncpu; i++){
+80106b62:	8b 1d 64 71 22 80    	mov    0x80227164,%ebx
+80106b68:	85 db                	test   %ebx,%ebx
+80106b6a:	7e 3d                	jle    80106ba9 <enqueue+0xd9>
+80106b6c:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+80106b6f:	eb 0e                	jmp    80106b7f <enqueue+0xaf>
+80106b71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106b78:	83 c1 01             	add    $0x1,%ecx
+80106b7b:	39 cf                	cmp    %ecx,%edi
+80106b7d:	74 2a                	je     80106ba9 <enqueue+0xd9>
+    if(cpus[(cpu + i) % ncpu].idle){
+80106b7f:	89 c8                	mov    %ecx,%eax
+80106b81:	99                   	cltd
+80106b82:	f7 fb                	idiv   %ebx
+80106b84:	69 d2 bc 00 00 00    	imul   $0xbc,%edx,%edx
+80106b8a:	8b 82 30 72 22 80    	mov    -0x7fdd8dd0(%edx),%eax
+80106b90:	85 c0                	test   %eax,%eax
+80106b92:	74 e4                	je     80106b78 <enqueue+0xa8>
+      lapicipi(cpus[(cpu + i) % ncpu].apicid, T_IRQ0 + IRQ_WAKEUP);
+80106b94:	83 ec 08             	sub    $0x8,%esp
+80106b97:	6a 3e                	push   $0x3e
+80106b99:	0f b6 82 80 71 22 80 	movzbl -0x7fdd8e80(%edx),%eax
+80106ba0:	50                   	push   %eax
+80106ba1:	e8 fa e4 ff ff       	call   801050a0 <lapicipi>
+      return;
+80106ba6:	83 c4 10             	add    $0x10,%esp
+  release(&rq->lock);
+80106ba9:	83 ec 0c             	sub    $0xc,%esp
+80106bac:	56                   	push   %esi
+80106bad:	e8 ee 17 00 00       	call   801083a0 <release>
+}
+80106bb2:	83 c4 10             	add    $0x10,%esp
+80106bb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106bb8:	5b                   	pop    %ebx
+80106bb9:	5e                   	pop    %esi
+80106bba:	5f                   	pop    %edi
+80106bbb:	5d                   	pop    %ebp
+80106bbc:	c3                   	ret
+80106bbd:	8d 76 00             	lea    0x0(%esi),%esi
+    rq->head[p->level] = p;
+80106bc0:	89 1c bd a0 87 22 80 	mov    %ebx,-0x7fdd7860(,%edi,4)
+80106bc7:	e9 6e ff ff ff       	jmp    80106b3a <enqueue+0x6a>
+80106bcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80106bd0 <pinit>:
+{
+80106bd0:	55                   	push   %ebp
+80106bd1:	89 e5                	mov    %esp,%ebp
+80106bd3:	53                   	push   %ebx
+80106bd4:	bb a0 87 22 80       	mov    $0x802287a0,%ebx
+80106bd9:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&ptable.lock, "ptable");
+80106bdc:	68 bc bc 10 80       	push   $0x8010bcbc
+80106be1:	68 20 8a 22 80       	push   $0x80228a20
+80106be6:	e8 25 13 00 00       	call   80107f10 <initlock>
+  for(i = 0; i < NCPU; i++)
+80106beb:	83 c4 10             	add    $0x10,%esp
+80106bee:	66 90                	xchg   %ax,%ax
+    initlock(&runq[i].lock, "runq");
+80106bf0:	83 ec 08             	sub    $0x8,%esp
+80106bf3:	68 c3 bc 10 80       	push   $0x8010bcc3
+80106bf8:	53                   	push   %ebx
+  for(i = 0; i < NCPU; i++)
+80106bf9:	83 c3 50             	add    $0x50,%ebx
+    initlock(&runq[i].lock, "runq");
+80106bfc:	e8 0f 13 00 00       	call   80107f10 <initlock>
+  for(i = 0; i < NCPU; i++)
+80106c01:	83 c4 10             	add    $0x10,%esp
+80106c04:	81 fb 20 8a 22 80    	cmp    $0x80228a20,%ebx
+80106c0a:	75 e4                	jne    80106bf0 <pinit+0x20>
+80106c0c:	bb 60 77 22 80       	mov    $0x80227760,%ebx
+80106c11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    initlock(&waitq[i].lock, "waitq");
+80106c18:	83 ec 08             	sub    $0x8,%esp
+80106c1b:	68 c8 bc 10 80       	push   $0x8010bcc8
+80106c20:	53                   	push   %ebx
+  for(i = 0; i < NWAITQ; i++)
+80106c21:	83 c3 44             	add    $0x44,%ebx
+    initlock(&waitq[i].lock, "waitq");
+80106c24:	e8 e7 12 00 00       	call   80107f10 <initlock>
+  for(i = 0; i < NWAITQ; i++)
+80106c29:	83 c4 10             	add    $0x10,%esp
+80106c2c:	81 fb 94 87 22 80    	cmp    $0x80228794,%ebx
+80106c32:	75 e4                	jne    80106c18 <pinit+0x48>
+}
+80106c34:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106c37:	c9                   	leave
+80106c38:	c3                   	ret
+80106c39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80106c40 <mycpu>:
+{
+80106c40:	55                   	push   %ebp
+80106c41:	89 e5                	mov    %esp,%ebp
+80106c43:	56                   	push   %esi
+80106c44:	53                   	push   %ebx
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80106c45:	9c                   	pushf
+80106c46:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80106c47:	f6 c4 02             	test   $0x2,%ah
+80106c4a:	75 46                	jne    80106c92 <mycpu+0x52>
+  apicid = lapicid();
+80106c4c:	e8 0f e4 ff ff       	call   80105060 <lapicid>
+  for (i = 0; i < ncpu; ++i) {
+80106c51:	8b 35 64 71 22 80    	mov    0x80227164,%esi
+80106c57:	85 f6                	test   %esi,%esi
+80106c59:	7e 2a                	jle    80106c85 <mycpu+0x45>
+80106c5b:	31 d2                	xor    %edx,%edx
+80106c5d:	eb 08                	jmp    80106c67 <mycpu+0x27>
+80106c5f:	90                   	nop
+80106c60:	83 c2 01             	add    $0x1,%edx
+80106c63:	39 f2                	cmp    %esi,%edx
+80106c65:	74 1e                	je     80106c85 <mycpu+0x45>
+    if (cpus[i].apicid == apicid)
+80106c67:	69 ca bc 00 00 00    	imul   $0xbc,%edx,%ecx
+80106c6d:	0f b6 99 80 71 22 80 	movzbl -0x7fdd8e80(%ecx),%ebx
+80106c74:	39 c3                	cmp    %eax,%ebx
+80106c76:	75 e8                	jne    80106c60 <mycpu+0x20>
+}
+80106c78:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return &cpus[i];
+80106c7b:	8d 81 80 71 22 80    	lea    -0x7fdd8e80(%ecx),%eax
+}
+80106c81:	5b                   	pop    %ebx
+80106c82:	5e                   	pop    %esi
+80106c83:	5d                   	pop    %ebp
+80106c84:	c3                   	ret
+  panic("unknown apicid\n");
+80106c85:	83 ec 0c             	sub    $0xc,%esp
+80106c88:	68 ce bc 10 80       	push   $0x8010bcce
+80106c8d:	e8 ce 99 ff ff       	call   80100660 <panic>
+    panic("mycpu called with interrupts enabled\n");
+80106c92:	83 ec 0c             	sub    $0xc,%esp
+80106c95:	68 c4 bd 10 80       	push   $0x8010bdc4
+80106c9a:	e8 c1 99 ff ff       	call   80100660 <panic>
+80106c9f:	90                   	nop
+
+80106ca0 <cpuid>:
+cpuid() {
+80106ca0:	55                   	push   %ebp
+80106ca1:	89 e5                	mov    %esp,%ebp
+80106ca3:	83 ec 08             	sub    $0x8,%esp
+  return mycpu()-cpus;
+80106ca6:	e8 95 ff ff ff       	call   80106c40 <mycpu>
+}
+80106cab:	c9                   	leave
+  return mycpu()-cpus;
+80106cac:	2d 80 71 22 80       	sub    $0x80227180,%eax
+80106cb1:	c1 f8 02             	sar    $0x2,%eax
+80106cb4:	69 c0 cf 46 7d 67    	imul   $0x677d46cf,%eax,%eax
+}
+80106cba:	c3                   	ret
+80106cbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106cbf:	90                   	nop
+
+80106cc0 <allocproc>:
+// If found, change state to EMBRYO and initialize
+// state required to run in the kernel.
+// Otherwise return 0.
+static struct proc*
+allocproc(void)
+{
+80106cc0:	55                   	push   %ebp
+80106cc1:	89 e5                	mov    %esp,%ebp
+80106cc3:	53                   	push   %ebx
+  struct proc *p;
+  char *sp;
+
+  acquire(&ptable.lock);
+
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+80106cc4:	bb 60 8a 22 80       	mov    $0x80228a60,%ebx
+{
+80106cc9:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ptable.lock);
+80106ccc:	68 20 8a 22 80       	push   $0x80228a20
+80106cd1:	e8 8a 14 00 00       	call   80108160 <acquire>
+80106cd6:	83 c4 10             	add    $0x10,%esp
+80106cd9:	eb 17                	jmp    80106cf2 <allocproc+0x32>
+80106cdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106cdf:	90                   	nop
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+80106ce0:	81 c3 b4 00 00 00    	add    $0xb4,%ebx
+80106ce6:	81 fb 60 3e 23 80    	cmp    $0x80233e60,%ebx
+80106cec:	0f 84 e2 00 00 00    	je     80106dd4 <allocproc+0x114>
+    if(p->state == UNUSED)
+80106cf2:	8b 43 0c             	mov    0xc(%ebx),%eax
+80106cf5:	85 c0                	test   %eax,%eax
+80106cf7:	75 e7                	jne    80106ce0 <allocproc+0x20>
+  release(&ptable.lock);
+  return 0;
+
+found:
+  p->state = EMBRYO;
+  p->pid = nextpid++;
+80106cf9:	a1 04 f0 10 80       	mov    0x8010f004,%eax
+  p->level = 0;
+  p->slice = 0;
+  p->boost = ticks / BOOSTTICKS;
+  p->nrun = 0;
+  p->nsleep = 0;
+  memset(p->ticks, 0, sizeof(p->ticks));
+80106cfe:	83 ec 04             	sub    $0x4,%esp
+  p->state = EMBRYO;
+80106d01:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+  p->level = 0;
+80106d08:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%ebx)
+80106d0f:	00 00 00 
+  p->pid = nextpid++;
+80106d12:	8d 50 01             	lea    0x1(%eax),%edx
+80106d15:	89 43 10             	mov    %eax,0x10(%ebx)
+  p->boost = ticks / BOOSTTICKS;
+80106d18:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+  p->pid = nextpid++;
+80106d1d:	89 15 04 f0 10 80    	mov    %edx,0x8010f004
+  p->boost = ticks / BOOSTTICKS;
+80106d23:	f7 25 80 5f 23 80    	mull   0x80235f80
+  memset(p->ticks, 0, sizeof(p->ticks));
+80106d29:	8d 83 a4 00 00 00    	lea    0xa4(%ebx),%eax
+  p->slice = 0;
+80106d2f:	c7 83 94 00 00 00 00 	movl   $0x0,0x94(%ebx)
+80106d36:	00 00 00 
+  p->nrun = 0;
+80106d39:	c7 83 9c 00 00 00 00 	movl   $0x0,0x9c(%ebx)
+80106d40:	00 00 00 
+  p->nsleep = 0;
+80106d43:	c7 83 a0 00 00 00 00 	movl   $0x0,0xa0(%ebx)
+80106d4a:	00 00 00 
+  p->boost = ticks / BOOSTTICKS;
+80106d4d:	c1 ea 05             	shr    $0x5,%edx
+80106d50:	89 93 98 00 00 00    	mov    %edx,0x98(%ebx)
+  memset(p->ticks, 0, sizeof(p->ticks));
+80106d56:	6a 0c                	push   $0xc
+80106d58:	6a 00                	push   $0x0
+80106d5a:	50                   	push   %eax
+80106d5b:	e8 30 17 00 00       	call   80108490 <memset>
+
+  release(&ptable.lock);
+80106d60:	c7 04 24 20 8a 22 80 	movl   $0x80228a20,(%esp)
+80106d67:	e8 34 16 00 00       	call   801083a0 <release>
+
+  // Start out on the creating CPU's run queue.
+  pushcli();
+80106d6c:	e8 9f 13 00 00       	call   80108110 <pushcli>
+  return mycpu()-cpus;
+80106d71:	e8 ca fe ff ff       	call   80106c40 <mycpu>
+80106d76:	2d 80 71 22 80       	sub    $0x80227180,%eax
+80106d7b:	c1 f8 02             	sar    $0x2,%eax
+80106d7e:	69 c0 cf 46 7d 67    	imul   $0x677d46cf,%eax,%eax
+  p->cpu = cpuid();
+80106d84:	89 43 7c             	mov    %eax,0x7c(%ebx)
+  popcli();
+80106d87:	e8 b4 15 00 00       	call   80108340 <popcli>
+
+  // Allocate kernel stack.
+  if((p->kstack = kalloc()) == 0){
+80106d8c:	e8 1f de ff ff       	call   80104bb0 <kalloc>
+80106d91:	83 c4 10             	add    $0x10,%esp
+80106d94:	89 43 08             	mov    %eax,0x8(%ebx)
+80106d97:	85 c0                	test   %eax,%eax
+80106d99:	74 52                	je     80106ded <allocproc+0x12d>
+    return 0;
+  }
+  sp = p->kstack + KSTACKSIZE;
+
+  // Leave room for trap frame.
+  sp -= sizeof *p->tf;
+80106d9b:	8d 90 b4 0f 00 00    	lea    0xfb4(%eax),%edx
+  sp -= 4;
+  *(uint*)sp = (uint)trapret;
+
+  sp -= sizeof *p->context;
+  p->context = (struct context*)sp;
+  memset(p->context, 0, sizeof *p->context);
+80106da1:	83 ec 04             	sub    $0x4,%esp
+  sp -= sizeof *p->context;
+80106da4:	05 9c 0f 00 00       	add    $0xf9c,%eax
+  sp -= sizeof *p->tf;
+80106da9:	89 53 18             	mov    %edx,0x18(%ebx)
+  *(uint*)sp = (uint)trapret;
+80106dac:	c7 40 14 47 99 10 80 	movl   $0x80109947,0x14(%eax)
+  p->context = (struct context*)sp;
+80106db3:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  memset(p->context, 0, sizeof *p->context);
+80106db6:	6a 14                	push   $0x14
+80106db8:	6a 00                	push   $0x0
+80106dba:	50                   	push   %eax
+80106dbb:	e8 d0 16 00 00       	call   80108490 <memset>
+  p->context->eip = (uint)forkret;
+80106dc0:	8b 43 1c             	mov    0x1c(%ebx),%eax
+
+  return p;
+80106dc3:	83 c4 10             	add    $0x10,%esp
+  p->context->eip = (uint)forkret;
+80106dc6:	c7 40 10 00 6e 10 80 	movl   $0x80106e00,0x10(%eax)
+}
+80106dcd:	89 d8                	mov    %ebx,%eax
+80106dcf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106dd2:	c9                   	leave
+80106dd3:	c3                   	ret
+  release(&ptable.lock);
+80106dd4:	83 ec 0c             	sub    $0xc,%esp
+  return 0;
+80106dd7:	31 db                	xor    %ebx,%ebx
+  release(&ptable.lock);
+80106dd9:	68 20 8a 22 80       	push   $0x80228a20
+80106dde:	e8 bd 15 00 00       	call   801083a0 <release>
+  return 0;
+80106de3:	83 c4 10             	add    $0x10,%esp
+}
+80106de6:	89 d8                	mov    %ebx,%eax
+80106de8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106deb:	c9                   	leave
+80106dec:	c3                   	ret
+    p->state = UNUSED;
+80106ded:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return 0;
+80106df4:	31 db                	xor    %ebx,%ebx
+80106df6:	eb ee                	jmp    80106de6 <allocproc+0x126>
+80106df8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106dff:	90                   	nop
+
+80106e00 <forkret>:
+
+// A fork child's very first scheduling by scheduler()
+// will swtch here.  "Return" to user space.
+void
+forkret(void)
+{
+80106e00:	55                   	push   %ebp
+80106e01:	89 e5                	mov    %esp,%ebp
+80106e03:	83 ec 08             	sub    $0x8,%esp
+  return mycpu()-cpus;
+80106e06:	e8 35 fe ff ff       	call   80106c40 <mycpu>
+  static int first = 1;
+  // Still holding the run queue lock from scheduler.
+  release(&runq[cpuid()].lock);
+80106e0b:	83 ec 0c             	sub    $0xc,%esp
+  return mycpu()-cpus;
+80106e0e:	2d 80 71 22 80       	sub    $0x80227180,%eax
+80106e13:	c1 f8 02             	sar    $0x2,%eax
+80106e16:	69 c0 cf 46 7d 67    	imul   $0x677d46cf,%eax,%eax
+  release(&runq[cpuid()].lock);
+80106e1c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+80106e1f:	c1 e0 04             	shl    $0x4,%eax
+80106e22:	05 a0 87 22 80       	add    $0x802287a0,%eax
+80106e27:	50                   	push   %eax
+80106e28:	e8 73 15 00 00       	call   801083a0 <release>
+
+  if (first) {
+80106e2d:	a1 00 f0 10 80       	mov    0x8010f000,%eax
+80106e32:	83 c4 10             	add    $0x10,%esp
+80106e35:	85 c0                	test   %eax,%eax
+80106e37:	75 07                	jne    80106e40 <forkret+0x40>
+    iinit(ROOTDEV);
+    initlog(ROOTDEV);
+  }
+
+  // Return to "caller", actually trapret (see allocproc).
+}
+80106e39:	c9                   	leave
+80106e3a:	c3                   	ret
+80106e3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106e3f:	90                   	nop
+    first = 0;
+80106e40:	c7 05 00 f0 10 80 00 	movl   $0x0,0x8010f000
+80106e47:	00 00 00 
+    iinit(ROOTDEV);
+80106e4a:	83 ec 0c             	sub    $0xc,%esp
+80106e4d:	6a 01                	push   $0x1
+80106e4f:	e8 ac b8 ff ff       	call   80102700 <iinit>
+    initlog(ROOTDEV);
+80106e54:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+80106e5b:	e8 b0 e9 ff ff       	call   80105810 <initlog>
+}
+80106e60:	83 c4 10             	add    $0x10,%esp
+80106e63:	c9                   	leave
+80106e64:	c3                   	ret
+80106e65:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106e6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80106e70 <myproc>:
+myproc(void) {
+80106e70:	55                   	push   %ebp
+80106e71:	89 e5                	mov    %esp,%ebp
+80106e73:	53                   	push   %ebx
+80106e74:	83 ec 04             	sub    $0x4,%esp
+  pushcli();
+80106e77:	e8 94 12 00 00       	call   80108110 <pushcli>
+  c = mycpu();
+80106e7c:	e8 bf fd ff ff       	call   80106c40 <mycpu>
+  p = c->proc;
+80106e81:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80106e87:	e8 b4 14 00 00       	call   80108340 <popcli>
+}
+80106e8c:	89 d8                	mov    %ebx,%eax
+80106e8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106e91:	c9                   	leave
+80106e92:	c3                   	ret
+80106e93:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106e9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80106ea0 <userinit>:
+{
+80106ea0:	55                   	push   %ebp
+80106ea1:	89 e5                	mov    %esp,%ebp
+80106ea3:	53                   	push   %ebx
+80106ea4:	83 ec 04             	sub    $0x4,%esp
+  p = allocproc();
+80106ea7:	e8 14 fe ff ff       	call   80106cc0 <allocproc>
+80106eac:	89 c3                	mov    %eax,%ebx
+  initproc = p;
+80106eae:	a3 60 3e 23 80       	mov    %eax,0x80233e60
+  if((p->pgdir = setupkvm()) == 0)
+80106eb3:	e8 28 42 00 00       	call   8010b0e0 <setupkvm>
+80106eb8:	89 43 04             	mov    %eax,0x4(%ebx)
+80106ebb:	85 c0                	test   %eax,%eax
+80106ebd:	0f 84 a4 00 00 00    	je     80106f67 <userinit+0xc7>
+  inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
+80106ec3:	83 ec 04             	sub    $0x4,%esp
+80106ec6:	68 2c 00 00 00       	push   $0x2c
+80106ecb:	68 60 f4 10 80       	push   $0x8010f460
+80106ed0:	50                   	push   %eax
+80106ed1:	e8 ea 3e 00 00       	call   8010adc0 <inituvm>
+  memset(p->tf, 0, sizeof(*p->tf));
+80106ed6:	83 c4 0c             	add    $0xc,%esp
+  p->sz = PGSIZE;
+80106ed9:	c7 03 00 10 00 00    	movl   $0x1000,(%ebx)
+  memset(p->tf, 0, sizeof(*p->tf));
+80106edf:	6a 4c                	push   $0x4c
+80106ee1:	6a 00                	push   $0x0
+80106ee3:	ff 73 18             	push   0x18(%ebx)
+80106ee6:	e8 a5 15 00 00       	call   80108490 <memset>
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+80106eeb:	8b 43 18             	mov    0x18(%ebx),%eax
+80106eee:	ba 1b 00 00 00       	mov    $0x1b,%edx
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+80106ef3:	83 c4 0c             	add    $0xc,%esp
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+80106ef6:	b9 23 00 00 00       	mov    $0x23,%ecx
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+80106efb:	66 89 50 3c          	mov    %dx,0x3c(%eax)
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+80106eff:	8b 43 18             	mov    0x18(%ebx),%eax
+80106f02:	66 89 48 2c          	mov    %cx,0x2c(%eax)
+  p->tf->es = p->tf->ds;
+80106f06:	8b 43 18             	mov    0x18(%ebx),%eax
+80106f09:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80106f0d:	66 89 50 28          	mov    %dx,0x28(%eax)
+  p->tf->ss = p->tf->ds;
+80106f11:	8b 43 18             	mov    0x18(%ebx),%eax
+80106f14:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80106f18:	66 89 50 48          	mov    %dx,0x48(%eax)
+  p->tf->eflags = FL_IF;
+80106f1c:	8b 43 18             	mov    0x18(%ebx),%eax
+80106f1f:	c7 40 40 00 02 00 00 	movl   $0x200,0x40(%eax)
+  p->tf->esp = PGSIZE;
+80106f26:	8b 43 18             	mov    0x18(%ebx),%eax
+80106f29:	c7 40 44 00 10 00 00 	movl   $0x1000,0x44(%eax)
+  p->tf->eip = 0;  // beginning of initcode.S
+80106f30:	8b 43 18             	mov    0x18(%ebx),%eax
+80106f33:	c7 40 38 00 00 00 00 	movl   $0x0,0x38(%eax)
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+80106f3a:	8d 43 6c             	lea    0x6c(%ebx),%eax
+80106f3d:	6a 10                	push   $0x10
+80106f3f:	68 f7 bc 10 80       	push   $0x8010bcf7
+80106f44:	50                   	push   %eax
+80106f45:	e8 f6 16 00 00       	call   80108640 <safestrcpy>
+  p->cwd = namei("/");
+80106f4a:	c7 04 24 00 bd 10 80 	movl   $0x8010bd00,(%esp)
+80106f51:	e8 ca d1 ff ff       	call   80104120 <namei>
+  enqueue(p);
+80106f56:	83 c4 10             	add    $0x10,%esp
+  p->cwd = namei("/");
+80106f59:	89 43 68             	mov    %eax,0x68(%ebx)
+  enqueue(p);
+80106f5c:	89 d8                	mov    %ebx,%eax
+}
+80106f5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106f61:	c9                   	leave
+  enqueue(p);
+80106f62:	e9 69 fb ff ff       	jmp    80106ad0 <enqueue>
+    panic("userinit: out of memory?");
+80106f67:	83 ec 0c             	sub    $0xc,%esp
+80106f6a:	68 de bc 10 80       	push   $0x8010bcde
+80106f6f:	e8 ec 96 ff ff       	call   80100660 <panic>
+80106f74:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106f7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106f7f:	90                   	nop
+
+80106f80 <growproc>:
+{
+80106f80:	55                   	push   %ebp
+80106f81:	89 e5                	mov    %esp,%ebp
+80106f83:	56                   	push   %esi
+80106f84:	53                   	push   %ebx
+80106f85:	8b 75 08             	mov    0x8(%ebp),%esi
+  pushcli();
+80106f88:	e8 83 11 00 00       	call   80108110 <pushcli>
+  c = mycpu();
+80106f8d:	e8 ae fc ff ff       	call   80106c40 <mycpu>
+  p = c->proc;
+80106f92:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80106f98:	e8 a3 13 00 00       	call   80108340 <popcli>
+  sz = curproc->sz;
+80106f9d:	8b 03                	mov    (%ebx),%eax
+  if(n > 0){
+80106f9f:	85 f6                	test   %esi,%esi
+80106fa1:	7f 1d                	jg     80106fc0 <growproc+0x40>
+  } else if(n < 0){
+80106fa3:	75 3b                	jne    80106fe0 <growproc+0x60>
+  switchuvm(curproc);
+80106fa5:	83 ec 0c             	sub    $0xc,%esp
+  curproc->sz = sz;
+80106fa8:	89 03                	mov    %eax,(%ebx)
+  switchuvm(curproc);
+80106faa:	53                   	push   %ebx
+80106fab:	e8 00 3d 00 00       	call   8010acb0 <switchuvm>
+  return 0;
+80106fb0:	83 c4 10             	add    $0x10,%esp
+80106fb3:	31 c0                	xor    %eax,%eax
+}
+80106fb5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106fb8:	5b                   	pop    %ebx
+80106fb9:	5e                   	pop    %esi
+80106fba:	5d                   	pop    %ebp
+80106fbb:	c3                   	ret
+80106fbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+80106fc0:	83 ec 04             	sub    $0x4,%esp
+80106fc3:	01 c6                	add    %eax,%esi
+80106fc5:	56                   	push   %esi
+80106fc6:	50                   	push   %eax
+80106fc7:	ff 73 04             	push   0x4(%ebx)
+80106fca:	e8 41 3f 00 00       	call   8010af10 <allocuvm>
+80106fcf:	83 c4 10             	add    $0x10,%esp
+80106fd2:	85 c0                	test   %eax,%eax
+80106fd4:	75 cf                	jne    80106fa5 <growproc+0x25>
+      return -1;
+80106fd6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106fdb:	eb d8                	jmp    80106fb5 <growproc+0x35>
+80106fdd:	8d 76 00             	lea    0x0(%esi),%esi
+    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
+80106fe0:	83 ec 04             	sub    $0x4,%esp
+80106fe3:	01 c6                	add    %eax,%esi
+80106fe5:	56                   	push   %esi
+80106fe6:	50                   	push   %eax
+80106fe7:	ff 73 04             	push   0x4(%ebx)
+80106fea:	e8 41 40 00 00       	call   8010b030 <deallocuvm>
+80106fef:	83 c4 10             	add    $0x10,%esp
+80106ff2:	85 c0                	test   %eax,%eax
+80106ff4:	75 af                	jne    80106fa5 <growproc+0x25>
+80106ff6:	eb de                	jmp    80106fd6 <growproc+0x56>
+80106ff8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106fff:	90                   	nop
+
+80107000 <fork>:
+{
+80107000:	55                   	push   %ebp
+80107001:	89 e5                	mov    %esp,%ebp
+80107003:	57                   	push   %edi
+80107004:	56                   	push   %esi
+80107005:	53                   	push   %ebx
+80107006:	83 ec 1c             	sub    $0x1c,%esp
+  pushcli();
+80107009:	e8 02 11 00 00       	call   80108110 <pushcli>
+  c = mycpu();
+8010700e:	e8 2d fc ff ff       	call   80106c40 <mycpu>
+  p = c->proc;
+80107013:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80107019:	e8 22 13 00 00       	call   80108340 <popcli>
+  if((np = allocproc()) == 0){
+8010701e:	e8 9d fc ff ff       	call   80106cc0 <allocproc>
+80107023:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80107026:	85 c0                	test   %eax,%eax
+80107028:	0f 84 be 00 00 00    	je     801070ec <fork+0xec>
+  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
+8010702e:	83 ec 08             	sub    $0x8,%esp
+80107031:	ff 33                	push   (%ebx)
+80107033:	89 c7                	mov    %eax,%edi
+80107035:	ff 73 04             	push   0x4(%ebx)
+80107038:	e8 93 41 00 00       	call   8010b1d0 <copyuvm>
+8010703d:	83 c4 10             	add    $0x10,%esp
+80107040:	89 47 04             	mov    %eax,0x4(%edi)
+80107043:	85 c0                	test   %eax,%eax
+80107045:	0f 84 82 00 00 00    	je     801070cd <fork+0xcd>
+  np->sz = curproc->sz;
+8010704b:	8b 03                	mov    (%ebx),%eax
+8010704d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80107050:	89 01                	mov    %eax,(%ecx)
+  *np->tf = *curproc->tf;
+80107052:	8b 79 18             	mov    0x18(%ecx),%edi
+  np->parent = curproc;
+80107055:	89 c8                	mov    %ecx,%eax
+80107057:	89 59 14             	mov    %ebx,0x14(%ecx)
+  *np->tf = *curproc->tf;
+8010705a:	b9 13 00 00 00       	mov    $0x13,%ecx
+8010705f:	8b 73 18             	mov    0x18(%ebx),%esi
+80107062:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  for(i = 0; i < NOFILE; i++)
+80107064:	31 f6                	xor    %esi,%esi
+  np->tf->eax = 0;
+80107066:	8b 40 18             	mov    0x18(%eax),%eax
+80107069:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+    if(curproc->ofile[i])
+80107070:	8b 44 b3 28          	mov    0x28(%ebx,%esi,4),%eax
+80107074:	85 c0                	test   %eax,%eax
+80107076:	74 13                	je     8010708b <fork+0x8b>
+      np->ofile[i] = filedup(curproc->ofile[i]);
+80107078:	83 ec 0c             	sub    $0xc,%esp
+8010707b:	50                   	push   %eax
+8010707c:	e8 4f a3 ff ff       	call   801013d0 <filedup>
+80107081:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80107084:	83 c4 10             	add    $0x10,%esp
+80107087:	89 44 b2 28          	mov    %eax,0x28(%edx,%esi,4)
+  for(i = 0; i < NOFILE; i++)
+8010708b:	83 c6 01             	add    $0x1,%esi
+8010708e:	83 fe 10             	cmp    $0x10,%esi
+80107091:	75 dd                	jne    80107070 <fork+0x70>
+  np->cwd = idup(curproc->cwd);
+80107093:	83 ec 0c             	sub    $0xc,%esp
+80107096:	ff 73 68             	push   0x68(%ebx)
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+80107099:	83 c3 6c             	add    $0x6c,%ebx
+  np->cwd = idup(curproc->cwd);
+8010709c:	e8 9f b8 ff ff       	call   80102940 <idup>
+801070a1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+801070a4:	83 c4 0c             	add    $0xc,%esp
+  np->cwd = idup(curproc->cwd);
+801070a7:	89 47 68             	mov    %eax,0x68(%edi)
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+801070aa:	8d 47 6c             	lea    0x6c(%edi),%eax
+801070ad:	6a 10                	push   $0x10
+801070af:	53                   	push   %ebx
+801070b0:	50                   	push   %eax
+801070b1:	e8 8a 15 00 00       	call   80108640 <safestrcpy>
+  pid = np->pid;
+801070b6:	89 f8                	mov    %edi,%eax
+801070b8:	8b 5f 10             	mov    0x10(%edi),%ebx
+  enqueue(np);
+801070bb:	e8 10 fa ff ff       	call   80106ad0 <enqueue>
+  return pid;
+801070c0:	83 c4 10             	add    $0x10,%esp
+}
+801070c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801070c6:	89 d8                	mov    %ebx,%eax
+801070c8:	5b                   	pop    %ebx
+801070c9:	5e                   	pop    %esi
+801070ca:	5f                   	pop    %edi
+801070cb:	5d                   	pop    %ebp
+801070cc:	c3                   	ret
+    kfree(np->kstack);
+801070cd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801070d0:	83 ec 0c             	sub    $0xc,%esp
+801070d3:	ff 77 08             	push   0x8(%edi)
+801070d6:	e8 55 d8 ff ff       	call   80104930 <kfree>
+    np->kstack = 0;
+801070db:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+    return -1;
+801070e2:	83 c4 10             	add    $0x10,%esp
+    np->state = UNUSED;
+801070e5:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+    return -1;
+801070ec:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+801070f1:	eb d0                	jmp    801070c3 <fork+0xc3>
+801070f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801070fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107100 <kproc>:
+{
+80107100:	55                   	push   %ebp
+80107101:	89 e5                	mov    %esp,%ebp
+80107103:	53                   	push   %ebx
+80107104:	83 ec 04             	sub    $0x4,%esp
+  if((np = allocproc()) == 0)
+80107107:	e8 b4 fb ff ff       	call   80106cc0 <allocproc>
+8010710c:	85 c0                	test   %eax,%eax
+8010710e:	74 64                	je     80107174 <kproc+0x74>
+80107110:	89 c3                	mov    %eax,%ebx
+  if((np->pgdir = setupkvm()) == 0){
+80107112:	e8 c9 3f 00 00       	call   8010b0e0 <setupkvm>
+80107117:	89 43 04             	mov    %eax,0x4(%ebx)
+8010711a:	85 c0                	test   %eax,%eax
+8010711c:	74 3a                	je     80107158 <kproc+0x58>
+  np->parent = initproc;
+8010711e:	a1 60 3e 23 80       	mov    0x80233e60,%eax
+  *(uint*)(np->context + 1) = (uint)fn;
+80107123:	8b 55 0c             	mov    0xc(%ebp),%edx
+  safestrcpy(np->name, name, sizeof(np->name));
+80107126:	83 ec 04             	sub    $0x4,%esp
+  np->sz = 0;
+80107129:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  np->parent = initproc;
+8010712f:	89 43 14             	mov    %eax,0x14(%ebx)
+  *(uint*)(np->context + 1) = (uint)fn;
+80107132:	8b 43 1c             	mov    0x1c(%ebx),%eax
+80107135:	89 50 14             	mov    %edx,0x14(%eax)
+  safestrcpy(np->name, name, sizeof(np->name));
+80107138:	8d 43 6c             	lea    0x6c(%ebx),%eax
+8010713b:	6a 10                	push   $0x10
+8010713d:	ff 75 08             	push   0x8(%ebp)
+80107140:	50                   	push   %eax
+80107141:	e8 fa 14 00 00       	call   80108640 <safestrcpy>
+  enqueue(np);
+80107146:	89 d8                	mov    %ebx,%eax
+80107148:	e8 83 f9 ff ff       	call   80106ad0 <enqueue>
+  return np->pid;
+8010714d:	8b 43 10             	mov    0x10(%ebx),%eax
+80107150:	83 c4 10             	add    $0x10,%esp
+}
+80107153:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107156:	c9                   	leave
+80107157:	c3                   	ret
+    kfree(np->kstack);
+80107158:	83 ec 0c             	sub    $0xc,%esp
+8010715b:	ff 73 08             	push   0x8(%ebx)
+8010715e:	e8 cd d7 ff ff       	call   80104930 <kfree>
+    np->kstack = 0;
+80107163:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    return -1;
+8010716a:	83 c4 10             	add    $0x10,%esp
+    np->state = UNUSED;
+8010716d:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    return -1;
+80107174:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107179:	eb d8                	jmp    80107153 <kproc+0x53>
+8010717b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010717f:	90                   	nop
+
+80107180 <scheduler>:
+{
+80107180:	55                   	push   %ebp
+80107181:	89 e5                	mov    %esp,%ebp
+80107183:	57                   	push   %edi
+80107184:	56                   	push   %esi
+80107185:	53                   	push   %ebx
+80107186:	83 ec 2c             	sub    $0x2c,%esp
+  struct cpu *c = mycpu();
+80107189:	e8 b2 fa ff ff       	call   80106c40 <mycpu>
+8010718e:	89 c7                	mov    %eax,%edi
+80107190:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  return mycpu()-cpus;
+80107193:	e8 a8 fa ff ff       	call   80106c40 <mycpu>
+  c->proc = 0;
+80107198:	c7 87 ac 00 00 00 00 	movl   $0x0,0xac(%edi)
+8010719f:	00 00 00 
+  return mycpu()-cpus;
+801071a2:	2d 80 71 22 80       	sub    $0x80227180,%eax
+801071a7:	c1 f8 02             	sar    $0x2,%eax
+801071aa:	69 c0 cf 46 7d 67    	imul   $0x677d46cf,%eax,%eax
+  struct runq *rq = &runq[cpuid()];
+801071b0:	8d 04 80             	lea    (%eax,%eax,4),%eax
+801071b3:	c1 e0 04             	shl    $0x4,%eax
+801071b6:	05 a0 87 22 80       	add    $0x802287a0,%eax
+801071bb:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  c->proc = 0;
+801071be:	8d 87 b0 00 00 00    	lea    0xb0(%edi),%eax
+801071c4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+801071c7:	8d 47 04             	lea    0x4(%edi),%eax
+801071ca:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+801071cd:	8d 76 00             	lea    0x0(%esi),%esi
+  asm volatile("sti");
+801071d0:	fb                   	sti
+    acquire(&rq->lock);
+801071d1:	8b 7d dc             	mov    -0x24(%ebp),%edi
+801071d4:	83 ec 0c             	sub    $0xc,%esp
+801071d7:	57                   	push   %edi
+801071d8:	e8 83 0f 00 00       	call   80108160 <acquire>
+    if((p = rq->head[i]) != 0){
+801071dd:	8b 47 40             	mov    0x40(%edi),%eax
+801071e0:	83 c4 10             	add    $0x10,%esp
+801071e3:	85 c0                	test   %eax,%eax
+801071e5:	74 69                	je     80107250 <scheduler+0xd0>
+      rq->head[i] = p->rqnext;
+801071e7:	8b 90 80 00 00 00    	mov    0x80(%eax),%edx
+801071ed:	89 57 40             	mov    %edx,0x40(%edi)
+      if(rq->head[i] == 0)
+801071f0:	85 d2                	test   %edx,%edx
+801071f2:	0f 84 a8 01 00 00    	je     801073a0 <scheduler+0x220>
+      rq->n--;
+801071f8:	8b 7d dc             	mov    -0x24(%ebp),%edi
+801071fb:	83 6f 48 01          	subl   $0x1,0x48(%edi)
+      return p;
+801071ff:	90                   	nop
+    c->proc = p;
+80107200:	8b 75 d8             	mov    -0x28(%ebp),%esi
+    switchuvm(p);
+80107203:	83 ec 0c             	sub    $0xc,%esp
+    c->proc = p;
+80107206:	89 86 ac 00 00 00    	mov    %eax,0xac(%esi)
+    switchuvm(p);
+8010720c:	50                   	push   %eax
+8010720d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80107210:	e8 9b 3a 00 00       	call   8010acb0 <switchuvm>
+    p->state = RUNNING;
+80107215:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    p->nrun++;
+80107218:	83 80 9c 00 00 00 01 	addl   $0x1,0x9c(%eax)
+    p->state = RUNNING;
+8010721f:	c7 40 0c 04 00 00 00 	movl   $0x4,0xc(%eax)
+    swtch(&(c->scheduler), p->context);
+80107226:	5a                   	pop    %edx
+80107227:	59                   	pop    %ecx
+80107228:	ff 70 1c             	push   0x1c(%eax)
+8010722b:	ff 75 d4             	push   -0x2c(%ebp)
+8010722e:	e8 68 14 00 00       	call   8010869b <swtch>
+    switchkvm();
+80107233:	e8 68 3a 00 00       	call   8010aca0 <switchkvm>
+    c->proc = 0;
+80107238:	c7 86 ac 00 00 00 00 	movl   $0x0,0xac(%esi)
+8010723f:	00 00 00 
+    release(&rq->lock);
+80107242:	5b                   	pop    %ebx
+80107243:	ff 75 dc             	push   -0x24(%ebp)
+80107246:	e8 55 11 00 00       	call   801083a0 <release>
+8010724b:	83 c4 10             	add    $0x10,%esp
+8010724e:	eb 80                	jmp    801071d0 <scheduler+0x50>
+      release(&rq->lock);
+80107250:	83 ec 0c             	sub    $0xc,%esp
+80107253:	ff 75 dc             	push   -0x24(%ebp)
+80107256:	e8 45 11 00 00       	call   801083a0 <release>
+  return mycpu()-cpus;
+8010725b:	e8 e0 f9 ff ff       	call   80106c40 <mycpu>
+  for(i = 1; i < ncpu; i++){
+80107260:	8b 0d 64 71 22 80    	mov    0x80227164,%ecx
+80107266:	83 c4 10             	add    $0x10,%esp
+  return mycpu()-cpus;
+80107269:	2d 80 71 22 80       	sub    $0x80227180,%eax
+8010726e:	c1 f8 02             	sar    $0x2,%eax
+80107271:	69 c0 cf 46 7d 67    	imul   $0x677d46cf,%eax,%eax
+80107277:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for(i = 1; i < ncpu; i++){
+8010727a:	83 f9 01             	cmp    $0x1,%ecx
+8010727d:	0f 8e ba 00 00 00    	jle    8010733d <scheduler+0x1bd>
+80107283:	be 01 00 00 00       	mov    $0x1,%esi
+80107288:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010728f:	90                   	nop
+    rq = &runq[(self + i) % ncpu];
+80107290:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80107293:	01 f0                	add    %esi,%eax
+80107295:	99                   	cltd
+80107296:	f7 f9                	idiv   %ecx
+80107298:	89 d7                	mov    %edx,%edi
+    if(rq->n == 0)
+8010729a:	8d 14 95 00 00 00 00 	lea    0x0(,%edx,4),%edx
+801072a1:	8d 04 3a             	lea    (%edx,%edi,1),%eax
+801072a4:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+801072a7:	c1 e0 04             	shl    $0x4,%eax
+801072aa:	8d 98 a0 87 22 80    	lea    -0x7fdd7860(%eax),%ebx
+801072b0:	8b 80 e8 87 22 80    	mov    -0x7fdd7818(%eax),%eax
+801072b6:	85 c0                	test   %eax,%eax
+801072b8:	74 78                	je     80107332 <scheduler+0x1b2>
+    acquire(&rq->lock);
+801072ba:	83 ec 0c             	sub    $0xc,%esp
+801072bd:	53                   	push   %ebx
+801072be:	e8 9d 0e 00 00       	call   80108160 <acquire>
+    if((p = rq->head[i]) != 0){
+801072c3:	8b 43 40             	mov    0x40(%ebx),%eax
+801072c6:	83 c4 10             	add    $0x10,%esp
+801072c9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801072cc:	85 c0                	test   %eax,%eax
+801072ce:	74 50                	je     80107320 <scheduler+0x1a0>
+      rq->head[i] = p->rqnext;
+801072d0:	89 d1                	mov    %edx,%ecx
+801072d2:	89 da                	mov    %ebx,%edx
+801072d4:	89 cb                	mov    %ecx,%ebx
+801072d6:	8b 88 80 00 00 00    	mov    0x80(%eax),%ecx
+801072dc:	89 4a 40             	mov    %ecx,0x40(%edx)
+      if(rq->head[i] == 0)
+801072df:	85 c9                	test   %ecx,%ecx
+801072e1:	0f 84 a9 00 00 00    	je     80107390 <scheduler+0x210>
+      p->cpu = self;
+801072e7:	8b 75 e0             	mov    -0x20(%ebp),%esi
+      rq->n--;
+801072ea:	01 fb                	add    %edi,%ebx
+    release(&rq->lock);
+801072ec:	83 ec 0c             	sub    $0xc,%esp
+      p->cpu = self;
+801072ef:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      rq->n--;
+801072f2:	c1 e3 04             	shl    $0x4,%ebx
+801072f5:	83 ab e8 87 22 80 01 	subl   $0x1,-0x7fdd7818(%ebx)
+      p->cpu = self;
+801072fc:	89 70 7c             	mov    %esi,0x7c(%eax)
+    release(&rq->lock);
+801072ff:	52                   	push   %edx
+80107300:	e8 9b 10 00 00       	call   801083a0 <release>
+      acquire(&rq->lock);
+80107305:	5f                   	pop    %edi
+80107306:	ff 75 dc             	push   -0x24(%ebp)
+80107309:	e8 52 0e 00 00       	call   80108160 <acquire>
+8010730e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80107311:	83 c4 10             	add    $0x10,%esp
+80107314:	e9 e7 fe ff ff       	jmp    80107200 <scheduler+0x80>
+80107319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    release(&rq->lock);
+80107320:	83 ec 0c             	sub    $0xc,%esp
+80107323:	53                   	push   %ebx
+80107324:	e8 77 10 00 00       	call   801083a0 <release>
+    if(p)
+80107329:	8b 0d 64 71 22 80    	mov    0x80227164,%ecx
+    release(&rq->lock);
+8010732f:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < ncpu; i++){
+80107332:	83 c6 01             	add    $0x1,%esi
+80107335:	39 f1                	cmp    %esi,%ecx
+80107337:	0f 8f 53 ff ff ff    	jg     80107290 <scheduler+0x110>
+  asm volatile("cli");
+8010733d:	fa                   	cli
+  asm volatile("lock; xchgl %0, %1" :
+8010733e:	b8 01 00 00 00       	mov    $0x1,%eax
+80107343:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+80107346:	f0 87 03             	lock xchg %eax,(%ebx)
+  for(i = 0; i < ncpu; i++)
+80107349:	8b 0d 64 71 22 80    	mov    0x80227164,%ecx
+8010734f:	85 c9                	test   %ecx,%ecx
+80107351:	7e 61                	jle    801073b4 <scheduler+0x234>
+80107353:	ba e8 87 22 80       	mov    $0x802287e8,%edx
+80107358:	31 c0                	xor    %eax,%eax
+8010735a:	eb 0e                	jmp    8010736a <scheduler+0x1ea>
+8010735c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107360:	83 c0 01             	add    $0x1,%eax
+80107363:	83 c2 50             	add    $0x50,%edx
+80107366:	39 c1                	cmp    %eax,%ecx
+80107368:	74 46                	je     801073b0 <scheduler+0x230>
+    if(runq[i].n > 0)
+8010736a:	8b 32                	mov    (%edx),%esi
+8010736c:	85 f6                	test   %esi,%esi
+8010736e:	7e f0                	jle    80107360 <scheduler+0x1e0>
+  if(i == ncpu)
+80107370:	39 c1                	cmp    %eax,%ecx
+80107372:	74 3c                	je     801073b0 <scheduler+0x230>
+  c->idle = 0;
+80107374:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80107377:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+8010737e:	00 00 00 
+        continue;
+80107381:	e9 4a fe ff ff       	jmp    801071d0 <scheduler+0x50>
+80107386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010738d:	8d 76 00             	lea    0x0(%esi),%esi
+        rq->tail[i] = 0;
+80107390:	c7 42 44 00 00 00 00 	movl   $0x0,0x44(%edx)
+80107397:	e9 4b ff ff ff       	jmp    801072e7 <scheduler+0x167>
+8010739c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801073a0:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+801073a3:	c7 43 44 00 00 00 00 	movl   $0x0,0x44(%ebx)
+801073aa:	e9 49 fe ff ff       	jmp    801071f8 <scheduler+0x78>
+801073af:	90                   	nop
+  asm volatile("sti; hlt");
+801073b0:	fb                   	sti
+801073b1:	f4                   	hlt
+}
+801073b2:	eb c0                	jmp    80107374 <scheduler+0x1f4>
+  for(i = 0; i < ncpu; i++)
+801073b4:	31 c0                	xor    %eax,%eax
+801073b6:	eb b8                	jmp    80107370 <scheduler+0x1f0>
+801073b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801073bf:	90                   	nop
+
+801073c0 <sched>:
+{
+801073c0:	55                   	push   %ebp
+801073c1:	89 e5                	mov    %esp,%ebp
+801073c3:	56                   	push   %esi
+801073c4:	53                   	push   %ebx
+  pushcli();
+801073c5:	e8 46 0d 00 00       	call   80108110 <pushcli>
+  c = mycpu();
+801073ca:	e8 71 f8 ff ff       	call   80106c40 <mycpu>
+  p = c->proc;
+801073cf:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+801073d5:	e8 66 0f 00 00       	call   80108340 <popcli>
+  return mycpu()-cpus;
+801073da:	e8 61 f8 ff ff       	call   80106c40 <mycpu>
+  if(!holding(&runq[cpuid()].lock))
+801073df:	83 ec 0c             	sub    $0xc,%esp
+  return mycpu()-cpus;
+801073e2:	2d 80 71 22 80       	sub    $0x80227180,%eax
+801073e7:	c1 f8 02             	sar    $0x2,%eax
+801073ea:	69 c0 cf 46 7d 67    	imul   $0x677d46cf,%eax,%eax
+  if(!holding(&runq[cpuid()].lock))
+801073f0:	8d 04 80             	lea    (%eax,%eax,4),%eax
+801073f3:	c1 e0 04             	shl    $0x4,%eax
+801073f6:	05 a0 87 22 80       	add    $0x802287a0,%eax
+801073fb:	50                   	push   %eax
+801073fc:	e8 ff 0b 00 00       	call   80108000 <holding>
+80107401:	83 c4 10             	add    $0x10,%esp
+80107404:	85 c0                	test   %eax,%eax
+80107406:	74 4f                	je     80107457 <sched+0x97>
+  if(mycpu()->ncli != 1)
+80107408:	e8 33 f8 ff ff       	call   80106c40 <mycpu>
+8010740d:	83 b8 a4 00 00 00 01 	cmpl   $0x1,0xa4(%eax)
+80107414:	75 68                	jne    8010747e <sched+0xbe>
+  if(p->state == RUNNING)
+80107416:	83 7b 0c 04          	cmpl   $0x4,0xc(%ebx)
+8010741a:	74 55                	je     80107471 <sched+0xb1>
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+8010741c:	9c                   	pushf
+8010741d:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+8010741e:	f6 c4 02             	test   $0x2,%ah
+80107421:	75 41                	jne    80107464 <sched+0xa4>
+  intena = mycpu()->intena;
+80107423:	e8 18 f8 ff ff       	call   80106c40 <mycpu>
+  swtch(&p->context, mycpu()->scheduler);
+80107428:	83 c3 1c             	add    $0x1c,%ebx
+  intena = mycpu()->intena;
+8010742b:	8b b0 a8 00 00 00    	mov    0xa8(%eax),%esi
+  swtch(&p->context, mycpu()->scheduler);
+80107431:	e8 0a f8 ff ff       	call   80106c40 <mycpu>
+80107436:	83 ec 08             	sub    $0x8,%esp
+80107439:	ff 70 04             	push   0x4(%eax)
+8010743c:	53                   	push   %ebx
+8010743d:	e8 59 12 00 00       	call   8010869b <swtch>
+  mycpu()->intena = intena;
+80107442:	e8 f9 f7 ff ff       	call   80106c40 <mycpu>
+}
+80107447:	83 c4 10             	add    $0x10,%esp
+  mycpu()->intena = intena;
+8010744a:	89 b0 a8 00 00 00    	mov    %esi,0xa8(%eax)
+}
+80107450:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107453:	5b                   	pop    %ebx
+80107454:	5e                   	pop    %esi
+80107455:	5d                   	pop    %ebp
+80107456:	c3                   	ret
+    panic("sched runq lock");
+80107457:	83 ec 0c             	sub    $0xc,%esp
+8010745a:	68 02 bd 10 80       	push   $0x8010bd02
+8010745f:	e8 fc 91 ff ff       	call   80100660 <panic>
+    panic("sched interruptible");
+80107464:	83 ec 0c             	sub    $0xc,%esp
+80107467:	68 2c bd 10 80       	push   $0x8010bd2c
+8010746c:	e8 ef 91 ff ff       	call   80100660 <panic>
+    panic("sched running");
+80107471:	83 ec 0c             	sub    $0xc,%esp
+80107474:	68 1e bd 10 80       	push   $0x8010bd1e
+80107479:	e8 e2 91 ff ff       	call   80100660 <panic>
+    panic("sched locks");
+8010747e:	83 ec 0c             	sub    $0xc,%esp
+80107481:	68 12 bd 10 80       	push   $0x8010bd12
+80107486:	e8 d5 91 ff ff       	call   80100660 <panic>
+8010748b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010748f:	90                   	nop
+
+80107490 <schedtick>:
+{
+80107490:	55                   	push   %ebp
+80107491:	89 e5                	mov    %esp,%ebp
+80107493:	56                   	push   %esi
+80107494:	53                   	push   %ebx
+  pushcli();
+80107495:	e8 76 0c 00 00       	call   80108110 <pushcli>
+  c = mycpu();
+8010749a:	e8 a1 f7 ff ff       	call   80106c40 <mycpu>
+  p = c->proc;
+8010749f:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+801074a5:	e8 96 0e 00 00       	call   80108340 <popcli>
+  p->ticks[p->level]++;
+801074aa:	8b 93 90 00 00 00    	mov    0x90(%ebx),%edx
+801074b0:	83 84 93 a4 00 00 00 	addl   $0x1,0xa4(%ebx,%edx,4)
+801074b7:	01 
+  if(++p->slice >= QUANTUM(p->level)){
+801074b8:	8b 83 94 00 00 00    	mov    0x94(%ebx),%eax
+801074be:	83 c0 01             	add    $0x1,%eax
+801074c1:	89 83 94 00 00 00    	mov    %eax,0x94(%ebx)
+801074c7:	85 c0                	test   %eax,%eax
+801074c9:	7e 2d                	jle    801074f8 <schedtick+0x68>
+    if(p->level < NLEVEL-1)
+801074cb:	85 d2                	test   %edx,%edx
+801074cd:	78 19                	js     801074e8 <schedtick+0x58>
+    p->slice = 0;
+801074cf:	c7 83 94 00 00 00 00 	movl   $0x0,0x94(%ebx)
+801074d6:	00 00 00 
+    return 1;
+801074d9:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+801074de:	5b                   	pop    %ebx
+801074df:	89 d0                	mov    %edx,%eax
+801074e1:	5e                   	pop    %esi
+801074e2:	5d                   	pop    %ebp
+801074e3:	c3                   	ret
+801074e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      p->level++;
+801074e8:	83 c2 01             	add    $0x1,%edx
+801074eb:	89 93 90 00 00 00    	mov    %edx,0x90(%ebx)
+801074f1:	eb dc                	jmp    801074cf <schedtick+0x3f>
+801074f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801074f7:	90                   	nop
+  pushcli();
+801074f8:	e8 13 0c 00 00       	call   80108110 <pushcli>
+  return mycpu()-cpus;
+801074fd:	e8 3e f7 ff ff       	call   80106c40 <mycpu>
+80107502:	2d 80 71 22 80       	sub    $0x80227180,%eax
+80107507:	89 c6                	mov    %eax,%esi
+  popcli();
+80107509:	e8 32 0e 00 00       	call   80108340 <popcli>
+  for(i = 0; i < p->level; i++)
+8010750e:	8b 93 90 00 00 00    	mov    0x90(%ebx),%edx
+  return mycpu()-cpus;
+80107514:	c1 fe 02             	sar    $0x2,%esi
+80107517:	69 f6 cf 46 7d 67    	imul   $0x677d46cf,%esi,%esi
+  for(i = 0; i < p->level; i++)
+8010751d:	85 d2                	test   %edx,%edx
+8010751f:	7e 18                	jle    80107539 <schedtick+0xa9>
+    if(rq->head[i])
+80107521:	8d 04 b6             	lea    (%esi,%esi,4),%eax
+  return 0;
+80107524:	31 d2                	xor    %edx,%edx
+    if(rq->head[i])
+80107526:	c1 e0 04             	shl    $0x4,%eax
+80107529:	8b 80 e0 87 22 80    	mov    -0x7fdd7820(%eax),%eax
+8010752f:	85 c0                	test   %eax,%eax
+80107531:	75 a6                	jne    801074d9 <schedtick+0x49>
+}
+80107533:	5b                   	pop    %ebx
+80107534:	89 d0                	mov    %edx,%eax
+80107536:	5e                   	pop    %esi
+80107537:	5d                   	pop    %ebp
+80107538:	c3                   	ret
+  return 0;
+80107539:	31 d2                	xor    %edx,%edx
+8010753b:	eb a1                	jmp    801074de <schedtick+0x4e>
+8010753d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107540 <yield>:
+{
+80107540:	55                   	push   %ebp
+80107541:	89 e5                	mov    %esp,%ebp
+80107543:	57                   	push   %edi
+80107544:	56                   	push   %esi
+80107545:	53                   	push   %ebx
+80107546:	83 ec 1c             	sub    $0x1c,%esp
+  pushcli();
+80107549:	e8 c2 0b 00 00       	call   80108110 <pushcli>
+  c = mycpu();
+8010754e:	e8 ed f6 ff ff       	call   80106c40 <mycpu>
+  p = c->proc;
+80107553:	8b b8 ac 00 00 00    	mov    0xac(%eax),%edi
+  popcli();
+80107559:	e8 e2 0d 00 00       	call   80108340 <popcli>
+  pushcli();
+8010755e:	e8 ad 0b 00 00       	call   80108110 <pushcli>
+  return mycpu()-cpus;
+80107563:	e8 d8 f6 ff ff       	call   80106c40 <mycpu>
+  acquire(&rq->lock);
+80107568:	83 ec 0c             	sub    $0xc,%esp
+  return mycpu()-cpus;
+8010756b:	2d 80 71 22 80       	sub    $0x80227180,%eax
+80107570:	89 c3                	mov    %eax,%ebx
+80107572:	c1 fb 02             	sar    $0x2,%ebx
+80107575:	69 db cf 46 7d 67    	imul   $0x677d46cf,%ebx,%ebx
+  rq = &runq[cpuid()];
+8010757b:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+80107582:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+80107585:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80107588:	89 f2                	mov    %esi,%edx
+8010758a:	c1 e2 04             	shl    $0x4,%edx
+8010758d:	81 c2 a0 87 22 80    	add    $0x802287a0,%edx
+  acquire(&rq->lock);
+80107593:	52                   	push   %edx
+80107594:	e8 c7 0b 00 00       	call   80108160 <acquire>
+  popcli();
+80107599:	e8 a2 0d 00 00       	call   80108340 <popcli>
+  if(rq->tail[p->level])
+8010759e:	8b 87 90 00 00 00    	mov    0x90(%edi),%eax
+  p->state = RUNNABLE;
+801075a4:	c7 47 0c 03 00 00 00 	movl   $0x3,0xc(%edi)
+  if(rq->tail[p->level])
+801075ab:	83 c4 10             	add    $0x10,%esp
+  p->rqnext = 0;
+801075ae:	c7 87 80 00 00 00 00 	movl   $0x0,0x80(%edi)
+801075b5:	00 00 00 
+  if(rq->tail[p->level])
+801075b8:	8d 34 b0             	lea    (%eax,%esi,4),%esi
+801075bb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801075be:	83 c6 10             	add    $0x10,%esi
+801075c1:	8b 14 b5 a4 87 22 80 	mov    -0x7fdd785c(,%esi,4),%edx
+801075c8:	85 d2                	test   %edx,%edx
+801075ca:	74 64                	je     80107630 <yield+0xf0>
+    rq->tail[p->level]->rqnext = p;
+801075cc:	89 ba 80 00 00 00    	mov    %edi,0x80(%edx)
+  rq->tail[p->level] = p;
+801075d2:	01 d8                	add    %ebx,%eax
+801075d4:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  rq->n++;
+801075db:	c1 e0 04             	shl    $0x4,%eax
+  rq->tail[p->level] = p;
+801075de:	03 97 90 00 00 00    	add    0x90(%edi),%edx
+801075e4:	89 3c 95 e4 87 22 80 	mov    %edi,-0x7fdd781c(,%edx,4)
+  rq->n++;
+801075eb:	83 80 e8 87 22 80 01 	addl   $0x1,-0x7fdd7818(%eax)
+  sched();
+801075f2:	e8 c9 fd ff ff       	call   801073c0 <sched>
+  return mycpu()-cpus;
+801075f7:	e8 44 f6 ff ff       	call   80106c40 <mycpu>
+  release(&runq[cpuid()].lock);
+801075fc:	83 ec 0c             	sub    $0xc,%esp
+  return mycpu()-cpus;
+801075ff:	2d 80 71 22 80       	sub    $0x80227180,%eax
+80107604:	c1 f8 02             	sar    $0x2,%eax
+80107607:	69 c0 cf 46 7d 67    	imul   $0x677d46cf,%eax,%eax
+  release(&runq[cpuid()].lock);
+8010760d:	8d 04 80             	lea    (%eax,%eax,4),%eax
+80107610:	c1 e0 04             	shl    $0x4,%eax
+80107613:	05 a0 87 22 80       	add    $0x802287a0,%eax
+80107618:	50                   	push   %eax
+80107619:	e8 82 0d 00 00       	call   801083a0 <release>
+}
+8010761e:	83 c4 10             	add    $0x10,%esp
+80107621:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107624:	5b                   	pop    %ebx
+80107625:	5e                   	pop    %esi
+80107626:	5f                   	pop    %edi
+80107627:	5d                   	pop    %ebp
+80107628:	c3                   	ret
+80107629:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    rq->head[p->level] = p;
+80107630:	89 3c b5 a0 87 22 80 	mov    %edi,-0x7fdd7860(,%esi,4)
+80107637:	eb 99                	jmp    801075d2 <yield+0x92>
+80107639:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107640 <sleep>:
+
+// Atomically release lock and sleep on chan.
+// Reacquires lock when awakened.
+void
+sleep(void *chan, struct spinlock *lk)
+{
+80107640:	55                   	push   %ebp
+80107641:	89 e5                	mov    %esp,%ebp
+80107643:	57                   	push   %edi
+80107644:	56                   	push   %esi
+80107645:	53                   	push   %ebx
+80107646:	83 ec 1c             	sub    $0x1c,%esp
+80107649:	8b 45 08             	mov    0x8(%ebp),%eax
+8010764c:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010764f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  pushcli();
+80107652:	e8 b9 0a 00 00       	call   80108110 <pushcli>
+  c = mycpu();
+80107657:	e8 e4 f5 ff ff       	call   80106c40 <mycpu>
+  p = c->proc;
+8010765c:	8b b8 ac 00 00 00    	mov    0xac(%eax),%edi
+  popcli();
+80107662:	e8 d9 0c 00 00       	call   80108340 <popcli>
+  struct proc *p = myproc();
+  struct waitq *wq;
+  
+  if(p == 0)
+80107667:	85 ff                	test   %edi,%edi
+80107669:	0f 84 ce 00 00 00    	je     8010773d <sleep+0xfd>
+    panic("sleep");
+
+  if(lk == 0)
+8010766f:	85 f6                	test   %esi,%esi
+80107671:	0f 84 d3 00 00 00    	je     8010774a <sleep+0x10a>
+  // Must acquire chan's wait queue lock in order to
+  // change p->state.
+  // Once we hold it, we can be guaranteed that we
+  // won't miss any wakeup (wakeup runs with it
+  // locked), so it's okay to release lk.
+  wq = WAITQ(chan);
+80107677:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+8010767a:	b8 3f c5 25 43       	mov    $0x4325c53f,%eax
+  acquire(&wq->lock);  //DOC: sleeplock1
+8010767f:	83 ec 0c             	sub    $0xc,%esp
+  wq = WAITQ(chan);
+80107682:	c1 eb 02             	shr    $0x2,%ebx
+80107685:	f7 e3                	mul    %ebx
+80107687:	c1 ea 04             	shr    $0x4,%edx
+8010768a:	6b c2 3d             	imul   $0x3d,%edx,%eax
+8010768d:	89 da                	mov    %ebx,%edx
+8010768f:	29 c2                	sub    %eax,%edx
+  acquire(&wq->lock);  //DOC: sleeplock1
+80107691:	6b da 44             	imul   $0x44,%edx,%ebx
+80107694:	81 c3 60 77 22 80    	add    $0x80227760,%ebx
+8010769a:	53                   	push   %ebx
+8010769b:	e8 c0 0a 00 00       	call   80108160 <acquire>
+  release(lk);
+801076a0:	89 34 24             	mov    %esi,(%esp)
+801076a3:	e8 f8 0c 00 00       	call   801083a0 <release>
+
+  // Go to sleep.
+  p->chan = chan;
+801076a8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  p->state = SLEEPING;
+  p->nsleep++;
+801076ab:	83 87 a0 00 00 00 01 	addl   $0x1,0xa0(%edi)
+  p->state = SLEEPING;
+801076b2:	c7 47 0c 02 00 00 00 	movl   $0x2,0xc(%edi)
+  p->chan = chan;
+801076b9:	89 47 20             	mov    %eax,0x20(%edi)
+  p->wqnext = wq->head;
+801076bc:	8b 43 40             	mov    0x40(%ebx),%eax
+801076bf:	89 87 84 00 00 00    	mov    %eax,0x84(%edi)
+  wq->head = p;
+801076c5:	89 7b 40             	mov    %edi,0x40(%ebx)
+  pushcli();
+801076c8:	e8 43 0a 00 00       	call   80108110 <pushcli>
+  return mycpu()-cpus;
+801076cd:	e8 6e f5 ff ff       	call   80106c40 <mycpu>
+801076d2:	2d 80 71 22 80       	sub    $0x80227180,%eax
+801076d7:	c1 f8 02             	sar    $0x2,%eax
+801076da:	69 c0 cf 46 7d 67    	imul   $0x677d46cf,%eax,%eax
+  rq = &runq[cpuid()];
+801076e0:	8d 04 80             	lea    (%eax,%eax,4),%eax
+801076e3:	c1 e0 04             	shl    $0x4,%eax
+801076e6:	05 a0 87 22 80       	add    $0x802287a0,%eax
+  acquire(&rq->lock);
+801076eb:	89 04 24             	mov    %eax,(%esp)
+801076ee:	e8 6d 0a 00 00       	call   80108160 <acquire>
+  popcli();
+801076f3:	e8 48 0c 00 00       	call   80108340 <popcli>
+
+  // A wakeup after we release wq->lock has to enqueue
+  // p on this CPU's run queue, so it waits until sched()
+  // has switched away.
+  lockmyrunq();
+  release(&wq->lock);
+801076f8:	89 1c 24             	mov    %ebx,(%esp)
+801076fb:	e8 a0 0c 00 00       	call   801083a0 <release>
+  sched();
+80107700:	e8 bb fc ff ff       	call   801073c0 <sched>
+  return mycpu()-cpus;
+80107705:	e8 36 f5 ff ff       	call   80106c40 <mycpu>
+8010770a:	2d 80 71 22 80       	sub    $0x80227180,%eax
+8010770f:	c1 f8 02             	sar    $0x2,%eax
+80107712:	69 c0 cf 46 7d 67    	imul   $0x677d46cf,%eax,%eax
+  release(&runq[cpuid()].lock);
+80107718:	8d 04 80             	lea    (%eax,%eax,4),%eax
+8010771b:	c1 e0 04             	shl    $0x4,%eax
+8010771e:	05 a0 87 22 80       	add    $0x802287a0,%eax
+80107723:	89 04 24             	mov    %eax,(%esp)
+80107726:	e8 75 0c 00 00       	call   801083a0 <release>
+
+  // Reacquire original lock.
+  acquire(lk);  //DOC: sleeplock2
+8010772b:	89 75 08             	mov    %esi,0x8(%ebp)
+8010772e:	83 c4 10             	add    $0x10,%esp
+}
+80107731:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107734:	5b                   	pop    %ebx
+80107735:	5e                   	pop    %esi
+80107736:	5f                   	pop    %edi
+80107737:	5d                   	pop    %ebp
+  acquire(lk);  //DOC: sleeplock2
+80107738:	e9 23 0a 00 00       	jmp    80108160 <acquire>
+    panic("sleep");
+8010773d:	83 ec 0c             	sub    $0xc,%esp
+80107740:	68 40 bd 10 80       	push   $0x8010bd40
+80107745:	e8 16 8f ff ff       	call   80100660 <panic>
+    panic("sleep without lk");
+8010774a:	83 ec 0c             	sub    $0xc,%esp
+8010774d:	68 46 bd 10 80       	push   $0x8010bd46
+80107752:	e8 09 8f ff ff       	call   80100660 <panic>
+80107757:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010775e:	66 90                	xchg   %ax,%ax
+
+80107760 <wait>:
+{
+80107760:	55                   	push   %ebp
+80107761:	89 e5                	mov    %esp,%ebp
+80107763:	56                   	push   %esi
+80107764:	53                   	push   %ebx
+  pushcli();
+80107765:	e8 a6 09 00 00       	call   80108110 <pushcli>
+  c = mycpu();
+8010776a:	e8 d1 f4 ff ff       	call   80106c40 <mycpu>
+  p = c->proc;
+8010776f:	8b b0 ac 00 00 00    	mov    0xac(%eax),%esi
+  popcli();
+80107775:	e8 c6 0b 00 00       	call   80108340 <popcli>
+  acquire(&ptable.lock);
+8010777a:	83 ec 0c             	sub    $0xc,%esp
+8010777d:	68 20 8a 22 80       	push   $0x80228a20
+80107782:	e8 d9 09 00 00       	call   80108160 <acquire>
+80107787:	83 c4 10             	add    $0x10,%esp
+    havekids = 0;
+8010778a:	31 c0                	xor    %eax,%eax
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+8010778c:	bb 60 8a 22 80       	mov    $0x80228a60,%ebx
+80107791:	eb 13                	jmp    801077a6 <wait+0x46>
+80107793:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107797:	90                   	nop
+80107798:	81 c3 b4 00 00 00    	add    $0xb4,%ebx
+8010779e:	81 fb 60 3e 23 80    	cmp    $0x80233e60,%ebx
+801077a4:	74 1e                	je     801077c4 <wait+0x64>
+      if(p->parent != curproc)
+801077a6:	39 73 14             	cmp    %esi,0x14(%ebx)
+801077a9:	75 ed                	jne    80107798 <wait+0x38>
+      if(p->state == ZOMBIE){
+801077ab:	83 7b 0c 05          	cmpl   $0x5,0xc(%ebx)
+801077af:	74 3f                	je     801077f0 <wait+0x90>
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+801077b1:	81 c3 b4 00 00 00    	add    $0xb4,%ebx
+      havekids = 1;
+801077b7:	b8 01 00 00 00       	mov    $0x1,%eax
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+801077bc:	81 fb 60 3e 23 80    	cmp    $0x80233e60,%ebx
+801077c2:	75 e2                	jne    801077a6 <wait+0x46>
+    if(!havekids || curproc->killed){
+801077c4:	85 c0                	test   %eax,%eax
+801077c6:	0f 84 a5 00 00 00    	je     80107871 <wait+0x111>
+801077cc:	8b 46 24             	mov    0x24(%esi),%eax
+801077cf:	85 c0                	test   %eax,%eax
+801077d1:	0f 85 9a 00 00 00    	jne    80107871 <wait+0x111>
+    sleep(curproc, &ptable.lock);  //DOC: wait-sleep
+801077d7:	83 ec 08             	sub    $0x8,%esp
+801077da:	68 20 8a 22 80       	push   $0x80228a20
+801077df:	56                   	push   %esi
+801077e0:	e8 5b fe ff ff       	call   80107640 <sleep>
+    havekids = 0;
+801077e5:	83 c4 10             	add    $0x10,%esp
+801077e8:	eb a0                	jmp    8010778a <wait+0x2a>
+801077ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        acquire(&runq[p->cpu].lock);
+801077f0:	8b 43 7c             	mov    0x7c(%ebx),%eax
+801077f3:	83 ec 0c             	sub    $0xc,%esp
+801077f6:	8d 04 80             	lea    (%eax,%eax,4),%eax
+801077f9:	c1 e0 04             	shl    $0x4,%eax
+801077fc:	05 a0 87 22 80       	add    $0x802287a0,%eax
+80107801:	50                   	push   %eax
+80107802:	e8 59 09 00 00       	call   80108160 <acquire>
+        release(&runq[p->cpu].lock);
+80107807:	8b 43 7c             	mov    0x7c(%ebx),%eax
+8010780a:	8d 04 80             	lea    (%eax,%eax,4),%eax
+8010780d:	c1 e0 04             	shl    $0x4,%eax
+80107810:	05 a0 87 22 80       	add    $0x802287a0,%eax
+80107815:	89 04 24             	mov    %eax,(%esp)
+80107818:	e8 83 0b 00 00       	call   801083a0 <release>
+        kfree(p->kstack);
+8010781d:	5a                   	pop    %edx
+        pid = p->pid;
+8010781e:	8b 73 10             	mov    0x10(%ebx),%esi
+        kfree(p->kstack);
+80107821:	ff 73 08             	push   0x8(%ebx)
+80107824:	e8 07 d1 ff ff       	call   80104930 <kfree>
+        p->kstack = 0;
+80107829:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+        freevm(p->pgdir);
+80107830:	59                   	pop    %ecx
+80107831:	ff 73 04             	push   0x4(%ebx)
+80107834:	e8 27 38 00 00       	call   8010b060 <freevm>
+        p->pid = 0;
+80107839:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+        p->parent = 0;
+80107840:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+        p->name[0] = 0;
+80107847:	c6 43 6c 00          	movb   $0x0,0x6c(%ebx)
+        p->killed = 0;
+8010784b:	c7 43 24 00 00 00 00 	movl   $0x0,0x24(%ebx)
+        p->state = UNUSED;
+80107852:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+        release(&ptable.lock);
+80107859:	c7 04 24 20 8a 22 80 	movl   $0x80228a20,(%esp)
+80107860:	e8 3b 0b 00 00       	call   801083a0 <release>
+        return pid;
+80107865:	83 c4 10             	add    $0x10,%esp
+}
+80107868:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010786b:	89 f0                	mov    %esi,%eax
+8010786d:	5b                   	pop    %ebx
+8010786e:	5e                   	pop    %esi
+8010786f:	5d                   	pop    %ebp
+80107870:	c3                   	ret
+      release(&ptable.lock);
+80107871:	83 ec 0c             	sub    $0xc,%esp
+      return -1;
+80107874:	be ff ff ff ff       	mov    $0xffffffff,%esi
+      release(&ptable.lock);
+80107879:	68 20 8a 22 80       	push   $0x80228a20
+8010787e:	e8 1d 0b 00 00       	call   801083a0 <release>
+      return -1;
+80107883:	83 c4 10             	add    $0x10,%esp
+80107886:	eb e0                	jmp    80107868 <wait+0x108>
+80107888:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010788f:	90                   	nop
+
+80107890 <wakeup>:
+}
+
+// Wake up all processes sleeping on chan.
+void
+wakeup(void *chan)
+{
+80107890:	55                   	push   %ebp
+  struct waitq *wq = WAITQ(chan);
+80107891:	b8 3f c5 25 43       	mov    $0x4325c53f,%eax
+{
+80107896:	89 e5                	mov    %esp,%ebp
+80107898:	57                   	push   %edi
+80107899:	56                   	push   %esi
+8010789a:	53                   	push   %ebx
+8010789b:	83 ec 18             	sub    $0x18,%esp
+8010789e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct waitq *wq = WAITQ(chan);
+801078a1:	89 f9                	mov    %edi,%ecx
+801078a3:	c1 e9 02             	shr    $0x2,%ecx
+801078a6:	f7 e1                	mul    %ecx
+801078a8:	c1 ea 04             	shr    $0x4,%edx
+801078ab:	6b c2 3d             	imul   $0x3d,%edx,%eax
+801078ae:	29 c1                	sub    %eax,%ecx
+
+  acquire(&wq->lock);
+801078b0:	6b d9 44             	imul   $0x44,%ecx,%ebx
+801078b3:	8d b3 60 77 22 80    	lea    -0x7fdd88a0(%ebx),%esi
+  for(pp = &wq->head; (q = *pp) != 0; ){
+801078b9:	81 c3 a0 77 22 80    	add    $0x802277a0,%ebx
+  acquire(&wq->lock);
+801078bf:	56                   	push   %esi
+801078c0:	e8 9b 08 00 00       	call   80108160 <acquire>
+  for(pp = &wq->head; (q = *pp) != 0; ){
+801078c5:	8b 46 40             	mov    0x40(%esi),%eax
+801078c8:	83 c4 10             	add    $0x10,%esp
+801078cb:	85 c0                	test   %eax,%eax
+801078cd:	75 15                	jne    801078e4 <wakeup+0x54>
+801078cf:	eb 32                	jmp    80107903 <wakeup+0x73>
+801078d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      pp = &q->wqnext;
+801078d8:	8d 98 84 00 00 00    	lea    0x84(%eax),%ebx
+  for(pp = &wq->head; (q = *pp) != 0; ){
+801078de:	8b 03                	mov    (%ebx),%eax
+801078e0:	85 c0                	test   %eax,%eax
+801078e2:	74 1f                	je     80107903 <wakeup+0x73>
+    if(q->chan == chan && (p == 0 || q == p)){
+801078e4:	3b 78 20             	cmp    0x20(%eax),%edi
+801078e7:	75 ef                	jne    801078d8 <wakeup+0x48>
+      *pp = q->wqnext;
+801078e9:	8b 90 84 00 00 00    	mov    0x84(%eax),%edx
+801078ef:	89 13                	mov    %edx,(%ebx)
+      q->chan = 0;
+801078f1:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+      enqueue(q);
+801078f8:	e8 d3 f1 ff ff       	call   80106ad0 <enqueue>
+  for(pp = &wq->head; (q = *pp) != 0; ){
+801078fd:	8b 03                	mov    (%ebx),%eax
+801078ff:	85 c0                	test   %eax,%eax
+80107901:	75 e1                	jne    801078e4 <wakeup+0x54>
+  wakeup1(wq, chan, 0);
+  release(&wq->lock);
+80107903:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80107906:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107909:	5b                   	pop    %ebx
+8010790a:	5e                   	pop    %esi
+8010790b:	5f                   	pop    %edi
+8010790c:	5d                   	pop    %ebp
+  release(&wq->lock);
+8010790d:	e9 8e 0a 00 00       	jmp    801083a0 <release>
+80107912:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107919:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107920 <exit>:
+{
+80107920:	55                   	push   %ebp
+80107921:	89 e5                	mov    %esp,%ebp
+80107923:	57                   	push   %edi
+80107924:	56                   	push   %esi
+80107925:	53                   	push   %ebx
+80107926:	83 ec 0c             	sub    $0xc,%esp
+  struct proc *curproc = myproc();
+80107929:	e8 42 f5 ff ff       	call   80106e70 <myproc>
+  if(curproc == initproc)
+8010792e:	39 05 60 3e 23 80    	cmp    %eax,0x80233e60
+80107934:	0f 84 fe 00 00 00    	je     80107a38 <exit+0x118>
+8010793a:	89 c6                	mov    %eax,%esi
+8010793c:	8d 58 28             	lea    0x28(%eax),%ebx
+8010793f:	8d 78 68             	lea    0x68(%eax),%edi
+80107942:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(curproc->ofile[fd]){
+80107948:	8b 03                	mov    (%ebx),%eax
+8010794a:	85 c0                	test   %eax,%eax
+8010794c:	74 12                	je     80107960 <exit+0x40>
+      fileclose(curproc->ofile[fd]);
+8010794e:	83 ec 0c             	sub    $0xc,%esp
+80107951:	50                   	push   %eax
+80107952:	e8 c9 9a ff ff       	call   80101420 <fileclose>
+      curproc->ofile[fd] = 0;
+80107957:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+8010795d:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++){
+80107960:	83 c3 04             	add    $0x4,%ebx
+80107963:	39 fb                	cmp    %edi,%ebx
+80107965:	75 e1                	jne    80107948 <exit+0x28>
+  begin_op();
+80107967:	e8 54 e1 ff ff       	call   80105ac0 <begin_op>
+  iput(curproc->cwd);
+8010796c:	83 ec 0c             	sub    $0xc,%esp
+8010796f:	ff 76 68             	push   0x68(%esi)
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80107972:	bb 60 8a 22 80       	mov    $0x80228a60,%ebx
+  iput(curproc->cwd);
+80107977:	e8 f4 b1 ff ff       	call   80102b70 <iput>
+  end_op();
+8010797c:	e8 6f e1 ff ff       	call   80105af0 <end_op>
+  curproc->cwd = 0;
+80107981:	c7 46 68 00 00 00 00 	movl   $0x0,0x68(%esi)
+  acquire(&ptable.lock);
+80107988:	c7 04 24 20 8a 22 80 	movl   $0x80228a20,(%esp)
+8010798f:	e8 cc 07 00 00       	call   80108160 <acquire>
+  wakeup(curproc->parent);
+80107994:	58                   	pop    %eax
+80107995:	ff 76 14             	push   0x14(%esi)
+80107998:	e8 f3 fe ff ff       	call   80107890 <wakeup>
+8010799d:	83 c4 10             	add    $0x10,%esp
+801079a0:	eb 14                	jmp    801079b6 <exit+0x96>
+801079a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+801079a8:	81 c3 b4 00 00 00    	add    $0xb4,%ebx
+801079ae:	81 fb 60 3e 23 80    	cmp    $0x80233e60,%ebx
+801079b4:	74 2d                	je     801079e3 <exit+0xc3>
+    if(p->parent == curproc){
+801079b6:	39 73 14             	cmp    %esi,0x14(%ebx)
+801079b9:	75 ed                	jne    801079a8 <exit+0x88>
+      p->parent = initproc;
+801079bb:	a1 60 3e 23 80       	mov    0x80233e60,%eax
+      if(p->state == ZOMBIE)
+801079c0:	83 7b 0c 05          	cmpl   $0x5,0xc(%ebx)
+      p->parent = initproc;
+801079c4:	89 43 14             	mov    %eax,0x14(%ebx)
+      if(p->state == ZOMBIE)
+801079c7:	75 df                	jne    801079a8 <exit+0x88>
+        wakeup(initproc);
+801079c9:	83 ec 0c             	sub    $0xc,%esp
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+801079cc:	81 c3 b4 00 00 00    	add    $0xb4,%ebx
+        wakeup(initproc);
+801079d2:	50                   	push   %eax
+801079d3:	e8 b8 fe ff ff       	call   80107890 <wakeup>
+801079d8:	83 c4 10             	add    $0x10,%esp
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+801079db:	81 fb 60 3e 23 80    	cmp    $0x80233e60,%ebx
+801079e1:	75 d3                	jne    801079b6 <exit+0x96>
+  curproc->state = ZOMBIE;
+801079e3:	c7 46 0c 05 00 00 00 	movl   $0x5,0xc(%esi)
+  pushcli();
+801079ea:	e8 21 07 00 00       	call   80108110 <pushcli>
+  return mycpu()-cpus;
+801079ef:	e8 4c f2 ff ff       	call   80106c40 <mycpu>
+  acquire(&rq->lock);
+801079f4:	83 ec 0c             	sub    $0xc,%esp
+  return mycpu()-cpus;
+801079f7:	2d 80 71 22 80       	sub    $0x80227180,%eax
+801079fc:	c1 f8 02             	sar    $0x2,%eax
+801079ff:	69 c0 cf 46 7d 67    	imul   $0x677d46cf,%eax,%eax
+  rq = &runq[cpuid()];
+80107a05:	8d 04 80             	lea    (%eax,%eax,4),%eax
+80107a08:	c1 e0 04             	shl    $0x4,%eax
+80107a0b:	05 a0 87 22 80       	add    $0x802287a0,%eax
+  acquire(&rq->lock);
+80107a10:	50                   	push   %eax
+80107a11:	e8 4a 07 00 00       	call   80108160 <acquire>
+  popcli();
+80107a16:	e8 25 09 00 00       	call   80108340 <popcli>
+  release(&ptable.lock);
+80107a1b:	c7 04 24 20 8a 22 80 	movl   $0x80228a20,(%esp)
+80107a22:	e8 79 09 00 00       	call   801083a0 <release>
+  sched();
+80107a27:	e8 94 f9 ff ff       	call   801073c0 <sched>
+  panic("zombie exit");
+80107a2c:	c7 04 24 64 bd 10 80 	movl   $0x8010bd64,(%esp)
+80107a33:	e8 28 8c ff ff       	call   80100660 <panic>
+    panic("init exiting");
+80107a38:	83 ec 0c             	sub    $0xc,%esp
+80107a3b:	68 57 bd 10 80       	push   $0x8010bd57
+80107a40:	e8 1b 8c ff ff       	call   80100660 <panic>
+80107a45:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107a4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80107a50 <kill>:
+// Kill the process with the given pid.
+// Process won't exit until it returns
+// to user space (see trap in trap.c).
+int
+kill(int pid)
+{
+80107a50:	55                   	push   %ebp
+80107a51:	89 e5                	mov    %esp,%ebp
+80107a53:	57                   	push   %edi
+80107a54:	56                   	push   %esi
+80107a55:	53                   	push   %ebx
+  struct proc *p;
+  struct waitq *wq;
+  void *chan;
+
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80107a56:	bb 60 8a 22 80       	mov    $0x80228a60,%ebx
+{
+80107a5b:	83 ec 28             	sub    $0x28,%esp
+80107a5e:	8b 75 08             	mov    0x8(%ebp),%esi
+  acquire(&ptable.lock);
+80107a61:	68 20 8a 22 80       	push   $0x80228a20
+80107a66:	e8 f5 06 00 00       	call   80108160 <acquire>
+80107a6b:	83 c4 10             	add    $0x10,%esp
+80107a6e:	eb 0e                	jmp    80107a7e <kill+0x2e>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80107a70:	81 c3 b4 00 00 00    	add    $0xb4,%ebx
+80107a76:	81 fb 60 3e 23 80    	cmp    $0x80233e60,%ebx
+80107a7c:	74 7a                	je     80107af8 <kill+0xa8>
+    if(p->pid == pid){
+80107a7e:	39 73 10             	cmp    %esi,0x10(%ebx)
+80107a81:	75 ed                	jne    80107a70 <kill+0x20>
+      // Kernel processes have no user memory and never
+      // return to user space to die; leave them alone.
+      if(p->sz == 0)
+80107a83:	8b 03                	mov    (%ebx),%eax
+80107a85:	85 c0                	test   %eax,%eax
+80107a87:	74 6f                	je     80107af8 <kill+0xa8>
+        break;
+      p->killed = 1;
+      // Wake process from sleep if necessary.  It is
+      // asleep on chan only if its bucket still says so.
+      if((chan = p->chan) != 0){
+80107a89:	8b 7b 20             	mov    0x20(%ebx),%edi
+      p->killed = 1;
+80107a8c:	c7 43 24 01 00 00 00 	movl   $0x1,0x24(%ebx)
+      if((chan = p->chan) != 0){
+80107a93:	85 ff                	test   %edi,%edi
+80107a95:	74 41                	je     80107ad8 <kill+0x88>
+        wq = WAITQ(chan);
+80107a97:	89 f9                	mov    %edi,%ecx
+80107a99:	b8 3f c5 25 43       	mov    $0x4325c53f,%eax
+        acquire(&wq->lock);
+80107a9e:	83 ec 0c             	sub    $0xc,%esp
+        wq = WAITQ(chan);
+80107aa1:	c1 e9 02             	shr    $0x2,%ecx
+80107aa4:	f7 e1                	mul    %ecx
+80107aa6:	c1 ea 04             	shr    $0x4,%edx
+80107aa9:	6b c2 3d             	imul   $0x3d,%edx,%eax
+80107aac:	29 c1                	sub    %eax,%ecx
+        acquire(&wq->lock);
+80107aae:	6b f1 44             	imul   $0x44,%ecx,%esi
+80107ab1:	8d 96 60 77 22 80    	lea    -0x7fdd88a0(%esi),%edx
+80107ab7:	52                   	push   %edx
+80107ab8:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80107abb:	e8 a0 06 00 00       	call   80108160 <acquire>
+        if(p->state == SLEEPING && p->chan == chan)
+80107ac0:	83 c4 10             	add    $0x10,%esp
+80107ac3:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+80107ac7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80107aca:	74 49                	je     80107b15 <kill+0xc5>
+          wakeup1(wq, chan, p);
+        release(&wq->lock);
+80107acc:	83 ec 0c             	sub    $0xc,%esp
+80107acf:	52                   	push   %edx
+80107ad0:	e8 cb 08 00 00       	call   801083a0 <release>
+80107ad5:	83 c4 10             	add    $0x10,%esp
+      }
+      release(&ptable.lock);
+80107ad8:	83 ec 0c             	sub    $0xc,%esp
+80107adb:	68 20 8a 22 80       	push   $0x80228a20
+80107ae0:	e8 bb 08 00 00       	call   801083a0 <release>
+      return 0;
+80107ae5:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+80107ae8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+80107aeb:	31 c0                	xor    %eax,%eax
+}
+80107aed:	5b                   	pop    %ebx
+80107aee:	5e                   	pop    %esi
+80107aef:	5f                   	pop    %edi
+80107af0:	5d                   	pop    %ebp
+80107af1:	c3                   	ret
+80107af2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  release(&ptable.lock);
+80107af8:	83 ec 0c             	sub    $0xc,%esp
+80107afb:	68 20 8a 22 80       	push   $0x80228a20
+80107b00:	e8 9b 08 00 00       	call   801083a0 <release>
+  return -1;
+80107b05:	83 c4 10             	add    $0x10,%esp
+}
+80107b08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return -1;
+80107b0b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80107b10:	5b                   	pop    %ebx
+80107b11:	5e                   	pop    %esi
+80107b12:	5f                   	pop    %edi
+80107b13:	5d                   	pop    %ebp
+80107b14:	c3                   	ret
+        if(p->state == SLEEPING && p->chan == chan)
+80107b15:	39 7b 20             	cmp    %edi,0x20(%ebx)
+80107b18:	75 b2                	jne    80107acc <kill+0x7c>
+  for(pp = &wq->head; (q = *pp) != 0; ){
+80107b1a:	8b 42 40             	mov    0x40(%edx),%eax
+80107b1d:	81 c6 a0 77 22 80    	add    $0x802277a0,%esi
+80107b23:	85 c0                	test   %eax,%eax
+80107b25:	75 15                	jne    80107b3c <kill+0xec>
+80107b27:	eb a3                	jmp    80107acc <kill+0x7c>
+80107b29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      pp = &q->wqnext;
+80107b30:	8d b0 84 00 00 00    	lea    0x84(%eax),%esi
+  for(pp = &wq->head; (q = *pp) != 0; ){
+80107b36:	8b 06                	mov    (%esi),%eax
+80107b38:	85 c0                	test   %eax,%eax
+80107b3a:	74 90                	je     80107acc <kill+0x7c>
+    if(q->chan == chan && (p == 0 || q == p)){
+80107b3c:	3b 78 20             	cmp    0x20(%eax),%edi
+80107b3f:	75 ef                	jne    80107b30 <kill+0xe0>
+80107b41:	39 d8                	cmp    %ebx,%eax
+80107b43:	75 eb                	jne    80107b30 <kill+0xe0>
+      *pp = q->wqnext;
+80107b45:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+80107b4b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80107b4e:	89 06                	mov    %eax,(%esi)
+      enqueue(q);
+80107b50:	89 d8                	mov    %ebx,%eax
+      q->chan = 0;
+80107b52:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+      enqueue(q);
+80107b59:	e8 72 ef ff ff       	call   80106ad0 <enqueue>
+80107b5e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80107b61:	eb d3                	jmp    80107b36 <kill+0xe6>
+80107b63:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107b6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107b70 <getpstat>:
+// Copy the scheduling statistics of process pid into *ps.
+// *ps is user memory, which may fault on a copy-on-write page,
+// so it is only written after ptable.lock is released.
+int
+getpstat(int pid, struct pstat *ps)
+{
+80107b70:	55                   	push   %ebp
+80107b71:	89 e5                	mov    %esp,%ebp
+80107b73:	57                   	push   %edi
+80107b74:	56                   	push   %esi
+80107b75:	53                   	push   %ebx
+80107b76:	83 ec 28             	sub    $0x28,%esp
+80107b79:	8b 75 08             	mov    0x8(%ebp),%esi
+80107b7c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct proc *p;
+  struct pstat st;
+  int i;
+
+  acquire(&ptable.lock);
+80107b7f:	68 20 8a 22 80       	push   $0x80228a20
+80107b84:	e8 d7 05 00 00       	call   80108160 <acquire>
+80107b89:	83 c4 10             	add    $0x10,%esp
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80107b8c:	b8 60 8a 22 80       	mov    $0x80228a60,%eax
+80107b91:	eb 11                	jmp    80107ba4 <getpstat+0x34>
+80107b93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107b97:	90                   	nop
+80107b98:	05 b4 00 00 00       	add    $0xb4,%eax
+80107b9d:	3d 60 3e 23 80       	cmp    $0x80233e60,%eax
+80107ba2:	74 73                	je     80107c17 <getpstat+0xa7>
+    if(p->pid == pid && p->state != UNUSED){
+80107ba4:	39 70 10             	cmp    %esi,0x10(%eax)
+80107ba7:	75 ef                	jne    80107b98 <getpstat+0x28>
+80107ba9:	8b 50 0c             	mov    0xc(%eax),%edx
+80107bac:	85 d2                	test   %edx,%edx
+80107bae:	74 e8                	je     80107b98 <getpstat+0x28>
+      st.level = p->level;
+      st.nrun = p->nrun;
+80107bb0:	8b 90 9c 00 00 00    	mov    0x9c(%eax),%edx
+      st.level = p->level;
+80107bb6:	8b 88 90 00 00 00    	mov    0x90(%eax),%ecx
+      st.nsleep = p->nsleep;
+      for(i = 0; i < NMLFQ; i++)
+        st.ticks[i] = p->ticks[i];
+      release(&ptable.lock);
+80107bbc:	83 ec 0c             	sub    $0xc,%esp
+      st.nrun = p->nrun;
+80107bbf:	8b b8 a0 00 00 00    	mov    0xa0(%eax),%edi
+80107bc5:	8b b0 a4 00 00 00    	mov    0xa4(%eax),%esi
+80107bcb:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80107bce:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+80107bd4:	8b 80 ac 00 00 00    	mov    0xac(%eax),%eax
+      st.level = p->level;
+80107bda:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+      st.nrun = p->nrun;
+80107bdd:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80107be0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      release(&ptable.lock);
+80107be3:	68 20 8a 22 80       	push   $0x80228a20
+80107be8:	e8 b3 07 00 00       	call   801083a0 <release>
+      *ps = st;
+80107bed:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80107bf0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80107bf3:	89 7b 08             	mov    %edi,0x8(%ebx)
+80107bf6:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+80107bf9:	89 73 0c             	mov    %esi,0xc(%ebx)
+      return 0;
+80107bfc:	83 c4 10             	add    $0x10,%esp
+      *ps = st;
+80107bff:	89 53 04             	mov    %edx,0x4(%ebx)
+80107c02:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80107c05:	89 43 14             	mov    %eax,0x14(%ebx)
+      return 0;
+80107c08:	31 c0                	xor    %eax,%eax
+      *ps = st;
+80107c0a:	89 0b                	mov    %ecx,(%ebx)
+80107c0c:	89 53 10             	mov    %edx,0x10(%ebx)
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+80107c0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107c12:	5b                   	pop    %ebx
+80107c13:	5e                   	pop    %esi
+80107c14:	5f                   	pop    %edi
+80107c15:	5d                   	pop    %ebp
+80107c16:	c3                   	ret
+  release(&ptable.lock);
+80107c17:	83 ec 0c             	sub    $0xc,%esp
+80107c1a:	68 20 8a 22 80       	push   $0x80228a20
+80107c1f:	e8 7c 07 00 00       	call   801083a0 <release>
+  return -1;
+80107c24:	83 c4 10             	add    $0x10,%esp
+}
+80107c27:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return -1;
+80107c2a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80107c2f:	5b                   	pop    %ebx
+80107c30:	5e                   	pop    %esi
+80107c31:	5f                   	pop    %edi
+80107c32:	5d                   	pop    %ebp
+80107c33:	c3                   	ret
+80107c34:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107c3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107c3f:	90                   	nop
+
+80107c40 <procdump>:
+// CPU has been idle, to console.  For debugging.
+// Runs when user types ^P on console.
+// No lock to avoid wedging a stuck machine further.
+void
+procdump(void)
+{
+80107c40:	55                   	push   %ebp
+80107c41:	89 e5                	mov    %esp,%ebp
+80107c43:	57                   	push   %edi
+80107c44:	56                   	push   %esi
+80107c45:	8d 75 e8             	lea    -0x18(%ebp),%esi
+80107c48:	53                   	push   %ebx
+80107c49:	bb cc 8a 22 80       	mov    $0x80228acc,%ebx
+80107c4e:	83 ec 3c             	sub    $0x3c,%esp
+80107c51:	eb 23                	jmp    80107c76 <procdump+0x36>
+80107c53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107c57:	90                   	nop
+    if(p->state == SLEEPING){
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+      for(i=0; i<10 && pc[i] != 0; i++)
+        cprintf(" %p", pc[i]);
+    }
+    cprintf("\n");
+80107c58:	83 ec 0c             	sub    $0xc,%esp
+80107c5b:	68 bf c1 10 80       	push   $0x8010c1bf
+80107c60:	e8 2b 8d ff ff       	call   80100990 <cprintf>
+80107c65:	83 c4 10             	add    $0x10,%esp
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80107c68:	81 c3 b4 00 00 00    	add    $0xb4,%ebx
+80107c6e:	81 fb cc 3e 23 80    	cmp    $0x80233ecc,%ebx
+80107c74:	74 7d                	je     80107cf3 <procdump+0xb3>
+    if(p->state == UNUSED)
+80107c76:	8b 43 a0             	mov    -0x60(%ebx),%eax
+80107c79:	85 c0                	test   %eax,%eax
+80107c7b:	74 eb                	je     80107c68 <procdump+0x28>
+      state = "???";
+80107c7d:	ba 70 bd 10 80       	mov    $0x8010bd70,%edx
+    if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
+80107c82:	83 f8 05             	cmp    $0x5,%eax
+80107c85:	77 11                	ja     80107c98 <procdump+0x58>
+80107c87:	8b 14 85 ec bd 10 80 	mov    -0x7fef4214(,%eax,4),%edx
+      state = "???";
+80107c8e:	b8 70 bd 10 80       	mov    $0x8010bd70,%eax
+80107c93:	85 d2                	test   %edx,%edx
+80107c95:	0f 44 d0             	cmove  %eax,%edx
+    cprintf("%d %s %s", p->pid, state, p->name);
+80107c98:	53                   	push   %ebx
+80107c99:	52                   	push   %edx
+80107c9a:	ff 73 a4             	push   -0x5c(%ebx)
+80107c9d:	68 74 bd 10 80       	push   $0x8010bd74
+80107ca2:	e8 e9 8c ff ff       	call   80100990 <cprintf>
+    if(p->state == SLEEPING){
+80107ca7:	83 c4 10             	add    $0x10,%esp
+80107caa:	83 7b a0 02          	cmpl   $0x2,-0x60(%ebx)
+80107cae:	75 a8                	jne    80107c58 <procdump+0x18>
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+80107cb0:	83 ec 08             	sub    $0x8,%esp
+80107cb3:	8d 45 c0             	lea    -0x40(%ebp),%eax
+80107cb6:	8d 7d c0             	lea    -0x40(%ebp),%edi
+80107cb9:	50                   	push   %eax
+80107cba:	8b 43 b0             	mov    -0x50(%ebx),%eax
+80107cbd:	8b 40 0c             	mov    0xc(%eax),%eax
+80107cc0:	83 c0 08             	add    $0x8,%eax
+80107cc3:	50                   	push   %eax
+80107cc4:	e8 c7 02 00 00       	call   80107f90 <getcallerpcs>
+      for(i=0; i<10 && pc[i] != 0; i++)
+80107cc9:	83 c4 10             	add    $0x10,%esp
+80107ccc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107cd0:	8b 17                	mov    (%edi),%edx
+80107cd2:	85 d2                	test   %edx,%edx
+80107cd4:	74 82                	je     80107c58 <procdump+0x18>
+        cprintf(" %p", pc[i]);
+80107cd6:	83 ec 08             	sub    $0x8,%esp
+      for(i=0; i<10 && pc[i] != 0; i++)
+80107cd9:	83 c7 04             	add    $0x4,%edi
+        cprintf(" %p", pc[i]);
+80107cdc:	52                   	push   %edx
+80107cdd:	68 08 b7 10 80       	push   $0x8010b708
+80107ce2:	e8 a9 8c ff ff       	call   80100990 <cprintf>
+      for(i=0; i<10 && pc[i] != 0; i++)
+80107ce7:	83 c4 10             	add    $0x10,%esp
+80107cea:	39 f7                	cmp    %esi,%edi
+80107cec:	75 e2                	jne    80107cd0 <procdump+0x90>
+80107cee:	e9 65 ff ff ff       	jmp    80107c58 <procdump+0x18>
+  }
+  for(i = 0; i < ncpu; i++)
+80107cf3:	a1 64 71 22 80       	mov    0x80227164,%eax
+80107cf8:	85 c0                	test   %eax,%eax
+80107cfa:	7e 33                	jle    80107d2f <procdump+0xef>
+80107cfc:	be 34 72 22 80       	mov    $0x80227234,%esi
+80107d01:	31 db                	xor    %ebx,%ebx
+80107d03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107d07:	90                   	nop
+    cprintf("cpu%d: idle %d of %d ticks\n", i, cpus[i].idleticks,
+80107d08:	ff 36                	push   (%esi)
+  for(i = 0; i < ncpu; i++)
+80107d0a:	81 c6 bc 00 00 00    	add    $0xbc,%esi
+    cprintf("cpu%d: idle %d of %d ticks\n", i, cpus[i].idleticks,
+80107d10:	ff b6 48 ff ff ff    	push   -0xb8(%esi)
+80107d16:	53                   	push   %ebx
+  for(i = 0; i < ncpu; i++)
+80107d17:	83 c3 01             	add    $0x1,%ebx
+    cprintf("cpu%d: idle %d of %d ticks\n", i, cpus[i].idleticks,
+80107d1a:	68 7d bd 10 80       	push   $0x8010bd7d
+80107d1f:	e8 6c 8c ff ff       	call   80100990 <cprintf>
+  for(i = 0; i < ncpu; i++)
+80107d24:	83 c4 10             	add    $0x10,%esp
+80107d27:	39 1d 64 71 22 80    	cmp    %ebx,0x80227164
+80107d2d:	7f d9                	jg     80107d08 <procdump+0xc8>
+            cpus[i].nticks);
+}
+80107d2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107d32:	5b                   	pop    %ebx
+80107d33:	5e                   	pop    %esi
+80107d34:	5f                   	pop    %edi
+80107d35:	5d                   	pop    %ebp
+80107d36:	c3                   	ret
+80107d37:	66 90                	xchg   %ax,%ax
+80107d39:	66 90                	xchg   %ax,%ax
+80107d3b:	66 90                	xchg   %ax,%ax
+80107d3d:	66 90                	xchg   %ax,%ax
+80107d3f:	90                   	nop
+
+80107d40 <initsleeplock>:
+#include "spinlock.h"
+#include "sleeplock.h"
+
+void
+initsleeplock(struct sleeplock *lk, char *name)
+{
+80107d40:	55                   	push   %ebp
+80107d41:	89 e5                	mov    %esp,%ebp
+80107d43:	53                   	push   %ebx
+80107d44:	83 ec 0c             	sub    $0xc,%esp
+80107d47:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&lk->lk, "sleep lock");
+80107d4a:	68 04 be 10 80       	push   $0x8010be04
+80107d4f:	8d 43 0c             	lea    0xc(%ebx),%eax
+80107d52:	50                   	push   %eax
+80107d53:	e8 b8 01 00 00       	call   80107f10 <initlock>
+  lk->name = name;
+80107d58:	8b 45 0c             	mov    0xc(%ebp),%eax
+  lk->locked = 0;
+  lk->readers = 0;
+  lk->writers = 0;
+  lk->pid = 0;
+}
+80107d5b:	83 c4 10             	add    $0x10,%esp
+  lk->locked = 0;
+80107d5e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->readers = 0;
+80107d64:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  lk->name = name;
+80107d6b:	89 43 4c             	mov    %eax,0x4c(%ebx)
+  lk->writers = 0;
+80107d6e:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  lk->pid = 0;
+80107d75:	c7 43 50 00 00 00 00 	movl   $0x0,0x50(%ebx)
+}
+80107d7c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107d7f:	c9                   	leave
+80107d80:	c3                   	ret
+80107d81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107d88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107d8f:	90                   	nop
+
+80107d90 <acquiresleep>:
+
+void
+acquiresleep(struct sleeplock *lk)
+{
+80107d90:	55                   	push   %ebp
+80107d91:	89 e5                	mov    %esp,%ebp
+80107d93:	56                   	push   %esi
+80107d94:	53                   	push   %ebx
+80107d95:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+80107d98:	8d 73 0c             	lea    0xc(%ebx),%esi
+80107d9b:	83 ec 0c             	sub    $0xc,%esp
+80107d9e:	56                   	push   %esi
+80107d9f:	e8 bc 03 00 00       	call   80108160 <acquire>
+  lk->writers++;
+80107da4:	83 43 08 01          	addl   $0x1,0x8(%ebx)
+  while (lk->locked || lk->readers) {
+80107da8:	83 c4 10             	add    $0x10,%esp
+80107dab:	eb 10                	jmp    80107dbd <acquiresleep+0x2d>
+80107dad:	8d 76 00             	lea    0x0(%esi),%esi
+    sleep(lk, &lk->lk);
+80107db0:	83 ec 08             	sub    $0x8,%esp
+80107db3:	56                   	push   %esi
+80107db4:	53                   	push   %ebx
+80107db5:	e8 86 f8 ff ff       	call   80107640 <sleep>
+80107dba:	83 c4 10             	add    $0x10,%esp
+  while (lk->locked || lk->readers) {
+80107dbd:	8b 13                	mov    (%ebx),%edx
+80107dbf:	85 d2                	test   %edx,%edx
+80107dc1:	75 ed                	jne    80107db0 <acquiresleep+0x20>
+80107dc3:	8b 43 04             	mov    0x4(%ebx),%eax
+80107dc6:	85 c0                	test   %eax,%eax
+80107dc8:	75 e6                	jne    80107db0 <acquiresleep+0x20>
+  }
+  lk->writers--;
+80107dca:	83 6b 08 01          	subl   $0x1,0x8(%ebx)
+  lk->locked = 1;
+80107dce:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  lk->pid = myproc()->pid;
+80107dd4:	e8 97 f0 ff ff       	call   80106e70 <myproc>
+80107dd9:	8b 40 10             	mov    0x10(%eax),%eax
+80107ddc:	89 43 50             	mov    %eax,0x50(%ebx)
+  release(&lk->lk);
+80107ddf:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80107de2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107de5:	5b                   	pop    %ebx
+80107de6:	5e                   	pop    %esi
+80107de7:	5d                   	pop    %ebp
+  release(&lk->lk);
+80107de8:	e9 b3 05 00 00       	jmp    801083a0 <release>
+80107ded:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107df0 <releasesleep>:
+
+void
+releasesleep(struct sleeplock *lk)
+{
+80107df0:	55                   	push   %ebp
+80107df1:	89 e5                	mov    %esp,%ebp
+80107df3:	56                   	push   %esi
+80107df4:	53                   	push   %ebx
+80107df5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+80107df8:	8d 73 0c             	lea    0xc(%ebx),%esi
+80107dfb:	83 ec 0c             	sub    $0xc,%esp
+80107dfe:	56                   	push   %esi
+80107dff:	e8 5c 03 00 00       	call   80108160 <acquire>
+  lk->locked = 0;
+80107e04:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+80107e0a:	c7 43 50 00 00 00 00 	movl   $0x0,0x50(%ebx)
+  wakeup(lk);
+80107e11:	89 1c 24             	mov    %ebx,(%esp)
+80107e14:	e8 77 fa ff ff       	call   80107890 <wakeup>
+  release(&lk->lk);
+80107e19:	89 75 08             	mov    %esi,0x8(%ebp)
+80107e1c:	83 c4 10             	add    $0x10,%esp
+}
+80107e1f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107e22:	5b                   	pop    %ebx
+80107e23:	5e                   	pop    %esi
+80107e24:	5d                   	pop    %ebp
+  release(&lk->lk);
+80107e25:	e9 76 05 00 00       	jmp    801083a0 <release>
+80107e2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107e30 <acquiresleepread>:
+
+// Acquire lk shared with other readers.  Waits while a
+// process holds it exclusively or is waiting to.
+void
+acquiresleepread(struct sleeplock *lk)
+{
+80107e30:	55                   	push   %ebp
+80107e31:	89 e5                	mov    %esp,%ebp
+80107e33:	56                   	push   %esi
+80107e34:	53                   	push   %ebx
+80107e35:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+80107e38:	8d 73 0c             	lea    0xc(%ebx),%esi
+80107e3b:	83 ec 0c             	sub    $0xc,%esp
+80107e3e:	56                   	push   %esi
+80107e3f:	e8 1c 03 00 00       	call   80108160 <acquire>
+  while (lk->locked || lk->writers) {
+80107e44:	83 c4 10             	add    $0x10,%esp
+80107e47:	eb 14                	jmp    80107e5d <acquiresleepread+0x2d>
+80107e49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    sleep(lk, &lk->lk);
+80107e50:	83 ec 08             	sub    $0x8,%esp
+80107e53:	56                   	push   %esi
+80107e54:	53                   	push   %ebx
+80107e55:	e8 e6 f7 ff ff       	call   80107640 <sleep>
+80107e5a:	83 c4 10             	add    $0x10,%esp
+  while (lk->locked || lk->writers) {
+80107e5d:	8b 13                	mov    (%ebx),%edx
+80107e5f:	85 d2                	test   %edx,%edx
+80107e61:	75 ed                	jne    80107e50 <acquiresleepread+0x20>
+80107e63:	8b 43 08             	mov    0x8(%ebx),%eax
+80107e66:	85 c0                	test   %eax,%eax
+80107e68:	75 e6                	jne    80107e50 <acquiresleepread+0x20>
+  }
+  lk->readers++;
+80107e6a:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  release(&lk->lk);
+80107e6e:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80107e71:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107e74:	5b                   	pop    %ebx
+80107e75:	5e                   	pop    %esi
+80107e76:	5d                   	pop    %ebp
+  release(&lk->lk);
+80107e77:	e9 24 05 00 00       	jmp    801083a0 <release>
+80107e7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80107e80 <releasesleepread>:
+
+void
+releasesleepread(struct sleeplock *lk)
+{
+80107e80:	55                   	push   %ebp
+80107e81:	89 e5                	mov    %esp,%ebp
+80107e83:	56                   	push   %esi
+80107e84:	53                   	push   %ebx
+80107e85:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+80107e88:	8d 73 0c             	lea    0xc(%ebx),%esi
+80107e8b:	83 ec 0c             	sub    $0xc,%esp
+80107e8e:	56                   	push   %esi
+80107e8f:	e8 cc 02 00 00       	call   80108160 <acquire>
+  if(lk->readers == 0)
+80107e94:	8b 43 04             	mov    0x4(%ebx),%eax
+80107e97:	83 c4 10             	add    $0x10,%esp
+80107e9a:	85 c0                	test   %eax,%eax
+80107e9c:	74 34                	je     80107ed2 <releasesleepread+0x52>
+    panic("releasesleepread");
+  if(--lk->readers == 0)
+80107e9e:	83 e8 01             	sub    $0x1,%eax
+80107ea1:	89 43 04             	mov    %eax,0x4(%ebx)
+80107ea4:	74 12                	je     80107eb8 <releasesleepread+0x38>
+    wakeup(lk);
+  release(&lk->lk);
+80107ea6:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80107ea9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107eac:	5b                   	pop    %ebx
+80107ead:	5e                   	pop    %esi
+80107eae:	5d                   	pop    %ebp
+  release(&lk->lk);
+80107eaf:	e9 ec 04 00 00       	jmp    801083a0 <release>
+80107eb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    wakeup(lk);
+80107eb8:	83 ec 0c             	sub    $0xc,%esp
+80107ebb:	53                   	push   %ebx
+80107ebc:	e8 cf f9 ff ff       	call   80107890 <wakeup>
+  release(&lk->lk);
+80107ec1:	89 75 08             	mov    %esi,0x8(%ebp)
+    wakeup(lk);
+80107ec4:	83 c4 10             	add    $0x10,%esp
+}
+80107ec7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107eca:	5b                   	pop    %ebx
+80107ecb:	5e                   	pop    %esi
+80107ecc:	5d                   	pop    %ebp
+  release(&lk->lk);
+80107ecd:	e9 ce 04 00 00       	jmp    801083a0 <release>
+    panic("releasesleepread");
+80107ed2:	83 ec 0c             	sub    $0xc,%esp
+80107ed5:	68 0f be 10 80       	push   $0x8010be0f
+80107eda:	e8 81 87 ff ff       	call   80100660 <panic>
+80107edf:	90                   	nop
+
+80107ee0 <holdingsleep>:
+
+int
+holdingsleep(struct sleeplock *lk)
+{
+80107ee0:	55                   	push   %ebp
+80107ee1:	89 e5                	mov    %esp,%ebp
+80107ee3:	56                   	push   %esi
+80107ee4:	53                   	push   %ebx
+80107ee5:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  
+  acquire(&lk->lk);
+80107ee8:	8d 5e 0c             	lea    0xc(%esi),%ebx
+80107eeb:	83 ec 0c             	sub    $0xc,%esp
+80107eee:	53                   	push   %ebx
+80107eef:	e8 6c 02 00 00       	call   80108160 <acquire>
+  r = lk->locked;
+80107ef4:	8b 36                	mov    (%esi),%esi
+  release(&lk->lk);
+80107ef6:	89 1c 24             	mov    %ebx,(%esp)
+80107ef9:	e8 a2 04 00 00       	call   801083a0 <release>
+  return r;
+}
+80107efe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107f01:	89 f0                	mov    %esi,%eax
+80107f03:	5b                   	pop    %ebx
+80107f04:	5e                   	pop    %esi
+80107f05:	5d                   	pop    %ebp
+80107f06:	c3                   	ret
+80107f07:	66 90                	xchg   %ax,%ax
+80107f09:	66 90                	xchg   %ax,%ax
+80107f0b:	66 90                	xchg   %ax,%ax
+80107f0d:	66 90                	xchg   %ax,%ax
+80107f0f:	90                   	nop
+
+80107f10 <initlock>:
+  return 0;
+}
+
+void
+initlock(struct spinlock *lk, char *name)
+{
+80107f10:	55                   	push   %ebp
+80107f11:	89 e5                	mov    %esp,%ebp
+80107f13:	57                   	push   %edi
+80107f14:	56                   	push   %esi
+80107f15:	53                   	push   %ebx
+  for(s = lockstat; s < &lockstat[NLOCKSTAT]; s++){
+80107f16:	bb 80 3e 23 80       	mov    $0x80233e80,%ebx
+{
+80107f1b:	83 ec 0c             	sub    $0xc,%esp
+80107f1e:	8b 75 08             	mov    0x8(%ebp),%esi
+80107f21:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  lk->name = name;
+  lk->next = 0;
+80107f24:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  lk->name = name;
+80107f2a:	89 7e 08             	mov    %edi,0x8(%esi)
+  lk->owner = 0;
+80107f2d:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+  lk->cpu = 0;
+80107f34:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+    if(s->name == 0 &&
+80107f3b:	8b 03                	mov    (%ebx),%eax
+80107f3d:	85 c0                	test   %eax,%eax
+80107f3f:	74 37                	je     80107f78 <initlock+0x68>
+    if(s->name == name || strncmp(s->name, name, 16) == 0)
+80107f41:	39 c7                	cmp    %eax,%edi
+80107f43:	74 23                	je     80107f68 <initlock+0x58>
+80107f45:	83 ec 04             	sub    $0x4,%esp
+80107f48:	6a 10                	push   $0x10
+80107f4a:	57                   	push   %edi
+80107f4b:	50                   	push   %eax
+80107f4c:	e8 3f 06 00 00       	call   80108590 <strncmp>
+80107f51:	83 c4 10             	add    $0x10,%esp
+80107f54:	85 c0                	test   %eax,%eax
+80107f56:	74 10                	je     80107f68 <initlock+0x58>
+  for(s = lockstat; s < &lockstat[NLOCKSTAT]; s++){
+80107f58:	81 c3 84 00 00 00    	add    $0x84,%ebx
+80107f5e:	81 fb 80 5f 23 80    	cmp    $0x80235f80,%ebx
+80107f64:	75 d5                	jne    80107f3b <initlock+0x2b>
+  return 0;
+80107f66:	31 db                	xor    %ebx,%ebx
+  lk->stat = lockstatfor(name);
+80107f68:	89 5e 38             	mov    %ebx,0x38(%esi)
+}
+80107f6b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107f6e:	5b                   	pop    %ebx
+80107f6f:	5e                   	pop    %esi
+80107f70:	5f                   	pop    %edi
+80107f71:	5d                   	pop    %ebp
+80107f72:	c3                   	ret
+80107f73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107f77:	90                   	nop
+       __sync_bool_compare_and_swap(&s->name, 0, name))
+80107f78:	f0 0f b1 3b          	lock cmpxchg %edi,(%ebx)
+    if(s->name == 0 &&
+80107f7c:	74 ea                	je     80107f68 <initlock+0x58>
+    if(s->name == name || strncmp(s->name, name, 16) == 0)
+80107f7e:	8b 03                	mov    (%ebx),%eax
+80107f80:	eb bf                	jmp    80107f41 <initlock+0x31>
+80107f82:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107f89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107f90 <getcallerpcs>:
+}
+
+// Record the current call stack in pcs[] by following the %ebp chain.
+void
+getcallerpcs(void *v, uint pcs[])
+{
+80107f90:	55                   	push   %ebp
+80107f91:	89 e5                	mov    %esp,%ebp
+80107f93:	53                   	push   %ebx
+80107f94:	8b 45 08             	mov    0x8(%ebp),%eax
+80107f97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  uint *ebp;
+  int i;
+
+  ebp = (uint*)v - 2;
+80107f9a:	8d 50 f8             	lea    -0x8(%eax),%edx
+  for(i = 0; i < 10; i++){
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80107f9d:	05 f8 ff ff 7f       	add    $0x7ffffff8,%eax
+80107fa2:	3d fe ff ff 7f       	cmp    $0x7ffffffe,%eax
+  for(i = 0; i < 10; i++){
+80107fa7:	b8 00 00 00 00       	mov    $0x0,%eax
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80107fac:	76 10                	jbe    80107fbe <getcallerpcs+0x2e>
+80107fae:	eb 28                	jmp    80107fd8 <getcallerpcs+0x48>
+80107fb0:	8d 9a 00 00 00 80    	lea    -0x80000000(%edx),%ebx
+80107fb6:	81 fb fe ff ff 7f    	cmp    $0x7ffffffe,%ebx
+80107fbc:	77 1a                	ja     80107fd8 <getcallerpcs+0x48>
+      break;
+    pcs[i] = ebp[1];     // saved %eip
+80107fbe:	8b 5a 04             	mov    0x4(%edx),%ebx
+80107fc1:	89 1c 81             	mov    %ebx,(%ecx,%eax,4)
+  for(i = 0; i < 10; i++){
+80107fc4:	83 c0 01             	add    $0x1,%eax
+    ebp = (uint*)ebp[0]; // saved %ebp
+80107fc7:	8b 12                	mov    (%edx),%edx
+  for(i = 0; i < 10; i++){
+80107fc9:	83 f8 0a             	cmp    $0xa,%eax
+80107fcc:	75 e2                	jne    80107fb0 <getcallerpcs+0x20>
+  }
+  for(; i < 10; i++)
+    pcs[i] = 0;
+}
+80107fce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107fd1:	c9                   	leave
+80107fd2:	c3                   	ret
+80107fd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107fd7:	90                   	nop
+80107fd8:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+80107fdb:	8d 51 28             	lea    0x28(%ecx),%edx
+80107fde:	66 90                	xchg   %ax,%ax
+    pcs[i] = 0;
+80107fe0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(; i < 10; i++)
+80107fe6:	83 c0 04             	add    $0x4,%eax
+80107fe9:	39 d0                	cmp    %edx,%eax
+80107feb:	75 f3                	jne    80107fe0 <getcallerpcs+0x50>
+}
+80107fed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107ff0:	c9                   	leave
+80107ff1:	c3                   	ret
+80107ff2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107ff9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80108000 <holding>:
+
+// Check whether this cpu is holding the lock.
+int
+holding(struct spinlock *lock)
+{
+80108000:	55                   	push   %ebp
+80108001:	31 d2                	xor    %edx,%edx
+80108003:	89 e5                	mov    %esp,%ebp
+80108005:	53                   	push   %ebx
+80108006:	83 ec 04             	sub    $0x4,%esp
+80108009:	8b 45 08             	mov    0x8(%ebp),%eax
+  return lock->owner != lock->next && lock->cpu == mycpu();
+8010800c:	8b 48 04             	mov    0x4(%eax),%ecx
+8010800f:	3b 08                	cmp    (%eax),%ecx
+80108011:	74 0f                	je     80108022 <holding+0x22>
+80108013:	8b 58 0c             	mov    0xc(%eax),%ebx
+80108016:	e8 25 ec ff ff       	call   80106c40 <mycpu>
+8010801b:	31 d2                	xor    %edx,%edx
+8010801d:	39 c3                	cmp    %eax,%ebx
+8010801f:	0f 94 c2             	sete   %dl
+}
+80108022:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108025:	89 d0                	mov    %edx,%eax
+80108027:	c9                   	leave
+80108028:	c3                   	ret
+80108029:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80108030 <lockdump>:
+
+// Print the lock statistics to console.  For debugging.
+// Runs when user types ^L on console.
+void
+lockdump(void)
+{
+80108030:	55                   	push   %ebp
+80108031:	89 e5                	mov    %esp,%ebp
+80108033:	57                   	push   %edi
+80108034:	56                   	push   %esi
+80108035:	53                   	push   %ebx
+80108036:	83 ec 38             	sub    $0x38,%esp
+  struct lockstat *s;
+  uint nacquire, ncontend, nspin, maxhold;
+  int i;
+
+  cprintf("lock: acquired contended spins maxhold\n");
+80108039:	68 20 be 10 80       	push   $0x8010be20
+8010803e:	e8 4d 89 ff ff       	call   80100990 <cprintf>
+  for(s = lockstat; s < &lockstat[NLOCKSTAT] && s->name; s++){
+80108043:	c7 45 d8 84 3e 23 80 	movl   $0x80233e84,-0x28(%ebp)
+8010804a:	83 c4 10             	add    $0x10,%esp
+8010804d:	8d 76 00             	lea    0x0(%esi),%esi
+80108050:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80108053:	8b 40 fc             	mov    -0x4(%eax),%eax
+80108056:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+80108059:	85 c0                	test   %eax,%eax
+8010805b:	74 73                	je     801080d0 <lockdump+0xa0>
+    nacquire = ncontend = nspin = maxhold = 0;
+    for(i = 0; i < ncpu; i++){
+8010805d:	a1 64 71 22 80       	mov    0x80227164,%eax
+80108062:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80108065:	85 c0                	test   %eax,%eax
+80108067:	7e 77                	jle    801080e0 <lockdump+0xb0>
+    nacquire = ncontend = nspin = maxhold = 0;
+80108069:	31 db                	xor    %ebx,%ebx
+8010806b:	31 f6                	xor    %esi,%esi
+    for(i = 0; i < ncpu; i++){
+8010806d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80108070:	31 c9                	xor    %ecx,%ecx
+    nacquire = ncontend = nspin = maxhold = 0;
+80108072:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+80108075:	31 d2                	xor    %edx,%edx
+80108077:	31 ff                	xor    %edi,%edi
+80108079:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+8010807c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      nacquire += s->cpu[i].nacquire;
+80108080:	8b 18                	mov    (%eax),%ebx
+80108082:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+    for(i = 0; i < ncpu; i++){
+80108085:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+      ncontend += s->cpu[i].ncontend;
+80108088:	8b 70 04             	mov    0x4(%eax),%esi
+      nspin += s->cpu[i].nspin;
+8010808b:	03 78 08             	add    0x8(%eax),%edi
+      ncontend += s->cpu[i].ncontend;
+8010808e:	01 75 e0             	add    %esi,-0x20(%ebp)
+80108091:	3b 50 0c             	cmp    0xc(%eax),%edx
+80108094:	0f 42 50 0c          	cmovb  0xc(%eax),%edx
+    for(i = 0; i < ncpu; i++){
+80108098:	83 c1 01             	add    $0x1,%ecx
+8010809b:	83 c0 10             	add    $0x10,%eax
+8010809e:	39 d9                	cmp    %ebx,%ecx
+801080a0:	75 de                	jne    80108080 <lockdump+0x50>
+801080a2:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+801080a5:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+      if(s->cpu[i].maxhold > maxhold)
+        maxhold = s->cpu[i].maxhold;
+    }
+    cprintf("%s: %d %d %d %d\n", s->name, nacquire, ncontend, nspin,
+801080a8:	83 ec 08             	sub    $0x8,%esp
+801080ab:	52                   	push   %edx
+801080ac:	57                   	push   %edi
+801080ad:	53                   	push   %ebx
+801080ae:	56                   	push   %esi
+801080af:	ff 75 d4             	push   -0x2c(%ebp)
+801080b2:	68 48 be 10 80       	push   $0x8010be48
+801080b7:	e8 d4 88 ff ff       	call   80100990 <cprintf>
+  for(s = lockstat; s < &lockstat[NLOCKSTAT] && s->name; s++){
+801080bc:	81 45 d8 84 00 00 00 	addl   $0x84,-0x28(%ebp)
+801080c3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+801080c6:	83 c4 20             	add    $0x20,%esp
+801080c9:	3d 84 5f 23 80       	cmp    $0x80235f84,%eax
+801080ce:	75 80                	jne    80108050 <lockdump+0x20>
+            maxhold);
+  }
+}
+801080d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801080d3:	5b                   	pop    %ebx
+801080d4:	5e                   	pop    %esi
+801080d5:	5f                   	pop    %edi
+801080d6:	5d                   	pop    %ebp
+801080d7:	c3                   	ret
+801080d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801080df:	90                   	nop
+    nacquire = ncontend = nspin = maxhold = 0;
+801080e0:	31 d2                	xor    %edx,%edx
+801080e2:	31 ff                	xor    %edi,%edi
+801080e4:	31 db                	xor    %ebx,%ebx
+801080e6:	31 f6                	xor    %esi,%esi
+801080e8:	eb be                	jmp    801080a8 <lockdump+0x78>
+801080ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801080f0 <initrwlock>:
+#define RW_WAITING 2  // A writer is waiting
+#define RW_READER  4  // One reader
+
+void
+initrwlock(struct rwspinlock *lk, char *name)
+{
+801080f0:	55                   	push   %ebp
+801080f1:	89 e5                	mov    %esp,%ebp
+801080f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  lk->name = name;
+801080f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  lk->state = 0;
+801080f9:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  lk->name = name;
+801080ff:	89 50 04             	mov    %edx,0x4(%eax)
+  lk->cpu = 0;
+80108102:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+}
+80108109:	5d                   	pop    %ebp
+8010810a:	c3                   	ret
+8010810b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010810f:	90                   	nop
+
+80108110 <pushcli>:
+// it takes two popcli to undo two pushcli.  Also, if interrupts
+// are off, then pushcli, popcli leaves them off.
+
+void
+pushcli(void)
+{
+80108110:	55                   	push   %ebp
+80108111:	89 e5                	mov    %esp,%ebp
+80108113:	53                   	push   %ebx
+80108114:	83 ec 04             	sub    $0x4,%esp
+80108117:	9c                   	pushf
+80108118:	5b                   	pop    %ebx
+  asm volatile("cli");
+80108119:	fa                   	cli
+  int eflags;
+
+  eflags = readeflags();
+  cli();
+  if(mycpu()->ncli == 0)
+8010811a:	e8 21 eb ff ff       	call   80106c40 <mycpu>
+8010811f:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+80108125:	85 c0                	test   %eax,%eax
+80108127:	74 17                	je     80108140 <pushcli+0x30>
+    mycpu()->intena = eflags & FL_IF;
+  mycpu()->ncli += 1;
+80108129:	e8 12 eb ff ff       	call   80106c40 <mycpu>
+8010812e:	83 80 a4 00 00 00 01 	addl   $0x1,0xa4(%eax)
+}
+80108135:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108138:	c9                   	leave
+80108139:	c3                   	ret
+8010813a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mycpu()->intena = eflags & FL_IF;
+80108140:	e8 fb ea ff ff       	call   80106c40 <mycpu>
+80108145:	81 e3 00 02 00 00    	and    $0x200,%ebx
+8010814b:	89 98 a8 00 00 00    	mov    %ebx,0xa8(%eax)
+80108151:	eb d6                	jmp    80108129 <pushcli+0x19>
+80108153:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010815a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80108160 <acquire>:
+{
+80108160:	55                   	push   %ebp
+80108161:	89 e5                	mov    %esp,%ebp
+80108163:	57                   	push   %edi
+80108164:	56                   	push   %esi
+80108165:	53                   	push   %ebx
+80108166:	83 ec 0c             	sub    $0xc,%esp
+  pushcli(); // disable interrupts to avoid deadlock.
+80108169:	e8 a2 ff ff ff       	call   80108110 <pushcli>
+  c = mycpu();
+8010816e:	e8 cd ea ff ff       	call   80106c40 <mycpu>
+  if(holding(lk))
+80108173:	8b 75 08             	mov    0x8(%ebp),%esi
+  c = mycpu();
+80108176:	89 c3                	mov    %eax,%ebx
+  return lock->owner != lock->next && lock->cpu == mycpu();
+80108178:	8b 46 04             	mov    0x4(%esi),%eax
+8010817b:	3b 06                	cmp    (%esi),%eax
+8010817d:	0f 85 d5 00 00 00    	jne    80108258 <acquire+0xf8>
+  ticket = __sync_fetch_and_add(&lk->next, 1);
+80108183:	ba 01 00 00 00       	mov    $0x1,%edx
+80108188:	f0 0f c1 16          	lock xadd %edx,(%esi)
+  for(spins = 0; lk->owner != ticket; spins++)
+8010818c:	31 f6                	xor    %esi,%esi
+8010818e:	8b 45 08             	mov    0x8(%ebp),%eax
+80108191:	8b 40 04             	mov    0x4(%eax),%eax
+80108194:	39 c2                	cmp    %eax,%edx
+80108196:	74 17                	je     801081af <acquire+0x4f>
+80108198:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010819f:	90                   	nop
+    asm volatile("pause");
+801081a0:	f3 90                	pause
+  for(spins = 0; lk->owner != ticket; spins++)
+801081a2:	8b 45 08             	mov    0x8(%ebp),%eax
+801081a5:	83 c6 01             	add    $0x1,%esi
+801081a8:	8b 40 04             	mov    0x4(%eax),%eax
+801081ab:	39 d0                	cmp    %edx,%eax
+801081ad:	75 f1                	jne    801081a0 <acquire+0x40>
+  __sync_synchronize();
+801081af:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+801081b4:	8d 85 00 00 00 80    	lea    -0x80000000(%ebp),%eax
+  for(i = 0; i < 10; i++){
+801081ba:	31 d2                	xor    %edx,%edx
+  lk->cpu = c;
+801081bc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+801081bf:	89 59 0c             	mov    %ebx,0xc(%ecx)
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+801081c2:	3d fe ff ff 7f       	cmp    $0x7ffffffe,%eax
+801081c7:	77 57                	ja     80108220 <acquire+0xc0>
+  ebp = (uint*)v - 2;
+801081c9:	89 e8                	mov    %ebp,%eax
+801081cb:	eb 11                	jmp    801081de <acquire+0x7e>
+801081cd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+801081d0:	8d b8 00 00 00 80    	lea    -0x80000000(%eax),%edi
+801081d6:	81 ff fe ff ff 7f    	cmp    $0x7ffffffe,%edi
+801081dc:	77 42                	ja     80108220 <acquire+0xc0>
+    pcs[i] = ebp[1];     // saved %eip
+801081de:	8b 78 04             	mov    0x4(%eax),%edi
+801081e1:	89 7c 91 10          	mov    %edi,0x10(%ecx,%edx,4)
+  for(i = 0; i < 10; i++){
+801081e5:	83 c2 01             	add    $0x1,%edx
+    ebp = (uint*)ebp[0]; // saved %ebp
+801081e8:	8b 00                	mov    (%eax),%eax
+  for(i = 0; i < 10; i++){
+801081ea:	83 fa 0a             	cmp    $0xa,%edx
+801081ed:	75 e1                	jne    801081d0 <acquire+0x70>
+  if(lk->stat){
+801081ef:	8b 41 38             	mov    0x38(%ecx),%eax
+801081f2:	85 c0                	test   %eax,%eax
+801081f4:	74 20                	je     80108216 <acquire+0xb6>
+    lk->stat->cpu[c-cpus].nacquire++;
+801081f6:	81 eb 80 71 22 80    	sub    $0x80227180,%ebx
+801081fc:	c1 fb 02             	sar    $0x2,%ebx
+801081ff:	69 db cf 46 7d 67    	imul   $0x677d46cf,%ebx,%ebx
+80108205:	c1 e3 04             	shl    $0x4,%ebx
+80108208:	83 44 18 04 01       	addl   $0x1,0x4(%eax,%ebx,1)
+    if(spins){
+8010820d:	85 f6                	test   %esi,%esi
+8010820f:	75 2f                	jne    80108240 <acquire+0xe0>
+static inline uint
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+80108211:	0f 31                	rdtsc
+    lk->tacquire = rdtsc();
+80108213:	89 41 3c             	mov    %eax,0x3c(%ecx)
+}
+80108216:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108219:	5b                   	pop    %ebx
+8010821a:	5e                   	pop    %esi
+8010821b:	5f                   	pop    %edi
+8010821c:	5d                   	pop    %ebp
+8010821d:	c3                   	ret
+8010821e:	66 90                	xchg   %ax,%ax
+80108220:	8d 44 91 10          	lea    0x10(%ecx,%edx,4),%eax
+80108224:	8d 51 38             	lea    0x38(%ecx),%edx
+80108227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010822e:	66 90                	xchg   %ax,%ax
+    pcs[i] = 0;
+80108230:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(; i < 10; i++)
+80108236:	83 c0 04             	add    $0x4,%eax
+80108239:	39 d0                	cmp    %edx,%eax
+8010823b:	75 f3                	jne    80108230 <acquire+0xd0>
+8010823d:	eb b0                	jmp    801081ef <acquire+0x8f>
+8010823f:	90                   	nop
+      lk->stat->cpu[c-cpus].ncontend++;
+80108240:	8b 41 38             	mov    0x38(%ecx),%eax
+80108243:	01 d8                	add    %ebx,%eax
+80108245:	83 40 08 01          	addl   $0x1,0x8(%eax)
+      lk->stat->cpu[c-cpus].nspin += spins;
+80108249:	03 59 38             	add    0x38(%ecx),%ebx
+8010824c:	01 73 0c             	add    %esi,0xc(%ebx)
+8010824f:	eb c0                	jmp    80108211 <acquire+0xb1>
+80108251:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return lock->owner != lock->next && lock->cpu == mycpu();
+80108258:	8b 7e 0c             	mov    0xc(%esi),%edi
+8010825b:	e8 e0 e9 ff ff       	call   80106c40 <mycpu>
+80108260:	39 c7                	cmp    %eax,%edi
+80108262:	0f 85 1b ff ff ff    	jne    80108183 <acquire+0x23>
+    panic("acquire");
+80108268:	83 ec 0c             	sub    $0xc,%esp
+8010826b:	68 59 be 10 80       	push   $0x8010be59
+80108270:	e8 eb 83 ff ff       	call   80100660 <panic>
+80108275:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010827c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108280 <acquireread>:
+{
+80108280:	55                   	push   %ebp
+80108281:	89 e5                	mov    %esp,%ebp
+80108283:	56                   	push   %esi
+80108284:	53                   	push   %ebx
+80108285:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+80108288:	e8 83 fe ff ff       	call   80108110 <pushcli>
+  if(lk->cpu == mycpu())
+8010828d:	8b 73 08             	mov    0x8(%ebx),%esi
+80108290:	e8 ab e9 ff ff       	call   80106c40 <mycpu>
+80108295:	39 c6                	cmp    %eax,%esi
+80108297:	74 1e                	je     801082b7 <acquireread+0x37>
+    s = lk->state;
+80108299:	8b 03                	mov    (%ebx),%eax
+    if((s & (RW_WRITER|RW_WAITING)) == 0 &&
+8010829b:	a8 03                	test   $0x3,%al
+8010829d:	74 08                	je     801082a7 <acquireread+0x27>
+    asm volatile("pause");
+8010829f:	f3 90                	pause
+    s = lk->state;
+801082a1:	8b 03                	mov    (%ebx),%eax
+    if((s & (RW_WRITER|RW_WAITING)) == 0 &&
+801082a3:	a8 03                	test   $0x3,%al
+801082a5:	75 f8                	jne    8010829f <acquireread+0x1f>
+       __sync_bool_compare_and_swap(&lk->state, s, s + RW_READER))
+801082a7:	8d 50 04             	lea    0x4(%eax),%edx
+801082aa:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+    if((s & (RW_WRITER|RW_WAITING)) == 0 &&
+801082ae:	75 ef                	jne    8010829f <acquireread+0x1f>
+}
+801082b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801082b3:	5b                   	pop    %ebx
+801082b4:	5e                   	pop    %esi
+801082b5:	5d                   	pop    %ebp
+801082b6:	c3                   	ret
+    panic("acquireread");
+801082b7:	83 ec 0c             	sub    $0xc,%esp
+801082ba:	68 61 be 10 80       	push   $0x8010be61
+801082bf:	e8 9c 83 ff ff       	call   80100660 <panic>
+801082c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801082cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801082cf:	90                   	nop
+
+801082d0 <acquirewrite>:
+{
+801082d0:	55                   	push   %ebp
+801082d1:	89 e5                	mov    %esp,%ebp
+801082d3:	56                   	push   %esi
+801082d4:	53                   	push   %ebx
+801082d5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+801082d8:	e8 33 fe ff ff       	call   80108110 <pushcli>
+  if(lk->cpu == mycpu())
+801082dd:	8b 73 08             	mov    0x8(%ebx),%esi
+801082e0:	e8 5b e9 ff ff       	call   80106c40 <mycpu>
+801082e5:	39 c6                	cmp    %eax,%esi
+801082e7:	74 42                	je     8010832b <acquirewrite+0x5b>
+      if(__sync_bool_compare_and_swap(&lk->state, s, RW_WRITER))
+801082e9:	ba 01 00 00 00       	mov    $0x1,%edx
+    s = lk->state;
+801082ee:	8b 03                	mov    (%ebx),%eax
+    if((s & ~RW_WAITING) == 0){
+801082f0:	a9 fd ff ff ff       	test   $0xfffffffd,%eax
+801082f5:	75 19                	jne    80108310 <acquirewrite+0x40>
+      if(__sync_bool_compare_and_swap(&lk->state, s, RW_WRITER))
+801082f7:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+801082fb:	75 17                	jne    80108314 <acquirewrite+0x44>
+  lk->cpu = mycpu();
+801082fd:	e8 3e e9 ff ff       	call   80106c40 <mycpu>
+80108302:	89 43 08             	mov    %eax,0x8(%ebx)
+}
+80108305:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108308:	5b                   	pop    %ebx
+80108309:	5e                   	pop    %esi
+8010830a:	5d                   	pop    %ebp
+8010830b:	c3                   	ret
+8010830c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((s & RW_WAITING) == 0)
+80108310:	a8 02                	test   $0x2,%al
+80108312:	74 0c                	je     80108320 <acquirewrite+0x50>
+    asm volatile("pause");
+80108314:	f3 90                	pause
+    s = lk->state;
+80108316:	eb d6                	jmp    801082ee <acquirewrite+0x1e>
+80108318:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010831f:	90                   	nop
+      __sync_bool_compare_and_swap(&lk->state, s, s | RW_WAITING);
+80108320:	89 c1                	mov    %eax,%ecx
+80108322:	83 c9 02             	or     $0x2,%ecx
+80108325:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+80108329:	eb e9                	jmp    80108314 <acquirewrite+0x44>
+    panic("acquirewrite");
+8010832b:	83 ec 0c             	sub    $0xc,%esp
+8010832e:	68 6d be 10 80       	push   $0x8010be6d
+80108333:	e8 28 83 ff ff       	call   80100660 <panic>
+80108338:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010833f:	90                   	nop
+
+80108340 <popcli>:
+
+void
+popcli(void)
+{
+80108340:	55                   	push   %ebp
+80108341:	89 e5                	mov    %esp,%ebp
+80108343:	83 ec 08             	sub    $0x8,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80108346:	9c                   	pushf
+80108347:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80108348:	f6 c4 02             	test   $0x2,%ah
+8010834b:	75 35                	jne    80108382 <popcli+0x42>
+    panic("popcli - interruptible");
+  if(--mycpu()->ncli < 0)
+8010834d:	e8 ee e8 ff ff       	call   80106c40 <mycpu>
+80108352:	83 a8 a4 00 00 00 01 	subl   $0x1,0xa4(%eax)
+80108359:	78 34                	js     8010838f <popcli+0x4f>
+    panic("popcli");
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+8010835b:	e8 e0 e8 ff ff       	call   80106c40 <mycpu>
+80108360:	8b 90 a4 00 00 00    	mov    0xa4(%eax),%edx
+80108366:	85 d2                	test   %edx,%edx
+80108368:	74 06                	je     80108370 <popcli+0x30>
+    sti();
+}
+8010836a:	c9                   	leave
+8010836b:	c3                   	ret
+8010836c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+80108370:	e8 cb e8 ff ff       	call   80106c40 <mycpu>
+80108375:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+8010837b:	85 c0                	test   %eax,%eax
+8010837d:	74 eb                	je     8010836a <popcli+0x2a>
+  asm volatile("sti");
+8010837f:	fb                   	sti
+}
+80108380:	c9                   	leave
+80108381:	c3                   	ret
+    panic("popcli - interruptible");
+80108382:	83 ec 0c             	sub    $0xc,%esp
+80108385:	68 7a be 10 80       	push   $0x8010be7a
+8010838a:	e8 d1 82 ff ff       	call   80100660 <panic>
+    panic("popcli");
+8010838f:	83 ec 0c             	sub    $0xc,%esp
+80108392:	68 91 be 10 80       	push   $0x8010be91
+80108397:	e8 c4 82 ff ff       	call   80100660 <panic>
+8010839c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801083a0 <release>:
+{
+801083a0:	55                   	push   %ebp
+801083a1:	89 e5                	mov    %esp,%ebp
+801083a3:	56                   	push   %esi
+801083a4:	53                   	push   %ebx
+801083a5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  return lock->owner != lock->next && lock->cpu == mycpu();
+801083a8:	8b 43 04             	mov    0x4(%ebx),%eax
+801083ab:	3b 03                	cmp    (%ebx),%eax
+801083ad:	75 11                	jne    801083c0 <release+0x20>
+    panic("release");
+801083af:	83 ec 0c             	sub    $0xc,%esp
+801083b2:	68 98 be 10 80       	push   $0x8010be98
+801083b7:	e8 a4 82 ff ff       	call   80100660 <panic>
+801083bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return lock->owner != lock->next && lock->cpu == mycpu();
+801083c0:	8b 73 0c             	mov    0xc(%ebx),%esi
+801083c3:	e8 78 e8 ff ff       	call   80106c40 <mycpu>
+801083c8:	39 c6                	cmp    %eax,%esi
+801083ca:	75 e3                	jne    801083af <release+0xf>
+  if(lk->stat){
+801083cc:	8b 4b 38             	mov    0x38(%ebx),%ecx
+801083cf:	85 c9                	test   %ecx,%ecx
+801083d1:	74 24                	je     801083f7 <release+0x57>
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+801083d3:	0f 31                	rdtsc
+    if(hold > lk->stat->cpu[c-cpus].maxhold)
+801083d5:	8b 53 0c             	mov    0xc(%ebx),%edx
+    hold = rdtsc() - lk->tacquire;
+801083d8:	2b 43 3c             	sub    0x3c(%ebx),%eax
+    if(hold > lk->stat->cpu[c-cpus].maxhold)
+801083db:	81 ea 80 71 22 80    	sub    $0x80227180,%edx
+801083e1:	c1 fa 02             	sar    $0x2,%edx
+801083e4:	69 d2 cf 46 7d 67    	imul   $0x677d46cf,%edx,%edx
+801083ea:	c1 e2 04             	shl    $0x4,%edx
+801083ed:	01 d1                	add    %edx,%ecx
+801083ef:	39 41 10             	cmp    %eax,0x10(%ecx)
+801083f2:	73 03                	jae    801083f7 <release+0x57>
+      lk->stat->cpu[c-cpus].maxhold = hold;
+801083f4:	89 41 10             	mov    %eax,0x10(%ecx)
+  lk->pcs[0] = 0;
+801083f7:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  lk->cpu = 0;
+801083fe:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  __sync_synchronize();
+80108405:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  lk->owner = lk->owner + 1;
+8010840a:	8b 43 04             	mov    0x4(%ebx),%eax
+8010840d:	83 c0 01             	add    $0x1,%eax
+80108410:	89 43 04             	mov    %eax,0x4(%ebx)
+}
+80108413:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108416:	5b                   	pop    %ebx
+80108417:	5e                   	pop    %esi
+80108418:	5d                   	pop    %ebp
+  popcli();
+80108419:	e9 22 ff ff ff       	jmp    80108340 <popcli>
+8010841e:	66 90                	xchg   %ax,%ax
+
+80108420 <releaseread>:
+{
+80108420:	55                   	push   %ebp
+80108421:	89 e5                	mov    %esp,%ebp
+80108423:	83 ec 08             	sub    $0x8,%esp
+80108426:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(lk->state < RW_READER)
+80108429:	8b 10                	mov    (%eax),%edx
+8010842b:	83 fa 03             	cmp    $0x3,%edx
+8010842e:	76 0a                	jbe    8010843a <releaseread+0x1a>
+  __sync_fetch_and_sub(&lk->state, RW_READER);
+80108430:	f0 83 28 04          	lock subl $0x4,(%eax)
+}
+80108434:	c9                   	leave
+  popcli();
+80108435:	e9 06 ff ff ff       	jmp    80108340 <popcli>
+    panic("releaseread");
+8010843a:	83 ec 0c             	sub    $0xc,%esp
+8010843d:	68 a0 be 10 80       	push   $0x8010bea0
+80108442:	e8 19 82 ff ff       	call   80100660 <panic>
+80108447:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010844e:	66 90                	xchg   %ax,%ax
+
+80108450 <releasewrite>:
+{
+80108450:	55                   	push   %ebp
+80108451:	89 e5                	mov    %esp,%ebp
+80108453:	56                   	push   %esi
+80108454:	53                   	push   %ebx
+80108455:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!(lk->state & RW_WRITER) || lk->cpu != mycpu())
+80108458:	8b 03                	mov    (%ebx),%eax
+8010845a:	a8 01                	test   $0x1,%al
+8010845c:	74 22                	je     80108480 <releasewrite+0x30>
+8010845e:	8b 73 08             	mov    0x8(%ebx),%esi
+80108461:	e8 da e7 ff ff       	call   80106c40 <mycpu>
+80108466:	39 c6                	cmp    %eax,%esi
+80108468:	75 16                	jne    80108480 <releasewrite+0x30>
+  lk->cpu = 0;
+8010846a:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  __sync_fetch_and_and(&lk->state, ~RW_WRITER);
+80108471:	f0 83 23 fe          	lock andl $0xfffffffe,(%ebx)
+}
+80108475:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108478:	5b                   	pop    %ebx
+80108479:	5e                   	pop    %esi
+8010847a:	5d                   	pop    %ebp
+  popcli();
+8010847b:	e9 c0 fe ff ff       	jmp    80108340 <popcli>
+    panic("releasewrite");
+80108480:	83 ec 0c             	sub    $0xc,%esp
+80108483:	68 ac be 10 80       	push   $0x8010beac
+80108488:	e8 d3 81 ff ff       	call   80100660 <panic>
+8010848d:	66 90                	xchg   %ax,%ax
+8010848f:	90                   	nop
+
+80108490 <memset>:
+#include "types.h"
+#include "x86.h"
+
+void*
+memset(void *dst, int c, uint n)
+{
+80108490:	55                   	push   %ebp
+80108491:	89 e5                	mov    %esp,%ebp
+80108493:	57                   	push   %edi
+80108494:	8b 55 08             	mov    0x8(%ebp),%edx
+80108497:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  if ((int)dst%4 == 0 && n%4 == 0){
+8010849a:	89 d0                	mov    %edx,%eax
+8010849c:	09 c8                	or     %ecx,%eax
+8010849e:	a8 03                	test   $0x3,%al
+801084a0:	75 1e                	jne    801084c0 <memset+0x30>
+    c &= 0xFF;
+801084a2:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+    stosl(dst, (c<<24)|(c<<16)|(c<<8)|c, n/4);
+801084a6:	c1 e9 02             	shr    $0x2,%ecx
+  asm volatile("cld; rep stosl" :
+801084a9:	89 d7                	mov    %edx,%edi
+801084ab:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+801084b1:	fc                   	cld
+801084b2:	f3 ab                	rep stos %eax,%es:(%edi)
+  } else
+    stosb(dst, c, n);
+  return dst;
+}
+801084b4:	8b 7d fc             	mov    -0x4(%ebp),%edi
+801084b7:	89 d0                	mov    %edx,%eax
+801084b9:	c9                   	leave
+801084ba:	c3                   	ret
+801084bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801084bf:	90                   	nop
+  asm volatile("cld; rep stosb" :
+801084c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+801084c3:	89 d7                	mov    %edx,%edi
+801084c5:	fc                   	cld
+801084c6:	f3 aa                	rep stos %al,%es:(%edi)
+801084c8:	8b 7d fc             	mov    -0x4(%ebp),%edi
+801084cb:	89 d0                	mov    %edx,%eax
+801084cd:	c9                   	leave
+801084ce:	c3                   	ret
+801084cf:	90                   	nop
+
+801084d0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+801084d0:	55                   	push   %ebp
+801084d1:	89 e5                	mov    %esp,%ebp
+801084d3:	56                   	push   %esi
+801084d4:	53                   	push   %ebx
+801084d5:	8b 75 10             	mov    0x10(%ebp),%esi
+801084d8:	8b 55 08             	mov    0x8(%ebp),%edx
+801084db:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+801084de:	85 f6                	test   %esi,%esi
+801084e0:	74 2e                	je     80108510 <memcmp+0x40>
+801084e2:	01 c6                	add    %eax,%esi
+801084e4:	eb 14                	jmp    801084fa <memcmp+0x2a>
+801084e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801084ed:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+801084f0:	83 c0 01             	add    $0x1,%eax
+801084f3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+801084f6:	39 f0                	cmp    %esi,%eax
+801084f8:	74 16                	je     80108510 <memcmp+0x40>
+    if(*s1 != *s2)
+801084fa:	0f b6 0a             	movzbl (%edx),%ecx
+801084fd:	0f b6 18             	movzbl (%eax),%ebx
+80108500:	38 d9                	cmp    %bl,%cl
+80108502:	74 ec                	je     801084f0 <memcmp+0x20>
+      return *s1 - *s2;
+80108504:	0f b6 c1             	movzbl %cl,%eax
+80108507:	29 d8                	sub    %ebx,%eax
+  }
+
+  return 0;
+}
+80108509:	5b                   	pop    %ebx
+8010850a:	5e                   	pop    %esi
+8010850b:	5d                   	pop    %ebp
+8010850c:	c3                   	ret
+8010850d:	8d 76 00             	lea    0x0(%esi),%esi
+80108510:	5b                   	pop    %ebx
+  return 0;
+80108511:	31 c0                	xor    %eax,%eax
+}
+80108513:	5e                   	pop    %esi
+80108514:	5d                   	pop    %ebp
+80108515:	c3                   	ret
+80108516:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010851d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80108520 <memmove>:
+
+void*
+memmove(void *dst, const void *src, uint n)
+{
+80108520:	55                   	push   %ebp
+80108521:	89 e5                	mov    %esp,%ebp
+80108523:	57                   	push   %edi
+80108524:	56                   	push   %esi
+80108525:	8b 55 08             	mov    0x8(%ebp),%edx
+80108528:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010852b:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if(s < d && s + n > d){
+8010852e:	39 d6                	cmp    %edx,%esi
+80108530:	73 26                	jae    80108558 <memmove+0x38>
+80108532:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+80108535:	39 ca                	cmp    %ecx,%edx
+80108537:	73 1f                	jae    80108558 <memmove+0x38>
+    s += n;
+    d += n;
+    while(n-- > 0)
+80108539:	85 c0                	test   %eax,%eax
+8010853b:	74 0f                	je     8010854c <memmove+0x2c>
+8010853d:	83 e8 01             	sub    $0x1,%eax
+      *--d = *--s;
+80108540:	0f b6 0c 06          	movzbl (%esi,%eax,1),%ecx
+80108544:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+    while(n-- > 0)
+80108547:	83 e8 01             	sub    $0x1,%eax
+8010854a:	73 f4                	jae    80108540 <memmove+0x20>
+  } else
+    while(n-- > 0)
+      *d++ = *s++;
+
+  return dst;
+}
+8010854c:	5e                   	pop    %esi
+8010854d:	89 d0                	mov    %edx,%eax
+8010854f:	5f                   	pop    %edi
+80108550:	5d                   	pop    %ebp
+80108551:	c3                   	ret
+80108552:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    while(n-- > 0)
+80108558:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+8010855b:	89 d7                	mov    %edx,%edi
+8010855d:	85 c0                	test   %eax,%eax
+8010855f:	74 eb                	je     8010854c <memmove+0x2c>
+80108561:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      *d++ = *s++;
+80108568:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+    while(n-- > 0)
+80108569:	39 ce                	cmp    %ecx,%esi
+8010856b:	75 fb                	jne    80108568 <memmove+0x48>
+}
+8010856d:	5e                   	pop    %esi
+8010856e:	89 d0                	mov    %edx,%eax
+80108570:	5f                   	pop    %edi
+80108571:	5d                   	pop    %ebp
+80108572:	c3                   	ret
+80108573:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010857a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80108580 <memcpy>:
+
+// memcpy exists to placate GCC.  Use memmove.
+void*
+memcpy(void *dst, const void *src, uint n)
+{
+  return memmove(dst, src, n);
+80108580:	eb 9e                	jmp    80108520 <memmove>
+80108582:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108589:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80108590 <strncmp>:
+}
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+80108590:	55                   	push   %ebp
+80108591:	89 e5                	mov    %esp,%ebp
+80108593:	53                   	push   %ebx
+80108594:	8b 55 10             	mov    0x10(%ebp),%edx
+80108597:	8b 45 08             	mov    0x8(%ebp),%eax
+8010859a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(n > 0 && *p && *p == *q)
+8010859d:	85 d2                	test   %edx,%edx
+8010859f:	75 16                	jne    801085b7 <strncmp+0x27>
+801085a1:	eb 2d                	jmp    801085d0 <strncmp+0x40>
+801085a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801085a7:	90                   	nop
+801085a8:	3a 19                	cmp    (%ecx),%bl
+801085aa:	75 12                	jne    801085be <strncmp+0x2e>
+    n--, p++, q++;
+801085ac:	83 c0 01             	add    $0x1,%eax
+801085af:	83 c1 01             	add    $0x1,%ecx
+  while(n > 0 && *p && *p == *q)
+801085b2:	83 ea 01             	sub    $0x1,%edx
+801085b5:	74 19                	je     801085d0 <strncmp+0x40>
+801085b7:	0f b6 18             	movzbl (%eax),%ebx
+801085ba:	84 db                	test   %bl,%bl
+801085bc:	75 ea                	jne    801085a8 <strncmp+0x18>
+  if(n == 0)
+    return 0;
+  return (uchar)*p - (uchar)*q;
+801085be:	0f b6 00             	movzbl (%eax),%eax
+801085c1:	0f b6 11             	movzbl (%ecx),%edx
+}
+801085c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801085c7:	c9                   	leave
+  return (uchar)*p - (uchar)*q;
+801085c8:	29 d0                	sub    %edx,%eax
+}
+801085ca:	c3                   	ret
+801085cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801085cf:	90                   	nop
+801085d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+801085d3:	31 c0                	xor    %eax,%eax
+}
+801085d5:	c9                   	leave
+801085d6:	c3                   	ret
+801085d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801085de:	66 90                	xchg   %ax,%ax
+
+801085e0 <strncpy>:
+
+char*
+strncpy(char *s, const char *t, int n)
+{
+801085e0:	55                   	push   %ebp
+801085e1:	89 e5                	mov    %esp,%ebp
+801085e3:	57                   	push   %edi
+801085e4:	56                   	push   %esi
+801085e5:	53                   	push   %ebx
+801085e6:	8b 75 08             	mov    0x8(%ebp),%esi
+801085e9:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *os;
+
+  os = s;
+  while(n-- > 0 && (*s++ = *t++) != 0)
+801085ec:	89 f0                	mov    %esi,%eax
+801085ee:	eb 15                	jmp    80108605 <strncpy+0x25>
+801085f0:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+801085f4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+801085f7:	83 c0 01             	add    $0x1,%eax
+801085fa:	0f b6 4f ff          	movzbl -0x1(%edi),%ecx
+801085fe:	88 48 ff             	mov    %cl,-0x1(%eax)
+80108601:	84 c9                	test   %cl,%cl
+80108603:	74 13                	je     80108618 <strncpy+0x38>
+80108605:	89 d3                	mov    %edx,%ebx
+80108607:	83 ea 01             	sub    $0x1,%edx
+8010860a:	85 db                	test   %ebx,%ebx
+8010860c:	7f e2                	jg     801085f0 <strncpy+0x10>
+    ;
+  while(n-- > 0)
+    *s++ = 0;
+  return os;
+}
+8010860e:	5b                   	pop    %ebx
+8010860f:	89 f0                	mov    %esi,%eax
+80108611:	5e                   	pop    %esi
+80108612:	5f                   	pop    %edi
+80108613:	5d                   	pop    %ebp
+80108614:	c3                   	ret
+80108615:	8d 76 00             	lea    0x0(%esi),%esi
+  while(n-- > 0)
+80108618:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+8010861b:	83 e9 01             	sub    $0x1,%ecx
+8010861e:	85 d2                	test   %edx,%edx
+80108620:	74 ec                	je     8010860e <strncpy+0x2e>
+80108622:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *s++ = 0;
+80108628:	83 c0 01             	add    $0x1,%eax
+8010862b:	89 ca                	mov    %ecx,%edx
+8010862d:	c6 40 ff 00          	movb   $0x0,-0x1(%eax)
+  while(n-- > 0)
+80108631:	29 c2                	sub    %eax,%edx
+80108633:	85 d2                	test   %edx,%edx
+80108635:	7f f1                	jg     80108628 <strncpy+0x48>
+}
+80108637:	5b                   	pop    %ebx
+80108638:	89 f0                	mov    %esi,%eax
+8010863a:	5e                   	pop    %esi
+8010863b:	5f                   	pop    %edi
+8010863c:	5d                   	pop    %ebp
+8010863d:	c3                   	ret
+8010863e:	66 90                	xchg   %ax,%ax
+
+80108640 <safestrcpy>:
+
+// Like strncpy but guaranteed to NUL-terminate.
+char*
+safestrcpy(char *s, const char *t, int n)
+{
+80108640:	55                   	push   %ebp
+80108641:	89 e5                	mov    %esp,%ebp
+80108643:	56                   	push   %esi
+80108644:	53                   	push   %ebx
+80108645:	8b 55 10             	mov    0x10(%ebp),%edx
+80108648:	8b 75 08             	mov    0x8(%ebp),%esi
+8010864b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  char *os;
+
+  os = s;
+  if(n <= 0)
+8010864e:	85 d2                	test   %edx,%edx
+80108650:	7e 25                	jle    80108677 <safestrcpy+0x37>
+80108652:	8d 5c 10 ff          	lea    -0x1(%eax,%edx,1),%ebx
+80108656:	89 f2                	mov    %esi,%edx
+80108658:	eb 16                	jmp    80108670 <safestrcpy+0x30>
+8010865a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return os;
+  while(--n > 0 && (*s++ = *t++) != 0)
+80108660:	0f b6 08             	movzbl (%eax),%ecx
+80108663:	83 c0 01             	add    $0x1,%eax
+80108666:	83 c2 01             	add    $0x1,%edx
+80108669:	88 4a ff             	mov    %cl,-0x1(%edx)
+8010866c:	84 c9                	test   %cl,%cl
+8010866e:	74 04                	je     80108674 <safestrcpy+0x34>
+80108670:	39 d8                	cmp    %ebx,%eax
+80108672:	75 ec                	jne    80108660 <safestrcpy+0x20>
+    ;
+  *s = 0;
+80108674:	c6 02 00             	movb   $0x0,(%edx)
+  return os;
+}
+80108677:	89 f0                	mov    %esi,%eax
+80108679:	5b                   	pop    %ebx
+8010867a:	5e                   	pop    %esi
+8010867b:	5d                   	pop    %ebp
+8010867c:	c3                   	ret
+8010867d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80108680 <strlen>:
+
+int
+strlen(const char *s)
+{
+80108680:	55                   	push   %ebp
+  int n;
+
+  for(n = 0; s[n]; n++)
+80108681:	31 c0                	xor    %eax,%eax
+{
+80108683:	89 e5                	mov    %esp,%ebp
+80108685:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+80108688:	80 3a 00             	cmpb   $0x0,(%edx)
+8010868b:	74 0c                	je     80108699 <strlen+0x19>
+8010868d:	8d 76 00             	lea    0x0(%esi),%esi
+80108690:	83 c0 01             	add    $0x1,%eax
+80108693:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+80108697:	75 f7                	jne    80108690 <strlen+0x10>
+    ;
+  return n;
+}
+80108699:	5d                   	pop    %ebp
+8010869a:	c3                   	ret
+
+8010869b <swtch>:
+# a struct context, and save its address in *old.
+# Switch stacks to new and pop previously-saved registers.
+
+.globl swtch
+swtch:
+  movl 4(%esp), %eax
+8010869b:	8b 44 24 04          	mov    0x4(%esp),%eax
+  movl 8(%esp), %edx
+8010869f:	8b 54 24 08          	mov    0x8(%esp),%edx
+
+  # Save old callee-save registers
+  pushl %ebp
+801086a3:	55                   	push   %ebp
+  pushl %ebx
+801086a4:	53                   	push   %ebx
+  pushl %esi
+801086a5:	56                   	push   %esi
+  pushl %edi
+801086a6:	57                   	push   %edi
+
+  # Switch stacks
+  movl %esp, (%eax)
+801086a7:	89 20                	mov    %esp,(%eax)
+  movl %edx, %esp
+801086a9:	89 d4                	mov    %edx,%esp
+
+  # Load new callee-save registers
+  popl %edi
+801086ab:	5f                   	pop    %edi
+  popl %esi
+801086ac:	5e                   	pop    %esi
+  popl %ebx
+801086ad:	5b                   	pop    %ebx
+  popl %ebp
+801086ae:	5d                   	pop    %ebp
+  ret
+801086af:	c3                   	ret
+
+801086b0 <fetchint>:
+// to a saved program counter, and then the first argument.
+
+// Fetch the int at addr from the current process.
+int
+fetchint(uint addr, int *ip)
+{
+801086b0:	55                   	push   %ebp
+801086b1:	89 e5                	mov    %esp,%ebp
+801086b3:	53                   	push   %ebx
+801086b4:	83 ec 04             	sub    $0x4,%esp
+801086b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *curproc = myproc();
+801086ba:	e8 b1 e7 ff ff       	call   80106e70 <myproc>
+
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+801086bf:	8b 10                	mov    (%eax),%edx
+801086c1:	39 d3                	cmp    %edx,%ebx
+801086c3:	73 33                	jae    801086f8 <fetchint+0x48>
+801086c5:	8d 4b 04             	lea    0x4(%ebx),%ecx
+801086c8:	39 ca                	cmp    %ecx,%edx
+801086ca:	72 2c                	jb     801086f8 <fetchint+0x48>
+    return -1;
+  if(uvmtouch(curproc->pgdir, addr, 4, curproc->sz, 0) < 0)
+801086cc:	83 ec 0c             	sub    $0xc,%esp
+801086cf:	6a 00                	push   $0x0
+801086d1:	52                   	push   %edx
+801086d2:	6a 04                	push   $0x4
+801086d4:	53                   	push   %ebx
+801086d5:	ff 70 04             	push   0x4(%eax)
+801086d8:	e8 03 2e 00 00       	call   8010b4e0 <uvmtouch>
+801086dd:	83 c4 20             	add    $0x20,%esp
+801086e0:	85 c0                	test   %eax,%eax
+801086e2:	78 14                	js     801086f8 <fetchint+0x48>
+    return -1;
+  *ip = *(int*)(addr);
+801086e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+801086e7:	8b 13                	mov    (%ebx),%edx
+801086e9:	89 10                	mov    %edx,(%eax)
+  return 0;
+801086eb:	31 c0                	xor    %eax,%eax
+}
+801086ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801086f0:	c9                   	leave
+801086f1:	c3                   	ret
+801086f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+801086f8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801086fd:	eb ee                	jmp    801086ed <fetchint+0x3d>
+801086ff:	90                   	nop
+
+80108700 <argbuf>:
+// Check that the nth word-sized system call argument points to
+// size bytes within the process address space, and get them
+// ready for the kernel to read, or to write if write is set.
+static int
+argbuf(int n, char **pp, int size, int write)
+{
+80108700:	55                   	push   %ebp
+80108701:	89 e5                	mov    %esp,%ebp
+80108703:	57                   	push   %edi
+80108704:	56                   	push   %esi
+80108705:	89 c6                	mov    %eax,%esi
+80108707:	53                   	push   %ebx
+80108708:	89 cb                	mov    %ecx,%ebx
+8010870a:	83 ec 2c             	sub    $0x2c,%esp
+8010870d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  int i;
+  struct proc *curproc = myproc();
+80108710:	e8 5b e7 ff ff       	call   80106e70 <myproc>
+80108715:	89 c7                	mov    %eax,%edi
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80108717:	e8 54 e7 ff ff       	call   80106e70 <myproc>
+8010871c:	83 ec 08             	sub    $0x8,%esp
+8010871f:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+80108722:	51                   	push   %ecx
+80108723:	8b 40 18             	mov    0x18(%eax),%eax
+80108726:	8b 40 44             	mov    0x44(%eax),%eax
+80108729:	8d 44 b0 04          	lea    0x4(%eax,%esi,4),%eax
+8010872d:	50                   	push   %eax
+8010872e:	e8 7d ff ff ff       	call   801086b0 <fetchint>
+ 
+  if(argint(n, &i) < 0)
+    return -1;
+  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+80108733:	83 c4 10             	add    $0x10,%esp
+80108736:	09 d8                	or     %ebx,%eax
+80108738:	78 3e                	js     80108778 <argbuf+0x78>
+8010873a:	8b 07                	mov    (%edi),%eax
+8010873c:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+8010873f:	39 c6                	cmp    %eax,%esi
+80108741:	73 35                	jae    80108778 <argbuf+0x78>
+80108743:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+80108746:	39 c8                	cmp    %ecx,%eax
+80108748:	72 2e                	jb     80108778 <argbuf+0x78>
+    return -1;
+  // Heap pages not yet touched, and shared copy-on-write pages
+  // the kernel will write, get memory now, while running out
+  // can still fail the system call.
+  if(uvmtouch(curproc->pgdir, i, size, curproc->sz, write) < 0)
+8010874a:	83 ec 0c             	sub    $0xc,%esp
+8010874d:	ff 75 08             	push   0x8(%ebp)
+80108750:	50                   	push   %eax
+80108751:	53                   	push   %ebx
+80108752:	56                   	push   %esi
+80108753:	ff 77 04             	push   0x4(%edi)
+80108756:	e8 85 2d 00 00       	call   8010b4e0 <uvmtouch>
+8010875b:	83 c4 20             	add    $0x20,%esp
+8010875e:	85 c0                	test   %eax,%eax
+80108760:	78 16                	js     80108778 <argbuf+0x78>
+    return -1;
+  *pp = (char*)i;
+80108762:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80108765:	89 30                	mov    %esi,(%eax)
+  return 0;
+80108767:	31 c0                	xor    %eax,%eax
+}
+80108769:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010876c:	5b                   	pop    %ebx
+8010876d:	5e                   	pop    %esi
+8010876e:	5f                   	pop    %edi
+8010876f:	5d                   	pop    %ebp
+80108770:	c3                   	ret
+80108771:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+80108778:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010877d:	eb ea                	jmp    80108769 <argbuf+0x69>
+8010877f:	90                   	nop
+
+80108780 <fetchstr>:
+{
+80108780:	55                   	push   %ebp
+80108781:	89 e5                	mov    %esp,%ebp
+80108783:	57                   	push   %edi
+80108784:	56                   	push   %esi
+80108785:	53                   	push   %ebx
+80108786:	83 ec 0c             	sub    $0xc,%esp
+80108789:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *curproc = myproc();
+8010878c:	e8 df e6 ff ff       	call   80106e70 <myproc>
+  if(addr >= curproc->sz)
+80108791:	3b 18                	cmp    (%eax),%ebx
+80108793:	73 63                	jae    801087f8 <fetchstr+0x78>
+80108795:	89 c6                	mov    %eax,%esi
+  *pp = (char*)addr;
+80108797:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010879a:	89 18                	mov    %ebx,(%eax)
+  ep = (char*)curproc->sz;
+8010879c:	8b 3e                	mov    (%esi),%edi
+  for(s = *pp; s < ep; s++){
+8010879e:	39 fb                	cmp    %edi,%ebx
+801087a0:	73 56                	jae    801087f8 <fetchstr+0x78>
+801087a2:	89 d8                	mov    %ebx,%eax
+801087a4:	eb 16                	jmp    801087bc <fetchstr+0x3c>
+801087a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801087ad:	8d 76 00             	lea    0x0(%esi),%esi
+801087b0:	83 c3 01             	add    $0x1,%ebx
+801087b3:	39 fb                	cmp    %edi,%ebx
+801087b5:	73 41                	jae    801087f8 <fetchstr+0x78>
+      return s - *pp;
+801087b7:	8b 45 0c             	mov    0xc(%ebp),%eax
+801087ba:	8b 00                	mov    (%eax),%eax
+    if((s == *pp || (uint)s % PGSIZE == 0) &&
+801087bc:	39 d8                	cmp    %ebx,%eax
+801087be:	74 08                	je     801087c8 <fetchstr+0x48>
+801087c0:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+801087c6:	75 19                	jne    801087e1 <fetchstr+0x61>
+       uvmtouch(curproc->pgdir, (uint)s, 1, curproc->sz, 0) < 0)
+801087c8:	83 ec 0c             	sub    $0xc,%esp
+801087cb:	6a 00                	push   $0x0
+801087cd:	ff 36                	push   (%esi)
+801087cf:	6a 01                	push   $0x1
+801087d1:	53                   	push   %ebx
+801087d2:	ff 76 04             	push   0x4(%esi)
+801087d5:	e8 06 2d 00 00       	call   8010b4e0 <uvmtouch>
+    if((s == *pp || (uint)s % PGSIZE == 0) &&
+801087da:	83 c4 20             	add    $0x20,%esp
+801087dd:	85 c0                	test   %eax,%eax
+801087df:	78 17                	js     801087f8 <fetchstr+0x78>
+    if(*s == 0)
+801087e1:	80 3b 00             	cmpb   $0x0,(%ebx)
+801087e4:	75 ca                	jne    801087b0 <fetchstr+0x30>
+      return s - *pp;
+801087e6:	8b 55 0c             	mov    0xc(%ebp),%edx
+801087e9:	89 d8                	mov    %ebx,%eax
+801087eb:	2b 02                	sub    (%edx),%eax
+}
+801087ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801087f0:	5b                   	pop    %ebx
+801087f1:	5e                   	pop    %esi
+801087f2:	5f                   	pop    %edi
+801087f3:	5d                   	pop    %ebp
+801087f4:	c3                   	ret
+801087f5:	8d 76 00             	lea    0x0(%esi),%esi
+801087f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+801087fb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108800:	5b                   	pop    %ebx
+80108801:	5e                   	pop    %esi
+80108802:	5f                   	pop    %edi
+80108803:	5d                   	pop    %ebp
+80108804:	c3                   	ret
+80108805:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010880c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108810 <argint>:
+{
+80108810:	55                   	push   %ebp
+80108811:	89 e5                	mov    %esp,%ebp
+80108813:	56                   	push   %esi
+80108814:	53                   	push   %ebx
+80108815:	8b 75 0c             	mov    0xc(%ebp),%esi
+80108818:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+8010881b:	e8 50 e6 ff ff       	call   80106e70 <myproc>
+80108820:	89 75 0c             	mov    %esi,0xc(%ebp)
+80108823:	8b 40 18             	mov    0x18(%eax),%eax
+80108826:	8b 40 44             	mov    0x44(%eax),%eax
+80108829:	8d 44 98 04          	lea    0x4(%eax,%ebx,4),%eax
+8010882d:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80108830:	5b                   	pop    %ebx
+80108831:	5e                   	pop    %esi
+80108832:	5d                   	pop    %ebp
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80108833:	e9 78 fe ff ff       	jmp    801086b0 <fetchint>
+80108838:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010883f:	90                   	nop
+
+80108840 <argptr>:
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes that the kernel reads.
+// Check that the pointer lies within the process address space.
+int
+argptr(int n, char **pp, int size)
+{
+80108840:	55                   	push   %ebp
+80108841:	89 e5                	mov    %esp,%ebp
+80108843:	8b 45 08             	mov    0x8(%ebp),%eax
+  return argbuf(n, pp, size, 0);
+80108846:	8b 4d 10             	mov    0x10(%ebp),%ecx
+80108849:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+80108850:	8b 55 0c             	mov    0xc(%ebp),%edx
+}
+80108853:	5d                   	pop    %ebp
+  return argbuf(n, pp, size, 0);
+80108854:	e9 a7 fe ff ff       	jmp    80108700 <argbuf>
+80108859:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80108860 <argptrw>:
+
+// Like argptr, for a block of memory the kernel writes.
+int
+argptrw(int n, char **pp, int size)
+{
+80108860:	55                   	push   %ebp
+80108861:	89 e5                	mov    %esp,%ebp
+80108863:	8b 45 08             	mov    0x8(%ebp),%eax
+  return argbuf(n, pp, size, 1);
+80108866:	8b 4d 10             	mov    0x10(%ebp),%ecx
+80108869:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+80108870:	8b 55 0c             	mov    0xc(%ebp),%edx
+}
+80108873:	5d                   	pop    %ebp
+  return argbuf(n, pp, size, 1);
+80108874:	e9 87 fe ff ff       	jmp    80108700 <argbuf>
+80108879:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80108880 <argstr>:
+// Check that the pointer is valid and the string is nul-terminated.
+// (There is no shared writable memory, so the string can't change
+// between this check and being used by the kernel.)
+int
+argstr(int n, char **pp)
+{
+80108880:	55                   	push   %ebp
+80108881:	89 e5                	mov    %esp,%ebp
+80108883:	56                   	push   %esi
+80108884:	53                   	push   %ebx
+80108885:	83 ec 10             	sub    $0x10,%esp
+80108888:	8b 75 08             	mov    0x8(%ebp),%esi
+8010888b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+8010888e:	e8 dd e5 ff ff       	call   80106e70 <myproc>
+80108893:	83 ec 08             	sub    $0x8,%esp
+80108896:	8d 55 f4             	lea    -0xc(%ebp),%edx
+80108899:	52                   	push   %edx
+8010889a:	8b 40 18             	mov    0x18(%eax),%eax
+8010889d:	8b 40 44             	mov    0x44(%eax),%eax
+801088a0:	8d 44 b0 04          	lea    0x4(%eax,%esi,4),%eax
+801088a4:	50                   	push   %eax
+801088a5:	e8 06 fe ff ff       	call   801086b0 <fetchint>
+  int addr;
+  if(argint(n, &addr) < 0)
+801088aa:	83 c4 10             	add    $0x10,%esp
+801088ad:	85 c0                	test   %eax,%eax
+801088af:	78 17                	js     801088c8 <argstr+0x48>
+    return -1;
+  return fetchstr(addr, pp);
+801088b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+801088b4:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+801088b7:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+801088ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801088bd:	5b                   	pop    %ebx
+801088be:	5e                   	pop    %esi
+801088bf:	5d                   	pop    %ebp
+  return fetchstr(addr, pp);
+801088c0:	e9 bb fe ff ff       	jmp    80108780 <fetchstr>
+801088c5:	8d 76 00             	lea    0x0(%esi),%esi
+}
+801088c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801088cb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801088d0:	5b                   	pop    %ebx
+801088d1:	5e                   	pop    %esi
+801088d2:	5d                   	pop    %ebp
+801088d3:	c3                   	ret
+801088d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801088db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801088df:	90                   	nop
+
+801088e0 <syscall>:
+[SYS_copyrange] sys_copyrange,
+};
+
+void
+syscall(void)
+{
+801088e0:	55                   	push   %ebp
+801088e1:	89 e5                	mov    %esp,%ebp
+801088e3:	53                   	push   %ebx
+801088e4:	83 ec 04             	sub    $0x4,%esp
+  int num;
+  struct proc *curproc = myproc();
+801088e7:	e8 84 e5 ff ff       	call   80106e70 <myproc>
+801088ec:	89 c3                	mov    %eax,%ebx
+
+  num = curproc->tf->eax;
+801088ee:	8b 40 18             	mov    0x18(%eax),%eax
+801088f1:	8b 40 1c             	mov    0x1c(%eax),%eax
+  if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+801088f4:	8d 50 ff             	lea    -0x1(%eax),%edx
+801088f7:	83 fa 18             	cmp    $0x18,%edx
+801088fa:	77 24                	ja     80108920 <syscall+0x40>
+801088fc:	8b 14 85 e0 be 10 80 	mov    -0x7fef4120(,%eax,4),%edx
+80108903:	85 d2                	test   %edx,%edx
+80108905:	74 19                	je     80108920 <syscall+0x40>
+    curproc->tf->eax = syscalls[num]();
+80108907:	ff d2                	call   *%edx
+80108909:	89 c2                	mov    %eax,%edx
+8010890b:	8b 43 18             	mov    0x18(%ebx),%eax
+8010890e:	89 50 1c             	mov    %edx,0x1c(%eax)
+  } else {
+    cprintf("%d %s: unknown sys call %d\n",
+            curproc->pid, curproc->name, num);
+    curproc->tf->eax = -1;
+  }
+}
+80108911:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108914:	c9                   	leave
+80108915:	c3                   	ret
+80108916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010891d:	8d 76 00             	lea    0x0(%esi),%esi
+    cprintf("%d %s: unknown sys call %d\n",
+80108920:	50                   	push   %eax
+            curproc->pid, curproc->name, num);
+80108921:	8d 43 6c             	lea    0x6c(%ebx),%eax
+    cprintf("%d %s: unknown sys call %d\n",
+80108924:	50                   	push   %eax
+80108925:	ff 73 10             	push   0x10(%ebx)
+80108928:	68 b9 be 10 80       	push   $0x8010beb9
+8010892d:	e8 5e 80 ff ff       	call   80100990 <cprintf>
+    curproc->tf->eax = -1;
+80108932:	8b 43 18             	mov    0x18(%ebx),%eax
+80108935:	83 c4 10             	add    $0x10,%esp
+80108938:	c7 40 1c ff ff ff ff 	movl   $0xffffffff,0x1c(%eax)
+}
+8010893f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108942:	c9                   	leave
+80108943:	c3                   	ret
+80108944:	66 90                	xchg   %ax,%ax
+80108946:	66 90                	xchg   %ax,%ax
+80108948:	66 90                	xchg   %ax,%ax
+8010894a:	66 90                	xchg   %ax,%ax
+8010894c:	66 90                	xchg   %ax,%ax
+8010894e:	66 90                	xchg   %ax,%ax
+
+80108950 <create>:
+  return -1;
+}
+
+static struct inode*
+create(char *path, short type, short major, short minor)
+{
+80108950:	55                   	push   %ebp
+80108951:	89 e5                	mov    %esp,%ebp
+80108953:	57                   	push   %edi
+80108954:	56                   	push   %esi
+  uint off;
+  struct inode *ip, *dp;
+  char name[DIRSIZ];
+
+  if((dp = nameiparent(path, name)) == 0)
+80108955:	8d 7d da             	lea    -0x26(%ebp),%edi
+{
+80108958:	53                   	push   %ebx
+80108959:	83 ec 44             	sub    $0x44,%esp
+8010895c:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+8010895f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80108962:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+80108965:	89 4d bc             	mov    %ecx,-0x44(%ebp)
+  if((dp = nameiparent(path, name)) == 0)
+80108968:	57                   	push   %edi
+80108969:	50                   	push   %eax
+8010896a:	e8 d1 b7 ff ff       	call   80104140 <nameiparent>
+8010896f:	83 c4 10             	add    $0x10,%esp
+80108972:	85 c0                	test   %eax,%eax
+80108974:	74 5e                	je     801089d4 <create+0x84>
+    return 0;
+  ilock(dp);
+80108976:	83 ec 0c             	sub    $0xc,%esp
+80108979:	89 c3                	mov    %eax,%ebx
+8010897b:	50                   	push   %eax
+8010897c:	e8 ef 9f ff ff       	call   80102970 <ilock>
+
+  if((ip = dirlookup(dp, name, &off)) != 0){
+80108981:	83 c4 0c             	add    $0xc,%esp
+80108984:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+80108987:	50                   	push   %eax
+80108988:	57                   	push   %edi
+80108989:	53                   	push   %ebx
+8010898a:	e8 21 b1 ff ff       	call   80103ab0 <dirlookup>
+8010898f:	83 c4 10             	add    $0x10,%esp
+80108992:	89 c6                	mov    %eax,%esi
+80108994:	85 c0                	test   %eax,%eax
+80108996:	74 48                	je     801089e0 <create+0x90>
+    iunlockput(dp);
+80108998:	83 ec 0c             	sub    $0xc,%esp
+8010899b:	53                   	push   %ebx
+8010899c:	e8 1f a5 ff ff       	call   80102ec0 <iunlockput>
+    ilock(ip);
+801089a1:	89 34 24             	mov    %esi,(%esp)
+801089a4:	e8 c7 9f ff ff       	call   80102970 <ilock>
+    if(type == T_FILE && ip->type == T_FILE)
+801089a9:	83 c4 10             	add    $0x10,%esp
+801089ac:	66 83 7d c4 02       	cmpw   $0x2,-0x3c(%ebp)
+801089b1:	75 15                	jne    801089c8 <create+0x78>
+801089b3:	66 83 7e 70 02       	cmpw   $0x2,0x70(%esi)
+801089b8:	75 0e                	jne    801089c8 <create+0x78>
+  }
+
+  iunlockput(dp);
+
+  return ip;
+}
+801089ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801089bd:	89 f0                	mov    %esi,%eax
+801089bf:	5b                   	pop    %ebx
+801089c0:	5e                   	pop    %esi
+801089c1:	5f                   	pop    %edi
+801089c2:	5d                   	pop    %ebp
+801089c3:	c3                   	ret
+801089c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iunlockput(ip);
+801089c8:	83 ec 0c             	sub    $0xc,%esp
+801089cb:	56                   	push   %esi
+801089cc:	e8 ef a4 ff ff       	call   80102ec0 <iunlockput>
+    return 0;
+801089d1:	83 c4 10             	add    $0x10,%esp
+    return 0;
+801089d4:	31 f6                	xor    %esi,%esi
+}
+801089d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801089d9:	89 f0                	mov    %esi,%eax
+801089db:	5b                   	pop    %ebx
+801089dc:	5e                   	pop    %esi
+801089dd:	5f                   	pop    %edi
+801089de:	5d                   	pop    %ebp
+801089df:	c3                   	ret
+  if((ip = ialloc(dp->dev, type)) == 0)
+801089e0:	0f bf 45 c4          	movswl -0x3c(%ebp),%eax
+801089e4:	83 ec 08             	sub    $0x8,%esp
+801089e7:	50                   	push   %eax
+801089e8:	ff 33                	push   (%ebx)
+801089ea:	e8 b1 9d ff ff       	call   801027a0 <ialloc>
+801089ef:	83 c4 10             	add    $0x10,%esp
+801089f2:	89 c6                	mov    %eax,%esi
+801089f4:	85 c0                	test   %eax,%eax
+801089f6:	0f 84 fd 00 00 00    	je     80108af9 <create+0x1a9>
+  ilock(ip);
+801089fc:	83 ec 0c             	sub    $0xc,%esp
+801089ff:	50                   	push   %eax
+80108a00:	e8 6b 9f ff ff       	call   80102970 <ilock>
+  ip->major = major;
+80108a05:	0f b7 45 c0          	movzwl -0x40(%ebp),%eax
+  ip->nlink = 1;
+80108a09:	ba 01 00 00 00       	mov    $0x1,%edx
+80108a0e:	66 89 56 78          	mov    %dx,0x78(%esi)
+  ip->major = major;
+80108a12:	66 89 46 72          	mov    %ax,0x72(%esi)
+  ip->minor = minor;
+80108a16:	0f b7 45 bc          	movzwl -0x44(%ebp),%eax
+80108a1a:	66 89 46 74          	mov    %ax,0x74(%esi)
+  iupdate(ip);
+80108a1e:	89 34 24             	mov    %esi,(%esp)
+80108a21:	e8 8a 9e ff ff       	call   801028b0 <iupdate>
+  if(type == T_DIR){  // Create . and .. entries.
+80108a26:	83 c4 10             	add    $0x10,%esp
+80108a29:	66 83 7d c4 01       	cmpw   $0x1,-0x3c(%ebp)
+80108a2e:	74 30                	je     80108a60 <create+0x110>
+  if(dirlink(dp, name, ip->inum) < 0){
+80108a30:	83 ec 04             	sub    $0x4,%esp
+80108a33:	ff 76 04             	push   0x4(%esi)
+80108a36:	57                   	push   %edi
+80108a37:	53                   	push   %ebx
+80108a38:	e8 53 b5 ff ff       	call   80103f90 <dirlink>
+80108a3d:	83 c4 10             	add    $0x10,%esp
+80108a40:	85 c0                	test   %eax,%eax
+80108a42:	78 7f                	js     80108ac3 <create+0x173>
+  iunlockput(dp);
+80108a44:	83 ec 0c             	sub    $0xc,%esp
+80108a47:	53                   	push   %ebx
+80108a48:	e8 73 a4 ff ff       	call   80102ec0 <iunlockput>
+  return ip;
+80108a4d:	83 c4 10             	add    $0x10,%esp
+}
+80108a50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108a53:	89 f0                	mov    %esi,%eax
+80108a55:	5b                   	pop    %ebx
+80108a56:	5e                   	pop    %esi
+80108a57:	5f                   	pop    %edi
+80108a58:	5d                   	pop    %ebp
+80108a59:	c3                   	ret
+80108a5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    iupdate(dp);
+80108a60:	83 ec 0c             	sub    $0xc,%esp
+    dp->nlink++;  // for ".."
+80108a63:	66 83 43 78 01       	addw   $0x1,0x78(%ebx)
+    iupdate(dp);
+80108a68:	53                   	push   %ebx
+80108a69:	e8 42 9e ff ff       	call   801028b0 <iupdate>
+    if(dirlink(ip, ".", ip->inum) < 0 || dirlink(ip, "..", dp->inum) < 0)
+80108a6e:	83 c4 0c             	add    $0xc,%esp
+80108a71:	ff 76 04             	push   0x4(%esi)
+80108a74:	68 64 bf 10 80       	push   $0x8010bf64
+80108a79:	56                   	push   %esi
+80108a7a:	e8 11 b5 ff ff       	call   80103f90 <dirlink>
+80108a7f:	83 c4 10             	add    $0x10,%esp
+80108a82:	85 c0                	test   %eax,%eax
+80108a84:	78 66                	js     80108aec <create+0x19c>
+80108a86:	83 ec 04             	sub    $0x4,%esp
+80108a89:	ff 73 04             	push   0x4(%ebx)
+80108a8c:	68 63 bf 10 80       	push   $0x8010bf63
+80108a91:	56                   	push   %esi
+80108a92:	e8 f9 b4 ff ff       	call   80103f90 <dirlink>
+80108a97:	83 c4 10             	add    $0x10,%esp
+80108a9a:	85 c0                	test   %eax,%eax
+80108a9c:	78 4e                	js     80108aec <create+0x19c>
+  if(dirlink(dp, name, ip->inum) < 0){
+80108a9e:	83 ec 04             	sub    $0x4,%esp
+80108aa1:	ff 76 04             	push   0x4(%esi)
+80108aa4:	57                   	push   %edi
+80108aa5:	53                   	push   %ebx
+80108aa6:	e8 e5 b4 ff ff       	call   80103f90 <dirlink>
+80108aab:	83 c4 10             	add    $0x10,%esp
+80108aae:	85 c0                	test   %eax,%eax
+80108ab0:	79 92                	jns    80108a44 <create+0xf4>
+      iupdate(dp);
+80108ab2:	83 ec 0c             	sub    $0xc,%esp
+      dp->nlink--;
+80108ab5:	66 83 6b 78 01       	subw   $0x1,0x78(%ebx)
+      iupdate(dp);
+80108aba:	53                   	push   %ebx
+80108abb:	e8 f0 9d ff ff       	call   801028b0 <iupdate>
+80108ac0:	83 c4 10             	add    $0x10,%esp
+    iupdate(ip);
+80108ac3:	83 ec 0c             	sub    $0xc,%esp
+    ip->nlink = 0;
+80108ac6:	31 c0                	xor    %eax,%eax
+80108ac8:	66 89 46 78          	mov    %ax,0x78(%esi)
+    iupdate(ip);
+80108acc:	56                   	push   %esi
+80108acd:	e8 de 9d ff ff       	call   801028b0 <iupdate>
+    iunlockput(ip);
+80108ad2:	89 34 24             	mov    %esi,(%esp)
+    return 0;
+80108ad5:	31 f6                	xor    %esi,%esi
+    iunlockput(ip);
+80108ad7:	e8 e4 a3 ff ff       	call   80102ec0 <iunlockput>
+    iunlockput(dp);
+80108adc:	89 1c 24             	mov    %ebx,(%esp)
+80108adf:	e8 dc a3 ff ff       	call   80102ec0 <iunlockput>
+    return 0;
+80108ae4:	83 c4 10             	add    $0x10,%esp
+80108ae7:	e9 ea fe ff ff       	jmp    801089d6 <create+0x86>
+      panic("create dots");
+80108aec:	83 ec 0c             	sub    $0xc,%esp
+80108aef:	68 57 bf 10 80       	push   $0x8010bf57
+80108af4:	e8 67 7b ff ff       	call   80100660 <panic>
+    panic("create: ialloc");
+80108af9:	83 ec 0c             	sub    $0xc,%esp
+80108afc:	68 48 bf 10 80       	push   $0x8010bf48
+80108b01:	e8 5a 7b ff ff       	call   80100660 <panic>
+80108b06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108b0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80108b10 <sys_dup>:
+{
+80108b10:	55                   	push   %ebp
+80108b11:	89 e5                	mov    %esp,%ebp
+80108b13:	56                   	push   %esi
+80108b14:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80108b15:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80108b18:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80108b1b:	50                   	push   %eax
+80108b1c:	6a 00                	push   $0x0
+80108b1e:	e8 ed fc ff ff       	call   80108810 <argint>
+80108b23:	83 c4 10             	add    $0x10,%esp
+80108b26:	85 c0                	test   %eax,%eax
+80108b28:	78 36                	js     80108b60 <sys_dup+0x50>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80108b2a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80108b2e:	77 30                	ja     80108b60 <sys_dup+0x50>
+80108b30:	e8 3b e3 ff ff       	call   80106e70 <myproc>
+80108b35:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80108b38:	8b 74 90 28          	mov    0x28(%eax,%edx,4),%esi
+80108b3c:	85 f6                	test   %esi,%esi
+80108b3e:	74 20                	je     80108b60 <sys_dup+0x50>
+  struct proc *curproc = myproc();
+80108b40:	e8 2b e3 ff ff       	call   80106e70 <myproc>
+  for(fd = 0; fd < NOFILE; fd++){
+80108b45:	31 db                	xor    %ebx,%ebx
+80108b47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108b4e:	66 90                	xchg   %ax,%ax
+    if(curproc->ofile[fd] == 0){
+80108b50:	8b 54 98 28          	mov    0x28(%eax,%ebx,4),%edx
+80108b54:	85 d2                	test   %edx,%edx
+80108b56:	74 18                	je     80108b70 <sys_dup+0x60>
+  for(fd = 0; fd < NOFILE; fd++){
+80108b58:	83 c3 01             	add    $0x1,%ebx
+80108b5b:	83 fb 10             	cmp    $0x10,%ebx
+80108b5e:	75 f0                	jne    80108b50 <sys_dup+0x40>
+}
+80108b60:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return -1;
+80108b63:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+}
+80108b68:	89 d8                	mov    %ebx,%eax
+80108b6a:	5b                   	pop    %ebx
+80108b6b:	5e                   	pop    %esi
+80108b6c:	5d                   	pop    %ebp
+80108b6d:	c3                   	ret
+80108b6e:	66 90                	xchg   %ax,%ax
+  filedup(f);
+80108b70:	83 ec 0c             	sub    $0xc,%esp
+      curproc->ofile[fd] = f;
+80108b73:	89 74 98 28          	mov    %esi,0x28(%eax,%ebx,4)
+  filedup(f);
+80108b77:	56                   	push   %esi
+80108b78:	e8 53 88 ff ff       	call   801013d0 <filedup>
+  return fd;
+80108b7d:	83 c4 10             	add    $0x10,%esp
+}
+80108b80:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108b83:	89 d8                	mov    %ebx,%eax
+80108b85:	5b                   	pop    %ebx
+80108b86:	5e                   	pop    %esi
+80108b87:	5d                   	pop    %ebp
+80108b88:	c3                   	ret
+80108b89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80108b90 <sys_read>:
+{
+80108b90:	55                   	push   %ebp
+80108b91:	89 e5                	mov    %esp,%ebp
+80108b93:	56                   	push   %esi
+80108b94:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80108b95:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80108b98:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80108b9b:	53                   	push   %ebx
+80108b9c:	6a 00                	push   $0x0
+80108b9e:	e8 6d fc ff ff       	call   80108810 <argint>
+80108ba3:	83 c4 10             	add    $0x10,%esp
+80108ba6:	85 c0                	test   %eax,%eax
+80108ba8:	78 5e                	js     80108c08 <sys_read+0x78>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80108baa:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80108bae:	77 58                	ja     80108c08 <sys_read+0x78>
+80108bb0:	e8 bb e2 ff ff       	call   80106e70 <myproc>
+80108bb5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80108bb8:	8b 74 90 28          	mov    0x28(%eax,%edx,4),%esi
+80108bbc:	85 f6                	test   %esi,%esi
+80108bbe:	74 48                	je     80108c08 <sys_read+0x78>
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptrw(1, &p, n) < 0)
+80108bc0:	83 ec 08             	sub    $0x8,%esp
+80108bc3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108bc6:	50                   	push   %eax
+80108bc7:	6a 02                	push   $0x2
+80108bc9:	e8 42 fc ff ff       	call   80108810 <argint>
+80108bce:	83 c4 10             	add    $0x10,%esp
+80108bd1:	85 c0                	test   %eax,%eax
+80108bd3:	78 33                	js     80108c08 <sys_read+0x78>
+80108bd5:	83 ec 04             	sub    $0x4,%esp
+80108bd8:	ff 75 f0             	push   -0x10(%ebp)
+80108bdb:	53                   	push   %ebx
+80108bdc:	6a 01                	push   $0x1
+80108bde:	e8 7d fc ff ff       	call   80108860 <argptrw>
+80108be3:	83 c4 10             	add    $0x10,%esp
+80108be6:	85 c0                	test   %eax,%eax
+80108be8:	78 1e                	js     80108c08 <sys_read+0x78>
+  return fileread(f, p, n);
+80108bea:	83 ec 04             	sub    $0x4,%esp
+80108bed:	ff 75 f0             	push   -0x10(%ebp)
+80108bf0:	ff 75 f4             	push   -0xc(%ebp)
+80108bf3:	56                   	push   %esi
+80108bf4:	e8 57 89 ff ff       	call   80101550 <fileread>
+80108bf9:	83 c4 10             	add    $0x10,%esp
+}
+80108bfc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108bff:	5b                   	pop    %ebx
+80108c00:	5e                   	pop    %esi
+80108c01:	5d                   	pop    %ebp
+80108c02:	c3                   	ret
+80108c03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108c07:	90                   	nop
+    return -1;
+80108c08:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108c0d:	eb ed                	jmp    80108bfc <sys_read+0x6c>
+80108c0f:	90                   	nop
+
+80108c10 <sys_write>:
+{
+80108c10:	55                   	push   %ebp
+80108c11:	89 e5                	mov    %esp,%ebp
+80108c13:	56                   	push   %esi
+80108c14:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80108c15:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80108c18:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80108c1b:	53                   	push   %ebx
+80108c1c:	6a 00                	push   $0x0
+80108c1e:	e8 ed fb ff ff       	call   80108810 <argint>
+80108c23:	83 c4 10             	add    $0x10,%esp
+80108c26:	85 c0                	test   %eax,%eax
+80108c28:	78 5e                	js     80108c88 <sys_write+0x78>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80108c2a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80108c2e:	77 58                	ja     80108c88 <sys_write+0x78>
+80108c30:	e8 3b e2 ff ff       	call   80106e70 <myproc>
+80108c35:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80108c38:	8b 74 90 28          	mov    0x28(%eax,%edx,4),%esi
+80108c3c:	85 f6                	test   %esi,%esi
+80108c3e:	74 48                	je     80108c88 <sys_write+0x78>
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+80108c40:	83 ec 08             	sub    $0x8,%esp
+80108c43:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108c46:	50                   	push   %eax
+80108c47:	6a 02                	push   $0x2
+80108c49:	e8 c2 fb ff ff       	call   80108810 <argint>
+80108c4e:	83 c4 10             	add    $0x10,%esp
+80108c51:	85 c0                	test   %eax,%eax
+80108c53:	78 33                	js     80108c88 <sys_write+0x78>
+80108c55:	83 ec 04             	sub    $0x4,%esp
+80108c58:	ff 75 f0             	push   -0x10(%ebp)
+80108c5b:	53                   	push   %ebx
+80108c5c:	6a 01                	push   $0x1
+80108c5e:	e8 dd fb ff ff       	call   80108840 <argptr>
+80108c63:	83 c4 10             	add    $0x10,%esp
+80108c66:	85 c0                	test   %eax,%eax
+80108c68:	78 1e                	js     80108c88 <sys_write+0x78>
+  return filewrite(f, p, n);
+80108c6a:	83 ec 04             	sub    $0x4,%esp
+80108c6d:	ff 75 f0             	push   -0x10(%ebp)
+80108c70:	ff 75 f4             	push   -0xc(%ebp)
+80108c73:	56                   	push   %esi
+80108c74:	e8 67 89 ff ff       	call   801015e0 <filewrite>
+80108c79:	83 c4 10             	add    $0x10,%esp
+}
+80108c7c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108c7f:	5b                   	pop    %ebx
+80108c80:	5e                   	pop    %esi
+80108c81:	5d                   	pop    %ebp
+80108c82:	c3                   	ret
+80108c83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108c87:	90                   	nop
+    return -1;
+80108c88:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108c8d:	eb ed                	jmp    80108c7c <sys_write+0x6c>
+80108c8f:	90                   	nop
+
+80108c90 <sys_close>:
+{
+80108c90:	55                   	push   %ebp
+80108c91:	89 e5                	mov    %esp,%ebp
+80108c93:	56                   	push   %esi
+80108c94:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80108c95:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80108c98:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80108c9b:	50                   	push   %eax
+80108c9c:	6a 00                	push   $0x0
+80108c9e:	e8 6d fb ff ff       	call   80108810 <argint>
+80108ca3:	83 c4 10             	add    $0x10,%esp
+80108ca6:	85 c0                	test   %eax,%eax
+80108ca8:	78 3e                	js     80108ce8 <sys_close+0x58>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80108caa:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80108cae:	77 38                	ja     80108ce8 <sys_close+0x58>
+80108cb0:	e8 bb e1 ff ff       	call   80106e70 <myproc>
+80108cb5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80108cb8:	8d 5a 08             	lea    0x8(%edx),%ebx
+80108cbb:	8b 74 98 08          	mov    0x8(%eax,%ebx,4),%esi
+80108cbf:	85 f6                	test   %esi,%esi
+80108cc1:	74 25                	je     80108ce8 <sys_close+0x58>
+  myproc()->ofile[fd] = 0;
+80108cc3:	e8 a8 e1 ff ff       	call   80106e70 <myproc>
+  fileclose(f);
+80108cc8:	83 ec 0c             	sub    $0xc,%esp
+  myproc()->ofile[fd] = 0;
+80108ccb:	c7 44 98 08 00 00 00 	movl   $0x0,0x8(%eax,%ebx,4)
+80108cd2:	00 
+  fileclose(f);
+80108cd3:	56                   	push   %esi
+80108cd4:	e8 47 87 ff ff       	call   80101420 <fileclose>
+  return 0;
+80108cd9:	83 c4 10             	add    $0x10,%esp
+80108cdc:	31 c0                	xor    %eax,%eax
+}
+80108cde:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108ce1:	5b                   	pop    %ebx
+80108ce2:	5e                   	pop    %esi
+80108ce3:	5d                   	pop    %ebp
+80108ce4:	c3                   	ret
+80108ce5:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80108ce8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108ced:	eb ef                	jmp    80108cde <sys_close+0x4e>
+80108cef:	90                   	nop
+
+80108cf0 <sys_fstat>:
+{
+80108cf0:	55                   	push   %ebp
+80108cf1:	89 e5                	mov    %esp,%ebp
+80108cf3:	56                   	push   %esi
+80108cf4:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80108cf5:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80108cf8:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80108cfb:	53                   	push   %ebx
+80108cfc:	6a 00                	push   $0x0
+80108cfe:	e8 0d fb ff ff       	call   80108810 <argint>
+80108d03:	83 c4 10             	add    $0x10,%esp
+80108d06:	85 c0                	test   %eax,%eax
+80108d08:	78 46                	js     80108d50 <sys_fstat+0x60>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80108d0a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80108d0e:	77 40                	ja     80108d50 <sys_fstat+0x60>
+80108d10:	e8 5b e1 ff ff       	call   80106e70 <myproc>
+80108d15:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80108d18:	8b 74 90 28          	mov    0x28(%eax,%edx,4),%esi
+80108d1c:	85 f6                	test   %esi,%esi
+80108d1e:	74 30                	je     80108d50 <sys_fstat+0x60>
+  if(argfd(0, 0, &f) < 0 || argptrw(1, (void*)&st, sizeof(*st)) < 0)
+80108d20:	83 ec 04             	sub    $0x4,%esp
+80108d23:	6a 14                	push   $0x14
+80108d25:	53                   	push   %ebx
+80108d26:	6a 01                	push   $0x1
+80108d28:	e8 33 fb ff ff       	call   80108860 <argptrw>
+80108d2d:	83 c4 10             	add    $0x10,%esp
+80108d30:	85 c0                	test   %eax,%eax
+80108d32:	78 1c                	js     80108d50 <sys_fstat+0x60>
+  return filestat(f, st);
+80108d34:	83 ec 08             	sub    $0x8,%esp
+80108d37:	ff 75 f4             	push   -0xc(%ebp)
+80108d3a:	56                   	push   %esi
+80108d3b:	e8 c0 87 ff ff       	call   80101500 <filestat>
+80108d40:	83 c4 10             	add    $0x10,%esp
+}
+80108d43:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108d46:	5b                   	pop    %ebx
+80108d47:	5e                   	pop    %esi
+80108d48:	5d                   	pop    %ebp
+80108d49:	c3                   	ret
+80108d4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+80108d50:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108d55:	eb ec                	jmp    80108d43 <sys_fstat+0x53>
+80108d57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108d5e:	66 90                	xchg   %ax,%ax
+
+80108d60 <sys_link>:
+{
+80108d60:	55                   	push   %ebp
+80108d61:	89 e5                	mov    %esp,%ebp
+80108d63:	57                   	push   %edi
+80108d64:	56                   	push   %esi
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+80108d65:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+{
+80108d68:	53                   	push   %ebx
+80108d69:	83 ec 34             	sub    $0x34,%esp
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+80108d6c:	50                   	push   %eax
+80108d6d:	6a 00                	push   $0x0
+80108d6f:	e8 0c fb ff ff       	call   80108880 <argstr>
+80108d74:	83 c4 10             	add    $0x10,%esp
+80108d77:	85 c0                	test   %eax,%eax
+80108d79:	0f 88 fb 00 00 00    	js     80108e7a <sys_link+0x11a>
+80108d7f:	83 ec 08             	sub    $0x8,%esp
+80108d82:	8d 45 d0             	lea    -0x30(%ebp),%eax
+80108d85:	50                   	push   %eax
+80108d86:	6a 01                	push   $0x1
+80108d88:	e8 f3 fa ff ff       	call   80108880 <argstr>
+80108d8d:	83 c4 10             	add    $0x10,%esp
+80108d90:	85 c0                	test   %eax,%eax
+80108d92:	0f 88 e2 00 00 00    	js     80108e7a <sys_link+0x11a>
+  begin_op();
+80108d98:	e8 23 cd ff ff       	call   80105ac0 <begin_op>
+  if((ip = namei(old)) == 0){
+80108d9d:	83 ec 0c             	sub    $0xc,%esp
+80108da0:	ff 75 d4             	push   -0x2c(%ebp)
+80108da3:	e8 78 b3 ff ff       	call   80104120 <namei>
+80108da8:	83 c4 10             	add    $0x10,%esp
+80108dab:	89 c3                	mov    %eax,%ebx
+80108dad:	85 c0                	test   %eax,%eax
+80108daf:	0f 84 df 00 00 00    	je     80108e94 <sys_link+0x134>
+  ilock(ip);
+80108db5:	83 ec 0c             	sub    $0xc,%esp
+80108db8:	50                   	push   %eax
+80108db9:	e8 b2 9b ff ff       	call   80102970 <ilock>
+  if(ip->type == T_DIR){
+80108dbe:	83 c4 10             	add    $0x10,%esp
+80108dc1:	66 83 7b 70 01       	cmpw   $0x1,0x70(%ebx)
+80108dc6:	0f 84 b5 00 00 00    	je     80108e81 <sys_link+0x121>
+  iupdate(ip);
+80108dcc:	83 ec 0c             	sub    $0xc,%esp
+  ip->nlink++;
+80108dcf:	66 83 43 78 01       	addw   $0x1,0x78(%ebx)
+  if((dp = nameiparent(new, name)) == 0)
+80108dd4:	8d 7d da             	lea    -0x26(%ebp),%edi
+  iupdate(ip);
+80108dd7:	53                   	push   %ebx
+80108dd8:	e8 d3 9a ff ff       	call   801028b0 <iupdate>
+  iunlock(ip);
+80108ddd:	89 1c 24             	mov    %ebx,(%esp)
+80108de0:	e8 6b 9c ff ff       	call   80102a50 <iunlock>
+  if((dp = nameiparent(new, name)) == 0)
+80108de5:	58                   	pop    %eax
+80108de6:	5a                   	pop    %edx
+80108de7:	57                   	push   %edi
+80108de8:	ff 75 d0             	push   -0x30(%ebp)
+80108deb:	e8 50 b3 ff ff       	call   80104140 <nameiparent>
+80108df0:	83 c4 10             	add    $0x10,%esp
+80108df3:	89 c6                	mov    %eax,%esi
+80108df5:	85 c0                	test   %eax,%eax
+80108df7:	74 5b                	je     80108e54 <sys_link+0xf4>
+  ilock(dp);
+80108df9:	83 ec 0c             	sub    $0xc,%esp
+80108dfc:	50                   	push   %eax
+80108dfd:	e8 6e 9b ff ff       	call   80102970 <ilock>
+  if(dp->dev != ip->dev || dirlink(dp, name, ip->inum) < 0){
+80108e02:	8b 03                	mov    (%ebx),%eax
+80108e04:	83 c4 10             	add    $0x10,%esp
+80108e07:	39 06                	cmp    %eax,(%esi)
+80108e09:	75 3d                	jne    80108e48 <sys_link+0xe8>
+80108e0b:	83 ec 04             	sub    $0x4,%esp
+80108e0e:	ff 73 04             	push   0x4(%ebx)
+80108e11:	57                   	push   %edi
+80108e12:	56                   	push   %esi
+80108e13:	e8 78 b1 ff ff       	call   80103f90 <dirlink>
+80108e18:	83 c4 10             	add    $0x10,%esp
+80108e1b:	85 c0                	test   %eax,%eax
+80108e1d:	78 29                	js     80108e48 <sys_link+0xe8>
+  iunlockput(dp);
+80108e1f:	83 ec 0c             	sub    $0xc,%esp
+80108e22:	56                   	push   %esi
+80108e23:	e8 98 a0 ff ff       	call   80102ec0 <iunlockput>
+  iput(ip);
+80108e28:	89 1c 24             	mov    %ebx,(%esp)
+80108e2b:	e8 40 9d ff ff       	call   80102b70 <iput>
+  end_op();
+80108e30:	e8 bb cc ff ff       	call   80105af0 <end_op>
+  return 0;
+80108e35:	83 c4 10             	add    $0x10,%esp
+80108e38:	31 c0                	xor    %eax,%eax
+}
+80108e3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108e3d:	5b                   	pop    %ebx
+80108e3e:	5e                   	pop    %esi
+80108e3f:	5f                   	pop    %edi
+80108e40:	5d                   	pop    %ebp
+80108e41:	c3                   	ret
+80108e42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    iunlockput(dp);
+80108e48:	83 ec 0c             	sub    $0xc,%esp
+80108e4b:	56                   	push   %esi
+80108e4c:	e8 6f a0 ff ff       	call   80102ec0 <iunlockput>
+    goto bad;
+80108e51:	83 c4 10             	add    $0x10,%esp
+  ilock(ip);
+80108e54:	83 ec 0c             	sub    $0xc,%esp
+80108e57:	53                   	push   %ebx
+80108e58:	e8 13 9b ff ff       	call   80102970 <ilock>
+  ip->nlink--;
+80108e5d:	66 83 6b 78 01       	subw   $0x1,0x78(%ebx)
+  iupdate(ip);
+80108e62:	89 1c 24             	mov    %ebx,(%esp)
+80108e65:	e8 46 9a ff ff       	call   801028b0 <iupdate>
+  iunlockput(ip);
+80108e6a:	89 1c 24             	mov    %ebx,(%esp)
+80108e6d:	e8 4e a0 ff ff       	call   80102ec0 <iunlockput>
+  end_op();
+80108e72:	e8 79 cc ff ff       	call   80105af0 <end_op>
+  return -1;
+80108e77:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80108e7a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108e7f:	eb b9                	jmp    80108e3a <sys_link+0xda>
+    iunlockput(ip);
+80108e81:	83 ec 0c             	sub    $0xc,%esp
+80108e84:	53                   	push   %ebx
+80108e85:	e8 36 a0 ff ff       	call   80102ec0 <iunlockput>
+    end_op();
+80108e8a:	e8 61 cc ff ff       	call   80105af0 <end_op>
+    return -1;
+80108e8f:	83 c4 10             	add    $0x10,%esp
+80108e92:	eb e6                	jmp    80108e7a <sys_link+0x11a>
+    end_op();
+80108e94:	e8 57 cc ff ff       	call   80105af0 <end_op>
+    return -1;
+80108e99:	eb df                	jmp    80108e7a <sys_link+0x11a>
+80108e9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108e9f:	90                   	nop
+
+80108ea0 <sys_unlink>:
+{
+80108ea0:	55                   	push   %ebp
+80108ea1:	89 e5                	mov    %esp,%ebp
+80108ea3:	57                   	push   %edi
+80108ea4:	56                   	push   %esi
+  if(argstr(0, &path) < 0)
+80108ea5:	8d 45 c0             	lea    -0x40(%ebp),%eax
+{
+80108ea8:	53                   	push   %ebx
+80108ea9:	83 ec 54             	sub    $0x54,%esp
+  if(argstr(0, &path) < 0)
+80108eac:	50                   	push   %eax
+80108ead:	6a 00                	push   $0x0
+80108eaf:	e8 cc f9 ff ff       	call   80108880 <argstr>
+80108eb4:	83 c4 10             	add    $0x10,%esp
+80108eb7:	85 c0                	test   %eax,%eax
+80108eb9:	0f 88 a1 01 00 00    	js     80109060 <sys_unlink+0x1c0>
+  begin_op();
+80108ebf:	e8 fc cb ff ff       	call   80105ac0 <begin_op>
+  if((dp = nameiparent(path, name)) == 0){
+80108ec4:	83 ec 08             	sub    $0x8,%esp
+80108ec7:	8d 45 ca             	lea    -0x36(%ebp),%eax
+80108eca:	50                   	push   %eax
+80108ecb:	ff 75 c0             	push   -0x40(%ebp)
+80108ece:	e8 6d b2 ff ff       	call   80104140 <nameiparent>
+80108ed3:	83 c4 10             	add    $0x10,%esp
+80108ed6:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+80108ed9:	85 c0                	test   %eax,%eax
+80108edb:	0f 84 a8 01 00 00    	je     80109089 <sys_unlink+0x1e9>
+  ilock(dp);
+80108ee1:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+80108ee4:	83 ec 0c             	sub    $0xc,%esp
+80108ee7:	53                   	push   %ebx
+80108ee8:	e8 83 9a ff ff       	call   80102970 <ilock>
+  if(namecmp(name, ".") == 0 || namecmp(name, "..") == 0)
+80108eed:	8d 45 ca             	lea    -0x36(%ebp),%eax
+80108ef0:	5e                   	pop    %esi
+80108ef1:	5f                   	pop    %edi
+80108ef2:	68 64 bf 10 80       	push   $0x8010bf64
+80108ef7:	50                   	push   %eax
+80108ef8:	e8 03 a5 ff ff       	call   80103400 <namecmp>
+80108efd:	83 c4 10             	add    $0x10,%esp
+80108f00:	85 c0                	test   %eax,%eax
+80108f02:	0f 84 45 01 00 00    	je     8010904d <sys_unlink+0x1ad>
+80108f08:	83 ec 08             	sub    $0x8,%esp
+80108f0b:	8d 45 ca             	lea    -0x36(%ebp),%eax
+80108f0e:	68 63 bf 10 80       	push   $0x8010bf63
+80108f13:	50                   	push   %eax
+80108f14:	e8 e7 a4 ff ff       	call   80103400 <namecmp>
+80108f19:	83 c4 10             	add    $0x10,%esp
+80108f1c:	85 c0                	test   %eax,%eax
+80108f1e:	0f 84 29 01 00 00    	je     8010904d <sys_unlink+0x1ad>
+  if((ip = dirlookup(dp, name, &off)) == 0)
+80108f24:	83 ec 04             	sub    $0x4,%esp
+80108f27:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+80108f2a:	50                   	push   %eax
+80108f2b:	8d 45 ca             	lea    -0x36(%ebp),%eax
+80108f2e:	50                   	push   %eax
+80108f2f:	53                   	push   %ebx
+80108f30:	e8 7b ab ff ff       	call   80103ab0 <dirlookup>
+80108f35:	83 c4 10             	add    $0x10,%esp
+80108f38:	89 c7                	mov    %eax,%edi
+80108f3a:	85 c0                	test   %eax,%eax
+80108f3c:	0f 84 0b 01 00 00    	je     8010904d <sys_unlink+0x1ad>
+  ilock(ip);
+80108f42:	83 ec 0c             	sub    $0xc,%esp
+80108f45:	50                   	push   %eax
+80108f46:	e8 25 9a ff ff       	call   80102970 <ilock>
+  if(ip->nlink < 1)
+80108f4b:	83 c4 10             	add    $0x10,%esp
+80108f4e:	66 83 7f 78 00       	cmpw   $0x0,0x78(%edi)
+80108f53:	0f 8e 51 01 00 00    	jle    801090aa <sys_unlink+0x20a>
+  if(ip->type == T_DIR && !isdirempty(ip)){
+80108f59:	66 83 7f 70 01       	cmpw   $0x1,0x70(%edi)
+80108f5e:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+80108f61:	74 75                	je     80108fd8 <sys_unlink+0x138>
+  memset(&de, 0, sizeof(de));
+80108f63:	83 ec 04             	sub    $0x4,%esp
+80108f66:	6a 10                	push   $0x10
+80108f68:	6a 00                	push   $0x0
+80108f6a:	53                   	push   %ebx
+80108f6b:	e8 20 f5 ff ff       	call   80108490 <memset>
+  dcinvalidate(dp, name);
+80108f70:	58                   	pop    %eax
+80108f71:	8d 45 ca             	lea    -0x36(%ebp),%eax
+80108f74:	5a                   	pop    %edx
+80108f75:	50                   	push   %eax
+80108f76:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+80108f79:	56                   	push   %esi
+80108f7a:	e8 a1 a4 ff ff       	call   80103420 <dcinvalidate>
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80108f7f:	6a 10                	push   $0x10
+80108f81:	ff 75 c4             	push   -0x3c(%ebp)
+80108f84:	53                   	push   %ebx
+80108f85:	56                   	push   %esi
+80108f86:	e8 55 a1 ff ff       	call   801030e0 <writei>
+80108f8b:	83 c4 20             	add    $0x20,%esp
+80108f8e:	83 f8 10             	cmp    $0x10,%eax
+80108f91:	0f 85 06 01 00 00    	jne    8010909d <sys_unlink+0x1fd>
+  if(ip->type == T_DIR){
+80108f97:	66 83 7f 70 01       	cmpw   $0x1,0x70(%edi)
+80108f9c:	0f 84 ce 00 00 00    	je     80109070 <sys_unlink+0x1d0>
+  iunlockput(dp);
+80108fa2:	83 ec 0c             	sub    $0xc,%esp
+80108fa5:	ff 75 b4             	push   -0x4c(%ebp)
+80108fa8:	e8 13 9f ff ff       	call   80102ec0 <iunlockput>
+  ip->nlink--;
+80108fad:	66 83 6f 78 01       	subw   $0x1,0x78(%edi)
+  iupdate(ip);
+80108fb2:	89 3c 24             	mov    %edi,(%esp)
+80108fb5:	e8 f6 98 ff ff       	call   801028b0 <iupdate>
+  iunlockput(ip);
+80108fba:	89 3c 24             	mov    %edi,(%esp)
+80108fbd:	e8 fe 9e ff ff       	call   80102ec0 <iunlockput>
+  end_op();
+80108fc2:	e8 29 cb ff ff       	call   80105af0 <end_op>
+  return 0;
+80108fc7:	83 c4 10             	add    $0x10,%esp
+80108fca:	31 c0                	xor    %eax,%eax
+}
+80108fcc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108fcf:	5b                   	pop    %ebx
+80108fd0:	5e                   	pop    %esi
+80108fd1:	5f                   	pop    %edi
+80108fd2:	5d                   	pop    %ebp
+80108fd3:	c3                   	ret
+80108fd4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(off=0; off<dp->size; off+=sizeof(de)){
+80108fd8:	8b 4f 7c             	mov    0x7c(%edi),%ecx
+80108fdb:	85 c9                	test   %ecx,%ecx
+80108fdd:	74 84                	je     80108f63 <sys_unlink+0xc3>
+80108fdf:	31 f6                	xor    %esi,%esi
+80108fe1:	eb 11                	jmp    80108ff4 <sys_unlink+0x154>
+80108fe3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108fe7:	90                   	nop
+80108fe8:	83 c6 10             	add    $0x10,%esi
+80108feb:	3b 77 7c             	cmp    0x7c(%edi),%esi
+80108fee:	0f 83 6f ff ff ff    	jae    80108f63 <sys_unlink+0xc3>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80108ff4:	6a 10                	push   $0x10
+80108ff6:	56                   	push   %esi
+80108ff7:	53                   	push   %ebx
+80108ff8:	57                   	push   %edi
+80108ff9:	e8 42 9f ff ff       	call   80102f40 <readi>
+80108ffe:	83 c4 10             	add    $0x10,%esp
+80109001:	83 f8 10             	cmp    $0x10,%eax
+80109004:	0f 85 86 00 00 00    	jne    80109090 <sys_unlink+0x1f0>
+    if(de.inum != 0 && namecmp(de.name, ".") != 0 &&
+8010900a:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+8010900f:	74 d7                	je     80108fe8 <sys_unlink+0x148>
+80109011:	83 ec 08             	sub    $0x8,%esp
+80109014:	8d 45 da             	lea    -0x26(%ebp),%eax
+80109017:	68 64 bf 10 80       	push   $0x8010bf64
+8010901c:	50                   	push   %eax
+8010901d:	e8 de a3 ff ff       	call   80103400 <namecmp>
+80109022:	83 c4 10             	add    $0x10,%esp
+80109025:	85 c0                	test   %eax,%eax
+80109027:	74 bf                	je     80108fe8 <sys_unlink+0x148>
+       namecmp(de.name, "..") != 0)
+80109029:	83 ec 08             	sub    $0x8,%esp
+8010902c:	8d 45 da             	lea    -0x26(%ebp),%eax
+8010902f:	68 63 bf 10 80       	push   $0x8010bf63
+80109034:	50                   	push   %eax
+80109035:	e8 c6 a3 ff ff       	call   80103400 <namecmp>
+    if(de.inum != 0 && namecmp(de.name, ".") != 0 &&
+8010903a:	83 c4 10             	add    $0x10,%esp
+8010903d:	85 c0                	test   %eax,%eax
+8010903f:	74 a7                	je     80108fe8 <sys_unlink+0x148>
+    iunlockput(ip);
+80109041:	83 ec 0c             	sub    $0xc,%esp
+80109044:	57                   	push   %edi
+80109045:	e8 76 9e ff ff       	call   80102ec0 <iunlockput>
+    goto bad;
+8010904a:	83 c4 10             	add    $0x10,%esp
+  iunlockput(dp);
+8010904d:	83 ec 0c             	sub    $0xc,%esp
+80109050:	ff 75 b4             	push   -0x4c(%ebp)
+80109053:	e8 68 9e ff ff       	call   80102ec0 <iunlockput>
+  end_op();
+80109058:	e8 93 ca ff ff       	call   80105af0 <end_op>
+  return -1;
+8010905d:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80109060:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80109065:	e9 62 ff ff ff       	jmp    80108fcc <sys_unlink+0x12c>
+8010906a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    dp->nlink--;
+80109070:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    iupdate(dp);
+80109073:	83 ec 0c             	sub    $0xc,%esp
+    dp->nlink--;
+80109076:	66 83 68 78 01       	subw   $0x1,0x78(%eax)
+    iupdate(dp);
+8010907b:	50                   	push   %eax
+8010907c:	e8 2f 98 ff ff       	call   801028b0 <iupdate>
+80109081:	83 c4 10             	add    $0x10,%esp
+80109084:	e9 19 ff ff ff       	jmp    80108fa2 <sys_unlink+0x102>
+    end_op();
+80109089:	e8 62 ca ff ff       	call   80105af0 <end_op>
+    return -1;
+8010908e:	eb d0                	jmp    80109060 <sys_unlink+0x1c0>
+      panic("isdirempty: readi");
+80109090:	83 ec 0c             	sub    $0xc,%esp
+80109093:	68 78 bf 10 80       	push   $0x8010bf78
+80109098:	e8 c3 75 ff ff       	call   80100660 <panic>
+    panic("unlink: writei");
+8010909d:	83 ec 0c             	sub    $0xc,%esp
+801090a0:	68 8a bf 10 80       	push   $0x8010bf8a
+801090a5:	e8 b6 75 ff ff       	call   80100660 <panic>
+    panic("unlink: nlink < 1");
+801090aa:	83 ec 0c             	sub    $0xc,%esp
+801090ad:	68 66 bf 10 80       	push   $0x8010bf66
+801090b2:	e8 a9 75 ff ff       	call   80100660 <panic>
+801090b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801090be:	66 90                	xchg   %ax,%ax
+
+801090c0 <sys_open>:
+
+int
+sys_open(void)
+{
+801090c0:	55                   	push   %ebp
+801090c1:	89 e5                	mov    %esp,%ebp
+801090c3:	57                   	push   %edi
+801090c4:	56                   	push   %esi
+  char *path;
+  int fd, omode;
+  struct file *f;
+  struct inode *ip;
+
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+801090c5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+801090c8:	53                   	push   %ebx
+801090c9:	83 ec 24             	sub    $0x24,%esp
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+801090cc:	50                   	push   %eax
+801090cd:	6a 00                	push   $0x0
+801090cf:	e8 ac f7 ff ff       	call   80108880 <argstr>
+801090d4:	83 c4 10             	add    $0x10,%esp
+801090d7:	85 c0                	test   %eax,%eax
+801090d9:	0f 88 a2 00 00 00    	js     80109181 <sys_open+0xc1>
+801090df:	83 ec 08             	sub    $0x8,%esp
+801090e2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+801090e5:	50                   	push   %eax
+801090e6:	6a 01                	push   $0x1
+801090e8:	e8 23 f7 ff ff       	call   80108810 <argint>
+801090ed:	83 c4 10             	add    $0x10,%esp
+801090f0:	85 c0                	test   %eax,%eax
+801090f2:	0f 88 89 00 00 00    	js     80109181 <sys_open+0xc1>
+    return -1;
+
+  begin_op();
+801090f8:	e8 c3 c9 ff ff       	call   80105ac0 <begin_op>
+
+  if(omode & O_CREATE){
+801090fd:	f6 45 e5 02          	testb  $0x2,-0x1b(%ebp)
+80109101:	0f 85 89 00 00 00    	jne    80109190 <sys_open+0xd0>
+       (ip->flags & I_EXTENT) == 0){
+      ip->flags |= I_EXTENT;
+      iupdate(ip);
+    }
+  } else {
+    if((ip = namei(path)) == 0){
+80109107:	83 ec 0c             	sub    $0xc,%esp
+8010910a:	ff 75 e0             	push   -0x20(%ebp)
+8010910d:	e8 0e b0 ff ff       	call   80104120 <namei>
+80109112:	83 c4 10             	add    $0x10,%esp
+80109115:	89 c6                	mov    %eax,%esi
+80109117:	85 c0                	test   %eax,%eax
+80109119:	0f 84 31 01 00 00    	je     80109250 <sys_open+0x190>
+      end_op();
+      return -1;
+    }
+    ilock(ip);
+8010911f:	83 ec 0c             	sub    $0xc,%esp
+80109122:	50                   	push   %eax
+80109123:	e8 48 98 ff ff       	call   80102970 <ilock>
+    if(ip->type == T_DIR && omode != O_RDONLY){
+80109128:	83 c4 10             	add    $0x10,%esp
+8010912b:	66 83 7e 70 01       	cmpw   $0x1,0x70(%esi)
+80109130:	0f 84 0a 01 00 00    	je     80109240 <sys_open+0x180>
+      end_op();
+      return -1;
+    }
+  }
+
+  if((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0){
+80109136:	e8 25 82 ff ff       	call   80101360 <filealloc>
+8010913b:	89 c7                	mov    %eax,%edi
+8010913d:	85 c0                	test   %eax,%eax
+8010913f:	74 2f                	je     80109170 <sys_open+0xb0>
+  struct proc *curproc = myproc();
+80109141:	e8 2a dd ff ff       	call   80106e70 <myproc>
+  for(fd = 0; fd < NOFILE; fd++){
+80109146:	31 db                	xor    %ebx,%ebx
+80109148:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010914f:	90                   	nop
+    if(curproc->ofile[fd] == 0){
+80109150:	8b 54 98 28          	mov    0x28(%eax,%ebx,4),%edx
+80109154:	85 d2                	test   %edx,%edx
+80109156:	0f 84 9c 00 00 00    	je     801091f8 <sys_open+0x138>
+  for(fd = 0; fd < NOFILE; fd++){
+8010915c:	83 c3 01             	add    $0x1,%ebx
+8010915f:	83 fb 10             	cmp    $0x10,%ebx
+80109162:	75 ec                	jne    80109150 <sys_open+0x90>
+    if(f)
+      fileclose(f);
+80109164:	83 ec 0c             	sub    $0xc,%esp
+80109167:	57                   	push   %edi
+80109168:	e8 b3 82 ff ff       	call   80101420 <fileclose>
+8010916d:	83 c4 10             	add    $0x10,%esp
+    iunlockput(ip);
+80109170:	83 ec 0c             	sub    $0xc,%esp
+80109173:	56                   	push   %esi
+80109174:	e8 47 9d ff ff       	call   80102ec0 <iunlockput>
+    end_op();
+80109179:	e8 72 c9 ff ff       	call   80105af0 <end_op>
+    return -1;
+8010917e:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80109181:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80109186:	e9 a6 00 00 00       	jmp    80109231 <sys_open+0x171>
+8010918b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010918f:	90                   	nop
+    ip = create(path, T_FILE, 0, 0);
+80109190:	83 ec 0c             	sub    $0xc,%esp
+80109193:	31 c9                	xor    %ecx,%ecx
+80109195:	ba 02 00 00 00       	mov    $0x2,%edx
+8010919a:	6a 00                	push   $0x0
+8010919c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010919f:	e8 ac f7 ff ff       	call   80108950 <create>
+    if(ip == 0){
+801091a4:	83 c4 10             	add    $0x10,%esp
+    ip = create(path, T_FILE, 0, 0);
+801091a7:	89 c6                	mov    %eax,%esi
+    if(ip == 0){
+801091a9:	85 c0                	test   %eax,%eax
+801091ab:	0f 84 9f 00 00 00    	je     80109250 <sys_open+0x190>
+    if((omode & O_EXTENT) && ip->type == T_FILE && ip->size == 0 &&
+801091b1:	f6 45 e5 04          	testb  $0x4,-0x1b(%ebp)
+801091b5:	0f 84 7b ff ff ff    	je     80109136 <sys_open+0x76>
+801091bb:	66 83 78 70 02       	cmpw   $0x2,0x70(%eax)
+801091c0:	0f 85 70 ff ff ff    	jne    80109136 <sys_open+0x76>
+801091c6:	8b 58 7c             	mov    0x7c(%eax),%ebx
+801091c9:	85 db                	test   %ebx,%ebx
+801091cb:	0f 85 65 ff ff ff    	jne    80109136 <sys_open+0x76>
+       (ip->flags & I_EXTENT) == 0){
+801091d1:	0f b7 40 76          	movzwl 0x76(%eax),%eax
+    if((omode & O_EXTENT) && ip->type == T_FILE && ip->size == 0 &&
+801091d5:	a8 01                	test   $0x1,%al
+801091d7:	0f 85 59 ff ff ff    	jne    80109136 <sys_open+0x76>
+      iupdate(ip);
+801091dd:	83 ec 0c             	sub    $0xc,%esp
+      ip->flags |= I_EXTENT;
+801091e0:	83 c8 01             	or     $0x1,%eax
+801091e3:	66 89 46 76          	mov    %ax,0x76(%esi)
+      iupdate(ip);
+801091e7:	56                   	push   %esi
+801091e8:	e8 c3 96 ff ff       	call   801028b0 <iupdate>
+801091ed:	83 c4 10             	add    $0x10,%esp
+801091f0:	e9 41 ff ff ff       	jmp    80109136 <sys_open+0x76>
+801091f5:	8d 76 00             	lea    0x0(%esi),%esi
+  }
+  iunlock(ip);
+801091f8:	83 ec 0c             	sub    $0xc,%esp
+      curproc->ofile[fd] = f;
+801091fb:	89 7c 98 28          	mov    %edi,0x28(%eax,%ebx,4)
+  iunlock(ip);
+801091ff:	56                   	push   %esi
+80109200:	e8 4b 98 ff ff       	call   80102a50 <iunlock>
+  end_op();
+80109205:	e8 e6 c8 ff ff       	call   80105af0 <end_op>
+
+  f->type = FD_INODE;
+8010920a:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  f->ip = ip;
+  f->off = 0;
+  f->readable = !(omode & O_WRONLY);
+80109210:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+80109213:	83 c4 10             	add    $0x10,%esp
+  f->ip = ip;
+80109216:	89 77 10             	mov    %esi,0x10(%edi)
+  f->readable = !(omode & O_WRONLY);
+80109219:	89 d0                	mov    %edx,%eax
+  f->off = 0;
+8010921b:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+  f->readable = !(omode & O_WRONLY);
+80109222:	f7 d0                	not    %eax
+80109224:	83 e0 01             	and    $0x1,%eax
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+80109227:	83 e2 03             	and    $0x3,%edx
+  f->readable = !(omode & O_WRONLY);
+8010922a:	88 47 08             	mov    %al,0x8(%edi)
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+8010922d:	0f 95 47 09          	setne  0x9(%edi)
+  return fd;
+}
+80109231:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109234:	89 d8                	mov    %ebx,%eax
+80109236:	5b                   	pop    %ebx
+80109237:	5e                   	pop    %esi
+80109238:	5f                   	pop    %edi
+80109239:	5d                   	pop    %ebp
+8010923a:	c3                   	ret
+8010923b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010923f:	90                   	nop
+    if(ip->type == T_DIR && omode != O_RDONLY){
+80109240:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80109243:	85 c9                	test   %ecx,%ecx
+80109245:	0f 84 eb fe ff ff    	je     80109136 <sys_open+0x76>
+8010924b:	e9 20 ff ff ff       	jmp    80109170 <sys_open+0xb0>
+      end_op();
+80109250:	e8 9b c8 ff ff       	call   80105af0 <end_op>
+      return -1;
+80109255:	e9 27 ff ff ff       	jmp    80109181 <sys_open+0xc1>
+8010925a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80109260 <sys_mkdir>:
+
+int
+sys_mkdir(void)
+{
+80109260:	55                   	push   %ebp
+80109261:	89 e5                	mov    %esp,%ebp
+80109263:	83 ec 18             	sub    $0x18,%esp
+  char *path;
+  struct inode *ip;
+
+  begin_op();
+80109266:	e8 55 c8 ff ff       	call   80105ac0 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
+8010926b:	83 ec 08             	sub    $0x8,%esp
+8010926e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109271:	50                   	push   %eax
+80109272:	6a 00                	push   $0x0
+80109274:	e8 07 f6 ff ff       	call   80108880 <argstr>
+80109279:	83 c4 10             	add    $0x10,%esp
+8010927c:	85 c0                	test   %eax,%eax
+8010927e:	78 30                	js     801092b0 <sys_mkdir+0x50>
+80109280:	83 ec 0c             	sub    $0xc,%esp
+80109283:	31 c9                	xor    %ecx,%ecx
+80109285:	ba 01 00 00 00       	mov    $0x1,%edx
+8010928a:	6a 00                	push   $0x0
+8010928c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+8010928f:	e8 bc f6 ff ff       	call   80108950 <create>
+80109294:	83 c4 10             	add    $0x10,%esp
+80109297:	85 c0                	test   %eax,%eax
+80109299:	74 15                	je     801092b0 <sys_mkdir+0x50>
+    end_op();
+    return -1;
+  }
+  iunlockput(ip);
+8010929b:	83 ec 0c             	sub    $0xc,%esp
+8010929e:	50                   	push   %eax
+8010929f:	e8 1c 9c ff ff       	call   80102ec0 <iunlockput>
+  end_op();
+801092a4:	e8 47 c8 ff ff       	call   80105af0 <end_op>
+  return 0;
+801092a9:	83 c4 10             	add    $0x10,%esp
+801092ac:	31 c0                	xor    %eax,%eax
+}
+801092ae:	c9                   	leave
+801092af:	c3                   	ret
+    end_op();
+801092b0:	e8 3b c8 ff ff       	call   80105af0 <end_op>
+    return -1;
+801092b5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801092ba:	c9                   	leave
+801092bb:	c3                   	ret
+801092bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801092c0 <sys_mknod>:
+
+int
+sys_mknod(void)
+{
+801092c0:	55                   	push   %ebp
+801092c1:	89 e5                	mov    %esp,%ebp
+801092c3:	83 ec 18             	sub    $0x18,%esp
+  struct inode *ip;
+  char *path;
+  int major, minor;
+
+  begin_op();
+801092c6:	e8 f5 c7 ff ff       	call   80105ac0 <begin_op>
+  if((argstr(0, &path)) < 0 ||
+801092cb:	83 ec 08             	sub    $0x8,%esp
+801092ce:	8d 45 ec             	lea    -0x14(%ebp),%eax
+801092d1:	50                   	push   %eax
+801092d2:	6a 00                	push   $0x0
+801092d4:	e8 a7 f5 ff ff       	call   80108880 <argstr>
+801092d9:	83 c4 10             	add    $0x10,%esp
+801092dc:	85 c0                	test   %eax,%eax
+801092de:	78 60                	js     80109340 <sys_mknod+0x80>
+     argint(1, &major) < 0 ||
+801092e0:	83 ec 08             	sub    $0x8,%esp
+801092e3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801092e6:	50                   	push   %eax
+801092e7:	6a 01                	push   $0x1
+801092e9:	e8 22 f5 ff ff       	call   80108810 <argint>
+  if((argstr(0, &path)) < 0 ||
+801092ee:	83 c4 10             	add    $0x10,%esp
+801092f1:	85 c0                	test   %eax,%eax
+801092f3:	78 4b                	js     80109340 <sys_mknod+0x80>
+     argint(2, &minor) < 0 ||
+801092f5:	83 ec 08             	sub    $0x8,%esp
+801092f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801092fb:	50                   	push   %eax
+801092fc:	6a 02                	push   $0x2
+801092fe:	e8 0d f5 ff ff       	call   80108810 <argint>
+     argint(1, &major) < 0 ||
+80109303:	83 c4 10             	add    $0x10,%esp
+80109306:	85 c0                	test   %eax,%eax
+80109308:	78 36                	js     80109340 <sys_mknod+0x80>
+     (ip = create(path, T_DEV, major, minor)) == 0){
+8010930a:	0f bf 45 f4          	movswl -0xc(%ebp),%eax
+8010930e:	83 ec 0c             	sub    $0xc,%esp
+80109311:	0f bf 4d f0          	movswl -0x10(%ebp),%ecx
+80109315:	ba 03 00 00 00       	mov    $0x3,%edx
+8010931a:	50                   	push   %eax
+8010931b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+8010931e:	e8 2d f6 ff ff       	call   80108950 <create>
+     argint(2, &minor) < 0 ||
+80109323:	83 c4 10             	add    $0x10,%esp
+80109326:	85 c0                	test   %eax,%eax
+80109328:	74 16                	je     80109340 <sys_mknod+0x80>
+    end_op();
+    return -1;
+  }
+  iunlockput(ip);
+8010932a:	83 ec 0c             	sub    $0xc,%esp
+8010932d:	50                   	push   %eax
+8010932e:	e8 8d 9b ff ff       	call   80102ec0 <iunlockput>
+  end_op();
+80109333:	e8 b8 c7 ff ff       	call   80105af0 <end_op>
+  return 0;
+80109338:	83 c4 10             	add    $0x10,%esp
+8010933b:	31 c0                	xor    %eax,%eax
+}
+8010933d:	c9                   	leave
+8010933e:	c3                   	ret
+8010933f:	90                   	nop
+    end_op();
+80109340:	e8 ab c7 ff ff       	call   80105af0 <end_op>
+    return -1;
+80109345:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010934a:	c9                   	leave
+8010934b:	c3                   	ret
+8010934c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80109350 <sys_chdir>:
+
+int
+sys_chdir(void)
+{
+80109350:	55                   	push   %ebp
+80109351:	89 e5                	mov    %esp,%ebp
+80109353:	56                   	push   %esi
+80109354:	53                   	push   %ebx
+80109355:	83 ec 10             	sub    $0x10,%esp
+  char *path;
+  struct inode *ip;
+  struct proc *curproc = myproc();
+80109358:	e8 13 db ff ff       	call   80106e70 <myproc>
+8010935d:	89 c6                	mov    %eax,%esi
+  
+  begin_op();
+8010935f:	e8 5c c7 ff ff       	call   80105ac0 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = namei(path)) == 0){
+80109364:	83 ec 08             	sub    $0x8,%esp
+80109367:	8d 45 f4             	lea    -0xc(%ebp),%eax
+8010936a:	50                   	push   %eax
+8010936b:	6a 00                	push   $0x0
+8010936d:	e8 0e f5 ff ff       	call   80108880 <argstr>
+80109372:	83 c4 10             	add    $0x10,%esp
+80109375:	85 c0                	test   %eax,%eax
+80109377:	78 77                	js     801093f0 <sys_chdir+0xa0>
+80109379:	83 ec 0c             	sub    $0xc,%esp
+8010937c:	ff 75 f4             	push   -0xc(%ebp)
+8010937f:	e8 9c ad ff ff       	call   80104120 <namei>
+80109384:	83 c4 10             	add    $0x10,%esp
+80109387:	89 c3                	mov    %eax,%ebx
+80109389:	85 c0                	test   %eax,%eax
+8010938b:	74 63                	je     801093f0 <sys_chdir+0xa0>
+    end_op();
+    return -1;
+  }
+  ilock(ip);
+8010938d:	83 ec 0c             	sub    $0xc,%esp
+80109390:	50                   	push   %eax
+80109391:	e8 da 95 ff ff       	call   80102970 <ilock>
+  if(ip->type != T_DIR){
+80109396:	83 c4 10             	add    $0x10,%esp
+80109399:	66 83 7b 70 01       	cmpw   $0x1,0x70(%ebx)
+8010939e:	75 30                	jne    801093d0 <sys_chdir+0x80>
+    iunlockput(ip);
+    end_op();
+    return -1;
+  }
+  iunlock(ip);
+801093a0:	83 ec 0c             	sub    $0xc,%esp
+801093a3:	53                   	push   %ebx
+801093a4:	e8 a7 96 ff ff       	call   80102a50 <iunlock>
+  iput(curproc->cwd);
+801093a9:	58                   	pop    %eax
+801093aa:	ff 76 68             	push   0x68(%esi)
+801093ad:	e8 be 97 ff ff       	call   80102b70 <iput>
+  end_op();
+801093b2:	e8 39 c7 ff ff       	call   80105af0 <end_op>
+  curproc->cwd = ip;
+801093b7:	89 5e 68             	mov    %ebx,0x68(%esi)
+  return 0;
+801093ba:	83 c4 10             	add    $0x10,%esp
+801093bd:	31 c0                	xor    %eax,%eax
+}
+801093bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801093c2:	5b                   	pop    %ebx
+801093c3:	5e                   	pop    %esi
+801093c4:	5d                   	pop    %ebp
+801093c5:	c3                   	ret
+801093c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801093cd:	8d 76 00             	lea    0x0(%esi),%esi
+    iunlockput(ip);
+801093d0:	83 ec 0c             	sub    $0xc,%esp
+801093d3:	53                   	push   %ebx
+801093d4:	e8 e7 9a ff ff       	call   80102ec0 <iunlockput>
+    end_op();
+801093d9:	e8 12 c7 ff ff       	call   80105af0 <end_op>
+    return -1;
+801093de:	83 c4 10             	add    $0x10,%esp
+    return -1;
+801093e1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801093e6:	eb d7                	jmp    801093bf <sys_chdir+0x6f>
+801093e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801093ef:	90                   	nop
+    end_op();
+801093f0:	e8 fb c6 ff ff       	call   80105af0 <end_op>
+    return -1;
+801093f5:	eb ea                	jmp    801093e1 <sys_chdir+0x91>
+801093f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801093fe:	66 90                	xchg   %ax,%ax
+
+80109400 <sys_exec>:
+
+int
+sys_exec(void)
+{
+80109400:	55                   	push   %ebp
+80109401:	89 e5                	mov    %esp,%ebp
+80109403:	57                   	push   %edi
+80109404:	56                   	push   %esi
+  char *path, *argv[MAXARG];
+  int i;
+  uint uargv, uarg;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+80109405:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+{
+8010940b:	53                   	push   %ebx
+8010940c:	81 ec a4 00 00 00    	sub    $0xa4,%esp
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+80109412:	50                   	push   %eax
+80109413:	6a 00                	push   $0x0
+80109415:	e8 66 f4 ff ff       	call   80108880 <argstr>
+8010941a:	83 c4 10             	add    $0x10,%esp
+8010941d:	85 c0                	test   %eax,%eax
+8010941f:	0f 88 87 00 00 00    	js     801094ac <sys_exec+0xac>
+80109425:	83 ec 08             	sub    $0x8,%esp
+80109428:	8d 85 60 ff ff ff    	lea    -0xa0(%ebp),%eax
+8010942e:	50                   	push   %eax
+8010942f:	6a 01                	push   $0x1
+80109431:	e8 da f3 ff ff       	call   80108810 <argint>
+80109436:	83 c4 10             	add    $0x10,%esp
+80109439:	85 c0                	test   %eax,%eax
+8010943b:	78 6f                	js     801094ac <sys_exec+0xac>
+    return -1;
+  }
+  memset(argv, 0, sizeof(argv));
+8010943d:	83 ec 04             	sub    $0x4,%esp
+80109440:	8d b5 68 ff ff ff    	lea    -0x98(%ebp),%esi
+  for(i=0;; i++){
+80109446:	31 db                	xor    %ebx,%ebx
+  memset(argv, 0, sizeof(argv));
+80109448:	68 80 00 00 00       	push   $0x80
+8010944d:	6a 00                	push   $0x0
+8010944f:	56                   	push   %esi
+80109450:	e8 3b f0 ff ff       	call   80108490 <memset>
+80109455:	83 c4 10             	add    $0x10,%esp
+80109458:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010945f:	90                   	nop
+    if(i >= NELEM(argv))
+      return -1;
+    if(fetchint(uargv+4*i, (int*)&uarg) < 0)
+80109460:	83 ec 08             	sub    $0x8,%esp
+80109463:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+80109469:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+80109470:	50                   	push   %eax
+80109471:	8b 85 60 ff ff ff    	mov    -0xa0(%ebp),%eax
+80109477:	01 f8                	add    %edi,%eax
+80109479:	50                   	push   %eax
+8010947a:	e8 31 f2 ff ff       	call   801086b0 <fetchint>
+8010947f:	83 c4 10             	add    $0x10,%esp
+80109482:	85 c0                	test   %eax,%eax
+80109484:	78 26                	js     801094ac <sys_exec+0xac>
+      return -1;
+    if(uarg == 0){
+80109486:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+8010948c:	85 c0                	test   %eax,%eax
+8010948e:	74 30                	je     801094c0 <sys_exec+0xc0>
+      argv[i] = 0;
+      break;
+    }
+    if(fetchstr(uarg, &argv[i]) < 0)
+80109490:	83 ec 08             	sub    $0x8,%esp
+80109493:	8d 14 3e             	lea    (%esi,%edi,1),%edx
+80109496:	52                   	push   %edx
+80109497:	50                   	push   %eax
+80109498:	e8 e3 f2 ff ff       	call   80108780 <fetchstr>
+8010949d:	83 c4 10             	add    $0x10,%esp
+801094a0:	85 c0                	test   %eax,%eax
+801094a2:	78 08                	js     801094ac <sys_exec+0xac>
+  for(i=0;; i++){
+801094a4:	83 c3 01             	add    $0x1,%ebx
+    if(i >= NELEM(argv))
+801094a7:	83 fb 20             	cmp    $0x20,%ebx
+801094aa:	75 b4                	jne    80109460 <sys_exec+0x60>
+      return -1;
+  }
+  return exec(path, argv);
+}
+801094ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+801094af:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801094b4:	5b                   	pop    %ebx
+801094b5:	5e                   	pop    %esi
+801094b6:	5f                   	pop    %edi
+801094b7:	5d                   	pop    %ebp
+801094b8:	c3                   	ret
+801094b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      argv[i] = 0;
+801094c0:	c7 84 9d 68 ff ff ff 	movl   $0x0,-0x98(%ebp,%ebx,4)
+801094c7:	00 00 00 00 
+  return exec(path, argv);
+801094cb:	83 ec 08             	sub    $0x8,%esp
+801094ce:	56                   	push   %esi
+801094cf:	ff b5 5c ff ff ff    	push   -0xa4(%ebp)
+801094d5:	e8 16 79 ff ff       	call   80100df0 <exec>
+801094da:	83 c4 10             	add    $0x10,%esp
+}
+801094dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801094e0:	5b                   	pop    %ebx
+801094e1:	5e                   	pop    %esi
+801094e2:	5f                   	pop    %edi
+801094e3:	5d                   	pop    %ebp
+801094e4:	c3                   	ret
+801094e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801094ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801094f0 <sys_pipe>:
+
+int
+sys_pipe(void)
+{
+801094f0:	55                   	push   %ebp
+801094f1:	89 e5                	mov    %esp,%ebp
+801094f3:	57                   	push   %edi
+801094f4:	56                   	push   %esi
+  int *fd;
+  struct file *rf, *wf;
+  int fd0, fd1;
+
+  if(argptrw(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+801094f5:	8d 45 dc             	lea    -0x24(%ebp),%eax
+{
+801094f8:	53                   	push   %ebx
+801094f9:	83 ec 20             	sub    $0x20,%esp
+  if(argptrw(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+801094fc:	6a 08                	push   $0x8
+801094fe:	50                   	push   %eax
+801094ff:	6a 00                	push   $0x0
+80109501:	e8 5a f3 ff ff       	call   80108860 <argptrw>
+80109506:	83 c4 10             	add    $0x10,%esp
+80109509:	85 c0                	test   %eax,%eax
+8010950b:	0f 88 8b 00 00 00    	js     8010959c <sys_pipe+0xac>
+    return -1;
+  if(pipealloc(&rf, &wf) < 0)
+80109511:	83 ec 08             	sub    $0x8,%esp
+80109514:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80109517:	50                   	push   %eax
+80109518:	8d 45 e0             	lea    -0x20(%ebp),%eax
+8010951b:	50                   	push   %eax
+8010951c:	e8 5f cc ff ff       	call   80106180 <pipealloc>
+80109521:	83 c4 10             	add    $0x10,%esp
+80109524:	85 c0                	test   %eax,%eax
+80109526:	78 74                	js     8010959c <sys_pipe+0xac>
+    return -1;
+  fd0 = -1;
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+80109528:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(fd = 0; fd < NOFILE; fd++){
+8010952b:	31 db                	xor    %ebx,%ebx
+  struct proc *curproc = myproc();
+8010952d:	e8 3e d9 ff ff       	call   80106e70 <myproc>
+    if(curproc->ofile[fd] == 0){
+80109532:	8b 74 98 28          	mov    0x28(%eax,%ebx,4),%esi
+80109536:	85 f6                	test   %esi,%esi
+80109538:	74 16                	je     80109550 <sys_pipe+0x60>
+8010953a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(fd = 0; fd < NOFILE; fd++){
+80109540:	83 c3 01             	add    $0x1,%ebx
+80109543:	83 fb 10             	cmp    $0x10,%ebx
+80109546:	74 3d                	je     80109585 <sys_pipe+0x95>
+    if(curproc->ofile[fd] == 0){
+80109548:	8b 74 98 28          	mov    0x28(%eax,%ebx,4),%esi
+8010954c:	85 f6                	test   %esi,%esi
+8010954e:	75 f0                	jne    80109540 <sys_pipe+0x50>
+      curproc->ofile[fd] = f;
+80109550:	8d 73 08             	lea    0x8(%ebx),%esi
+80109553:	89 7c b0 08          	mov    %edi,0x8(%eax,%esi,4)
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+80109557:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  struct proc *curproc = myproc();
+8010955a:	e8 11 d9 ff ff       	call   80106e70 <myproc>
+  for(fd = 0; fd < NOFILE; fd++){
+8010955f:	31 d2                	xor    %edx,%edx
+80109561:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(curproc->ofile[fd] == 0){
+80109568:	8b 4c 90 28          	mov    0x28(%eax,%edx,4),%ecx
+8010956c:	85 c9                	test   %ecx,%ecx
+8010956e:	74 38                	je     801095a8 <sys_pipe+0xb8>
+  for(fd = 0; fd < NOFILE; fd++){
+80109570:	83 c2 01             	add    $0x1,%edx
+80109573:	83 fa 10             	cmp    $0x10,%edx
+80109576:	75 f0                	jne    80109568 <sys_pipe+0x78>
+    if(fd0 >= 0)
+      myproc()->ofile[fd0] = 0;
+80109578:	e8 f3 d8 ff ff       	call   80106e70 <myproc>
+8010957d:	c7 44 b0 08 00 00 00 	movl   $0x0,0x8(%eax,%esi,4)
+80109584:	00 
+    fileclose(rf);
+80109585:	83 ec 0c             	sub    $0xc,%esp
+80109588:	ff 75 e0             	push   -0x20(%ebp)
+8010958b:	e8 90 7e ff ff       	call   80101420 <fileclose>
+    fileclose(wf);
+80109590:	58                   	pop    %eax
+80109591:	ff 75 e4             	push   -0x1c(%ebp)
+80109594:	e8 87 7e ff ff       	call   80101420 <fileclose>
+    return -1;
+80109599:	83 c4 10             	add    $0x10,%esp
+    return -1;
+8010959c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801095a1:	eb 16                	jmp    801095b9 <sys_pipe+0xc9>
+801095a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801095a7:	90                   	nop
+      curproc->ofile[fd] = f;
+801095a8:	89 7c 90 28          	mov    %edi,0x28(%eax,%edx,4)
+  }
+  fd[0] = fd0;
+801095ac:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801095af:	89 18                	mov    %ebx,(%eax)
+  fd[1] = fd1;
+801095b1:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801095b4:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+801095b7:	31 c0                	xor    %eax,%eax
+}
+801095b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801095bc:	5b                   	pop    %ebx
+801095bd:	5e                   	pop    %esi
+801095be:	5f                   	pop    %edi
+801095bf:	5d                   	pop    %ebp
+801095c0:	c3                   	ret
+801095c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801095c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801095cf:	90                   	nop
+
+801095d0 <sys_pipesize>:
+
+// Set the capacity of the pipe fd to at least n bytes.
+int
+sys_pipesize(void)
+{
+801095d0:	55                   	push   %ebp
+801095d1:	89 e5                	mov    %esp,%ebp
+801095d3:	56                   	push   %esi
+801095d4:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+801095d5:	8d 75 f4             	lea    -0xc(%ebp),%esi
+{
+801095d8:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+801095db:	56                   	push   %esi
+801095dc:	6a 00                	push   $0x0
+801095de:	e8 2d f2 ff ff       	call   80108810 <argint>
+801095e3:	83 c4 10             	add    $0x10,%esp
+801095e6:	85 c0                	test   %eax,%eax
+801095e8:	78 46                	js     80109630 <sys_pipesize+0x60>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+801095ea:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+801095ee:	77 40                	ja     80109630 <sys_pipesize+0x60>
+801095f0:	e8 7b d8 ff ff       	call   80106e70 <myproc>
+801095f5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+801095f8:	8b 5c 90 28          	mov    0x28(%eax,%edx,4),%ebx
+801095fc:	85 db                	test   %ebx,%ebx
+801095fe:	74 30                	je     80109630 <sys_pipesize+0x60>
+  struct file *f;
+  int n;
+
+  if(argfd(0, 0, &f) < 0 || argint(1, &n) < 0)
+80109600:	83 ec 08             	sub    $0x8,%esp
+80109603:	56                   	push   %esi
+80109604:	6a 01                	push   $0x1
+80109606:	e8 05 f2 ff ff       	call   80108810 <argint>
+8010960b:	83 c4 10             	add    $0x10,%esp
+8010960e:	85 c0                	test   %eax,%eax
+80109610:	78 1e                	js     80109630 <sys_pipesize+0x60>
+    return -1;
+  if(f->type != FD_PIPE)
+80109612:	83 3b 01             	cmpl   $0x1,(%ebx)
+80109615:	75 19                	jne    80109630 <sys_pipesize+0x60>
+    return -1;
+  return pipesize(f->pipe, n);
+80109617:	83 ec 08             	sub    $0x8,%esp
+8010961a:	ff 75 f4             	push   -0xc(%ebp)
+8010961d:	ff 73 0c             	push   0xc(%ebx)
+80109620:	e8 5b cd ff ff       	call   80106380 <pipesize>
+80109625:	83 c4 10             	add    $0x10,%esp
+}
+80109628:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010962b:	5b                   	pop    %ebx
+8010962c:	5e                   	pop    %esi
+8010962d:	5d                   	pop    %ebp
+8010962e:	c3                   	ret
+8010962f:	90                   	nop
+    return -1;
+80109630:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80109635:	eb f1                	jmp    80109628 <sys_pipesize+0x58>
+80109637:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010963e:	66 90                	xchg   %ax,%ax
+
+80109640 <sys_splice>:
+
+// Move up to n bytes from fd in to fd out, one of them a pipe.
+int
+sys_splice(void)
+{
+80109640:	55                   	push   %ebp
+80109641:	89 e5                	mov    %esp,%ebp
+80109643:	57                   	push   %edi
+80109644:	56                   	push   %esi
+80109645:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80109646:	8d 5d e4             	lea    -0x1c(%ebp),%ebx
+{
+80109649:	83 ec 24             	sub    $0x24,%esp
+  if(argint(n, &fd) < 0)
+8010964c:	53                   	push   %ebx
+8010964d:	6a 00                	push   $0x0
+8010964f:	e8 bc f1 ff ff       	call   80108810 <argint>
+80109654:	83 c4 10             	add    $0x10,%esp
+80109657:	85 c0                	test   %eax,%eax
+80109659:	78 6d                	js     801096c8 <sys_splice+0x88>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+8010965b:	83 7d e4 0f          	cmpl   $0xf,-0x1c(%ebp)
+8010965f:	77 67                	ja     801096c8 <sys_splice+0x88>
+80109661:	e8 0a d8 ff ff       	call   80106e70 <myproc>
+80109666:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80109669:	8b 74 90 28          	mov    0x28(%eax,%edx,4),%esi
+8010966d:	85 f6                	test   %esi,%esi
+8010966f:	74 57                	je     801096c8 <sys_splice+0x88>
+  if(argint(n, &fd) < 0)
+80109671:	83 ec 08             	sub    $0x8,%esp
+80109674:	53                   	push   %ebx
+80109675:	6a 01                	push   $0x1
+80109677:	e8 94 f1 ff ff       	call   80108810 <argint>
+8010967c:	83 c4 10             	add    $0x10,%esp
+8010967f:	85 c0                	test   %eax,%eax
+80109681:	78 45                	js     801096c8 <sys_splice+0x88>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80109683:	83 7d e4 0f          	cmpl   $0xf,-0x1c(%ebp)
+80109687:	77 3f                	ja     801096c8 <sys_splice+0x88>
+80109689:	e8 e2 d7 ff ff       	call   80106e70 <myproc>
+8010968e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80109691:	8b 7c 90 28          	mov    0x28(%eax,%edx,4),%edi
+80109695:	85 ff                	test   %edi,%edi
+80109697:	74 2f                	je     801096c8 <sys_splice+0x88>
+  struct file *in, *out;
+  int n;
+
+  if(argfd(0, 0, &in) < 0 || argfd(1, 0, &out) < 0 || argint(2, &n) < 0)
+80109699:	83 ec 08             	sub    $0x8,%esp
+8010969c:	53                   	push   %ebx
+8010969d:	6a 02                	push   $0x2
+8010969f:	e8 6c f1 ff ff       	call   80108810 <argint>
+801096a4:	83 c4 10             	add    $0x10,%esp
+801096a7:	85 c0                	test   %eax,%eax
+801096a9:	78 1d                	js     801096c8 <sys_splice+0x88>
+    return -1;
+  return filesplice(in, out, n);
+801096ab:	83 ec 04             	sub    $0x4,%esp
+801096ae:	ff 75 e4             	push   -0x1c(%ebp)
+801096b1:	57                   	push   %edi
+801096b2:	56                   	push   %esi
+801096b3:	e8 88 7f ff ff       	call   80101640 <filesplice>
+801096b8:	83 c4 10             	add    $0x10,%esp
+}
+801096bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801096be:	5b                   	pop    %ebx
+801096bf:	5e                   	pop    %esi
+801096c0:	5f                   	pop    %edi
+801096c1:	5d                   	pop    %ebp
+801096c2:	c3                   	ret
+801096c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801096c7:	90                   	nop
+    return -1;
+801096c8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801096cd:	eb ec                	jmp    801096bb <sys_splice+0x7b>
+801096cf:	90                   	nop
+
+801096d0 <sys_copyrange>:
+
+// Copy up to n bytes from fd in to fd out, both inode files.
+int
+sys_copyrange(void)
+{
+801096d0:	55                   	push   %ebp
+801096d1:	89 e5                	mov    %esp,%ebp
+801096d3:	57                   	push   %edi
+801096d4:	56                   	push   %esi
+801096d5:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+801096d6:	8d 5d e4             	lea    -0x1c(%ebp),%ebx
+{
+801096d9:	83 ec 24             	sub    $0x24,%esp
+  if(argint(n, &fd) < 0)
+801096dc:	53                   	push   %ebx
+801096dd:	6a 00                	push   $0x0
+801096df:	e8 2c f1 ff ff       	call   80108810 <argint>
+801096e4:	83 c4 10             	add    $0x10,%esp
+801096e7:	85 c0                	test   %eax,%eax
+801096e9:	78 6d                	js     80109758 <sys_copyrange+0x88>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+801096eb:	83 7d e4 0f          	cmpl   $0xf,-0x1c(%ebp)
+801096ef:	77 67                	ja     80109758 <sys_copyrange+0x88>
+801096f1:	e8 7a d7 ff ff       	call   80106e70 <myproc>
+801096f6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801096f9:	8b 74 90 28          	mov    0x28(%eax,%edx,4),%esi
+801096fd:	85 f6                	test   %esi,%esi
+801096ff:	74 57                	je     80109758 <sys_copyrange+0x88>
+  if(argint(n, &fd) < 0)
+80109701:	83 ec 08             	sub    $0x8,%esp
+80109704:	53                   	push   %ebx
+80109705:	6a 01                	push   $0x1
+80109707:	e8 04 f1 ff ff       	call   80108810 <argint>
+8010970c:	83 c4 10             	add    $0x10,%esp
+8010970f:	85 c0                	test   %eax,%eax
+80109711:	78 45                	js     80109758 <sys_copyrange+0x88>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80109713:	83 7d e4 0f          	cmpl   $0xf,-0x1c(%ebp)
+80109717:	77 3f                	ja     80109758 <sys_copyrange+0x88>
+80109719:	e8 52 d7 ff ff       	call   80106e70 <myproc>
+8010971e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80109721:	8b 7c 90 28          	mov    0x28(%eax,%edx,4),%edi
+80109725:	85 ff                	test   %edi,%edi
+80109727:	74 2f                	je     80109758 <sys_copyrange+0x88>
+  struct file *in, *out;
+  int n;
+
+  if(argfd(0, 0, &in) < 0 || argfd(1, 0, &out) < 0 || argint(2, &n) < 0)
+80109729:	83 ec 08             	sub    $0x8,%esp
+8010972c:	53                   	push   %ebx
+8010972d:	6a 02                	push   $0x2
+8010972f:	e8 dc f0 ff ff       	call   80108810 <argint>
+80109734:	83 c4 10             	add    $0x10,%esp
+80109737:	85 c0                	test   %eax,%eax
+80109739:	78 1d                	js     80109758 <sys_copyrange+0x88>
+    return -1;
+  return filecopy(in, out, n);
+8010973b:	83 ec 04             	sub    $0x4,%esp
+8010973e:	ff 75 e4             	push   -0x1c(%ebp)
+80109741:	57                   	push   %edi
+80109742:	56                   	push   %esi
+80109743:	e8 68 80 ff ff       	call   801017b0 <filecopy>
+80109748:	83 c4 10             	add    $0x10,%esp
+}
+8010974b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010974e:	5b                   	pop    %ebx
+8010974f:	5e                   	pop    %esi
+80109750:	5f                   	pop    %edi
+80109751:	5d                   	pop    %ebp
+80109752:	c3                   	ret
+80109753:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80109757:	90                   	nop
+    return -1;
+80109758:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010975d:	eb ec                	jmp    8010974b <sys_copyrange+0x7b>
+8010975f:	90                   	nop
+
+80109760 <sys_fork>:
+#include "pstat.h"
+
+int
+sys_fork(void)
+{
+  return fork();
+80109760:	e9 9b d8 ff ff       	jmp    80107000 <fork>
+80109765:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010976c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80109770 <sys_exit>:
+}
+
+int
+sys_exit(void)
+{
+80109770:	55                   	push   %ebp
+80109771:	89 e5                	mov    %esp,%ebp
+80109773:	83 ec 08             	sub    $0x8,%esp
+  exit();
+80109776:	e8 a5 e1 ff ff       	call   80107920 <exit>
+  return 0;  // not reached
+}
+8010977b:	31 c0                	xor    %eax,%eax
+8010977d:	c9                   	leave
+8010977e:	c3                   	ret
+8010977f:	90                   	nop
+
+80109780 <sys_wait>:
+
+int
+sys_wait(void)
+{
+  return wait();
+80109780:	e9 db df ff ff       	jmp    80107760 <wait>
+80109785:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010978c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80109790 <sys_kill>:
+}
+
+int
+sys_kill(void)
+{
+80109790:	55                   	push   %ebp
+80109791:	89 e5                	mov    %esp,%ebp
+80109793:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+
+  if(argint(0, &pid) < 0)
+80109796:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109799:	50                   	push   %eax
+8010979a:	6a 00                	push   $0x0
+8010979c:	e8 6f f0 ff ff       	call   80108810 <argint>
+801097a1:	83 c4 10             	add    $0x10,%esp
+801097a4:	85 c0                	test   %eax,%eax
+801097a6:	78 18                	js     801097c0 <sys_kill+0x30>
+    return -1;
+  return kill(pid);
+801097a8:	83 ec 0c             	sub    $0xc,%esp
+801097ab:	ff 75 f4             	push   -0xc(%ebp)
+801097ae:	e8 9d e2 ff ff       	call   80107a50 <kill>
+801097b3:	83 c4 10             	add    $0x10,%esp
+}
+801097b6:	c9                   	leave
+801097b7:	c3                   	ret
+801097b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801097bf:	90                   	nop
+801097c0:	c9                   	leave
+    return -1;
+801097c1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801097c6:	c3                   	ret
+801097c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801097ce:	66 90                	xchg   %ax,%ax
+
+801097d0 <sys_getpid>:
+
+int
+sys_getpid(void)
+{
+801097d0:	55                   	push   %ebp
+801097d1:	89 e5                	mov    %esp,%ebp
+801097d3:	83 ec 08             	sub    $0x8,%esp
+  return myproc()->pid;
+801097d6:	e8 95 d6 ff ff       	call   80106e70 <myproc>
+801097db:	8b 40 10             	mov    0x10(%eax),%eax
+}
+801097de:	c9                   	leave
+801097df:	c3                   	ret
+
+801097e0 <sys_sbrk>:
+
+int
+sys_sbrk(void)
+{
+801097e0:	55                   	push   %ebp
+801097e1:	89 e5                	mov    %esp,%ebp
+801097e3:	53                   	push   %ebx
+  int addr;
+  int n;
+
+  if(argint(0, &n) < 0)
+801097e4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+801097e7:	83 ec 1c             	sub    $0x1c,%esp
+  if(argint(0, &n) < 0)
+801097ea:	50                   	push   %eax
+801097eb:	6a 00                	push   $0x0
+801097ed:	e8 1e f0 ff ff       	call   80108810 <argint>
+801097f2:	83 c4 10             	add    $0x10,%esp
+801097f5:	85 c0                	test   %eax,%eax
+801097f7:	78 37                	js     80109830 <sys_sbrk+0x50>
+    return -1;
+  addr = myproc()->sz;
+801097f9:	e8 72 d6 ff ff       	call   80106e70 <myproc>
+801097fe:	8b 18                	mov    (%eax),%ebx
+  if(n > 0){
+80109800:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80109803:	85 c0                	test   %eax,%eax
+80109805:	7e 19                	jle    80109820 <sys_sbrk+0x40>
+    // Demand-zero: only grow the size now; trap() maps a
+    // zeroed page on first touch (see lazyfault in vm.c).
+    if((uint)addr + n >= KERNBASE || (uint)addr + n < (uint)addr)
+80109807:	01 d8                	add    %ebx,%eax
+80109809:	72 25                	jb     80109830 <sys_sbrk+0x50>
+8010980b:	85 c0                	test   %eax,%eax
+8010980d:	78 21                	js     80109830 <sys_sbrk+0x50>
+      return -1;
+    myproc()->sz += n;
+8010980f:	e8 5c d6 ff ff       	call   80106e70 <myproc>
+80109814:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80109817:	01 10                	add    %edx,(%eax)
+  addr = myproc()->sz;
+80109819:	89 d8                	mov    %ebx,%eax
+    return addr;
+  }
+  if(growproc(n) < 0)
+    return -1;
+  return addr;
+}
+8010981b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010981e:	c9                   	leave
+8010981f:	c3                   	ret
+  if(growproc(n) < 0)
+80109820:	83 ec 0c             	sub    $0xc,%esp
+80109823:	50                   	push   %eax
+80109824:	e8 57 d7 ff ff       	call   80106f80 <growproc>
+80109829:	83 c4 10             	add    $0x10,%esp
+8010982c:	85 c0                	test   %eax,%eax
+8010982e:	79 e9                	jns    80109819 <sys_sbrk+0x39>
+    return -1;
+80109830:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80109835:	eb e4                	jmp    8010981b <sys_sbrk+0x3b>
+80109837:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010983e:	66 90                	xchg   %ax,%ax
+
+80109840 <sys_sleep>:
+
+int
+sys_sleep(void)
+{
+80109840:	55                   	push   %ebp
+80109841:	89 e5                	mov    %esp,%ebp
+80109843:	83 ec 20             	sub    $0x20,%esp
+  int n;
+
+  if(argint(0, &n) < 0)
+80109846:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109849:	50                   	push   %eax
+8010984a:	6a 00                	push   $0x0
+8010984c:	e8 bf ef ff ff       	call   80108810 <argint>
+80109851:	83 c4 10             	add    $0x10,%esp
+80109854:	85 c0                	test   %eax,%eax
+80109856:	78 48                	js     801098a0 <sys_sleep+0x60>
+    return -1;
+  acquire(&tickslock);
+80109858:	83 ec 0c             	sub    $0xc,%esp
+8010985b:	68 a0 5f 23 80       	push   $0x80235fa0
+80109860:	e8 fb e8 ff ff       	call   80108160 <acquire>
+  if(n > 0)
+80109865:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80109868:	83 c4 10             	add    $0x10,%esp
+8010986b:	85 c0                	test   %eax,%eax
+8010986d:	7e 0c                	jle    8010987b <sys_sleep+0x3b>
+    sleepticks(n);
+8010986f:	83 ec 0c             	sub    $0xc,%esp
+80109872:	50                   	push   %eax
+80109873:	e8 98 01 00 00       	call   80109a10 <sleepticks>
+80109878:	83 c4 10             	add    $0x10,%esp
+  release(&tickslock);
+8010987b:	83 ec 0c             	sub    $0xc,%esp
+8010987e:	68 a0 5f 23 80       	push   $0x80235fa0
+80109883:	e8 18 eb ff ff       	call   801083a0 <release>
+  if(myproc()->killed)
+80109888:	e8 e3 d5 ff ff       	call   80106e70 <myproc>
+8010988d:	83 c4 10             	add    $0x10,%esp
+80109890:	8b 40 24             	mov    0x24(%eax),%eax
+    return -1;
+  return 0;
+}
+80109893:	c9                   	leave
+  if(myproc()->killed)
+80109894:	f7 d8                	neg    %eax
+80109896:	19 c0                	sbb    %eax,%eax
+}
+80109898:	c3                   	ret
+80109899:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801098a0:	c9                   	leave
+    return -1;
+801098a1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801098a6:	c3                   	ret
+801098a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801098ae:	66 90                	xchg   %ax,%ax
+
+801098b0 <sys_uptime>:
+
+// return how many clock tick interrupts have occurred
+// since start.
+int
+sys_uptime(void)
+{
+801098b0:	55                   	push   %ebp
+801098b1:	89 e5                	mov    %esp,%ebp
+801098b3:	53                   	push   %ebx
+801098b4:	83 ec 10             	sub    $0x10,%esp
+  uint xticks;
+
+  acquire(&tickslock);
+801098b7:	68 a0 5f 23 80       	push   $0x80235fa0
+801098bc:	e8 9f e8 ff ff       	call   80108160 <acquire>
+  xticks = ticks;
+801098c1:	8b 1d 80 5f 23 80    	mov    0x80235f80,%ebx
+  release(&tickslock);
+801098c7:	c7 04 24 a0 5f 23 80 	movl   $0x80235fa0,(%esp)
+801098ce:	e8 cd ea ff ff       	call   801083a0 <release>
+  return xticks;
+}
+801098d3:	89 d8                	mov    %ebx,%eax
+801098d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801098d8:	c9                   	leave
+801098d9:	c3                   	ret
+801098da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801098e0 <sys_getpstat>:
+
+// return the scheduling statistics of process pid.
+int
+sys_getpstat(void)
+{
+801098e0:	55                   	push   %ebp
+801098e1:	89 e5                	mov    %esp,%ebp
+801098e3:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+  struct pstat *ps;
+
+  if(argint(0, &pid) < 0 || argptrw(1, (void*)&ps, sizeof(*ps)) < 0)
+801098e6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801098e9:	50                   	push   %eax
+801098ea:	6a 00                	push   $0x0
+801098ec:	e8 1f ef ff ff       	call   80108810 <argint>
+801098f1:	83 c4 10             	add    $0x10,%esp
+801098f4:	85 c0                	test   %eax,%eax
+801098f6:	78 30                	js     80109928 <sys_getpstat+0x48>
+801098f8:	83 ec 04             	sub    $0x4,%esp
+801098fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801098fe:	6a 18                	push   $0x18
+80109900:	50                   	push   %eax
+80109901:	6a 01                	push   $0x1
+80109903:	e8 58 ef ff ff       	call   80108860 <argptrw>
+80109908:	83 c4 10             	add    $0x10,%esp
+8010990b:	85 c0                	test   %eax,%eax
+8010990d:	78 19                	js     80109928 <sys_getpstat+0x48>
+    return -1;
+  return getpstat(pid, ps);
+8010990f:	83 ec 08             	sub    $0x8,%esp
+80109912:	ff 75 f4             	push   -0xc(%ebp)
+80109915:	ff 75 f0             	push   -0x10(%ebp)
+80109918:	e8 53 e2 ff ff       	call   80107b70 <getpstat>
+8010991d:	83 c4 10             	add    $0x10,%esp
+}
+80109920:	c9                   	leave
+80109921:	c3                   	ret
+80109922:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80109928:	c9                   	leave
+    return -1;
+80109929:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010992e:	c3                   	ret
+
+8010992f <alltraps>:
+
+  # vectors.S sends all traps here.
+.globl alltraps
+alltraps:
+  # Build trap frame.
+  pushl %ds
+8010992f:	1e                   	push   %ds
+  pushl %es
+80109930:	06                   	push   %es
+  pushl %fs
+80109931:	0f a0                	push   %fs
+  pushl %gs
+80109933:	0f a8                	push   %gs
+  pushal
+80109935:	60                   	pusha
+  
+  # Set up data segments.
+  movw $(SEG_KDATA<<3), %ax
+80109936:	66 b8 10 00          	mov    $0x10,%ax
+  movw %ax, %ds
+8010993a:	8e d8                	mov    %eax,%ds
+  movw %ax, %es
+8010993c:	8e c0                	mov    %eax,%es
+
+  # Call trap(tf), where tf=%esp
+  pushl %esp
+8010993e:	54                   	push   %esp
+  call trap
+8010993f:	e8 9c 01 00 00       	call   80109ae0 <trap>
+  addl $4, %esp
+80109944:	83 c4 04             	add    $0x4,%esp
+
+80109947 <trapret>:
+
+  # Return falls through to trapret...
+.globl trapret
+trapret:
+  popal
+80109947:	61                   	popa
+  popl %gs
+80109948:	0f a9                	pop    %gs
+  popl %fs
+8010994a:	0f a1                	pop    %fs
+  popl %es
+8010994c:	07                   	pop    %es
+  popl %ds
+8010994d:	1f                   	pop    %ds
+  addl $0x8, %esp  # trapno and errcode
+8010994e:	83 c4 08             	add    $0x8,%esp
+  iret
+80109951:	cf                   	iret
+80109952:	66 90                	xchg   %ax,%ax
+80109954:	66 90                	xchg   %ax,%ax
+80109956:	66 90                	xchg   %ax,%ax
+80109958:	66 90                	xchg   %ax,%ax
+8010995a:	66 90                	xchg   %ax,%ax
+8010995c:	66 90                	xchg   %ax,%ax
+8010995e:	66 90                	xchg   %ax,%ax
+
+80109960 <tvinit>:
+#define NWHEEL 64
+static struct proc *wheel[NWHEEL];
+
+void
+tvinit(void)
+{
+80109960:	55                   	push   %ebp
+  int i;
+
+  for(i = 0; i < 256; i++)
+80109961:	31 c0                	xor    %eax,%eax
+{
+80109963:	89 e5                	mov    %esp,%ebp
+80109965:	83 ec 08             	sub    $0x8,%esp
+80109968:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010996f:	90                   	nop
+    SETGATE(idt[i], 0, SEG_KCODE<<3, vectors[i], 0);
+80109970:	8b 14 85 08 f0 10 80 	mov    -0x7fef0ff8(,%eax,4),%edx
+80109977:	c7 04 c5 e2 5f 23 80 	movl   $0x8e000008,-0x7fdca01e(,%eax,8)
+8010997e:	08 00 00 8e 
+80109982:	66 89 14 c5 e0 5f 23 	mov    %dx,-0x7fdca020(,%eax,8)
+80109989:	80 
+8010998a:	c1 ea 10             	shr    $0x10,%edx
+8010998d:	66 89 14 c5 e6 5f 23 	mov    %dx,-0x7fdca01a(,%eax,8)
+80109994:	80 
+  for(i = 0; i < 256; i++)
+80109995:	83 c0 01             	add    $0x1,%eax
+80109998:	3d 00 01 00 00       	cmp    $0x100,%eax
+8010999d:	75 d1                	jne    80109970 <tvinit+0x10>
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+8010999f:	a1 08 f1 10 80       	mov    0x8010f108,%eax
+
+  initlock(&tickslock, "time");
+801099a4:	83 ec 08             	sub    $0x8,%esp
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+801099a7:	c7 05 e2 61 23 80 08 	movl   $0xef000008,0x802361e2
+801099ae:	00 00 ef 
+801099b1:	66 a3 e0 61 23 80    	mov    %ax,0x802361e0
+801099b7:	c1 e8 10             	shr    $0x10,%eax
+801099ba:	66 a3 e6 61 23 80    	mov    %ax,0x802361e6
+  initlock(&tickslock, "time");
+801099c0:	68 99 bf 10 80       	push   $0x8010bf99
+801099c5:	68 a0 5f 23 80       	push   $0x80235fa0
+801099ca:	e8 41 e5 ff ff       	call   80107f10 <initlock>
+}
+801099cf:	83 c4 10             	add    $0x10,%esp
+801099d2:	c9                   	leave
+801099d3:	c3                   	ret
+801099d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801099db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801099df:	90                   	nop
+
+801099e0 <idtinit>:
+
+void
+idtinit(void)
+{
+801099e0:	55                   	push   %ebp
+  pd[0] = size-1;
+801099e1:	b8 ff 07 00 00       	mov    $0x7ff,%eax
+801099e6:	89 e5                	mov    %esp,%ebp
+801099e8:	83 ec 10             	sub    $0x10,%esp
+801099eb:	66 89 45 fa          	mov    %ax,-0x6(%ebp)
+  pd[1] = (uint)p;
+801099ef:	b8 e0 5f 23 80       	mov    $0x80235fe0,%eax
+801099f4:	66 89 45 fc          	mov    %ax,-0x4(%ebp)
+  pd[2] = (uint)p >> 16;
+801099f8:	c1 e8 10             	shr    $0x10,%eax
+801099fb:	66 89 45 fe          	mov    %ax,-0x2(%ebp)
+  asm volatile("lidt (%0)" : : "r" (pd));
+801099ff:	8d 45 fa             	lea    -0x6(%ebp),%eax
+80109a02:	0f 01 18             	lidtl  (%eax)
+  lidt(idt, sizeof(idt));
+}
+80109a05:	c9                   	leave
+80109a06:	c3                   	ret
+80109a07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109a0e:	66 90                	xchg   %ax,%ax
+
+80109a10 <sleepticks>:
+
+// Sleep for n ticks, or until the process is killed.
+// Caller must hold tickslock.
+void
+sleepticks(uint n)
+{
+80109a10:	55                   	push   %ebp
+80109a11:	89 e5                	mov    %esp,%ebp
+80109a13:	56                   	push   %esi
+80109a14:	53                   	push   %ebx
+80109a15:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct proc *p = myproc();
+80109a18:	e8 53 d4 ff ff       	call   80106e70 <myproc>
+  struct proc **pp;
+
+  if(n == 0)
+80109a1d:	85 f6                	test   %esi,%esi
+80109a1f:	0f 84 8b 00 00 00    	je     80109ab0 <sleepticks+0xa0>
+    return;
+  p->deadline = ticks + n;
+80109a25:	8b 15 80 5f 23 80    	mov    0x80235f80,%edx
+80109a2b:	89 c3                	mov    %eax,%ebx
+80109a2d:	01 d6                	add    %edx,%esi
+80109a2f:	89 b0 88 00 00 00    	mov    %esi,0x88(%eax)
+  pp = &wheel[p->deadline % NWHEEL];
+80109a35:	83 e6 3f             	and    $0x3f,%esi
+  p->tnext = *pp;
+80109a38:	8b 04 b5 e0 67 23 80 	mov    -0x7fdc9820(,%esi,4),%eax
+80109a3f:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+  *pp = p;
+80109a45:	89 1c b5 e0 67 23 80 	mov    %ebx,-0x7fdc9820(,%esi,4)
+  while((int)(ticks - p->deadline) < 0 && !p->killed)
+80109a4c:	8b 83 88 00 00 00    	mov    0x88(%ebx),%eax
+    sleep(&p->deadline, &tickslock);
+80109a52:	8d b3 88 00 00 00    	lea    0x88(%ebx),%esi
+  while((int)(ticks - p->deadline) < 0 && !p->killed)
+80109a58:	39 c2                	cmp    %eax,%edx
+80109a5a:	78 23                	js     80109a7f <sleepticks+0x6f>
+80109a5c:	eb 28                	jmp    80109a86 <sleepticks+0x76>
+80109a5e:	66 90                	xchg   %ax,%ax
+    sleep(&p->deadline, &tickslock);
+80109a60:	83 ec 08             	sub    $0x8,%esp
+80109a63:	68 a0 5f 23 80       	push   $0x80235fa0
+80109a68:	56                   	push   %esi
+80109a69:	e8 d2 db ff ff       	call   80107640 <sleep>
+  while((int)(ticks - p->deadline) < 0 && !p->killed)
+80109a6e:	8b 83 88 00 00 00    	mov    0x88(%ebx),%eax
+80109a74:	83 c4 10             	add    $0x10,%esp
+80109a77:	39 05 80 5f 23 80    	cmp    %eax,0x80235f80
+80109a7d:	79 07                	jns    80109a86 <sleepticks+0x76>
+80109a7f:	8b 53 24             	mov    0x24(%ebx),%edx
+80109a82:	85 d2                	test   %edx,%edx
+80109a84:	74 da                	je     80109a60 <sleepticks+0x50>
+
+  // Still on the wheel if killed early.
+  for(pp = &wheel[p->deadline % NWHEEL]; *pp; pp = &(*pp)->tnext){
+80109a86:	83 e0 3f             	and    $0x3f,%eax
+80109a89:	89 c2                	mov    %eax,%edx
+80109a8b:	8b 04 85 e0 67 23 80 	mov    -0x7fdc9820(,%eax,4),%eax
+80109a92:	85 c0                	test   %eax,%eax
+80109a94:	74 1a                	je     80109ab0 <sleepticks+0xa0>
+    if(*pp == p){
+80109a96:	39 d8                	cmp    %ebx,%eax
+80109a98:	75 0a                	jne    80109aa4 <sleepticks+0x94>
+80109a9a:	eb 39                	jmp    80109ad5 <sleepticks+0xc5>
+80109a9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80109aa0:	39 c3                	cmp    %eax,%ebx
+80109aa2:	74 1c                	je     80109ac0 <sleepticks+0xb0>
+  for(pp = &wheel[p->deadline % NWHEEL]; *pp; pp = &(*pp)->tnext){
+80109aa4:	89 c2                	mov    %eax,%edx
+80109aa6:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+80109aac:	85 c0                	test   %eax,%eax
+80109aae:	75 f0                	jne    80109aa0 <sleepticks+0x90>
+      *pp = p->tnext;
+      break;
+    }
+  }
+}
+80109ab0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80109ab3:	5b                   	pop    %ebx
+80109ab4:	5e                   	pop    %esi
+80109ab5:	5d                   	pop    %ebp
+80109ab6:	c3                   	ret
+80109ab7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109abe:	66 90                	xchg   %ax,%ax
+  for(pp = &wheel[p->deadline % NWHEEL]; *pp; pp = &(*pp)->tnext){
+80109ac0:	81 c2 8c 00 00 00    	add    $0x8c,%edx
+      *pp = p->tnext;
+80109ac6:	8b 83 8c 00 00 00    	mov    0x8c(%ebx),%eax
+80109acc:	89 02                	mov    %eax,(%edx)
+}
+80109ace:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80109ad1:	5b                   	pop    %ebx
+80109ad2:	5e                   	pop    %esi
+80109ad3:	5d                   	pop    %ebp
+80109ad4:	c3                   	ret
+  for(pp = &wheel[p->deadline % NWHEEL]; *pp; pp = &(*pp)->tnext){
+80109ad5:	8d 14 95 e0 67 23 80 	lea    -0x7fdc9820(,%edx,4),%edx
+80109adc:	eb e8                	jmp    80109ac6 <sleepticks+0xb6>
+80109ade:	66 90                	xchg   %ax,%ax
+
+80109ae0 <trap>:
+}
+
+//PAGEBREAK: 41
+void
+trap(struct trapframe *tf)
+{
+80109ae0:	55                   	push   %ebp
+80109ae1:	89 e5                	mov    %esp,%ebp
+80109ae3:	57                   	push   %edi
+80109ae4:	56                   	push   %esi
+80109ae5:	53                   	push   %ebx
+80109ae6:	83 ec 1c             	sub    $0x1c,%esp
+80109ae9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(tf->trapno == T_SYSCALL){
+80109aec:	8b 43 30             	mov    0x30(%ebx),%eax
+80109aef:	83 f8 40             	cmp    $0x40,%eax
+80109af2:	0f 84 60 01 00 00    	je     80109c58 <trap+0x178>
+    if(myproc()->killed)
+      exit();
+    return;
+  }
+
+  switch(tf->trapno){
+80109af8:	83 e8 0e             	sub    $0xe,%eax
+80109afb:	83 f8 31             	cmp    $0x31,%eax
+80109afe:	0f 87 ac 00 00 00    	ja     80109bb0 <trap+0xd0>
+80109b04:	ff 24 85 40 c0 10 80 	jmp    *-0x7fef3fc0(,%eax,4)
+80109b0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80109b0f:	90                   	nop
+  case T_IRQ0 + IRQ_WAKEUP:
+    // Work for an idle CPU; scheduler() will find it.
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_IDE:
+    ideintr();
+80109b10:	e8 3b aa ff ff       	call   80104550 <ideintr>
+    lapiceoi();
+80109b15:	e8 66 b5 ff ff       	call   80105080 <lapiceoi>
+  }
+
+  // Force process exit if it has been killed and is in user space.
+  // (If it is still executing in the kernel, let it keep running
+  // until it gets to the regular system call return.)
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+80109b1a:	e8 51 d3 ff ff       	call   80106e70 <myproc>
+80109b1f:	85 c0                	test   %eax,%eax
+80109b21:	74 1d                	je     80109b40 <trap+0x60>
+80109b23:	e8 48 d3 ff ff       	call   80106e70 <myproc>
+80109b28:	8b 50 24             	mov    0x24(%eax),%edx
+80109b2b:	85 d2                	test   %edx,%edx
+80109b2d:	74 11                	je     80109b40 <trap+0x60>
+80109b2f:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80109b33:	83 e0 03             	and    $0x3,%eax
+80109b36:	66 83 f8 03          	cmp    $0x3,%ax
+80109b3a:	0f 84 e0 01 00 00    	je     80109d20 <trap+0x240>
+    exit();
+
+  // Force process to give up CPU on clock tick.
+  // If interrupts were on while locks held, would need to check nlock.
+  if(myproc() && myproc()->state == RUNNING &&
+80109b40:	e8 2b d3 ff ff       	call   80106e70 <myproc>
+80109b45:	85 c0                	test   %eax,%eax
+80109b47:	74 0f                	je     80109b58 <trap+0x78>
+80109b49:	e8 22 d3 ff ff       	call   80106e70 <myproc>
+80109b4e:	83 78 0c 04          	cmpl   $0x4,0xc(%eax)
+80109b52:	0f 84 d8 00 00 00    	je     80109c30 <trap+0x150>
+     tf->trapno == T_IRQ0+IRQ_TIMER && schedtick())
+    yield();
+
+  // Check if the process has been killed since we yielded
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+80109b58:	e8 13 d3 ff ff       	call   80106e70 <myproc>
+80109b5d:	85 c0                	test   %eax,%eax
+80109b5f:	74 1d                	je     80109b7e <trap+0x9e>
+80109b61:	e8 0a d3 ff ff       	call   80106e70 <myproc>
+80109b66:	8b 40 24             	mov    0x24(%eax),%eax
+80109b69:	85 c0                	test   %eax,%eax
+80109b6b:	74 11                	je     80109b7e <trap+0x9e>
+80109b6d:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80109b71:	83 e0 03             	and    $0x3,%eax
+80109b74:	66 83 f8 03          	cmp    $0x3,%ax
+80109b78:	0f 84 07 01 00 00    	je     80109c85 <trap+0x1a5>
+    exit();
+}
+80109b7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109b81:	5b                   	pop    %ebx
+80109b82:	5e                   	pop    %esi
+80109b83:	5f                   	pop    %edi
+80109b84:	5d                   	pop    %ebp
+80109b85:	c3                   	ret
+80109b86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109b8d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(myproc() != 0){
+80109b90:	e8 db d2 ff ff       	call   80106e70 <myproc>
+80109b95:	85 c0                	test   %eax,%eax
+80109b97:	74 17                	je     80109bb0 <trap+0xd0>
+      if(tf->err & FEC_PR){
+80109b99:	8b 43 34             	mov    0x34(%ebx),%eax
+80109b9c:	a8 01                	test   $0x1,%al
+80109b9e:	0f 84 4c 02 00 00    	je     80109df0 <trap+0x310>
+        if((tf->err & FEC_WR) && cowfault(myproc()->pgdir, rcr2()) == 0)
+80109ba4:	a8 02                	test   $0x2,%al
+80109ba6:	0f 85 84 01 00 00    	jne    80109d30 <trap+0x250>
+80109bac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(myproc() == 0 || (tf->cs&3) == 0){
+80109bb0:	e8 bb d2 ff ff       	call   80106e70 <myproc>
+80109bb5:	8b 7b 38             	mov    0x38(%ebx),%edi
+80109bb8:	85 c0                	test   %eax,%eax
+80109bba:	0f 84 5c 02 00 00    	je     80109e1c <trap+0x33c>
+80109bc0:	f6 43 3c 03          	testb  $0x3,0x3c(%ebx)
+80109bc4:	0f 84 52 02 00 00    	je     80109e1c <trap+0x33c>
+
+static inline uint
+rcr2(void)
+{
+  uint val;
+  asm volatile("movl %%cr2,%0" : "=r" (val));
+80109bca:	0f 20 d1             	mov    %cr2,%ecx
+80109bcd:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+80109bd0:	e8 cb d0 ff ff       	call   80106ca0 <cpuid>
+80109bd5:	8b 73 30             	mov    0x30(%ebx),%esi
+80109bd8:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80109bdb:	8b 43 34             	mov    0x34(%ebx),%eax
+80109bde:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+            myproc()->pid, myproc()->name, tf->trapno,
+80109be1:	e8 8a d2 ff ff       	call   80106e70 <myproc>
+80109be6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80109be9:	e8 82 d2 ff ff       	call   80106e70 <myproc>
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+80109bee:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+80109bf1:	51                   	push   %ecx
+80109bf2:	57                   	push   %edi
+80109bf3:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80109bf6:	52                   	push   %edx
+80109bf7:	ff 75 e4             	push   -0x1c(%ebp)
+80109bfa:	56                   	push   %esi
+            myproc()->pid, myproc()->name, tf->trapno,
+80109bfb:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80109bfe:	83 c6 6c             	add    $0x6c,%esi
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+80109c01:	56                   	push   %esi
+80109c02:	ff 70 10             	push   0x10(%eax)
+80109c05:	68 fc bf 10 80       	push   $0x8010bffc
+80109c0a:	e8 81 6d ff ff       	call   80100990 <cprintf>
+    myproc()->killed = 1;
+80109c0f:	83 c4 20             	add    $0x20,%esp
+80109c12:	e8 59 d2 ff ff       	call   80106e70 <myproc>
+80109c17:	c7 40 24 01 00 00 00 	movl   $0x1,0x24(%eax)
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+80109c1e:	e8 4d d2 ff ff       	call   80106e70 <myproc>
+80109c23:	85 c0                	test   %eax,%eax
+80109c25:	0f 85 f8 fe ff ff    	jne    80109b23 <trap+0x43>
+80109c2b:	e9 10 ff ff ff       	jmp    80109b40 <trap+0x60>
+  if(myproc() && myproc()->state == RUNNING &&
+80109c30:	83 7b 30 20          	cmpl   $0x20,0x30(%ebx)
+80109c34:	0f 85 1e ff ff ff    	jne    80109b58 <trap+0x78>
+     tf->trapno == T_IRQ0+IRQ_TIMER && schedtick())
+80109c3a:	e8 51 d8 ff ff       	call   80107490 <schedtick>
+80109c3f:	85 c0                	test   %eax,%eax
+80109c41:	0f 84 11 ff ff ff    	je     80109b58 <trap+0x78>
+    yield();
+80109c47:	e8 f4 d8 ff ff       	call   80107540 <yield>
+80109c4c:	e9 07 ff ff ff       	jmp    80109b58 <trap+0x78>
+80109c51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(myproc()->killed)
+80109c58:	e8 13 d2 ff ff       	call   80106e70 <myproc>
+80109c5d:	8b 70 24             	mov    0x24(%eax),%esi
+80109c60:	85 f6                	test   %esi,%esi
+80109c62:	0f 85 f0 00 00 00    	jne    80109d58 <trap+0x278>
+    myproc()->tf = tf;
+80109c68:	e8 03 d2 ff ff       	call   80106e70 <myproc>
+80109c6d:	89 58 18             	mov    %ebx,0x18(%eax)
+    syscall();
+80109c70:	e8 6b ec ff ff       	call   801088e0 <syscall>
+    if(myproc()->killed)
+80109c75:	e8 f6 d1 ff ff       	call   80106e70 <myproc>
+80109c7a:	8b 48 24             	mov    0x24(%eax),%ecx
+80109c7d:	85 c9                	test   %ecx,%ecx
+80109c7f:	0f 84 f9 fe ff ff    	je     80109b7e <trap+0x9e>
+}
+80109c85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109c88:	5b                   	pop    %ebx
+80109c89:	5e                   	pop    %esi
+80109c8a:	5f                   	pop    %edi
+80109c8b:	5d                   	pop    %ebp
+      exit();
+80109c8c:	e9 8f dc ff ff       	jmp    80107920 <exit>
+80109c91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    cprintf("cpu%d: spurious interrupt at %x:%x\n",
+80109c98:	8b 7b 38             	mov    0x38(%ebx),%edi
+80109c9b:	0f b7 73 3c          	movzwl 0x3c(%ebx),%esi
+80109c9f:	e8 fc cf ff ff       	call   80106ca0 <cpuid>
+80109ca4:	57                   	push   %edi
+80109ca5:	56                   	push   %esi
+80109ca6:	50                   	push   %eax
+80109ca7:	68 a4 bf 10 80       	push   $0x8010bfa4
+80109cac:	e8 df 6c ff ff       	call   80100990 <cprintf>
+    lapiceoi();
+80109cb1:	e8 ca b3 ff ff       	call   80105080 <lapiceoi>
+    break;
+80109cb6:	83 c4 10             	add    $0x10,%esp
+80109cb9:	e9 5c fe ff ff       	jmp    80109b1a <trap+0x3a>
+80109cbe:	66 90                	xchg   %ax,%ax
+    if(cpuid() == 0){
+80109cc0:	e8 db cf ff ff       	call   80106ca0 <cpuid>
+80109cc5:	85 c0                	test   %eax,%eax
+80109cc7:	0f 84 9b 00 00 00    	je     80109d68 <trap+0x288>
+    mycpu()->nticks++;
+80109ccd:	e8 6e cf ff ff       	call   80106c40 <mycpu>
+80109cd2:	83 80 b4 00 00 00 01 	addl   $0x1,0xb4(%eax)
+    if(mycpu()->idle)
+80109cd9:	e8 62 cf ff ff       	call   80106c40 <mycpu>
+80109cde:	8b 80 b0 00 00 00    	mov    0xb0(%eax),%eax
+80109ce4:	85 c0                	test   %eax,%eax
+80109ce6:	0f 84 29 fe ff ff    	je     80109b15 <trap+0x35>
+      mycpu()->idleticks++;
+80109cec:	e8 4f cf ff ff       	call   80106c40 <mycpu>
+80109cf1:	83 80 b8 00 00 00 01 	addl   $0x1,0xb8(%eax)
+    lapiceoi();
+80109cf8:	e9 18 fe ff ff       	jmp    80109b15 <trap+0x35>
+80109cfd:	8d 76 00             	lea    0x0(%esi),%esi
+    uartintr();
+80109d00:	e8 cb 02 00 00       	call   80109fd0 <uartintr>
+    lapiceoi();
+80109d05:	e8 76 b3 ff ff       	call   80105080 <lapiceoi>
+    break;
+80109d0a:	e9 0b fe ff ff       	jmp    80109b1a <trap+0x3a>
+80109d0f:	90                   	nop
+    kbdintr();
+80109d10:	e8 2b b2 ff ff       	call   80104f40 <kbdintr>
+    lapiceoi();
+80109d15:	e8 66 b3 ff ff       	call   80105080 <lapiceoi>
+    break;
+80109d1a:	e9 fb fd ff ff       	jmp    80109b1a <trap+0x3a>
+80109d1f:	90                   	nop
+    exit();
+80109d20:	e8 fb db ff ff       	call   80107920 <exit>
+80109d25:	e9 16 fe ff ff       	jmp    80109b40 <trap+0x60>
+80109d2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80109d30:	0f 20 d6             	mov    %cr2,%esi
+        if((tf->err & FEC_WR) && cowfault(myproc()->pgdir, rcr2()) == 0)
+80109d33:	e8 38 d1 ff ff       	call   80106e70 <myproc>
+80109d38:	83 ec 08             	sub    $0x8,%esp
+80109d3b:	56                   	push   %esi
+80109d3c:	ff 70 04             	push   0x4(%eax)
+80109d3f:	e8 1c 16 00 00       	call   8010b360 <cowfault>
+80109d44:	83 c4 10             	add    $0x10,%esp
+80109d47:	85 c0                	test   %eax,%eax
+80109d49:	0f 84 cb fd ff ff    	je     80109b1a <trap+0x3a>
+80109d4f:	e9 5c fe ff ff       	jmp    80109bb0 <trap+0xd0>
+80109d54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      exit();
+80109d58:	e8 c3 db ff ff       	call   80107920 <exit>
+80109d5d:	e9 06 ff ff ff       	jmp    80109c68 <trap+0x188>
+80109d62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      acquire(&tickslock);
+80109d68:	83 ec 0c             	sub    $0xc,%esp
+80109d6b:	68 a0 5f 23 80       	push   $0x80235fa0
+80109d70:	e8 eb e3 ff ff       	call   80108160 <acquire>
+      ticks++;
+80109d75:	a1 80 5f 23 80       	mov    0x80235f80,%eax
+  for(pp = &wheel[ticks % NWHEEL]; (p = *pp) != 0; ){
+80109d7a:	83 c4 10             	add    $0x10,%esp
+      ticks++;
+80109d7d:	8d 50 01             	lea    0x1(%eax),%edx
+  for(pp = &wheel[ticks % NWHEEL]; (p = *pp) != 0; ){
+80109d80:	89 d0                	mov    %edx,%eax
+      ticks++;
+80109d82:	89 15 80 5f 23 80    	mov    %edx,0x80235f80
+  for(pp = &wheel[ticks % NWHEEL]; (p = *pp) != 0; ){
+80109d88:	83 e0 3f             	and    $0x3f,%eax
+80109d8b:	8d 34 85 e0 67 23 80 	lea    -0x7fdc9820(,%eax,4),%esi
+80109d92:	8b 04 85 e0 67 23 80 	mov    -0x7fdc9820(,%eax,4),%eax
+80109d99:	85 c0                	test   %eax,%eax
+80109d9b:	75 15                	jne    80109db2 <trap+0x2d2>
+80109d9d:	eb 39                	jmp    80109dd8 <trap+0x2f8>
+80109d9f:	90                   	nop
+      pp = &p->tnext;
+80109da0:	8d b0 8c 00 00 00    	lea    0x8c(%eax),%esi
+  for(pp = &wheel[ticks % NWHEEL]; (p = *pp) != 0; ){
+80109da6:	8b 06                	mov    (%esi),%eax
+80109da8:	85 c0                	test   %eax,%eax
+80109daa:	74 2c                	je     80109dd8 <trap+0x2f8>
+    if(p->deadline == ticks){
+80109dac:	8b 15 80 5f 23 80    	mov    0x80235f80,%edx
+80109db2:	39 90 88 00 00 00    	cmp    %edx,0x88(%eax)
+80109db8:	75 e6                	jne    80109da0 <trap+0x2c0>
+      *pp = p->tnext;
+80109dba:	8b 90 8c 00 00 00    	mov    0x8c(%eax),%edx
+      wakeup(&p->deadline);
+80109dc0:	83 ec 0c             	sub    $0xc,%esp
+80109dc3:	05 88 00 00 00       	add    $0x88,%eax
+      *pp = p->tnext;
+80109dc8:	89 16                	mov    %edx,(%esi)
+      wakeup(&p->deadline);
+80109dca:	50                   	push   %eax
+80109dcb:	e8 c0 da ff ff       	call   80107890 <wakeup>
+80109dd0:	83 c4 10             	add    $0x10,%esp
+80109dd3:	eb d1                	jmp    80109da6 <trap+0x2c6>
+80109dd5:	8d 76 00             	lea    0x0(%esi),%esi
+      release(&tickslock);
+80109dd8:	83 ec 0c             	sub    $0xc,%esp
+80109ddb:	68 a0 5f 23 80       	push   $0x80235fa0
+80109de0:	e8 bb e5 ff ff       	call   801083a0 <release>
+80109de5:	83 c4 10             	add    $0x10,%esp
+80109de8:	e9 e0 fe ff ff       	jmp    80109ccd <trap+0x1ed>
+80109ded:	8d 76 00             	lea    0x0(%esi),%esi
+      } else if(lazyfault(myproc()->pgdir, rcr2(), myproc()->sz) == 0)
+80109df0:	e8 7b d0 ff ff       	call   80106e70 <myproc>
+80109df5:	8b 38                	mov    (%eax),%edi
+80109df7:	0f 20 d6             	mov    %cr2,%esi
+80109dfa:	e8 71 d0 ff ff       	call   80106e70 <myproc>
+80109dff:	83 ec 04             	sub    $0x4,%esp
+80109e02:	57                   	push   %edi
+80109e03:	56                   	push   %esi
+80109e04:	ff 70 04             	push   0x4(%eax)
+80109e07:	e8 44 16 00 00       	call   8010b450 <lazyfault>
+80109e0c:	83 c4 10             	add    $0x10,%esp
+80109e0f:	85 c0                	test   %eax,%eax
+80109e11:	0f 84 03 fd ff ff    	je     80109b1a <trap+0x3a>
+80109e17:	e9 94 fd ff ff       	jmp    80109bb0 <trap+0xd0>
+80109e1c:	0f 20 d6             	mov    %cr2,%esi
+      cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
+80109e1f:	e8 7c ce ff ff       	call   80106ca0 <cpuid>
+80109e24:	83 ec 0c             	sub    $0xc,%esp
+80109e27:	56                   	push   %esi
+80109e28:	57                   	push   %edi
+80109e29:	50                   	push   %eax
+80109e2a:	ff 73 30             	push   0x30(%ebx)
+80109e2d:	68 c8 bf 10 80       	push   $0x8010bfc8
+80109e32:	e8 59 6b ff ff       	call   80100990 <cprintf>
+      panic("trap");
+80109e37:	83 c4 14             	add    $0x14,%esp
+80109e3a:	68 9e bf 10 80       	push   $0x8010bf9e
+80109e3f:	e8 1c 68 ff ff       	call   80100660 <panic>
+80109e44:	66 90                	xchg   %ax,%ax
+80109e46:	66 90                	xchg   %ax,%ax
+80109e48:	66 90                	xchg   %ax,%ax
+80109e4a:	66 90                	xchg   %ax,%ax
+80109e4c:	66 90                	xchg   %ax,%ax
+80109e4e:	66 90                	xchg   %ax,%ax
+
+80109e50 <uartgetc>:
+}
+
+static int
+uartgetc(void)
+{
+  if(!uart)
+80109e50:	a1 e0 68 23 80       	mov    0x802368e0,%eax
+80109e55:	85 c0                	test   %eax,%eax
+80109e57:	74 17                	je     80109e70 <uartgetc+0x20>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80109e59:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80109e5e:	ec                   	in     (%dx),%al
+    return -1;
+  if(!(inb(COM1+5) & 0x01))
+80109e5f:	a8 01                	test   $0x1,%al
+80109e61:	74 0d                	je     80109e70 <uartgetc+0x20>
+80109e63:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109e68:	ec                   	in     (%dx),%al
+    return -1;
+  return inb(COM1+0);
+80109e69:	0f b6 c0             	movzbl %al,%eax
+80109e6c:	c3                   	ret
+80109e6d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80109e70:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109e75:	c3                   	ret
+80109e76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109e7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80109e80 <uartinit>:
+{
+80109e80:	55                   	push   %ebp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109e81:	31 c9                	xor    %ecx,%ecx
+80109e83:	89 c8                	mov    %ecx,%eax
+80109e85:	89 e5                	mov    %esp,%ebp
+80109e87:	57                   	push   %edi
+80109e88:	bf fa 03 00 00       	mov    $0x3fa,%edi
+80109e8d:	56                   	push   %esi
+80109e8e:	89 fa                	mov    %edi,%edx
+80109e90:	53                   	push   %ebx
+80109e91:	83 ec 1c             	sub    $0x1c,%esp
+80109e94:	ee                   	out    %al,(%dx)
+80109e95:	be fb 03 00 00       	mov    $0x3fb,%esi
+80109e9a:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+80109e9f:	89 f2                	mov    %esi,%edx
+80109ea1:	ee                   	out    %al,(%dx)
+80109ea2:	b8 0c 00 00 00       	mov    $0xc,%eax
+80109ea7:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109eac:	ee                   	out    %al,(%dx)
+80109ead:	bb f9 03 00 00       	mov    $0x3f9,%ebx
+80109eb2:	89 c8                	mov    %ecx,%eax
+80109eb4:	89 da                	mov    %ebx,%edx
+80109eb6:	ee                   	out    %al,(%dx)
+80109eb7:	b8 03 00 00 00       	mov    $0x3,%eax
+80109ebc:	89 f2                	mov    %esi,%edx
+80109ebe:	ee                   	out    %al,(%dx)
+80109ebf:	ba fc 03 00 00       	mov    $0x3fc,%edx
+80109ec4:	89 c8                	mov    %ecx,%eax
+80109ec6:	ee                   	out    %al,(%dx)
+80109ec7:	b8 01 00 00 00       	mov    $0x1,%eax
+80109ecc:	89 da                	mov    %ebx,%edx
+80109ece:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80109ecf:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80109ed4:	ec                   	in     (%dx),%al
+  if(inb(COM1+5) == 0xFF)
+80109ed5:	3c ff                	cmp    $0xff,%al
+80109ed7:	0f 84 7c 00 00 00    	je     80109f59 <uartinit+0xd9>
+  uart = 1;
+80109edd:	c7 05 e0 68 23 80 01 	movl   $0x1,0x802368e0
+80109ee4:	00 00 00 
+80109ee7:	89 fa                	mov    %edi,%edx
+80109ee9:	ec                   	in     (%dx),%al
+80109eea:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109eef:	ec                   	in     (%dx),%al
+  ioapicenable(IRQ_COM1, 0);
+80109ef0:	83 ec 08             	sub    $0x8,%esp
+  for(p="xv6...\n"; *p; p++)
+80109ef3:	bf 08 c1 10 80       	mov    $0x8010c108,%edi
+80109ef8:	be fd 03 00 00       	mov    $0x3fd,%esi
+  ioapicenable(IRQ_COM1, 0);
+80109efd:	6a 00                	push   $0x0
+80109eff:	6a 04                	push   $0x4
+80109f01:	e8 ea a9 ff ff       	call   801048f0 <ioapicenable>
+  for(p="xv6...\n"; *p; p++)
+80109f06:	c6 45 e7 78          	movb   $0x78,-0x19(%ebp)
+  ioapicenable(IRQ_COM1, 0);
+80109f0a:	83 c4 10             	add    $0x10,%esp
+80109f0d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(!uart)
+80109f10:	a1 e0 68 23 80       	mov    0x802368e0,%eax
+80109f15:	85 c0                	test   %eax,%eax
+80109f17:	74 32                	je     80109f4b <uartinit+0xcb>
+80109f19:	89 f2                	mov    %esi,%edx
+80109f1b:	ec                   	in     (%dx),%al
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109f1c:	a8 20                	test   $0x20,%al
+80109f1e:	75 21                	jne    80109f41 <uartinit+0xc1>
+80109f20:	bb 80 00 00 00       	mov    $0x80,%ebx
+80109f25:	8d 76 00             	lea    0x0(%esi),%esi
+    microdelay(10);
+80109f28:	83 ec 0c             	sub    $0xc,%esp
+80109f2b:	6a 0a                	push   $0xa
+80109f2d:	e8 ae b1 ff ff       	call   801050e0 <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109f32:	83 c4 10             	add    $0x10,%esp
+80109f35:	83 eb 01             	sub    $0x1,%ebx
+80109f38:	74 07                	je     80109f41 <uartinit+0xc1>
+80109f3a:	89 f2                	mov    %esi,%edx
+80109f3c:	ec                   	in     (%dx),%al
+80109f3d:	a8 20                	test   $0x20,%al
+80109f3f:	74 e7                	je     80109f28 <uartinit+0xa8>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109f41:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109f46:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+80109f4a:	ee                   	out    %al,(%dx)
+  for(p="xv6...\n"; *p; p++)
+80109f4b:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+80109f4f:	83 c7 01             	add    $0x1,%edi
+80109f52:	88 45 e7             	mov    %al,-0x19(%ebp)
+80109f55:	84 c0                	test   %al,%al
+80109f57:	75 b7                	jne    80109f10 <uartinit+0x90>
+}
+80109f59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109f5c:	5b                   	pop    %ebx
+80109f5d:	5e                   	pop    %esi
+80109f5e:	5f                   	pop    %edi
+80109f5f:	5d                   	pop    %ebp
+80109f60:	c3                   	ret
+80109f61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109f68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109f6f:	90                   	nop
+
+80109f70 <uartputc>:
+  if(!uart)
+80109f70:	a1 e0 68 23 80       	mov    0x802368e0,%eax
+80109f75:	85 c0                	test   %eax,%eax
+80109f77:	74 4f                	je     80109fc8 <uartputc+0x58>
+{
+80109f79:	55                   	push   %ebp
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80109f7a:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80109f7f:	89 e5                	mov    %esp,%ebp
+80109f81:	56                   	push   %esi
+80109f82:	53                   	push   %ebx
+80109f83:	ec                   	in     (%dx),%al
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109f84:	a8 20                	test   $0x20,%al
+80109f86:	75 29                	jne    80109fb1 <uartputc+0x41>
+80109f88:	bb 80 00 00 00       	mov    $0x80,%ebx
+80109f8d:	be fd 03 00 00       	mov    $0x3fd,%esi
+80109f92:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    microdelay(10);
+80109f98:	83 ec 0c             	sub    $0xc,%esp
+80109f9b:	6a 0a                	push   $0xa
+80109f9d:	e8 3e b1 ff ff       	call   801050e0 <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109fa2:	83 c4 10             	add    $0x10,%esp
+80109fa5:	83 eb 01             	sub    $0x1,%ebx
+80109fa8:	74 07                	je     80109fb1 <uartputc+0x41>
+80109faa:	89 f2                	mov    %esi,%edx
+80109fac:	ec                   	in     (%dx),%al
+80109fad:	a8 20                	test   $0x20,%al
+80109faf:	74 e7                	je     80109f98 <uartputc+0x28>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109fb1:	8b 45 08             	mov    0x8(%ebp),%eax
+80109fb4:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109fb9:	ee                   	out    %al,(%dx)
+}
+80109fba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80109fbd:	5b                   	pop    %ebx
+80109fbe:	5e                   	pop    %esi
+80109fbf:	5d                   	pop    %ebp
+80109fc0:	c3                   	ret
+80109fc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109fc8:	c3                   	ret
+80109fc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80109fd0 <uartintr>:
+
+void
+uartintr(void)
+{
+80109fd0:	55                   	push   %ebp
+80109fd1:	89 e5                	mov    %esp,%ebp
+80109fd3:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(uartgetc);
+80109fd6:	68 50 9e 10 80       	push   $0x80109e50
+80109fdb:	e8 c0 6b ff ff       	call   80100ba0 <consoleintr>
+}
+80109fe0:	83 c4 10             	add    $0x10,%esp
+80109fe3:	c9                   	leave
+80109fe4:	c3                   	ret
+
+80109fe5 <vector0>:
+# generated by vectors.pl - do not edit
+# handlers
+.globl alltraps
+.globl vector0
+vector0:
+  pushl $0
+80109fe5:	6a 00                	push   $0x0
+  pushl $0
+80109fe7:	6a 00                	push   $0x0
+  jmp alltraps
+80109fe9:	e9 41 f9 ff ff       	jmp    8010992f <alltraps>
+
+80109fee <vector1>:
+.globl vector1
+vector1:
+  pushl $0
+80109fee:	6a 00                	push   $0x0
+  pushl $1
+80109ff0:	6a 01                	push   $0x1
+  jmp alltraps
+80109ff2:	e9 38 f9 ff ff       	jmp    8010992f <alltraps>
+
+80109ff7 <vector2>:
+.globl vector2
+vector2:
+  pushl $0
+80109ff7:	6a 00                	push   $0x0
+  pushl $2
+80109ff9:	6a 02                	push   $0x2
+  jmp alltraps
+80109ffb:	e9 2f f9 ff ff       	jmp    8010992f <alltraps>
+
+8010a000 <vector3>:
+.globl vector3
+vector3:
+  pushl $0
+8010a000:	6a 00                	push   $0x0
+  pushl $3
+8010a002:	6a 03                	push   $0x3
+  jmp alltraps
+8010a004:	e9 26 f9 ff ff       	jmp    8010992f <alltraps>
+
+8010a009 <vector4>:
+.globl vector4
+vector4:
+  pushl $0
+8010a009:	6a 00                	push   $0x0
+  pushl $4
+8010a00b:	6a 04                	push   $0x4
+  jmp alltraps
+8010a00d:	e9 1d f9 ff ff       	jmp    8010992f <alltraps>
+
+8010a012 <vector5>:
+.globl vector5
+vector5:
+  pushl $0
+8010a012:	6a 00                	push   $0x0
+  pushl $5
+8010a014:	6a 05                	push   $0x5
+  jmp alltraps
+8010a016:	e9 14 f9 ff ff       	jmp    8010992f <alltraps>
+
+8010a01b <vector6>:
+.globl vector6
+vector6:
+  pushl $0
+8010a01b:	6a 00                	push   $0x0
+  pushl $6
+8010a01d:	6a 06                	push   $0x6
+  jmp alltraps
+8010a01f:	e9 0b f9 ff ff       	jmp    8010992f <alltraps>
+
+8010a024 <vector7>:
+.globl vector7
+vector7:
+  pushl $0
+8010a024:	6a 00                	push   $0x0
+  pushl $7
+8010a026:	6a 07                	push   $0x7
+  jmp alltraps
+8010a028:	e9 02 f9 ff ff       	jmp    8010992f <alltraps>
+
+8010a02d <vector8>:
+.globl vector8
+vector8:
+  pushl $8
+8010a02d:	6a 08                	push   $0x8
+  jmp alltraps
+8010a02f:	e9 fb f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a034 <vector9>:
+.globl vector9
+vector9:
+  pushl $0
+8010a034:	6a 00                	push   $0x0
+  pushl $9
+8010a036:	6a 09                	push   $0x9
+  jmp alltraps
+8010a038:	e9 f2 f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a03d <vector10>:
+.globl vector10
+vector10:
+  pushl $10
+8010a03d:	6a 0a                	push   $0xa
+  jmp alltraps
+8010a03f:	e9 eb f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a044 <vector11>:
+.globl vector11
+vector11:
+  pushl $11
+8010a044:	6a 0b                	push   $0xb
+  jmp alltraps
+8010a046:	e9 e4 f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a04b <vector12>:
+.globl vector12
+vector12:
+  pushl $12
+8010a04b:	6a 0c                	push   $0xc
+  jmp alltraps
+8010a04d:	e9 dd f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a052 <vector13>:
+.globl vector13
+vector13:
+  pushl $13
+8010a052:	6a 0d                	push   $0xd
+  jmp alltraps
+8010a054:	e9 d6 f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a059 <vector14>:
+.globl vector14
+vector14:
+  pushl $14
+8010a059:	6a 0e                	push   $0xe
+  jmp alltraps
+8010a05b:	e9 cf f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a060 <vector15>:
+.globl vector15
+vector15:
+  pushl $0
+8010a060:	6a 00                	push   $0x0
+  pushl $15
+8010a062:	6a 0f                	push   $0xf
+  jmp alltraps
+8010a064:	e9 c6 f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a069 <vector16>:
+.globl vector16
+vector16:
+  pushl $0
+8010a069:	6a 00                	push   $0x0
+  pushl $16
+8010a06b:	6a 10                	push   $0x10
+  jmp alltraps
+8010a06d:	e9 bd f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a072 <vector17>:
+.globl vector17
+vector17:
+  pushl $17
+8010a072:	6a 11                	push   $0x11
+  jmp alltraps
+8010a074:	e9 b6 f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a079 <vector18>:
+.globl vector18
+vector18:
+  pushl $0
+8010a079:	6a 00                	push   $0x0
+  pushl $18
+8010a07b:	6a 12                	push   $0x12
+  jmp alltraps
+8010a07d:	e9 ad f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a082 <vector19>:
+.globl vector19
+vector19:
+  pushl $0
+8010a082:	6a 00                	push   $0x0
+  pushl $19
+8010a084:	6a 13                	push   $0x13
+  jmp alltraps
+8010a086:	e9 a4 f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a08b <vector20>:
+.globl vector20
+vector20:
+  pushl $0
+8010a08b:	6a 00                	push   $0x0
+  pushl $20
+8010a08d:	6a 14                	push   $0x14
+  jmp alltraps
+8010a08f:	e9 9b f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a094 <vector21>:
+.globl vector21
+vector21:
+  pushl $0
+8010a094:	6a 00                	push   $0x0
+  pushl $21
+8010a096:	6a 15                	push   $0x15
+  jmp alltraps
+8010a098:	e9 92 f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a09d <vector22>:
+.globl vector22
+vector22:
+  pushl $0
+8010a09d:	6a 00                	push   $0x0
+  pushl $22
+8010a09f:	6a 16                	push   $0x16
+  jmp alltraps
+8010a0a1:	e9 89 f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a0a6 <vector23>:
+.globl vector23
+vector23:
+  pushl $0
+8010a0a6:	6a 00                	push   $0x0
+  pushl $23
+8010a0a8:	6a 17                	push   $0x17
+  jmp alltraps
+8010a0aa:	e9 80 f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a0af <vector24>:
+.globl vector24
+vector24:
+  pushl $0
+8010a0af:	6a 00                	push   $0x0
+  pushl $24
+8010a0b1:	6a 18                	push   $0x18
+  jmp alltraps
+8010a0b3:	e9 77 f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a0b8 <vector25>:
+.globl vector25
+vector25:
+  pushl $0
+8010a0b8:	6a 00                	push   $0x0
+  pushl $25
+8010a0ba:	6a 19                	push   $0x19
+  jmp alltraps
+8010a0bc:	e9 6e f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a0c1 <vector26>:
+.globl vector26
+vector26:
+  pushl $0
+8010a0c1:	6a 00                	push   $0x0
+  pushl $26
+8010a0c3:	6a 1a                	push   $0x1a
+  jmp alltraps
+8010a0c5:	e9 65 f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a0ca <vector27>:
+.globl vector27
+vector27:
+  pushl $0
+8010a0ca:	6a 00                	push   $0x0
+  pushl $27
+8010a0cc:	6a 1b                	push   $0x1b
+  jmp alltraps
+8010a0ce:	e9 5c f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a0d3 <vector28>:
+.globl vector28
+vector28:
+  pushl $0
+8010a0d3:	6a 00                	push   $0x0
+  pushl $28
+8010a0d5:	6a 1c                	push   $0x1c
+  jmp alltraps
+8010a0d7:	e9 53 f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a0dc <vector29>:
+.globl vector29
+vector29:
+  pushl $0
+8010a0dc:	6a 00                	push   $0x0
+  pushl $29
+8010a0de:	6a 1d                	push   $0x1d
+  jmp alltraps
+8010a0e0:	e9 4a f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a0e5 <vector30>:
+.globl vector30
+vector30:
+  pushl $0
+8010a0e5:	6a 00                	push   $0x0
+  pushl $30
+8010a0e7:	6a 1e                	push   $0x1e
+  jmp alltraps
+8010a0e9:	e9 41 f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a0ee <vector31>:
+.globl vector31
+vector31:
+  pushl $0
+8010a0ee:	6a 00                	push   $0x0
+  pushl $31
+8010a0f0:	6a 1f                	push   $0x1f
+  jmp alltraps
+8010a0f2:	e9 38 f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a0f7 <vector32>:
+.globl vector32
+vector32:
+  pushl $0
+8010a0f7:	6a 00                	push   $0x0
+  pushl $32
+8010a0f9:	6a 20                	push   $0x20
+  jmp alltraps
+8010a0fb:	e9 2f f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a100 <vector33>:
+.globl vector33
+vector33:
+  pushl $0
+8010a100:	6a 00                	push   $0x0
+  pushl $33
+8010a102:	6a 21                	push   $0x21
+  jmp alltraps
+8010a104:	e9 26 f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a109 <vector34>:
+.globl vector34
+vector34:
+  pushl $0
+8010a109:	6a 00                	push   $0x0
+  pushl $34
+8010a10b:	6a 22                	push   $0x22
+  jmp alltraps
+8010a10d:	e9 1d f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a112 <vector35>:
+.globl vector35
+vector35:
+  pushl $0
+8010a112:	6a 00                	push   $0x0
+  pushl $35
+8010a114:	6a 23                	push   $0x23
+  jmp alltraps
+8010a116:	e9 14 f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a11b <vector36>:
+.globl vector36
+vector36:
+  pushl $0
+8010a11b:	6a 00                	push   $0x0
+  pushl $36
+8010a11d:	6a 24                	push   $0x24
+  jmp alltraps
+8010a11f:	e9 0b f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a124 <vector37>:
+.globl vector37
+vector37:
+  pushl $0
+8010a124:	6a 00                	push   $0x0
+  pushl $37
+8010a126:	6a 25                	push   $0x25
+  jmp alltraps
+8010a128:	e9 02 f8 ff ff       	jmp    8010992f <alltraps>
+
+8010a12d <vector38>:
+.globl vector38
+vector38:
+  pushl $0
+8010a12d:	6a 00                	push   $0x0
+  pushl $38
+8010a12f:	6a 26                	push   $0x26
+  jmp alltraps
+8010a131:	e9 f9 f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a136 <vector39>:
+.globl vector39
+vector39:
+  pushl $0
+8010a136:	6a 00                	push   $0x0
+  pushl $39
+8010a138:	6a 27                	push   $0x27
+  jmp alltraps
+8010a13a:	e9 f0 f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a13f <vector40>:
+.globl vector40
+vector40:
+  pushl $0
+8010a13f:	6a 00                	push   $0x0
+  pushl $40
+8010a141:	6a 28                	push   $0x28
+  jmp alltraps
+8010a143:	e9 e7 f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a148 <vector41>:
+.globl vector41
+vector41:
+  pushl $0
+8010a148:	6a 00                	push   $0x0
+  pushl $41
+8010a14a:	6a 29                	push   $0x29
+  jmp alltraps
+8010a14c:	e9 de f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a151 <vector42>:
+.globl vector42
+vector42:
+  pushl $0
+8010a151:	6a 00                	push   $0x0
+  pushl $42
+8010a153:	6a 2a                	push   $0x2a
+  jmp alltraps
+8010a155:	e9 d5 f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a15a <vector43>:
+.globl vector43
+vector43:
+  pushl $0
+8010a15a:	6a 00                	push   $0x0
+  pushl $43
+8010a15c:	6a 2b                	push   $0x2b
+  jmp alltraps
+8010a15e:	e9 cc f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a163 <vector44>:
+.globl vector44
+vector44:
+  pushl $0
+8010a163:	6a 00                	push   $0x0
+  pushl $44
+8010a165:	6a 2c                	push   $0x2c
+  jmp alltraps
+8010a167:	e9 c3 f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a16c <vector45>:
+.globl vector45
+vector45:
+  pushl $0
+8010a16c:	6a 00                	push   $0x0
+  pushl $45
+8010a16e:	6a 2d                	push   $0x2d
+  jmp alltraps
+8010a170:	e9 ba f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a175 <vector46>:
+.globl vector46
+vector46:
+  pushl $0
+8010a175:	6a 00                	push   $0x0
+  pushl $46
+8010a177:	6a 2e                	push   $0x2e
+  jmp alltraps
+8010a179:	e9 b1 f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a17e <vector47>:
+.globl vector47
+vector47:
+  pushl $0
+8010a17e:	6a 00                	push   $0x0
+  pushl $47
+8010a180:	6a 2f                	push   $0x2f
+  jmp alltraps
+8010a182:	e9 a8 f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a187 <vector48>:
+.globl vector48
+vector48:
+  pushl $0
+8010a187:	6a 00                	push   $0x0
+  pushl $48
+8010a189:	6a 30                	push   $0x30
+  jmp alltraps
+8010a18b:	e9 9f f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a190 <vector49>:
+.globl vector49
+vector49:
+  pushl $0
+8010a190:	6a 00                	push   $0x0
+  pushl $49
+8010a192:	6a 31                	push   $0x31
+  jmp alltraps
+8010a194:	e9 96 f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a199 <vector50>:
+.globl vector50
+vector50:
+  pushl $0
+8010a199:	6a 00                	push   $0x0
+  pushl $50
+8010a19b:	6a 32                	push   $0x32
+  jmp alltraps
+8010a19d:	e9 8d f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a1a2 <vector51>:
+.globl vector51
+vector51:
+  pushl $0
+8010a1a2:	6a 00                	push   $0x0
+  pushl $51
+8010a1a4:	6a 33                	push   $0x33
+  jmp alltraps
+8010a1a6:	e9 84 f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a1ab <vector52>:
+.globl vector52
+vector52:
+  pushl $0
+8010a1ab:	6a 00                	push   $0x0
+  pushl $52
+8010a1ad:	6a 34                	push   $0x34
+  jmp alltraps
+8010a1af:	e9 7b f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a1b4 <vector53>:
+.globl vector53
+vector53:
+  pushl $0
+8010a1b4:	6a 00                	push   $0x0
+  pushl $53
+8010a1b6:	6a 35                	push   $0x35
+  jmp alltraps
+8010a1b8:	e9 72 f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a1bd <vector54>:
+.globl vector54
+vector54:
+  pushl $0
+8010a1bd:	6a 00                	push   $0x0
+  pushl $54
+8010a1bf:	6a 36                	push   $0x36
+  jmp alltraps
+8010a1c1:	e9 69 f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a1c6 <vector55>:
+.globl vector55
+vector55:
+  pushl $0
+8010a1c6:	6a 00                	push   $0x0
+  pushl $55
+8010a1c8:	6a 37                	push   $0x37
+  jmp alltraps
+8010a1ca:	e9 60 f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a1cf <vector56>:
+.globl vector56
+vector56:
+  pushl $0
+8010a1cf:	6a 00                	push   $0x0
+  pushl $56
+8010a1d1:	6a 38                	push   $0x38
+  jmp alltraps
+8010a1d3:	e9 57 f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a1d8 <vector57>:
+.globl vector57
+vector57:
+  pushl $0
+8010a1d8:	6a 00                	push   $0x0
+  pushl $57
+8010a1da:	6a 39                	push   $0x39
+  jmp alltraps
+8010a1dc:	e9 4e f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a1e1 <vector58>:
+.globl vector58
+vector58:
+  pushl $0
+8010a1e1:	6a 00                	push   $0x0
+  pushl $58
+8010a1e3:	6a 3a                	push   $0x3a
+  jmp alltraps
+8010a1e5:	e9 45 f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a1ea <vector59>:
+.globl vector59
+vector59:
+  pushl $0
+8010a1ea:	6a 00                	push   $0x0
+  pushl $59
+8010a1ec:	6a 3b                	push   $0x3b
+  jmp alltraps
+8010a1ee:	e9 3c f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a1f3 <vector60>:
+.globl vector60
+vector60:
+  pushl $0
+8010a1f3:	6a 00                	push   $0x0
+  pushl $60
+8010a1f5:	6a 3c                	push   $0x3c
+  jmp alltraps
+8010a1f7:	e9 33 f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a1fc <vector61>:
+.globl vector61
+vector61:
+  pushl $0
+8010a1fc:	6a 00                	push   $0x0
+  pushl $61
+8010a1fe:	6a 3d                	push   $0x3d
+  jmp alltraps
+8010a200:	e9 2a f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a205 <vector62>:
+.globl vector62
+vector62:
+  pushl $0
+8010a205:	6a 00                	push   $0x0
+  pushl $62
+8010a207:	6a 3e                	push   $0x3e
+  jmp alltraps
+8010a209:	e9 21 f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a20e <vector63>:
+.globl vector63
+vector63:
+  pushl $0
+8010a20e:	6a 00                	push   $0x0
+  pushl $63
+8010a210:	6a 3f                	push   $0x3f
+  jmp alltraps
+8010a212:	e9 18 f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a217 <vector64>:
+.globl vector64
+vector64:
+  pushl $0
+8010a217:	6a 00                	push   $0x0
+  pushl $64
+8010a219:	6a 40                	push   $0x40
+  jmp alltraps
+8010a21b:	e9 0f f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a220 <vector65>:
+.globl vector65
+vector65:
+  pushl $0
+8010a220:	6a 00                	push   $0x0
+  pushl $65
+8010a222:	6a 41                	push   $0x41
+  jmp alltraps
+8010a224:	e9 06 f7 ff ff       	jmp    8010992f <alltraps>
+
+8010a229 <vector66>:
+.globl vector66
+vector66:
+  pushl $0
+8010a229:	6a 00                	push   $0x0
+  pushl $66
+8010a22b:	6a 42                	push   $0x42
+  jmp alltraps
+8010a22d:	e9 fd f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a232 <vector67>:
+.globl vector67
+vector67:
+  pushl $0
+8010a232:	6a 00                	push   $0x0
+  pushl $67
+8010a234:	6a 43                	push   $0x43
+  jmp alltraps
+8010a236:	e9 f4 f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a23b <vector68>:
+.globl vector68
+vector68:
+  pushl $0
+8010a23b:	6a 00                	push   $0x0
+  pushl $68
+8010a23d:	6a 44                	push   $0x44
+  jmp alltraps
+8010a23f:	e9 eb f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a244 <vector69>:
+.globl vector69
+vector69:
+  pushl $0
+8010a244:	6a 00                	push   $0x0
+  pushl $69
+8010a246:	6a 45                	push   $0x45
+  jmp alltraps
+8010a248:	e9 e2 f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a24d <vector70>:
+.globl vector70
+vector70:
+  pushl $0
+8010a24d:	6a 00                	push   $0x0
+  pushl $70
+8010a24f:	6a 46                	push   $0x46
+  jmp alltraps
+8010a251:	e9 d9 f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a256 <vector71>:
+.globl vector71
+vector71:
+  pushl $0
+8010a256:	6a 00                	push   $0x0
+  pushl $71
+8010a258:	6a 47                	push   $0x47
+  jmp alltraps
+8010a25a:	e9 d0 f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a25f <vector72>:
+.globl vector72
+vector72:
+  pushl $0
+8010a25f:	6a 00                	push   $0x0
+  pushl $72
+8010a261:	6a 48                	push   $0x48
+  jmp alltraps
+8010a263:	e9 c7 f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a268 <vector73>:
+.globl vector73
+vector73:
+  pushl $0
+8010a268:	6a 00                	push   $0x0
+  pushl $73
+8010a26a:	6a 49                	push   $0x49
+  jmp alltraps
+8010a26c:	e9 be f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a271 <vector74>:
+.globl vector74
+vector74:
+  pushl $0
+8010a271:	6a 00                	push   $0x0
+  pushl $74
+8010a273:	6a 4a                	push   $0x4a
+  jmp alltraps
+8010a275:	e9 b5 f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a27a <vector75>:
+.globl vector75
+vector75:
+  pushl $0
+8010a27a:	6a 00                	push   $0x0
+  pushl $75
+8010a27c:	6a 4b                	push   $0x4b
+  jmp alltraps
+8010a27e:	e9 ac f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a283 <vector76>:
+.globl vector76
+vector76:
+  pushl $0
+8010a283:	6a 00                	push   $0x0
+  pushl $76
+8010a285:	6a 4c                	push   $0x4c
+  jmp alltraps
+8010a287:	e9 a3 f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a28c <vector77>:
+.globl vector77
+vector77:
+  pushl $0
+8010a28c:	6a 00                	push   $0x0
+  pushl $77
+8010a28e:	6a 4d                	push   $0x4d
+  jmp alltraps
+8010a290:	e9 9a f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a295 <vector78>:
+.globl vector78
+vector78:
+  pushl $0
+8010a295:	6a 00                	push   $0x0
+  pushl $78
+8010a297:	6a 4e                	push   $0x4e
+  jmp alltraps
+8010a299:	e9 91 f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a29e <vector79>:
+.globl vector79
+vector79:
+  pushl $0
+8010a29e:	6a 00                	push   $0x0
+  pushl $79
+8010a2a0:	6a 4f                	push   $0x4f
+  jmp alltraps
+8010a2a2:	e9 88 f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a2a7 <vector80>:
+.globl vector80
+vector80:
+  pushl $0
+8010a2a7:	6a 00                	push   $0x0
+  pushl $80
+8010a2a9:	6a 50                	push   $0x50
+  jmp alltraps
+8010a2ab:	e9 7f f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a2b0 <vector81>:
+.globl vector81
+vector81:
+  pushl $0
+8010a2b0:	6a 00                	push   $0x0
+  pushl $81
+8010a2b2:	6a 51                	push   $0x51
+  jmp alltraps
+8010a2b4:	e9 76 f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a2b9 <vector82>:
+.globl vector82
+vector82:
+  pushl $0
+8010a2b9:	6a 00                	push   $0x0
+  pushl $82
+8010a2bb:	6a 52                	push   $0x52
+  jmp alltraps
+8010a2bd:	e9 6d f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a2c2 <vector83>:
+.globl vector83
+vector83:
+  pushl $0
+8010a2c2:	6a 00                	push   $0x0
+  pushl $83
+8010a2c4:	6a 53                	push   $0x53
+  jmp alltraps
+8010a2c6:	e9 64 f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a2cb <vector84>:
+.globl vector84
+vector84:
+  pushl $0
+8010a2cb:	6a 00                	push   $0x0
+  pushl $84
+8010a2cd:	6a 54                	push   $0x54
+  jmp alltraps
+8010a2cf:	e9 5b f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a2d4 <vector85>:
+.globl vector85
+vector85:
+  pushl $0
+8010a2d4:	6a 00                	push   $0x0
+  pushl $85
+8010a2d6:	6a 55                	push   $0x55
+  jmp alltraps
+8010a2d8:	e9 52 f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a2dd <vector86>:
+.globl vector86
+vector86:
+  pushl $0
+8010a2dd:	6a 00                	push   $0x0
+  pushl $86
+8010a2df:	6a 56                	push   $0x56
+  jmp alltraps
+8010a2e1:	e9 49 f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a2e6 <vector87>:
+.globl vector87
+vector87:
+  pushl $0
+8010a2e6:	6a 00                	push   $0x0
+  pushl $87
+8010a2e8:	6a 57                	push   $0x57
+  jmp alltraps
+8010a2ea:	e9 40 f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a2ef <vector88>:
+.globl vector88
+vector88:
+  pushl $0
+8010a2ef:	6a 00                	push   $0x0
+  pushl $88
+8010a2f1:	6a 58                	push   $0x58
+  jmp alltraps
+8010a2f3:	e9 37 f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a2f8 <vector89>:
+.globl vector89
+vector89:
+  pushl $0
+8010a2f8:	6a 00                	push   $0x0
+  pushl $89
+8010a2fa:	6a 59                	push   $0x59
+  jmp alltraps
+8010a2fc:	e9 2e f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a301 <vector90>:
+.globl vector90
+vector90:
+  pushl $0
+8010a301:	6a 00                	push   $0x0
+  pushl $90
+8010a303:	6a 5a                	push   $0x5a
+  jmp alltraps
+8010a305:	e9 25 f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a30a <vector91>:
+.globl vector91
+vector91:
+  pushl $0
+8010a30a:	6a 00                	push   $0x0
+  pushl $91
+8010a30c:	6a 5b                	push   $0x5b
+  jmp alltraps
+8010a30e:	e9 1c f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a313 <vector92>:
+.globl vector92
+vector92:
+  pushl $0
+8010a313:	6a 00                	push   $0x0
+  pushl $92
+8010a315:	6a 5c                	push   $0x5c
+  jmp alltraps
+8010a317:	e9 13 f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a31c <vector93>:
+.globl vector93
+vector93:
+  pushl $0
+8010a31c:	6a 00                	push   $0x0
+  pushl $93
+8010a31e:	6a 5d                	push   $0x5d
+  jmp alltraps
+8010a320:	e9 0a f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a325 <vector94>:
+.globl vector94
+vector94:
+  pushl $0
+8010a325:	6a 00                	push   $0x0
+  pushl $94
+8010a327:	6a 5e                	push   $0x5e
+  jmp alltraps
+8010a329:	e9 01 f6 ff ff       	jmp    8010992f <alltraps>
+
+8010a32e <vector95>:
+.globl vector95
+vector95:
+  pushl $0
+8010a32e:	6a 00                	push   $0x0
+  pushl $95
+8010a330:	6a 5f                	push   $0x5f
+  jmp alltraps
+8010a332:	e9 f8 f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a337 <vector96>:
+.globl vector96
+vector96:
+  pushl $0
+8010a337:	6a 00                	push   $0x0
+  pushl $96
+8010a339:	6a 60                	push   $0x60
+  jmp alltraps
+8010a33b:	e9 ef f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a340 <vector97>:
+.globl vector97
+vector97:
+  pushl $0
+8010a340:	6a 00                	push   $0x0
+  pushl $97
+8010a342:	6a 61                	push   $0x61
+  jmp alltraps
+8010a344:	e9 e6 f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a349 <vector98>:
+.globl vector98
+vector98:
+  pushl $0
+8010a349:	6a 00                	push   $0x0
+  pushl $98
+8010a34b:	6a 62                	push   $0x62
+  jmp alltraps
+8010a34d:	e9 dd f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a352 <vector99>:
+.globl vector99
+vector99:
+  pushl $0
+8010a352:	6a 00                	push   $0x0
+  pushl $99
+8010a354:	6a 63                	push   $0x63
+  jmp alltraps
+8010a356:	e9 d4 f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a35b <vector100>:
+.globl vector100
+vector100:
+  pushl $0
+8010a35b:	6a 00                	push   $0x0
+  pushl $100
+8010a35d:	6a 64                	push   $0x64
+  jmp alltraps
+8010a35f:	e9 cb f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a364 <vector101>:
+.globl vector101
+vector101:
+  pushl $0
+8010a364:	6a 00                	push   $0x0
+  pushl $101
+8010a366:	6a 65                	push   $0x65
+  jmp alltraps
+8010a368:	e9 c2 f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a36d <vector102>:
+.globl vector102
+vector102:
+  pushl $0
+8010a36d:	6a 00                	push   $0x0
+  pushl $102
+8010a36f:	6a 66                	push   $0x66
+  jmp alltraps
+8010a371:	e9 b9 f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a376 <vector103>:
+.globl vector103
+vector103:
+  pushl $0
+8010a376:	6a 00                	push   $0x0
+  pushl $103
+8010a378:	6a 67                	push   $0x67
+  jmp alltraps
+8010a37a:	e9 b0 f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a37f <vector104>:
+.globl vector104
+vector104:
+  pushl $0
+8010a37f:	6a 00                	push   $0x0
+  pushl $104
+8010a381:	6a 68                	push   $0x68
+  jmp alltraps
+8010a383:	e9 a7 f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a388 <vector105>:
+.globl vector105
+vector105:
+  pushl $0
+8010a388:	6a 00                	push   $0x0
+  pushl $105
+8010a38a:	6a 69                	push   $0x69
+  jmp alltraps
+8010a38c:	e9 9e f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a391 <vector106>:
+.globl vector106
+vector106:
+  pushl $0
+8010a391:	6a 00                	push   $0x0
+  pushl $106
+8010a393:	6a 6a                	push   $0x6a
+  jmp alltraps
+8010a395:	e9 95 f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a39a <vector107>:
+.globl vector107
+vector107:
+  pushl $0
+8010a39a:	6a 00                	push   $0x0
+  pushl $107
+8010a39c:	6a 6b                	push   $0x6b
+  jmp alltraps
+8010a39e:	e9 8c f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a3a3 <vector108>:
+.globl vector108
+vector108:
+  pushl $0
+8010a3a3:	6a 00                	push   $0x0
+  pushl $108
+8010a3a5:	6a 6c                	push   $0x6c
+  jmp alltraps
+8010a3a7:	e9 83 f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a3ac <vector109>:
+.globl vector109
+vector109:
+  pushl $0
+8010a3ac:	6a 00                	push   $0x0
+  pushl $109
+8010a3ae:	6a 6d                	push   $0x6d
+  jmp alltraps
+8010a3b0:	e9 7a f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a3b5 <vector110>:
+.globl vector110
+vector110:
+  pushl $0
+8010a3b5:	6a 00                	push   $0x0
+  pushl $110
+8010a3b7:	6a 6e                	push   $0x6e
+  jmp alltraps
+8010a3b9:	e9 71 f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a3be <vector111>:
+.globl vector111
+vector111:
+  pushl $0
+8010a3be:	6a 00                	push   $0x0
+  pushl $111
+8010a3c0:	6a 6f                	push   $0x6f
+  jmp alltraps
+8010a3c2:	e9 68 f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a3c7 <vector112>:
+.globl vector112
+vector112:
+  pushl $0
+8010a3c7:	6a 00                	push   $0x0
+  pushl $112
+8010a3c9:	6a 70                	push   $0x70
+  jmp alltraps
+8010a3cb:	e9 5f f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a3d0 <vector113>:
+.globl vector113
+vector113:
+  pushl $0
+8010a3d0:	6a 00                	push   $0x0
+  pushl $113
+8010a3d2:	6a 71                	push   $0x71
+  jmp alltraps
+8010a3d4:	e9 56 f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a3d9 <vector114>:
+.globl vector114
+vector114:
+  pushl $0
+8010a3d9:	6a 00                	push   $0x0
+  pushl $114
+8010a3db:	6a 72                	push   $0x72
+  jmp alltraps
+8010a3dd:	e9 4d f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a3e2 <vector115>:
+.globl vector115
+vector115:
+  pushl $0
+8010a3e2:	6a 00                	push   $0x0
+  pushl $115
+8010a3e4:	6a 73                	push   $0x73
+  jmp alltraps
+8010a3e6:	e9 44 f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a3eb <vector116>:
+.globl vector116
+vector116:
+  pushl $0
+8010a3eb:	6a 00                	push   $0x0
+  pushl $116
+8010a3ed:	6a 74                	push   $0x74
+  jmp alltraps
+8010a3ef:	e9 3b f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a3f4 <vector117>:
+.globl vector117
+vector117:
+  pushl $0
+8010a3f4:	6a 00                	push   $0x0
+  pushl $117
+8010a3f6:	6a 75                	push   $0x75
+  jmp alltraps
+8010a3f8:	e9 32 f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a3fd <vector118>:
+.globl vector118
+vector118:
+  pushl $0
+8010a3fd:	6a 00                	push   $0x0
+  pushl $118
+8010a3ff:	6a 76                	push   $0x76
+  jmp alltraps
+8010a401:	e9 29 f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a406 <vector119>:
+.globl vector119
+vector119:
+  pushl $0
+8010a406:	6a 00                	push   $0x0
+  pushl $119
+8010a408:	6a 77                	push   $0x77
+  jmp alltraps
+8010a40a:	e9 20 f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a40f <vector120>:
+.globl vector120
+vector120:
+  pushl $0
+8010a40f:	6a 00                	push   $0x0
+  pushl $120
+8010a411:	6a 78                	push   $0x78
+  jmp alltraps
+8010a413:	e9 17 f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a418 <vector121>:
+.globl vector121
+vector121:
+  pushl $0
+8010a418:	6a 00                	push   $0x0
+  pushl $121
+8010a41a:	6a 79                	push   $0x79
+  jmp alltraps
+8010a41c:	e9 0e f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a421 <vector122>:
+.globl vector122
+vector122:
+  pushl $0
+8010a421:	6a 00                	push   $0x0
+  pushl $122
+8010a423:	6a 7a                	push   $0x7a
+  jmp alltraps
+8010a425:	e9 05 f5 ff ff       	jmp    8010992f <alltraps>
+
+8010a42a <vector123>:
+.globl vector123
+vector123:
+  pushl $0
+8010a42a:	6a 00                	push   $0x0
+  pushl $123
+8010a42c:	6a 7b                	push   $0x7b
+  jmp alltraps
+8010a42e:	e9 fc f4 ff ff       	jmp    8010992f <alltraps>
+
+8010a433 <vector124>:
+.globl vector124
+vector124:
+  pushl $0
+8010a433:	6a 00                	push   $0x0
+  pushl $124
+8010a435:	6a 7c                	push   $0x7c
+  jmp alltraps
+8010a437:	e9 f3 f4 ff ff       	jmp    8010992f <alltraps>
+
+8010a43c <vector125>:
+.globl vector125
+vector125:
+  pushl $0
+8010a43c:	6a 00                	push   $0x0
+  pushl $125
+8010a43e:	6a 7d                	push   $0x7d
+  jmp alltraps
+8010a440:	e9 ea f4 ff ff       	jmp    8010992f <alltraps>
+
+8010a445 <vector126>:
+.globl vector126
+vector126:
+  pushl $0
+8010a445:	6a 00                	push   $0x0
+  pushl $126
+8010a447:	6a 7e                	push   $0x7e
+  jmp alltraps
+8010a449:	e9 e1 f4 ff ff       	jmp    8010992f <alltraps>
+
+8010a44e <vector127>:
+.globl vector127
+vector127:
+  pushl $0
+8010a44e:	6a 00                	push   $0x0
+  pushl $127
+8010a450:	6a 7f                	push   $0x7f
+  jmp alltraps
+8010a452:	e9 d8 f4 ff ff       	jmp    8010992f <alltraps>
+
+8010a457 <vector128>:
+.globl vector128
+vector128:
+  pushl $0
+8010a457:	6a 00                	push   $0x0
+  pushl $128
+8010a459:	68 80 00 00 00       	push   $0x80
+  jmp alltraps
+8010a45e:	e9 cc f4 ff ff       	jmp    8010992f <alltraps>
+
+8010a463 <vector129>:
+.globl vector129
+vector129:
+  pushl $0
+8010a463:	6a 00                	push   $0x0
+  pushl $129
+8010a465:	68 81 00 00 00       	push   $0x81
+  jmp alltraps
+8010a46a:	e9 c0 f4 ff ff       	jmp    8010992f <alltraps>
+
+8010a46f <vector130>:
+.globl vector130
+vector130:
+  pushl $0
+8010a46f:	6a 00                	push   $0x0
+  pushl $130
+8010a471:	68 82 00 00 00       	push   $0x82
+  jmp alltraps
+8010a476:	e9 b4 f4 ff ff       	jmp    8010992f <alltraps>
+
+8010a47b <vector131>:
+.globl vector131
+vector131:
+  pushl $0
+8010a47b:	6a 00                	push   $0x0
+  pushl $131
+8010a47d:	68 83 00 00 00       	push   $0x83
+  jmp alltraps
+8010a482:	e9 a8 f4 ff ff       	jmp    8010992f <alltraps>
+
+8010a487 <vector132>:
+.globl vector132
+vector132:
+  pushl $0
+8010a487:	6a 00                	push   $0x0
+  pushl $132
+8010a489:	68 84 00 00 00       	push   $0x84
+  jmp alltraps
+8010a48e:	e9 9c f4 ff ff       	jmp    8010992f <alltraps>
+
+8010a493 <vector133>:
+.globl vector133
+vector133:
+  pushl $0
+8010a493:	6a 00                	push   $0x0
+  pushl $133
+8010a495:	68 85 00 00 00       	push   $0x85
+  jmp alltraps
+8010a49a:	e9 90 f4 ff ff       	jmp    8010992f <alltraps>
+
+8010a49f <vector134>:
+.globl vector134
+vector134:
+  pushl $0
+8010a49f:	6a 00                	push   $0x0
+  pushl $134
+8010a4a1:	68 86 00 00 00       	push   $0x86
+  jmp alltraps
+8010a4a6:	e9 84 f4 ff ff       	jmp    8010992f <alltraps>
+
+8010a4ab <vector135>:
+.globl vector135
+vector135:
+  pushl $0
+8010a4ab:	6a 00                	push   $0x0
+  pushl $135
+8010a4ad:	68 87 00 00 00       	push   $0x87
+  jmp alltraps
+8010a4b2:	e9 78 f4 ff ff       	jmp    8010992f <alltraps>
+
+8010a4b7 <vector136>:
+.globl vector136
+vector136:
+  pushl $0
+8010a4b7:	6a 00                	push   $0x0
+  pushl $136
+8010a4b9:	68 88 00 00 00       	push   $0x88
+  jmp alltraps
+8010a4be:	e9 6c f4 ff ff       	jmp    8010992f <alltraps>
+
+8010a4c3 <vector137>:
+.globl vector137
+vector137:
+  pushl $0
+8010a4c3:	6a 00                	push   $0x0
+  pushl $137
+8010a4c5:	68 89 00 00 00       	push   $0x89
+  jmp alltraps
+8010a4ca:	e9 60 f4 ff ff       	jmp    8010992f <alltraps>
+
+8010a4cf <vector138>:
+.globl vector138
+vector138:
+  pushl $0
+8010a4cf:	6a 00                	push   $0x0
+  pushl $138
+8010a4d1:	68 8a 00 00 00       	push   $0x8a
+  jmp alltraps
+8010a4d6:	e9 54 f4 ff ff       	jmp    8010992f <alltraps>
+
+8010a4db <vector139>:
+.globl vector139
+vector139:
+  pushl $0
+8010a4db:	6a 00                	push   $0x0
+  pushl $139
+8010a4dd:	68 8b 00 00 00       	push   $0x8b
+  jmp alltraps
+8010a4e2:	e9 48 f4 ff ff       	jmp    8010992f <alltraps>
+
+8010a4e7 <vector140>:
+.globl vector140
+vector140:
+  pushl $0
+8010a4e7:	6a 00                	push   $0x0
+  pushl $140
+8010a4e9:	68 8c 00 00 00       	push   $0x8c
+  jmp alltraps
+8010a4ee:	e9 3c f4 ff ff       	jmp    8010992f <alltraps>
+
+8010a4f3 <vector141>:
+.globl vector141
+vector141:
+  pushl $0
+8010a4f3:	6a 00                	push   $0x0
+  pushl $141
+8010a4f5:	68 8d 00 00 00       	push   $0x8d
+  jmp alltraps
+8010a4fa:	e9 30 f4 ff ff       	jmp    8010992f <alltraps>
+
+8010a4ff <vector142>:
+.globl vector142
+vector142:
+  pushl $0
+8010a4ff:	6a 00                	push   $0x0
+  pushl $142
+8010a501:	68 8e 00 00 00       	push   $0x8e
+  jmp alltraps
+8010a506:	e9 24 f4 ff ff       	jmp    8010992f <alltraps>
+
+8010a50b <vector143>:
+.globl vector143
+vector143:
+  pushl $0
+8010a50b:	6a 00                	push   $0x0
+  pushl $143
+8010a50d:	68 8f 00 00 00       	push   $0x8f
+  jmp alltraps
+8010a512:	e9 18 f4 ff ff       	jmp    8010992f <alltraps>
+
+8010a517 <vector144>:
+.globl vector144
+vector144:
+  pushl $0
+8010a517:	6a 00                	push   $0x0
+  pushl $144
+8010a519:	68 90 00 00 00       	push   $0x90
+  jmp alltraps
+8010a51e:	e9 0c f4 ff ff       	jmp    8010992f <alltraps>
+
+8010a523 <vector145>:
+.globl vector145
+vector145:
+  pushl $0
+8010a523:	6a 00                	push   $0x0
+  pushl $145
+8010a525:	68 91 00 00 00       	push   $0x91
+  jmp alltraps
+8010a52a:	e9 00 f4 ff ff       	jmp    8010992f <alltraps>
+
+8010a52f <vector146>:
+.globl vector146
+vector146:
+  pushl $0
+8010a52f:	6a 00                	push   $0x0
+  pushl $146
+8010a531:	68 92 00 00 00       	push   $0x92
+  jmp alltraps
+8010a536:	e9 f4 f3 ff ff       	jmp    8010992f <alltraps>
+
+8010a53b <vector147>:
+.globl vector147
+vector147:
+  pushl $0
+8010a53b:	6a 00                	push   $0x0
+  pushl $147
+8010a53d:	68 93 00 00 00       	push   $0x93
+  jmp alltraps
+8010a542:	e9 e8 f3 ff ff       	jmp    8010992f <alltraps>
+
+8010a547 <vector148>:
+.globl vector148
+vector148:
+  pushl $0
+8010a547:	6a 00                	push   $0x0
+  pushl $148
+8010a549:	68 94 00 00 00       	push   $0x94
+  jmp alltraps
+8010a54e:	e9 dc f3 ff ff       	jmp    8010992f <alltraps>
+
+8010a553 <vector149>:
+.globl vector149
+vector149:
+  pushl $0
+8010a553:	6a 00                	push   $0x0
+  pushl $149
+8010a555:	68 95 00 00 00       	push   $0x95
+  jmp alltraps
+8010a55a:	e9 d0 f3 ff ff       	jmp    8010992f <alltraps>
+
+8010a55f <vector150>:
+.globl vector150
+vector150:
+  pushl $0
+8010a55f:	6a 00                	push   $0x0
+  pushl $150
+8010a561:	68 96 00 00 00       	push   $0x96
+  jmp alltraps
+8010a566:	e9 c4 f3 ff ff       	jmp    8010992f <alltraps>
+
+8010a56b <vector151>:
+.globl vector151
+vector151:
+  pushl $0
+8010a56b:	6a 00                	push   $0x0
+  pushl $151
+8010a56d:	68 97 00 00 00       	push   $0x97
+  jmp alltraps
+8010a572:	e9 b8 f3 ff ff       	jmp    8010992f <alltraps>
+
+8010a577 <vector152>:
+.globl vector152
+vector152:
+  pushl $0
+8010a577:	6a 00                	push   $0x0
+  pushl $152
+8010a579:	68 98 00 00 00       	push   $0x98
+  jmp alltraps
+8010a57e:	e9 ac f3 ff ff       	jmp    8010992f <alltraps>
+
+8010a583 <vector153>:
+.globl vector153
+vector153:
+  pushl $0
+8010a583:	6a 00                	push   $0x0
+  pushl $153
+8010a585:	68 99 00 00 00       	push   $0x99
+  jmp alltraps
+8010a58a:	e9 a0 f3 ff ff       	jmp    8010992f <alltraps>
+
+8010a58f <vector154>:
+.globl vector154
+vector154:
+  pushl $0
+8010a58f:	6a 00                	push   $0x0
+  pushl $154
+8010a591:	68 9a 00 00 00       	push   $0x9a
+  jmp alltraps
+8010a596:	e9 94 f3 ff ff       	jmp    8010992f <alltraps>
+
+8010a59b <vector155>:
+.globl vector155
+vector155:
+  pushl $0
+8010a59b:	6a 00                	push   $0x0
+  pushl $155
+8010a59d:	68 9b 00 00 00       	push   $0x9b
+  jmp alltraps
+8010a5a2:	e9 88 f3 ff ff       	jmp    8010992f <alltraps>
+
+8010a5a7 <vector156>:
+.globl vector156
+vector156:
+  pushl $0
+8010a5a7:	6a 00                	push   $0x0
+  pushl $156
+8010a5a9:	68 9c 00 00 00       	push   $0x9c
+  jmp alltraps
+8010a5ae:	e9 7c f3 ff ff       	jmp    8010992f <alltraps>
+
+8010a5b3 <vector157>:
+.globl vector157
+vector157:
+  pushl $0
+8010a5b3:	6a 00                	push   $0x0
+  pushl $157
+8010a5b5:	68 9d 00 00 00       	push   $0x9d
+  jmp alltraps
+8010a5ba:	e9 70 f3 ff ff       	jmp    8010992f <alltraps>
+
+8010a5bf <vector158>:
+.globl vector158
+vector158:
+  pushl $0
+8010a5bf:	6a 00                	push   $0x0
+  pushl $158
+8010a5c1:	68 9e 00 00 00       	push   $0x9e
+  jmp alltraps
+8010a5c6:	e9 64 f3 ff ff       	jmp    8010992f <alltraps>
+
+8010a5cb <vector159>:
+.globl vector159
+vector159:
+  pushl $0
+8010a5cb:	6a 00                	push   $0x0
+  pushl $159
+8010a5cd:	68 9f 00 00 00       	push   $0x9f
+  jmp alltraps
+8010a5d2:	e9 58 f3 ff ff       	jmp    8010992f <alltraps>
+
+8010a5d7 <vector160>:
+.globl vector160
+vector160:
+  pushl $0
+8010a5d7:	6a 00                	push   $0x0
+  pushl $160
+8010a5d9:	68 a0 00 00 00       	push   $0xa0
+  jmp alltraps
+8010a5de:	e9 4c f3 ff ff       	jmp    8010992f <alltraps>
+
+8010a5e3 <vector161>:
+.globl vector161
+vector161:
+  pushl $0
+8010a5e3:	6a 00                	push   $0x0
+  pushl $161
+8010a5e5:	68 a1 00 00 00       	push   $0xa1
+  jmp alltraps
+8010a5ea:	e9 40 f3 ff ff       	jmp    8010992f <alltraps>
+
+8010a5ef <vector162>:
+.globl vector162
+vector162:
+  pushl $0
+8010a5ef:	6a 00                	push   $0x0
+  pushl $162
+8010a5f1:	68 a2 00 00 00       	push   $0xa2
+  jmp alltraps
+8010a5f6:	e9 34 f3 ff ff       	jmp    8010992f <alltraps>
+
+8010a5fb <vector163>:
+.globl vector163
+vector163:
+  pushl $0
+8010a5fb:	6a 00                	push   $0x0
+  pushl $163
+8010a5fd:	68 a3 00 00 00       	push   $0xa3
+  jmp alltraps
+8010a602:	e9 28 f3 ff ff       	jmp    8010992f <alltraps>
+
+8010a607 <vector164>:
+.globl vector164
+vector164:
+  pushl $0
+8010a607:	6a 00                	push   $0x0
+  pushl $164
+8010a609:	68 a4 00 00 00       	push   $0xa4
+  jmp alltraps
+8010a60e:	e9 1c f3 ff ff       	jmp    8010992f <alltraps>
+
+8010a613 <vector165>:
+.globl vector165
+vector165:
+  pushl $0
+8010a613:	6a 00                	push   $0x0
+  pushl $165
+8010a615:	68 a5 00 00 00       	push   $0xa5
+  jmp alltraps
+8010a61a:	e9 10 f3 ff ff       	jmp    8010992f <alltraps>
+
+8010a61f <vector166>:
+.globl vector166
+vector166:
+  pushl $0
+8010a61f:	6a 00                	push   $0x0
+  pushl $166
+8010a621:	68 a6 00 00 00       	push   $0xa6
+  jmp alltraps
+8010a626:	e9 04 f3 ff ff       	jmp    8010992f <alltraps>
+
+8010a62b <vector167>:
+.globl vector167
+vector167:
+  pushl $0
+8010a62b:	6a 00                	push   $0x0
+  pushl $167
+8010a62d:	68 a7 00 00 00       	push   $0xa7
+  jmp alltraps
+8010a632:	e9 f8 f2 ff ff       	jmp    8010992f <alltraps>
+
+8010a637 <vector168>:
+.globl vector168
+vector168:
+  pushl $0
+8010a637:	6a 00                	push   $0x0
+  pushl $168
+8010a639:	68 a8 00 00 00       	push   $0xa8
+  jmp alltraps
+8010a63e:	e9 ec f2 ff ff       	jmp    8010992f <alltraps>
+
+8010a643 <vector169>:
+.globl vector169
+vector169:
+  pushl $0
+8010a643:	6a 00                	push   $0x0
+  pushl $169
+8010a645:	68 a9 00 00 00       	push   $0xa9
+  jmp alltraps
+8010a64a:	e9 e0 f2 ff ff       	jmp    8010992f <alltraps>
+
+8010a64f <vector170>:
+.globl vector170
+vector170:
+  pushl $0
+8010a64f:	6a 00                	push   $0x0
+  pushl $170
+8010a651:	68 aa 00 00 00       	push   $0xaa
+  jmp alltraps
+8010a656:	e9 d4 f2 ff ff       	jmp    8010992f <alltraps>
+
+8010a65b <vector171>:
+.globl vector171
+vector171:
+  pushl $0
+8010a65b:	6a 00                	push   $0x0
+  pushl $171
+8010a65d:	68 ab 00 00 00       	push   $0xab
+  jmp alltraps
+8010a662:	e9 c8 f2 ff ff       	jmp    8010992f <alltraps>
+
+8010a667 <vector172>:
+.globl vector172
+vector172:
+  pushl $0
+8010a667:	6a 00                	push   $0x0
+  pushl $172
+8010a669:	68 ac 00 00 00       	push   $0xac
+  jmp alltraps
+8010a66e:	e9 bc f2 ff ff       	jmp    8010992f <alltraps>
+
+8010a673 <vector173>:
+.globl vector173
+vector173:
+  pushl $0
+8010a673:	6a 00                	push   $0x0
+  pushl $173
+8010a675:	68 ad 00 00 00       	push   $0xad
+  jmp alltraps
+8010a67a:	e9 b0 f2 ff ff       	jmp    8010992f <alltraps>
+
+8010a67f <vector174>:
+.globl vector174
+vector174:
+  pushl $0
+8010a67f:	6a 00                	push   $0x0
+  pushl $174
+8010a681:	68 ae 00 00 00       	push   $0xae
+  jmp alltraps
+8010a686:	e9 a4 f2 ff ff       	jmp    8010992f <alltraps>
+
+8010a68b <vector175>:
+.globl vector175
+vector175:
+  pushl $0
+8010a68b:	6a 00                	push   $0x0
+  pushl $175
+8010a68d:	68 af 00 00 00       	push   $0xaf
+  jmp alltraps
+8010a692:	e9 98 f2 ff ff       	jmp    8010992f <alltraps>
+
+8010a697 <vector176>:
+.globl vector176
+vector176:
+  pushl $0
+8010a697:	6a 00                	push   $0x0
+  pushl $176
+8010a699:	68 b0 00 00 00       	push   $0xb0
+  jmp alltraps
+8010a69e:	e9 8c f2 ff ff       	jmp    8010992f <alltraps>
+
+8010a6a3 <vector177>:
+.globl vector177
+vector177:
+  pushl $0
+8010a6a3:	6a 00                	push   $0x0
+  pushl $177
+8010a6a5:	68 b1 00 00 00       	push   $0xb1
+  jmp alltraps
+8010a6aa:	e9 80 f2 ff ff       	jmp    8010992f <alltraps>
+
+8010a6af <vector178>:
+.globl vector178
+vector178:
+  pushl $0
+8010a6af:	6a 00                	push   $0x0
+  pushl $178
+8010a6b1:	68 b2 00 00 00       	push   $0xb2
+  jmp alltraps
+8010a6b6:	e9 74 f2 ff ff       	jmp    8010992f <alltraps>
+
+8010a6bb <vector179>:
+.globl vector179
+vector179:
+  pushl $0
+8010a6bb:	6a 00                	push   $0x0
+  pushl $179
+8010a6bd:	68 b3 00 00 00       	push   $0xb3
+  jmp alltraps
+8010a6c2:	e9 68 f2 ff ff       	jmp    8010992f <alltraps>
+
+8010a6c7 <vector180>:
+.globl vector180
+vector180:
+  pushl $0
+8010a6c7:	6a 00                	push   $0x0
+  pushl $180
+8010a6c9:	68 b4 00 00 00       	push   $0xb4
+  jmp alltraps
+8010a6ce:	e9 5c f2 ff ff       	jmp    8010992f <alltraps>
+
+8010a6d3 <vector181>:
+.globl vector181
+vector181:
+  pushl $0
+8010a6d3:	6a 00                	push   $0x0
+  pushl $181
+8010a6d5:	68 b5 00 00 00       	push   $0xb5
+  jmp alltraps
+8010a6da:	e9 50 f2 ff ff       	jmp    8010992f <alltraps>
+
+8010a6df <vector182>:
+.globl vector182
+vector182:
+  pushl $0
+8010a6df:	6a 00                	push   $0x0
+  pushl $182
+8010a6e1:	68 b6 00 00 00       	push   $0xb6
+  jmp alltraps
+8010a6e6:	e9 44 f2 ff ff       	jmp    8010992f <alltraps>
+
+8010a6eb <vector183>:
+.globl vector183
+vector183:
+  pushl $0
+8010a6eb:	6a 00                	push   $0x0
+  pushl $183
+8010a6ed:	68 b7 00 00 00       	push   $0xb7
+  jmp alltraps
+8010a6f2:	e9 38 f2 ff ff       	jmp    8010992f <alltraps>
+
+8010a6f7 <vector184>:
+.globl vector184
+vector184:
+  pushl $0
+8010a6f7:	6a 00                	push   $0x0
+  pushl $184
+8010a6f9:	68 b8 00 00 00       	push   $0xb8
+  jmp alltraps
+8010a6fe:	e9 2c f2 ff ff       	jmp    8010992f <alltraps>
+
+8010a703 <vector185>:
+.globl vector185
+vector185:
+  pushl $0
+8010a703:	6a 00                	push   $0x0
+  pushl $185
+8010a705:	68 b9 00 00 00       	push   $0xb9
+  jmp alltraps
+8010a70a:	e9 20 f2 ff ff       	jmp    8010992f <alltraps>
+
+8010a70f <vector186>:
+.globl vector186
+vector186:
+  pushl $0
+8010a70f:	6a 00                	push   $0x0
+  pushl $186
+8010a711:	68 ba 00 00 00       	push   $0xba
+  jmp alltraps
+8010a716:	e9 14 f2 ff ff       	jmp    8010992f <alltraps>
+
+8010a71b <vector187>:
+.globl vector187
+vector187:
+  pushl $0
+8010a71b:	6a 00                	push   $0x0
+  pushl $187
+8010a71d:	68 bb 00 00 00       	push   $0xbb
+  jmp alltraps
+8010a722:	e9 08 f2 ff ff       	jmp    8010992f <alltraps>
+
+8010a727 <vector188>:
+.globl vector188
+vector188:
+  pushl $0
+8010a727:	6a 00                	push   $0x0
+  pushl $188
+8010a729:	68 bc 00 00 00       	push   $0xbc
+  jmp alltraps
+8010a72e:	e9 fc f1 ff ff       	jmp    8010992f <alltraps>
+
+8010a733 <vector189>:
+.globl vector189
+vector189:
+  pushl $0
+8010a733:	6a 00                	push   $0x0
+  pushl $189
+8010a735:	68 bd 00 00 00       	push   $0xbd
+  jmp alltraps
+8010a73a:	e9 f0 f1 ff ff       	jmp    8010992f <alltraps>
+
+8010a73f <vector190>:
+.globl vector190
+vector190:
+  pushl $0
+8010a73f:	6a 00                	push   $0x0
+  pushl $190
+8010a741:	68 be 00 00 00       	push   $0xbe
+  jmp alltraps
+8010a746:	e9 e4 f1 ff ff       	jmp    8010992f <alltraps>
+
+8010a74b <vector191>:
+.globl vector191
+vector191:
+  pushl $0
+8010a74b:	6a 00                	push   $0x0
+  pushl $191
+8010a74d:	68 bf 00 00 00       	push   $0xbf
+  jmp alltraps
+8010a752:	e9 d8 f1 ff ff       	jmp    8010992f <alltraps>
+
+8010a757 <vector192>:
+.globl vector192
+vector192:
+  pushl $0
+8010a757:	6a 00                	push   $0x0
+  pushl $192
+8010a759:	68 c0 00 00 00       	push   $0xc0
+  jmp alltraps
+8010a75e:	e9 cc f1 ff ff       	jmp    8010992f <alltraps>
+
+8010a763 <vector193>:
+.globl vector193
+vector193:
+  pushl $0
+8010a763:	6a 00                	push   $0x0
+  pushl $193
+8010a765:	68 c1 00 00 00       	push   $0xc1
+  jmp alltraps
+8010a76a:	e9 c0 f1 ff ff       	jmp    8010992f <alltraps>
+
+8010a76f <vector194>:
+.globl vector194
+vector194:
+  pushl $0
+8010a76f:	6a 00                	push   $0x0
+  pushl $194
+8010a771:	68 c2 00 00 00       	push   $0xc2
+  jmp alltraps
+8010a776:	e9 b4 f1 ff ff       	jmp    8010992f <alltraps>
+
+8010a77b <vector195>:
+.globl vector195
+vector195:
+  pushl $0
+8010a77b:	6a 00                	push   $0x0
+  pushl $195
+8010a77d:	68 c3 00 00 00       	push   $0xc3
+  jmp alltraps
+8010a782:	e9 a8 f1 ff ff       	jmp    8010992f <alltraps>
+
+8010a787 <vector196>:
+.globl vector196
+vector196:
+  pushl $0
+8010a787:	6a 00                	push   $0x0
+  pushl $196
+8010a789:	68 c4 00 00 00       	push   $0xc4
+  jmp alltraps
+8010a78e:	e9 9c f1 ff ff       	jmp    8010992f <alltraps>
+
+8010a793 <vector197>:
+.globl vector197
+vector197:
+  pushl $0
+8010a793:	6a 00                	push   $0x0
+  pushl $197
+8010a795:	68 c5 00 00 00       	push   $0xc5
+  jmp alltraps
+8010a79a:	e9 90 f1 ff ff       	jmp    8010992f <alltraps>
+
+8010a79f <vector198>:
+.globl vector198
+vector198:
+  pushl $0
+8010a79f:	6a 00                	push   $0x0
+  pushl $198
+8010a7a1:	68 c6 00 00 00       	push   $0xc6
+  jmp alltraps
+8010a7a6:	e9 84 f1 ff ff       	jmp    8010992f <alltraps>
+
+8010a7ab <vector199>:
+.globl vector199
+vector199:
+  pushl $0
+8010a7ab:	6a 00                	push   $0x0
+  pushl $199
+8010a7ad:	68 c7 00 00 00       	push   $0xc7
+  jmp alltraps
+8010a7b2:	e9 78 f1 ff ff       	jmp    8010992f <alltraps>
+
+8010a7b7 <vector200>:
+.globl vector200
+vector200:
+  pushl $0
+8010a7b7:	6a 00                	push   $0x0
+  pushl $200
+8010a7b9:	68 c8 00 00 00       	push   $0xc8
+  jmp alltraps
+8010a7be:	e9 6c f1 ff ff       	jmp    8010992f <alltraps>
+
+8010a7c3 <vector201>:
+.globl vector201
+vector201:
+  pushl $0
+8010a7c3:	6a 00                	push   $0x0
+  pushl $201
+8010a7c5:	68 c9 00 00 00       	push   $0xc9
+  jmp alltraps
+8010a7ca:	e9 60 f1 ff ff       	jmp    8010992f <alltraps>
+
+8010a7cf <vector202>:
+.globl vector202
+vector202:
+  pushl $0
+8010a7cf:	6a 00                	push   $0x0
+  pushl $202
+8010a7d1:	68 ca 00 00 00       	push   $0xca
+  jmp alltraps
+8010a7d6:	e9 54 f1 ff ff       	jmp    8010992f <alltraps>
+
+8010a7db <vector203>:
+.globl vector203
+vector203:
+  pushl $0
+8010a7db:	6a 00                	push   $0x0
+  pushl $203
+8010a7dd:	68 cb 00 00 00       	push   $0xcb
+  jmp alltraps
+8010a7e2:	e9 48 f1 ff ff       	jmp    8010992f <alltraps>
+
+8010a7e7 <vector204>:
+.globl vector204
+vector204:
+  pushl $0
+8010a7e7:	6a 00                	push   $0x0
+  pushl $204
+8010a7e9:	68 cc 00 00 00       	push   $0xcc
+  jmp alltraps
+8010a7ee:	e9 3c f1 ff ff       	jmp    8010992f <alltraps>
+
+8010a7f3 <vector205>:
+.globl vector205
+vector205:
+  pushl $0
+8010a7f3:	6a 00                	push   $0x0
+  pushl $205
+8010a7f5:	68 cd 00 00 00       	push   $0xcd
+  jmp alltraps
+8010a7fa:	e9 30 f1 ff ff       	jmp    8010992f <alltraps>
+
+8010a7ff <vector206>:
+.globl vector206
+vector206:
+  pushl $0
+8010a7ff:	6a 00                	push   $0x0
+  pushl $206
+8010a801:	68 ce 00 00 00       	push   $0xce
+  jmp alltraps
+8010a806:	e9 24 f1 ff ff       	jmp    8010992f <alltraps>
+
+8010a80b <vector207>:
+.globl vector207
+vector207:
+  pushl $0
+8010a80b:	6a 00                	push   $0x0
+  pushl $207
+8010a80d:	68 cf 00 00 00       	push   $0xcf
+  jmp alltraps
+8010a812:	e9 18 f1 ff ff       	jmp    8010992f <alltraps>
+
+8010a817 <vector208>:
+.globl vector208
+vector208:
+  pushl $0
+8010a817:	6a 00                	push   $0x0
+  pushl $208
+8010a819:	68 d0 00 00 00       	push   $0xd0
+  jmp alltraps
+8010a81e:	e9 0c f1 ff ff       	jmp    8010992f <alltraps>
+
+8010a823 <vector209>:
+.globl vector209
+vector209:
+  pushl $0
+8010a823:	6a 00                	push   $0x0
+  pushl $209
+8010a825:	68 d1 00 00 00       	push   $0xd1
+  jmp alltraps
+8010a82a:	e9 00 f1 ff ff       	jmp    8010992f <alltraps>
+
+8010a82f <vector210>:
+.globl vector210
+vector210:
+  pushl $0
+8010a82f:	6a 00                	push   $0x0
+  pushl $210
+8010a831:	68 d2 00 00 00       	push   $0xd2
+  jmp alltraps
+8010a836:	e9 f4 f0 ff ff       	jmp    8010992f <alltraps>
+
+8010a83b <vector211>:
+.globl vector211
+vector211:
+  pushl $0
+8010a83b:	6a 00                	push   $0x0
+  pushl $211
+8010a83d:	68 d3 00 00 00       	push   $0xd3
+  jmp alltraps
+8010a842:	e9 e8 f0 ff ff       	jmp    8010992f <alltraps>
+
+8010a847 <vector212>:
+.globl vector212
+vector212:
+  pushl $0
+8010a847:	6a 00                	push   $0x0
+  pushl $212
+8010a849:	68 d4 00 00 00       	push   $0xd4
+  jmp alltraps
+8010a84e:	e9 dc f0 ff ff       	jmp    8010992f <alltraps>
+
+8010a853 <vector213>:
+.globl vector213
+vector213:
+  pushl $0
+8010a853:	6a 00                	push   $0x0
+  pushl $213
+8010a855:	68 d5 00 00 00       	push   $0xd5
+  jmp alltraps
+8010a85a:	e9 d0 f0 ff ff       	jmp    8010992f <alltraps>
+
+8010a85f <vector214>:
+.globl vector214
+vector214:
+  pushl $0
+8010a85f:	6a 00                	push   $0x0
+  pushl $214
+8010a861:	68 d6 00 00 00       	push   $0xd6
+  jmp alltraps
+8010a866:	e9 c4 f0 ff ff       	jmp    8010992f <alltraps>
+
+8010a86b <vector215>:
+.globl vector215
+vector215:
+  pushl $0
+8010a86b:	6a 00                	push   $0x0
+  pushl $215
+8010a86d:	68 d7 00 00 00       	push   $0xd7
+  jmp alltraps
+8010a872:	e9 b8 f0 ff ff       	jmp    8010992f <alltraps>
+
+8010a877 <vector216>:
+.globl vector216
+vector216:
+  pushl $0
+8010a877:	6a 00                	push   $0x0
+  pushl $216
+8010a879:	68 d8 00 00 00       	push   $0xd8
+  jmp alltraps
+8010a87e:	e9 ac f0 ff ff       	jmp    8010992f <alltraps>
+
+8010a883 <vector217>:
+.globl vector217
+vector217:
+  pushl $0
+8010a883:	6a 00                	push   $0x0
+  pushl $217
+8010a885:	68 d9 00 00 00       	push   $0xd9
+  jmp alltraps
+8010a88a:	e9 a0 f0 ff ff       	jmp    8010992f <alltraps>
+
+8010a88f <vector218>:
+.globl vector218
+vector218:
+  pushl $0
+8010a88f:	6a 00                	push   $0x0
+  pushl $218
+8010a891:	68 da 00 00 00       	push   $0xda
+  jmp alltraps
+8010a896:	e9 94 f0 ff ff       	jmp    8010992f <alltraps>
+
+8010a89b <vector219>:
+.globl vector219
+vector219:
+  pushl $0
+8010a89b:	6a 00                	push   $0x0
+  pushl $219
+8010a89d:	68 db 00 00 00       	push   $0xdb
+  jmp alltraps
+8010a8a2:	e9 88 f0 ff ff       	jmp    8010992f <alltraps>
+
+8010a8a7 <vector220>:
+.globl vector220
+vector220:
+  pushl $0
+8010a8a7:	6a 00                	push   $0x0
+  pushl $220
+8010a8a9:	68 dc 00 00 00       	push   $0xdc
+  jmp alltraps
+8010a8ae:	e9 7c f0 ff ff       	jmp    8010992f <alltraps>
+
+8010a8b3 <vector221>:
+.globl vector221
+vector221:
+  pushl $0
+8010a8b3:	6a 00                	push   $0x0
+  pushl $221
+8010a8b5:	68 dd 00 00 00       	push   $0xdd
+  jmp alltraps
+8010a8ba:	e9 70 f0 ff ff       	jmp    8010992f <alltraps>
+
+8010a8bf <vector222>:
+.globl vector222
+vector222:
+  pushl $0
+8010a8bf:	6a 00                	push   $0x0
+  pushl $222
+8010a8c1:	68 de 00 00 00       	push   $0xde
+  jmp alltraps
+8010a8c6:	e9 64 f0 ff ff       	jmp    8010992f <alltraps>
+
+8010a8cb <vector223>:
+.globl vector223
+vector223:
+  pushl $0
+8010a8cb:	6a 00                	push   $0x0
+  pushl $223
+8010a8cd:	68 df 00 00 00       	push   $0xdf
+  jmp alltraps
+8010a8d2:	e9 58 f0 ff ff       	jmp    8010992f <alltraps>
+
+8010a8d7 <vector224>:
+.globl vector224
+vector224:
+  pushl $0
+8010a8d7:	6a 00                	push   $0x0
+  pushl $224
+8010a8d9:	68 e0 00 00 00       	push   $0xe0
+  jmp alltraps
+8010a8de:	e9 4c f0 ff ff       	jmp    8010992f <alltraps>
+
+8010a8e3 <vector225>:
+.globl vector225
+vector225:
+  pushl $0
+8010a8e3:	6a 00                	push   $0x0
+  pushl $225
+8010a8e5:	68 e1 00 00 00       	push   $0xe1
+  jmp alltraps
+8010a8ea:	e9 40 f0 ff ff       	jmp    8010992f <alltraps>
+
+8010a8ef <vector226>:
+.globl vector226
+vector226:
+  pushl $0
+8010a8ef:	6a 00                	push   $0x0
+  pushl $226
+8010a8f1:	68 e2 00 00 00       	push   $0xe2
+  jmp alltraps
+8010a8f6:	e9 34 f0 ff ff       	jmp    8010992f <alltraps>
+
+8010a8fb <vector227>:
+.globl vector227
+vector227:
+  pushl $0
+8010a8fb:	6a 00                	push   $0x0
+  pushl $227
+8010a8fd:	68 e3 00 00 00       	push   $0xe3
+  jmp alltraps
+8010a902:	e9 28 f0 ff ff       	jmp    8010992f <alltraps>
+
+8010a907 <vector228>:
+.globl vector228
+vector228:
+  pushl $0
+8010a907:	6a 00                	push   $0x0
+  pushl $228
+8010a909:	68 e4 00 00 00       	push   $0xe4
+  jmp alltraps
+8010a90e:	e9 1c f0 ff ff       	jmp    8010992f <alltraps>
+
+8010a913 <vector229>:
+.globl vector229
+vector229:
+  pushl $0
+8010a913:	6a 00                	push   $0x0
+  pushl $229
+8010a915:	68 e5 00 00 00       	push   $0xe5
+  jmp alltraps
+8010a91a:	e9 10 f0 ff ff       	jmp    8010992f <alltraps>
+
+8010a91f <vector230>:
+.globl vector230
+vector230:
+  pushl $0
+8010a91f:	6a 00                	push   $0x0
+  pushl $230
+8010a921:	68 e6 00 00 00       	push   $0xe6
+  jmp alltraps
+8010a926:	e9 04 f0 ff ff       	jmp    8010992f <alltraps>
+
+8010a92b <vector231>:
+.globl vector231
+vector231:
+  pushl $0
+8010a92b:	6a 00                	push   $0x0
+  pushl $231
+8010a92d:	68 e7 00 00 00       	push   $0xe7
+  jmp alltraps
+8010a932:	e9 f8 ef ff ff       	jmp    8010992f <alltraps>
+
+8010a937 <vector232>:
+.globl vector232
+vector232:
+  pushl $0
+8010a937:	6a 00                	push   $0x0
+  pushl $232
+8010a939:	68 e8 00 00 00       	push   $0xe8
+  jmp alltraps
+8010a93e:	e9 ec ef ff ff       	jmp    8010992f <alltraps>
+
+8010a943 <vector233>:
+.globl vector233
+vector233:
+  pushl $0
+8010a943:	6a 00                	push   $0x0
+  pushl $233
+8010a945:	68 e9 00 00 00       	push   $0xe9
+  jmp alltraps
+8010a94a:	e9 e0 ef ff ff       	jmp    8010992f <alltraps>
+
+8010a94f <vector234>:
+.globl vector234
+vector234:
+  pushl $0
+8010a94f:	6a 00                	push   $0x0
+  pushl $234
+8010a951:	68 ea 00 00 00       	push   $0xea
+  jmp alltraps
+8010a956:	e9 d4 ef ff ff       	jmp    8010992f <alltraps>
+
+8010a95b <vector235>:
+.globl vector235
+vector235:
+  pushl $0
+8010a95b:	6a 00                	push   $0x0
+  pushl $235
+8010a95d:	68 eb 00 00 00       	push   $0xeb
+  jmp alltraps
+8010a962:	e9 c8 ef ff ff       	jmp    8010992f <alltraps>
+
+8010a967 <vector236>:
+.globl vector236
+vector236:
+  pushl $0
+8010a967:	6a 00                	push   $0x0
+  pushl $236
+8010a969:	68 ec 00 00 00       	push   $0xec
+  jmp alltraps
+8010a96e:	e9 bc ef ff ff       	jmp    8010992f <alltraps>
+
+8010a973 <vector237>:
+.globl vector237
+vector237:
+  pushl $0
+8010a973:	6a 00                	push   $0x0
+  pushl $237
+8010a975:	68 ed 00 00 00       	push   $0xed
+  jmp alltraps
+8010a97a:	e9 b0 ef ff ff       	jmp    8010992f <alltraps>
+
+8010a97f <vector238>:
+.globl vector238
+vector238:
+  pushl $0
+8010a97f:	6a 00                	push   $0x0
+  pushl $238
+8010a981:	68 ee 00 00 00       	push   $0xee
+  jmp alltraps
+8010a986:	e9 a4 ef ff ff       	jmp    8010992f <alltraps>
+
+8010a98b <vector239>:
+.globl vector239
+vector239:
+  pushl $0
+8010a98b:	6a 00                	push   $0x0
+  pushl $239
+8010a98d:	68 ef 00 00 00       	push   $0xef
+  jmp alltraps
+8010a992:	e9 98 ef ff ff       	jmp    8010992f <alltraps>
+
+8010a997 <vector240>:
+.globl vector240
+vector240:
+  pushl $0
+8010a997:	6a 00                	push   $0x0
+  pushl $240
+8010a999:	68 f0 00 00 00       	push   $0xf0
+  jmp alltraps
+8010a99e:	e9 8c ef ff ff       	jmp    8010992f <alltraps>
+
+8010a9a3 <vector241>:
+.globl vector241
+vector241:
+  pushl $0
+8010a9a3:	6a 00                	push   $0x0
+  pushl $241
+8010a9a5:	68 f1 00 00 00       	push   $0xf1
+  jmp alltraps
+8010a9aa:	e9 80 ef ff ff       	jmp    8010992f <alltraps>
+
+8010a9af <vector242>:
+.globl vector242
+vector242:
+  pushl $0
+8010a9af:	6a 00                	push   $0x0
+  pushl $242
+8010a9b1:	68 f2 00 00 00       	push   $0xf2
+  jmp alltraps
+8010a9b6:	e9 74 ef ff ff       	jmp    8010992f <alltraps>
+
+8010a9bb <vector243>:
+.globl vector243
+vector243:
+  pushl $0
+8010a9bb:	6a 00                	push   $0x0
+  pushl $243
+8010a9bd:	68 f3 00 00 00       	push   $0xf3
+  jmp alltraps
+8010a9c2:	e9 68 ef ff ff       	jmp    8010992f <alltraps>
+
+8010a9c7 <vector244>:
+.globl vector244
+vector244:
+  pushl $0
+8010a9c7:	6a 00                	push   $0x0
+  pushl $244
+8010a9c9:	68 f4 00 00 00       	push   $0xf4
+  jmp alltraps
+8010a9ce:	e9 5c ef ff ff       	jmp    8010992f <alltraps>
+
+8010a9d3 <vector245>:
+.globl vector245
+vector245:
+  pushl $0
+8010a9d3:	6a 00                	push   $0x0
+  pushl $245
+8010a9d5:	68 f5 00 00 00       	push   $0xf5
+  jmp alltraps
+8010a9da:	e9 50 ef ff ff       	jmp    8010992f <alltraps>
+
+8010a9df <vector246>:
+.globl vector246
+vector246:
+  pushl $0
+8010a9df:	6a 00                	push   $0x0
+  pushl $246
+8010a9e1:	68 f6 00 00 00       	push   $0xf6
+  jmp alltraps
+8010a9e6:	e9 44 ef ff ff       	jmp    8010992f <alltraps>
+
+8010a9eb <vector247>:
+.globl vector247
+vector247:
+  pushl $0
+8010a9eb:	6a 00                	push   $0x0
+  pushl $247
+8010a9ed:	68 f7 00 00 00       	push   $0xf7
+  jmp alltraps
+8010a9f2:	e9 38 ef ff ff       	jmp    8010992f <alltraps>
+
+8010a9f7 <vector248>:
+.globl vector248
+vector248:
+  pushl $0
+8010a9f7:	6a 00                	push   $0x0
+  pushl $248
+8010a9f9:	68 f8 00 00 00       	push   $0xf8
+  jmp alltraps
+8010a9fe:	e9 2c ef ff ff       	jmp    8010992f <alltraps>
+
+8010aa03 <vector249>:
+.globl vector249
+vector249:
+  pushl $0
+8010aa03:	6a 00                	push   $0x0
+  pushl $249
+8010aa05:	68 f9 00 00 00       	push   $0xf9
+  jmp alltraps
+8010aa0a:	e9 20 ef ff ff       	jmp    8010992f <alltraps>
+
+8010aa0f <vector250>:
+.globl vector250
+vector250:
+  pushl $0
+8010aa0f:	6a 00                	push   $0x0
+  pushl $250
+8010aa11:	68 fa 00 00 00       	push   $0xfa
+  jmp alltraps
+8010aa16:	e9 14 ef ff ff       	jmp    8010992f <alltraps>
+
+8010aa1b <vector251>:
+.globl vector251
+vector251:
+  pushl $0
+8010aa1b:	6a 00                	push   $0x0
+  pushl $251
+8010aa1d:	68 fb 00 00 00       	push   $0xfb
+  jmp alltraps
+8010aa22:	e9 08 ef ff ff       	jmp    8010992f <alltraps>
+
+8010aa27 <vector252>:
+.globl vector252
+vector252:
+  pushl $0
+8010aa27:	6a 00                	push   $0x0
+  pushl $252
+8010aa29:	68 fc 00 00 00       	push   $0xfc
+  jmp alltraps
+8010aa2e:	e9 fc ee ff ff       	jmp    8010992f <alltraps>
+
+8010aa33 <vector253>:
+.globl vector253
+vector253:
+  pushl $0
+8010aa33:	6a 00                	push   $0x0
+  pushl $253
+8010aa35:	68 fd 00 00 00       	push   $0xfd
+  jmp alltraps
+8010aa3a:	e9 f0 ee ff ff       	jmp    8010992f <alltraps>
+
+8010aa3f <vector254>:
+.globl vector254
+vector254:
+  pushl $0
+8010aa3f:	6a 00                	push   $0x0
+  pushl $254
+8010aa41:	68 fe 00 00 00       	push   $0xfe
+  jmp alltraps
+8010aa46:	e9 e4 ee ff ff       	jmp    8010992f <alltraps>
+
+8010aa4b <vector255>:
+.globl vector255
+vector255:
+  pushl $0
+8010aa4b:	6a 00                	push   $0x0
+  pushl $255
+8010aa4d:	68 ff 00 00 00       	push   $0xff
+  jmp alltraps
+8010aa52:	e9 d8 ee ff ff       	jmp    8010992f <alltraps>
+8010aa57:	66 90                	xchg   %ax,%ax
+8010aa59:	66 90                	xchg   %ax,%ax
+8010aa5b:	66 90                	xchg   %ax,%ax
+8010aa5d:	66 90                	xchg   %ax,%ax
+8010aa5f:	90                   	nop
+
+8010aa60 <deallocuvm.part.0>:
+// Deallocate user pages to bring the process size from oldsz to
+// newsz.  oldsz and newsz need not be page-aligned, nor does newsz
+// need to be less than oldsz.  oldsz can be larger than the actual
+// process size.  Returns the new process size.
+int
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+8010aa60:	55                   	push   %ebp
+8010aa61:	89 e5                	mov    %esp,%ebp
+8010aa63:	57                   	push   %edi
+8010aa64:	56                   	push   %esi
+8010aa65:	53                   	push   %ebx
+  uint a, pa;
+
+  if(newsz >= oldsz)
+    return oldsz;
+
+  a = PGROUNDUP(newsz);
+8010aa66:	8d 99 ff 0f 00 00    	lea    0xfff(%ecx),%ebx
+8010aa6c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+8010aa72:	83 ec 1c             	sub    $0x1c,%esp
+  for(; a  < oldsz; a += PGSIZE){
+8010aa75:	39 d3                	cmp    %edx,%ebx
+8010aa77:	73 56                	jae    8010aacf <deallocuvm.part.0+0x6f>
+8010aa79:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+8010aa7c:	89 c6                	mov    %eax,%esi
+8010aa7e:	89 d7                	mov    %edx,%edi
+8010aa80:	eb 12                	jmp    8010aa94 <deallocuvm.part.0+0x34>
+8010aa82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(!pte)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+8010aa88:	83 c2 01             	add    $0x1,%edx
+8010aa8b:	89 d3                	mov    %edx,%ebx
+8010aa8d:	c1 e3 16             	shl    $0x16,%ebx
+  for(; a  < oldsz; a += PGSIZE){
+8010aa90:	39 fb                	cmp    %edi,%ebx
+8010aa92:	73 38                	jae    8010aacc <deallocuvm.part.0+0x6c>
+  pde = &pgdir[PDX(va)];
+8010aa94:	89 da                	mov    %ebx,%edx
+8010aa96:	c1 ea 16             	shr    $0x16,%edx
+  if(*pde & PTE_P){
+8010aa99:	8b 04 96             	mov    (%esi,%edx,4),%eax
+8010aa9c:	a8 01                	test   $0x1,%al
+8010aa9e:	74 e8                	je     8010aa88 <deallocuvm.part.0+0x28>
+  return &pgtab[PTX(va)];
+8010aaa0:	89 d9                	mov    %ebx,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010aaa2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010aaa7:	c1 e9 0a             	shr    $0xa,%ecx
+8010aaaa:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+8010aab0:	8d 84 08 00 00 00 80 	lea    -0x80000000(%eax,%ecx,1),%eax
+    if(!pte)
+8010aab7:	85 c0                	test   %eax,%eax
+8010aab9:	74 cd                	je     8010aa88 <deallocuvm.part.0+0x28>
+    else if((*pte & PTE_P) != 0){
+8010aabb:	8b 10                	mov    (%eax),%edx
+8010aabd:	f6 c2 01             	test   $0x1,%dl
+8010aac0:	75 1e                	jne    8010aae0 <deallocuvm.part.0+0x80>
+  for(; a  < oldsz; a += PGSIZE){
+8010aac2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010aac8:	39 fb                	cmp    %edi,%ebx
+8010aaca:	72 c8                	jb     8010aa94 <deallocuvm.part.0+0x34>
+8010aacc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      kfree(v);
+      *pte = 0;
+    }
+  }
+  return newsz;
+}
+8010aacf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010aad2:	89 c8                	mov    %ecx,%eax
+8010aad4:	5b                   	pop    %ebx
+8010aad5:	5e                   	pop    %esi
+8010aad6:	5f                   	pop    %edi
+8010aad7:	5d                   	pop    %ebp
+8010aad8:	c3                   	ret
+8010aad9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(pa == 0)
+8010aae0:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+8010aae6:	74 26                	je     8010ab0e <deallocuvm.part.0+0xae>
+      kfree(v);
+8010aae8:	83 ec 0c             	sub    $0xc,%esp
+      char *v = P2V(pa);
+8010aaeb:	81 c2 00 00 00 80    	add    $0x80000000,%edx
+8010aaf1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(; a  < oldsz; a += PGSIZE){
+8010aaf4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+      kfree(v);
+8010aafa:	52                   	push   %edx
+8010aafb:	e8 30 9e ff ff       	call   80104930 <kfree>
+      *pte = 0;
+8010ab00:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for(; a  < oldsz; a += PGSIZE){
+8010ab03:	83 c4 10             	add    $0x10,%esp
+      *pte = 0;
+8010ab06:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+8010ab0c:	eb 82                	jmp    8010aa90 <deallocuvm.part.0+0x30>
+        panic("kfree");
+8010ab0e:	83 ec 0c             	sub    $0xc,%esp
+8010ab11:	68 72 b9 10 80       	push   $0x8010b972
+8010ab16:	e8 45 5b ff ff       	call   80100660 <panic>
+8010ab1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010ab1f:	90                   	nop
+
+8010ab20 <mappages>:
+{
+8010ab20:	55                   	push   %ebp
+8010ab21:	89 e5                	mov    %esp,%ebp
+8010ab23:	57                   	push   %edi
+8010ab24:	56                   	push   %esi
+8010ab25:	53                   	push   %ebx
+  a = (char*)PGROUNDDOWN((uint)va);
+8010ab26:	89 d3                	mov    %edx,%ebx
+8010ab28:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+8010ab2e:	83 ec 1c             	sub    $0x1c,%esp
+8010ab31:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  last = (char*)PGROUNDDOWN(((uint)va) + size - 1);
+8010ab34:	8d 44 0a ff          	lea    -0x1(%edx,%ecx,1),%eax
+8010ab38:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010ab3d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+8010ab40:	8b 45 08             	mov    0x8(%ebp),%eax
+8010ab43:	29 d8                	sub    %ebx,%eax
+8010ab45:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010ab48:	eb 3f                	jmp    8010ab89 <mappages+0x69>
+8010ab4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010ab50:	89 da                	mov    %ebx,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010ab52:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010ab57:	c1 ea 0a             	shr    $0xa,%edx
+8010ab5a:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010ab60:	8d 84 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%eax
+    if((pte = walkpgdir(pgdir, a, 1)) == 0)
+8010ab67:	85 c0                	test   %eax,%eax
+8010ab69:	74 75                	je     8010abe0 <mappages+0xc0>
+    if(*pte & PTE_P)
+8010ab6b:	f6 00 01             	testb  $0x1,(%eax)
+8010ab6e:	0f 85 86 00 00 00    	jne    8010abfa <mappages+0xda>
+    *pte = pa | perm | PTE_P;
+8010ab74:	0b 75 0c             	or     0xc(%ebp),%esi
+8010ab77:	83 ce 01             	or     $0x1,%esi
+8010ab7a:	89 30                	mov    %esi,(%eax)
+    if(a == last)
+8010ab7c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+8010ab7f:	39 c3                	cmp    %eax,%ebx
+8010ab81:	74 6d                	je     8010abf0 <mappages+0xd0>
+    a += PGSIZE;
+8010ab83:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  for(;;){
+8010ab89:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  pde = &pgdir[PDX(va)];
+8010ab8c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010ab8f:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+8010ab92:	89 d8                	mov    %ebx,%eax
+8010ab94:	c1 e8 16             	shr    $0x16,%eax
+8010ab97:	8d 3c 81             	lea    (%ecx,%eax,4),%edi
+  if(*pde & PTE_P){
+8010ab9a:	8b 07                	mov    (%edi),%eax
+8010ab9c:	a8 01                	test   $0x1,%al
+8010ab9e:	75 b0                	jne    8010ab50 <mappages+0x30>
+    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+8010aba0:	e8 0b a0 ff ff       	call   80104bb0 <kalloc>
+8010aba5:	85 c0                	test   %eax,%eax
+8010aba7:	74 37                	je     8010abe0 <mappages+0xc0>
+    memset(pgtab, 0, PGSIZE);
+8010aba9:	83 ec 04             	sub    $0x4,%esp
+8010abac:	68 00 10 00 00       	push   $0x1000
+8010abb1:	6a 00                	push   $0x0
+8010abb3:	50                   	push   %eax
+8010abb4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+8010abb7:	e8 d4 d8 ff ff       	call   80108490 <memset>
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010abbc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  return &pgtab[PTX(va)];
+8010abbf:	83 c4 10             	add    $0x10,%esp
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010abc2:	8d 82 00 00 00 80    	lea    -0x80000000(%edx),%eax
+8010abc8:	83 c8 07             	or     $0x7,%eax
+8010abcb:	89 07                	mov    %eax,(%edi)
+  return &pgtab[PTX(va)];
+8010abcd:	89 d8                	mov    %ebx,%eax
+8010abcf:	c1 e8 0a             	shr    $0xa,%eax
+8010abd2:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010abd7:	01 d0                	add    %edx,%eax
+8010abd9:	eb 90                	jmp    8010ab6b <mappages+0x4b>
+8010abdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010abdf:	90                   	nop
+}
+8010abe0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010abe3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010abe8:	5b                   	pop    %ebx
+8010abe9:	5e                   	pop    %esi
+8010abea:	5f                   	pop    %edi
+8010abeb:	5d                   	pop    %ebp
+8010abec:	c3                   	ret
+8010abed:	8d 76 00             	lea    0x0(%esi),%esi
+8010abf0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010abf3:	31 c0                	xor    %eax,%eax
+}
+8010abf5:	5b                   	pop    %ebx
+8010abf6:	5e                   	pop    %esi
+8010abf7:	5f                   	pop    %edi
+8010abf8:	5d                   	pop    %ebp
+8010abf9:	c3                   	ret
+      panic("remap");
+8010abfa:	83 ec 0c             	sub    $0xc,%esp
+8010abfd:	68 10 c1 10 80       	push   $0x8010c110
+8010ac02:	e8 59 5a ff ff       	call   80100660 <panic>
+8010ac07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010ac0e:	66 90                	xchg   %ax,%ax
+
+8010ac10 <seginit>:
+{
+8010ac10:	55                   	push   %ebp
+8010ac11:	89 e5                	mov    %esp,%ebp
+8010ac13:	83 ec 18             	sub    $0x18,%esp
+  c = &cpus[cpuid()];
+8010ac16:	e8 85 c0 ff ff       	call   80106ca0 <cpuid>
+  pd[0] = size-1;
+8010ac1b:	ba 2f 00 00 00       	mov    $0x2f,%edx
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+8010ac20:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+8010ac26:	c7 80 f8 71 22 80 ff 	movl   $0xffff,-0x7fdd8e08(%eax)
+8010ac2d:	ff 00 00 
+  c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
+8010ac30:	c7 80 00 72 22 80 ff 	movl   $0xffff,-0x7fdd8e00(%eax)
+8010ac37:	ff 00 00 
+  c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
+8010ac3a:	c7 80 08 72 22 80 ff 	movl   $0xffff,-0x7fdd8df8(%eax)
+8010ac41:	ff 00 00 
+  c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+8010ac44:	c7 80 10 72 22 80 ff 	movl   $0xffff,-0x7fdd8df0(%eax)
+8010ac4b:	ff 00 00 
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+8010ac4e:	c7 80 fc 71 22 80 00 	movl   $0xcf9a00,-0x7fdd8e04(%eax)
+8010ac55:	9a cf 00 
+  c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
+8010ac58:	c7 80 04 72 22 80 00 	movl   $0xcf9200,-0x7fdd8dfc(%eax)
+8010ac5f:	92 cf 00 
+  c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
+8010ac62:	c7 80 0c 72 22 80 00 	movl   $0xcffa00,-0x7fdd8df4(%eax)
+8010ac69:	fa cf 00 
+  c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+8010ac6c:	c7 80 14 72 22 80 00 	movl   $0xcff200,-0x7fdd8dec(%eax)
+8010ac73:	f2 cf 00 
+  lgdt(c->gdt, sizeof(c->gdt));
+8010ac76:	05 f0 71 22 80       	add    $0x802271f0,%eax
+8010ac7b:	66 89 55 f2          	mov    %dx,-0xe(%ebp)
+  pd[1] = (uint)p;
+8010ac7f:	66 89 45 f4          	mov    %ax,-0xc(%ebp)
+  pd[2] = (uint)p >> 16;
+8010ac83:	c1 e8 10             	shr    $0x10,%eax
+8010ac86:	66 89 45 f6          	mov    %ax,-0xa(%ebp)
+  asm volatile("lgdt (%0)" : : "r" (pd));
+8010ac8a:	8d 45 f2             	lea    -0xe(%ebp),%eax
+8010ac8d:	0f 01 10             	lgdtl  (%eax)
+}
+8010ac90:	c9                   	leave
+8010ac91:	c3                   	ret
+8010ac92:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010ac99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+8010aca0 <switchkvm>:
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+8010aca0:	a1 e4 68 23 80       	mov    0x802368e4,%eax
+8010aca5:	05 00 00 00 80       	add    $0x80000000,%eax
+}
+
+static inline void
+lcr3(uint val)
+{
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010acaa:	0f 22 d8             	mov    %eax,%cr3
+}
+8010acad:	c3                   	ret
+8010acae:	66 90                	xchg   %ax,%ax
+
+8010acb0 <switchuvm>:
+{
+8010acb0:	55                   	push   %ebp
+8010acb1:	89 e5                	mov    %esp,%ebp
+8010acb3:	57                   	push   %edi
+8010acb4:	56                   	push   %esi
+8010acb5:	53                   	push   %ebx
+8010acb6:	83 ec 1c             	sub    $0x1c,%esp
+8010acb9:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(p == 0)
+8010acbc:	85 f6                	test   %esi,%esi
+8010acbe:	0f 84 cb 00 00 00    	je     8010ad8f <switchuvm+0xdf>
+  if(p->kstack == 0)
+8010acc4:	8b 46 08             	mov    0x8(%esi),%eax
+8010acc7:	85 c0                	test   %eax,%eax
+8010acc9:	0f 84 da 00 00 00    	je     8010ada9 <switchuvm+0xf9>
+  if(p->pgdir == 0)
+8010accf:	8b 46 04             	mov    0x4(%esi),%eax
+8010acd2:	85 c0                	test   %eax,%eax
+8010acd4:	0f 84 c2 00 00 00    	je     8010ad9c <switchuvm+0xec>
+  pushcli();
+8010acda:	e8 31 d4 ff ff       	call   80108110 <pushcli>
+  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
+8010acdf:	e8 5c bf ff ff       	call   80106c40 <mycpu>
+8010ace4:	89 c3                	mov    %eax,%ebx
+8010ace6:	e8 55 bf ff ff       	call   80106c40 <mycpu>
+8010aceb:	89 c7                	mov    %eax,%edi
+8010aced:	e8 4e bf ff ff       	call   80106c40 <mycpu>
+8010acf2:	83 c7 08             	add    $0x8,%edi
+8010acf5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010acf8:	e8 43 bf ff ff       	call   80106c40 <mycpu>
+8010acfd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010ad00:	ba 67 00 00 00       	mov    $0x67,%edx
+8010ad05:	66 89 bb 9a 00 00 00 	mov    %di,0x9a(%ebx)
+8010ad0c:	83 c0 08             	add    $0x8,%eax
+8010ad0f:	66 89 93 98 00 00 00 	mov    %dx,0x98(%ebx)
+  mycpu()->ts.iomb = (ushort) 0xFFFF;
+8010ad16:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
+8010ad1b:	83 c1 08             	add    $0x8,%ecx
+8010ad1e:	c1 e8 18             	shr    $0x18,%eax
+8010ad21:	c1 e9 10             	shr    $0x10,%ecx
+8010ad24:	88 83 9f 00 00 00    	mov    %al,0x9f(%ebx)
+8010ad2a:	88 8b 9c 00 00 00    	mov    %cl,0x9c(%ebx)
+8010ad30:	b9 99 40 00 00       	mov    $0x4099,%ecx
+8010ad35:	66 89 8b 9d 00 00 00 	mov    %cx,0x9d(%ebx)
+  mycpu()->ts.ss0 = SEG_KDATA << 3;
+8010ad3c:	bb 10 00 00 00       	mov    $0x10,%ebx
+  mycpu()->gdt[SEG_TSS].s = 0;
+8010ad41:	e8 fa be ff ff       	call   80106c40 <mycpu>
+8010ad46:	80 a0 9d 00 00 00 ef 	andb   $0xef,0x9d(%eax)
+  mycpu()->ts.ss0 = SEG_KDATA << 3;
+8010ad4d:	e8 ee be ff ff       	call   80106c40 <mycpu>
+8010ad52:	66 89 58 10          	mov    %bx,0x10(%eax)
+  mycpu()->ts.esp0 = (uint)p->kstack + KSTACKSIZE;
+8010ad56:	8b 5e 08             	mov    0x8(%esi),%ebx
+8010ad59:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010ad5f:	e8 dc be ff ff       	call   80106c40 <mycpu>
+8010ad64:	89 58 0c             	mov    %ebx,0xc(%eax)
+  mycpu()->ts.iomb = (ushort) 0xFFFF;
+8010ad67:	e8 d4 be ff ff       	call   80106c40 <mycpu>
+8010ad6c:	66 89 78 6e          	mov    %di,0x6e(%eax)
+  asm volatile("ltr %0" : : "r" (sel));
+8010ad70:	b8 28 00 00 00       	mov    $0x28,%eax
+8010ad75:	0f 00 d8             	ltr    %ax
+  lcr3(V2P(p->pgdir));  // switch to process's address space
+8010ad78:	8b 46 04             	mov    0x4(%esi),%eax
+8010ad7b:	05 00 00 00 80       	add    $0x80000000,%eax
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010ad80:	0f 22 d8             	mov    %eax,%cr3
+}
+8010ad83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010ad86:	5b                   	pop    %ebx
+8010ad87:	5e                   	pop    %esi
+8010ad88:	5f                   	pop    %edi
+8010ad89:	5d                   	pop    %ebp
+  popcli();
+8010ad8a:	e9 b1 d5 ff ff       	jmp    80108340 <popcli>
+    panic("switchuvm: no process");
+8010ad8f:	83 ec 0c             	sub    $0xc,%esp
+8010ad92:	68 16 c1 10 80       	push   $0x8010c116
+8010ad97:	e8 c4 58 ff ff       	call   80100660 <panic>
+    panic("switchuvm: no pgdir");
+8010ad9c:	83 ec 0c             	sub    $0xc,%esp
+8010ad9f:	68 41 c1 10 80       	push   $0x8010c141
+8010ada4:	e8 b7 58 ff ff       	call   80100660 <panic>
+    panic("switchuvm: no kstack");
+8010ada9:	83 ec 0c             	sub    $0xc,%esp
+8010adac:	68 2c c1 10 80       	push   $0x8010c12c
+8010adb1:	e8 aa 58 ff ff       	call   80100660 <panic>
+8010adb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010adbd:	8d 76 00             	lea    0x0(%esi),%esi
+
+8010adc0 <inituvm>:
+{
+8010adc0:	55                   	push   %ebp
+8010adc1:	89 e5                	mov    %esp,%ebp
+8010adc3:	57                   	push   %edi
+8010adc4:	56                   	push   %esi
+8010adc5:	53                   	push   %ebx
+8010adc6:	83 ec 1c             	sub    $0x1c,%esp
+8010adc9:	8b 45 08             	mov    0x8(%ebp),%eax
+8010adcc:	8b 75 10             	mov    0x10(%ebp),%esi
+8010adcf:	8b 7d 0c             	mov    0xc(%ebp),%edi
+8010add2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(sz >= PGSIZE)
+8010add5:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+8010addb:	77 49                	ja     8010ae26 <inituvm+0x66>
+  mem = kalloc();
+8010addd:	e8 ce 9d ff ff       	call   80104bb0 <kalloc>
+  memset(mem, 0, PGSIZE);
+8010ade2:	83 ec 04             	sub    $0x4,%esp
+8010ade5:	68 00 10 00 00       	push   $0x1000
+  mem = kalloc();
+8010adea:	89 c3                	mov    %eax,%ebx
+  memset(mem, 0, PGSIZE);
+8010adec:	6a 00                	push   $0x0
+8010adee:	50                   	push   %eax
+8010adef:	e8 9c d6 ff ff       	call   80108490 <memset>
+  mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
+8010adf4:	58                   	pop    %eax
+8010adf5:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+8010adfb:	5a                   	pop    %edx
+8010adfc:	6a 06                	push   $0x6
+8010adfe:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010ae03:	31 d2                	xor    %edx,%edx
+8010ae05:	50                   	push   %eax
+8010ae06:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010ae09:	e8 12 fd ff ff       	call   8010ab20 <mappages>
+  memmove(mem, init, sz);
+8010ae0e:	89 75 10             	mov    %esi,0x10(%ebp)
+8010ae11:	83 c4 10             	add    $0x10,%esp
+8010ae14:	89 7d 0c             	mov    %edi,0xc(%ebp)
+8010ae17:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+8010ae1a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010ae1d:	5b                   	pop    %ebx
+8010ae1e:	5e                   	pop    %esi
+8010ae1f:	5f                   	pop    %edi
+8010ae20:	5d                   	pop    %ebp
+  memmove(mem, init, sz);
+8010ae21:	e9 fa d6 ff ff       	jmp    80108520 <memmove>
+    panic("inituvm: more than a page");
+8010ae26:	83 ec 0c             	sub    $0xc,%esp
+8010ae29:	68 55 c1 10 80       	push   $0x8010c155
+8010ae2e:	e8 2d 58 ff ff       	call   80100660 <panic>
+8010ae33:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010ae3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010ae40 <loaduvm>:
+{
+8010ae40:	55                   	push   %ebp
+8010ae41:	89 e5                	mov    %esp,%ebp
+8010ae43:	57                   	push   %edi
+8010ae44:	56                   	push   %esi
+8010ae45:	53                   	push   %ebx
+8010ae46:	83 ec 0c             	sub    $0xc,%esp
+  if((uint) addr % PGSIZE != 0)
+8010ae49:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+8010ae4c:	8b 7d 18             	mov    0x18(%ebp),%edi
+  if((uint) addr % PGSIZE != 0)
+8010ae4f:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+8010ae55:	0f 85 a2 00 00 00    	jne    8010aefd <loaduvm+0xbd>
+  for(i = 0; i < sz; i += PGSIZE){
+8010ae5b:	85 ff                	test   %edi,%edi
+8010ae5d:	74 7d                	je     8010aedc <loaduvm+0x9c>
+8010ae5f:	90                   	nop
+  pde = &pgdir[PDX(va)];
+8010ae60:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if(*pde & PTE_P){
+8010ae63:	8b 55 08             	mov    0x8(%ebp),%edx
+8010ae66:	01 f0                	add    %esi,%eax
+  pde = &pgdir[PDX(va)];
+8010ae68:	89 c1                	mov    %eax,%ecx
+8010ae6a:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010ae6d:	8b 0c 8a             	mov    (%edx,%ecx,4),%ecx
+8010ae70:	f6 c1 01             	test   $0x1,%cl
+8010ae73:	75 13                	jne    8010ae88 <loaduvm+0x48>
+      panic("loaduvm: address should exist");
+8010ae75:	83 ec 0c             	sub    $0xc,%esp
+8010ae78:	68 6f c1 10 80       	push   $0x8010c16f
+8010ae7d:	e8 de 57 ff ff       	call   80100660 <panic>
+8010ae82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010ae88:	c1 e8 0a             	shr    $0xa,%eax
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010ae8b:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  return &pgtab[PTX(va)];
+8010ae91:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010ae96:	8d 8c 01 00 00 00 80 	lea    -0x80000000(%ecx,%eax,1),%ecx
+    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
+8010ae9d:	85 c9                	test   %ecx,%ecx
+8010ae9f:	74 d4                	je     8010ae75 <loaduvm+0x35>
+    if(sz - i < PGSIZE)
+8010aea1:	89 fb                	mov    %edi,%ebx
+8010aea3:	b8 00 10 00 00       	mov    $0x1000,%eax
+8010aea8:	29 f3                	sub    %esi,%ebx
+8010aeaa:	39 c3                	cmp    %eax,%ebx
+8010aeac:	0f 47 d8             	cmova  %eax,%ebx
+    if(readi(ip, P2V(pa), offset+i, n) != n)
+8010aeaf:	53                   	push   %ebx
+8010aeb0:	8b 45 14             	mov    0x14(%ebp),%eax
+8010aeb3:	01 f0                	add    %esi,%eax
+8010aeb5:	50                   	push   %eax
+    pa = PTE_ADDR(*pte);
+8010aeb6:	8b 01                	mov    (%ecx),%eax
+8010aeb8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    if(readi(ip, P2V(pa), offset+i, n) != n)
+8010aebd:	05 00 00 00 80       	add    $0x80000000,%eax
+8010aec2:	50                   	push   %eax
+8010aec3:	ff 75 10             	push   0x10(%ebp)
+8010aec6:	e8 75 80 ff ff       	call   80102f40 <readi>
+8010aecb:	83 c4 10             	add    $0x10,%esp
+8010aece:	39 d8                	cmp    %ebx,%eax
+8010aed0:	75 1e                	jne    8010aef0 <loaduvm+0xb0>
+  for(i = 0; i < sz; i += PGSIZE){
+8010aed2:	81 c6 00 10 00 00    	add    $0x1000,%esi
+8010aed8:	39 fe                	cmp    %edi,%esi
+8010aeda:	72 84                	jb     8010ae60 <loaduvm+0x20>
+}
+8010aedc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010aedf:	31 c0                	xor    %eax,%eax
+}
+8010aee1:	5b                   	pop    %ebx
+8010aee2:	5e                   	pop    %esi
+8010aee3:	5f                   	pop    %edi
+8010aee4:	5d                   	pop    %ebp
+8010aee5:	c3                   	ret
+8010aee6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010aeed:	8d 76 00             	lea    0x0(%esi),%esi
+8010aef0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010aef3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010aef8:	5b                   	pop    %ebx
+8010aef9:	5e                   	pop    %esi
+8010aefa:	5f                   	pop    %edi
+8010aefb:	5d                   	pop    %ebp
+8010aefc:	c3                   	ret
+    panic("loaduvm: addr must be page aligned");
+8010aefd:	83 ec 0c             	sub    $0xc,%esp
+8010af00:	68 10 c2 10 80       	push   $0x8010c210
+8010af05:	e8 56 57 ff ff       	call   80100660 <panic>
+8010af0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010af10 <allocuvm>:
+{
+8010af10:	55                   	push   %ebp
+8010af11:	89 e5                	mov    %esp,%ebp
+8010af13:	57                   	push   %edi
+8010af14:	56                   	push   %esi
+8010af15:	53                   	push   %ebx
+8010af16:	83 ec 1c             	sub    $0x1c,%esp
+8010af19:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(newsz >= KERNBASE)
+8010af1c:	85 f6                	test   %esi,%esi
+8010af1e:	0f 88 98 00 00 00    	js     8010afbc <allocuvm+0xac>
+8010af24:	89 f2                	mov    %esi,%edx
+  if(newsz < oldsz)
+8010af26:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010af29:	0f 82 a1 00 00 00    	jb     8010afd0 <allocuvm+0xc0>
+  a = PGROUNDUP(oldsz);
+8010af2f:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010af32:	05 ff 0f 00 00       	add    $0xfff,%eax
+8010af37:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010af3c:	89 c7                	mov    %eax,%edi
+  for(; a < newsz; a += PGSIZE){
+8010af3e:	39 f0                	cmp    %esi,%eax
+8010af40:	0f 83 8d 00 00 00    	jae    8010afd3 <allocuvm+0xc3>
+8010af46:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+8010af49:	eb 44                	jmp    8010af8f <allocuvm+0x7f>
+8010af4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010af4f:	90                   	nop
+    memset(mem, 0, PGSIZE);
+8010af50:	83 ec 04             	sub    $0x4,%esp
+8010af53:	68 00 10 00 00       	push   $0x1000
+8010af58:	6a 00                	push   $0x0
+8010af5a:	50                   	push   %eax
+8010af5b:	e8 30 d5 ff ff       	call   80108490 <memset>
+    if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+8010af60:	58                   	pop    %eax
+8010af61:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+8010af67:	5a                   	pop    %edx
+8010af68:	6a 06                	push   $0x6
+8010af6a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010af6f:	89 fa                	mov    %edi,%edx
+8010af71:	50                   	push   %eax
+8010af72:	8b 45 08             	mov    0x8(%ebp),%eax
+8010af75:	e8 a6 fb ff ff       	call   8010ab20 <mappages>
+8010af7a:	83 c4 10             	add    $0x10,%esp
+8010af7d:	85 c0                	test   %eax,%eax
+8010af7f:	78 5f                	js     8010afe0 <allocuvm+0xd0>
+  for(; a < newsz; a += PGSIZE){
+8010af81:	81 c7 00 10 00 00    	add    $0x1000,%edi
+8010af87:	39 f7                	cmp    %esi,%edi
+8010af89:	0f 83 89 00 00 00    	jae    8010b018 <allocuvm+0x108>
+    mem = kalloc();
+8010af8f:	e8 1c 9c ff ff       	call   80104bb0 <kalloc>
+8010af94:	89 c3                	mov    %eax,%ebx
+    if(mem == 0){
+8010af96:	85 c0                	test   %eax,%eax
+8010af98:	75 b6                	jne    8010af50 <allocuvm+0x40>
+      cprintf("allocuvm out of memory\n");
+8010af9a:	83 ec 0c             	sub    $0xc,%esp
+8010af9d:	68 8d c1 10 80       	push   $0x8010c18d
+8010afa2:	e8 e9 59 ff ff       	call   80100990 <cprintf>
+  if(newsz >= oldsz)
+8010afa7:	83 c4 10             	add    $0x10,%esp
+8010afaa:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010afad:	74 0d                	je     8010afbc <allocuvm+0xac>
+8010afaf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010afb2:	8b 45 08             	mov    0x8(%ebp),%eax
+8010afb5:	89 f2                	mov    %esi,%edx
+8010afb7:	e8 a4 fa ff ff       	call   8010aa60 <deallocuvm.part.0>
+    return 0;
+8010afbc:	31 d2                	xor    %edx,%edx
+}
+8010afbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010afc1:	89 d0                	mov    %edx,%eax
+8010afc3:	5b                   	pop    %ebx
+8010afc4:	5e                   	pop    %esi
+8010afc5:	5f                   	pop    %edi
+8010afc6:	5d                   	pop    %ebp
+8010afc7:	c3                   	ret
+8010afc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010afcf:	90                   	nop
+    return oldsz;
+8010afd0:	8b 55 0c             	mov    0xc(%ebp),%edx
+}
+8010afd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010afd6:	89 d0                	mov    %edx,%eax
+8010afd8:	5b                   	pop    %ebx
+8010afd9:	5e                   	pop    %esi
+8010afda:	5f                   	pop    %edi
+8010afdb:	5d                   	pop    %ebp
+8010afdc:	c3                   	ret
+8010afdd:	8d 76 00             	lea    0x0(%esi),%esi
+      cprintf("allocuvm out of memory (2)\n");
+8010afe0:	83 ec 0c             	sub    $0xc,%esp
+8010afe3:	68 a5 c1 10 80       	push   $0x8010c1a5
+8010afe8:	e8 a3 59 ff ff       	call   80100990 <cprintf>
+  if(newsz >= oldsz)
+8010afed:	83 c4 10             	add    $0x10,%esp
+8010aff0:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010aff3:	74 0d                	je     8010b002 <allocuvm+0xf2>
+8010aff5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010aff8:	8b 45 08             	mov    0x8(%ebp),%eax
+8010affb:	89 f2                	mov    %esi,%edx
+8010affd:	e8 5e fa ff ff       	call   8010aa60 <deallocuvm.part.0>
+      kfree(mem);
+8010b002:	83 ec 0c             	sub    $0xc,%esp
+8010b005:	53                   	push   %ebx
+8010b006:	e8 25 99 ff ff       	call   80104930 <kfree>
+      return 0;
+8010b00b:	83 c4 10             	add    $0x10,%esp
+    return 0;
+8010b00e:	31 d2                	xor    %edx,%edx
+8010b010:	eb ac                	jmp    8010afbe <allocuvm+0xae>
+8010b012:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+8010b018:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+}
+8010b01b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b01e:	5b                   	pop    %ebx
+8010b01f:	5e                   	pop    %esi
+8010b020:	89 d0                	mov    %edx,%eax
+8010b022:	5f                   	pop    %edi
+8010b023:	5d                   	pop    %ebp
+8010b024:	c3                   	ret
+8010b025:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b02c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+8010b030 <deallocuvm>:
+{
+8010b030:	55                   	push   %ebp
+8010b031:	89 e5                	mov    %esp,%ebp
+8010b033:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010b036:	8b 4d 10             	mov    0x10(%ebp),%ecx
+8010b039:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(newsz >= oldsz)
+8010b03c:	39 d1                	cmp    %edx,%ecx
+8010b03e:	73 10                	jae    8010b050 <deallocuvm+0x20>
+}
+8010b040:	5d                   	pop    %ebp
+8010b041:	e9 1a fa ff ff       	jmp    8010aa60 <deallocuvm.part.0>
+8010b046:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b04d:	8d 76 00             	lea    0x0(%esi),%esi
+8010b050:	89 d0                	mov    %edx,%eax
+8010b052:	5d                   	pop    %ebp
+8010b053:	c3                   	ret
+8010b054:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b05b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010b05f:	90                   	nop
+
+8010b060 <freevm>:
+
+// Free a page table and all the physical memory pages
+// in the user part.
+void
+freevm(pde_t *pgdir)
+{
+8010b060:	55                   	push   %ebp
+8010b061:	89 e5                	mov    %esp,%ebp
+8010b063:	57                   	push   %edi
+8010b064:	56                   	push   %esi
+8010b065:	53                   	push   %ebx
+8010b066:	83 ec 0c             	sub    $0xc,%esp
+8010b069:	8b 75 08             	mov    0x8(%ebp),%esi
+  uint i;
+
+  if(pgdir == 0)
+8010b06c:	85 f6                	test   %esi,%esi
+8010b06e:	74 59                	je     8010b0c9 <freevm+0x69>
+  if(newsz >= oldsz)
+8010b070:	31 c9                	xor    %ecx,%ecx
+8010b072:	ba 00 00 00 80       	mov    $0x80000000,%edx
+8010b077:	89 f0                	mov    %esi,%eax
+8010b079:	89 f3                	mov    %esi,%ebx
+8010b07b:	e8 e0 f9 ff ff       	call   8010aa60 <deallocuvm.part.0>
+    panic("freevm: no pgdir");
+  deallocuvm(pgdir, KERNBASE, 0);
+  for(i = 0; i < NPDENTRIES; i++){
+8010b080:	8d be 00 10 00 00    	lea    0x1000(%esi),%edi
+8010b086:	eb 0f                	jmp    8010b097 <freevm+0x37>
+8010b088:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b08f:	90                   	nop
+8010b090:	83 c3 04             	add    $0x4,%ebx
+8010b093:	39 fb                	cmp    %edi,%ebx
+8010b095:	74 23                	je     8010b0ba <freevm+0x5a>
+    if(pgdir[i] & PTE_P){
+8010b097:	8b 03                	mov    (%ebx),%eax
+8010b099:	a8 01                	test   $0x1,%al
+8010b09b:	74 f3                	je     8010b090 <freevm+0x30>
+      char * v = P2V(PTE_ADDR(pgdir[i]));
+8010b09d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+      kfree(v);
+8010b0a2:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < NPDENTRIES; i++){
+8010b0a5:	83 c3 04             	add    $0x4,%ebx
+      char * v = P2V(PTE_ADDR(pgdir[i]));
+8010b0a8:	05 00 00 00 80       	add    $0x80000000,%eax
+      kfree(v);
+8010b0ad:	50                   	push   %eax
+8010b0ae:	e8 7d 98 ff ff       	call   80104930 <kfree>
+8010b0b3:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NPDENTRIES; i++){
+8010b0b6:	39 fb                	cmp    %edi,%ebx
+8010b0b8:	75 dd                	jne    8010b097 <freevm+0x37>
+    }
+  }
+  kfree((char*)pgdir);
+8010b0ba:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+8010b0bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b0c0:	5b                   	pop    %ebx
+8010b0c1:	5e                   	pop    %esi
+8010b0c2:	5f                   	pop    %edi
+8010b0c3:	5d                   	pop    %ebp
+  kfree((char*)pgdir);
+8010b0c4:	e9 67 98 ff ff       	jmp    80104930 <kfree>
+    panic("freevm: no pgdir");
+8010b0c9:	83 ec 0c             	sub    $0xc,%esp
+8010b0cc:	68 c1 c1 10 80       	push   $0x8010c1c1
+8010b0d1:	e8 8a 55 ff ff       	call   80100660 <panic>
+8010b0d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b0dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+8010b0e0 <setupkvm>:
+{
+8010b0e0:	55                   	push   %ebp
+8010b0e1:	89 e5                	mov    %esp,%ebp
+8010b0e3:	56                   	push   %esi
+8010b0e4:	53                   	push   %ebx
+  if((pgdir = (pde_t*)kalloc()) == 0)
+8010b0e5:	e8 c6 9a ff ff       	call   80104bb0 <kalloc>
+8010b0ea:	85 c0                	test   %eax,%eax
+8010b0ec:	74 5e                	je     8010b14c <setupkvm+0x6c>
+  memset(pgdir, 0, PGSIZE);
+8010b0ee:	83 ec 04             	sub    $0x4,%esp
+8010b0f1:	89 c6                	mov    %eax,%esi
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+8010b0f3:	bb 20 f4 10 80       	mov    $0x8010f420,%ebx
+  memset(pgdir, 0, PGSIZE);
+8010b0f8:	68 00 10 00 00       	push   $0x1000
+8010b0fd:	6a 00                	push   $0x0
+8010b0ff:	50                   	push   %eax
+8010b100:	e8 8b d3 ff ff       	call   80108490 <memset>
+8010b105:	83 c4 10             	add    $0x10,%esp
+                (uint)k->phys_start, k->perm) < 0) {
+8010b108:	8b 43 04             	mov    0x4(%ebx),%eax
+    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
+8010b10b:	83 ec 08             	sub    $0x8,%esp
+8010b10e:	8b 4b 08             	mov    0x8(%ebx),%ecx
+8010b111:	8b 13                	mov    (%ebx),%edx
+8010b113:	ff 73 0c             	push   0xc(%ebx)
+8010b116:	50                   	push   %eax
+8010b117:	29 c1                	sub    %eax,%ecx
+8010b119:	89 f0                	mov    %esi,%eax
+8010b11b:	e8 00 fa ff ff       	call   8010ab20 <mappages>
+8010b120:	83 c4 10             	add    $0x10,%esp
+8010b123:	85 c0                	test   %eax,%eax
+8010b125:	78 19                	js     8010b140 <setupkvm+0x60>
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+8010b127:	83 c3 10             	add    $0x10,%ebx
+8010b12a:	81 fb 60 f4 10 80    	cmp    $0x8010f460,%ebx
+8010b130:	75 d6                	jne    8010b108 <setupkvm+0x28>
+}
+8010b132:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010b135:	89 f0                	mov    %esi,%eax
+8010b137:	5b                   	pop    %ebx
+8010b138:	5e                   	pop    %esi
+8010b139:	5d                   	pop    %ebp
+8010b13a:	c3                   	ret
+8010b13b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010b13f:	90                   	nop
+      freevm(pgdir);
+8010b140:	83 ec 0c             	sub    $0xc,%esp
+8010b143:	56                   	push   %esi
+8010b144:	e8 17 ff ff ff       	call   8010b060 <freevm>
+      return 0;
+8010b149:	83 c4 10             	add    $0x10,%esp
+}
+8010b14c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+8010b14f:	31 f6                	xor    %esi,%esi
+}
+8010b151:	89 f0                	mov    %esi,%eax
+8010b153:	5b                   	pop    %ebx
+8010b154:	5e                   	pop    %esi
+8010b155:	5d                   	pop    %ebp
+8010b156:	c3                   	ret
+8010b157:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b15e:	66 90                	xchg   %ax,%ax
+
+8010b160 <kvmalloc>:
+{
+8010b160:	55                   	push   %ebp
+8010b161:	89 e5                	mov    %esp,%ebp
+8010b163:	83 ec 08             	sub    $0x8,%esp
+  kpgdir = setupkvm();
+8010b166:	e8 75 ff ff ff       	call   8010b0e0 <setupkvm>
+8010b16b:	a3 e4 68 23 80       	mov    %eax,0x802368e4
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+8010b170:	05 00 00 00 80       	add    $0x80000000,%eax
+8010b175:	0f 22 d8             	mov    %eax,%cr3
+}
+8010b178:	c9                   	leave
+8010b179:	c3                   	ret
+8010b17a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010b180 <clearpteu>:
+
+// Clear PTE_U on a page. Used to create an inaccessible
+// page beneath the user stack.
+void
+clearpteu(pde_t *pgdir, char *uva)
+{
+8010b180:	55                   	push   %ebp
+8010b181:	89 e5                	mov    %esp,%ebp
+8010b183:	83 ec 08             	sub    $0x8,%esp
+8010b186:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if(*pde & PTE_P){
+8010b189:	8b 55 08             	mov    0x8(%ebp),%edx
+  pde = &pgdir[PDX(va)];
+8010b18c:	89 c1                	mov    %eax,%ecx
+8010b18e:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010b191:	8b 14 8a             	mov    (%edx,%ecx,4),%edx
+8010b194:	f6 c2 01             	test   $0x1,%dl
+8010b197:	75 17                	jne    8010b1b0 <clearpteu+0x30>
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, uva, 0);
+  if(pte == 0)
+    panic("clearpteu");
+8010b199:	83 ec 0c             	sub    $0xc,%esp
+8010b19c:	68 d2 c1 10 80       	push   $0x8010c1d2
+8010b1a1:	e8 ba 54 ff ff       	call   80100660 <panic>
+8010b1a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b1ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010b1b0:	c1 e8 0a             	shr    $0xa,%eax
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b1b3:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  return &pgtab[PTX(va)];
+8010b1b9:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010b1be:	8d 84 02 00 00 00 80 	lea    -0x80000000(%edx,%eax,1),%eax
+  if(pte == 0)
+8010b1c5:	85 c0                	test   %eax,%eax
+8010b1c7:	74 d0                	je     8010b199 <clearpteu+0x19>
+  *pte &= ~PTE_U;
+8010b1c9:	83 20 fb             	andl   $0xfffffffb,(%eax)
+}
+8010b1cc:	c9                   	leave
+8010b1cd:	c3                   	ret
+8010b1ce:	66 90                	xchg   %ax,%ax
+
+8010b1d0 <copyuvm>:
+// of it for a child.  Writable user pages are not copied:
+// both page tables map them read-only with PTE_COW set,
+// and cowfault() copies a page when either side writes it.
+pde_t*
+copyuvm(pde_t *pgdir, uint sz)
+{
+8010b1d0:	55                   	push   %ebp
+8010b1d1:	89 e5                	mov    %esp,%ebp
+8010b1d3:	57                   	push   %edi
+8010b1d4:	56                   	push   %esi
+8010b1d5:	53                   	push   %ebx
+8010b1d6:	83 ec 1c             	sub    $0x1c,%esp
+  pde_t *d;
+  pte_t *pte;
+  uint pa, i, flags;
+  char *mem;
+
+  if((d = setupkvm()) == 0)
+8010b1d9:	e8 02 ff ff ff       	call   8010b0e0 <setupkvm>
+8010b1de:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010b1e1:	85 c0                	test   %eax,%eax
+8010b1e3:	0f 84 5d 01 00 00    	je     8010b346 <copyuvm+0x176>
+    return 0;
+  for(i = 0; i < sz; i += PGSIZE){
+8010b1e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010b1ec:	31 f6                	xor    %esi,%esi
+8010b1ee:	85 c9                	test   %ecx,%ecx
+8010b1f0:	75 1f                	jne    8010b211 <copyuvm+0x41>
+8010b1f2:	e9 b6 00 00 00       	jmp    8010b2ad <copyuvm+0xdd>
+8010b1f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b1fe:	66 90                	xchg   %ax,%ax
+    // Skip heap pages that were never touched (see lazyfault).
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0){
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+8010b200:	83 c1 01             	add    $0x1,%ecx
+8010b203:	89 ce                	mov    %ecx,%esi
+8010b205:	c1 e6 16             	shl    $0x16,%esi
+  for(i = 0; i < sz; i += PGSIZE){
+8010b208:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010b20b:	0f 83 9c 00 00 00    	jae    8010b2ad <copyuvm+0xdd>
+  if(*pde & PTE_P){
+8010b211:	8b 45 08             	mov    0x8(%ebp),%eax
+  pde = &pgdir[PDX(va)];
+8010b214:	89 f1                	mov    %esi,%ecx
+8010b216:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010b219:	8b 04 88             	mov    (%eax,%ecx,4),%eax
+8010b21c:	a8 01                	test   $0x1,%al
+8010b21e:	74 e0                	je     8010b200 <copyuvm+0x30>
+  return &pgtab[PTX(va)];
+8010b220:	89 f3                	mov    %esi,%ebx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b222:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010b227:	c1 eb 0a             	shr    $0xa,%ebx
+8010b22a:	81 e3 fc 0f 00 00    	and    $0xffc,%ebx
+8010b230:	8d bc 18 00 00 00 80 	lea    -0x80000000(%eax,%ebx,1),%edi
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0){
+8010b237:	85 ff                	test   %edi,%edi
+8010b239:	74 c5                	je     8010b200 <copyuvm+0x30>
+      continue;
+    }
+    if(!(*pte & PTE_P))
+8010b23b:	8b 07                	mov    (%edi),%eax
+8010b23d:	a8 01                	test   $0x1,%al
+8010b23f:	0f 84 c9 00 00 00    	je     8010b30e <copyuvm+0x13e>
+      continue;
+    pa = PTE_ADDR(*pte);
+8010b245:	89 c3                	mov    %eax,%ebx
+    flags = PTE_FLAGS(*pte);
+8010b247:	89 c1                	mov    %eax,%ecx
+    pa = PTE_ADDR(*pte);
+8010b249:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    flags = PTE_FLAGS(*pte);
+8010b24f:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+    if(!(flags & PTE_U)){
+8010b255:	a8 04                	test   $0x4,%al
+8010b257:	74 6f                	je     8010b2c8 <copyuvm+0xf8>
+        kfree(mem);
+        goto bad;
+      }
+      continue;
+    }
+    if(flags & PTE_W){
+8010b259:	a8 02                	test   $0x2,%al
+8010b25b:	74 10                	je     8010b26d <copyuvm+0x9d>
+      flags = (flags & ~PTE_W) | PTE_COW;
+8010b25d:	25 fd 07 00 00       	and    $0x7fd,%eax
+8010b262:	80 cc 08             	or     $0x8,%ah
+8010b265:	89 c1                	mov    %eax,%ecx
+      *pte = pa | flags;
+8010b267:	89 d8                	mov    %ebx,%eax
+8010b269:	09 c8                	or     %ecx,%eax
+8010b26b:	89 07                	mov    %eax,(%edi)
+    }
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
+8010b26d:	83 ec 08             	sub    $0x8,%esp
+8010b270:	89 f2                	mov    %esi,%edx
+8010b272:	51                   	push   %ecx
+8010b273:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010b278:	53                   	push   %ebx
+8010b279:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010b27c:	e8 9f f8 ff ff       	call   8010ab20 <mappages>
+8010b281:	83 c4 10             	add    $0x10,%esp
+8010b284:	85 c0                	test   %eax,%eax
+8010b286:	0f 88 a0 00 00 00    	js     8010b32c <copyuvm+0x15c>
+      goto bad;
+    kaddref(P2V(pa));
+8010b28c:	83 ec 0c             	sub    $0xc,%esp
+8010b28f:	81 c3 00 00 00 80    	add    $0x80000000,%ebx
+  for(i = 0; i < sz; i += PGSIZE){
+8010b295:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    kaddref(P2V(pa));
+8010b29b:	53                   	push   %ebx
+8010b29c:	e8 4f 9b ff ff       	call   80104df0 <kaddref>
+  for(i = 0; i < sz; i += PGSIZE){
+8010b2a1:	83 c4 10             	add    $0x10,%esp
+8010b2a4:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010b2a7:	0f 82 64 ff ff ff    	jb     8010b211 <copyuvm+0x41>
+  }
+  // The parent's PTEs may have lost PTE_W; flush its TLB.
+  lcr3(V2P(pgdir));
+8010b2ad:	8b 45 08             	mov    0x8(%ebp),%eax
+8010b2b0:	8d b0 00 00 00 80    	lea    -0x80000000(%eax),%esi
+8010b2b6:	0f 22 de             	mov    %esi,%cr3
+
+bad:
+  freevm(d);
+  lcr3(V2P(pgdir));
+  return 0;
+}
+8010b2b9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010b2bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b2bf:	5b                   	pop    %ebx
+8010b2c0:	5e                   	pop    %esi
+8010b2c1:	5f                   	pop    %edi
+8010b2c2:	5d                   	pop    %ebp
+8010b2c3:	c3                   	ret
+8010b2c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010b2c8:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+      if((mem = kalloc()) == 0)
+8010b2cb:	e8 e0 98 ff ff       	call   80104bb0 <kalloc>
+8010b2d0:	89 c7                	mov    %eax,%edi
+8010b2d2:	85 c0                	test   %eax,%eax
+8010b2d4:	74 56                	je     8010b32c <copyuvm+0x15c>
+      memmove(mem, (char*)P2V(pa), PGSIZE);
+8010b2d6:	83 ec 04             	sub    $0x4,%esp
+8010b2d9:	81 c3 00 00 00 80    	add    $0x80000000,%ebx
+8010b2df:	68 00 10 00 00       	push   $0x1000
+8010b2e4:	53                   	push   %ebx
+8010b2e5:	50                   	push   %eax
+8010b2e6:	e8 35 d2 ff ff       	call   80108520 <memmove>
+      if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0){
+8010b2eb:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010b2ee:	58                   	pop    %eax
+8010b2ef:	8d 87 00 00 00 80    	lea    -0x80000000(%edi),%eax
+8010b2f5:	5a                   	pop    %edx
+8010b2f6:	89 f2                	mov    %esi,%edx
+8010b2f8:	51                   	push   %ecx
+8010b2f9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010b2fe:	50                   	push   %eax
+8010b2ff:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010b302:	e8 19 f8 ff ff       	call   8010ab20 <mappages>
+8010b307:	83 c4 10             	add    $0x10,%esp
+8010b30a:	85 c0                	test   %eax,%eax
+8010b30c:	78 12                	js     8010b320 <copyuvm+0x150>
+  for(i = 0; i < sz; i += PGSIZE){
+8010b30e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+8010b314:	e9 ef fe ff ff       	jmp    8010b208 <copyuvm+0x38>
+8010b319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        kfree(mem);
+8010b320:	83 ec 0c             	sub    $0xc,%esp
+8010b323:	57                   	push   %edi
+8010b324:	e8 07 96 ff ff       	call   80104930 <kfree>
+        goto bad;
+8010b329:	83 c4 10             	add    $0x10,%esp
+  freevm(d);
+8010b32c:	83 ec 0c             	sub    $0xc,%esp
+8010b32f:	ff 75 e4             	push   -0x1c(%ebp)
+8010b332:	e8 29 fd ff ff       	call   8010b060 <freevm>
+  lcr3(V2P(pgdir));
+8010b337:	8b 45 08             	mov    0x8(%ebp),%eax
+8010b33a:	8d b0 00 00 00 80    	lea    -0x80000000(%eax),%esi
+8010b340:	0f 22 de             	mov    %esi,%cr3
+  return 0;
+8010b343:	83 c4 10             	add    $0x10,%esp
+    return 0;
+8010b346:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+}
+8010b34d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010b350:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b353:	5b                   	pop    %ebx
+8010b354:	5e                   	pop    %esi
+8010b355:	5f                   	pop    %edi
+8010b356:	5d                   	pop    %ebp
+8010b357:	c3                   	ret
+8010b358:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b35f:	90                   	nop
+
+8010b360 <cowfault>:
+// If the page is copy-on-write, give this address space its own
+// writable copy (or just make it writable if no one else shares it).
+// Returns 0 if the fault was resolved, -1 if it was a real fault.
+int
+cowfault(pde_t *pgdir, uint va)
+{
+8010b360:	55                   	push   %ebp
+8010b361:	89 e5                	mov    %esp,%ebp
+8010b363:	57                   	push   %edi
+8010b364:	56                   	push   %esi
+8010b365:	53                   	push   %ebx
+8010b366:	83 ec 1c             	sub    $0x1c,%esp
+8010b369:	8b 45 0c             	mov    0xc(%ebp),%eax
+  pte_t *pte;
+  uint pa, flags;
+  char *mem;
+
+  if(va >= KERNBASE)
+8010b36c:	85 c0                	test   %eax,%eax
+8010b36e:	0f 88 d4 00 00 00    	js     8010b448 <cowfault+0xe8>
+  if(*pde & PTE_P){
+8010b374:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  pde = &pgdir[PDX(va)];
+8010b377:	89 c2                	mov    %eax,%edx
+8010b379:	c1 ea 16             	shr    $0x16,%edx
+  if(*pde & PTE_P){
+8010b37c:	8b 14 91             	mov    (%ecx,%edx,4),%edx
+8010b37f:	f6 c2 01             	test   $0x1,%dl
+8010b382:	0f 84 c0 00 00 00    	je     8010b448 <cowfault+0xe8>
+  return &pgtab[PTX(va)];
+8010b388:	c1 e8 0a             	shr    $0xa,%eax
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b38b:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  return &pgtab[PTX(va)];
+8010b391:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010b396:	8d b4 02 00 00 00 80 	lea    -0x80000000(%edx,%eax,1),%esi
+    return -1;
+  if((pte = walkpgdir(pgdir, (void*)va, 0)) == 0)
+8010b39d:	85 f6                	test   %esi,%esi
+8010b39f:	0f 84 a3 00 00 00    	je     8010b448 <cowfault+0xe8>
+    return -1;
+  if((*pte & (PTE_P|PTE_U|PTE_COW)) != (PTE_P|PTE_U|PTE_COW))
+8010b3a5:	8b 1e                	mov    (%esi),%ebx
+8010b3a7:	89 d8                	mov    %ebx,%eax
+8010b3a9:	25 05 08 00 00       	and    $0x805,%eax
+8010b3ae:	3d 05 08 00 00       	cmp    $0x805,%eax
+8010b3b3:	0f 85 8f 00 00 00    	jne    8010b448 <cowfault+0xe8>
+    return -1;
+  pa = PTE_ADDR(*pte);
+8010b3b9:	89 da                	mov    %ebx,%edx
+  flags = (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+  if(krefcnt(P2V(pa)) == 1){
+8010b3bb:	83 ec 0c             	sub    $0xc,%esp
+  flags = (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+8010b3be:	81 e3 fd 07 00 00    	and    $0x7fd,%ebx
+  pa = PTE_ADDR(*pte);
+8010b3c4:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  flags = (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+8010b3ca:	83 cb 02             	or     $0x2,%ebx
+  if(krefcnt(P2V(pa)) == 1){
+8010b3cd:	8d ba 00 00 00 80    	lea    -0x80000000(%edx),%edi
+8010b3d3:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010b3d6:	57                   	push   %edi
+8010b3d7:	e8 64 9a ff ff       	call   80104e40 <krefcnt>
+8010b3dc:	83 c4 10             	add    $0x10,%esp
+8010b3df:	83 f8 01             	cmp    $0x1,%eax
+8010b3e2:	75 1c                	jne    8010b400 <cowfault+0xa0>
+    // Last reference; no need to copy.
+    *pte = pa | flags;
+8010b3e4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010b3e7:	09 da                	or     %ebx,%edx
+8010b3e9:	89 16                	mov    %edx,(%esi)
+    }
+    memmove(mem, (char*)P2V(pa), PGSIZE);
+    *pte = V2P(mem) | flags;
+    kfree(P2V(pa));
+  }
+  lcr3(V2P(pgdir));
+8010b3eb:	8b 45 08             	mov    0x8(%ebp),%eax
+8010b3ee:	05 00 00 00 80       	add    $0x80000000,%eax
+8010b3f3:	0f 22 d8             	mov    %eax,%cr3
+  return 0;
+8010b3f6:	31 c0                	xor    %eax,%eax
+}
+8010b3f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b3fb:	5b                   	pop    %ebx
+8010b3fc:	5e                   	pop    %esi
+8010b3fd:	5f                   	pop    %edi
+8010b3fe:	5d                   	pop    %ebp
+8010b3ff:	c3                   	ret
+    if((mem = kalloc()) == 0){
+8010b400:	e8 ab 97 ff ff       	call   80104bb0 <kalloc>
+8010b405:	85 c0                	test   %eax,%eax
+8010b407:	74 2c                	je     8010b435 <cowfault+0xd5>
+    memmove(mem, (char*)P2V(pa), PGSIZE);
+8010b409:	83 ec 04             	sub    $0x4,%esp
+8010b40c:	68 00 10 00 00       	push   $0x1000
+8010b411:	57                   	push   %edi
+8010b412:	50                   	push   %eax
+8010b413:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010b416:	e8 05 d1 ff ff       	call   80108520 <memmove>
+    *pte = V2P(mem) | flags;
+8010b41b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010b41e:	81 c2 00 00 00 80    	add    $0x80000000,%edx
+8010b424:	09 da                	or     %ebx,%edx
+8010b426:	89 16                	mov    %edx,(%esi)
+    kfree(P2V(pa));
+8010b428:	89 3c 24             	mov    %edi,(%esp)
+8010b42b:	e8 00 95 ff ff       	call   80104930 <kfree>
+8010b430:	83 c4 10             	add    $0x10,%esp
+8010b433:	eb b6                	jmp    8010b3eb <cowfault+0x8b>
+      cprintf("cowfault: out of memory\n");
+8010b435:	83 ec 0c             	sub    $0xc,%esp
+8010b438:	68 dc c1 10 80       	push   $0x8010c1dc
+8010b43d:	e8 4e 55 ff ff       	call   80100990 <cprintf>
+      return -1;
+8010b442:	83 c4 10             	add    $0x10,%esp
+8010b445:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+8010b448:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010b44d:	eb a9                	jmp    8010b3f8 <cowfault+0x98>
+8010b44f:	90                   	nop
+
+8010b450 <lazyfault>:
+// without allocating memory; the first touch of each page
+// lands here and maps a zeroed page.
+// Returns 0 if the fault was resolved, -1 if it was a real fault.
+int
+lazyfault(pde_t *pgdir, uint va, uint sz)
+{
+8010b450:	55                   	push   %ebp
+8010b451:	89 e5                	mov    %esp,%ebp
+8010b453:	56                   	push   %esi
+8010b454:	53                   	push   %ebx
+8010b455:	8b 45 0c             	mov    0xc(%ebp),%eax
+  char *mem;
+
+  if(va >= sz || va >= KERNBASE)
+8010b458:	3b 45 10             	cmp    0x10(%ebp),%eax
+8010b45b:	73 63                	jae    8010b4c0 <lazyfault+0x70>
+8010b45d:	85 c0                	test   %eax,%eax
+8010b45f:	78 5f                	js     8010b4c0 <lazyfault+0x70>
+    return -1;
+  va = PGROUNDDOWN(va);
+8010b461:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010b466:	89 c6                	mov    %eax,%esi
+  if((mem = kalloc()) == 0){
+8010b468:	e8 43 97 ff ff       	call   80104bb0 <kalloc>
+8010b46d:	89 c3                	mov    %eax,%ebx
+8010b46f:	85 c0                	test   %eax,%eax
+8010b471:	74 3a                	je     8010b4ad <lazyfault+0x5d>
+    cprintf("lazyfault: out of memory\n");
+    return -1;
+  }
+  memset(mem, 0, PGSIZE);
+8010b473:	83 ec 04             	sub    $0x4,%esp
+8010b476:	68 00 10 00 00       	push   $0x1000
+8010b47b:	6a 00                	push   $0x0
+8010b47d:	50                   	push   %eax
+8010b47e:	e8 0d d0 ff ff       	call   80108490 <memset>
+  if(mappages(pgdir, (char*)va, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+8010b483:	58                   	pop    %eax
+8010b484:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+8010b48a:	5a                   	pop    %edx
+8010b48b:	6a 06                	push   $0x6
+8010b48d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010b492:	89 f2                	mov    %esi,%edx
+8010b494:	50                   	push   %eax
+8010b495:	8b 45 08             	mov    0x8(%ebp),%eax
+8010b498:	e8 83 f6 ff ff       	call   8010ab20 <mappages>
+8010b49d:	83 c4 10             	add    $0x10,%esp
+8010b4a0:	85 c0                	test   %eax,%eax
+8010b4a2:	78 23                	js     8010b4c7 <lazyfault+0x77>
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+8010b4a4:	31 c0                	xor    %eax,%eax
+}
+8010b4a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010b4a9:	5b                   	pop    %ebx
+8010b4aa:	5e                   	pop    %esi
+8010b4ab:	5d                   	pop    %ebp
+8010b4ac:	c3                   	ret
+    cprintf("lazyfault: out of memory\n");
+8010b4ad:	83 ec 0c             	sub    $0xc,%esp
+8010b4b0:	68 f5 c1 10 80       	push   $0x8010c1f5
+8010b4b5:	e8 d6 54 ff ff       	call   80100990 <cprintf>
+    return -1;
+8010b4ba:	83 c4 10             	add    $0x10,%esp
+8010b4bd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+8010b4c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010b4c5:	eb df                	jmp    8010b4a6 <lazyfault+0x56>
+    kfree(mem);
+8010b4c7:	83 ec 0c             	sub    $0xc,%esp
+8010b4ca:	53                   	push   %ebx
+8010b4cb:	e8 60 94 ff ff       	call   80104930 <kfree>
+    return -1;
+8010b4d0:	83 c4 10             	add    $0x10,%esp
+8010b4d3:	eb eb                	jmp    8010b4c0 <lazyfault+0x70>
+8010b4d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b4dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+8010b4e0 <uvmtouch>:
+// that the kernel can use them without faulting: a failed
+// lazyfault() or cowfault() in the kernel would be a panic.
+// Returns -1 if out of memory.
+int
+uvmtouch(pde_t *pgdir, uint va, uint len, uint sz, int write)
+{
+8010b4e0:	55                   	push   %ebp
+8010b4e1:	89 e5                	mov    %esp,%ebp
+8010b4e3:	57                   	push   %edi
+8010b4e4:	56                   	push   %esi
+8010b4e5:	53                   	push   %ebx
+8010b4e6:	83 ec 0c             	sub    $0xc,%esp
+8010b4e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  pte_t *pte;
+  uint a;
+
+  for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE){
+8010b4ec:	8b 75 10             	mov    0x10(%ebp),%esi
+{
+8010b4ef:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE){
+8010b4f2:	89 cb                	mov    %ecx,%ebx
+8010b4f4:	01 ce                	add    %ecx,%esi
+8010b4f6:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+8010b4fc:	39 f3                	cmp    %esi,%ebx
+8010b4fe:	72 42                	jb     8010b542 <uvmtouch+0x62>
+8010b500:	e9 86 00 00 00       	jmp    8010b58b <uvmtouch+0xab>
+8010b505:	8d 76 00             	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010b508:	89 d9                	mov    %ebx,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b50a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010b50f:	c1 e9 0a             	shr    $0xa,%ecx
+8010b512:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+8010b518:	8d 84 08 00 00 00 80 	lea    -0x80000000(%eax,%ecx,1),%eax
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(pte == 0 || (*pte & PTE_P) == 0){
+8010b51f:	85 c0                	test   %eax,%eax
+8010b521:	74 2b                	je     8010b54e <uvmtouch+0x6e>
+8010b523:	8b 00                	mov    (%eax),%eax
+8010b525:	a8 01                	test   $0x1,%al
+8010b527:	74 25                	je     8010b54e <uvmtouch+0x6e>
+      if(lazyfault(pgdir, a, sz) < 0)
+        return -1;
+    } else if(write && (*pte & PTE_COW)){
+8010b529:	8b 55 18             	mov    0x18(%ebp),%edx
+8010b52c:	85 d2                	test   %edx,%edx
+8010b52e:	74 08                	je     8010b538 <uvmtouch+0x58>
+8010b530:	f6 c4 08             	test   $0x8,%ah
+8010b533:	75 3b                	jne    8010b570 <uvmtouch+0x90>
+8010b535:	8d 76 00             	lea    0x0(%esi),%esi
+  for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE){
+8010b538:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010b53e:	39 f3                	cmp    %esi,%ebx
+8010b540:	73 49                	jae    8010b58b <uvmtouch+0xab>
+  pde = &pgdir[PDX(va)];
+8010b542:	89 d8                	mov    %ebx,%eax
+8010b544:	c1 e8 16             	shr    $0x16,%eax
+  if(*pde & PTE_P){
+8010b547:	8b 04 87             	mov    (%edi,%eax,4),%eax
+8010b54a:	a8 01                	test   $0x1,%al
+8010b54c:	75 ba                	jne    8010b508 <uvmtouch+0x28>
+      if(lazyfault(pgdir, a, sz) < 0)
+8010b54e:	83 ec 04             	sub    $0x4,%esp
+8010b551:	ff 75 14             	push   0x14(%ebp)
+8010b554:	53                   	push   %ebx
+8010b555:	57                   	push   %edi
+8010b556:	e8 f5 fe ff ff       	call   8010b450 <lazyfault>
+8010b55b:	83 c4 10             	add    $0x10,%esp
+8010b55e:	85 c0                	test   %eax,%eax
+8010b560:	79 d6                	jns    8010b538 <uvmtouch+0x58>
+      if(cowfault(pgdir, a) < 0)
+        return -1;
+    }
+  }
+  return 0;
+}
+8010b562:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return -1;
+8010b565:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010b56a:	5b                   	pop    %ebx
+8010b56b:	5e                   	pop    %esi
+8010b56c:	5f                   	pop    %edi
+8010b56d:	5d                   	pop    %ebp
+8010b56e:	c3                   	ret
+8010b56f:	90                   	nop
+      if(cowfault(pgdir, a) < 0)
+8010b570:	83 ec 08             	sub    $0x8,%esp
+8010b573:	53                   	push   %ebx
+8010b574:	57                   	push   %edi
+8010b575:	e8 e6 fd ff ff       	call   8010b360 <cowfault>
+8010b57a:	83 c4 10             	add    $0x10,%esp
+8010b57d:	85 c0                	test   %eax,%eax
+8010b57f:	78 e1                	js     8010b562 <uvmtouch+0x82>
+  for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE){
+8010b581:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010b587:	39 f3                	cmp    %esi,%ebx
+8010b589:	72 b7                	jb     8010b542 <uvmtouch+0x62>
+}
+8010b58b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010b58e:	31 c0                	xor    %eax,%eax
+}
+8010b590:	5b                   	pop    %ebx
+8010b591:	5e                   	pop    %esi
+8010b592:	5f                   	pop    %edi
+8010b593:	5d                   	pop    %ebp
+8010b594:	c3                   	ret
+8010b595:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b59c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+8010b5a0 <uva2ka>:
+
+//PAGEBREAK!
+// Map user virtual address to kernel address.
+char*
+uva2ka(pde_t *pgdir, char *uva)
+{
+8010b5a0:	55                   	push   %ebp
+8010b5a1:	89 e5                	mov    %esp,%ebp
+8010b5a3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  if(*pde & PTE_P){
+8010b5a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  pde = &pgdir[PDX(va)];
+8010b5a9:	89 d1                	mov    %edx,%ecx
+8010b5ab:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010b5ae:	8b 0c 88             	mov    (%eax,%ecx,4),%ecx
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, uva, 0);
+  if(pte == 0 || (*pte & PTE_P) == 0)
+    return 0;
+8010b5b1:	31 c0                	xor    %eax,%eax
+  if(*pde & PTE_P){
+8010b5b3:	f6 c1 01             	test   $0x1,%cl
+8010b5b6:	74 36                	je     8010b5ee <uva2ka+0x4e>
+  return &pgtab[PTX(va)];
+8010b5b8:	c1 ea 0a             	shr    $0xa,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b5bb:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  return &pgtab[PTX(va)];
+8010b5c1:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010b5c7:	8d 84 11 00 00 00 80 	lea    -0x80000000(%ecx,%edx,1),%eax
+  if(pte == 0 || (*pte & PTE_P) == 0)
+8010b5ce:	85 c0                	test   %eax,%eax
+8010b5d0:	74 1c                	je     8010b5ee <uva2ka+0x4e>
+8010b5d2:	8b 00                	mov    (%eax),%eax
+  if((*pte & PTE_U) == 0)
+8010b5d4:	89 c2                	mov    %eax,%edx
+    return 0;
+  return (char*)P2V(PTE_ADDR(*pte));
+8010b5d6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  if((*pte & PTE_U) == 0)
+8010b5db:	83 e2 05             	and    $0x5,%edx
+  return (char*)P2V(PTE_ADDR(*pte));
+8010b5de:	05 00 00 00 80       	add    $0x80000000,%eax
+8010b5e3:	83 fa 05             	cmp    $0x5,%edx
+8010b5e6:	ba 00 00 00 00       	mov    $0x0,%edx
+8010b5eb:	0f 45 c2             	cmovne %edx,%eax
+}
+8010b5ee:	5d                   	pop    %ebp
+8010b5ef:	c3                   	ret
+
+8010b5f0 <copyout>:
+// Copy len bytes from p to user address va in page table pgdir.
+// Most useful when pgdir is not the current page table.
+// uva2ka ensures this only works for PTE_U pages.
+int
+copyout(pde_t *pgdir, uint va, void *p, uint len)
+{
+8010b5f0:	55                   	push   %ebp
+8010b5f1:	89 e5                	mov    %esp,%ebp
+8010b5f3:	57                   	push   %edi
+8010b5f4:	56                   	push   %esi
+8010b5f5:	53                   	push   %ebx
+8010b5f6:	83 ec 0c             	sub    $0xc,%esp
+8010b5f9:	8b 75 14             	mov    0x14(%ebp),%esi
+8010b5fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010b5ff:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *buf, *pa0;
+  uint n, va0;
+
+  buf = (char*)p;
+  while(len > 0){
+8010b602:	85 f6                	test   %esi,%esi
+8010b604:	75 7b                	jne    8010b681 <copyout+0x91>
+8010b606:	e9 a5 00 00 00       	jmp    8010b6b0 <copyout+0xc0>
+8010b60b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010b60f:	90                   	nop
+  return &pgtab[PTX(va)];
+8010b610:	89 fb                	mov    %edi,%ebx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b612:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  return &pgtab[PTX(va)];
+8010b618:	c1 eb 0a             	shr    $0xa,%ebx
+8010b61b:	81 e3 fc 0f 00 00    	and    $0xffc,%ebx
+8010b621:	8d 8c 19 00 00 00 80 	lea    -0x80000000(%ecx,%ebx,1),%ecx
+  if(pte == 0 || (*pte & PTE_P) == 0)
+8010b628:	85 c9                	test   %ecx,%ecx
+8010b62a:	74 71                	je     8010b69d <copyout+0xad>
+8010b62c:	8b 09                	mov    (%ecx),%ecx
+  if((*pte & PTE_U) == 0)
+8010b62e:	89 cb                	mov    %ecx,%ebx
+8010b630:	83 e3 05             	and    $0x5,%ebx
+8010b633:	83 fb 05             	cmp    $0x5,%ebx
+8010b636:	75 65                	jne    8010b69d <copyout+0xad>
+  return (char*)P2V(PTE_ADDR(*pte));
+8010b638:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+8010b63e:	89 cb                	mov    %ecx,%ebx
+8010b640:	8d 89 00 00 00 80    	lea    -0x80000000(%ecx),%ecx
+    va0 = (uint)PGROUNDDOWN(va);
+    pa0 = uva2ka(pgdir, (char*)va0);
+    if(pa0 == 0)
+8010b646:	81 fb 00 00 00 80    	cmp    $0x80000000,%ebx
+8010b64c:	74 4f                	je     8010b69d <copyout+0xad>
+      return -1;
+    n = PGSIZE - (va - va0);
+8010b64e:	89 fb                	mov    %edi,%ebx
+8010b650:	29 c3                	sub    %eax,%ebx
+8010b652:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010b658:	39 f3                	cmp    %esi,%ebx
+8010b65a:	0f 47 de             	cmova  %esi,%ebx
+    if(n > len)
+      n = len;
+    memmove(pa0 + (va - va0), buf, n);
+8010b65d:	29 f8                	sub    %edi,%eax
+8010b65f:	83 ec 04             	sub    $0x4,%esp
+8010b662:	01 c1                	add    %eax,%ecx
+8010b664:	53                   	push   %ebx
+8010b665:	52                   	push   %edx
+8010b666:	89 55 10             	mov    %edx,0x10(%ebp)
+8010b669:	51                   	push   %ecx
+8010b66a:	e8 b1 ce ff ff       	call   80108520 <memmove>
+    len -= n;
+    buf += n;
+8010b66f:	8b 55 10             	mov    0x10(%ebp),%edx
+    va = va0 + PGSIZE;
+8010b672:	8d 87 00 10 00 00    	lea    0x1000(%edi),%eax
+  while(len > 0){
+8010b678:	83 c4 10             	add    $0x10,%esp
+    buf += n;
+8010b67b:	01 da                	add    %ebx,%edx
+  while(len > 0){
+8010b67d:	29 de                	sub    %ebx,%esi
+8010b67f:	74 2f                	je     8010b6b0 <copyout+0xc0>
+  if(*pde & PTE_P){
+8010b681:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pde = &pgdir[PDX(va)];
+8010b684:	89 c1                	mov    %eax,%ecx
+    va0 = (uint)PGROUNDDOWN(va);
+8010b686:	89 c7                	mov    %eax,%edi
+  pde = &pgdir[PDX(va)];
+8010b688:	c1 e9 16             	shr    $0x16,%ecx
+    va0 = (uint)PGROUNDDOWN(va);
+8010b68b:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  if(*pde & PTE_P){
+8010b691:	8b 0c 8b             	mov    (%ebx,%ecx,4),%ecx
+8010b694:	f6 c1 01             	test   $0x1,%cl
+8010b697:	0f 85 73 ff ff ff    	jne    8010b610 <copyout+0x20>
+  }
+  return 0;
+}
+8010b69d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010b6a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010b6a5:	5b                   	pop    %ebx
+8010b6a6:	5e                   	pop    %esi
+8010b6a7:	5f                   	pop    %edi
+8010b6a8:	5d                   	pop    %ebp
+8010b6a9:	c3                   	ret
+8010b6aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+8010b6b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010b6b3:	31 c0                	xor    %eax,%eax
+}
+8010b6b5:	5b                   	pop    %ebx
+8010b6b6:	5e                   	pop    %esi
+8010b6b7:	5f                   	pop    %edi
+8010b6b8:	5d                   	pop    %ebp
+8010b6b9:	c3                   	ret
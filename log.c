@@ -1,6 +1,8 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
+#include "proc.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
@@ -15,99 +17,198 @@
 // write an uncommitted system call's updates to disk.
 //
 // A system call should call begin_op()/end_op() to mark
-// its start and end. Usually begin_op() just increments
-// the count of in-progress FS system calls and returns.
-// But if it thinks the log is close to running out, it
-// sleeps until the last outstanding end_op() commits.
+// its start and end. begin_op() reserves MAXOPBLOCKS log
+// blocks for the call; a call that knows how many blocks it
+// will write, such as a large file write, uses begin_opn(n)
+// to reserve exactly n instead.  Usually this just adds to
+// the reservations of the in-progress FS system calls and
+// returns.  But if the reservation would not fit in the log,
+// it sleeps until the log daemon commits.  end_op() returns
+// once the transaction holding the call's updates has
+// committed, i.e., its commit record is on disk.
+//
+// Commits are done by a kernel process, logdaemon(), which
+// implements group commit: once a transaction has absorbed
+// more than one FS system call, it stays open for up to
+// LOGDELAY ticks so that more calls can join it, unless the
+// log fills first.  A transaction with a single call commits
+// as soon as that call ends.  After writing the commit record
+// the daemon wakes the waiting calls and only then copies the
+// blocks to their home locations, while the next transaction
+// is already accepting new calls.
 //
 // The log is a physical re-do log containing disk blocks.
 // The on-disk log format:
-//   header block, containing block #s for block A, B, C, ...
+//   LOGHDRBLOCKS header blocks, containing block #s for block A, B, C, ...
 //   block A
 //   block B
 //   block C
 //   ...
 // Log appends are synchronous.
+//
+// The header is a struct logheader spread over consecutive blocks.
+// The first header block holds the count n, so writing it last
+// is still the single point at which a transaction commits.
 
-// Contents of the header block, used for both the on-disk header block
+// Contents of the header blocks, used for both the on-disk header
 // and to keep track in memory of logged block# before commit.
 struct logheader {
   int n;
   int block[LOGSIZE];
 };
 
+// Open-addressed hash of the open transaction's block numbers, for
+// log absorption.  Entries are indexes into lh.block plus one; 0 is
+// an empty slot.
+#define LOGHASHSIZE (2*LOGSIZE+1)
+
 struct log {
   struct spinlock lock;
   int start;
   int size;
+  int cap;         // max blocks in a transaction, LOGSIZE or less
   int outstanding; // how many FS sys calls are executing.
+  int reserved;    // log blocks reserved by the executing calls
   int committing;  // in commit(), please wait.
   int dev;
-  struct logheader lh;
+  uint seq;        // sequence number of the open transaction
+  uint done;       // sequence number of the last committed transaction
+  int nops;        // FS sys calls that joined the open transaction
+  uint opened;     // ticks when the open transaction got its first call
+  int full;        // begin_op() is waiting for log space
+  struct logheader lh;   // open transaction
+  struct logheader clh;  // committed transaction being installed
+  ushort hash[LOGHASHSIZE];  // block# -> index in lh.block, plus 1
 };
 struct log log;
 
+// Not in the buffer cache: used to write committed blocks from the
+// log to their home locations without touching the cached copies,
+// which the next transaction may already have modified.
+static struct buf installbuf;
+
 static void recover_from_log(void);
-static void commit();
+static void logdaemon(void);
 
 void
 initlog(int dev)
 {
-  if (sizeof(struct logheader) >= BSIZE)
+  if (sizeof(struct logheader) > LOGHDRBLOCKS*BSIZE)
     panic("initlog: too big logheader");
 
   struct superblock sb;
   initlock(&log.lock, "log");
+  initsleeplock(&installbuf.lock, "installbuf");
   readsb(dev, &sb);
   log.start = sb.logstart;
   log.size = sb.nlog;
   log.dev = dev;
+  // The disk may have been made with a smaller log.
+  log.cap = log.size - LOGHDRBLOCKS;
+  if(log.cap > LOGSIZE)
+    log.cap = LOGSIZE;
+  if(log.cap < MAXOPBLOCKS)
+    panic("initlog: log too small");
+  log.seq = 1;
   recover_from_log();
+  if(kproc("logd", logdaemon) < 0)
+    panic("initlog: logd");
 }
 
-// Copy committed blocks from log to their home location
+// Return the index of blockno in the open transaction's
+// header, or -1.  Caller must hold log.lock.
+static int
+loglookup(uint blockno)
+{
+  uint h;
+  int i;
+
+  for(h = blockno % LOGHASHSIZE; log.hash[h]; h = (h+1) % LOGHASHSIZE){
+    i = log.hash[h] - 1;
+    if(log.lh.block[i] == blockno)
+      return i;
+  }
+  return -1;
+}
+
+// Copy committed blocks from log to their home location.
+// If unpin, also let the buffer cache evict the cached copies,
+// unless the open transaction has logged them again.
 static void
-install_trans(void)
+install_trans(struct logheader *lh, int unpin)
 {
   int tail;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
-    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
-    bwrite(dbuf);  // write dst to disk
+  acquiresleep(&installbuf.lock);
+  for (tail = 0; tail < lh->n; tail++) {
+    struct buf *lbuf = bread(log.dev, log.start+LOGHDRBLOCKS+tail); // read log block
+    installbuf.dev = log.dev;
+    installbuf.blockno = lh->block[tail];
+    installbuf.flags = B_DIRTY;
+    memmove(installbuf.data, lbuf->data, BSIZE);
+    iderw(&installbuf);  // write dst to disk
     brelse(lbuf);
-    brelse(dbuf);
+    if(unpin){
+      // Holding dbuf's lock keeps log_write() from logging it
+      // while we decide.
+      struct buf *dbuf = bread(log.dev, lh->block[tail]);
+      acquire(&log.lock);
+      if (loglookup(dbuf->blockno) < 0)
+        dbuf->flags &= ~B_DIRTY;
+      release(&log.lock);
+      brelse(dbuf);
+    }
   }
+  releasesleep(&installbuf.lock);
 }
 
+// Number of header bytes in use for a header with n entries.
+#define HDRBYTES(n) (sizeof(int) * (1 + (n)))
+
 // Read the log header from disk into the in-memory log header
 static void
-read_head(void)
+read_head(struct logheader *h)
 {
-  struct buf *buf = bread(log.dev, log.start);
-  struct logheader *lh = (struct logheader *) (buf->data);
-  int i;
-  log.lh.n = lh->n;
-  for (i = 0; i < log.lh.n; i++) {
-    log.lh.block[i] = lh->block[i];
+  struct buf *buf;
+  uint off, m;
+
+  buf = bread(log.dev, log.start);
+  h->n = ((struct logheader *) (buf->data))->n;
+  if(h->n < 0 || h->n > log.cap)
+    panic("read_head: bad log header");
+  for(off = 0; off < HDRBYTES(h->n); off += BSIZE){
+    if(off > 0)
+      buf = bread(log.dev, log.start + off/BSIZE);
+    m = HDRBYTES(h->n) - off;
+    if(m > BSIZE)
+      m = BSIZE;
+    memmove((char*)h + off, buf->data, m);
+    brelse(buf);
   }
-  brelse(buf);
 }
 
 // Write in-memory log header to disk.
-// This is the true point at which the
-// current transaction commits.
+// Writing the first header block, which holds the count,
+// is the true point at which the current transaction
+// commits, so it goes last.
 static void
-write_head(void)
+write_head(struct logheader *h)
 {
-  struct buf *buf = bread(log.dev, log.start);
-  struct logheader *hb = (struct logheader *) (buf->data);
-  int i;
-  hb->n = log.lh.n;
-  for (i = 0; i < log.lh.n; i++) {
-    hb->block[i] = log.lh.block[i];
+  struct buf *buf;
+  uint off, m;
+
+  for(off = BSIZE; off < HDRBYTES(h->n); off += BSIZE){
+    buf = bread(log.dev, log.start + off/BSIZE);
+    m = HDRBYTES(h->n) - off;
+    if(m > BSIZE)
+      m = BSIZE;
+    memmove(buf->data, (char*)h + off, m);
+    bwrite(buf);
+    brelse(buf);
   }
+  m = HDRBYTES(h->n) < BSIZE ? HDRBYTES(h->n) : BSIZE;
+  buf = bread(log.dev, log.start);
+  memmove(buf->data, h, m);
   bwrite(buf);
   brelse(buf);
 }
@@ -115,73 +216,102 @@ write_head(void)
 static void
 recover_from_log(void)
 {
-  read_head();
-  install_trans(); // if committed, copy from log to disk
-  log.lh.n = 0;
-  write_head(); // clear the log
+  read_head(&log.clh);
+  install_trans(&log.clh, 0); // if committed, copy from log to disk
+  log.clh.n = 0;
+  write_head(&log.clh); // clear the log
 }
 
-// called at the start of each FS system call.
+// called at the start of each FS system call that
+// writes at most n blocks.
 void
-begin_op(void)
+begin_opn(int n)
 {
+  if(n > log.cap)
+    panic("begin_opn: too big");
   acquire(&log.lock);
   while(1){
     if(log.committing){
       sleep(&log, &log.lock);
-    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+    } else if(log.full || log.lh.n + log.reserved + n > log.cap){
       // this op might exhaust log space; wait for commit.
+      // Once one op waits, later ones wait behind it, so
+      // that small ops cannot starve a large one.
+      log.full = 1;
+      wakeup(&log);
       sleep(&log, &log.lock);
     } else {
+      if(log.nops == 0)
+        log.opened = ticks;
+      log.nops += 1;
       log.outstanding += 1;
+      log.reserved += n;
+      myproc()->logblocks = n;
       release(&log.lock);
       break;
     }
   }
 }
 
+// called at the start of each FS system call.
+void
+begin_op(void)
+{
+  begin_opn(MAXOPBLOCKS);
+}
+
+// Most blocks a single call may reserve with begin_opn(), a
+// share of the log that leaves room for other calls to join.
+int
+log_opmax(void)
+{
+  return log.cap / 2;
+}
+
 // called at the end of each FS system call.
-// commits if this was the last outstanding operation.
+// waits until the transaction holding this call's
+// updates has committed.
 void
 end_op(void)
 {
-  int do_commit = 0;
+  uint seq;
 
   acquire(&log.lock);
   log.outstanding -= 1;
+  log.reserved -= myproc()->logblocks;
   if(log.committing)
     panic("log.committing");
-  if(log.outstanding == 0){
-    do_commit = 1;
-    log.committing = 1;
-  } else {
-    // begin_op() may be waiting for log space,
-    // and decrementing log.outstanding has decreased
-    // the amount of reserved space.
-    wakeup(&log);
-  }
-  release(&log.lock);
-
-  if(do_commit){
-    // call commit w/o holding locks, since not allowed
-    // to sleep with locks.
-    commit();
-    acquire(&log.lock);
-    log.committing = 0;
+  if(log.outstanding == 0 && log.lh.n == 0){
+    // nothing was written; the transaction is complete
+    // without a commit.  Calls that ended earlier wait for
+    // it below, and begin_opn() may be waiting for the
+    // reserved space.
+    log.done = log.seq++;
+    log.nops = 0;
+    log.full = 0;
     wakeup(&log);
     release(&log.lock);
+    return;
   }
+  // logdaemon() may be waiting for log.outstanding to reach 0,
+  // and begin_opn() may be waiting for log space, since
+  // releasing this call's reservation has made room.
+  wakeup(&log);
+  seq = log.seq;
+  while((int)(log.done - seq) < 0)
+    sleep(&log, &log.lock);
+  release(&log.lock);
 }
 
 // Copy modified blocks from cache to log.
 static void
-write_log(void)
+write_log(struct logheader *lh)
 {
   int tail;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
-    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+  for (tail = 0; tail < lh->n; tail++) {
+    struct buf *to = bclaim(log.dev, log.start+LOGHDRBLOCKS+tail); // log block
+    struct buf *from = bread(log.dev, lh->block[tail]); // cache block
     memmove(to->data, from->data, BSIZE);
     bwrite(to);  // write the log
     brelse(from);
@@ -189,21 +319,70 @@ write_log(void)
   }
 }
 
+// Should the open transaction be committed now?
+// Caller must hold log.lock.
+static int
+commitready(void)
+{
+  if(log.outstanding > 0 || log.lh.n == 0)
+    return 0;
+  return log.nops <= 1 || log.full || ticks - log.opened >= LOGDELAY;
+}
+
+//PAGEBREAK!
+// Kernel process that commits transactions and installs
+// them.  Never returns.
 static void
-commit()
+logdaemon(void)
 {
-  if (log.lh.n > 0) {
-    write_log();     // Write modified blocks from cache to log
-    write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
+  acquire(&log.lock);
+  for(;;){
+    if(!commitready()){
+      if(log.outstanding == 0 && log.lh.n > 0){
+        // Group commit window: recheck on the next tick.
+        release(&log.lock);
+        acquire(&tickslock);
+        sleepticks(1);
+        release(&tickslock);
+        acquire(&log.lock);
+      } else {
+        sleep(&log, &log.lock);
+      }
+      continue;
+    }
+
+    // Commit.  No FS calls may run while the cached blocks
+    // are copied to the log.
+    log.committing = 1;
+    log.clh = log.lh;
+    release(&log.lock);
+
+    write_log(&log.clh);     // Write modified blocks from cache to log
+    write_head(&log.clh);    // Write header to disk -- the real commit
+
+    acquire(&log.lock);
+    log.done = log.seq++;
     log.lh.n = 0;
-    write_head();    // Erase the transaction from the log
+    memset(log.hash, 0, sizeof(log.hash));
+    log.nops = 0;
+    log.full = 0;
+    log.committing = 0;
+    wakeup(&log);
+    release(&log.lock);
+
+    // The calls of the committed transaction have returned and
+    // the next transaction is open; install in the background.
+    install_trans(&log.clh, 1); // Now install writes to home locations
+    log.clh.n = 0;
+    write_head(&log.clh);    // Erase the transaction from the log
+
+    acquire(&log.lock);
   }
 }
 
 // Caller has modified b->data and is done with the buffer.
 // Record the block number and pin in the cache with B_DIRTY.
-// commit()/write_log() will do the disk write.
+// The log daemon will do the disk write.
 //
 // log_write() replaces bwrite(); a typical use is:
 //   bp = bread(...)
@@ -213,22 +392,20 @@ commit()
 void
 log_write(struct buf *b)
 {
-  int i;
+  uint h;
 
-  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+  if (log.lh.n >= log.cap)
     panic("too big a transaction");
   if (log.outstanding < 1)
     panic("log_write outside of trans");
 
   acquire(&log.lock);
-  for (i = 0; i < log.lh.n; i++) {
-    if (log.lh.block[i] == b->blockno)   // log absorbtion
-      break;
+  if (loglookup(b->blockno) < 0) {   // else log absorbtion
+    for (h = b->blockno % LOGHASHSIZE; log.hash[h]; h = (h+1) % LOGHASHSIZE)
+      ;
+    log.lh.block[log.lh.n++] = b->blockno;
+    log.hash[h] = log.lh.n;
   }
-  log.lh.block[i] = b->blockno;
-  if (i == log.lh.n)
-    log.lh.n++;
   b->flags |= B_DIRTY; // prevent eviction
   release(&log.lock);
 }
-
@@ -15,14 +15,15 @@
 #define static_assert(a, b) do { switch (0) case 0: case (a): ; } while (0)
 #endif
 
-#define NINODES 200
+#define NINODES 32000
+#define NROOTENT 1024  // max entries in the root directory
 
 // Disk layout:
 // [ boot block | sb block | log | inode blocks | free bit map | data blocks ]
 
 int nbitmap = FSSIZE/(BSIZE*8) + 1;
 int ninodeblocks = NINODES / IPB + 1;
-int nlog = LOGSIZE;
+int nlog = LOGHDRBLOCKS + LOGSIZE;
 int nmeta;    // Number of meta blocks (boot, sb, nlog, inode, bitmap)
 int nblocks;  // Number of data blocks
 
@@ -40,6 +41,7 @@ void rinode(uint inum, struct dinode *ip);
 void rsect(uint sec, void *buf);
 uint ialloc(ushort type);
 void iappend(uint inum, void *p, int n);
+void dirwrite(uint inum, struct dirent *de, int n);
 
 // convert to intel byte order
 ushort
@@ -68,10 +70,10 @@ int
 main(int argc, char *argv[])
 {
   int i, cc, fd;
-  uint rootino, inum, off;
-  struct dirent de;
+  uint rootino, inum;
+  static struct dirent de[NROOTENT];
+  int nde;
   char buf[BSIZE];
-  struct dinode din;
 
 
   static_assert(sizeof(int) == 4, "Integers must be 4 bytes!");
@@ -117,15 +119,12 @@ main(int argc, char *argv[])
   rootino = ialloc(T_DIR);
   assert(rootino == ROOTINO);
 
-  bzero(&de, sizeof(de));
-  de.inum = xshort(rootino);
-  strcpy(de.name, ".");
-  iappend(rootino, &de, sizeof(de));
-
-  bzero(&de, sizeof(de));
-  de.inum = xshort(rootino);
-  strcpy(de.name, "..");
-  iappend(rootino, &de, sizeof(de));
+  bzero(de, sizeof(de));
+  de[0].inum = xshort(rootino);
+  strcpy(de[0].name, ".");
+  de[1].inum = xshort(rootino);
+  strcpy(de[1].name, "..");
+  nde = 2;
 
   for(i = 2; i < argc; i++){
     assert(index(argv[i], '/') == 0);
@@ -144,10 +143,10 @@ main(int argc, char *argv[])
 
     inum = ialloc(T_FILE);
 
-    bzero(&de, sizeof(de));
-    de.inum = xshort(inum);
-    strncpy(de.name, argv[i], DIRSIZ);
-    iappend(rootino, &de, sizeof(de));
+    assert(nde < NROOTENT);
+    de[nde].inum = xshort(inum);
+    strncpy(de[nde].name, argv[i], DIRSIZ);
+    nde++;
 
     while((cc = read(fd, buf, sizeof(buf))) > 0)
       iappend(inum, buf, cc);
@@ -155,12 +154,7 @@ main(int argc, char *argv[])
     close(fd);
   }
 
-  // fix size of root inode dir
-  rinode(rootino, &din);
-  off = xint(din.size);
-  off = ((off/BSIZE) + 1) * BSIZE;
-  din.size = xint(off);
-  winode(rootino, &din);
+  dirwrite(rootino, de, nde);
 
   balloc(freeblock);
 
@@ -238,16 +232,18 @@ void
 balloc(int used)
 {
   uchar buf[BSIZE];
-  int i;
+  int i, b;
 
   printf("balloc: first %d blocks have been allocated\n", used);
-  assert(used < BSIZE*8);
-  bzero(buf, BSIZE);
-  for(i = 0; i < used; i++){
-    buf[i/8] = buf[i/8] | (0x1 << (i%8));
+  assert(used < nbitmap*BSIZE*8);
+  for(b = 0; b*BSIZE*8 < used; b++){
+    bzero(buf, BSIZE);
+    for(i = 0; i < BSIZE*8 && b*BSIZE*8 + i < used; i++){
+      buf[i/8] = buf[i/8] | (0x1 << (i%8));
+    }
+    printf("balloc: write bitmap block at sector %d\n", sb.bmapstart+b);
+    wsect(sb.bmapstart+b, buf);
   }
-  printf("balloc: write bitmap block at sector %d\n", sb.bmapstart);
-  wsect(sb.bmapstart, buf);
 }
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
@@ -260,7 +256,8 @@ iappend(uint inum, void *xp, int n)
   struct dinode din;
   char buf[BSIZE];
   uint indirect[NINDIRECT];
-  uint x;
+  uint x, bn, nb;
+  int level;
 
   rinode(inum, &din);
   off = xint(din.size);
@@ -274,15 +271,24 @@ iappend(uint inum, void *xp, int n)
       }
       x = xint(din.addrs[fbn]);
     } else {
-      if(xint(din.addrs[NDIRECT]) == 0){
-        din.addrs[NDIRECT] = xint(freeblock++);
+      // Find the indirect tree holding fbn, then walk down it.
+      bn = fbn - NDIRECT;
+      for(level = 1, nb = NINDIRECT; bn >= nb; level++, nb *= NINDIRECT)
+        bn -= nb;
+      if(xint(din.addrs[NDIRECT+level-1]) == 0){
+        din.addrs[NDIRECT+level-1] = xint(freeblock++);
       }
-      rsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      if(indirect[fbn - NDIRECT] == 0){
-        indirect[fbn - NDIRECT] = xint(freeblock++);
-        wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
+      x = xint(din.addrs[NDIRECT+level-1]);
+      for(; level > 0; level--){
+        nb /= NINDIRECT;
+        rsect(x, (char*)indirect);
+        if(indirect[bn / nb] == 0){
+          indirect[bn / nb] = xint(freeblock++);
+          wsect(x, (char*)indirect);
+        }
+        x = xint(indirect[bn / nb]);
+        bn %= nb;
       }
-      x = xint(indirect[fbn-NDIRECT]);
     }
     n1 = min(n, (fbn + 1) * BSIZE - off);
     rsect(x, buf);
@@ -295,3 +301,63 @@ iappend(uint inum, void *xp, int n)
   din.size = xint(off);
   winode(inum, &din);
 }
+
+static int
+dxcmp(const void *a, const void *b)
+{
+  uint ha, hb;
+
+  ha = dxhash(((struct dirent*)a)->name);
+  hb = dxhash(((struct dirent*)b)->name);
+  return ha < hb ? -1 : ha > hb;
+}
+
+// Write the n entries de[] into the empty directory inum.
+// If they need more than one block, give the directory an
+// index, in the format the kernel's dirlink() maintains, with
+// leaves three quarters full.
+void
+dirwrite(uint inum, struct dirent *de, int n)
+{
+  struct dinode din;
+  struct dxnode root;
+  struct dirent leaf[DPB];
+  uint off, h;
+  int i, j;
+
+  if(n <= DPB){
+    iappend(inum, de, n * sizeof(*de));
+    // Round the size up to a whole block.
+    rinode(inum, &din);
+    off = xint(din.size);
+    off = ((off + BSIZE - 1) / BSIZE) * BSIZE;
+    din.size = xint(off);
+    winode(inum, &din);
+    return;
+  }
+
+  qsort(de, n, sizeof(*de), dxcmp);
+  bzero(&root, sizeof(root));
+  for(i = 0; i < n; i = j){
+    // Names that hash alike must share a leaf.
+    j = min(i + DPB*3/4, n);
+    h = dxhash(de[j-1].name);
+    while(j < n && dxhash(de[j].name) == h)
+      j++;
+    assert(j - i <= DPB);
+    assert(root.count < NDXENTRY);
+
+    bzero(leaf, sizeof(leaf));
+    memmove(leaf, &de[i], (j - i) * sizeof(*de));
+    root.e[root.count].hash = xint(root.count == 0 ? 0 : dxhash(de[i].name));
+    root.e[root.count].block = xint(root.count);
+    root.count++;
+    iappend(inum, leaf, sizeof(leaf));
+  }
+  root.count = xshort(root.count);
+
+  rinode(inum, &din);
+  din.addrs[DXROOT] = xint(freeblock);
+  winode(inum, &din);
+  wsect(freeblock++, &root);
+}
@@ -141,6 +141,11 @@ struct segdesc {
 #define PTE_D           0x040   // Dirty
 #define PTE_PS          0x080   // Page Size
 #define PTE_MBZ         0x180   // Bits must be zero
+#define PTE_COW         0x800   // Copy-on-write (software, avail bit)
+
+// Page fault error code bits (trapframe err for T_PGFLT)
+#define FEC_PR          0x1     // Protection violation (page was present)
+#define FEC_WR          0x2     // Fault caused by a write
 
 // Address in page table or page directory entry
 #define PTE_ADDR(pte)   ((uint)(pte) & ~0xFFF)
@@ -1,14 +1,19 @@
-#define NPROC        64  // maximum number of processes
+#define NPROC       256  // maximum number of processes
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
 #define NOFILE       16  // open files per process
-#define NFILE       100  // open files per system
-#define NINODE       50  // maximum number of active i-nodes
+#define NFILE       500  // open files per system
+#define NINODE      200  // i-nodes cached before unused ones are reused
+#define NDCACHE     256  // entries in directory name cache
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
-#define MAXOPBLOCKS  10  // max # of blocks any FS op writes
-#define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1000  // size of file system in blocks
+#define MAXOPBLOCKS  14  // max # of blocks any FS op writes
+#define LOGSIZE      (MAXOPBLOCKS*30)  // max data blocks in on-disk log
+#define LOGDELAY     1  // ticks a shared transaction waits for more FS ops
+#define NBUF         (LOGSIZE*3)  // size of disk block cache
+#define NBREADN      16  // max blocks in one multi-block read
+#define FSSIZE       20000  // size of file system in blocks
+#define NMLFQ         3  // MLFQ scheduler levels
+#define BOOSTTICKS  100  // ticks between MLFQ priority boosts
 
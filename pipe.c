@@ -8,17 +8,42 @@
 #include "sleeplock.h"
 #include "file.h"
 
-#define PIPESIZE 512
+#define min(a, b) ((a) < (b) ? (a) : (b))
+
+// A pipe's data is a ring buffer of PIPEPAGES pages by default,
+// which pipesize() can change to any power of two pages up to
+// PIPEMAXPAGES.  The struct pipe has a page of its own.
+#define PIPEPAGES 1
+#define PIPEMAXPAGES 16
 
 struct pipe {
   struct spinlock lock;
-  char data[PIPESIZE];
+  char *page[PIPEMAXPAGES];  // The ring buffer
+  uint size;      // Capacity in bytes, a power of two
   uint nread;     // number of bytes read
   uint nwrite;    // number of bytes written
   int readopen;   // read fd is still open
   int writeopen;  // write fd is still open
+  int wsplice;    // A splice is writing into the ring
+  int rsplice;    // A splice is reading from the ring
 };
 
+// Allocate n pages into pg[], or none of them.
+static int
+pipepages(char **pg, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++){
+    if((pg[i] = kalloc()) == 0){
+      while(--i >= 0)
+        kfree(pg[i]);
+      return -1;
+    }
+  }
+  return 0;
+}
+
 int
 pipealloc(struct file **f0, struct file **f1)
 {
@@ -30,6 +55,10 @@ pipealloc(struct file **f0, struct file **f1)
     goto bad;
   if((p = (struct pipe*)kalloc()) == 0)
     goto bad;
+  memset(p, 0, sizeof(*p));
+  if(pipepages(p->page, PIPEPAGES) < 0)
+    goto bad;
+  p->size = PIPEPAGES*PGSIZE;
   p->readopen = 1;
   p->writeopen = 1;
   p->nwrite = 0;
@@ -59,6 +88,8 @@ pipealloc(struct file **f0, struct file **f1)
 void
 pipeclose(struct pipe *p, int writable)
 {
+  int i;
+
   acquire(&p->lock);
   if(writable){
     p->writeopen = 0;
@@ -69,20 +100,71 @@ pipeclose(struct pipe *p, int writable)
   }
   if(p->readopen == 0 && p->writeopen == 0){
     release(&p->lock);
+    for(i = 0; i < p->size/PGSIZE; i++)
+      kfree(p->page[i]);
     kfree((char*)p);
   } else
     release(&p->lock);
 }
 
+// Change p's capacity to at least n bytes, rounded up to a
+// power of two pages.  Returns the new capacity, or -1 if n is
+// too big, or too small for the data in the pipe, or there is
+// no memory.  n of 0 just returns the capacity.
+int
+pipesize(struct pipe *p, int n)
+{
+  char *pg[PIPEMAXPAGES];
+  uint size, off, m, i;
+
+  if(n < 0 || n > PIPEMAXPAGES*PGSIZE)
+    return -1;
+  if(n == 0)
+    return p->size;
+  for(size = PGSIZE; size < n; size *= 2)
+    ;
+  if(pipepages(pg, size/PGSIZE) < 0)
+    return -1;
+
+  acquire(&p->lock);
+  while(p->wsplice || p->rsplice)
+    sleep(&p->nwrite, &p->lock);
+  if(p->nwrite - p->nread > size){
+    release(&p->lock);
+    for(i = 0; i < size/PGSIZE; i++)
+      kfree(pg[i]);
+    return -1;
+  }
+
+  // Copy the data over, to the start of the new ring.
+  for(off = 0; p->nread + off != p->nwrite; off += m){
+    m = min(p->nwrite - p->nread - off, PGSIZE - (p->nread + off)%PGSIZE);
+    m = min(m, PGSIZE - off%PGSIZE);
+    memmove(pg[off/PGSIZE] + off%PGSIZE,
+            p->page[((p->nread + off) & (p->size-1)) / PGSIZE] +
+            (p->nread + off)%PGSIZE, m);
+  }
+  for(i = 0; i < p->size/PGSIZE; i++)
+    kfree(p->page[i]);
+  memmove(p->page, pg, sizeof(pg));
+  p->size = size;
+  p->nread = 0;
+  p->nwrite = off;
+  wakeup(&p->nwrite);
+  release(&p->lock);
+  return size;
+}
+
 //PAGEBREAK: 40
 int
 pipewrite(struct pipe *p, char *addr, int n)
 {
-  int i;
+  int i, m;
+  uint off;
 
   acquire(&p->lock);
-  for(i = 0; i < n; i++){
-    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+  for(i = 0; i < n; i += m){
+    while(p->nwrite == p->nread + p->size || p->wsplice){  //DOC: pipewrite-full
       if(p->readopen == 0 || myproc()->killed){
         release(&p->lock);
         return -1;
@@ -90,7 +172,12 @@ pipewrite(struct pipe *p, char *addr, int n)
       wakeup(&p->nread);
       sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
     }
-    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+    // Copy as much as fits before the end of the page.
+    off = p->nwrite & (p->size-1);
+    m = min(n - i, p->nread + p->size - p->nwrite);
+    m = min(m, PGSIZE - off%PGSIZE);
+    memmove(p->page[off/PGSIZE] + off%PGSIZE, addr + i, m);
+    p->nwrite += m;
   }
   wakeup(&p->nread);  //DOC: pipewrite-wakeup1
   release(&p->lock);
@@ -100,22 +187,106 @@ pipewrite(struct pipe *p, char *addr, int n)
 int
 piperead(struct pipe *p, char *addr, int n)
 {
-  int i;
+  int i, m;
+  uint off;
 
   acquire(&p->lock);
-  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+  while((p->nread == p->nwrite && p->writeopen) || p->rsplice){  //DOC: pipe-empty
     if(myproc()->killed){
       release(&p->lock);
       return -1;
     }
     sleep(&p->nread, &p->lock); //DOC: piperead-sleep
   }
-  for(i = 0; i < n; i++){  //DOC: piperead-copy
-    if(p->nread == p->nwrite)
-      break;
-    addr[i] = p->data[p->nread++ % PIPESIZE];
+  for(i = 0; i < n && p->nread != p->nwrite; i += m){  //DOC: piperead-copy
+    off = p->nread & (p->size-1);
+    m = min(n - i, p->nwrite - p->nread);
+    m = min(m, PGSIZE - off%PGSIZE);
+    memmove(addr + i, p->page[off/PGSIZE] + off%PGSIZE, m);
+    p->nread += m;
   }
   wakeup(&p->nwrite);  //DOC: piperead-wakeup
   release(&p->lock);
   return i;
 }
+
+//PAGEBREAK: 40
+// Splicing.  splice() copies straight between a file's buffer
+// cache blocks and the pipe's pages, rather than through a user
+// buffer.  It claims a contiguous run of the ring, which keeps
+// other writers (or readers) out, unlocks the pipe while it
+// copies with readi() or writei(), and then accounts for what
+// it copied.
+
+// Wait for room in p, then claim up to *n bytes of it and
+// return where they start, setting *n to how many were claimed.
+// Returns 0 if the reader has gone away.
+char*
+pipewbegin(struct pipe *p, int *n)
+{
+  uint off;
+
+  acquire(&p->lock);
+  while(p->nwrite == p->nread + p->size || p->wsplice){
+    if(p->readopen == 0 || myproc()->killed){
+      release(&p->lock);
+      return 0;
+    }
+    wakeup(&p->nread);
+    sleep(&p->nwrite, &p->lock);
+  }
+  off = p->nwrite & (p->size-1);
+  *n = min(*n, p->nread + p->size - p->nwrite);
+  *n = min(*n, PGSIZE - off%PGSIZE);
+  p->wsplice = 1;
+  release(&p->lock);
+  return p->page[off/PGSIZE] + off%PGSIZE;
+}
+
+// Finish a pipewbegin(), having written n bytes.
+void
+pipewend(struct pipe *p, int n)
+{
+  acquire(&p->lock);
+  p->nwrite += n;
+  p->wsplice = 0;
+  wakeup(&p->nread);
+  wakeup(&p->nwrite);
+  release(&p->lock);
+}
+
+// Wait for data in p, then claim up to *n bytes of it and
+// return where they start, setting *n to how many were claimed,
+// or to 0 at end of file.  Returns 0 if killed.
+char*
+piperbegin(struct pipe *p, int *n)
+{
+  uint off;
+
+  acquire(&p->lock);
+  while((p->nread == p->nwrite && p->writeopen) || p->rsplice){
+    if(myproc()->killed){
+      release(&p->lock);
+      return 0;
+    }
+    sleep(&p->nread, &p->lock);
+  }
+  off = p->nread & (p->size-1);
+  *n = min(*n, p->nwrite - p->nread);
+  *n = min(*n, PGSIZE - off%PGSIZE);
+  p->rsplice = 1;
+  release(&p->lock);
+  return p->page[off/PGSIZE] + off%PGSIZE;
+}
+
+// Finish a piperbegin(), having read n bytes.
+void
+piperend(struct pipe *p, int n)
+{
+  acquire(&p->lock);
+  p->nread += n;
+  p->rsplice = 0;
+  wakeup(&p->nwrite);
+  wakeup(&p->nread);
+  release(&p->lock);
+}
@@ -0,0 +1,1387 @@
+
+_pipebench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char buf[MAXBUF];
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+  int fd[2], kb, bs, size, n, pid;
+  uint start, total, want;
+
+  size = 0;
+   f:	31 f6                	xor    %esi,%esi
+{
+  11:	53                   	push   %ebx
+  12:	51                   	push   %ecx
+  13:	83 ec 28             	sub    $0x28,%esp
+  16:	8b 39                	mov    (%ecx),%edi
+  18:	8b 51 04             	mov    0x4(%ecx),%edx
+  if(argc > 2 && strcmp(argv[1], "-s") == 0){
+  1b:	83 ff 02             	cmp    $0x2,%edi
+  1e:	0f 8f 47 01 00 00    	jg     16b <main+0x16b>
+    size = atoi(argv[2]);
+    argc -= 2;
+    argv += 2;
+  }
+  kb = argc > 1 ? atoi(argv[1]) : 4096;
+  24:	c7 45 d4 00 10 00 00 	movl   $0x1000,-0x2c(%ebp)
+  bs = argc > 2 ? atoi(argv[2]) : 4096;
+  2b:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  kb = argc > 1 ? atoi(argv[1]) : 4096;
+  30:	83 ff 01             	cmp    $0x1,%edi
+  33:	0f 8f a1 01 00 00    	jg     1da <main+0x1da>
+  if(bs <= 0 || bs > MAXBUF)
+    bs = MAXBUF;
+
+  if(pipe(fd) < 0){
+  39:	83 ec 0c             	sub    $0xc,%esp
+  3c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  3f:	50                   	push   %eax
+  40:	e8 6e 04 00 00       	call   4b3 <pipe>
+  45:	83 c4 10             	add    $0x10,%esp
+  48:	85 c0                	test   %eax,%eax
+  4a:	0f 88 77 01 00 00    	js     1c7 <main+0x1c7>
+    printf(1, "pipebench: pipe failed\n");
+    exit();
+  }
+  if(size && pipesize(fd[1], size) < 0){
+  50:	85 f6                	test   %esi,%esi
+  52:	74 16                	je     6a <main+0x6a>
+  54:	50                   	push   %eax
+  55:	50                   	push   %eax
+  56:	56                   	push   %esi
+  57:	ff 75 e4             	push   -0x1c(%ebp)
+  5a:	e8 ec 04 00 00       	call   54b <pipesize>
+  5f:	83 c4 10             	add    $0x10,%esp
+  62:	85 c0                	test   %eax,%eax
+  64:	0f 88 bb 01 00 00    	js     225 <main+0x225>
+    printf(1, "pipebench: cannot set pipe size %d\n", size);
+    exit();
+  }
+
+  want = kb * 1024;
+  start = uptime();
+  6a:	e8 cc 04 00 00       	call   53b <uptime>
+  6f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  pid = fork();
+  72:	e8 24 04 00 00       	call   49b <fork>
+  if(pid < 0){
+  77:	85 c0                	test   %eax,%eax
+  79:	0f 88 7d 01 00 00    	js     1fc <main+0x1fc>
+  want = kb * 1024;
+  7f:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  82:	c1 e6 0a             	shl    $0xa,%esi
+    printf(1, "pipebench: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+  85:	85 c0                	test   %eax,%eax
+  87:	75 73                	jne    fc <main+0xfc>
+    close(fd[0]);
+  89:	83 ec 0c             	sub    $0xc,%esp
+  8c:	ff 75 e0             	push   -0x20(%ebp)
+  8f:	e8 37 04 00 00       	call   4cb <close>
+    memset(buf, 'x', bs);
+  94:	83 c4 0c             	add    $0xc,%esp
+  97:	53                   	push   %ebx
+  98:	6a 78                	push   $0x78
+  9a:	68 20 0d 00 00       	push   $0xd20
+  9f:	e8 7c 02 00 00       	call   320 <memset>
+    for(total = 0; total < want; total += n){
+  a4:	83 c4 10             	add    $0x10,%esp
+  a7:	85 f6                	test   %esi,%esi
+  a9:	0f 84 b7 00 00 00    	je     166 <main+0x166>
+  af:	31 d2                	xor    %edx,%edx
+  b1:	eb 0f                	jmp    c2 <main+0xc2>
+  b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  b7:	90                   	nop
+  b8:	01 c2                	add    %eax,%edx
+  ba:	39 f2                	cmp    %esi,%edx
+  bc:	0f 83 a4 00 00 00    	jae    166 <main+0x166>
+      n = want - total < bs ? want - total : bs;
+  c2:	89 f7                	mov    %esi,%edi
+  c4:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  c7:	29 d7                	sub    %edx,%edi
+  c9:	39 df                	cmp    %ebx,%edi
+  cb:	0f 47 fb             	cmova  %ebx,%edi
+      if(write(fd[1], buf, n) != n){
+  ce:	83 ec 04             	sub    $0x4,%esp
+  d1:	57                   	push   %edi
+  d2:	68 20 0d 00 00       	push   $0xd20
+  d7:	ff 75 e4             	push   -0x1c(%ebp)
+  da:	e8 e4 03 00 00       	call   4c3 <write>
+  df:	83 c4 10             	add    $0x10,%esp
+  e2:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  e5:	39 f8                	cmp    %edi,%eax
+  e7:	74 cf                	je     b8 <main+0xb8>
+        printf(1, "pipebench: write failed\n");
+  e9:	53                   	push   %ebx
+  ea:	53                   	push   %ebx
+  eb:	68 6b 09 00 00       	push   $0x96b
+  f0:	6a 01                	push   $0x1
+  f2:	e8 19 05 00 00       	call   610 <printf>
+        exit();
+  f7:	e8 a7 03 00 00       	call   4a3 <exit>
+      }
+    }
+    exit();
+  }
+
+  close(fd[1]);
+  fc:	83 ec 0c             	sub    $0xc,%esp
+  ff:	ff 75 e4             	push   -0x1c(%ebp)
+  total = 0;
+ 102:	31 ff                	xor    %edi,%edi
+  close(fd[1]);
+ 104:	e8 c2 03 00 00       	call   4cb <close>
+  while((n = read(fd[0], buf, bs)) > 0)
+ 109:	83 c4 10             	add    $0x10,%esp
+ 10c:	eb 04                	jmp    112 <main+0x112>
+ 10e:	66 90                	xchg   %ax,%ax
+    total += n;
+ 110:	01 c7                	add    %eax,%edi
+  while((n = read(fd[0], buf, bs)) > 0)
+ 112:	83 ec 04             	sub    $0x4,%esp
+ 115:	53                   	push   %ebx
+ 116:	68 20 0d 00 00       	push   $0xd20
+ 11b:	ff 75 e0             	push   -0x20(%ebp)
+ 11e:	e8 98 03 00 00       	call   4bb <read>
+ 123:	83 c4 10             	add    $0x10,%esp
+ 126:	85 c0                	test   %eax,%eax
+ 128:	7f e6                	jg     110 <main+0x110>
+  wait();
+ 12a:	e8 7c 03 00 00       	call   4ab <wait>
+  if(total != want)
+ 12f:	39 f7                	cmp    %esi,%edi
+ 131:	0f 85 d8 00 00 00    	jne    20f <main+0x20f>
+    printf(1, "pipebench: read %d bytes, wanted %d\n", total, want);
+  printf(1, "pipebench: %d KB in %d byte writes, pipe size %d: %d ticks\n",
+         kb, bs, pipesize(fd[0], 0), uptime() - start);
+ 137:	e8 ff 03 00 00       	call   53b <uptime>
+  printf(1, "pipebench: %d KB in %d byte writes, pipe size %d: %d ticks\n",
+ 13c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+ 13f:	29 c8                	sub    %ecx,%eax
+ 141:	89 c6                	mov    %eax,%esi
+ 143:	50                   	push   %eax
+ 144:	50                   	push   %eax
+ 145:	6a 00                	push   $0x0
+ 147:	ff 75 e0             	push   -0x20(%ebp)
+ 14a:	e8 fc 03 00 00       	call   54b <pipesize>
+ 14f:	5a                   	pop    %edx
+ 150:	59                   	pop    %ecx
+ 151:	56                   	push   %esi
+ 152:	50                   	push   %eax
+ 153:	53                   	push   %ebx
+ 154:	ff 75 d4             	push   -0x2c(%ebp)
+ 157:	68 d0 09 00 00       	push   $0x9d0
+ 15c:	6a 01                	push   $0x1
+ 15e:	e8 ad 04 00 00       	call   610 <printf>
+  exit();
+ 163:	83 c4 20             	add    $0x20,%esp
+ 166:	e8 38 03 00 00       	call   4a3 <exit>
+  if(argc > 2 && strcmp(argv[1], "-s") == 0){
+ 16b:	50                   	push   %eax
+ 16c:	50                   	push   %eax
+ 16d:	68 38 09 00 00       	push   $0x938
+ 172:	ff 72 04             	push   0x4(%edx)
+ 175:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 178:	e8 13 01 00 00       	call   290 <strcmp>
+ 17d:	83 c4 10             	add    $0x10,%esp
+ 180:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 183:	85 c0                	test   %eax,%eax
+ 185:	0f 84 ad 00 00 00    	je     238 <main+0x238>
+  kb = argc > 1 ? atoi(argv[1]) : 4096;
+ 18b:	83 ec 0c             	sub    $0xc,%esp
+ 18e:	ff 72 04             	push   0x4(%edx)
+ 191:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 194:	e8 97 02 00 00       	call   430 <atoi>
+ 199:	8b 55 d0             	mov    -0x30(%ebp),%edx
+ 19c:	83 c4 10             	add    $0x10,%esp
+ 19f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  bs = argc > 2 ? atoi(argv[2]) : 4096;
+ 1a2:	83 ec 0c             	sub    $0xc,%esp
+ 1a5:	ff 72 08             	push   0x8(%edx)
+ 1a8:	e8 83 02 00 00       	call   430 <atoi>
+  if(bs <= 0 || bs > MAXBUF)
+ 1ad:	83 c4 10             	add    $0x10,%esp
+  bs = argc > 2 ? atoi(argv[2]) : 4096;
+ 1b0:	89 c3                	mov    %eax,%ebx
+  if(bs <= 0 || bs > MAXBUF)
+ 1b2:	8d 40 ff             	lea    -0x1(%eax),%eax
+    bs = MAXBUF;
+ 1b5:	3d 00 40 00 00       	cmp    $0x4000,%eax
+ 1ba:	b8 00 40 00 00       	mov    $0x4000,%eax
+ 1bf:	0f 43 d8             	cmovae %eax,%ebx
+ 1c2:	e9 72 fe ff ff       	jmp    39 <main+0x39>
+    printf(1, "pipebench: pipe failed\n");
+ 1c7:	50                   	push   %eax
+ 1c8:	50                   	push   %eax
+ 1c9:	68 3b 09 00 00       	push   $0x93b
+ 1ce:	6a 01                	push   $0x1
+ 1d0:	e8 3b 04 00 00       	call   610 <printf>
+    exit();
+ 1d5:	e8 c9 02 00 00       	call   4a3 <exit>
+  kb = argc > 1 ? atoi(argv[1]) : 4096;
+ 1da:	83 ec 0c             	sub    $0xc,%esp
+ 1dd:	ff 72 04             	push   0x4(%edx)
+ 1e0:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 1e3:	e8 48 02 00 00       	call   430 <atoi>
+  bs = argc > 2 ? atoi(argv[2]) : 4096;
+ 1e8:	83 c4 10             	add    $0x10,%esp
+ 1eb:	83 ff 02             	cmp    $0x2,%edi
+ 1ee:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  kb = argc > 1 ? atoi(argv[1]) : 4096;
+ 1f1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  bs = argc > 2 ? atoi(argv[2]) : 4096;
+ 1f4:	0f 84 3f fe ff ff    	je     39 <main+0x39>
+ 1fa:	eb a6                	jmp    1a2 <main+0x1a2>
+    printf(1, "pipebench: fork failed\n");
+ 1fc:	56                   	push   %esi
+ 1fd:	56                   	push   %esi
+ 1fe:	68 53 09 00 00       	push   $0x953
+ 203:	6a 01                	push   $0x1
+ 205:	e8 06 04 00 00       	call   610 <printf>
+    exit();
+ 20a:	e8 94 02 00 00       	call   4a3 <exit>
+    printf(1, "pipebench: read %d bytes, wanted %d\n", total, want);
+ 20f:	56                   	push   %esi
+ 210:	57                   	push   %edi
+ 211:	68 a8 09 00 00       	push   $0x9a8
+ 216:	6a 01                	push   $0x1
+ 218:	e8 f3 03 00 00       	call   610 <printf>
+ 21d:	83 c4 10             	add    $0x10,%esp
+ 220:	e9 12 ff ff ff       	jmp    137 <main+0x137>
+    printf(1, "pipebench: cannot set pipe size %d\n", size);
+ 225:	57                   	push   %edi
+ 226:	56                   	push   %esi
+ 227:	68 84 09 00 00       	push   $0x984
+ 22c:	6a 01                	push   $0x1
+ 22e:	e8 dd 03 00 00       	call   610 <printf>
+    exit();
+ 233:	e8 6b 02 00 00       	call   4a3 <exit>
+    size = atoi(argv[2]);
+ 238:	83 ec 0c             	sub    $0xc,%esp
+ 23b:	ff 72 08             	push   0x8(%edx)
+    argc -= 2;
+ 23e:	83 ef 02             	sub    $0x2,%edi
+    size = atoi(argv[2]);
+ 241:	e8 ea 01 00 00       	call   430 <atoi>
+    argv += 2;
+ 246:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 249:	83 c4 10             	add    $0x10,%esp
+    size = atoi(argv[2]);
+ 24c:	89 c6                	mov    %eax,%esi
+    argv += 2;
+ 24e:	83 c2 08             	add    $0x8,%edx
+ 251:	e9 ce fd ff ff       	jmp    24 <main+0x24>
+ 256:	66 90                	xchg   %ax,%ax
+ 258:	66 90                	xchg   %ax,%ax
+ 25a:	66 90                	xchg   %ax,%ax
+ 25c:	66 90                	xchg   %ax,%ax
+ 25e:	66 90                	xchg   %ax,%ax
+
+00000260 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 260:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 261:	31 c0                	xor    %eax,%eax
+{
+ 263:	89 e5                	mov    %esp,%ebp
+ 265:	53                   	push   %ebx
+ 266:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 269:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 26c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 270:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 274:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 277:	83 c0 01             	add    $0x1,%eax
+ 27a:	84 d2                	test   %dl,%dl
+ 27c:	75 f2                	jne    270 <strcpy+0x10>
+    ;
+  return os;
+}
+ 27e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 281:	89 c8                	mov    %ecx,%eax
+ 283:	c9                   	leave
+ 284:	c3                   	ret
+ 285:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	53                   	push   %ebx
+ 294:	8b 55 08             	mov    0x8(%ebp),%edx
+ 297:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 29a:	0f b6 02             	movzbl (%edx),%eax
+ 29d:	84 c0                	test   %al,%al
+ 29f:	75 17                	jne    2b8 <strcmp+0x28>
+ 2a1:	eb 3a                	jmp    2dd <strcmp+0x4d>
+ 2a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2a7:	90                   	nop
+ 2a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2ac:	83 c2 01             	add    $0x1,%edx
+ 2af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2b2:	84 c0                	test   %al,%al
+ 2b4:	74 1a                	je     2d0 <strcmp+0x40>
+    p++, q++;
+ 2b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2b8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2bb:	38 c3                	cmp    %al,%bl
+ 2bd:	74 e9                	je     2a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2bf:	29 d8                	sub    %ebx,%eax
+}
+ 2c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2c4:	c9                   	leave
+ 2c5:	c3                   	ret
+ 2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2d4:	31 c0                	xor    %eax,%eax
+ 2d6:	29 d8                	sub    %ebx,%eax
+}
+ 2d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2db:	c9                   	leave
+ 2dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2dd:	0f b6 19             	movzbl (%ecx),%ebx
+ 2e0:	31 c0                	xor    %eax,%eax
+ 2e2:	eb db                	jmp    2bf <strcmp+0x2f>
+ 2e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+
+000002f0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2f6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2f9:	74 15                	je     310 <strlen+0x20>
+ 2fb:	31 c0                	xor    %eax,%eax
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 300:	83 c0 01             	add    $0x1,%eax
+ 303:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 307:	89 c1                	mov    %eax,%ecx
+ 309:	75 f5                	jne    300 <strlen+0x10>
+    ;
+  return n;
+}
+ 30b:	89 c8                	mov    %ecx,%eax
+ 30d:	5d                   	pop    %ebp
+ 30e:	c3                   	ret
+ 30f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 310:	31 c9                	xor    %ecx,%ecx
+}
+ 312:	5d                   	pop    %ebp
+ 313:	89 c8                	mov    %ecx,%eax
+ 315:	c3                   	ret
+ 316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000320 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	57                   	push   %edi
+ 324:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 327:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 32a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 32d:	89 d7                	mov    %edx,%edi
+ 32f:	fc                   	cld
+ 330:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 332:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 335:	89 d0                	mov    %edx,%eax
+ 337:	c9                   	leave
+ 338:	c3                   	ret
+ 339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000340 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	8b 45 08             	mov    0x8(%ebp),%eax
+ 346:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 34a:	0f b6 10             	movzbl (%eax),%edx
+ 34d:	84 d2                	test   %dl,%dl
+ 34f:	75 12                	jne    363 <strchr+0x23>
+ 351:	eb 1d                	jmp    370 <strchr+0x30>
+ 353:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 357:	90                   	nop
+ 358:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 35c:	83 c0 01             	add    $0x1,%eax
+ 35f:	84 d2                	test   %dl,%dl
+ 361:	74 0d                	je     370 <strchr+0x30>
+    if(*s == c)
+ 363:	38 d1                	cmp    %dl,%cl
+ 365:	75 f1                	jne    358 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 367:	5d                   	pop    %ebp
+ 368:	c3                   	ret
+ 369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 370:	31 c0                	xor    %eax,%eax
+}
+ 372:	5d                   	pop    %ebp
+ 373:	c3                   	ret
+ 374:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 37f:	90                   	nop
+
+00000380 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	57                   	push   %edi
+ 384:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 385:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 388:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 389:	31 db                	xor    %ebx,%ebx
+{
+ 38b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 38e:	eb 27                	jmp    3b7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 390:	83 ec 04             	sub    $0x4,%esp
+ 393:	6a 01                	push   $0x1
+ 395:	56                   	push   %esi
+ 396:	6a 00                	push   $0x0
+ 398:	e8 1e 01 00 00       	call   4bb <read>
+    if(cc < 1)
+ 39d:	83 c4 10             	add    $0x10,%esp
+ 3a0:	85 c0                	test   %eax,%eax
+ 3a2:	7e 1d                	jle    3c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 3a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 3af:	3c 0a                	cmp    $0xa,%al
+ 3b1:	74 10                	je     3c3 <gets+0x43>
+ 3b3:	3c 0d                	cmp    $0xd,%al
+ 3b5:	74 0c                	je     3c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 3b7:	89 df                	mov    %ebx,%edi
+ 3b9:	83 c3 01             	add    $0x1,%ebx
+ 3bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3bf:	7c cf                	jl     390 <gets+0x10>
+ 3c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 3c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 3ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3cd:	5b                   	pop    %ebx
+ 3ce:	5e                   	pop    %esi
+ 3cf:	5f                   	pop    %edi
+ 3d0:	5d                   	pop    %ebp
+ 3d1:	c3                   	ret
+ 3d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	56                   	push   %esi
+ 3e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3e5:	83 ec 08             	sub    $0x8,%esp
+ 3e8:	6a 00                	push   $0x0
+ 3ea:	ff 75 08             	push   0x8(%ebp)
+ 3ed:	e8 f1 00 00 00       	call   4e3 <open>
+  if(fd < 0)
+ 3f2:	83 c4 10             	add    $0x10,%esp
+ 3f5:	85 c0                	test   %eax,%eax
+ 3f7:	78 27                	js     420 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3f9:	83 ec 08             	sub    $0x8,%esp
+ 3fc:	ff 75 0c             	push   0xc(%ebp)
+ 3ff:	89 c3                	mov    %eax,%ebx
+ 401:	50                   	push   %eax
+ 402:	e8 f4 00 00 00       	call   4fb <fstat>
+  close(fd);
+ 407:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 40a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 40c:	e8 ba 00 00 00       	call   4cb <close>
+  return r;
+ 411:	83 c4 10             	add    $0x10,%esp
+}
+ 414:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 417:	89 f0                	mov    %esi,%eax
+ 419:	5b                   	pop    %ebx
+ 41a:	5e                   	pop    %esi
+ 41b:	5d                   	pop    %ebp
+ 41c:	c3                   	ret
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 420:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 425:	eb ed                	jmp    414 <stat+0x34>
+ 427:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42e:	66 90                	xchg   %ax,%ax
+
+00000430 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	53                   	push   %ebx
+ 434:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 437:	0f be 02             	movsbl (%edx),%eax
+ 43a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 43d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 440:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 445:	77 1e                	ja     465 <atoi+0x35>
+ 447:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 450:	83 c2 01             	add    $0x1,%edx
+ 453:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 456:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 45a:	0f be 02             	movsbl (%edx),%eax
+ 45d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 460:	80 fb 09             	cmp    $0x9,%bl
+ 463:	76 eb                	jbe    450 <atoi+0x20>
+  return n;
+}
+ 465:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 468:	89 c8                	mov    %ecx,%eax
+ 46a:	c9                   	leave
+ 46b:	c3                   	ret
+ 46c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000470 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	56                   	push   %esi
+ 475:	8b 45 10             	mov    0x10(%ebp),%eax
+ 478:	8b 55 08             	mov    0x8(%ebp),%edx
+ 47b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 47e:	85 c0                	test   %eax,%eax
+ 480:	7e 13                	jle    495 <memmove+0x25>
+ 482:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 484:	89 d7                	mov    %edx,%edi
+ 486:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 490:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 491:	39 f8                	cmp    %edi,%eax
+ 493:	75 fb                	jne    490 <memmove+0x20>
+  return vdst;
+}
+ 495:	5e                   	pop    %esi
+ 496:	89 d0                	mov    %edx,%eax
+ 498:	5f                   	pop    %edi
+ 499:	5d                   	pop    %ebp
+ 49a:	c3                   	ret
+
+0000049b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 49b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <exit>:
+SYSCALL(exit)
+ 4a3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <wait>:
+SYSCALL(wait)
+ 4ab:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <pipe>:
+SYSCALL(pipe)
+ 4b3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <read>:
+SYSCALL(read)
+ 4bb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <write>:
+SYSCALL(write)
+ 4c3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <close>:
+SYSCALL(close)
+ 4cb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <kill>:
+SYSCALL(kill)
+ 4d3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <exec>:
+SYSCALL(exec)
+ 4db:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <open>:
+SYSCALL(open)
+ 4e3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <mknod>:
+SYSCALL(mknod)
+ 4eb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <unlink>:
+SYSCALL(unlink)
+ 4f3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <fstat>:
+SYSCALL(fstat)
+ 4fb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <link>:
+SYSCALL(link)
+ 503:	b8 13 00 00 00       	mov    $0x13,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <mkdir>:
+SYSCALL(mkdir)
+ 50b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <chdir>:
+SYSCALL(chdir)
+ 513:	b8 09 00 00 00       	mov    $0x9,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <dup>:
+SYSCALL(dup)
+ 51b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <getpid>:
+SYSCALL(getpid)
+ 523:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <sbrk>:
+SYSCALL(sbrk)
+ 52b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <sleep>:
+SYSCALL(sleep)
+ 533:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <uptime>:
+SYSCALL(uptime)
+ 53b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <getpstat>:
+SYSCALL(getpstat)
+ 543:	b8 16 00 00 00       	mov    $0x16,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <pipesize>:
+SYSCALL(pipesize)
+ 54b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <splice>:
+SYSCALL(splice)
+ 553:	b8 18 00 00 00       	mov    $0x18,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <copyrange>:
+SYSCALL(copyrange)
+ 55b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+ 563:	66 90                	xchg   %ax,%ax
+ 565:	66 90                	xchg   %ax,%ax
+ 567:	66 90                	xchg   %ax,%ax
+ 569:	66 90                	xchg   %ax,%ax
+ 56b:	66 90                	xchg   %ax,%ax
+ 56d:	66 90                	xchg   %ax,%ax
+ 56f:	90                   	nop
+
+00000570 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	57                   	push   %edi
+ 574:	56                   	push   %esi
+ 575:	53                   	push   %ebx
+ 576:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 578:	89 d1                	mov    %edx,%ecx
+{
+ 57a:	83 ec 3c             	sub    $0x3c,%esp
+ 57d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 580:	85 d2                	test   %edx,%edx
+ 582:	0f 89 80 00 00 00    	jns    608 <printint+0x98>
+ 588:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 58c:	74 7a                	je     608 <printint+0x98>
+    x = -xx;
+ 58e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 590:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 595:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 598:	31 f6                	xor    %esi,%esi
+ 59a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5a0:	89 c8                	mov    %ecx,%eax
+ 5a2:	31 d2                	xor    %edx,%edx
+ 5a4:	89 f7                	mov    %esi,%edi
+ 5a6:	f7 f3                	div    %ebx
+ 5a8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5ab:	0f b6 92 6c 0a 00 00 	movzbl 0xa6c(%edx),%edx
+ 5b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5b6:	89 ca                	mov    %ecx,%edx
+ 5b8:	89 c1                	mov    %eax,%ecx
+ 5ba:	39 da                	cmp    %ebx,%edx
+ 5bc:	73 e2                	jae    5a0 <printint+0x30>
+  if(neg)
+ 5be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5c1:	85 c0                	test   %eax,%eax
+ 5c3:	74 07                	je     5cc <printint+0x5c>
+    buf[i++] = '-';
+ 5c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5ca:	89 f7                	mov    %esi,%edi
+ 5cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5d2:	01 df                	add    %ebx,%edi
+ 5d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5db:	83 ec 04             	sub    $0x4,%esp
+ 5de:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5e4:	6a 01                	push   $0x1
+ 5e6:	50                   	push   %eax
+ 5e7:	56                   	push   %esi
+ 5e8:	e8 d6 fe ff ff       	call   4c3 <write>
+  while(--i >= 0)
+ 5ed:	89 f8                	mov    %edi,%eax
+ 5ef:	83 c4 10             	add    $0x10,%esp
+ 5f2:	83 ef 01             	sub    $0x1,%edi
+ 5f5:	39 d8                	cmp    %ebx,%eax
+ 5f7:	75 df                	jne    5d8 <printint+0x68>
+}
+ 5f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5fc:	5b                   	pop    %ebx
+ 5fd:	5e                   	pop    %esi
+ 5fe:	5f                   	pop    %edi
+ 5ff:	5d                   	pop    %ebp
+ 600:	c3                   	ret
+ 601:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 608:	31 c0                	xor    %eax,%eax
+ 60a:	eb 89                	jmp    595 <printint+0x25>
+ 60c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000610 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	57                   	push   %edi
+ 614:	56                   	push   %esi
+ 615:	53                   	push   %ebx
+ 616:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 619:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 61c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 61f:	0f b6 1e             	movzbl (%esi),%ebx
+ 622:	83 c6 01             	add    $0x1,%esi
+ 625:	84 db                	test   %bl,%bl
+ 627:	74 67                	je     690 <printf+0x80>
+ 629:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 62c:	31 d2                	xor    %edx,%edx
+ 62e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 631:	eb 34                	jmp    667 <printf+0x57>
+ 633:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 637:	90                   	nop
+ 638:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 63b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 640:	83 f8 25             	cmp    $0x25,%eax
+ 643:	74 18                	je     65d <printf+0x4d>
+  write(fd, &c, 1);
+ 645:	83 ec 04             	sub    $0x4,%esp
+ 648:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 64b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 64e:	6a 01                	push   $0x1
+ 650:	50                   	push   %eax
+ 651:	57                   	push   %edi
+ 652:	e8 6c fe ff ff       	call   4c3 <write>
+ 657:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 65a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 65d:	0f b6 1e             	movzbl (%esi),%ebx
+ 660:	83 c6 01             	add    $0x1,%esi
+ 663:	84 db                	test   %bl,%bl
+ 665:	74 29                	je     690 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 667:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 66a:	85 d2                	test   %edx,%edx
+ 66c:	74 ca                	je     638 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 66e:	83 fa 25             	cmp    $0x25,%edx
+ 671:	75 ea                	jne    65d <printf+0x4d>
+      if(c == 'd'){
+ 673:	83 f8 25             	cmp    $0x25,%eax
+ 676:	0f 84 24 01 00 00    	je     7a0 <printf+0x190>
+ 67c:	83 e8 63             	sub    $0x63,%eax
+ 67f:	83 f8 15             	cmp    $0x15,%eax
+ 682:	77 1c                	ja     6a0 <printf+0x90>
+ 684:	ff 24 85 14 0a 00 00 	jmp    *0xa14(,%eax,4)
+ 68b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 68f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 690:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 693:	5b                   	pop    %ebx
+ 694:	5e                   	pop    %esi
+ 695:	5f                   	pop    %edi
+ 696:	5d                   	pop    %ebp
+ 697:	c3                   	ret
+ 698:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 69f:	90                   	nop
+  write(fd, &c, 1);
+ 6a0:	83 ec 04             	sub    $0x4,%esp
+ 6a3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6a6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6aa:	6a 01                	push   $0x1
+ 6ac:	52                   	push   %edx
+ 6ad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6b0:	57                   	push   %edi
+ 6b1:	e8 0d fe ff ff       	call   4c3 <write>
+ 6b6:	83 c4 0c             	add    $0xc,%esp
+ 6b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6bc:	6a 01                	push   $0x1
+ 6be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6c1:	52                   	push   %edx
+ 6c2:	57                   	push   %edi
+ 6c3:	e8 fb fd ff ff       	call   4c3 <write>
+        putc(fd, c);
+ 6c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6cb:	31 d2                	xor    %edx,%edx
+ 6cd:	eb 8e                	jmp    65d <printf+0x4d>
+ 6cf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6d3:	83 ec 0c             	sub    $0xc,%esp
+ 6d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6db:	8b 13                	mov    (%ebx),%edx
+ 6dd:	6a 00                	push   $0x0
+ 6df:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6e1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6e4:	e8 87 fe ff ff       	call   570 <printint>
+        ap++;
+ 6e9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6ef:	31 d2                	xor    %edx,%edx
+ 6f1:	e9 67 ff ff ff       	jmp    65d <printf+0x4d>
+ 6f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 700:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 703:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 705:	83 c0 04             	add    $0x4,%eax
+ 708:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 70b:	85 db                	test   %ebx,%ebx
+ 70d:	0f 84 9d 00 00 00    	je     7b0 <printf+0x1a0>
+        while(*s != 0){
+ 713:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 716:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 718:	84 c0                	test   %al,%al
+ 71a:	0f 84 3d ff ff ff    	je     65d <printf+0x4d>
+ 720:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 723:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 726:	89 de                	mov    %ebx,%esi
+ 728:	89 d3                	mov    %edx,%ebx
+ 72a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 730:	83 ec 04             	sub    $0x4,%esp
+ 733:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 736:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 739:	6a 01                	push   $0x1
+ 73b:	53                   	push   %ebx
+ 73c:	57                   	push   %edi
+ 73d:	e8 81 fd ff ff       	call   4c3 <write>
+        while(*s != 0){
+ 742:	0f b6 06             	movzbl (%esi),%eax
+ 745:	83 c4 10             	add    $0x10,%esp
+ 748:	84 c0                	test   %al,%al
+ 74a:	75 e4                	jne    730 <printf+0x120>
+      state = 0;
+ 74c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 74f:	31 d2                	xor    %edx,%edx
+ 751:	e9 07 ff ff ff       	jmp    65d <printf+0x4d>
+ 756:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 75d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 760:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 763:	83 ec 0c             	sub    $0xc,%esp
+ 766:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 76b:	8b 13                	mov    (%ebx),%edx
+ 76d:	6a 01                	push   $0x1
+ 76f:	e9 6b ff ff ff       	jmp    6df <printf+0xcf>
+ 774:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 778:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 77b:	83 ec 04             	sub    $0x4,%esp
+ 77e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 781:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 783:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 786:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 789:	6a 01                	push   $0x1
+ 78b:	52                   	push   %edx
+ 78c:	57                   	push   %edi
+ 78d:	e8 31 fd ff ff       	call   4c3 <write>
+        ap++;
+ 792:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 795:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 798:	31 d2                	xor    %edx,%edx
+ 79a:	e9 be fe ff ff       	jmp    65d <printf+0x4d>
+ 79f:	90                   	nop
+  write(fd, &c, 1);
+ 7a0:	83 ec 04             	sub    $0x4,%esp
+ 7a3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7a6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7a9:	6a 01                	push   $0x1
+ 7ab:	e9 11 ff ff ff       	jmp    6c1 <printf+0xb1>
+ 7b0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7b5:	bb 0c 0a 00 00       	mov    $0xa0c,%ebx
+ 7ba:	e9 61 ff ff ff       	jmp    720 <printf+0x110>
+ 7bf:	90                   	nop
+
+000007c0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7c0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7c1:	a1 20 4d 00 00       	mov    0x4d20,%eax
+{
+ 7c6:	89 e5                	mov    %esp,%ebp
+ 7c8:	57                   	push   %edi
+ 7c9:	56                   	push   %esi
+ 7ca:	53                   	push   %ebx
+ 7cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 7ce:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7d8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7da:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7dc:	39 ca                	cmp    %ecx,%edx
+ 7de:	73 30                	jae    810 <free+0x50>
+ 7e0:	39 c1                	cmp    %eax,%ecx
+ 7e2:	72 04                	jb     7e8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7e4:	39 c2                	cmp    %eax,%edx
+ 7e6:	72 f0                	jb     7d8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7e8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7eb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7ee:	39 f8                	cmp    %edi,%eax
+ 7f0:	74 2e                	je     820 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7f2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7f5:	8b 42 04             	mov    0x4(%edx),%eax
+ 7f8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7fb:	39 f1                	cmp    %esi,%ecx
+ 7fd:	74 38                	je     837 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7ff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 801:	5b                   	pop    %ebx
+  freep = p;
+ 802:	89 15 20 4d 00 00    	mov    %edx,0x4d20
+}
+ 808:	5e                   	pop    %esi
+ 809:	5f                   	pop    %edi
+ 80a:	5d                   	pop    %ebp
+ 80b:	c3                   	ret
+ 80c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 810:	39 c1                	cmp    %eax,%ecx
+ 812:	72 d0                	jb     7e4 <free+0x24>
+ 814:	eb c2                	jmp    7d8 <free+0x18>
+ 816:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 81d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 820:	03 70 04             	add    0x4(%eax),%esi
+ 823:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 826:	8b 02                	mov    (%edx),%eax
+ 828:	8b 00                	mov    (%eax),%eax
+ 82a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 82d:	8b 42 04             	mov    0x4(%edx),%eax
+ 830:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 833:	39 f1                	cmp    %esi,%ecx
+ 835:	75 c8                	jne    7ff <free+0x3f>
+    p->s.size += bp->s.size;
+ 837:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 83a:	89 15 20 4d 00 00    	mov    %edx,0x4d20
+    p->s.size += bp->s.size;
+ 840:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 843:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 846:	89 0a                	mov    %ecx,(%edx)
+}
+ 848:	5b                   	pop    %ebx
+ 849:	5e                   	pop    %esi
+ 84a:	5f                   	pop    %edi
+ 84b:	5d                   	pop    %ebp
+ 84c:	c3                   	ret
+ 84d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000850 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 850:	55                   	push   %ebp
+ 851:	89 e5                	mov    %esp,%ebp
+ 853:	57                   	push   %edi
+ 854:	56                   	push   %esi
+ 855:	53                   	push   %ebx
+ 856:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 859:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 85c:	8b 15 20 4d 00 00    	mov    0x4d20,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 862:	8d 78 07             	lea    0x7(%eax),%edi
+ 865:	c1 ef 03             	shr    $0x3,%edi
+ 868:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 86b:	85 d2                	test   %edx,%edx
+ 86d:	0f 84 8d 00 00 00    	je     900 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 873:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 875:	8b 48 04             	mov    0x4(%eax),%ecx
+ 878:	39 f9                	cmp    %edi,%ecx
+ 87a:	73 64                	jae    8e0 <malloc+0x90>
+  if(nu < 4096)
+ 87c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 881:	39 df                	cmp    %ebx,%edi
+ 883:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 886:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 88d:	eb 0a                	jmp    899 <malloc+0x49>
+ 88f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 890:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 892:	8b 48 04             	mov    0x4(%eax),%ecx
+ 895:	39 f9                	cmp    %edi,%ecx
+ 897:	73 47                	jae    8e0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 899:	89 c2                	mov    %eax,%edx
+ 89b:	39 05 20 4d 00 00    	cmp    %eax,0x4d20
+ 8a1:	75 ed                	jne    890 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 8a3:	83 ec 0c             	sub    $0xc,%esp
+ 8a6:	56                   	push   %esi
+ 8a7:	e8 7f fc ff ff       	call   52b <sbrk>
+  if(p == (char*)-1)
+ 8ac:	83 c4 10             	add    $0x10,%esp
+ 8af:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8b2:	74 1c                	je     8d0 <malloc+0x80>
+  hp->s.size = nu;
+ 8b4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8b7:	83 ec 0c             	sub    $0xc,%esp
+ 8ba:	83 c0 08             	add    $0x8,%eax
+ 8bd:	50                   	push   %eax
+ 8be:	e8 fd fe ff ff       	call   7c0 <free>
+  return freep;
+ 8c3:	8b 15 20 4d 00 00    	mov    0x4d20,%edx
+      if((p = morecore(nunits)) == 0)
+ 8c9:	83 c4 10             	add    $0x10,%esp
+ 8cc:	85 d2                	test   %edx,%edx
+ 8ce:	75 c0                	jne    890 <malloc+0x40>
+        return 0;
+  }
+}
+ 8d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 8d3:	31 c0                	xor    %eax,%eax
+}
+ 8d5:	5b                   	pop    %ebx
+ 8d6:	5e                   	pop    %esi
+ 8d7:	5f                   	pop    %edi
+ 8d8:	5d                   	pop    %ebp
+ 8d9:	c3                   	ret
+ 8da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 8e0:	39 cf                	cmp    %ecx,%edi
+ 8e2:	74 4c                	je     930 <malloc+0xe0>
+        p->s.size -= nunits;
+ 8e4:	29 f9                	sub    %edi,%ecx
+ 8e6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 8e9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 8ec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 8ef:	89 15 20 4d 00 00    	mov    %edx,0x4d20
+}
+ 8f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 8f8:	83 c0 08             	add    $0x8,%eax
+}
+ 8fb:	5b                   	pop    %ebx
+ 8fc:	5e                   	pop    %esi
+ 8fd:	5f                   	pop    %edi
+ 8fe:	5d                   	pop    %ebp
+ 8ff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 900:	c7 05 20 4d 00 00 24 	movl   $0x4d24,0x4d20
+ 907:	4d 00 00 
+    base.s.size = 0;
+ 90a:	b8 24 4d 00 00       	mov    $0x4d24,%eax
+    base.s.ptr = freep = prevp = &base;
+ 90f:	c7 05 24 4d 00 00 24 	movl   $0x4d24,0x4d24
+ 916:	4d 00 00 
+    base.s.size = 0;
+ 919:	c7 05 28 4d 00 00 00 	movl   $0x0,0x4d28
+ 920:	00 00 00 
+    if(p->s.size >= nunits){
+ 923:	e9 54 ff ff ff       	jmp    87c <malloc+0x2c>
+ 928:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 92f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 930:	8b 08                	mov    (%eax),%ecx
+ 932:	89 0a                	mov    %ecx,(%edx)
+ 934:	eb b9                	jmp    8ef <malloc+0x9f>
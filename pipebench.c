@@ -0,0 +1,71 @@
+// Measure pipe throughput.  pipebench [-s size] [kbytes [bufsize]]
+// has a child write kbytes (default 4096) KB into a pipe in
+// bufsize (default 4096) byte writes, like dd, while the parent
+// reads it back, and prints the ticks taken.  With -s the pipe's
+// capacity is set to size bytes first.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define MAXBUF 16384
+
+char buf[MAXBUF];
+
+int
+main(int argc, char *argv[])
+{
+  int fd[2], kb, bs, size, n, pid;
+  uint start, total, want;
+
+  size = 0;
+  if(argc > 2 && strcmp(argv[1], "-s") == 0){
+    size = atoi(argv[2]);
+    argc -= 2;
+    argv += 2;
+  }
+  kb = argc > 1 ? atoi(argv[1]) : 4096;
+  bs = argc > 2 ? atoi(argv[2]) : 4096;
+  if(bs <= 0 || bs > MAXBUF)
+    bs = MAXBUF;
+
+  if(pipe(fd) < 0){
+    printf(1, "pipebench: pipe failed\n");
+    exit();
+  }
+  if(size && pipesize(fd[1], size) < 0){
+    printf(1, "pipebench: cannot set pipe size %d\n", size);
+    exit();
+  }
+
+  want = kb * 1024;
+  start = uptime();
+  pid = fork();
+  if(pid < 0){
+    printf(1, "pipebench: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    close(fd[0]);
+    memset(buf, 'x', bs);
+    for(total = 0; total < want; total += n){
+      n = want - total < bs ? want - total : bs;
+      if(write(fd[1], buf, n) != n){
+        printf(1, "pipebench: write failed\n");
+        exit();
+      }
+    }
+    exit();
+  }
+
+  close(fd[1]);
+  total = 0;
+  while((n = read(fd[0], buf, bs)) > 0)
+    total += n;
+  wait();
+  if(total != want)
+    printf(1, "pipebench: read %d bytes, wanted %d\n", total, want);
+  printf(1, "pipebench: %d KB in %d byte writes, pipe size %d: %d ticks\n",
+         kb, bs, pipesize(fd[0], 0), uptime() - start);
+  exit();
+}
@@ -6,24 +6,76 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "pstat.h"
+#include "traps.h"
 
 struct {
   struct spinlock lock;
   struct proc proc[NPROC];
 } ptable;
 
+// Scheduling policy, chosen at build time (make SCHED=MLFQ).
+// Round robin gives every process a one-tick time slice.
+// MLFQ keeps NMLFQ levels: a process starts at level 0, runs
+// before anything at a lower level, and moves down a level
+// when it has used up the time slice of its level, 1<<level
+// ticks, whether in one go or across sleeps.  Every BOOSTTICKS
+// ticks all processes move back to level 0.
+#ifdef SCHED_MLFQ
+#define NLEVEL NMLFQ
+#define QUANTUM(level) (1 << (level))
+#else
+#define NLEVEL 1
+#define QUANTUM(level) 1
+#endif
+
+// Per-CPU queues of RUNNABLE processes, one per level.  A
+// process is only ever put on a queue of p->cpu, the CPU it
+// last ran on, which holds its queue's lock from the time a
+// process gives up the CPU in sched() until swtch() has moved
+// off its stack.  An idle CPU steals from the others, taking
+// the victim's queue lock, so a process never runs on two
+// CPUs at once.
+struct runq {
+  struct spinlock lock;
+  struct proc *head[NLEVEL];
+  struct proc *tail[NLEVEL];
+  int n;
+  uint boost;     // boost period the levels were last reset in
+};
+
+struct runq runq[NCPU];
+
+// Sleeping processes, hashed by wait channel.  A process's
+// move to and from SLEEPING happens under its bucket's lock,
+// so wakeup() only looks at the processes that might be
+// waiting on its channel.
+#define NWAITQ 61
+#define WAITQ(chan) (&waitq[((uint)(chan) >> 2) % NWAITQ])
+
+struct waitq {
+  struct spinlock lock;
+  struct proc *head;
+};
+
+struct waitq waitq[NWAITQ];
+
 static struct proc *initproc;
 
 int nextpid = 1;
 extern void forkret(void);
 extern void trapret(void);
 
-static void wakeup1(void *chan);
-
 void
 pinit(void)
 {
+  int i;
+
   initlock(&ptable.lock, "ptable");
+  for(i = 0; i < NCPU; i++)
+    initlock(&runq[i].lock, "runq");
+  for(i = 0; i < NWAITQ; i++)
+    initlock(&waitq[i].lock, "waitq");
 }
 
 // Must be called with interrupts disabled
@@ -65,6 +117,142 @@ myproc(void) {
   return p;
 }
 
+// Move p back to level 0 if a boost period has begun since
+// it was last at level 0.
+static void
+boost(struct proc *p)
+{
+#ifdef SCHED_MLFQ
+  if(p->boost != ticks / BOOSTTICKS){
+    p->boost = ticks / BOOSTTICKS;
+    p->level = 0;
+    p->slice = 0;
+  }
+#endif
+}
+
+// Append p to rq at its level.  Caller must hold rq->lock.
+static void
+runqput(struct runq *rq, struct proc *p)
+{
+  boost(p);
+  p->rqnext = 0;
+  if(rq->tail[p->level])
+    rq->tail[p->level]->rqnext = p;
+  else
+    rq->head[p->level] = p;
+  rq->tail[p->level] = p;
+  rq->n++;
+}
+
+// Remove and return the first process on the highest
+// nonempty level of rq, or 0.  Caller must hold rq->lock.
+static struct proc*
+runqget(struct runq *rq)
+{
+  struct proc *p;
+  int i;
+
+#ifdef SCHED_MLFQ
+  // Move everyone back to level 0 at each boost.
+  if(rq->boost != ticks / BOOSTTICKS){
+    rq->boost = ticks / BOOSTTICKS;
+    for(i = 1; i < NLEVEL; i++){
+      if(rq->head[i] == 0)
+        continue;
+      for(p = rq->head[i]; p; p = p->rqnext){
+        p->boost = rq->boost;
+        p->level = 0;
+        p->slice = 0;
+      }
+      if(rq->tail[0])
+        rq->tail[0]->rqnext = rq->head[i];
+      else
+        rq->head[0] = rq->head[i];
+      rq->tail[0] = rq->tail[i];
+      rq->head[i] = rq->tail[i] = 0;
+    }
+  }
+#endif
+
+  for(i = 0; i < NLEVEL; i++){
+    if((p = rq->head[i]) != 0){
+      rq->head[i] = p->rqnext;
+      if(rq->head[i] == 0)
+        rq->tail[i] = 0;
+      rq->n--;
+      return p;
+    }
+  }
+  return 0;
+}
+
+// Lock and return this CPU's run queue.
+static struct runq*
+lockmyrunq(void)
+{
+  struct runq *rq;
+
+  pushcli();
+  rq = &runq[cpuid()];
+  acquire(&rq->lock);
+  popcli();
+  return rq;
+}
+
+// Wake up a halted CPU to run, or steal, the work queued on
+// CPU cpu: cpu itself if it is idle, else some other idle CPU.
+static void
+kick(int cpu)
+{
+  int i;
+
+  __sync_synchronize();  // order the enqueue before reading idle
+  for(i = 0; i < ncpu; i++){
+    if(cpus[(cpu + i) % ncpu].idle){
+      lapicipi(cpus[(cpu + i) % ncpu].apicid, T_IRQ0 + IRQ_WAKEUP);
+      return;
+    }
+  }
+}
+
+// Make p RUNNABLE on the run queue of the CPU it last ran on.
+// p must not be on a run queue.
+static void
+enqueue(struct proc *p)
+{
+  struct runq *rq = &runq[p->cpu];
+
+  acquire(&rq->lock);
+  p->state = RUNNABLE;
+  runqput(rq, p);
+  kick(p->cpu);
+  release(&rq->lock);
+}
+
+// Take a RUNNABLE process from another CPU's run queue and
+// make it ours.  It is on no queue when returned.
+static struct proc*
+steal(int self)
+{
+  struct runq *rq;
+  struct proc *p;
+  int i;
+
+  for(i = 1; i < ncpu; i++){
+    rq = &runq[(self + i) % ncpu];
+    if(rq->n == 0)
+      continue;
+    acquire(&rq->lock);
+    if((p = runqget(rq)) != 0)
+      p->cpu = self;
+    release(&rq->lock);
+    if(p)
+      return p;
+  }
+  return 0;
+}
+
 //PAGEBREAK: 32
 // Look in the process table for an UNUSED proc.
 // If found, change state to EMBRYO and initialize
@@ -88,9 +276,20 @@ allocproc(void)
 found:
   p->state = EMBRYO;
   p->pid = nextpid++;
+  p->level = 0;
+  p->slice = 0;
+  p->boost = ticks / BOOSTTICKS;
+  p->nrun = 0;
+  p->nsleep = 0;
+  memset(p->ticks, 0, sizeof(p->ticks));
 
   release(&ptable.lock);
 
+  // Start out on the creating CPU's run queue.
+  pushcli();
+  p->cpu = cpuid();
+  popcli();
+
   // Allocate kernel stack.
   if((p->kstack = kalloc()) == 0){
     p->state = UNUSED;
@@ -142,15 +341,10 @@ userinit(void)
   safestrcpy(p->name, "initcode", sizeof(p->name));
   p->cwd = namei("/");
 
-  // this assignment to p->state lets other cores
-  // run this process. the acquire forces the above
-  // writes to be visible, and the lock is also needed
-  // because the assignment might not be atomic.
-  acquire(&ptable.lock);
-
-  p->state = RUNNABLE;
-
-  release(&ptable.lock);
+  // enqueueing p lets other cores run this process.
+  // the run queue lock forces the above writes to be
+  // visible.
+  enqueue(p);
 }
 
 // Grow current process's memory by n bytes.
@@ -212,13 +406,36 @@ fork(void)
 
   pid = np->pid;
 
-  acquire(&ptable.lock);
+  enqueue(np);
 
-  np->state = RUNNABLE;
+  return pid;
+}
 
-  release(&ptable.lock);
+// Create a kernel process that runs fn(), which must never
+// return.  It has the kernel part of a page table but no user
+// memory, and never returns to user space, so kill() ignores it.
+int
+kproc(char *name, void (*fn)(void))
+{
+  struct proc *np;
 
-  return pid;
+  if((np = allocproc()) == 0)
+    return -1;
+  if((np->pgdir = setupkvm()) == 0){
+    kfree(np->kstack);
+    np->kstack = 0;
+    np->state = UNUSED;
+    return -1;
+  }
+  np->sz = 0;
+  np->parent = initproc;
+  // Have forkret() "return" to fn instead of trapret.
+  *(uint*)(np->context + 1) = (uint)fn;
+  safestrcpy(np->name, name, sizeof(np->name));
+
+  enqueue(np);
+
+  return np->pid;
 }
 
 // Exit the current process.  Does not return.
@@ -250,19 +467,24 @@ exit(void)
   acquire(&ptable.lock);
 
   // Parent might be sleeping in wait().
-  wakeup1(curproc->parent);
+  wakeup(curproc->parent);
 
   // Pass abandoned children to init.
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
     if(p->parent == curproc){
       p->parent = initproc;
       if(p->state == ZOMBIE)
-        wakeup1(initproc);
+        wakeup(initproc);
     }
   }
 
   // Jump into the scheduler, never to return.
+  // wait() can free our stack once it sees ZOMBIE, so take
+  // the run queue lock before releasing ptable.lock; wait()
+  // uses it to know that we have switched away.
   curproc->state = ZOMBIE;
+  lockmyrunq();
+  release(&ptable.lock);
   sched();
   panic("zombie exit");
 }
@@ -285,7 +507,9 @@ wait(void)
         continue;
       havekids = 1;
       if(p->state == ZOMBIE){
-        // Found one.
+        // Found one.  Wait for it to be off its stack.
+        acquire(&runq[p->cpu].lock);
+        release(&runq[p->cpu].lock);
         pid = p->pid;
         kfree(p->kstack);
         p->kstack = 0;
@@ -306,16 +530,35 @@ wait(void)
       return -1;
     }
 
-    // Wait for children to exit.  (See wakeup1 call in proc_exit.)
+    // Wait for children to exit.  (See wakeup call in proc_exit.)
     sleep(curproc, &ptable.lock);  //DOC: wait-sleep
   }
 }
 
+// Halt this CPU until an interrupt arrives, unless work has
+// been queued since scheduler() last looked.  kick() sends an
+// interrupt to an idle CPU when it queues work.
+static void
+idle(struct cpu *c)
+{
+  int i;
+
+  cli();
+  xchg(&c->idle, 1);
+  for(i = 0; i < ncpu; i++)
+    if(runq[i].n > 0)
+      break;
+  if(i == ncpu)
+    stihlt();
+  c->idle = 0;
+}
+
 //PAGEBREAK: 42
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
 // Scheduler never returns.  It loops, doing:
-//  - choose a process to run
+//  - choose a process to run from this CPU's run queue,
+//      or steal one from another CPU's
 //  - swtch to start running that process
 //  - eventually that process transfers control
 //      via swtch back to the scheduler.
@@ -324,38 +567,42 @@ scheduler(void)
 {
   struct proc *p;
   struct cpu *c = mycpu();
+  struct runq *rq = &runq[cpuid()];
   c->proc = 0;
   
   for(;;){
     // Enable interrupts on this processor.
     sti();
 
-    // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
+    acquire(&rq->lock);
+    if((p = runqget(rq)) == 0){
+      release(&rq->lock);
+      if((p = steal(cpuid())) == 0){
+        idle(c);
         continue;
-
-      // Switch to chosen process.  It is the process's job
-      // to release ptable.lock and then reacquire it
-      // before jumping back to us.
-      c->proc = p;
-      switchuvm(p);
-      p->state = RUNNING;
-
-      swtch(&(c->scheduler), p->context);
-      switchkvm();
-
-      // Process is done running for now.
-      // It should have changed its p->state before coming back.
-      c->proc = 0;
+      }
+      acquire(&rq->lock);
     }
-    release(&ptable.lock);
 
+    // Switch to chosen process.  It is the process's job
+    // to release rq->lock and then reacquire it
+    // before jumping back to us.
+    c->proc = p;
+    switchuvm(p);
+    p->state = RUNNING;
+    p->nrun++;
+
+    swtch(&(c->scheduler), p->context);
+    switchkvm();
+
+    // Process is done running for now.
+    // It should have changed its p->state before coming back.
+    c->proc = 0;
+    release(&rq->lock);
   }
 }
 
-// Enter scheduler.  Must hold only ptable.lock
+// Enter scheduler.  Must hold only this CPU's run queue lock
 // and have changed proc->state. Saves and restores
 // intena because intena is a property of this
 // kernel thread, not this CPU. It should
@@ -368,8 +615,8 @@ sched(void)
   int intena;
   struct proc *p = myproc();
 
-  if(!holding(&ptable.lock))
-    panic("sched ptable.lock");
+  if(!holding(&runq[cpuid()].lock))
+    panic("sched runq lock");
   if(mycpu()->ncli != 1)
     panic("sched locks");
   if(p->state == RUNNING)
@@ -381,14 +628,45 @@ sched(void)
   mycpu()->intena = intena;
 }
 
+// Account a timer tick to the current process.  Return 1 if
+// it should give up the CPU: it has used up its time slice,
+// or a process at a higher level is waiting on this CPU.
+int
+schedtick(void)
+{
+  struct proc *p = myproc();
+  struct runq *rq;
+  int i;
+
+  boost(p);
+  p->ticks[p->level]++;
+  if(++p->slice >= QUANTUM(p->level)){
+    if(p->level < NLEVEL-1)
+      p->level++;
+    p->slice = 0;
+    return 1;
+  }
+  pushcli();
+  rq = &runq[cpuid()];
+  popcli();
+  for(i = 0; i < p->level; i++)
+    if(rq->head[i])
+      return 1;
+  return 0;
+}
+
 // Give up the CPU for one scheduling round.
 void
 yield(void)
 {
-  acquire(&ptable.lock);  //DOC: yieldlock
-  myproc()->state = RUNNABLE;
+  struct runq *rq;
+  struct proc *p = myproc();
+
+  rq = lockmyrunq();  //DOC: yieldlock
+  p->state = RUNNABLE;
+  runqput(rq, p);
   sched();
-  release(&ptable.lock);
+  release(&runq[cpuid()].lock);
 }
 
 // A fork child's very first scheduling by scheduler()
@@ -397,8 +675,8 @@ void
 forkret(void)
 {
   static int first = 1;
-  // Still holding ptable.lock from scheduler.
-  release(&ptable.lock);
+  // Still holding the run queue lock from scheduler.
+  release(&runq[cpuid()].lock);
 
   if (first) {
     // Some initialization functions must be run in the context
@@ -418,6 +696,7 @@ void
 sleep(void *chan, struct spinlock *lk)
 {
   struct proc *p = myproc();
+  struct waitq *wq;
   
   if(p == 0)
     panic("sleep");
@@ -425,52 +704,61 @@ sleep(void *chan, struct spinlock *lk)
   if(lk == 0)
     panic("sleep without lk");
 
-  // Must acquire ptable.lock in order to
-  // change p->state and then call sched.
-  // Once we hold ptable.lock, we can be
-  // guaranteed that we won't miss any wakeup
-  // (wakeup runs with ptable.lock locked),
-  // so it's okay to release lk.
-  if(lk != &ptable.lock){  //DOC: sleeplock0
-    acquire(&ptable.lock);  //DOC: sleeplock1
-    release(lk);
-  }
+  // Must acquire chan's wait queue lock in order to
+  // change p->state.
+  // Once we hold it, we can be guaranteed that we
+  // won't miss any wakeup (wakeup runs with it
+  // locked), so it's okay to release lk.
+  wq = WAITQ(chan);
+  acquire(&wq->lock);  //DOC: sleeplock1
+  release(lk);
+
   // Go to sleep.
   p->chan = chan;
   p->state = SLEEPING;
-
+  p->nsleep++;
+  p->wqnext = wq->head;
+  wq->head = p;
+
+  // A wakeup after we release wq->lock has to enqueue
+  // p on this CPU's run queue, so it waits until sched()
+  // has switched away.
+  lockmyrunq();
+  release(&wq->lock);
   sched();
-
-  // Tidy up.
-  p->chan = 0;
+  release(&runq[cpuid()].lock);
 
   // Reacquire original lock.
-  if(lk != &ptable.lock){  //DOC: sleeplock2
-    release(&ptable.lock);
-    acquire(lk);
-  }
+  acquire(lk);  //DOC: sleeplock2
 }
 
 //PAGEBREAK!
-// Wake up all processes sleeping on chan.
-// The ptable lock must be held.
+// Wake up the processes sleeping on chan in wq, or just p
+// if p is not 0.  Caller must hold wq->lock.
 static void
-wakeup1(void *chan)
+wakeup1(struct waitq *wq, void *chan, struct proc *p)
 {
-  struct proc *p;
-
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
+  struct proc **pp, *q;
+
+  for(pp = &wq->head; (q = *pp) != 0; ){
+    if(q->chan == chan && (p == 0 || q == p)){
+      *pp = q->wqnext;
+      q->chan = 0;
+      enqueue(q);
+    } else
+      pp = &q->wqnext;
+  }
 }
 
 // Wake up all processes sleeping on chan.
 void
 wakeup(void *chan)
 {
-  acquire(&ptable.lock);
-  wakeup1(chan);
-  release(&ptable.lock);
+  struct waitq *wq = WAITQ(chan);
+
+  acquire(&wq->lock);
+  wakeup1(wq, chan, 0);
+  release(&wq->lock);
 }
 
 // Kill the process with the given pid.
@@ -480,15 +768,54 @@ int
 kill(int pid)
 {
   struct proc *p;
+  struct waitq *wq;
+  void *chan;
 
   acquire(&ptable.lock);
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
     if(p->pid == pid){
+      // Kernel processes have no user memory and never
+      // return to user space to die; leave them alone.
+      if(p->sz == 0)
+        break;
       p->killed = 1;
-      // Wake process from sleep if necessary.
-      if(p->state == SLEEPING)
-        p->state = RUNNABLE;
+      // Wake process from sleep if necessary.  It is
+      // asleep on chan only if its bucket still says so.
+      if((chan = p->chan) != 0){
+        wq = WAITQ(chan);
+        acquire(&wq->lock);
+        if(p->state == SLEEPING && p->chan == chan)
+          wakeup1(wq, chan, p);
+        release(&wq->lock);
+      }
+      release(&ptable.lock);
+      return 0;
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
+// Copy the scheduling statistics of process pid into *ps.
+// *ps is user memory, which may fault on a copy-on-write page,
+// so it is only written after ptable.lock is released.
+int
+getpstat(int pid, struct pstat *ps)
+{
+  struct proc *p;
+  struct pstat st;
+  int i;
+
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->pid == pid && p->state != UNUSED){
+      st.level = p->level;
+      st.nrun = p->nrun;
+      st.nsleep = p->nsleep;
+      for(i = 0; i < NMLFQ; i++)
+        st.ticks[i] = p->ticks[i];
       release(&ptable.lock);
+      *ps = st;
       return 0;
     }
   }
@@ -497,7 +824,8 @@ kill(int pid)
 }
 
 //PAGEBREAK: 36
-// Print a process listing to console.  For debugging.
+// Print a process listing, and how much of the time each
+// CPU has been idle, to console.  For debugging.
 // Runs when user types ^P on console.
 // No lock to avoid wedging a stuck machine further.
 void
@@ -531,4 +859,7 @@ procdump(void)
     }
     cprintf("\n");
   }
+  for(i = 0; i < ncpu; i++)
+    cprintf("cpu%d: idle %d of %d ticks\n", i, cpus[i].idleticks,
+            cpus[i].nticks);
 }
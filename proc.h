@@ -8,6 +8,9 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  volatile uint idle;          // Halted in scheduler() waiting for work?
+  uint nticks;                 // Timer ticks taken on this cpu
+  uint idleticks;              // ... of which while idle
 };
 
 extern struct cpu cpus[NCPU];
@@ -49,6 +52,18 @@ struct proc {
   struct file *ofile[NOFILE];  // Open files
   struct inode *cwd;           // Current directory
   char name[16];               // Process name (debugging)
+  int cpu;                     // CPU whose run queue p belongs on
+  struct proc *rqnext;         // Next on run queue
+  struct proc *wqnext;         // Next on wait queue
+  uint deadline;               // Tick to wake at in sleepticks()
+  struct proc *tnext;          // Next on timing wheel slot
+  int level;                   // Scheduling queue level, 0 is highest
+  int slice;                   // Ticks used of this level's time slice
+  uint boost;                  // Boost period p was last at level 0 in
+  uint nrun;                   // Times scheduled
+  uint nsleep;                 // Times gone to sleep
+  uint ticks[NMLFQ];           // Ticks run at each level
+  int logblocks;               // Log blocks reserved by begin_opn()
 };
 
 // Process memory is laid out contiguously, low addresses first:
@@ -0,0 +1,8 @@
+// Per-process scheduling statistics, returned by getpstat().
+// Needs param.h for NMLFQ.
+struct pstat {
+  int level;          // Scheduling queue level, 0 is highest
+  uint nrun;          // Times scheduled
+  uint nsleep;        // Times gone to sleep
+  uint ticks[NMLFQ];  // Timer ticks run at each level
+};
@@ -0,0 +1,94 @@
+// Run CPU-bound and I/O-bound processes side by side and report
+// how each was scheduled.  schedbench [ncpu [nio]] starts ncpu
+// (default 4) processes that spin and nio (default 4) that do a
+// little work and then sleep for a tick, for DURATION ticks.
+// Each reports its rounds of work and its getpstat() statistics.
+
+#include "param.h"
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "pstat.h"
+
+#define DURATION 500
+
+struct result {
+  int pid;
+  int io;
+  uint rounds;
+  struct pstat ps;
+};
+
+volatile uint sink;
+
+void
+work(int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    sink += i;
+}
+
+void
+child(int io, int fd)
+{
+  struct result r;
+  uint end;
+
+  r.pid = getpid();
+  r.io = io;
+  r.rounds = 0;
+  end = uptime() + DURATION;
+  while(uptime() < end){
+    if(io){
+      work(1000);
+      sleep(1);
+    } else
+      work(100000);
+    r.rounds++;
+  }
+  getpstat(r.pid, &r.ps);
+  write(fd, &r, sizeof(r));
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, j, ncpu, nio, fd[2];
+  struct result r;
+
+  ncpu = argc > 1 ? atoi(argv[1]) : 4;
+  nio = argc > 2 ? atoi(argv[2]) : 4;
+
+  if(pipe(fd) < 0){
+    printf(1, "schedbench: pipe failed\n");
+    exit();
+  }
+  for(i = 0; i < ncpu + nio; i++){
+    j = fork();
+    if(j < 0){
+      printf(1, "schedbench: fork failed\n");
+      break;
+    }
+    if(j == 0){
+      close(fd[0]);
+      child(i >= ncpu, fd[1]);
+    }
+  }
+  close(fd[1]);
+
+  while(read(fd[0], &r, sizeof(r)) == sizeof(r)){
+    printf(1, "schedbench: %s pid %d: %d rounds, level %d, ran %d times, "
+           "slept %d times, ticks",
+           r.io ? "io " : "cpu", r.pid, r.rounds, r.ps.level,
+           r.ps.nrun, r.ps.nsleep);
+    for(j = 0; j < NMLFQ; j++)
+      printf(1, " %d", r.ps.ticks[j]);
+    printf(1, "\n");
+  }
+  for(; i > 0; i--)
+    wait();
+  exit();
+}
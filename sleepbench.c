@@ -0,0 +1,69 @@
+// Measure how much CPU sleeping processes cost the rest of the
+// system.  sleepbench [n] times a CPU-bound loop alone, then with
+// n processes (default 200, or as many as fork allows) that sleep
+// for 1 to 10 ticks at a time, and prints both loop counts.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define DURATION 300
+#define MAXSLEEPERS 256
+
+int pids[MAXSLEEPERS];
+volatile uint sink;
+
+// Count rounds of busy work done in DURATION ticks.
+uint
+spin(void)
+{
+  uint end, n;
+  int i;
+
+  n = 0;
+  end = uptime() + DURATION;
+  while(uptime() < end){
+    for(i = 0; i < 10000; i++)
+      sink += i;
+    n++;
+  }
+  return n;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, n, pid;
+  uint alone, shared;
+
+  n = 200;
+  if(argc > 1)
+    n = atoi(argv[1]);
+  if(n > MAXSLEEPERS)
+    n = MAXSLEEPERS;
+
+  alone = spin();
+
+  for(i = 0; i < n; i++){
+    pid = fork();
+    if(pid < 0)
+      break;
+    if(pid == 0){
+      for(;;)
+        sleep(1 + i % 10);
+    }
+    pids[i] = pid;
+  }
+  n = i;
+
+  shared = spin();
+
+  for(i = 0; i < n; i++)
+    kill(pids[i]);
+  for(i = 0; i < n; i++)
+    wait();
+
+  printf(1, "sleepbench: %d rounds alone, %d rounds with %d sleepers\n",
+         alone, shared, n);
+  exit();
+}
@@ -1,6 +1,10 @@
 // Long-term locks for processes
+// Held either exclusively by one process, or shared by any
+// number of readers.
 struct sleeplock {
-  uint locked;       // Is the lock held?
+  uint locked;       // Is the lock held exclusively?
+  uint readers;      // Number of processes holding it shared
+  uint writers;      // Processes waiting to hold it exclusively
   struct spinlock lk; // spinlock protecting this sleep lock
   
   // For debugging:
@@ -9,12 +9,49 @@
 #include "proc.h"
 #include "spinlock.h"
 
+// Lock statistics, one entry per lock name, so that short-lived
+// locks such as a pipe's add to one entry that outlives them.
+// Each CPU updates its own counters, while holding the lock
+// and with interrupts off, so they need no atomic operations.
+#define NLOCKSTAT 64
+
+struct lockstat {
+  char *name;
+  struct {
+    uint nacquire;    // Acquisitions
+    uint ncontend;    // Acquisitions that had to wait
+    uint nspin;       // Times around the wait loop
+    uint maxhold;     // Longest hold, in cycles
+  } cpu[NCPU];
+};
+
+static struct lockstat lockstat[NLOCKSTAT];
+
+// Return the statistics entry for locks named name, adding
+// one if needed, or 0 if the table is full.
+static struct lockstat*
+lockstatfor(char *name)
+{
+  struct lockstat *s;
+
+  for(s = lockstat; s < &lockstat[NLOCKSTAT]; s++){
+    if(s->name == 0 &&
+       __sync_bool_compare_and_swap(&s->name, 0, name))
+      return s;
+    if(s->name == name || strncmp(s->name, name, 16) == 0)
+      return s;
+  }
+  return 0;
+}
+
 void
 initlock(struct spinlock *lk, char *name)
 {
   lk->name = name;
-  lk->locked = 0;
+  lk->next = 0;
+  lk->owner = 0;
   lk->cpu = 0;
+  lk->stat = lockstatfor(name);
 }
 
 // Acquire the lock.
@@ -24,13 +61,18 @@ initlock(struct spinlock *lk, char *name)
 void
 acquire(struct spinlock *lk)
 {
+  uint ticket, spins;
+  struct cpu *c;
+
   pushcli(); // disable interrupts to avoid deadlock.
+  c = mycpu();
   if(holding(lk))
     panic("acquire");
 
-  // The xchg is atomic.
-  while(xchg(&lk->locked, 1) != 0)
-    ;
+  // The fetch-and-add is atomic.
+  ticket = __sync_fetch_and_add(&lk->next, 1);
+  for(spins = 0; lk->owner != ticket; spins++)
+    asm volatile("pause");
 
   // Tell the C compiler and the processor to not move loads or stores
   // past this point, to ensure that the critical section's memory
@@ -38,17 +80,36 @@ acquire(struct spinlock *lk)
   __sync_synchronize();
 
   // Record info about lock acquisition for debugging.
-  lk->cpu = mycpu();
+  lk->cpu = c;
   getcallerpcs(&lk, lk->pcs);
+
+  if(lk->stat){
+    lk->stat->cpu[c-cpus].nacquire++;
+    if(spins){
+      lk->stat->cpu[c-cpus].ncontend++;
+      lk->stat->cpu[c-cpus].nspin += spins;
+    }
+    lk->tacquire = rdtsc();
+  }
 }
 
 // Release the lock.
 void
 release(struct spinlock *lk)
 {
+  uint hold;
+  struct cpu *c;
+
   if(!holding(lk))
     panic("release");
 
+  c = lk->cpu;
+  if(lk->stat){
+    hold = rdtsc() - lk->tacquire;
+    if(hold > lk->stat->cpu[c-cpus].maxhold)
+      lk->stat->cpu[c-cpus].maxhold = hold;
+  }
+
   lk->pcs[0] = 0;
   lk->cpu = 0;
 
@@ -59,10 +120,9 @@ release(struct spinlock *lk)
   // stores; __sync_synchronize() tells them both not to.
   __sync_synchronize();
 
-  // Release the lock, equivalent to lk->locked = 0.
-  // This code can't use a C assignment, since it might
-  // not be atomic. A real OS would use C atomics here.
-  asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+  // Release the lock by serving the next ticket.  Only the
+  // holder writes owner, and an aligned 32-bit store is atomic.
+  lk->owner = lk->owner + 1;
 
   popcli();
 }
@@ -89,10 +149,109 @@ getcallerpcs(void *v, uint pcs[])
 int
 holding(struct spinlock *lock)
 {
-  return lock->locked && lock->cpu == mycpu();
+  return lock->owner != lock->next && lock->cpu == mycpu();
+}
+
+// Print the lock statistics to console.  For debugging.
+// Runs when user types ^L on console.
+void
+lockdump(void)
+{
+  struct lockstat *s;
+  uint nacquire, ncontend, nspin, maxhold;
+  int i;
+
+  cprintf("lock: acquired contended spins maxhold\n");
+  for(s = lockstat; s < &lockstat[NLOCKSTAT] && s->name; s++){
+    nacquire = ncontend = nspin = maxhold = 0;
+    for(i = 0; i < ncpu; i++){
+      nacquire += s->cpu[i].nacquire;
+      ncontend += s->cpu[i].ncontend;
+      nspin += s->cpu[i].nspin;
+      if(s->cpu[i].maxhold > maxhold)
+        maxhold = s->cpu[i].maxhold;
+    }
+    cprintf("%s: %d %d %d %d\n", s->name, nacquire, ncontend, nspin,
+            maxhold);
+  }
+}
+
+
+// Reader-writer spin locks.
+// The whole lock is one word, changed only by compare-and-swap.
+#define RW_WRITER  1  // Held by a writer
+#define RW_WAITING 2  // A writer is waiting
+#define RW_READER  4  // One reader
+
+void
+initrwlock(struct rwspinlock *lk, char *name)
+{
+  lk->name = name;
+  lk->state = 0;
+  lk->cpu = 0;
+}
+
+// Acquire lk shared with other readers.
+void
+acquireread(struct rwspinlock *lk)
+{
+  uint s;
+
+  pushcli();
+  if(lk->cpu == mycpu())
+    panic("acquireread");
+  for(;;){
+    s = lk->state;
+    if((s & (RW_WRITER|RW_WAITING)) == 0 &&
+       __sync_bool_compare_and_swap(&lk->state, s, s + RW_READER))
+      break;
+    asm volatile("pause");
+  }
 }
 
+void
+releaseread(struct rwspinlock *lk)
+{
+  if(lk->state < RW_READER)
+    panic("releaseread");
+  __sync_fetch_and_sub(&lk->state, RW_READER);
+  popcli();
+}
+
+// Acquire lk exclusively.  Sets RW_WAITING while readers
+// hold it so that no new ones get in.
+void
+acquirewrite(struct rwspinlock *lk)
+{
+  uint s;
+
+  pushcli();
+  if(lk->cpu == mycpu())
+    panic("acquirewrite");
+  for(;;){
+    s = lk->state;
+    if((s & ~RW_WAITING) == 0){
+      if(__sync_bool_compare_and_swap(&lk->state, s, RW_WRITER))
+        break;
+    } else if((s & RW_WAITING) == 0)
+      __sync_bool_compare_and_swap(&lk->state, s, s | RW_WAITING);
+    asm volatile("pause");
+  }
+  lk->cpu = mycpu();
+}
+
+void
+releasewrite(struct rwspinlock *lk)
+{
+  if(!(lk->state & RW_WRITER) || lk->cpu != mycpu())
+    panic("releasewrite");
+  lk->cpu = 0;
+  // Clear RW_WRITER but keep a RW_WAITING set by another writer.
+  __sync_fetch_and_and(&lk->state, ~RW_WRITER);
+  popcli();
+}
 
+//PAGEBREAK!
 // Pushcli/popcli are like cli/sti except that they are matched:
 // it takes two popcli to undo two pushcli.  Also, if interrupts
 // are off, then pushcli, popcli leaves them off.
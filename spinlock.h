@@ -1,11 +1,29 @@
 // Mutual exclusion lock.
+// A ticket lock: acquire() takes the next ticket and waits
+// until owner reaches it, so CPUs get the lock in FIFO order.
 struct spinlock {
-  uint locked;       // Is the lock held?
+  uint next;           // Next ticket to hand out
+  volatile uint owner; // Ticket now holding the lock
 
   // For debugging:
   char *name;        // Name of lock.
   struct cpu *cpu;   // The cpu holding the lock.
   uint pcs[10];      // The call stack (an array of program counters)
                      // that locked the lock.
+
+  // For statistics:
+  struct lockstat *stat;  // Counters for locks of this name, or 0
+  uint tacquire;          // rdtsc() when acquired
 };
 
+// Reader-writer spin lock.
+// Any number of readers may hold the lock at once, or one
+// writer.  A waiting writer keeps new readers out, so a steady
+// stream of readers cannot starve it.
+struct rwspinlock {
+  volatile uint state; // RW_WRITER, RW_WAITING, readers*RW_READER
+
+  // For debugging:
+  char *name;        // Name of lock.
+  struct cpu *cpu;   // The cpu holding the lock for writing.
+};
@@ -0,0 +1,70 @@
+// Stress the physical page allocator from several processes at once.
+// Each child repeatedly grows its heap by NPAGE pages, touches them,
+// and shrinks it again, so every iteration is NPAGE kalloc()s and
+// NPAGE kfree()s.  Run under different CPUS= settings to see how
+// allocation throughput scales with the number of CPUs:
+//   make qemu CPUS=1   ...   $ stressmem
+//   make qemu CPUS=8   ...   $ stressmem
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "mmu.h"
+
+#define NPAGE     64    // pages per sbrk() call
+#define DURATION  300   // ticks each child runs for
+
+int
+main(int argc, char *argv[])
+{
+  int i, j, n, nchild, fds[2];
+  uint start, elapsed, total;
+  char *a;
+
+  nchild = 8;
+  if(argc > 1)
+    nchild = atoi(argv[1]);
+  if(nchild < 1)
+    nchild = 1;
+
+  printf(1, "stressmem: %d processes, %d ticks\n", nchild, DURATION);
+  if(pipe(fds) < 0){
+    printf(1, "stressmem: pipe failed\n");
+    exit();
+  }
+
+  start = uptime();
+  for(i = 0; i < nchild; i++){
+    if(fork() == 0){
+      close(fds[0]);
+      n = 0;
+      while(uptime() - start < DURATION){
+        a = sbrk(NPAGE*PGSIZE);
+        if(a == (char*)-1){
+          printf(1, "stressmem: sbrk failed\n");
+          break;
+        }
+        for(j = 0; j < NPAGE; j++)
+          a[j*PGSIZE] = j;
+        sbrk(-NPAGE*PGSIZE);
+        n += NPAGE;
+      }
+      write(fds[1], &n, sizeof(n));
+      exit();
+    }
+  }
+  close(fds[1]);
+
+  total = 0;
+  while(read(fds[0], &n, sizeof(n)) == sizeof(n))
+    total += n;
+  for(i = 0; i < nchild; i++)
+    wait();
+  elapsed = uptime() - start;
+  if(elapsed == 0)
+    elapsed = 1;
+
+  printf(1, "stressmem: %d page allocs in %d ticks, %d allocs per 100 ticks\n",
+         total, elapsed, total * 100 / elapsed);
+  exit();
+}
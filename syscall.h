@@ -20,3 +20,7 @@
 #define SYS_link   19
 #define SYS_mkdir  20
 #define SYS_close  21
+#define SYS_getpstat 22
+#define SYS_pipesize 23
+#define SYS_splice 24
+#define SYS_copyrange 25
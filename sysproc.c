@@ -6,6 +6,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "pstat.h"
 
 int
 sys_fork(void)
@@ -51,6 +52,14 @@ sys_sbrk(void)
   if(argint(0, &n) < 0)
     return -1;
   addr = myproc()->sz;
+  if(n > 0){
+    // Demand-zero: only grow the size now; trap() maps a
+    // zeroed page on first touch (see lazyfault in vm.c).
+    if((uint)addr + n >= KERNBASE || (uint)addr + n < (uint)addr)
+      return -1;
+    myproc()->sz += n;
+    return addr;
+  }
   if(growproc(n) < 0)
     return -1;
   return addr;
@@ -60,20 +69,15 @@ int
 sys_sleep(void)
 {
   int n;
-  uint ticks0;
 
   if(argint(0, &n) < 0)
     return -1;
   acquire(&tickslock);
-  ticks0 = ticks;
-  while(ticks - ticks0 < n){
-    if(myproc()->killed){
-      release(&tickslock);
-      return -1;
-    }
-    sleep(&ticks, &tickslock);
-  }
+  if(n > 0)
+    sleepticks(n);
   release(&tickslock);
+  if(myproc()->killed)
+    return -1;
   return 0;
 }
 
@@ -89,3 +93,15 @@ sys_uptime(void)
   release(&tickslock);
   return xticks;
 }
+
+// return the scheduling statistics of process pid.
+int
+sys_getpstat(void)
+{
+  int pid;
+  struct pstat *ps;
+
+  if(argint(0, &pid) < 0 || argptrw(1, (void*)&ps, sizeof(*ps)) < 0)
+    return -1;
+  return getpstat(pid, ps);
+}
@@ -14,6 +14,13 @@ extern uint vectors[];  // in vectors.S: array of 256 entry pointers
 struct spinlock tickslock;
 uint ticks;
 
+// Processes in sleepticks(), hashed by deadline into a timing
+// wheel of NWHEEL slots.  Each tick wakes only the processes
+// in one slot whose deadline has come; the others are at least
+// one more turn of the wheel away.  Protected by tickslock.
+#define NWHEEL 64
+static struct proc *wheel[NWHEEL];
+
 void
 tvinit(void)
 {
@@ -32,6 +39,48 @@ idtinit(void)
   lidt(idt, sizeof(idt));
 }
 
+// Sleep for n ticks, or until the process is killed.
+// Caller must hold tickslock.
+void
+sleepticks(uint n)
+{
+  struct proc *p = myproc();
+  struct proc **pp;
+
+  if(n == 0)
+    return;
+  p->deadline = ticks + n;
+  pp = &wheel[p->deadline % NWHEEL];
+  p->tnext = *pp;
+  *pp = p;
+  while((int)(ticks - p->deadline) < 0 && !p->killed)
+    sleep(&p->deadline, &tickslock);
+
+  // Still on the wheel if killed early.
+  for(pp = &wheel[p->deadline % NWHEEL]; *pp; pp = &(*pp)->tnext){
+    if(*pp == p){
+      *pp = p->tnext;
+      break;
+    }
+  }
+}
+
+// Wake the processes whose deadline is this tick.
+// Caller must hold tickslock.
+static void
+expire(void)
+{
+  struct proc **pp, *p;
+
+  for(pp = &wheel[ticks % NWHEEL]; (p = *pp) != 0; ){
+    if(p->deadline == ticks){
+      *pp = p->tnext;
+      wakeup(&p->deadline);
+    } else
+      pp = &p->tnext;
+  }
+}
+
 //PAGEBREAK: 41
 void
 trap(struct trapframe *tf)
@@ -51,9 +100,16 @@ trap(struct trapframe *tf)
     if(cpuid() == 0){
       acquire(&tickslock);
       ticks++;
-      wakeup(&ticks);
+      expire();
       release(&tickslock);
     }
+    mycpu()->nticks++;
+    if(mycpu()->idle)
+      mycpu()->idleticks++;
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_WAKEUP:
+    // Work for an idle CPU; scheduler() will find it.
     lapiceoi();
     break;
   case T_IRQ0 + IRQ_IDE:
@@ -71,6 +127,19 @@ trap(struct trapframe *tf)
     uartintr();
     lapiceoi();
     break;
+  case T_PGFLT:
+    // Writes to copy-on-write pages and first touches of lazily
+    // allocated heap pages, from user code or from the kernel
+    // using a user buffer, are resolved here.
+    // Anything else is a real fault; see default.
+    if(myproc() != 0){
+      if(tf->err & FEC_PR){
+        if((tf->err & FEC_WR) && cowfault(myproc()->pgdir, rcr2()) == 0)
+          break;
+      } else if(lazyfault(myproc()->pgdir, rcr2(), myproc()->sz) == 0)
+        break;
+    }
+    goto fault;
   case T_IRQ0 + 7:
   case T_IRQ0 + IRQ_SPURIOUS:
     cprintf("cpu%d: spurious interrupt at %x:%x\n",
@@ -80,6 +149,7 @@ trap(struct trapframe *tf)
 
   //PAGEBREAK: 13
   default:
+  fault:
     if(myproc() == 0 || (tf->cs&3) == 0){
       // In kernel, it must be our mistake.
       cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
@@ -103,7 +173,7 @@ trap(struct trapframe *tf)
   // Force process to give up CPU on clock tick.
   // If interrupts were on while locks held, would need to check nlock.
   if(myproc() && myproc()->state == RUNNING &&
-     tf->trapno == T_IRQ0+IRQ_TIMER)
+     tf->trapno == T_IRQ0+IRQ_TIMER && schedtick())
     yield();
 
   // Check if the process has been killed since we yielded
@@ -1,5 +1,6 @@
 struct stat;
 struct rtcdate;
+struct pstat;
 
 // system calls
 int fork(void);
@@ -23,6 +24,10 @@ int getpid(void);
 char* sbrk(int);
 int sleep(int);
 int uptime(void);
+int getpstat(int, struct pstat*);
+int pipesize(int, int);
+int splice(int, int, int);
+int copyrange(int, int, int);
 
 // ulib.c
 int stat(char*, struct stat*);
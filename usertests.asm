@@ -0,0 +1,9120 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+      11:	68 0c 6e 00 00       	push   $0x6e0c
+      16:	6a 01                	push   $0x1
+      18:	e8 73 54 00 00       	call   5490 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      1d:	59                   	pop    %ecx
+      1e:	58                   	pop    %eax
+      1f:	6a 00                	push   $0x0
+      21:	68 20 6e 00 00       	push   $0x6e20
+      26:	e8 38 53 00 00       	call   5363 <open>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	85 c0                	test   %eax,%eax
+      30:	78 13                	js     45 <main+0x45>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      32:	52                   	push   %edx
+      33:	52                   	push   %edx
+      34:	68 10 78 00 00       	push   $0x7810
+      39:	6a 01                	push   $0x1
+      3b:	e8 50 54 00 00       	call   5490 <printf>
+    exit();
+      40:	e8 de 52 00 00       	call   5323 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      45:	50                   	push   %eax
+      46:	50                   	push   %eax
+      47:	68 00 02 00 00       	push   $0x200
+      4c:	68 20 6e 00 00       	push   $0x6e20
+      51:	e8 0d 53 00 00       	call   5363 <open>
+      56:	89 04 24             	mov    %eax,(%esp)
+      59:	e8 ed 52 00 00       	call   534b <close>
+
+  argptest();
+      5e:	e8 ed 4f 00 00       	call   5050 <argptest>
+  createdelete();
+      63:	e8 b8 19 00 00       	call   1a20 <createdelete>
+  linkunlink();
+      68:	e8 73 26 00 00       	call   26e0 <linkunlink>
+  concreate();
+      6d:	e8 6e 23 00 00       	call   23e0 <concreate>
+  conlookup();
+      72:	e8 49 1f 00 00       	call   1fc0 <conlookup>
+  dcachetest();
+      77:	e8 34 21 00 00       	call   21b0 <dcachetest>
+  fourfiles();
+      7c:	e8 9f 17 00 00       	call   1820 <fourfiles>
+  sharedfd();
+      81:	e8 da 15 00 00       	call   1660 <sharedfd>
+
+  bigargtest();
+      86:	e8 85 4c 00 00       	call   4d10 <bigargtest>
+  bigwrite();
+      8b:	e8 e0 31 00 00       	call   3270 <bigwrite>
+  hugewrite();
+      90:	e8 bb 32 00 00       	call   3350 <hugewrite>
+  bigargtest();
+      95:	e8 76 4c 00 00       	call   4d10 <bigargtest>
+  bsstest();
+      9a:	e8 01 4c 00 00       	call   4ca0 <bsstest>
+  sbrktest();
+      9f:	e8 bc 43 00 00       	call   4460 <sbrktest>
+  cowtest();
+      a4:	e8 f7 47 00 00       	call   48a0 <cowtest>
+  lazytest();
+      a9:	e8 c2 49 00 00       	call   4a70 <lazytest>
+  validatetest();
+      ae:	e8 3d 4b 00 00       	call   4bf0 <validatetest>
+
+  opentest();
+      b3:	e8 78 03 00 00       	call   430 <opentest>
+  writetest();
+      b8:	e8 03 04 00 00       	call   4c0 <writetest>
+  writetest1();
+      bd:	e8 de 05 00 00       	call   6a0 <writetest1>
+  createtest();
+      c2:	e8 99 07 00 00       	call   860 <createtest>
+
+  openiputtest();
+      c7:	e8 64 02 00 00       	call   330 <openiputtest>
+  exitiputtest();
+      cc:	e8 5f 01 00 00       	call   230 <exitiputtest>
+  iputtest();
+      d1:	e8 7a 00 00 00       	call   150 <iputtest>
+
+  mem();
+      d6:	e8 b5 14 00 00       	call   1590 <mem>
+  pipe1();
+      db:	e8 60 09 00 00       	call   a40 <pipe1>
+  pipesizetest();
+      e0:	e8 fb 0a 00 00       	call   be0 <pipesizetest>
+  splicetest();
+      e5:	e8 d6 0c 00 00       	call   dc0 <splicetest>
+  copyrangetest();
+      ea:	e8 a1 10 00 00       	call   1190 <copyrangetest>
+  preempt();
+      ef:	e8 bc 12 00 00       	call   13b0 <preempt>
+  exitwait();
+      f4:	e8 17 14 00 00       	call   1510 <exitwait>
+
+  rmdot();
+      f9:	e8 52 3b 00 00       	call   3c50 <rmdot>
+  fourteen();
+      fe:	e8 0d 3a 00 00       	call   3b10 <fourteen>
+  bigfile();
+     103:	e8 28 34 00 00       	call   3530 <bigfile>
+  extenttest();
+     108:	e8 f3 35 00 00       	call   3700 <extenttest>
+  extentfull();
+     10d:	e8 2e 38 00 00       	call   3940 <extentfull>
+  subdir();
+     112:	e8 79 2a 00 00       	call   2b90 <subdir>
+  linktest();
+     117:	e8 94 1c 00 00       	call   1db0 <linktest>
+  unlinkread();
+     11c:	e8 ff 1a 00 00       	call   1c20 <unlinkread>
+  dirfile();
+     121:	e8 aa 3c 00 00       	call   3dd0 <dirfile>
+  iref();
+     126:	e8 65 41 00 00       	call   4290 <iref>
+  manyinodes();
+     12b:	e8 a0 3e 00 00       	call   3fd0 <manyinodes>
+  forktest();
+     130:	e8 7b 42 00 00       	call   43b0 <forktest>
+  bigdir(); // slow
+     135:	e8 b6 26 00 00       	call   27f0 <bigdir>
+  indexdir();
+     13a:	e8 e1 27 00 00       	call   2920 <indexdir>
+
+  uio();
+     13f:	e8 9c 4e 00 00       	call   4fe0 <uio>
+
+  exectest();
+     144:	e8 a7 08 00 00       	call   9f0 <exectest>
+
+  exit();
+     149:	e8 d5 51 00 00       	call   5323 <exit>
+     14e:	66 90                	xchg   %ax,%ax
+
+00000150 <iputtest>:
+{
+     150:	55                   	push   %ebp
+     151:	89 e5                	mov    %esp,%ebp
+     153:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+     156:	68 4c 58 00 00       	push   $0x584c
+     15b:	ff 35 b0 83 00 00    	push   0x83b0
+     161:	e8 2a 53 00 00       	call   5490 <printf>
+  if(mkdir("iputdir") < 0){
+     166:	c7 04 24 df 57 00 00 	movl   $0x57df,(%esp)
+     16d:	e8 19 52 00 00       	call   538b <mkdir>
+     172:	83 c4 10             	add    $0x10,%esp
+     175:	85 c0                	test   %eax,%eax
+     177:	78 58                	js     1d1 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+     179:	83 ec 0c             	sub    $0xc,%esp
+     17c:	68 df 57 00 00       	push   $0x57df
+     181:	e8 0d 52 00 00       	call   5393 <chdir>
+     186:	83 c4 10             	add    $0x10,%esp
+     189:	85 c0                	test   %eax,%eax
+     18b:	0f 88 85 00 00 00    	js     216 <iputtest+0xc6>
+  if(unlink("../iputdir") < 0){
+     191:	83 ec 0c             	sub    $0xc,%esp
+     194:	68 dc 57 00 00       	push   $0x57dc
+     199:	e8 d5 51 00 00       	call   5373 <unlink>
+     19e:	83 c4 10             	add    $0x10,%esp
+     1a1:	85 c0                	test   %eax,%eax
+     1a3:	78 5a                	js     1ff <iputtest+0xaf>
+  if(chdir("/") < 0){
+     1a5:	83 ec 0c             	sub    $0xc,%esp
+     1a8:	68 01 58 00 00       	push   $0x5801
+     1ad:	e8 e1 51 00 00       	call   5393 <chdir>
+     1b2:	83 c4 10             	add    $0x10,%esp
+     1b5:	85 c0                	test   %eax,%eax
+     1b7:	78 2f                	js     1e8 <iputtest+0x98>
+  printf(stdout, "iput test ok\n");
+     1b9:	83 ec 08             	sub    $0x8,%esp
+     1bc:	68 75 58 00 00       	push   $0x5875
+     1c1:	ff 35 b0 83 00 00    	push   0x83b0
+     1c7:	e8 c4 52 00 00       	call   5490 <printf>
+}
+     1cc:	83 c4 10             	add    $0x10,%esp
+     1cf:	c9                   	leave
+     1d0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     1d1:	50                   	push   %eax
+     1d2:	50                   	push   %eax
+     1d3:	68 b8 57 00 00       	push   $0x57b8
+     1d8:	ff 35 b0 83 00 00    	push   0x83b0
+     1de:	e8 ad 52 00 00       	call   5490 <printf>
+    exit();
+     1e3:	e8 3b 51 00 00       	call   5323 <exit>
+    printf(stdout, "chdir / failed\n");
+     1e8:	50                   	push   %eax
+     1e9:	50                   	push   %eax
+     1ea:	68 03 58 00 00       	push   $0x5803
+     1ef:	ff 35 b0 83 00 00    	push   0x83b0
+     1f5:	e8 96 52 00 00       	call   5490 <printf>
+    exit();
+     1fa:	e8 24 51 00 00       	call   5323 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     1ff:	52                   	push   %edx
+     200:	52                   	push   %edx
+     201:	68 e7 57 00 00       	push   $0x57e7
+     206:	ff 35 b0 83 00 00    	push   0x83b0
+     20c:	e8 7f 52 00 00       	call   5490 <printf>
+    exit();
+     211:	e8 0d 51 00 00       	call   5323 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     216:	51                   	push   %ecx
+     217:	51                   	push   %ecx
+     218:	68 c6 57 00 00       	push   $0x57c6
+     21d:	ff 35 b0 83 00 00    	push   0x83b0
+     223:	e8 68 52 00 00       	call   5490 <printf>
+    exit();
+     228:	e8 f6 50 00 00       	call   5323 <exit>
+     22d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000230 <exitiputtest>:
+{
+     230:	55                   	push   %ebp
+     231:	89 e5                	mov    %esp,%ebp
+     233:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     236:	68 13 58 00 00       	push   $0x5813
+     23b:	ff 35 b0 83 00 00    	push   0x83b0
+     241:	e8 4a 52 00 00       	call   5490 <printf>
+  pid = fork();
+     246:	e8 d0 50 00 00       	call   531b <fork>
+  if(pid < 0){
+     24b:	83 c4 10             	add    $0x10,%esp
+     24e:	85 c0                	test   %eax,%eax
+     250:	0f 88 8a 00 00 00    	js     2e0 <exitiputtest+0xb0>
+  if(pid == 0){
+     256:	75 50                	jne    2a8 <exitiputtest+0x78>
+    if(mkdir("iputdir") < 0){
+     258:	83 ec 0c             	sub    $0xc,%esp
+     25b:	68 df 57 00 00       	push   $0x57df
+     260:	e8 26 51 00 00       	call   538b <mkdir>
+     265:	83 c4 10             	add    $0x10,%esp
+     268:	85 c0                	test   %eax,%eax
+     26a:	0f 88 87 00 00 00    	js     2f7 <exitiputtest+0xc7>
+    if(chdir("iputdir") < 0){
+     270:	83 ec 0c             	sub    $0xc,%esp
+     273:	68 df 57 00 00       	push   $0x57df
+     278:	e8 16 51 00 00       	call   5393 <chdir>
+     27d:	83 c4 10             	add    $0x10,%esp
+     280:	85 c0                	test   %eax,%eax
+     282:	0f 88 86 00 00 00    	js     30e <exitiputtest+0xde>
+    if(unlink("../iputdir") < 0){
+     288:	83 ec 0c             	sub    $0xc,%esp
+     28b:	68 dc 57 00 00       	push   $0x57dc
+     290:	e8 de 50 00 00       	call   5373 <unlink>
+     295:	83 c4 10             	add    $0x10,%esp
+     298:	85 c0                	test   %eax,%eax
+     29a:	78 2c                	js     2c8 <exitiputtest+0x98>
+    exit();
+     29c:	e8 82 50 00 00       	call   5323 <exit>
+     2a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+     2a8:	e8 7e 50 00 00       	call   532b <wait>
+  printf(stdout, "exitiput test ok\n");
+     2ad:	83 ec 08             	sub    $0x8,%esp
+     2b0:	68 36 58 00 00       	push   $0x5836
+     2b5:	ff 35 b0 83 00 00    	push   0x83b0
+     2bb:	e8 d0 51 00 00       	call   5490 <printf>
+}
+     2c0:	83 c4 10             	add    $0x10,%esp
+     2c3:	c9                   	leave
+     2c4:	c3                   	ret
+     2c5:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+     2c8:	83 ec 08             	sub    $0x8,%esp
+     2cb:	68 e7 57 00 00       	push   $0x57e7
+     2d0:	ff 35 b0 83 00 00    	push   0x83b0
+     2d6:	e8 b5 51 00 00       	call   5490 <printf>
+      exit();
+     2db:	e8 43 50 00 00       	call   5323 <exit>
+    printf(stdout, "fork failed\n");
+     2e0:	51                   	push   %ecx
+     2e1:	51                   	push   %ecx
+     2e2:	68 6f 6d 00 00       	push   $0x6d6f
+     2e7:	ff 35 b0 83 00 00    	push   0x83b0
+     2ed:	e8 9e 51 00 00       	call   5490 <printf>
+    exit();
+     2f2:	e8 2c 50 00 00       	call   5323 <exit>
+      printf(stdout, "mkdir failed\n");
+     2f7:	52                   	push   %edx
+     2f8:	52                   	push   %edx
+     2f9:	68 b8 57 00 00       	push   $0x57b8
+     2fe:	ff 35 b0 83 00 00    	push   0x83b0
+     304:	e8 87 51 00 00       	call   5490 <printf>
+      exit();
+     309:	e8 15 50 00 00       	call   5323 <exit>
+      printf(stdout, "child chdir failed\n");
+     30e:	50                   	push   %eax
+     30f:	50                   	push   %eax
+     310:	68 22 58 00 00       	push   $0x5822
+     315:	ff 35 b0 83 00 00    	push   0x83b0
+     31b:	e8 70 51 00 00       	call   5490 <printf>
+      exit();
+     320:	e8 fe 4f 00 00       	call   5323 <exit>
+     325:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <openiputtest>:
+{
+     330:	55                   	push   %ebp
+     331:	89 e5                	mov    %esp,%ebp
+     333:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     336:	68 48 58 00 00       	push   $0x5848
+     33b:	ff 35 b0 83 00 00    	push   0x83b0
+     341:	e8 4a 51 00 00       	call   5490 <printf>
+  if(mkdir("oidir") < 0){
+     346:	c7 04 24 57 58 00 00 	movl   $0x5857,(%esp)
+     34d:	e8 39 50 00 00       	call   538b <mkdir>
+     352:	83 c4 10             	add    $0x10,%esp
+     355:	85 c0                	test   %eax,%eax
+     357:	0f 88 9f 00 00 00    	js     3fc <openiputtest+0xcc>
+  pid = fork();
+     35d:	e8 b9 4f 00 00       	call   531b <fork>
+  if(pid < 0){
+     362:	85 c0                	test   %eax,%eax
+     364:	78 7f                	js     3e5 <openiputtest+0xb5>
+  if(pid == 0){
+     366:	75 38                	jne    3a0 <openiputtest+0x70>
+    int fd = open("oidir", O_RDWR);
+     368:	83 ec 08             	sub    $0x8,%esp
+     36b:	6a 02                	push   $0x2
+     36d:	68 57 58 00 00       	push   $0x5857
+     372:	e8 ec 4f 00 00       	call   5363 <open>
+    if(fd >= 0){
+     377:	83 c4 10             	add    $0x10,%esp
+     37a:	85 c0                	test   %eax,%eax
+     37c:	78 62                	js     3e0 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     37e:	83 ec 08             	sub    $0x8,%esp
+     381:	68 40 6e 00 00       	push   $0x6e40
+     386:	ff 35 b0 83 00 00    	push   0x83b0
+     38c:	e8 ff 50 00 00       	call   5490 <printf>
+      exit();
+     391:	e8 8d 4f 00 00       	call   5323 <exit>
+     396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     39d:	8d 76 00             	lea    0x0(%esi),%esi
+  sleep(1);
+     3a0:	83 ec 0c             	sub    $0xc,%esp
+     3a3:	6a 01                	push   $0x1
+     3a5:	e8 09 50 00 00       	call   53b3 <sleep>
+  if(unlink("oidir") != 0){
+     3aa:	c7 04 24 57 58 00 00 	movl   $0x5857,(%esp)
+     3b1:	e8 bd 4f 00 00       	call   5373 <unlink>
+     3b6:	83 c4 10             	add    $0x10,%esp
+     3b9:	85 c0                	test   %eax,%eax
+     3bb:	75 56                	jne    413 <openiputtest+0xe3>
+  wait();
+     3bd:	e8 69 4f 00 00       	call   532b <wait>
+  printf(stdout, "openiput test ok\n");
+     3c2:	83 ec 08             	sub    $0x8,%esp
+     3c5:	68 71 58 00 00       	push   $0x5871
+     3ca:	ff 35 b0 83 00 00    	push   0x83b0
+     3d0:	e8 bb 50 00 00       	call   5490 <printf>
+}
+     3d5:	83 c4 10             	add    $0x10,%esp
+     3d8:	c9                   	leave
+     3d9:	c3                   	ret
+     3da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+     3e0:	e8 3e 4f 00 00       	call   5323 <exit>
+    printf(stdout, "fork failed\n");
+     3e5:	52                   	push   %edx
+     3e6:	52                   	push   %edx
+     3e7:	68 6f 6d 00 00       	push   $0x6d6f
+     3ec:	ff 35 b0 83 00 00    	push   0x83b0
+     3f2:	e8 99 50 00 00       	call   5490 <printf>
+    exit();
+     3f7:	e8 27 4f 00 00       	call   5323 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     3fc:	51                   	push   %ecx
+     3fd:	51                   	push   %ecx
+     3fe:	68 5d 58 00 00       	push   $0x585d
+     403:	ff 35 b0 83 00 00    	push   0x83b0
+     409:	e8 82 50 00 00       	call   5490 <printf>
+    exit();
+     40e:	e8 10 4f 00 00       	call   5323 <exit>
+    printf(stdout, "unlink failed\n");
+     413:	50                   	push   %eax
+     414:	50                   	push   %eax
+     415:	68 23 61 00 00       	push   $0x6123
+     41a:	ff 35 b0 83 00 00    	push   0x83b0
+     420:	e8 6b 50 00 00       	call   5490 <printf>
+    exit();
+     425:	e8 f9 4e 00 00       	call   5323 <exit>
+     42a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000430 <opentest>:
+{
+     430:	55                   	push   %ebp
+     431:	89 e5                	mov    %esp,%ebp
+     433:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     436:	68 83 58 00 00       	push   $0x5883
+     43b:	ff 35 b0 83 00 00    	push   0x83b0
+     441:	e8 4a 50 00 00       	call   5490 <printf>
+  fd = open("echo", 0);
+     446:	58                   	pop    %eax
+     447:	5a                   	pop    %edx
+     448:	6a 00                	push   $0x0
+     44a:	68 8e 58 00 00       	push   $0x588e
+     44f:	e8 0f 4f 00 00       	call   5363 <open>
+  if(fd < 0){
+     454:	83 c4 10             	add    $0x10,%esp
+     457:	85 c0                	test   %eax,%eax
+     459:	78 36                	js     491 <opentest+0x61>
+  close(fd);
+     45b:	83 ec 0c             	sub    $0xc,%esp
+     45e:	50                   	push   %eax
+     45f:	e8 e7 4e 00 00       	call   534b <close>
+  fd = open("doesnotexist", 0);
+     464:	5a                   	pop    %edx
+     465:	59                   	pop    %ecx
+     466:	6a 00                	push   $0x0
+     468:	68 a6 58 00 00       	push   $0x58a6
+     46d:	e8 f1 4e 00 00       	call   5363 <open>
+  if(fd >= 0){
+     472:	83 c4 10             	add    $0x10,%esp
+     475:	85 c0                	test   %eax,%eax
+     477:	79 2f                	jns    4a8 <opentest+0x78>
+  printf(stdout, "open test ok\n");
+     479:	83 ec 08             	sub    $0x8,%esp
+     47c:	68 d1 58 00 00       	push   $0x58d1
+     481:	ff 35 b0 83 00 00    	push   0x83b0
+     487:	e8 04 50 00 00       	call   5490 <printf>
+}
+     48c:	83 c4 10             	add    $0x10,%esp
+     48f:	c9                   	leave
+     490:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     491:	50                   	push   %eax
+     492:	50                   	push   %eax
+     493:	68 93 58 00 00       	push   $0x5893
+     498:	ff 35 b0 83 00 00    	push   0x83b0
+     49e:	e8 ed 4f 00 00       	call   5490 <printf>
+    exit();
+     4a3:	e8 7b 4e 00 00       	call   5323 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     4a8:	50                   	push   %eax
+     4a9:	50                   	push   %eax
+     4aa:	68 b3 58 00 00       	push   $0x58b3
+     4af:	ff 35 b0 83 00 00    	push   0x83b0
+     4b5:	e8 d6 4f 00 00       	call   5490 <printf>
+    exit();
+     4ba:	e8 64 4e 00 00       	call   5323 <exit>
+     4bf:	90                   	nop
+
+000004c0 <writetest>:
+{
+     4c0:	55                   	push   %ebp
+     4c1:	89 e5                	mov    %esp,%ebp
+     4c3:	56                   	push   %esi
+     4c4:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     4c5:	83 ec 08             	sub    $0x8,%esp
+     4c8:	68 df 58 00 00       	push   $0x58df
+     4cd:	ff 35 b0 83 00 00    	push   0x83b0
+     4d3:	e8 b8 4f 00 00       	call   5490 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     4d8:	58                   	pop    %eax
+     4d9:	5a                   	pop    %edx
+     4da:	68 02 02 00 00       	push   $0x202
+     4df:	68 f0 58 00 00       	push   $0x58f0
+     4e4:	e8 7a 4e 00 00       	call   5363 <open>
+  if(fd >= 0){
+     4e9:	83 c4 10             	add    $0x10,%esp
+     4ec:	85 c0                	test   %eax,%eax
+     4ee:	0f 88 88 01 00 00    	js     67c <writetest+0x1bc>
+    printf(stdout, "creat small succeeded; ok\n");
+     4f4:	83 ec 08             	sub    $0x8,%esp
+     4f7:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     4f9:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     4fb:	68 f6 58 00 00       	push   $0x58f6
+     500:	ff 35 b0 83 00 00    	push   0x83b0
+     506:	e8 85 4f 00 00       	call   5490 <printf>
+     50b:	83 c4 10             	add    $0x10,%esp
+     50e:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     510:	83 ec 04             	sub    $0x4,%esp
+     513:	6a 0a                	push   $0xa
+     515:	68 2d 59 00 00       	push   $0x592d
+     51a:	56                   	push   %esi
+     51b:	e8 23 4e 00 00       	call   5343 <write>
+     520:	83 c4 10             	add    $0x10,%esp
+     523:	83 f8 0a             	cmp    $0xa,%eax
+     526:	0f 85 d9 00 00 00    	jne    605 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     52c:	83 ec 04             	sub    $0x4,%esp
+     52f:	6a 0a                	push   $0xa
+     531:	68 38 59 00 00       	push   $0x5938
+     536:	56                   	push   %esi
+     537:	e8 07 4e 00 00       	call   5343 <write>
+     53c:	83 c4 10             	add    $0x10,%esp
+     53f:	83 f8 0a             	cmp    $0xa,%eax
+     542:	0f 85 d6 00 00 00    	jne    61e <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+     548:	83 c3 01             	add    $0x1,%ebx
+     54b:	83 fb 64             	cmp    $0x64,%ebx
+     54e:	75 c0                	jne    510 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     550:	83 ec 08             	sub    $0x8,%esp
+     553:	68 43 59 00 00       	push   $0x5943
+     558:	ff 35 b0 83 00 00    	push   0x83b0
+     55e:	e8 2d 4f 00 00       	call   5490 <printf>
+  close(fd);
+     563:	89 34 24             	mov    %esi,(%esp)
+     566:	e8 e0 4d 00 00       	call   534b <close>
+  fd = open("small", O_RDONLY);
+     56b:	5b                   	pop    %ebx
+     56c:	5e                   	pop    %esi
+     56d:	6a 00                	push   $0x0
+     56f:	68 f0 58 00 00       	push   $0x58f0
+     574:	e8 ea 4d 00 00       	call   5363 <open>
+  if(fd >= 0){
+     579:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     57c:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     57e:	85 c0                	test   %eax,%eax
+     580:	0f 88 b1 00 00 00    	js     637 <writetest+0x177>
+    printf(stdout, "open small succeeded ok\n");
+     586:	83 ec 08             	sub    $0x8,%esp
+     589:	68 4e 59 00 00       	push   $0x594e
+     58e:	ff 35 b0 83 00 00    	push   0x83b0
+     594:	e8 f7 4e 00 00       	call   5490 <printf>
+  i = read(fd, buf, 2000);
+     599:	83 c4 0c             	add    $0xc,%esp
+     59c:	68 d0 07 00 00       	push   $0x7d0
+     5a1:	68 00 ab 00 00       	push   $0xab00
+     5a6:	53                   	push   %ebx
+     5a7:	e8 8f 4d 00 00       	call   533b <read>
+  if(i == 2000){
+     5ac:	83 c4 10             	add    $0x10,%esp
+     5af:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     5b4:	0f 85 94 00 00 00    	jne    64e <writetest+0x18e>
+    printf(stdout, "read succeeded ok\n");
+     5ba:	83 ec 08             	sub    $0x8,%esp
+     5bd:	68 82 59 00 00       	push   $0x5982
+     5c2:	ff 35 b0 83 00 00    	push   0x83b0
+     5c8:	e8 c3 4e 00 00       	call   5490 <printf>
+  close(fd);
+     5cd:	89 1c 24             	mov    %ebx,(%esp)
+     5d0:	e8 76 4d 00 00       	call   534b <close>
+  if(unlink("small") < 0){
+     5d5:	c7 04 24 f0 58 00 00 	movl   $0x58f0,(%esp)
+     5dc:	e8 92 4d 00 00       	call   5373 <unlink>
+     5e1:	83 c4 10             	add    $0x10,%esp
+     5e4:	85 c0                	test   %eax,%eax
+     5e6:	78 7d                	js     665 <writetest+0x1a5>
+  printf(stdout, "small file test ok\n");
+     5e8:	83 ec 08             	sub    $0x8,%esp
+     5eb:	68 aa 59 00 00       	push   $0x59aa
+     5f0:	ff 35 b0 83 00 00    	push   0x83b0
+     5f6:	e8 95 4e 00 00       	call   5490 <printf>
+}
+     5fb:	83 c4 10             	add    $0x10,%esp
+     5fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     601:	5b                   	pop    %ebx
+     602:	5e                   	pop    %esi
+     603:	5d                   	pop    %ebp
+     604:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     605:	83 ec 04             	sub    $0x4,%esp
+     608:	53                   	push   %ebx
+     609:	68 64 6e 00 00       	push   $0x6e64
+     60e:	ff 35 b0 83 00 00    	push   0x83b0
+     614:	e8 77 4e 00 00       	call   5490 <printf>
+      exit();
+     619:	e8 05 4d 00 00       	call   5323 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     61e:	83 ec 04             	sub    $0x4,%esp
+     621:	53                   	push   %ebx
+     622:	68 88 6e 00 00       	push   $0x6e88
+     627:	ff 35 b0 83 00 00    	push   0x83b0
+     62d:	e8 5e 4e 00 00       	call   5490 <printf>
+      exit();
+     632:	e8 ec 4c 00 00       	call   5323 <exit>
+    printf(stdout, "error: open small failed!\n");
+     637:	51                   	push   %ecx
+     638:	51                   	push   %ecx
+     639:	68 67 59 00 00       	push   $0x5967
+     63e:	ff 35 b0 83 00 00    	push   0x83b0
+     644:	e8 47 4e 00 00       	call   5490 <printf>
+    exit();
+     649:	e8 d5 4c 00 00       	call   5323 <exit>
+    printf(stdout, "read failed\n");
+     64e:	52                   	push   %edx
+     64f:	52                   	push   %edx
+     650:	68 c5 66 00 00       	push   $0x66c5
+     655:	ff 35 b0 83 00 00    	push   0x83b0
+     65b:	e8 30 4e 00 00       	call   5490 <printf>
+    exit();
+     660:	e8 be 4c 00 00       	call   5323 <exit>
+    printf(stdout, "unlink small failed\n");
+     665:	50                   	push   %eax
+     666:	50                   	push   %eax
+     667:	68 95 59 00 00       	push   $0x5995
+     66c:	ff 35 b0 83 00 00    	push   0x83b0
+     672:	e8 19 4e 00 00       	call   5490 <printf>
+    exit();
+     677:	e8 a7 4c 00 00       	call   5323 <exit>
+    printf(stdout, "error: creat small failed!\n");
+     67c:	50                   	push   %eax
+     67d:	50                   	push   %eax
+     67e:	68 11 59 00 00       	push   $0x5911
+     683:	ff 35 b0 83 00 00    	push   0x83b0
+     689:	e8 02 4e 00 00       	call   5490 <printf>
+    exit();
+     68e:	e8 90 4c 00 00       	call   5323 <exit>
+     693:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     69a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000006a0 <writetest1>:
+{
+     6a0:	55                   	push   %ebp
+     6a1:	89 e5                	mov    %esp,%ebp
+     6a3:	56                   	push   %esi
+     6a4:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     6a5:	83 ec 08             	sub    $0x8,%esp
+     6a8:	68 be 59 00 00       	push   $0x59be
+     6ad:	ff 35 b0 83 00 00    	push   0x83b0
+     6b3:	e8 d8 4d 00 00       	call   5490 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     6b8:	58                   	pop    %eax
+     6b9:	5a                   	pop    %edx
+     6ba:	68 02 02 00 00       	push   $0x202
+     6bf:	68 38 5a 00 00       	push   $0x5a38
+     6c4:	e8 9a 4c 00 00       	call   5363 <open>
+  if(fd < 0){
+     6c9:	83 c4 10             	add    $0x10,%esp
+     6cc:	85 c0                	test   %eax,%eax
+     6ce:	0f 88 5d 01 00 00    	js     831 <writetest1+0x191>
+     6d4:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < BIGBLOCKS; i++){
+     6d6:	31 db                	xor    %ebx,%ebx
+     6d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6df:	90                   	nop
+    if(write(fd, buf, 512) != 512){
+     6e0:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     6e3:	89 1d 00 ab 00 00    	mov    %ebx,0xab00
+    if(write(fd, buf, 512) != 512){
+     6e9:	68 00 02 00 00       	push   $0x200
+     6ee:	68 00 ab 00 00       	push   $0xab00
+     6f3:	56                   	push   %esi
+     6f4:	e8 4a 4c 00 00       	call   5343 <write>
+     6f9:	83 c4 10             	add    $0x10,%esp
+     6fc:	3d 00 02 00 00       	cmp    $0x200,%eax
+     701:	0f 85 b3 00 00 00    	jne    7ba <writetest1+0x11a>
+  for(i = 0; i < BIGBLOCKS; i++){
+     707:	83 c3 01             	add    $0x1,%ebx
+     70a:	81 fb 8a 01 00 00    	cmp    $0x18a,%ebx
+     710:	75 ce                	jne    6e0 <writetest1+0x40>
+  close(fd);
+     712:	83 ec 0c             	sub    $0xc,%esp
+     715:	56                   	push   %esi
+     716:	e8 30 4c 00 00       	call   534b <close>
+  fd = open("big", O_RDONLY);
+     71b:	5b                   	pop    %ebx
+     71c:	5e                   	pop    %esi
+     71d:	6a 00                	push   $0x0
+     71f:	68 38 5a 00 00       	push   $0x5a38
+     724:	e8 3a 4c 00 00       	call   5363 <open>
+  if(fd < 0){
+     729:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     72c:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     72e:	85 c0                	test   %eax,%eax
+     730:	0f 88 e4 00 00 00    	js     81a <writetest1+0x17a>
+  n = 0;
+     736:	31 f6                	xor    %esi,%esi
+     738:	eb 1d                	jmp    757 <writetest1+0xb7>
+     73a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+     740:	3d 00 02 00 00       	cmp    $0x200,%eax
+     745:	0f 85 9f 00 00 00    	jne    7ea <writetest1+0x14a>
+    if(((int*)buf)[0] != n){
+     74b:	a1 00 ab 00 00       	mov    0xab00,%eax
+     750:	39 f0                	cmp    %esi,%eax
+     752:	75 7f                	jne    7d3 <writetest1+0x133>
+    n++;
+     754:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+     757:	83 ec 04             	sub    $0x4,%esp
+     75a:	68 00 02 00 00       	push   $0x200
+     75f:	68 00 ab 00 00       	push   $0xab00
+     764:	53                   	push   %ebx
+     765:	e8 d1 4b 00 00       	call   533b <read>
+    if(i == 0){
+     76a:	83 c4 10             	add    $0x10,%esp
+     76d:	85 c0                	test   %eax,%eax
+     76f:	75 cf                	jne    740 <writetest1+0xa0>
+      if(n != BIGBLOCKS){
+     771:	81 fe 8a 01 00 00    	cmp    $0x18a,%esi
+     777:	0f 85 86 00 00 00    	jne    803 <writetest1+0x163>
+  close(fd);
+     77d:	83 ec 0c             	sub    $0xc,%esp
+     780:	53                   	push   %ebx
+     781:	e8 c5 4b 00 00       	call   534b <close>
+  if(unlink("big") < 0){
+     786:	c7 04 24 38 5a 00 00 	movl   $0x5a38,(%esp)
+     78d:	e8 e1 4b 00 00       	call   5373 <unlink>
+     792:	83 c4 10             	add    $0x10,%esp
+     795:	85 c0                	test   %eax,%eax
+     797:	0f 88 ab 00 00 00    	js     848 <writetest1+0x1a8>
+  printf(stdout, "big files ok\n");
+     79d:	83 ec 08             	sub    $0x8,%esp
+     7a0:	68 5f 5a 00 00       	push   $0x5a5f
+     7a5:	ff 35 b0 83 00 00    	push   0x83b0
+     7ab:	e8 e0 4c 00 00       	call   5490 <printf>
+}
+     7b0:	83 c4 10             	add    $0x10,%esp
+     7b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     7b6:	5b                   	pop    %ebx
+     7b7:	5e                   	pop    %esi
+     7b8:	5d                   	pop    %ebp
+     7b9:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     7ba:	83 ec 04             	sub    $0x4,%esp
+     7bd:	53                   	push   %ebx
+     7be:	68 e8 59 00 00       	push   $0x59e8
+     7c3:	ff 35 b0 83 00 00    	push   0x83b0
+     7c9:	e8 c2 4c 00 00       	call   5490 <printf>
+      exit();
+     7ce:	e8 50 4b 00 00       	call   5323 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     7d3:	50                   	push   %eax
+     7d4:	56                   	push   %esi
+     7d5:	68 ac 6e 00 00       	push   $0x6eac
+     7da:	ff 35 b0 83 00 00    	push   0x83b0
+     7e0:	e8 ab 4c 00 00       	call   5490 <printf>
+      exit();
+     7e5:	e8 39 4b 00 00       	call   5323 <exit>
+      printf(stdout, "read failed %d\n", i);
+     7ea:	83 ec 04             	sub    $0x4,%esp
+     7ed:	50                   	push   %eax
+     7ee:	68 3c 5a 00 00       	push   $0x5a3c
+     7f3:	ff 35 b0 83 00 00    	push   0x83b0
+     7f9:	e8 92 4c 00 00       	call   5490 <printf>
+      exit();
+     7fe:	e8 20 4b 00 00       	call   5323 <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     803:	52                   	push   %edx
+     804:	56                   	push   %esi
+     805:	68 1f 5a 00 00       	push   $0x5a1f
+     80a:	ff 35 b0 83 00 00    	push   0x83b0
+     810:	e8 7b 4c 00 00       	call   5490 <printf>
+        exit();
+     815:	e8 09 4b 00 00       	call   5323 <exit>
+    printf(stdout, "error: open big failed!\n");
+     81a:	51                   	push   %ecx
+     81b:	51                   	push   %ecx
+     81c:	68 06 5a 00 00       	push   $0x5a06
+     821:	ff 35 b0 83 00 00    	push   0x83b0
+     827:	e8 64 4c 00 00       	call   5490 <printf>
+    exit();
+     82c:	e8 f2 4a 00 00       	call   5323 <exit>
+    printf(stdout, "error: creat big failed!\n");
+     831:	50                   	push   %eax
+     832:	50                   	push   %eax
+     833:	68 ce 59 00 00       	push   $0x59ce
+     838:	ff 35 b0 83 00 00    	push   0x83b0
+     83e:	e8 4d 4c 00 00       	call   5490 <printf>
+    exit();
+     843:	e8 db 4a 00 00       	call   5323 <exit>
+    printf(stdout, "unlink big failed\n");
+     848:	50                   	push   %eax
+     849:	50                   	push   %eax
+     84a:	68 4c 5a 00 00       	push   $0x5a4c
+     84f:	ff 35 b0 83 00 00    	push   0x83b0
+     855:	e8 36 4c 00 00       	call   5490 <printf>
+    exit();
+     85a:	e8 c4 4a 00 00       	call   5323 <exit>
+     85f:	90                   	nop
+
+00000860 <createtest>:
+{
+     860:	55                   	push   %ebp
+     861:	89 e5                	mov    %esp,%ebp
+     863:	53                   	push   %ebx
+  name[2] = '\0';
+     864:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     869:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     86c:	68 cc 6e 00 00       	push   $0x6ecc
+     871:	ff 35 b0 83 00 00    	push   0x83b0
+     877:	e8 14 4c 00 00       	call   5490 <printf>
+  name[0] = 'a';
+     87c:	c6 05 f0 aa 00 00 61 	movb   $0x61,0xaaf0
+  name[2] = '\0';
+     883:	83 c4 10             	add    $0x10,%esp
+     886:	c6 05 f2 aa 00 00 00 	movb   $0x0,0xaaf2
+  for(i = 0; i < 52; i++){
+     88d:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     890:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     893:	88 1d f1 aa 00 00    	mov    %bl,0xaaf1
+  for(i = 0; i < 52; i++){
+     899:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     89c:	68 02 02 00 00       	push   $0x202
+     8a1:	68 f0 aa 00 00       	push   $0xaaf0
+     8a6:	e8 b8 4a 00 00       	call   5363 <open>
+    close(fd);
+     8ab:	89 04 24             	mov    %eax,(%esp)
+     8ae:	e8 98 4a 00 00       	call   534b <close>
+  for(i = 0; i < 52; i++){
+     8b3:	83 c4 10             	add    $0x10,%esp
+     8b6:	80 fb 64             	cmp    $0x64,%bl
+     8b9:	75 d5                	jne    890 <createtest+0x30>
+  name[0] = 'a';
+     8bb:	c6 05 f0 aa 00 00 61 	movb   $0x61,0xaaf0
+  name[2] = '\0';
+     8c2:	bb 30 00 00 00       	mov    $0x30,%ebx
+     8c7:	c6 05 f2 aa 00 00 00 	movb   $0x0,0xaaf2
+  for(i = 0; i < 52; i++){
+     8ce:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     8d0:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     8d3:	88 1d f1 aa 00 00    	mov    %bl,0xaaf1
+  for(i = 0; i < 52; i++){
+     8d9:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     8dc:	68 f0 aa 00 00       	push   $0xaaf0
+     8e1:	e8 8d 4a 00 00       	call   5373 <unlink>
+  for(i = 0; i < 52; i++){
+     8e6:	83 c4 10             	add    $0x10,%esp
+     8e9:	80 fb 64             	cmp    $0x64,%bl
+     8ec:	75 e2                	jne    8d0 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     8ee:	83 ec 08             	sub    $0x8,%esp
+     8f1:	68 f4 6e 00 00       	push   $0x6ef4
+     8f6:	ff 35 b0 83 00 00    	push   0x83b0
+     8fc:	e8 8f 4b 00 00       	call   5490 <printf>
+}
+     901:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     904:	83 c4 10             	add    $0x10,%esp
+     907:	c9                   	leave
+     908:	c3                   	ret
+     909:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000910 <dirtest>:
+{
+     910:	55                   	push   %ebp
+     911:	89 e5                	mov    %esp,%ebp
+     913:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     916:	68 6d 5a 00 00       	push   $0x5a6d
+     91b:	ff 35 b0 83 00 00    	push   0x83b0
+     921:	e8 6a 4b 00 00       	call   5490 <printf>
+  if(mkdir("dir0") < 0){
+     926:	c7 04 24 79 5a 00 00 	movl   $0x5a79,(%esp)
+     92d:	e8 59 4a 00 00       	call   538b <mkdir>
+     932:	83 c4 10             	add    $0x10,%esp
+     935:	85 c0                	test   %eax,%eax
+     937:	78 58                	js     991 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     939:	83 ec 0c             	sub    $0xc,%esp
+     93c:	68 79 5a 00 00       	push   $0x5a79
+     941:	e8 4d 4a 00 00       	call   5393 <chdir>
+     946:	83 c4 10             	add    $0x10,%esp
+     949:	85 c0                	test   %eax,%eax
+     94b:	0f 88 85 00 00 00    	js     9d6 <dirtest+0xc6>
+  if(chdir("..") < 0){
+     951:	83 ec 0c             	sub    $0xc,%esp
+     954:	68 38 64 00 00       	push   $0x6438
+     959:	e8 35 4a 00 00       	call   5393 <chdir>
+     95e:	83 c4 10             	add    $0x10,%esp
+     961:	85 c0                	test   %eax,%eax
+     963:	78 5a                	js     9bf <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+     965:	83 ec 0c             	sub    $0xc,%esp
+     968:	68 79 5a 00 00       	push   $0x5a79
+     96d:	e8 01 4a 00 00       	call   5373 <unlink>
+     972:	83 c4 10             	add    $0x10,%esp
+     975:	85 c0                	test   %eax,%eax
+     977:	78 2f                	js     9a8 <dirtest+0x98>
+  printf(stdout, "mkdir test ok\n");
+     979:	83 ec 08             	sub    $0x8,%esp
+     97c:	68 b6 5a 00 00       	push   $0x5ab6
+     981:	ff 35 b0 83 00 00    	push   0x83b0
+     987:	e8 04 4b 00 00       	call   5490 <printf>
+}
+     98c:	83 c4 10             	add    $0x10,%esp
+     98f:	c9                   	leave
+     990:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     991:	50                   	push   %eax
+     992:	50                   	push   %eax
+     993:	68 b8 57 00 00       	push   $0x57b8
+     998:	ff 35 b0 83 00 00    	push   0x83b0
+     99e:	e8 ed 4a 00 00       	call   5490 <printf>
+    exit();
+     9a3:	e8 7b 49 00 00       	call   5323 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     9a8:	50                   	push   %eax
+     9a9:	50                   	push   %eax
+     9aa:	68 a2 5a 00 00       	push   $0x5aa2
+     9af:	ff 35 b0 83 00 00    	push   0x83b0
+     9b5:	e8 d6 4a 00 00       	call   5490 <printf>
+    exit();
+     9ba:	e8 64 49 00 00       	call   5323 <exit>
+    printf(stdout, "chdir .. failed\n");
+     9bf:	52                   	push   %edx
+     9c0:	52                   	push   %edx
+     9c1:	68 91 5a 00 00       	push   $0x5a91
+     9c6:	ff 35 b0 83 00 00    	push   0x83b0
+     9cc:	e8 bf 4a 00 00       	call   5490 <printf>
+    exit();
+     9d1:	e8 4d 49 00 00       	call   5323 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     9d6:	51                   	push   %ecx
+     9d7:	51                   	push   %ecx
+     9d8:	68 7e 5a 00 00       	push   $0x5a7e
+     9dd:	ff 35 b0 83 00 00    	push   0x83b0
+     9e3:	e8 a8 4a 00 00       	call   5490 <printf>
+    exit();
+     9e8:	e8 36 49 00 00       	call   5323 <exit>
+     9ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009f0 <exectest>:
+{
+     9f0:	55                   	push   %ebp
+     9f1:	89 e5                	mov    %esp,%ebp
+     9f3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     9f6:	68 c5 5a 00 00       	push   $0x5ac5
+     9fb:	ff 35 b0 83 00 00    	push   0x83b0
+     a01:	e8 8a 4a 00 00       	call   5490 <printf>
+  if(exec("echo", echoargv) < 0){
+     a06:	5a                   	pop    %edx
+     a07:	59                   	pop    %ecx
+     a08:	68 b4 83 00 00       	push   $0x83b4
+     a0d:	68 8e 58 00 00       	push   $0x588e
+     a12:	e8 44 49 00 00       	call   535b <exec>
+     a17:	83 c4 10             	add    $0x10,%esp
+     a1a:	85 c0                	test   %eax,%eax
+     a1c:	78 02                	js     a20 <exectest+0x30>
+}
+     a1e:	c9                   	leave
+     a1f:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     a20:	50                   	push   %eax
+     a21:	50                   	push   %eax
+     a22:	68 d0 5a 00 00       	push   $0x5ad0
+     a27:	ff 35 b0 83 00 00    	push   0x83b0
+     a2d:	e8 5e 4a 00 00       	call   5490 <printf>
+    exit();
+     a32:	e8 ec 48 00 00       	call   5323 <exit>
+     a37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a3e:	66 90                	xchg   %ax,%ax
+
+00000a40 <pipe1>:
+{
+     a40:	55                   	push   %ebp
+     a41:	89 e5                	mov    %esp,%ebp
+     a43:	57                   	push   %edi
+     a44:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     a45:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     a48:	53                   	push   %ebx
+     a49:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     a4c:	50                   	push   %eax
+     a4d:	e8 e1 48 00 00       	call   5333 <pipe>
+     a52:	83 c4 10             	add    $0x10,%esp
+     a55:	85 c0                	test   %eax,%eax
+     a57:	0f 85 41 01 00 00    	jne    b9e <pipe1+0x15e>
+     a5d:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     a5f:	e8 b7 48 00 00       	call   531b <fork>
+  if(pid == 0){
+     a64:	85 c0                	test   %eax,%eax
+     a66:	0f 84 92 00 00 00    	je     afe <pipe1+0xbe>
+  } else if(pid > 0){
+     a6c:	0f 8e 3f 01 00 00    	jle    bb1 <pipe1+0x171>
+    close(fds[1]);
+     a72:	83 ec 0c             	sub    $0xc,%esp
+     a75:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     a78:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     a7a:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     a7f:	e8 c7 48 00 00       	call   534b <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     a84:	83 c4 10             	add    $0x10,%esp
+     a87:	83 ec 04             	sub    $0x4,%esp
+     a8a:	57                   	push   %edi
+     a8b:	68 00 ab 00 00       	push   $0xab00
+     a90:	ff 75 e0             	push   -0x20(%ebp)
+     a93:	e8 a3 48 00 00       	call   533b <read>
+     a98:	83 c4 10             	add    $0x10,%esp
+     a9b:	89 c1                	mov    %eax,%ecx
+     a9d:	85 c0                	test   %eax,%eax
+     a9f:	0f 8e b8 00 00 00    	jle    b5d <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     aa5:	89 f0                	mov    %esi,%eax
+     aa7:	32 05 00 ab 00 00    	xor    0xab00,%al
+     aad:	0f b6 c0             	movzbl %al,%eax
+     ab0:	85 c0                	test   %eax,%eax
+     ab2:	75 30                	jne    ae4 <pipe1+0xa4>
+     ab4:	83 c6 01             	add    $0x1,%esi
+     ab7:	eb 0f                	jmp    ac8 <pipe1+0x88>
+     ab9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ac0:	38 90 00 ab 00 00    	cmp    %dl,0xab00(%eax)
+     ac6:	75 1c                	jne    ae4 <pipe1+0xa4>
+     ac8:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     acb:	83 c0 01             	add    $0x1,%eax
+     ace:	39 c1                	cmp    %eax,%ecx
+     ad0:	75 ee                	jne    ac0 <pipe1+0x80>
+      cc = cc * 2;
+     ad2:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+     ad4:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+     ad9:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+     adb:	89 d6                	mov    %edx,%esi
+     add:	39 c7                	cmp    %eax,%edi
+     adf:	0f 4f f8             	cmovg  %eax,%edi
+     ae2:	eb a3                	jmp    a87 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+     ae4:	83 ec 08             	sub    $0x8,%esp
+     ae7:	68 ff 5a 00 00       	push   $0x5aff
+     aec:	6a 01                	push   $0x1
+     aee:	e8 9d 49 00 00       	call   5490 <printf>
+     af3:	83 c4 10             	add    $0x10,%esp
+}
+     af6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     af9:	5b                   	pop    %ebx
+     afa:	5e                   	pop    %esi
+     afb:	5f                   	pop    %edi
+     afc:	5d                   	pop    %ebp
+     afd:	c3                   	ret
+    close(fds[0]);
+     afe:	83 ec 0c             	sub    $0xc,%esp
+     b01:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+     b04:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+     b06:	e8 40 48 00 00       	call   534b <close>
+     b0b:	83 c4 10             	add    $0x10,%esp
+     b0e:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+     b10:	31 c0                	xor    %eax,%eax
+     b12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+     b18:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+     b1b:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     b1e:	88 90 ff aa 00 00    	mov    %dl,0xaaff(%eax)
+      for(i = 0; i < 1033; i++)
+     b24:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b29:	75 ed                	jne    b18 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+     b2b:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     b2e:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     b34:	68 09 04 00 00       	push   $0x409
+     b39:	68 00 ab 00 00       	push   $0xab00
+     b3e:	ff 75 e4             	push   -0x1c(%ebp)
+     b41:	e8 fd 47 00 00       	call   5343 <write>
+     b46:	83 c4 10             	add    $0x10,%esp
+     b49:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b4e:	75 74                	jne    bc4 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+     b50:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b56:	75 b8                	jne    b10 <pipe1+0xd0>
+    exit();
+     b58:	e8 c6 47 00 00       	call   5323 <exit>
+    if(total != 5 * 1033){
+     b5d:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b63:	75 26                	jne    b8b <pipe1+0x14b>
+    close(fds[0]);
+     b65:	83 ec 0c             	sub    $0xc,%esp
+     b68:	ff 75 e0             	push   -0x20(%ebp)
+     b6b:	e8 db 47 00 00       	call   534b <close>
+    wait();
+     b70:	e8 b6 47 00 00       	call   532b <wait>
+  printf(1, "pipe1 ok\n");
+     b75:	5a                   	pop    %edx
+     b76:	59                   	pop    %ecx
+     b77:	68 24 5b 00 00       	push   $0x5b24
+     b7c:	6a 01                	push   $0x1
+     b7e:	e8 0d 49 00 00       	call   5490 <printf>
+     b83:	83 c4 10             	add    $0x10,%esp
+     b86:	e9 6b ff ff ff       	jmp    af6 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     b8b:	56                   	push   %esi
+     b8c:	53                   	push   %ebx
+     b8d:	68 0d 5b 00 00       	push   $0x5b0d
+     b92:	6a 01                	push   $0x1
+     b94:	e8 f7 48 00 00       	call   5490 <printf>
+      exit();
+     b99:	e8 85 47 00 00       	call   5323 <exit>
+    printf(1, "pipe() failed\n");
+     b9e:	50                   	push   %eax
+     b9f:	50                   	push   %eax
+     ba0:	68 e2 5a 00 00       	push   $0x5ae2
+     ba5:	6a 01                	push   $0x1
+     ba7:	e8 e4 48 00 00       	call   5490 <printf>
+    exit();
+     bac:	e8 72 47 00 00       	call   5323 <exit>
+    printf(1, "fork() failed\n");
+     bb1:	50                   	push   %eax
+     bb2:	50                   	push   %eax
+     bb3:	68 2e 5b 00 00       	push   $0x5b2e
+     bb8:	6a 01                	push   $0x1
+     bba:	e8 d1 48 00 00       	call   5490 <printf>
+    exit();
+     bbf:	e8 5f 47 00 00       	call   5323 <exit>
+        printf(1, "pipe1 oops 1\n");
+     bc4:	57                   	push   %edi
+     bc5:	57                   	push   %edi
+     bc6:	68 f1 5a 00 00       	push   $0x5af1
+     bcb:	6a 01                	push   $0x1
+     bcd:	e8 be 48 00 00       	call   5490 <printf>
+        exit();
+     bd2:	e8 4c 47 00 00       	call   5323 <exit>
+     bd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bde:	66 90                	xchg   %ax,%ax
+
+00000be0 <pipesizetest>:
+{
+     be0:	55                   	push   %ebp
+     be1:	89 e5                	mov    %esp,%ebp
+     be3:	56                   	push   %esi
+     be4:	53                   	push   %ebx
+     be5:	83 ec 18             	sub    $0x18,%esp
+  printf(1, "pipesize test\n");
+     be8:	68 3d 5b 00 00       	push   $0x5b3d
+     bed:	6a 01                	push   $0x1
+     bef:	e8 9c 48 00 00       	call   5490 <printf>
+  if(pipe(fds) != 0){
+     bf4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     bf7:	89 04 24             	mov    %eax,(%esp)
+     bfa:	e8 34 47 00 00       	call   5333 <pipe>
+     bff:	83 c4 10             	add    $0x10,%esp
+     c02:	85 c0                	test   %eax,%eax
+     c04:	0f 85 8d 01 00 00    	jne    d97 <pipesizetest+0x1b7>
+  if(pipesize(fds[1], 3*4096) != 4*4096){
+     c0a:	83 ec 08             	sub    $0x8,%esp
+     c0d:	89 c3                	mov    %eax,%ebx
+     c0f:	68 00 30 00 00       	push   $0x3000
+     c14:	ff 75 f4             	push   -0xc(%ebp)
+     c17:	e8 af 47 00 00       	call   53cb <pipesize>
+     c1c:	83 c4 10             	add    $0x10,%esp
+     c1f:	3d 00 40 00 00       	cmp    $0x4000,%eax
+     c24:	0f 85 34 01 00 00    	jne    d5e <pipesizetest+0x17e>
+  for(i = 0; i < 5; i++){
+     c2a:	31 f6                	xor    %esi,%esi
+     c2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 3000);
+     c30:	83 ec 04             	sub    $0x4,%esp
+     c33:	68 b8 0b 00 00       	push   $0xbb8
+     c38:	56                   	push   %esi
+     c39:	68 00 ab 00 00       	push   $0xab00
+     c3e:	e8 5d 45 00 00       	call   51a0 <memset>
+    if(write(fds[1], buf, 3000) != 3000){
+     c43:	83 c4 0c             	add    $0xc,%esp
+     c46:	68 b8 0b 00 00       	push   $0xbb8
+     c4b:	68 00 ab 00 00       	push   $0xab00
+     c50:	ff 75 f4             	push   -0xc(%ebp)
+     c53:	e8 eb 46 00 00       	call   5343 <write>
+     c58:	83 c4 10             	add    $0x10,%esp
+     c5b:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+     c60:	0f 85 e4 00 00 00    	jne    d4a <pipesizetest+0x16a>
+  for(i = 0; i < 5; i++){
+     c66:	83 c6 01             	add    $0x1,%esi
+     c69:	83 fe 05             	cmp    $0x5,%esi
+     c6c:	75 c2                	jne    c30 <pipesizetest+0x50>
+  if(pipesize(fds[0], 4096) >= 0){
+     c6e:	83 ec 08             	sub    $0x8,%esp
+     c71:	68 00 10 00 00       	push   $0x1000
+     c76:	ff 75 f0             	push   -0x10(%ebp)
+     c79:	e8 4d 47 00 00       	call   53cb <pipesize>
+     c7e:	83 c4 10             	add    $0x10,%esp
+     c81:	85 c0                	test   %eax,%eax
+     c83:	0f 89 fb 00 00 00    	jns    d84 <pipesizetest+0x1a4>
+  if(pipesize(fds[0], 8*4096) != 8*4096){
+     c89:	83 ec 08             	sub    $0x8,%esp
+     c8c:	68 00 80 00 00       	push   $0x8000
+     c91:	ff 75 f0             	push   -0x10(%ebp)
+     c94:	e8 32 47 00 00       	call   53cb <pipesize>
+     c99:	83 c4 10             	add    $0x10,%esp
+     c9c:	3d 00 80 00 00       	cmp    $0x8000,%eax
+     ca1:	0f 85 ca 00 00 00    	jne    d71 <pipesizetest+0x191>
+  close(fds[1]);
+     ca7:	83 ec 0c             	sub    $0xc,%esp
+     caa:	ff 75 f4             	push   -0xc(%ebp)
+     cad:	e8 99 46 00 00       	call   534b <close>
+     cb2:	83 c4 10             	add    $0x10,%esp
+     cb5:	8d 76 00             	lea    0x0(%esi),%esi
+    if((n = read(fds[0], buf, 3000)) != 3000 ||
+     cb8:	83 ec 04             	sub    $0x4,%esp
+     cbb:	68 b8 0b 00 00       	push   $0xbb8
+     cc0:	68 00 ab 00 00       	push   $0xab00
+     cc5:	ff 75 f0             	push   -0x10(%ebp)
+     cc8:	e8 6e 46 00 00       	call   533b <read>
+     ccd:	83 c4 10             	add    $0x10,%esp
+     cd0:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+     cd5:	75 5e                	jne    d35 <pipesizetest+0x155>
+       buf[0] != i || buf[2999] != i){
+     cd7:	0f be 05 00 ab 00 00 	movsbl 0xab00,%eax
+    if((n = read(fds[0], buf, 3000)) != 3000 ||
+     cde:	39 d8                	cmp    %ebx,%eax
+     ce0:	75 53                	jne    d35 <pipesizetest+0x155>
+       buf[0] != i || buf[2999] != i){
+     ce2:	0f be 05 b7 b6 00 00 	movsbl 0xb6b7,%eax
+     ce9:	39 d8                	cmp    %ebx,%eax
+     ceb:	75 48                	jne    d35 <pipesizetest+0x155>
+  for(i = 0; i < 5; i++){
+     ced:	83 c3 01             	add    $0x1,%ebx
+     cf0:	83 fb 05             	cmp    $0x5,%ebx
+     cf3:	75 c3                	jne    cb8 <pipesizetest+0xd8>
+  if(read(fds[0], buf, 1) != 0){
+     cf5:	83 ec 04             	sub    $0x4,%esp
+     cf8:	6a 01                	push   $0x1
+     cfa:	68 00 ab 00 00       	push   $0xab00
+     cff:	ff 75 f0             	push   -0x10(%ebp)
+     d02:	e8 34 46 00 00       	call   533b <read>
+     d07:	83 c4 10             	add    $0x10,%esp
+     d0a:	85 c0                	test   %eax,%eax
+     d0c:	0f 85 98 00 00 00    	jne    daa <pipesizetest+0x1ca>
+  close(fds[0]);
+     d12:	83 ec 0c             	sub    $0xc,%esp
+     d15:	ff 75 f0             	push   -0x10(%ebp)
+     d18:	e8 2e 46 00 00       	call   534b <close>
+  printf(1, "pipesize ok\n");
+     d1d:	58                   	pop    %eax
+     d1e:	5a                   	pop    %edx
+     d1f:	68 bc 5b 00 00       	push   $0x5bbc
+     d24:	6a 01                	push   $0x1
+     d26:	e8 65 47 00 00       	call   5490 <printf>
+}
+     d2b:	83 c4 10             	add    $0x10,%esp
+     d2e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d31:	5b                   	pop    %ebx
+     d32:	5e                   	pop    %esi
+     d33:	5d                   	pop    %ebp
+     d34:	c3                   	ret
+      printf(1, "pipesize: read %d bad\n", i);
+     d35:	83 ec 04             	sub    $0x4,%esp
+     d38:	53                   	push   %ebx
+     d39:	68 8f 5b 00 00       	push   $0x5b8f
+     d3e:	6a 01                	push   $0x1
+     d40:	e8 4b 47 00 00       	call   5490 <printf>
+      exit();
+     d45:	e8 d9 45 00 00       	call   5323 <exit>
+      printf(1, "pipesize: write failed\n");
+     d4a:	83 ec 08             	sub    $0x8,%esp
+     d4d:	68 60 5b 00 00       	push   $0x5b60
+     d52:	6a 01                	push   $0x1
+     d54:	e8 37 47 00 00       	call   5490 <printf>
+      exit();
+     d59:	e8 c5 45 00 00       	call   5323 <exit>
+    printf(1, "pipesize: bad size\n");
+     d5e:	50                   	push   %eax
+     d5f:	50                   	push   %eax
+     d60:	68 4c 5b 00 00       	push   $0x5b4c
+     d65:	6a 01                	push   $0x1
+     d67:	e8 24 47 00 00       	call   5490 <printf>
+    exit();
+     d6c:	e8 b2 45 00 00       	call   5323 <exit>
+    printf(1, "pipesize: grow failed\n");
+     d71:	53                   	push   %ebx
+     d72:	53                   	push   %ebx
+     d73:	68 78 5b 00 00       	push   $0x5b78
+     d78:	6a 01                	push   $0x1
+     d7a:	e8 11 47 00 00       	call   5490 <printf>
+    exit();
+     d7f:	e8 9f 45 00 00       	call   5323 <exit>
+    printf(1, "pipesize: shrank below its data\n");
+     d84:	56                   	push   %esi
+     d85:	56                   	push   %esi
+     d86:	68 1c 6f 00 00       	push   $0x6f1c
+     d8b:	6a 01                	push   $0x1
+     d8d:	e8 fe 46 00 00       	call   5490 <printf>
+    exit();
+     d92:	e8 8c 45 00 00       	call   5323 <exit>
+    printf(1, "pipe() failed\n");
+     d97:	50                   	push   %eax
+     d98:	50                   	push   %eax
+     d99:	68 e2 5a 00 00       	push   $0x5ae2
+     d9e:	6a 01                	push   $0x1
+     da0:	e8 eb 46 00 00       	call   5490 <printf>
+    exit();
+     da5:	e8 79 45 00 00       	call   5323 <exit>
+    printf(1, "pipesize: extra data\n");
+     daa:	51                   	push   %ecx
+     dab:	51                   	push   %ecx
+     dac:	68 a6 5b 00 00       	push   $0x5ba6
+     db1:	6a 01                	push   $0x1
+     db3:	e8 d8 46 00 00       	call   5490 <printf>
+    exit();
+     db8:	e8 66 45 00 00       	call   5323 <exit>
+     dbd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000dc0 <splicetest>:
+{
+     dc0:	55                   	push   %ebp
+     dc1:	89 e5                	mov    %esp,%ebp
+     dc3:	57                   	push   %edi
+     dc4:	56                   	push   %esi
+     dc5:	53                   	push   %ebx
+     dc6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "splice test\n");
+     dc9:	68 c9 5b 00 00       	push   $0x5bc9
+     dce:	6a 01                	push   $0x1
+     dd0:	e8 bb 46 00 00       	call   5490 <printf>
+  unlink("splice.in");
+     dd5:	c7 04 24 d6 5b 00 00 	movl   $0x5bd6,(%esp)
+     ddc:	e8 92 45 00 00       	call   5373 <unlink>
+  unlink("splice.out");
+     de1:	c7 04 24 e0 5b 00 00 	movl   $0x5be0,(%esp)
+     de8:	e8 86 45 00 00       	call   5373 <unlink>
+  fd = open("splice.in", O_CREATE|O_RDWR);
+     ded:	5e                   	pop    %esi
+     dee:	5f                   	pop    %edi
+     def:	68 02 02 00 00       	push   $0x202
+     df4:	68 d6 5b 00 00       	push   $0x5bd6
+     df9:	e8 65 45 00 00       	call   5363 <open>
+  if(fd < 0){
+     dfe:	83 c4 10             	add    $0x10,%esp
+     e01:	85 c0                	test   %eax,%eax
+     e03:	0f 88 53 03 00 00    	js     115c <splicetest+0x39c>
+     e09:	89 c6                	mov    %eax,%esi
+     e0b:	bb 61 00 00 00       	mov    $0x61,%ebx
+    memset(buf, 'a' + i, 1000);
+     e10:	83 ec 04             	sub    $0x4,%esp
+     e13:	68 e8 03 00 00       	push   $0x3e8
+     e18:	53                   	push   %ebx
+     e19:	68 00 ab 00 00       	push   $0xab00
+     e1e:	e8 7d 43 00 00       	call   51a0 <memset>
+    if(write(fd, buf, 1000) != 1000){
+     e23:	83 c4 0c             	add    $0xc,%esp
+     e26:	68 e8 03 00 00       	push   $0x3e8
+     e2b:	68 00 ab 00 00       	push   $0xab00
+     e30:	56                   	push   %esi
+     e31:	e8 0d 45 00 00       	call   5343 <write>
+     e36:	83 c4 10             	add    $0x10,%esp
+     e39:	3d e8 03 00 00       	cmp    $0x3e8,%eax
+     e3e:	0f 85 a5 02 00 00    	jne    10e9 <splicetest+0x329>
+  for(i = 0; i < 10; i++){
+     e44:	83 c3 01             	add    $0x1,%ebx
+     e47:	83 fb 6b             	cmp    $0x6b,%ebx
+     e4a:	75 c4                	jne    e10 <splicetest+0x50>
+  close(fd);
+     e4c:	83 ec 0c             	sub    $0xc,%esp
+     e4f:	56                   	push   %esi
+     e50:	e8 f6 44 00 00       	call   534b <close>
+  if(pipe(fds) != 0 || pipe(fds2) != 0){
+     e55:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     e58:	89 04 24             	mov    %eax,(%esp)
+     e5b:	e8 d3 44 00 00       	call   5333 <pipe>
+     e60:	83 c4 10             	add    $0x10,%esp
+     e63:	85 c0                	test   %eax,%eax
+     e65:	0f 85 a5 02 00 00    	jne    1110 <splicetest+0x350>
+     e6b:	83 ec 0c             	sub    $0xc,%esp
+     e6e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     e71:	50                   	push   %eax
+     e72:	e8 bc 44 00 00       	call   5333 <pipe>
+     e77:	83 c4 10             	add    $0x10,%esp
+     e7a:	89 c6                	mov    %eax,%esi
+     e7c:	85 c0                	test   %eax,%eax
+     e7e:	0f 85 8c 02 00 00    	jne    1110 <splicetest+0x350>
+  fd = open("splice.in", 0);
+     e84:	83 ec 08             	sub    $0x8,%esp
+     e87:	6a 00                	push   $0x0
+     e89:	68 d6 5b 00 00       	push   $0x5bd6
+     e8e:	e8 d0 44 00 00       	call   5363 <open>
+     e93:	89 c7                	mov    %eax,%edi
+  fd2 = open("splice.out", O_CREATE|O_RDWR);
+     e95:	58                   	pop    %eax
+     e96:	5a                   	pop    %edx
+     e97:	68 02 02 00 00       	push   $0x202
+     e9c:	68 e0 5b 00 00       	push   $0x5be0
+     ea1:	e8 bd 44 00 00       	call   5363 <open>
+  if(fd < 0 || fd2 < 0 || write(fds2[1], "x", 1) != 1){
+     ea6:	83 c4 10             	add    $0x10,%esp
+  fd2 = open("splice.out", O_CREATE|O_RDWR);
+     ea9:	89 c3                	mov    %eax,%ebx
+  if(fd < 0 || fd2 < 0 || write(fds2[1], "x", 1) != 1){
+     eab:	89 f8                	mov    %edi,%eax
+     ead:	09 d8                	or     %ebx,%eax
+     eaf:	0f 88 48 02 00 00    	js     10fd <splicetest+0x33d>
+     eb5:	83 ec 04             	sub    $0x4,%esp
+     eb8:	6a 01                	push   $0x1
+     eba:	68 58 62 00 00       	push   $0x6258
+     ebf:	ff 75 e4             	push   -0x1c(%ebp)
+     ec2:	e8 7c 44 00 00       	call   5343 <write>
+     ec7:	83 c4 10             	add    $0x10,%esp
+     eca:	83 f8 01             	cmp    $0x1,%eax
+     ecd:	0f 85 2a 02 00 00    	jne    10fd <splicetest+0x33d>
+  if(splice(fd, fd2, 100) >= 0 || splice(fds2[0], fds[1], 100) >= 0){
+     ed3:	83 ec 04             	sub    $0x4,%esp
+     ed6:	6a 64                	push   $0x64
+     ed8:	53                   	push   %ebx
+     ed9:	57                   	push   %edi
+     eda:	e8 f4 44 00 00       	call   53d3 <splice>
+     edf:	83 c4 10             	add    $0x10,%esp
+     ee2:	85 c0                	test   %eax,%eax
+     ee4:	0f 89 39 02 00 00    	jns    1123 <splicetest+0x363>
+     eea:	83 ec 04             	sub    $0x4,%esp
+     eed:	6a 64                	push   $0x64
+     eef:	ff 75 dc             	push   -0x24(%ebp)
+     ef2:	ff 75 e0             	push   -0x20(%ebp)
+     ef5:	e8 d9 44 00 00       	call   53d3 <splice>
+     efa:	83 c4 10             	add    $0x10,%esp
+     efd:	85 c0                	test   %eax,%eax
+     eff:	0f 89 1e 02 00 00    	jns    1123 <splicetest+0x363>
+  close(fd);
+     f05:	83 ec 0c             	sub    $0xc,%esp
+     f08:	57                   	push   %edi
+     f09:	e8 3d 44 00 00       	call   534b <close>
+  close(fd2);
+     f0e:	89 1c 24             	mov    %ebx,(%esp)
+     f11:	e8 35 44 00 00       	call   534b <close>
+  close(fds2[0]);
+     f16:	5b                   	pop    %ebx
+     f17:	ff 75 e0             	push   -0x20(%ebp)
+     f1a:	e8 2c 44 00 00       	call   534b <close>
+  close(fds2[1]);
+     f1f:	5f                   	pop    %edi
+     f20:	ff 75 e4             	push   -0x1c(%ebp)
+     f23:	e8 23 44 00 00       	call   534b <close>
+  pid = fork();
+     f28:	e8 ee 43 00 00       	call   531b <fork>
+  if(pid < 0){
+     f2d:	83 c4 10             	add    $0x10,%esp
+     f30:	85 c0                	test   %eax,%eax
+     f32:	0f 88 fe 01 00 00    	js     1136 <splicetest+0x376>
+  if(pid == 0){
+     f38:	0f 85 8a 00 00 00    	jne    fc8 <splicetest+0x208>
+    close(fds[0]);
+     f3e:	83 ec 0c             	sub    $0xc,%esp
+     f41:	ff 75 d8             	push   -0x28(%ebp)
+     f44:	e8 02 44 00 00       	call   534b <close>
+    fd = open("splice.in", 0);
+     f49:	58                   	pop    %eax
+     f4a:	5a                   	pop    %edx
+     f4b:	6a 00                	push   $0x0
+     f4d:	68 d6 5b 00 00       	push   $0x5bd6
+     f52:	e8 0c 44 00 00       	call   5363 <open>
+    if(splice(fd, fds[0], 100) >= 0 || splice(fd, fd, 100) >= 0){
+     f57:	83 c4 0c             	add    $0xc,%esp
+     f5a:	6a 64                	push   $0x64
+    fd = open("splice.in", 0);
+     f5c:	89 c3                	mov    %eax,%ebx
+    if(splice(fd, fds[0], 100) >= 0 || splice(fd, fd, 100) >= 0){
+     f5e:	ff 75 d8             	push   -0x28(%ebp)
+     f61:	50                   	push   %eax
+     f62:	e8 6c 44 00 00       	call   53d3 <splice>
+     f67:	83 c4 10             	add    $0x10,%esp
+     f6a:	85 c0                	test   %eax,%eax
+     f6c:	0f 89 fd 01 00 00    	jns    116f <splicetest+0x3af>
+     f72:	83 ec 04             	sub    $0x4,%esp
+     f75:	6a 64                	push   $0x64
+     f77:	53                   	push   %ebx
+     f78:	53                   	push   %ebx
+     f79:	e8 55 44 00 00       	call   53d3 <splice>
+     f7e:	83 c4 10             	add    $0x10,%esp
+     f81:	85 c0                	test   %eax,%eax
+     f83:	0f 89 e6 01 00 00    	jns    116f <splicetest+0x3af>
+     f89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    while((n = splice(fd, fds[1], 3000)) > 0)
+     f90:	83 ec 04             	sub    $0x4,%esp
+     f93:	68 b8 0b 00 00       	push   $0xbb8
+     f98:	ff 75 dc             	push   -0x24(%ebp)
+     f9b:	53                   	push   %ebx
+     f9c:	e8 32 44 00 00       	call   53d3 <splice>
+     fa1:	83 c4 10             	add    $0x10,%esp
+     fa4:	85 c0                	test   %eax,%eax
+     fa6:	7f e8                	jg     f90 <splicetest+0x1d0>
+    if(n < 0){
+     fa8:	0f 84 22 01 00 00    	je     10d0 <splicetest+0x310>
+      printf(1, "splice: file to pipe failed\n");
+     fae:	83 ec 08             	sub    $0x8,%esp
+     fb1:	68 48 5c 00 00       	push   $0x5c48
+     fb6:	6a 01                	push   $0x1
+     fb8:	e8 d3 44 00 00       	call   5490 <printf>
+      exit();
+     fbd:	e8 61 43 00 00       	call   5323 <exit>
+     fc2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  close(fds[1]);
+     fc8:	83 ec 0c             	sub    $0xc,%esp
+     fcb:	ff 75 dc             	push   -0x24(%ebp)
+     fce:	e8 78 43 00 00       	call   534b <close>
+  fd = open("splice.out", O_CREATE|O_RDWR);
+     fd3:	5b                   	pop    %ebx
+     fd4:	5f                   	pop    %edi
+     fd5:	68 02 02 00 00       	push   $0x202
+     fda:	68 e0 5b 00 00       	push   $0x5be0
+     fdf:	e8 7f 43 00 00       	call   5363 <open>
+  for(tot = 0; (n = splice(fds[0], fd, 10000)) > 0; tot += n)
+     fe4:	83 c4 10             	add    $0x10,%esp
+  fd = open("splice.out", O_CREATE|O_RDWR);
+     fe7:	89 c7                	mov    %eax,%edi
+  for(tot = 0; (n = splice(fds[0], fd, 10000)) > 0; tot += n)
+     fe9:	eb 07                	jmp    ff2 <splicetest+0x232>
+     feb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     fef:	90                   	nop
+     ff0:	01 de                	add    %ebx,%esi
+     ff2:	83 ec 04             	sub    $0x4,%esp
+     ff5:	68 10 27 00 00       	push   $0x2710
+     ffa:	57                   	push   %edi
+     ffb:	ff 75 d8             	push   -0x28(%ebp)
+     ffe:	e8 d0 43 00 00       	call   53d3 <splice>
+    1003:	83 c4 10             	add    $0x10,%esp
+    1006:	89 c3                	mov    %eax,%ebx
+    1008:	85 c0                	test   %eax,%eax
+    100a:	7f e4                	jg     ff0 <splicetest+0x230>
+  wait();
+    100c:	e8 1a 43 00 00       	call   532b <wait>
+  close(fds[0]);
+    1011:	83 ec 0c             	sub    $0xc,%esp
+    1014:	ff 75 d8             	push   -0x28(%ebp)
+    1017:	e8 2f 43 00 00       	call   534b <close>
+  close(fd);
+    101c:	89 3c 24             	mov    %edi,(%esp)
+    101f:	e8 27 43 00 00       	call   534b <close>
+  if(n < 0 || tot != 10000){
+    1024:	83 c4 10             	add    $0x10,%esp
+    1027:	85 db                	test   %ebx,%ebx
+    1029:	0f 88 1a 01 00 00    	js     1149 <splicetest+0x389>
+    102f:	81 fe 10 27 00 00    	cmp    $0x2710,%esi
+    1035:	0f 85 0e 01 00 00    	jne    1149 <splicetest+0x389>
+  fd = open("splice.out", 0);
+    103b:	83 ec 08             	sub    $0x8,%esp
+    103e:	bb 61 00 00 00       	mov    $0x61,%ebx
+    1043:	6a 00                	push   $0x0
+    1045:	68 e0 5b 00 00       	push   $0x5be0
+    104a:	e8 14 43 00 00       	call   5363 <open>
+    104f:	83 c4 10             	add    $0x10,%esp
+    1052:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 10; i++){
+    1054:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(read(fd, buf, 1000) != 1000 || buf[0] != 'a' + i || buf[999] != 'a' + i){
+    1058:	83 ec 04             	sub    $0x4,%esp
+    105b:	68 e8 03 00 00       	push   $0x3e8
+    1060:	68 00 ab 00 00       	push   $0xab00
+    1065:	56                   	push   %esi
+    1066:	e8 d0 42 00 00       	call   533b <read>
+    106b:	83 c4 10             	add    $0x10,%esp
+    106e:	3d e8 03 00 00       	cmp    $0x3e8,%eax
+    1073:	75 60                	jne    10d5 <splicetest+0x315>
+    1075:	0f be 05 00 ab 00 00 	movsbl 0xab00,%eax
+    107c:	39 d8                	cmp    %ebx,%eax
+    107e:	75 55                	jne    10d5 <splicetest+0x315>
+    1080:	0f be 05 e7 ae 00 00 	movsbl 0xaee7,%eax
+    1087:	39 d8                	cmp    %ebx,%eax
+    1089:	75 4a                	jne    10d5 <splicetest+0x315>
+  for(i = 0; i < 10; i++){
+    108b:	83 c3 01             	add    $0x1,%ebx
+    108e:	83 fb 6b             	cmp    $0x6b,%ebx
+    1091:	75 c5                	jne    1058 <splicetest+0x298>
+  close(fd);
+    1093:	83 ec 0c             	sub    $0xc,%esp
+    1096:	56                   	push   %esi
+    1097:	e8 af 42 00 00       	call   534b <close>
+  unlink("splice.in");
+    109c:	c7 04 24 d6 5b 00 00 	movl   $0x5bd6,(%esp)
+    10a3:	e8 cb 42 00 00       	call   5373 <unlink>
+  unlink("splice.out");
+    10a8:	c7 04 24 e0 5b 00 00 	movl   $0x5be0,(%esp)
+    10af:	e8 bf 42 00 00       	call   5373 <unlink>
+  printf(1, "splice ok\n");
+    10b4:	58                   	pop    %eax
+    10b5:	5a                   	pop    %edx
+    10b6:	68 79 5c 00 00       	push   $0x5c79
+    10bb:	6a 01                	push   $0x1
+    10bd:	e8 ce 43 00 00       	call   5490 <printf>
+}
+    10c2:	83 c4 10             	add    $0x10,%esp
+    10c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10c8:	5b                   	pop    %ebx
+    10c9:	5e                   	pop    %esi
+    10ca:	5f                   	pop    %edi
+    10cb:	5d                   	pop    %ebp
+    10cc:	c3                   	ret
+    10cd:	8d 76 00             	lea    0x0(%esi),%esi
+    exit();
+    10d0:	e8 4e 42 00 00       	call   5323 <exit>
+      printf(1, "splice: wrong data\n");
+    10d5:	83 ec 08             	sub    $0x8,%esp
+    10d8:	68 65 5c 00 00       	push   $0x5c65
+    10dd:	6a 01                	push   $0x1
+    10df:	e8 ac 43 00 00       	call   5490 <printf>
+      exit();
+    10e4:	e8 3a 42 00 00       	call   5323 <exit>
+      printf(1, "splice: write failed\n");
+    10e9:	83 ec 08             	sub    $0x8,%esp
+    10ec:	68 02 5c 00 00       	push   $0x5c02
+    10f1:	6a 01                	push   $0x1
+    10f3:	e8 98 43 00 00       	call   5490 <printf>
+      exit();
+    10f8:	e8 26 42 00 00       	call   5323 <exit>
+    printf(1, "splice: setup failed\n");
+    10fd:	50                   	push   %eax
+    10fe:	50                   	push   %eax
+    10ff:	68 18 5c 00 00       	push   $0x5c18
+    1104:	6a 01                	push   $0x1
+    1106:	e8 85 43 00 00       	call   5490 <printf>
+    exit();
+    110b:	e8 13 42 00 00       	call   5323 <exit>
+    printf(1, "pipe() failed\n");
+    1110:	51                   	push   %ecx
+    1111:	51                   	push   %ecx
+    1112:	68 e2 5a 00 00       	push   $0x5ae2
+    1117:	6a 01                	push   $0x1
+    1119:	e8 72 43 00 00       	call   5490 <printf>
+    exit();
+    111e:	e8 00 42 00 00       	call   5323 <exit>
+    printf(1, "splice: file to file or pipe to pipe accepted\n");
+    1123:	50                   	push   %eax
+    1124:	50                   	push   %eax
+    1125:	68 40 6f 00 00       	push   $0x6f40
+    112a:	6a 01                	push   $0x1
+    112c:	e8 5f 43 00 00       	call   5490 <printf>
+    exit();
+    1131:	e8 ed 41 00 00       	call   5323 <exit>
+    printf(1, "fork failed\n");
+    1136:	51                   	push   %ecx
+    1137:	51                   	push   %ecx
+    1138:	68 6f 6d 00 00       	push   $0x6d6f
+    113d:	6a 01                	push   $0x1
+    113f:	e8 4c 43 00 00       	call   5490 <printf>
+    exit();
+    1144:	e8 da 41 00 00       	call   5323 <exit>
+    printf(1, "splice: pipe to file moved %d\n", tot);
+    1149:	51                   	push   %ecx
+    114a:	56                   	push   %esi
+    114b:	68 70 6f 00 00       	push   $0x6f70
+    1150:	6a 01                	push   $0x1
+    1152:	e8 39 43 00 00       	call   5490 <printf>
+    exit();
+    1157:	e8 c7 41 00 00       	call   5323 <exit>
+    printf(1, "splice: create failed\n");
+    115c:	53                   	push   %ebx
+    115d:	53                   	push   %ebx
+    115e:	68 eb 5b 00 00       	push   $0x5beb
+    1163:	6a 01                	push   $0x1
+    1165:	e8 26 43 00 00       	call   5490 <printf>
+    exit();
+    116a:	e8 b4 41 00 00       	call   5323 <exit>
+      printf(1, "splice: bad fds accepted\n");
+    116f:	50                   	push   %eax
+    1170:	50                   	push   %eax
+    1171:	68 2e 5c 00 00       	push   $0x5c2e
+    1176:	6a 01                	push   $0x1
+    1178:	e8 13 43 00 00       	call   5490 <printf>
+      exit();
+    117d:	e8 a1 41 00 00       	call   5323 <exit>
+    1182:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001190 <copyrangetest>:
+{
+    1190:	55                   	push   %ebp
+    1191:	89 e5                	mov    %esp,%ebp
+    1193:	57                   	push   %edi
+    1194:	56                   	push   %esi
+    1195:	53                   	push   %ebx
+  fd0 = open("cr.in", O_CREATE|O_RDWR);
+    1196:	bb 61 00 00 00       	mov    $0x61,%ebx
+{
+    119b:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "copyrange test\n");
+    119e:	68 84 5c 00 00       	push   $0x5c84
+    11a3:	6a 01                	push   $0x1
+    11a5:	e8 e6 42 00 00       	call   5490 <printf>
+  fd0 = open("cr.in", O_CREATE|O_RDWR);
+    11aa:	5e                   	pop    %esi
+    11ab:	5f                   	pop    %edi
+    11ac:	68 02 02 00 00       	push   $0x202
+    11b1:	68 94 5c 00 00       	push   $0x5c94
+    11b6:	e8 a8 41 00 00       	call   5363 <open>
+    11bb:	83 c4 10             	add    $0x10,%esp
+    11be:	89 c6                	mov    %eax,%esi
+    memset(buf, 'a' + i, 1000);
+    11c0:	83 ec 04             	sub    $0x4,%esp
+    11c3:	68 e8 03 00 00       	push   $0x3e8
+    11c8:	53                   	push   %ebx
+    11c9:	68 00 ab 00 00       	push   $0xab00
+    11ce:	e8 cd 3f 00 00       	call   51a0 <memset>
+    if(write(fd0, buf, 1000) != 1000){
+    11d3:	83 c4 0c             	add    $0xc,%esp
+    11d6:	68 e8 03 00 00       	push   $0x3e8
+    11db:	68 00 ab 00 00       	push   $0xab00
+    11e0:	56                   	push   %esi
+    11e1:	e8 5d 41 00 00       	call   5343 <write>
+    11e6:	83 c4 10             	add    $0x10,%esp
+    11e9:	3d e8 03 00 00       	cmp    $0x3e8,%eax
+    11ee:	0f 85 75 01 00 00    	jne    1369 <copyrangetest+0x1d9>
+  for(i = 0; i < 20; i++){
+    11f4:	83 c3 01             	add    $0x1,%ebx
+    11f7:	83 fb 75             	cmp    $0x75,%ebx
+    11fa:	75 c4                	jne    11c0 <copyrangetest+0x30>
+  close(fd0);
+    11fc:	83 ec 0c             	sub    $0xc,%esp
+    11ff:	56                   	push   %esi
+    1200:	e8 46 41 00 00       	call   534b <close>
+  fd0 = open("cr.in", O_RDONLY);
+    1205:	58                   	pop    %eax
+    1206:	5a                   	pop    %edx
+    1207:	6a 00                	push   $0x0
+    1209:	68 94 5c 00 00       	push   $0x5c94
+    120e:	e8 50 41 00 00       	call   5363 <open>
+  fd1 = open("cr.out", O_CREATE|O_RDWR);
+    1213:	59                   	pop    %ecx
+    1214:	5b                   	pop    %ebx
+    1215:	68 02 02 00 00       	push   $0x202
+    121a:	68 b3 5c 00 00       	push   $0x5cb3
+  fd0 = open("cr.in", O_RDONLY);
+    121f:	89 c6                	mov    %eax,%esi
+  fd1 = open("cr.out", O_CREATE|O_RDWR);
+    1221:	e8 3d 41 00 00       	call   5363 <open>
+    1226:	89 c7                	mov    %eax,%edi
+  if(pipe(fds) != 0 || copyrange(fd0, fds[1], 10) >= 0){
+    1228:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    122b:	89 04 24             	mov    %eax,(%esp)
+    122e:	e8 00 41 00 00       	call   5333 <pipe>
+    1233:	83 c4 10             	add    $0x10,%esp
+    1236:	89 c3                	mov    %eax,%ebx
+    1238:	85 c0                	test   %eax,%eax
+    123a:	0f 85 50 01 00 00    	jne    1390 <copyrangetest+0x200>
+    1240:	83 ec 04             	sub    $0x4,%esp
+    1243:	6a 0a                	push   $0xa
+    1245:	ff 75 e4             	push   -0x1c(%ebp)
+    1248:	56                   	push   %esi
+    1249:	e8 8d 41 00 00       	call   53db <copyrange>
+    124e:	83 c4 10             	add    $0x10,%esp
+    1251:	85 c0                	test   %eax,%eax
+    1253:	0f 89 37 01 00 00    	jns    1390 <copyrangetest+0x200>
+  close(fds[0]);
+    1259:	83 ec 0c             	sub    $0xc,%esp
+    125c:	ff 75 e0             	push   -0x20(%ebp)
+    125f:	e8 e7 40 00 00       	call   534b <close>
+  close(fds[1]);
+    1264:	58                   	pop    %eax
+    1265:	ff 75 e4             	push   -0x1c(%ebp)
+    1268:	e8 de 40 00 00       	call   534b <close>
+  for(tot = 0; (n = copyrange(fd0, fd1, 3333)) > 0; tot += n)
+    126d:	83 c4 10             	add    $0x10,%esp
+    1270:	eb 08                	jmp    127a <copyrangetest+0xea>
+    1272:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1278:	01 d3                	add    %edx,%ebx
+    127a:	83 ec 04             	sub    $0x4,%esp
+    127d:	68 05 0d 00 00       	push   $0xd05
+    1282:	57                   	push   %edi
+    1283:	56                   	push   %esi
+    1284:	e8 52 41 00 00       	call   53db <copyrange>
+    1289:	83 c4 10             	add    $0x10,%esp
+    128c:	89 c2                	mov    %eax,%edx
+    128e:	85 c0                	test   %eax,%eax
+    1290:	7f e6                	jg     1278 <copyrangetest+0xe8>
+  close(fd0);
+    1292:	83 ec 0c             	sub    $0xc,%esp
+    1295:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    1298:	56                   	push   %esi
+    1299:	e8 ad 40 00 00       	call   534b <close>
+  close(fd1);
+    129e:	89 3c 24             	mov    %edi,(%esp)
+    12a1:	e8 a5 40 00 00       	call   534b <close>
+  if(n < 0 || tot != 20000){
+    12a6:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    12a9:	83 c4 10             	add    $0x10,%esp
+    12ac:	85 d2                	test   %edx,%edx
+    12ae:	0f 88 c9 00 00 00    	js     137d <copyrangetest+0x1ed>
+    12b4:	81 fb 20 4e 00 00    	cmp    $0x4e20,%ebx
+    12ba:	0f 85 bd 00 00 00    	jne    137d <copyrangetest+0x1ed>
+  fd1 = open("cr.out", O_RDONLY);
+    12c0:	83 ec 08             	sub    $0x8,%esp
+    12c3:	bb 61 00 00 00       	mov    $0x61,%ebx
+    12c8:	6a 00                	push   $0x0
+    12ca:	68 b3 5c 00 00       	push   $0x5cb3
+    12cf:	e8 8f 40 00 00       	call   5363 <open>
+    12d4:	83 c4 10             	add    $0x10,%esp
+    12d7:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    12d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(read(fd1, buf, 1000) != 1000 || buf[0] != 'a' + i || buf[999] != 'a' + i){
+    12e0:	83 ec 04             	sub    $0x4,%esp
+    12e3:	68 e8 03 00 00       	push   $0x3e8
+    12e8:	68 00 ab 00 00       	push   $0xab00
+    12ed:	56                   	push   %esi
+    12ee:	e8 48 40 00 00       	call   533b <read>
+    12f3:	83 c4 10             	add    $0x10,%esp
+    12f6:	3d e8 03 00 00       	cmp    $0x3e8,%eax
+    12fb:	75 58                	jne    1355 <copyrangetest+0x1c5>
+    12fd:	0f be 05 00 ab 00 00 	movsbl 0xab00,%eax
+    1304:	39 d8                	cmp    %ebx,%eax
+    1306:	75 4d                	jne    1355 <copyrangetest+0x1c5>
+    1308:	0f be 05 e7 ae 00 00 	movsbl 0xaee7,%eax
+    130f:	39 d8                	cmp    %ebx,%eax
+    1311:	75 42                	jne    1355 <copyrangetest+0x1c5>
+  for(i = 0; i < 20; i++){
+    1313:	83 c3 01             	add    $0x1,%ebx
+    1316:	83 fb 75             	cmp    $0x75,%ebx
+    1319:	75 c5                	jne    12e0 <copyrangetest+0x150>
+  close(fd1);
+    131b:	83 ec 0c             	sub    $0xc,%esp
+    131e:	56                   	push   %esi
+    131f:	e8 27 40 00 00       	call   534b <close>
+  unlink("cr.in");
+    1324:	c7 04 24 94 5c 00 00 	movl   $0x5c94,(%esp)
+    132b:	e8 43 40 00 00       	call   5373 <unlink>
+  unlink("cr.out");
+    1330:	c7 04 24 b3 5c 00 00 	movl   $0x5cb3,(%esp)
+    1337:	e8 37 40 00 00       	call   5373 <unlink>
+  printf(1, "copyrange ok\n");
+    133c:	58                   	pop    %eax
+    133d:	5a                   	pop    %edx
+    133e:	68 04 5d 00 00       	push   $0x5d04
+    1343:	6a 01                	push   $0x1
+    1345:	e8 46 41 00 00       	call   5490 <printf>
+}
+    134a:	83 c4 10             	add    $0x10,%esp
+    134d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1350:	5b                   	pop    %ebx
+    1351:	5e                   	pop    %esi
+    1352:	5f                   	pop    %edi
+    1353:	5d                   	pop    %ebp
+    1354:	c3                   	ret
+      printf(1, "copyrange: wrong data\n");
+    1355:	83 ec 08             	sub    $0x8,%esp
+    1358:	68 ed 5c 00 00       	push   $0x5ced
+    135d:	6a 01                	push   $0x1
+    135f:	e8 2c 41 00 00       	call   5490 <printf>
+      exit();
+    1364:	e8 ba 3f 00 00       	call   5323 <exit>
+      printf(1, "copyrange: write failed\n");
+    1369:	83 ec 08             	sub    $0x8,%esp
+    136c:	68 9a 5c 00 00       	push   $0x5c9a
+    1371:	6a 01                	push   $0x1
+    1373:	e8 18 41 00 00       	call   5490 <printf>
+      exit();
+    1378:	e8 a6 3f 00 00       	call   5323 <exit>
+    printf(1, "copyrange: copied %d\n", tot);
+    137d:	51                   	push   %ecx
+    137e:	53                   	push   %ebx
+    137f:	68 d7 5c 00 00       	push   $0x5cd7
+    1384:	6a 01                	push   $0x1
+    1386:	e8 05 41 00 00       	call   5490 <printf>
+    exit();
+    138b:	e8 93 3f 00 00       	call   5323 <exit>
+    printf(1, "copyrange: copied to a pipe\n");
+    1390:	50                   	push   %eax
+    1391:	50                   	push   %eax
+    1392:	68 ba 5c 00 00       	push   $0x5cba
+    1397:	6a 01                	push   $0x1
+    1399:	e8 f2 40 00 00       	call   5490 <printf>
+    exit();
+    139e:	e8 80 3f 00 00       	call   5323 <exit>
+    13a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000013b0 <preempt>:
+{
+    13b0:	55                   	push   %ebp
+    13b1:	89 e5                	mov    %esp,%ebp
+    13b3:	57                   	push   %edi
+    13b4:	56                   	push   %esi
+    13b5:	53                   	push   %ebx
+    13b6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+    13b9:	68 12 5d 00 00       	push   $0x5d12
+    13be:	6a 01                	push   $0x1
+    13c0:	e8 cb 40 00 00       	call   5490 <printf>
+  pid1 = fork();
+    13c5:	e8 51 3f 00 00       	call   531b <fork>
+  if(pid1 == 0)
+    13ca:	83 c4 10             	add    $0x10,%esp
+    13cd:	85 c0                	test   %eax,%eax
+    13cf:	75 07                	jne    13d8 <preempt+0x28>
+    for(;;)
+    13d1:	eb fe                	jmp    13d1 <preempt+0x21>
+    13d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13d7:	90                   	nop
+    13d8:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+    13da:	e8 3c 3f 00 00       	call   531b <fork>
+    13df:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+    13e1:	85 c0                	test   %eax,%eax
+    13e3:	75 0b                	jne    13f0 <preempt+0x40>
+    for(;;)
+    13e5:	eb fe                	jmp    13e5 <preempt+0x35>
+    13e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13ee:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+    13f0:	83 ec 0c             	sub    $0xc,%esp
+    13f3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    13f6:	50                   	push   %eax
+    13f7:	e8 37 3f 00 00       	call   5333 <pipe>
+  pid3 = fork();
+    13fc:	e8 1a 3f 00 00       	call   531b <fork>
+  if(pid3 == 0){
+    1401:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+    1404:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+    1406:	85 c0                	test   %eax,%eax
+    1408:	75 3e                	jne    1448 <preempt+0x98>
+    close(pfds[0]);
+    140a:	83 ec 0c             	sub    $0xc,%esp
+    140d:	ff 75 e0             	push   -0x20(%ebp)
+    1410:	e8 36 3f 00 00       	call   534b <close>
+    if(write(pfds[1], "x", 1) != 1)
+    1415:	83 c4 0c             	add    $0xc,%esp
+    1418:	6a 01                	push   $0x1
+    141a:	68 58 62 00 00       	push   $0x6258
+    141f:	ff 75 e4             	push   -0x1c(%ebp)
+    1422:	e8 1c 3f 00 00       	call   5343 <write>
+    1427:	83 c4 10             	add    $0x10,%esp
+    142a:	83 f8 01             	cmp    $0x1,%eax
+    142d:	0f 85 b8 00 00 00    	jne    14eb <preempt+0x13b>
+    close(pfds[1]);
+    1433:	83 ec 0c             	sub    $0xc,%esp
+    1436:	ff 75 e4             	push   -0x1c(%ebp)
+    1439:	e8 0d 3f 00 00       	call   534b <close>
+    143e:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+    1441:	eb fe                	jmp    1441 <preempt+0x91>
+    1443:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1447:	90                   	nop
+  close(pfds[1]);
+    1448:	83 ec 0c             	sub    $0xc,%esp
+    144b:	ff 75 e4             	push   -0x1c(%ebp)
+    144e:	e8 f8 3e 00 00       	call   534b <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+    1453:	83 c4 0c             	add    $0xc,%esp
+    1456:	68 00 20 00 00       	push   $0x2000
+    145b:	68 00 ab 00 00       	push   $0xab00
+    1460:	ff 75 e0             	push   -0x20(%ebp)
+    1463:	e8 d3 3e 00 00       	call   533b <read>
+    1468:	83 c4 10             	add    $0x10,%esp
+    146b:	83 f8 01             	cmp    $0x1,%eax
+    146e:	75 67                	jne    14d7 <preempt+0x127>
+  close(pfds[0]);
+    1470:	83 ec 0c             	sub    $0xc,%esp
+    1473:	ff 75 e0             	push   -0x20(%ebp)
+    1476:	e8 d0 3e 00 00       	call   534b <close>
+  printf(1, "kill... ");
+    147b:	58                   	pop    %eax
+    147c:	5a                   	pop    %edx
+    147d:	68 43 5d 00 00       	push   $0x5d43
+    1482:	6a 01                	push   $0x1
+    1484:	e8 07 40 00 00       	call   5490 <printf>
+  kill(pid1);
+    1489:	89 1c 24             	mov    %ebx,(%esp)
+    148c:	e8 c2 3e 00 00       	call   5353 <kill>
+  kill(pid2);
+    1491:	89 34 24             	mov    %esi,(%esp)
+    1494:	e8 ba 3e 00 00       	call   5353 <kill>
+  kill(pid3);
+    1499:	89 3c 24             	mov    %edi,(%esp)
+    149c:	e8 b2 3e 00 00       	call   5353 <kill>
+  printf(1, "wait... ");
+    14a1:	59                   	pop    %ecx
+    14a2:	5b                   	pop    %ebx
+    14a3:	68 4c 5d 00 00       	push   $0x5d4c
+    14a8:	6a 01                	push   $0x1
+    14aa:	e8 e1 3f 00 00       	call   5490 <printf>
+  wait();
+    14af:	e8 77 3e 00 00       	call   532b <wait>
+  wait();
+    14b4:	e8 72 3e 00 00       	call   532b <wait>
+  wait();
+    14b9:	e8 6d 3e 00 00       	call   532b <wait>
+  printf(1, "preempt ok\n");
+    14be:	5e                   	pop    %esi
+    14bf:	5f                   	pop    %edi
+    14c0:	68 55 5d 00 00       	push   $0x5d55
+    14c5:	6a 01                	push   $0x1
+    14c7:	e8 c4 3f 00 00       	call   5490 <printf>
+    14cc:	83 c4 10             	add    $0x10,%esp
+}
+    14cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14d2:	5b                   	pop    %ebx
+    14d3:	5e                   	pop    %esi
+    14d4:	5f                   	pop    %edi
+    14d5:	5d                   	pop    %ebp
+    14d6:	c3                   	ret
+    printf(1, "preempt read error");
+    14d7:	83 ec 08             	sub    $0x8,%esp
+    14da:	68 30 5d 00 00       	push   $0x5d30
+    14df:	6a 01                	push   $0x1
+    14e1:	e8 aa 3f 00 00       	call   5490 <printf>
+    14e6:	83 c4 10             	add    $0x10,%esp
+    14e9:	eb e4                	jmp    14cf <preempt+0x11f>
+      printf(1, "preempt write error");
+    14eb:	83 ec 08             	sub    $0x8,%esp
+    14ee:	68 1c 5d 00 00       	push   $0x5d1c
+    14f3:	6a 01                	push   $0x1
+    14f5:	e8 96 3f 00 00       	call   5490 <printf>
+    14fa:	83 c4 10             	add    $0x10,%esp
+    14fd:	e9 31 ff ff ff       	jmp    1433 <preempt+0x83>
+    1502:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1509:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001510 <exitwait>:
+{
+    1510:	55                   	push   %ebp
+    1511:	89 e5                	mov    %esp,%ebp
+    1513:	56                   	push   %esi
+    1514:	be 64 00 00 00       	mov    $0x64,%esi
+    1519:	53                   	push   %ebx
+    151a:	eb 14                	jmp    1530 <exitwait+0x20>
+    151c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+    1520:	74 68                	je     158a <exitwait+0x7a>
+      if(wait() != pid){
+    1522:	e8 04 3e 00 00       	call   532b <wait>
+    1527:	39 d8                	cmp    %ebx,%eax
+    1529:	75 2d                	jne    1558 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+    152b:	83 ee 01             	sub    $0x1,%esi
+    152e:	74 41                	je     1571 <exitwait+0x61>
+    pid = fork();
+    1530:	e8 e6 3d 00 00       	call   531b <fork>
+    1535:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    1537:	85 c0                	test   %eax,%eax
+    1539:	79 e5                	jns    1520 <exitwait+0x10>
+      printf(1, "fork failed\n");
+    153b:	83 ec 08             	sub    $0x8,%esp
+    153e:	68 6f 6d 00 00       	push   $0x6d6f
+    1543:	6a 01                	push   $0x1
+    1545:	e8 46 3f 00 00       	call   5490 <printf>
+      return;
+    154a:	83 c4 10             	add    $0x10,%esp
+}
+    154d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1550:	5b                   	pop    %ebx
+    1551:	5e                   	pop    %esi
+    1552:	5d                   	pop    %ebp
+    1553:	c3                   	ret
+    1554:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+    1558:	83 ec 08             	sub    $0x8,%esp
+    155b:	68 61 5d 00 00       	push   $0x5d61
+    1560:	6a 01                	push   $0x1
+    1562:	e8 29 3f 00 00       	call   5490 <printf>
+        return;
+    1567:	83 c4 10             	add    $0x10,%esp
+}
+    156a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    156d:	5b                   	pop    %ebx
+    156e:	5e                   	pop    %esi
+    156f:	5d                   	pop    %ebp
+    1570:	c3                   	ret
+  printf(1, "exitwait ok\n");
+    1571:	83 ec 08             	sub    $0x8,%esp
+    1574:	68 71 5d 00 00       	push   $0x5d71
+    1579:	6a 01                	push   $0x1
+    157b:	e8 10 3f 00 00       	call   5490 <printf>
+    1580:	83 c4 10             	add    $0x10,%esp
+}
+    1583:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1586:	5b                   	pop    %ebx
+    1587:	5e                   	pop    %esi
+    1588:	5d                   	pop    %ebp
+    1589:	c3                   	ret
+      exit();
+    158a:	e8 94 3d 00 00       	call   5323 <exit>
+    158f:	90                   	nop
+
+00001590 <mem>:
+{
+    1590:	55                   	push   %ebp
+    1591:	89 e5                	mov    %esp,%ebp
+    1593:	56                   	push   %esi
+    1594:	31 f6                	xor    %esi,%esi
+    1596:	53                   	push   %ebx
+  printf(1, "mem test\n");
+    1597:	83 ec 08             	sub    $0x8,%esp
+    159a:	68 7e 5d 00 00       	push   $0x5d7e
+    159f:	6a 01                	push   $0x1
+    15a1:	e8 ea 3e 00 00       	call   5490 <printf>
+  ppid = getpid();
+    15a6:	e8 f8 3d 00 00       	call   53a3 <getpid>
+    15ab:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+    15ad:	e8 69 3d 00 00       	call   531b <fork>
+    15b2:	83 c4 10             	add    $0x10,%esp
+    15b5:	85 c0                	test   %eax,%eax
+    15b7:	74 0b                	je     15c4 <mem+0x34>
+    15b9:	e9 8a 00 00 00       	jmp    1648 <mem+0xb8>
+    15be:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+    15c0:	89 30                	mov    %esi,(%eax)
+    15c2:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+    15c4:	83 ec 0c             	sub    $0xc,%esp
+    15c7:	68 11 27 00 00       	push   $0x2711
+    15cc:	e8 ff 40 00 00       	call   56d0 <malloc>
+    15d1:	83 c4 10             	add    $0x10,%esp
+    15d4:	85 c0                	test   %eax,%eax
+    15d6:	75 e8                	jne    15c0 <mem+0x30>
+    while(m1){
+    15d8:	85 f6                	test   %esi,%esi
+    15da:	74 18                	je     15f4 <mem+0x64>
+    15dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+    15e0:	89 f0                	mov    %esi,%eax
+      free(m1);
+    15e2:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+    15e5:	8b 36                	mov    (%esi),%esi
+      free(m1);
+    15e7:	50                   	push   %eax
+    15e8:	e8 53 40 00 00       	call   5640 <free>
+    while(m1){
+    15ed:	83 c4 10             	add    $0x10,%esp
+    15f0:	85 f6                	test   %esi,%esi
+    15f2:	75 ec                	jne    15e0 <mem+0x50>
+    m1 = malloc(1024*20);
+    15f4:	83 ec 0c             	sub    $0xc,%esp
+    15f7:	68 00 50 00 00       	push   $0x5000
+    15fc:	e8 cf 40 00 00       	call   56d0 <malloc>
+    if(m1 == 0){
+    1601:	83 c4 10             	add    $0x10,%esp
+    1604:	85 c0                	test   %eax,%eax
+    1606:	74 20                	je     1628 <mem+0x98>
+    free(m1);
+    1608:	83 ec 0c             	sub    $0xc,%esp
+    160b:	50                   	push   %eax
+    160c:	e8 2f 40 00 00       	call   5640 <free>
+    printf(1, "mem ok\n");
+    1611:	58                   	pop    %eax
+    1612:	5a                   	pop    %edx
+    1613:	68 a2 5d 00 00       	push   $0x5da2
+    1618:	6a 01                	push   $0x1
+    161a:	e8 71 3e 00 00       	call   5490 <printf>
+    exit();
+    161f:	e8 ff 3c 00 00       	call   5323 <exit>
+    1624:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+    1628:	83 ec 08             	sub    $0x8,%esp
+    162b:	68 88 5d 00 00       	push   $0x5d88
+    1630:	6a 01                	push   $0x1
+    1632:	e8 59 3e 00 00       	call   5490 <printf>
+      kill(ppid);
+    1637:	89 1c 24             	mov    %ebx,(%esp)
+    163a:	e8 14 3d 00 00       	call   5353 <kill>
+      exit();
+    163f:	e8 df 3c 00 00       	call   5323 <exit>
+    1644:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    1648:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    164b:	5b                   	pop    %ebx
+    164c:	5e                   	pop    %esi
+    164d:	5d                   	pop    %ebp
+    wait();
+    164e:	e9 d8 3c 00 00       	jmp    532b <wait>
+    1653:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    165a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001660 <sharedfd>:
+{
+    1660:	55                   	push   %ebp
+    1661:	89 e5                	mov    %esp,%ebp
+    1663:	57                   	push   %edi
+    1664:	56                   	push   %esi
+    1665:	53                   	push   %ebx
+    1666:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+    1669:	68 aa 5d 00 00       	push   $0x5daa
+    166e:	6a 01                	push   $0x1
+    1670:	e8 1b 3e 00 00       	call   5490 <printf>
+  unlink("sharedfd");
+    1675:	c7 04 24 b9 5d 00 00 	movl   $0x5db9,(%esp)
+    167c:	e8 f2 3c 00 00       	call   5373 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    1681:	5b                   	pop    %ebx
+    1682:	5e                   	pop    %esi
+    1683:	68 02 02 00 00       	push   $0x202
+    1688:	68 b9 5d 00 00       	push   $0x5db9
+    168d:	e8 d1 3c 00 00       	call   5363 <open>
+  if(fd < 0){
+    1692:	83 c4 10             	add    $0x10,%esp
+    1695:	85 c0                	test   %eax,%eax
+    1697:	0f 88 2a 01 00 00    	js     17c7 <sharedfd+0x167>
+    169d:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    169f:	8d 75 de             	lea    -0x22(%ebp),%esi
+    16a2:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+    16a7:	e8 6f 3c 00 00       	call   531b <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    16ac:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+    16af:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    16b2:	19 c0                	sbb    %eax,%eax
+    16b4:	83 ec 04             	sub    $0x4,%esp
+    16b7:	83 e0 f3             	and    $0xfffffff3,%eax
+    16ba:	6a 0a                	push   $0xa
+    16bc:	83 c0 70             	add    $0x70,%eax
+    16bf:	50                   	push   %eax
+    16c0:	56                   	push   %esi
+    16c1:	e8 da 3a 00 00       	call   51a0 <memset>
+    16c6:	83 c4 10             	add    $0x10,%esp
+    16c9:	eb 0a                	jmp    16d5 <sharedfd+0x75>
+    16cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    16cf:	90                   	nop
+  for(i = 0; i < 1000; i++){
+    16d0:	83 eb 01             	sub    $0x1,%ebx
+    16d3:	74 26                	je     16fb <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    16d5:	83 ec 04             	sub    $0x4,%esp
+    16d8:	6a 0a                	push   $0xa
+    16da:	56                   	push   %esi
+    16db:	57                   	push   %edi
+    16dc:	e8 62 3c 00 00       	call   5343 <write>
+    16e1:	83 c4 10             	add    $0x10,%esp
+    16e4:	83 f8 0a             	cmp    $0xa,%eax
+    16e7:	74 e7                	je     16d0 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+    16e9:	83 ec 08             	sub    $0x8,%esp
+    16ec:	68 bc 6f 00 00       	push   $0x6fbc
+    16f1:	6a 01                	push   $0x1
+    16f3:	e8 98 3d 00 00       	call   5490 <printf>
+      break;
+    16f8:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+    16fb:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    16fe:	85 c9                	test   %ecx,%ecx
+    1700:	0f 84 f5 00 00 00    	je     17fb <sharedfd+0x19b>
+    wait();
+    1706:	e8 20 3c 00 00       	call   532b <wait>
+  close(fd);
+    170b:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+    170e:	31 db                	xor    %ebx,%ebx
+  close(fd);
+    1710:	57                   	push   %edi
+    1711:	8d 7d e8             	lea    -0x18(%ebp),%edi
+    1714:	e8 32 3c 00 00       	call   534b <close>
+  fd = open("sharedfd", 0);
+    1719:	58                   	pop    %eax
+    171a:	5a                   	pop    %edx
+    171b:	6a 00                	push   $0x0
+    171d:	68 b9 5d 00 00       	push   $0x5db9
+    1722:	e8 3c 3c 00 00       	call   5363 <open>
+  if(fd < 0){
+    1727:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+    172a:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+    172c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+    172f:	85 c0                	test   %eax,%eax
+    1731:	0f 88 aa 00 00 00    	js     17e1 <sharedfd+0x181>
+    1737:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    173e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    1740:	83 ec 04             	sub    $0x4,%esp
+    1743:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1746:	6a 0a                	push   $0xa
+    1748:	56                   	push   %esi
+    1749:	ff 75 d0             	push   -0x30(%ebp)
+    174c:	e8 ea 3b 00 00       	call   533b <read>
+    1751:	83 c4 10             	add    $0x10,%esp
+    1754:	85 c0                	test   %eax,%eax
+    1756:	7e 28                	jle    1780 <sharedfd+0x120>
+    1758:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    175b:	89 f0                	mov    %esi,%eax
+    175d:	eb 13                	jmp    1772 <sharedfd+0x112>
+    175f:	90                   	nop
+        np++;
+    1760:	80 f9 70             	cmp    $0x70,%cl
+    1763:	0f 94 c1             	sete   %cl
+    1766:	0f b6 c9             	movzbl %cl,%ecx
+    1769:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+    176b:	83 c0 01             	add    $0x1,%eax
+    176e:	39 f8                	cmp    %edi,%eax
+    1770:	74 ce                	je     1740 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+    1772:	0f b6 08             	movzbl (%eax),%ecx
+    1775:	80 f9 63             	cmp    $0x63,%cl
+    1778:	75 e6                	jne    1760 <sharedfd+0x100>
+        nc++;
+    177a:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+    177d:	eb ec                	jmp    176b <sharedfd+0x10b>
+    177f:	90                   	nop
+  close(fd);
+    1780:	83 ec 0c             	sub    $0xc,%esp
+    1783:	ff 75 d0             	push   -0x30(%ebp)
+    1786:	e8 c0 3b 00 00       	call   534b <close>
+  unlink("sharedfd");
+    178b:	c7 04 24 b9 5d 00 00 	movl   $0x5db9,(%esp)
+    1792:	e8 dc 3b 00 00       	call   5373 <unlink>
+  if(nc == 10000 && np == 10000){
+    1797:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    179a:	83 c4 10             	add    $0x10,%esp
+    179d:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+    17a3:	75 5b                	jne    1800 <sharedfd+0x1a0>
+    17a5:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+    17ab:	75 53                	jne    1800 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+    17ad:	83 ec 08             	sub    $0x8,%esp
+    17b0:	68 c2 5d 00 00       	push   $0x5dc2
+    17b5:	6a 01                	push   $0x1
+    17b7:	e8 d4 3c 00 00       	call   5490 <printf>
+    17bc:	83 c4 10             	add    $0x10,%esp
+}
+    17bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17c2:	5b                   	pop    %ebx
+    17c3:	5e                   	pop    %esi
+    17c4:	5f                   	pop    %edi
+    17c5:	5d                   	pop    %ebp
+    17c6:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+    17c7:	83 ec 08             	sub    $0x8,%esp
+    17ca:	68 90 6f 00 00       	push   $0x6f90
+    17cf:	6a 01                	push   $0x1
+    17d1:	e8 ba 3c 00 00       	call   5490 <printf>
+    return;
+    17d6:	83 c4 10             	add    $0x10,%esp
+}
+    17d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17dc:	5b                   	pop    %ebx
+    17dd:	5e                   	pop    %esi
+    17de:	5f                   	pop    %edi
+    17df:	5d                   	pop    %ebp
+    17e0:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    17e1:	83 ec 08             	sub    $0x8,%esp
+    17e4:	68 dc 6f 00 00       	push   $0x6fdc
+    17e9:	6a 01                	push   $0x1
+    17eb:	e8 a0 3c 00 00       	call   5490 <printf>
+    return;
+    17f0:	83 c4 10             	add    $0x10,%esp
+}
+    17f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17f6:	5b                   	pop    %ebx
+    17f7:	5e                   	pop    %esi
+    17f8:	5f                   	pop    %edi
+    17f9:	5d                   	pop    %ebp
+    17fa:	c3                   	ret
+    exit();
+    17fb:	e8 23 3b 00 00       	call   5323 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    1800:	53                   	push   %ebx
+    1801:	52                   	push   %edx
+    1802:	68 cf 5d 00 00       	push   $0x5dcf
+    1807:	6a 01                	push   $0x1
+    1809:	e8 82 3c 00 00       	call   5490 <printf>
+    exit();
+    180e:	e8 10 3b 00 00       	call   5323 <exit>
+    1813:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    181a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001820 <fourfiles>:
+{
+    1820:	55                   	push   %ebp
+    1821:	89 e5                	mov    %esp,%ebp
+    1823:	57                   	push   %edi
+    1824:	56                   	push   %esi
+    1825:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    1826:	31 db                	xor    %ebx,%ebx
+{
+    1828:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    182b:	c7 45 d8 7e 68 00 00 	movl   $0x687e,-0x28(%ebp)
+    1832:	c7 45 dc 2a 5f 00 00 	movl   $0x5f2a,-0x24(%ebp)
+    1839:	c7 45 e0 2e 5f 00 00 	movl   $0x5f2e,-0x20(%ebp)
+    1840:	c7 45 e4 e4 5d 00 00 	movl   $0x5de4,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    1847:	68 e7 5d 00 00       	push   $0x5de7
+    184c:	6a 01                	push   $0x1
+    184e:	e8 3d 3c 00 00       	call   5490 <printf>
+    1853:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    1856:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    185a:	83 ec 0c             	sub    $0xc,%esp
+    185d:	56                   	push   %esi
+    185e:	e8 10 3b 00 00       	call   5373 <unlink>
+    pid = fork();
+    1863:	e8 b3 3a 00 00       	call   531b <fork>
+    if(pid < 0){
+    1868:	83 c4 10             	add    $0x10,%esp
+    186b:	85 c0                	test   %eax,%eax
+    186d:	0f 88 65 01 00 00    	js     19d8 <fourfiles+0x1b8>
+    if(pid == 0){
+    1873:	0f 84 eb 00 00 00    	je     1964 <fourfiles+0x144>
+  for(pi = 0; pi < 4; pi++){
+    1879:	83 c3 01             	add    $0x1,%ebx
+    187c:	83 fb 04             	cmp    $0x4,%ebx
+    187f:	75 d5                	jne    1856 <fourfiles+0x36>
+    wait();
+    1881:	e8 a5 3a 00 00       	call   532b <wait>
+  for(i = 0; i < 2; i++){
+    1886:	31 f6                	xor    %esi,%esi
+    wait();
+    1888:	e8 9e 3a 00 00       	call   532b <wait>
+    188d:	e8 99 3a 00 00       	call   532b <wait>
+    1892:	e8 94 3a 00 00       	call   532b <wait>
+    fname = names[i];
+    1897:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    189b:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    189e:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    18a0:	6a 00                	push   $0x0
+    18a2:	53                   	push   %ebx
+    18a3:	e8 bb 3a 00 00       	call   5363 <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    18a8:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    18ab:	83 c4 10             	add    $0x10,%esp
+    18ae:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    18b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18b8:	83 ec 04             	sub    $0x4,%esp
+    18bb:	68 00 20 00 00       	push   $0x2000
+    18c0:	68 00 ab 00 00       	push   $0xab00
+    18c5:	ff 75 d4             	push   -0x2c(%ebp)
+    18c8:	e8 6e 3a 00 00       	call   533b <read>
+    18cd:	83 c4 10             	add    $0x10,%esp
+    18d0:	89 c3                	mov    %eax,%ebx
+    18d2:	85 c0                	test   %eax,%eax
+    18d4:	7e 28                	jle    18fe <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    18d6:	31 c0                	xor    %eax,%eax
+    18d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18df:	90                   	nop
+        if(buf[j] != '0'+i){
+    18e0:	83 fe 01             	cmp    $0x1,%esi
+    18e3:	0f be 88 00 ab 00 00 	movsbl 0xab00(%eax),%ecx
+    18ea:	19 d2                	sbb    %edx,%edx
+    18ec:	83 c2 31             	add    $0x31,%edx
+    18ef:	39 d1                	cmp    %edx,%ecx
+    18f1:	75 5d                	jne    1950 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    18f3:	83 c0 01             	add    $0x1,%eax
+    18f6:	39 c3                	cmp    %eax,%ebx
+    18f8:	75 e6                	jne    18e0 <fourfiles+0xc0>
+      total += n;
+    18fa:	01 df                	add    %ebx,%edi
+    18fc:	eb ba                	jmp    18b8 <fourfiles+0x98>
+    close(fd);
+    18fe:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    1901:	83 ec 0c             	sub    $0xc,%esp
+    1904:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1907:	51                   	push   %ecx
+    1908:	e8 3e 3a 00 00       	call   534b <close>
+    if(total != 12*500){
+    190d:	83 c4 10             	add    $0x10,%esp
+    1910:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    1916:	0f 85 d0 00 00 00    	jne    19ec <fourfiles+0x1cc>
+    unlink(fname);
+    191c:	83 ec 0c             	sub    $0xc,%esp
+    191f:	53                   	push   %ebx
+    1920:	e8 4e 3a 00 00       	call   5373 <unlink>
+  for(i = 0; i < 2; i++){
+    1925:	83 c4 10             	add    $0x10,%esp
+    1928:	85 f6                	test   %esi,%esi
+    192a:	75 0a                	jne    1936 <fourfiles+0x116>
+    192c:	be 01 00 00 00       	mov    $0x1,%esi
+    1931:	e9 61 ff ff ff       	jmp    1897 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    1936:	83 ec 08             	sub    $0x8,%esp
+    1939:	68 25 5e 00 00       	push   $0x5e25
+    193e:	6a 01                	push   $0x1
+    1940:	e8 4b 3b 00 00       	call   5490 <printf>
+}
+    1945:	83 c4 10             	add    $0x10,%esp
+    1948:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    194b:	5b                   	pop    %ebx
+    194c:	5e                   	pop    %esi
+    194d:	5f                   	pop    %edi
+    194e:	5d                   	pop    %ebp
+    194f:	c3                   	ret
+          printf(1, "wrong char\n");
+    1950:	83 ec 08             	sub    $0x8,%esp
+    1953:	68 08 5e 00 00       	push   $0x5e08
+    1958:	6a 01                	push   $0x1
+    195a:	e8 31 3b 00 00       	call   5490 <printf>
+          exit();
+    195f:	e8 bf 39 00 00       	call   5323 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    1964:	83 ec 08             	sub    $0x8,%esp
+    1967:	68 02 02 00 00       	push   $0x202
+    196c:	56                   	push   %esi
+    196d:	e8 f1 39 00 00       	call   5363 <open>
+      if(fd < 0){
+    1972:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    1975:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    1977:	85 c0                	test   %eax,%eax
+    1979:	78 45                	js     19c0 <fourfiles+0x1a0>
+      memset(buf, '0'+pi, 512);
+    197b:	83 ec 04             	sub    $0x4,%esp
+    197e:	83 c3 30             	add    $0x30,%ebx
+    1981:	68 00 02 00 00       	push   $0x200
+    1986:	53                   	push   %ebx
+    1987:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    198c:	68 00 ab 00 00       	push   $0xab00
+    1991:	e8 0a 38 00 00       	call   51a0 <memset>
+    1996:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    1999:	83 ec 04             	sub    $0x4,%esp
+    199c:	68 f4 01 00 00       	push   $0x1f4
+    19a1:	68 00 ab 00 00       	push   $0xab00
+    19a6:	56                   	push   %esi
+    19a7:	e8 97 39 00 00       	call   5343 <write>
+    19ac:	83 c4 10             	add    $0x10,%esp
+    19af:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    19b4:	75 49                	jne    19ff <fourfiles+0x1df>
+      for(i = 0; i < 12; i++){
+    19b6:	83 eb 01             	sub    $0x1,%ebx
+    19b9:	75 de                	jne    1999 <fourfiles+0x179>
+      exit();
+    19bb:	e8 63 39 00 00       	call   5323 <exit>
+        printf(1, "create failed\n");
+    19c0:	51                   	push   %ecx
+    19c1:	51                   	push   %ecx
+    19c2:	68 f3 5b 00 00       	push   $0x5bf3
+    19c7:	6a 01                	push   $0x1
+    19c9:	e8 c2 3a 00 00       	call   5490 <printf>
+        exit();
+    19ce:	e8 50 39 00 00       	call   5323 <exit>
+    19d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    19d7:	90                   	nop
+      printf(1, "fork failed\n");
+    19d8:	83 ec 08             	sub    $0x8,%esp
+    19db:	68 6f 6d 00 00       	push   $0x6d6f
+    19e0:	6a 01                	push   $0x1
+    19e2:	e8 a9 3a 00 00       	call   5490 <printf>
+      exit();
+    19e7:	e8 37 39 00 00       	call   5323 <exit>
+      printf(1, "wrong length %d\n", total);
+    19ec:	50                   	push   %eax
+    19ed:	57                   	push   %edi
+    19ee:	68 14 5e 00 00       	push   $0x5e14
+    19f3:	6a 01                	push   $0x1
+    19f5:	e8 96 3a 00 00       	call   5490 <printf>
+      exit();
+    19fa:	e8 24 39 00 00       	call   5323 <exit>
+          printf(1, "write failed %d\n", n);
+    19ff:	52                   	push   %edx
+    1a00:	50                   	push   %eax
+    1a01:	68 f7 5d 00 00       	push   $0x5df7
+    1a06:	6a 01                	push   $0x1
+    1a08:	e8 83 3a 00 00       	call   5490 <printf>
+          exit();
+    1a0d:	e8 11 39 00 00       	call   5323 <exit>
+    1a12:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001a20 <createdelete>:
+{
+    1a20:	55                   	push   %ebp
+    1a21:	89 e5                	mov    %esp,%ebp
+    1a23:	57                   	push   %edi
+    1a24:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    1a25:	31 f6                	xor    %esi,%esi
+{
+    1a27:	53                   	push   %ebx
+    1a28:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    1a2b:	68 33 5e 00 00       	push   $0x5e33
+    1a30:	6a 01                	push   $0x1
+    1a32:	e8 59 3a 00 00       	call   5490 <printf>
+    1a37:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    1a3a:	e8 dc 38 00 00       	call   531b <fork>
+    1a3f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    1a41:	85 c0                	test   %eax,%eax
+    1a43:	0f 88 ac 01 00 00    	js     1bf5 <createdelete+0x1d5>
+    if(pid == 0){
+    1a49:	0f 84 01 01 00 00    	je     1b50 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    1a4f:	83 c6 01             	add    $0x1,%esi
+    1a52:	83 fe 04             	cmp    $0x4,%esi
+    1a55:	75 e3                	jne    1a3a <createdelete+0x1a>
+    wait();
+    1a57:	e8 cf 38 00 00       	call   532b <wait>
+  for(i = 0; i < N; i++){
+    1a5c:	31 ff                	xor    %edi,%edi
+    1a5e:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    1a61:	e8 c5 38 00 00       	call   532b <wait>
+    1a66:	e8 c0 38 00 00       	call   532b <wait>
+    1a6b:	e8 bb 38 00 00       	call   532b <wait>
+  name[0] = name[1] = name[2] = 0;
+    1a70:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    1a74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    1a78:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    1a7a:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    1a7d:	bb 70 00 00 00       	mov    $0x70,%ebx
+    1a82:	0f 94 c2             	sete   %dl
+    1a85:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    1a88:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    1a8b:	0f 9f c0             	setg   %al
+    1a8e:	09 c2                	or     %eax,%edx
+    1a90:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    1a93:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    1a97:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    1a9a:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    1a9d:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    1aa0:	6a 00                	push   $0x0
+    1aa2:	56                   	push   %esi
+    1aa3:	e8 bb 38 00 00       	call   5363 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    1aa8:	83 c4 10             	add    $0x10,%esp
+    1aab:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    1aaf:	74 7f                	je     1b30 <createdelete+0x110>
+    1ab1:	85 c0                	test   %eax,%eax
+    1ab3:	0f 88 27 01 00 00    	js     1be0 <createdelete+0x1c0>
+        close(fd);
+    1ab9:	83 ec 0c             	sub    $0xc,%esp
+    1abc:	50                   	push   %eax
+    1abd:	e8 89 38 00 00       	call   534b <close>
+    1ac2:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    1ac5:	83 c3 01             	add    $0x1,%ebx
+    1ac8:	80 fb 74             	cmp    $0x74,%bl
+    1acb:	75 c6                	jne    1a93 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    1acd:	83 c7 01             	add    $0x1,%edi
+    1ad0:	83 ff 14             	cmp    $0x14,%edi
+    1ad3:	75 a3                	jne    1a78 <createdelete+0x58>
+    1ad5:	bf 70 00 00 00       	mov    $0x70,%edi
+    1ada:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    1ae0:	8d 47 c0             	lea    -0x40(%edi),%eax
+    1ae3:	bb 04 00 00 00       	mov    $0x4,%ebx
+    1ae8:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    1aeb:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    1aed:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    1af0:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    1af3:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    1af7:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    1afa:	56                   	push   %esi
+    1afb:	e8 73 38 00 00       	call   5373 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    1b00:	83 c4 10             	add    $0x10,%esp
+    1b03:	83 eb 01             	sub    $0x1,%ebx
+    1b06:	75 e3                	jne    1aeb <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    1b08:	83 c7 01             	add    $0x1,%edi
+    1b0b:	89 f8                	mov    %edi,%eax
+    1b0d:	3c 84                	cmp    $0x84,%al
+    1b0f:	75 cf                	jne    1ae0 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    1b11:	83 ec 08             	sub    $0x8,%esp
+    1b14:	68 46 5e 00 00       	push   $0x5e46
+    1b19:	6a 01                	push   $0x1
+    1b1b:	e8 70 39 00 00       	call   5490 <printf>
+}
+    1b20:	83 c4 10             	add    $0x10,%esp
+    1b23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b26:	5b                   	pop    %ebx
+    1b27:	5e                   	pop    %esi
+    1b28:	5f                   	pop    %edi
+    1b29:	5d                   	pop    %ebp
+    1b2a:	c3                   	ret
+    1b2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1b2f:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    1b30:	85 c0                	test   %eax,%eax
+    1b32:	78 91                	js     1ac5 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    1b34:	50                   	push   %eax
+    1b35:	56                   	push   %esi
+    1b36:	68 2c 70 00 00       	push   $0x702c
+    1b3b:	6a 01                	push   $0x1
+    1b3d:	e8 4e 39 00 00       	call   5490 <printf>
+        exit();
+    1b42:	e8 dc 37 00 00       	call   5323 <exit>
+    1b47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b4e:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    1b50:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    1b53:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    1b57:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    1b5a:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    1b5d:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    1b60:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    1b63:	8d 43 30             	lea    0x30(%ebx),%eax
+    1b66:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    1b69:	68 02 02 00 00       	push   $0x202
+    1b6e:	56                   	push   %esi
+    1b6f:	e8 ef 37 00 00       	call   5363 <open>
+        if(fd < 0){
+    1b74:	83 c4 10             	add    $0x10,%esp
+    1b77:	85 c0                	test   %eax,%eax
+    1b79:	0f 88 8a 00 00 00    	js     1c09 <createdelete+0x1e9>
+        close(fd);
+    1b7f:	83 ec 0c             	sub    $0xc,%esp
+    1b82:	50                   	push   %eax
+    1b83:	e8 c3 37 00 00       	call   534b <close>
+        if(i > 0 && (i % 2 ) == 0){
+    1b88:	83 c4 10             	add    $0x10,%esp
+    1b8b:	85 db                	test   %ebx,%ebx
+    1b8d:	74 19                	je     1ba8 <createdelete+0x188>
+    1b8f:	f6 c3 01             	test   $0x1,%bl
+    1b92:	74 1b                	je     1baf <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+    1b94:	83 c3 01             	add    $0x1,%ebx
+    1b97:	83 fb 14             	cmp    $0x14,%ebx
+    1b9a:	75 c4                	jne    1b60 <createdelete+0x140>
+      exit();
+    1b9c:	e8 82 37 00 00       	call   5323 <exit>
+    1ba1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+    1ba8:	bb 01 00 00 00       	mov    $0x1,%ebx
+    1bad:	eb b1                	jmp    1b60 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    1baf:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    1bb1:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    1bb4:	d1 f8                	sar    %eax
+    1bb6:	83 c0 30             	add    $0x30,%eax
+    1bb9:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    1bbc:	56                   	push   %esi
+    1bbd:	e8 b1 37 00 00       	call   5373 <unlink>
+    1bc2:	83 c4 10             	add    $0x10,%esp
+    1bc5:	85 c0                	test   %eax,%eax
+    1bc7:	79 cb                	jns    1b94 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    1bc9:	52                   	push   %edx
+    1bca:	52                   	push   %edx
+    1bcb:	68 23 61 00 00       	push   $0x6123
+    1bd0:	6a 01                	push   $0x1
+    1bd2:	e8 b9 38 00 00       	call   5490 <printf>
+            exit();
+    1bd7:	e8 47 37 00 00       	call   5323 <exit>
+    1bdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    1be0:	83 ec 04             	sub    $0x4,%esp
+    1be3:	56                   	push   %esi
+    1be4:	68 08 70 00 00       	push   $0x7008
+    1be9:	6a 01                	push   $0x1
+    1beb:	e8 a0 38 00 00       	call   5490 <printf>
+        exit();
+    1bf0:	e8 2e 37 00 00       	call   5323 <exit>
+      printf(1, "fork failed\n");
+    1bf5:	83 ec 08             	sub    $0x8,%esp
+    1bf8:	68 6f 6d 00 00       	push   $0x6d6f
+    1bfd:	6a 01                	push   $0x1
+    1bff:	e8 8c 38 00 00       	call   5490 <printf>
+      exit();
+    1c04:	e8 1a 37 00 00       	call   5323 <exit>
+          printf(1, "create failed\n");
+    1c09:	83 ec 08             	sub    $0x8,%esp
+    1c0c:	68 f3 5b 00 00       	push   $0x5bf3
+    1c11:	6a 01                	push   $0x1
+    1c13:	e8 78 38 00 00       	call   5490 <printf>
+          exit();
+    1c18:	e8 06 37 00 00       	call   5323 <exit>
+    1c1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001c20 <unlinkread>:
+{
+    1c20:	55                   	push   %ebp
+    1c21:	89 e5                	mov    %esp,%ebp
+    1c23:	56                   	push   %esi
+    1c24:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    1c25:	83 ec 08             	sub    $0x8,%esp
+    1c28:	68 57 5e 00 00       	push   $0x5e57
+    1c2d:	6a 01                	push   $0x1
+    1c2f:	e8 5c 38 00 00       	call   5490 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    1c34:	5b                   	pop    %ebx
+    1c35:	5e                   	pop    %esi
+    1c36:	68 02 02 00 00       	push   $0x202
+    1c3b:	68 68 5e 00 00       	push   $0x5e68
+    1c40:	e8 1e 37 00 00       	call   5363 <open>
+  if(fd < 0){
+    1c45:	83 c4 10             	add    $0x10,%esp
+    1c48:	85 c0                	test   %eax,%eax
+    1c4a:	0f 88 e6 00 00 00    	js     1d36 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    1c50:	83 ec 04             	sub    $0x4,%esp
+    1c53:	89 c3                	mov    %eax,%ebx
+    1c55:	6a 05                	push   $0x5
+    1c57:	68 8d 5e 00 00       	push   $0x5e8d
+    1c5c:	50                   	push   %eax
+    1c5d:	e8 e1 36 00 00       	call   5343 <write>
+  close(fd);
+    1c62:	89 1c 24             	mov    %ebx,(%esp)
+    1c65:	e8 e1 36 00 00       	call   534b <close>
+  fd = open("unlinkread", O_RDWR);
+    1c6a:	58                   	pop    %eax
+    1c6b:	5a                   	pop    %edx
+    1c6c:	6a 02                	push   $0x2
+    1c6e:	68 68 5e 00 00       	push   $0x5e68
+    1c73:	e8 eb 36 00 00       	call   5363 <open>
+  if(fd < 0){
+    1c78:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    1c7b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1c7d:	85 c0                	test   %eax,%eax
+    1c7f:	0f 88 10 01 00 00    	js     1d95 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    1c85:	83 ec 0c             	sub    $0xc,%esp
+    1c88:	68 68 5e 00 00       	push   $0x5e68
+    1c8d:	e8 e1 36 00 00       	call   5373 <unlink>
+    1c92:	83 c4 10             	add    $0x10,%esp
+    1c95:	85 c0                	test   %eax,%eax
+    1c97:	0f 85 e5 00 00 00    	jne    1d82 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    1c9d:	83 ec 08             	sub    $0x8,%esp
+    1ca0:	68 02 02 00 00       	push   $0x202
+    1ca5:	68 68 5e 00 00       	push   $0x5e68
+    1caa:	e8 b4 36 00 00       	call   5363 <open>
+  write(fd1, "yyy", 3);
+    1caf:	83 c4 0c             	add    $0xc,%esp
+    1cb2:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    1cb4:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    1cb6:	68 c5 5e 00 00       	push   $0x5ec5
+    1cbb:	50                   	push   %eax
+    1cbc:	e8 82 36 00 00       	call   5343 <write>
+  close(fd1);
+    1cc1:	89 34 24             	mov    %esi,(%esp)
+    1cc4:	e8 82 36 00 00       	call   534b <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1cc9:	83 c4 0c             	add    $0xc,%esp
+    1ccc:	68 00 20 00 00       	push   $0x2000
+    1cd1:	68 00 ab 00 00       	push   $0xab00
+    1cd6:	53                   	push   %ebx
+    1cd7:	e8 5f 36 00 00       	call   533b <read>
+    1cdc:	83 c4 10             	add    $0x10,%esp
+    1cdf:	83 f8 05             	cmp    $0x5,%eax
+    1ce2:	0f 85 87 00 00 00    	jne    1d6f <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    1ce8:	80 3d 00 ab 00 00 68 	cmpb   $0x68,0xab00
+    1cef:	75 6b                	jne    1d5c <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    1cf1:	83 ec 04             	sub    $0x4,%esp
+    1cf4:	6a 0a                	push   $0xa
+    1cf6:	68 00 ab 00 00       	push   $0xab00
+    1cfb:	53                   	push   %ebx
+    1cfc:	e8 42 36 00 00       	call   5343 <write>
+    1d01:	83 c4 10             	add    $0x10,%esp
+    1d04:	83 f8 0a             	cmp    $0xa,%eax
+    1d07:	75 40                	jne    1d49 <unlinkread+0x129>
+  close(fd);
+    1d09:	83 ec 0c             	sub    $0xc,%esp
+    1d0c:	53                   	push   %ebx
+    1d0d:	e8 39 36 00 00       	call   534b <close>
+  unlink("unlinkread");
+    1d12:	c7 04 24 68 5e 00 00 	movl   $0x5e68,(%esp)
+    1d19:	e8 55 36 00 00       	call   5373 <unlink>
+  printf(1, "unlinkread ok\n");
+    1d1e:	58                   	pop    %eax
+    1d1f:	5a                   	pop    %edx
+    1d20:	68 10 5f 00 00       	push   $0x5f10
+    1d25:	6a 01                	push   $0x1
+    1d27:	e8 64 37 00 00       	call   5490 <printf>
+}
+    1d2c:	83 c4 10             	add    $0x10,%esp
+    1d2f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1d32:	5b                   	pop    %ebx
+    1d33:	5e                   	pop    %esi
+    1d34:	5d                   	pop    %ebp
+    1d35:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    1d36:	51                   	push   %ecx
+    1d37:	51                   	push   %ecx
+    1d38:	68 73 5e 00 00       	push   $0x5e73
+    1d3d:	6a 01                	push   $0x1
+    1d3f:	e8 4c 37 00 00       	call   5490 <printf>
+    exit();
+    1d44:	e8 da 35 00 00       	call   5323 <exit>
+    printf(1, "unlinkread write failed\n");
+    1d49:	51                   	push   %ecx
+    1d4a:	51                   	push   %ecx
+    1d4b:	68 f7 5e 00 00       	push   $0x5ef7
+    1d50:	6a 01                	push   $0x1
+    1d52:	e8 39 37 00 00       	call   5490 <printf>
+    exit();
+    1d57:	e8 c7 35 00 00       	call   5323 <exit>
+    printf(1, "unlinkread wrong data\n");
+    1d5c:	53                   	push   %ebx
+    1d5d:	53                   	push   %ebx
+    1d5e:	68 e0 5e 00 00       	push   $0x5ee0
+    1d63:	6a 01                	push   $0x1
+    1d65:	e8 26 37 00 00       	call   5490 <printf>
+    exit();
+    1d6a:	e8 b4 35 00 00       	call   5323 <exit>
+    printf(1, "unlinkread read failed");
+    1d6f:	56                   	push   %esi
+    1d70:	56                   	push   %esi
+    1d71:	68 c9 5e 00 00       	push   $0x5ec9
+    1d76:	6a 01                	push   $0x1
+    1d78:	e8 13 37 00 00       	call   5490 <printf>
+    exit();
+    1d7d:	e8 a1 35 00 00       	call   5323 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    1d82:	50                   	push   %eax
+    1d83:	50                   	push   %eax
+    1d84:	68 ab 5e 00 00       	push   $0x5eab
+    1d89:	6a 01                	push   $0x1
+    1d8b:	e8 00 37 00 00       	call   5490 <printf>
+    exit();
+    1d90:	e8 8e 35 00 00       	call   5323 <exit>
+    printf(1, "open unlinkread failed\n");
+    1d95:	50                   	push   %eax
+    1d96:	50                   	push   %eax
+    1d97:	68 93 5e 00 00       	push   $0x5e93
+    1d9c:	6a 01                	push   $0x1
+    1d9e:	e8 ed 36 00 00       	call   5490 <printf>
+    exit();
+    1da3:	e8 7b 35 00 00       	call   5323 <exit>
+    1da8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1daf:	90                   	nop
+
+00001db0 <linktest>:
+{
+    1db0:	55                   	push   %ebp
+    1db1:	89 e5                	mov    %esp,%ebp
+    1db3:	53                   	push   %ebx
+    1db4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    1db7:	68 1f 5f 00 00       	push   $0x5f1f
+    1dbc:	6a 01                	push   $0x1
+    1dbe:	e8 cd 36 00 00       	call   5490 <printf>
+  unlink("lf1");
+    1dc3:	c7 04 24 29 5f 00 00 	movl   $0x5f29,(%esp)
+    1dca:	e8 a4 35 00 00       	call   5373 <unlink>
+  unlink("lf2");
+    1dcf:	c7 04 24 2d 5f 00 00 	movl   $0x5f2d,(%esp)
+    1dd6:	e8 98 35 00 00       	call   5373 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    1ddb:	58                   	pop    %eax
+    1ddc:	5a                   	pop    %edx
+    1ddd:	68 02 02 00 00       	push   $0x202
+    1de2:	68 29 5f 00 00       	push   $0x5f29
+    1de7:	e8 77 35 00 00       	call   5363 <open>
+  if(fd < 0){
+    1dec:	83 c4 10             	add    $0x10,%esp
+    1def:	85 c0                	test   %eax,%eax
+    1df1:	0f 88 1e 01 00 00    	js     1f15 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    1df7:	83 ec 04             	sub    $0x4,%esp
+    1dfa:	89 c3                	mov    %eax,%ebx
+    1dfc:	6a 05                	push   $0x5
+    1dfe:	68 8d 5e 00 00       	push   $0x5e8d
+    1e03:	50                   	push   %eax
+    1e04:	e8 3a 35 00 00       	call   5343 <write>
+    1e09:	83 c4 10             	add    $0x10,%esp
+    1e0c:	83 f8 05             	cmp    $0x5,%eax
+    1e0f:	0f 85 98 01 00 00    	jne    1fad <linktest+0x1fd>
+  close(fd);
+    1e15:	83 ec 0c             	sub    $0xc,%esp
+    1e18:	53                   	push   %ebx
+    1e19:	e8 2d 35 00 00       	call   534b <close>
+  if(link("lf1", "lf2") < 0){
+    1e1e:	5b                   	pop    %ebx
+    1e1f:	58                   	pop    %eax
+    1e20:	68 2d 5f 00 00       	push   $0x5f2d
+    1e25:	68 29 5f 00 00       	push   $0x5f29
+    1e2a:	e8 54 35 00 00       	call   5383 <link>
+    1e2f:	83 c4 10             	add    $0x10,%esp
+    1e32:	85 c0                	test   %eax,%eax
+    1e34:	0f 88 60 01 00 00    	js     1f9a <linktest+0x1ea>
+  unlink("lf1");
+    1e3a:	83 ec 0c             	sub    $0xc,%esp
+    1e3d:	68 29 5f 00 00       	push   $0x5f29
+    1e42:	e8 2c 35 00 00       	call   5373 <unlink>
+  if(open("lf1", 0) >= 0){
+    1e47:	58                   	pop    %eax
+    1e48:	5a                   	pop    %edx
+    1e49:	6a 00                	push   $0x0
+    1e4b:	68 29 5f 00 00       	push   $0x5f29
+    1e50:	e8 0e 35 00 00       	call   5363 <open>
+    1e55:	83 c4 10             	add    $0x10,%esp
+    1e58:	85 c0                	test   %eax,%eax
+    1e5a:	0f 89 27 01 00 00    	jns    1f87 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    1e60:	83 ec 08             	sub    $0x8,%esp
+    1e63:	6a 00                	push   $0x0
+    1e65:	68 2d 5f 00 00       	push   $0x5f2d
+    1e6a:	e8 f4 34 00 00       	call   5363 <open>
+  if(fd < 0){
+    1e6f:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    1e72:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1e74:	85 c0                	test   %eax,%eax
+    1e76:	0f 88 f8 00 00 00    	js     1f74 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1e7c:	83 ec 04             	sub    $0x4,%esp
+    1e7f:	68 00 20 00 00       	push   $0x2000
+    1e84:	68 00 ab 00 00       	push   $0xab00
+    1e89:	50                   	push   %eax
+    1e8a:	e8 ac 34 00 00       	call   533b <read>
+    1e8f:	83 c4 10             	add    $0x10,%esp
+    1e92:	83 f8 05             	cmp    $0x5,%eax
+    1e95:	0f 85 c6 00 00 00    	jne    1f61 <linktest+0x1b1>
+  close(fd);
+    1e9b:	83 ec 0c             	sub    $0xc,%esp
+    1e9e:	53                   	push   %ebx
+    1e9f:	e8 a7 34 00 00       	call   534b <close>
+  if(link("lf2", "lf2") >= 0){
+    1ea4:	58                   	pop    %eax
+    1ea5:	5a                   	pop    %edx
+    1ea6:	68 2d 5f 00 00       	push   $0x5f2d
+    1eab:	68 2d 5f 00 00       	push   $0x5f2d
+    1eb0:	e8 ce 34 00 00       	call   5383 <link>
+    1eb5:	83 c4 10             	add    $0x10,%esp
+    1eb8:	85 c0                	test   %eax,%eax
+    1eba:	0f 89 8e 00 00 00    	jns    1f4e <linktest+0x19e>
+  unlink("lf2");
+    1ec0:	83 ec 0c             	sub    $0xc,%esp
+    1ec3:	68 2d 5f 00 00       	push   $0x5f2d
+    1ec8:	e8 a6 34 00 00       	call   5373 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    1ecd:	59                   	pop    %ecx
+    1ece:	5b                   	pop    %ebx
+    1ecf:	68 29 5f 00 00       	push   $0x5f29
+    1ed4:	68 2d 5f 00 00       	push   $0x5f2d
+    1ed9:	e8 a5 34 00 00       	call   5383 <link>
+    1ede:	83 c4 10             	add    $0x10,%esp
+    1ee1:	85 c0                	test   %eax,%eax
+    1ee3:	79 56                	jns    1f3b <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    1ee5:	83 ec 08             	sub    $0x8,%esp
+    1ee8:	68 29 5f 00 00       	push   $0x5f29
+    1eed:	68 39 64 00 00       	push   $0x6439
+    1ef2:	e8 8c 34 00 00       	call   5383 <link>
+    1ef7:	83 c4 10             	add    $0x10,%esp
+    1efa:	85 c0                	test   %eax,%eax
+    1efc:	79 2a                	jns    1f28 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    1efe:	83 ec 08             	sub    $0x8,%esp
+    1f01:	68 c7 5f 00 00       	push   $0x5fc7
+    1f06:	6a 01                	push   $0x1
+    1f08:	e8 83 35 00 00       	call   5490 <printf>
+}
+    1f0d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f10:	83 c4 10             	add    $0x10,%esp
+    1f13:	c9                   	leave
+    1f14:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    1f15:	50                   	push   %eax
+    1f16:	50                   	push   %eax
+    1f17:	68 31 5f 00 00       	push   $0x5f31
+    1f1c:	6a 01                	push   $0x1
+    1f1e:	e8 6d 35 00 00       	call   5490 <printf>
+    exit();
+    1f23:	e8 fb 33 00 00       	call   5323 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    1f28:	50                   	push   %eax
+    1f29:	50                   	push   %eax
+    1f2a:	68 ab 5f 00 00       	push   $0x5fab
+    1f2f:	6a 01                	push   $0x1
+    1f31:	e8 5a 35 00 00       	call   5490 <printf>
+    exit();
+    1f36:	e8 e8 33 00 00       	call   5323 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    1f3b:	52                   	push   %edx
+    1f3c:	52                   	push   %edx
+    1f3d:	68 74 70 00 00       	push   $0x7074
+    1f42:	6a 01                	push   $0x1
+    1f44:	e8 47 35 00 00       	call   5490 <printf>
+    exit();
+    1f49:	e8 d5 33 00 00       	call   5323 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    1f4e:	50                   	push   %eax
+    1f4f:	50                   	push   %eax
+    1f50:	68 8d 5f 00 00       	push   $0x5f8d
+    1f55:	6a 01                	push   $0x1
+    1f57:	e8 34 35 00 00       	call   5490 <printf>
+    exit();
+    1f5c:	e8 c2 33 00 00       	call   5323 <exit>
+    printf(1, "read lf2 failed\n");
+    1f61:	51                   	push   %ecx
+    1f62:	51                   	push   %ecx
+    1f63:	68 7c 5f 00 00       	push   $0x5f7c
+    1f68:	6a 01                	push   $0x1
+    1f6a:	e8 21 35 00 00       	call   5490 <printf>
+    exit();
+    1f6f:	e8 af 33 00 00       	call   5323 <exit>
+    printf(1, "open lf2 failed\n");
+    1f74:	53                   	push   %ebx
+    1f75:	53                   	push   %ebx
+    1f76:	68 6b 5f 00 00       	push   $0x5f6b
+    1f7b:	6a 01                	push   $0x1
+    1f7d:	e8 0e 35 00 00       	call   5490 <printf>
+    exit();
+    1f82:	e8 9c 33 00 00       	call   5323 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    1f87:	50                   	push   %eax
+    1f88:	50                   	push   %eax
+    1f89:	68 4c 70 00 00       	push   $0x704c
+    1f8e:	6a 01                	push   $0x1
+    1f90:	e8 fb 34 00 00       	call   5490 <printf>
+    exit();
+    1f95:	e8 89 33 00 00       	call   5323 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    1f9a:	51                   	push   %ecx
+    1f9b:	51                   	push   %ecx
+    1f9c:	68 56 5f 00 00       	push   $0x5f56
+    1fa1:	6a 01                	push   $0x1
+    1fa3:	e8 e8 34 00 00       	call   5490 <printf>
+    exit();
+    1fa8:	e8 76 33 00 00       	call   5323 <exit>
+    printf(1, "write lf1 failed\n");
+    1fad:	50                   	push   %eax
+    1fae:	50                   	push   %eax
+    1faf:	68 44 5f 00 00       	push   $0x5f44
+    1fb4:	6a 01                	push   $0x1
+    1fb6:	e8 d5 34 00 00       	call   5490 <printf>
+    exit();
+    1fbb:	e8 63 33 00 00       	call   5323 <exit>
+
+00001fc0 <conlookup>:
+{
+    1fc0:	55                   	push   %ebp
+    1fc1:	89 e5                	mov    %esp,%ebp
+    1fc3:	56                   	push   %esi
+    1fc4:	53                   	push   %ebx
+  printf(1, "conlookup test\n");
+    1fc5:	83 ec 08             	sub    $0x8,%esp
+    1fc8:	68 d4 5f 00 00       	push   $0x5fd4
+    1fcd:	6a 01                	push   $0x1
+    1fcf:	e8 bc 34 00 00       	call   5490 <printf>
+  if(mkdir("cl") != 0){
+    1fd4:	c7 04 24 e4 5f 00 00 	movl   $0x5fe4,(%esp)
+    1fdb:	e8 ab 33 00 00       	call   538b <mkdir>
+    1fe0:	83 c4 10             	add    $0x10,%esp
+    1fe3:	85 c0                	test   %eax,%eax
+    1fe5:	0f 85 a6 01 00 00    	jne    2191 <conlookup+0x1d1>
+  fd = open("cl/f", O_CREATE|O_RDWR);
+    1feb:	83 ec 08             	sub    $0x8,%esp
+    1fee:	89 c6                	mov    %eax,%esi
+    1ff0:	68 02 02 00 00       	push   $0x202
+    1ff5:	68 f8 5f 00 00       	push   $0x5ff8
+    1ffa:	e8 64 33 00 00       	call   5363 <open>
+  if(fd < 0){
+    1fff:	83 c4 10             	add    $0x10,%esp
+    2002:	85 c0                	test   %eax,%eax
+    2004:	0f 88 74 01 00 00    	js     217e <conlookup+0x1be>
+  close(fd);
+    200a:	83 ec 0c             	sub    $0xc,%esp
+    200d:	50                   	push   %eax
+    200e:	e8 38 33 00 00       	call   534b <close>
+    2013:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    2016:	e8 00 33 00 00       	call   531b <fork>
+    if(pid < 0){
+    201b:	85 c0                	test   %eax,%eax
+    201d:	0f 88 47 01 00 00    	js     216a <conlookup+0x1aa>
+    if(pid == 0){
+    2023:	74 7b                	je     20a0 <conlookup+0xe0>
+  for(i = 0; i < 4; i++){
+    2025:	83 c6 01             	add    $0x1,%esi
+    2028:	83 fe 04             	cmp    $0x4,%esi
+    202b:	75 e9                	jne    2016 <conlookup+0x56>
+    wait();
+    202d:	e8 f9 32 00 00       	call   532b <wait>
+    2032:	e8 f4 32 00 00       	call   532b <wait>
+    2037:	e8 ef 32 00 00       	call   532b <wait>
+    203c:	e8 ea 32 00 00       	call   532b <wait>
+  unlink("cl/g");
+    2041:	83 ec 0c             	sub    $0xc,%esp
+    2044:	68 11 60 00 00       	push   $0x6011
+    2049:	e8 25 33 00 00       	call   5373 <unlink>
+  if(unlink("cl/f") != 0 || unlink("cl") != 0){
+    204e:	c7 04 24 f8 5f 00 00 	movl   $0x5ff8,(%esp)
+    2055:	e8 19 33 00 00       	call   5373 <unlink>
+    205a:	83 c4 10             	add    $0x10,%esp
+    205d:	85 c0                	test   %eax,%eax
+    205f:	0f 85 f2 00 00 00    	jne    2157 <conlookup+0x197>
+    2065:	83 ec 0c             	sub    $0xc,%esp
+    2068:	68 e4 5f 00 00       	push   $0x5fe4
+    206d:	e8 01 33 00 00       	call   5373 <unlink>
+    2072:	83 c4 10             	add    $0x10,%esp
+    2075:	85 c0                	test   %eax,%eax
+    2077:	0f 85 da 00 00 00    	jne    2157 <conlookup+0x197>
+  printf(1, "conlookup ok\n");
+    207d:	83 ec 08             	sub    $0x8,%esp
+    2080:	68 8a 60 00 00       	push   $0x608a
+    2085:	6a 01                	push   $0x1
+    2087:	e8 04 34 00 00       	call   5490 <printf>
+}
+    208c:	83 c4 10             	add    $0x10,%esp
+    208f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2092:	5b                   	pop    %ebx
+    2093:	5e                   	pop    %esi
+    2094:	5d                   	pop    %ebp
+    2095:	c3                   	ret
+    2096:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    209d:	8d 76 00             	lea    0x0(%esi),%esi
+    20a0:	bb c8 00 00 00       	mov    $0xc8,%ebx
+    20a5:	8d 76 00             	lea    0x0(%esi),%esi
+        if(i == 0){
+    20a8:	85 f6                	test   %esi,%esi
+    20aa:	75 31                	jne    20dd <conlookup+0x11d>
+          fd = open("cl/g", O_CREATE|O_RDWR);
+    20ac:	83 ec 08             	sub    $0x8,%esp
+    20af:	68 02 02 00 00       	push   $0x202
+    20b4:	68 11 60 00 00       	push   $0x6011
+    20b9:	e8 a5 32 00 00       	call   5363 <open>
+          if(fd < 0){
+    20be:	83 c4 10             	add    $0x10,%esp
+    20c1:	85 c0                	test   %eax,%eax
+    20c3:	78 7e                	js     2143 <conlookup+0x183>
+          close(fd);
+    20c5:	83 ec 0c             	sub    $0xc,%esp
+    20c8:	50                   	push   %eax
+    20c9:	e8 7d 32 00 00       	call   534b <close>
+          unlink("cl/g");
+    20ce:	c7 04 24 11 60 00 00 	movl   $0x6011,(%esp)
+    20d5:	e8 99 32 00 00       	call   5373 <unlink>
+    20da:	83 c4 10             	add    $0x10,%esp
+        fd = open("/cl/../cl/./f", 0);
+    20dd:	83 ec 08             	sub    $0x8,%esp
+    20e0:	6a 00                	push   $0x0
+    20e2:	68 2a 60 00 00       	push   $0x602a
+    20e7:	e8 77 32 00 00       	call   5363 <open>
+        if(fd < 0){
+    20ec:	83 c4 10             	add    $0x10,%esp
+    20ef:	85 c0                	test   %eax,%eax
+    20f1:	78 28                	js     211b <conlookup+0x15b>
+        close(fd);
+    20f3:	83 ec 0c             	sub    $0xc,%esp
+    20f6:	50                   	push   %eax
+    20f7:	e8 4f 32 00 00       	call   534b <close>
+        if(open("cl/none", 0) >= 0){
+    20fc:	5a                   	pop    %edx
+    20fd:	59                   	pop    %ecx
+    20fe:	6a 00                	push   $0x0
+    2100:	68 55 60 00 00       	push   $0x6055
+    2105:	e8 59 32 00 00       	call   5363 <open>
+    210a:	83 c4 10             	add    $0x10,%esp
+    210d:	85 c0                	test   %eax,%eax
+    210f:	79 1e                	jns    212f <conlookup+0x16f>
+      for(j = 0; j < 200; j++){
+    2111:	83 eb 01             	sub    $0x1,%ebx
+    2114:	75 92                	jne    20a8 <conlookup+0xe8>
+      exit();
+    2116:	e8 08 32 00 00       	call   5323 <exit>
+          printf(1, "conlookup: open cl/f failed\n");
+    211b:	83 ec 08             	sub    $0x8,%esp
+    211e:	68 38 60 00 00       	push   $0x6038
+    2123:	6a 01                	push   $0x1
+    2125:	e8 66 33 00 00       	call   5490 <printf>
+          exit();
+    212a:	e8 f4 31 00 00       	call   5323 <exit>
+          printf(1, "conlookup: opened cl/none\n");
+    212f:	83 ec 08             	sub    $0x8,%esp
+    2132:	68 5d 60 00 00       	push   $0x605d
+    2137:	6a 01                	push   $0x1
+    2139:	e8 52 33 00 00       	call   5490 <printf>
+          exit();
+    213e:	e8 e0 31 00 00       	call   5323 <exit>
+            printf(1, "create cl/g failed\n");
+    2143:	83 ec 08             	sub    $0x8,%esp
+    2146:	68 16 60 00 00       	push   $0x6016
+    214b:	6a 01                	push   $0x1
+    214d:	e8 3e 33 00 00       	call   5490 <printf>
+            exit();
+    2152:	e8 cc 31 00 00       	call   5323 <exit>
+    printf(1, "unlink cl failed\n");
+    2157:	50                   	push   %eax
+    2158:	50                   	push   %eax
+    2159:	68 78 60 00 00       	push   $0x6078
+    215e:	6a 01                	push   $0x1
+    2160:	e8 2b 33 00 00       	call   5490 <printf>
+    exit();
+    2165:	e8 b9 31 00 00       	call   5323 <exit>
+      printf(1, "fork failed\n");
+    216a:	83 ec 08             	sub    $0x8,%esp
+    216d:	68 6f 6d 00 00       	push   $0x6d6f
+    2172:	6a 01                	push   $0x1
+    2174:	e8 17 33 00 00       	call   5490 <printf>
+      exit();
+    2179:	e8 a5 31 00 00       	call   5323 <exit>
+    printf(1, "create cl/f failed\n");
+    217e:	53                   	push   %ebx
+    217f:	53                   	push   %ebx
+    2180:	68 fd 5f 00 00       	push   $0x5ffd
+    2185:	6a 01                	push   $0x1
+    2187:	e8 04 33 00 00       	call   5490 <printf>
+    exit();
+    218c:	e8 92 31 00 00       	call   5323 <exit>
+    printf(1, "mkdir cl failed\n");
+    2191:	56                   	push   %esi
+    2192:	56                   	push   %esi
+    2193:	68 e7 5f 00 00       	push   $0x5fe7
+    2198:	6a 01                	push   $0x1
+    219a:	e8 f1 32 00 00       	call   5490 <printf>
+    exit();
+    219f:	e8 7f 31 00 00       	call   5323 <exit>
+    21a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    21ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    21af:	90                   	nop
+
+000021b0 <dcachetest>:
+{
+    21b0:	55                   	push   %ebp
+    21b1:	89 e5                	mov    %esp,%ebp
+    21b3:	53                   	push   %ebx
+  printf(1, "dcache test\n");
+    21b4:	bb 03 00 00 00       	mov    $0x3,%ebx
+{
+    21b9:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dcache test\n");
+    21bc:	68 98 60 00 00       	push   $0x6098
+    21c1:	6a 01                	push   $0x1
+    21c3:	e8 c8 32 00 00       	call   5490 <printf>
+    21c8:	83 c4 10             	add    $0x10,%esp
+    if(open("dc/f", 0) >= 0 || open("dc", 0) >= 0){
+    21cb:	83 ec 08             	sub    $0x8,%esp
+    21ce:	6a 00                	push   $0x0
+    21d0:	68 a5 60 00 00       	push   $0x60a5
+    21d5:	e8 89 31 00 00       	call   5363 <open>
+    21da:	83 c4 10             	add    $0x10,%esp
+    21dd:	85 c0                	test   %eax,%eax
+    21df:	0f 89 40 01 00 00    	jns    2325 <dcachetest+0x175>
+    21e5:	83 ec 08             	sub    $0x8,%esp
+    21e8:	6a 00                	push   $0x0
+    21ea:	68 aa 60 00 00       	push   $0x60aa
+    21ef:	e8 6f 31 00 00       	call   5363 <open>
+    21f4:	83 c4 10             	add    $0x10,%esp
+    21f7:	85 c0                	test   %eax,%eax
+    21f9:	0f 89 26 01 00 00    	jns    2325 <dcachetest+0x175>
+    if(mkdir("dc") != 0){
+    21ff:	83 ec 0c             	sub    $0xc,%esp
+    2202:	68 aa 60 00 00       	push   $0x60aa
+    2207:	e8 7f 31 00 00       	call   538b <mkdir>
+    220c:	83 c4 10             	add    $0x10,%esp
+    220f:	85 c0                	test   %eax,%eax
+    2211:	0f 85 ae 01 00 00    	jne    23c5 <dcachetest+0x215>
+    if(open("dc/f", 0) >= 0){
+    2217:	83 ec 08             	sub    $0x8,%esp
+    221a:	6a 00                	push   $0x0
+    221c:	68 a5 60 00 00       	push   $0x60a5
+    2221:	e8 3d 31 00 00       	call   5363 <open>
+    2226:	83 c4 10             	add    $0x10,%esp
+    2229:	85 c0                	test   %eax,%eax
+    222b:	0f 89 80 01 00 00    	jns    23b1 <dcachetest+0x201>
+    fd = open("dc/f", O_CREATE|O_RDWR);
+    2231:	83 ec 08             	sub    $0x8,%esp
+    2234:	68 02 02 00 00       	push   $0x202
+    2239:	68 a5 60 00 00       	push   $0x60a5
+    223e:	e8 20 31 00 00       	call   5363 <open>
+    if(fd < 0){
+    2243:	83 c4 10             	add    $0x10,%esp
+    2246:	85 c0                	test   %eax,%eax
+    2248:	0f 88 4f 01 00 00    	js     239d <dcachetest+0x1ed>
+    close(fd);
+    224e:	83 ec 0c             	sub    $0xc,%esp
+    2251:	50                   	push   %eax
+    2252:	e8 f4 30 00 00       	call   534b <close>
+    if(link("dc/f", "dc/g") != 0){
+    2257:	58                   	pop    %eax
+    2258:	5a                   	pop    %edx
+    2259:	68 e2 60 00 00       	push   $0x60e2
+    225e:	68 a5 60 00 00       	push   $0x60a5
+    2263:	e8 1b 31 00 00       	call   5383 <link>
+    2268:	83 c4 10             	add    $0x10,%esp
+    226b:	85 c0                	test   %eax,%eax
+    226d:	0f 85 16 01 00 00    	jne    2389 <dcachetest+0x1d9>
+    if((fd = open("dc/g", 0)) < 0){
+    2273:	83 ec 08             	sub    $0x8,%esp
+    2276:	6a 00                	push   $0x0
+    2278:	68 e2 60 00 00       	push   $0x60e2
+    227d:	e8 e1 30 00 00       	call   5363 <open>
+    2282:	83 c4 10             	add    $0x10,%esp
+    2285:	85 c0                	test   %eax,%eax
+    2287:	0f 88 e8 00 00 00    	js     2375 <dcachetest+0x1c5>
+    close(fd);
+    228d:	83 ec 0c             	sub    $0xc,%esp
+    2290:	50                   	push   %eax
+    2291:	e8 b5 30 00 00       	call   534b <close>
+    if(unlink("dc/f") != 0 || unlink("dc/g") != 0){
+    2296:	c7 04 24 a5 60 00 00 	movl   $0x60a5,(%esp)
+    229d:	e8 d1 30 00 00       	call   5373 <unlink>
+    22a2:	83 c4 10             	add    $0x10,%esp
+    22a5:	85 c0                	test   %eax,%eax
+    22a7:	0f 85 a0 00 00 00    	jne    234d <dcachetest+0x19d>
+    22ad:	83 ec 0c             	sub    $0xc,%esp
+    22b0:	68 e2 60 00 00       	push   $0x60e2
+    22b5:	e8 b9 30 00 00       	call   5373 <unlink>
+    22ba:	83 c4 10             	add    $0x10,%esp
+    22bd:	85 c0                	test   %eax,%eax
+    22bf:	0f 85 88 00 00 00    	jne    234d <dcachetest+0x19d>
+    if(open("dc/f", 0) >= 0 || open("dc/g", 0) >= 0){
+    22c5:	83 ec 08             	sub    $0x8,%esp
+    22c8:	6a 00                	push   $0x0
+    22ca:	68 a5 60 00 00       	push   $0x60a5
+    22cf:	e8 8f 30 00 00       	call   5363 <open>
+    22d4:	83 c4 10             	add    $0x10,%esp
+    22d7:	85 c0                	test   %eax,%eax
+    22d9:	79 5e                	jns    2339 <dcachetest+0x189>
+    22db:	83 ec 08             	sub    $0x8,%esp
+    22de:	6a 00                	push   $0x0
+    22e0:	68 e2 60 00 00       	push   $0x60e2
+    22e5:	e8 79 30 00 00       	call   5363 <open>
+    22ea:	83 c4 10             	add    $0x10,%esp
+    22ed:	85 c0                	test   %eax,%eax
+    22ef:	79 48                	jns    2339 <dcachetest+0x189>
+    if(unlink("dc") != 0){
+    22f1:	83 ec 0c             	sub    $0xc,%esp
+    22f4:	68 aa 60 00 00       	push   $0x60aa
+    22f9:	e8 75 30 00 00       	call   5373 <unlink>
+    22fe:	83 c4 10             	add    $0x10,%esp
+    2301:	85 c0                	test   %eax,%eax
+    2303:	75 5c                	jne    2361 <dcachetest+0x1b1>
+  for(i = 0; i < 3; i++){
+    2305:	83 eb 01             	sub    $0x1,%ebx
+    2308:	0f 85 bd fe ff ff    	jne    21cb <dcachetest+0x1b>
+  printf(1, "dcache ok\n");
+    230e:	83 ec 08             	sub    $0x8,%esp
+    2311:	68 4c 61 00 00       	push   $0x614c
+    2316:	6a 01                	push   $0x1
+    2318:	e8 73 31 00 00       	call   5490 <printf>
+}
+    231d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2320:	83 c4 10             	add    $0x10,%esp
+    2323:	c9                   	leave
+    2324:	c3                   	ret
+      printf(1, "dcache: dc exists before mkdir\n");
+    2325:	83 ec 08             	sub    $0x8,%esp
+    2328:	68 98 70 00 00       	push   $0x7098
+    232d:	6a 01                	push   $0x1
+    232f:	e8 5c 31 00 00       	call   5490 <printf>
+      exit();
+    2334:	e8 ea 2f 00 00       	call   5323 <exit>
+      printf(1, "dcache: unlinked name still there\n");
+    2339:	83 ec 08             	sub    $0x8,%esp
+    233c:	68 dc 70 00 00       	push   $0x70dc
+    2341:	6a 01                	push   $0x1
+    2343:	e8 48 31 00 00       	call   5490 <printf>
+      exit();
+    2348:	e8 d6 2f 00 00       	call   5323 <exit>
+      printf(1, "dcache: unlink failed\n");
+    234d:	83 ec 08             	sub    $0x8,%esp
+    2350:	68 1b 61 00 00       	push   $0x611b
+    2355:	6a 01                	push   $0x1
+    2357:	e8 34 31 00 00       	call   5490 <printf>
+      exit();
+    235c:	e8 c2 2f 00 00       	call   5323 <exit>
+      printf(1, "dcache: unlink dc failed\n");
+    2361:	83 ec 08             	sub    $0x8,%esp
+    2364:	68 32 61 00 00       	push   $0x6132
+    2369:	6a 01                	push   $0x1
+    236b:	e8 20 31 00 00       	call   5490 <printf>
+      exit();
+    2370:	e8 ae 2f 00 00       	call   5323 <exit>
+      printf(1, "dcache: open dc/g failed\n");
+    2375:	83 ec 08             	sub    $0x8,%esp
+    2378:	68 01 61 00 00       	push   $0x6101
+    237d:	6a 01                	push   $0x1
+    237f:	e8 0c 31 00 00       	call   5490 <printf>
+      exit();
+    2384:	e8 9a 2f 00 00       	call   5323 <exit>
+      printf(1, "dcache: link dc/g failed\n");
+    2389:	83 ec 08             	sub    $0x8,%esp
+    238c:	68 e7 60 00 00       	push   $0x60e7
+    2391:	6a 01                	push   $0x1
+    2393:	e8 f8 30 00 00       	call   5490 <printf>
+      exit();
+    2398:	e8 86 2f 00 00       	call   5323 <exit>
+      printf(1, "dcache: create dc/f failed\n");
+    239d:	83 ec 08             	sub    $0x8,%esp
+    23a0:	68 c6 60 00 00       	push   $0x60c6
+    23a5:	6a 01                	push   $0x1
+    23a7:	e8 e4 30 00 00       	call   5490 <printf>
+      exit();
+    23ac:	e8 72 2f 00 00       	call   5323 <exit>
+      printf(1, "dcache: dc/f exists before create\n");
+    23b1:	83 ec 08             	sub    $0x8,%esp
+    23b4:	68 b8 70 00 00       	push   $0x70b8
+    23b9:	6a 01                	push   $0x1
+    23bb:	e8 d0 30 00 00       	call   5490 <printf>
+      exit();
+    23c0:	e8 5e 2f 00 00       	call   5323 <exit>
+      printf(1, "dcache: mkdir dc failed\n");
+    23c5:	83 ec 08             	sub    $0x8,%esp
+    23c8:	68 ad 60 00 00       	push   $0x60ad
+    23cd:	6a 01                	push   $0x1
+    23cf:	e8 bc 30 00 00       	call   5490 <printf>
+      exit();
+    23d4:	e8 4a 2f 00 00       	call   5323 <exit>
+    23d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000023e0 <concreate>:
+{
+    23e0:	55                   	push   %ebp
+    23e1:	89 e5                	mov    %esp,%ebp
+    23e3:	57                   	push   %edi
+    23e4:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    23e5:	31 f6                	xor    %esi,%esi
+{
+    23e7:	53                   	push   %ebx
+    23e8:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    23eb:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    23ee:	68 57 61 00 00       	push   $0x6157
+    23f3:	6a 01                	push   $0x1
+    23f5:	e8 96 30 00 00       	call   5490 <printf>
+  file[0] = 'C';
+    23fa:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    23fe:	83 c4 10             	add    $0x10,%esp
+    2401:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    2405:	eb 4c                	jmp    2453 <concreate+0x73>
+    2407:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    240e:	66 90                	xchg   %ax,%ax
+    2410:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    2416:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    241b:	0f 83 8f 00 00 00    	jae    24b0 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    2421:	83 ec 08             	sub    $0x8,%esp
+    2424:	68 02 02 00 00       	push   $0x202
+    2429:	53                   	push   %ebx
+    242a:	e8 34 2f 00 00       	call   5363 <open>
+      if(fd < 0){
+    242f:	83 c4 10             	add    $0x10,%esp
+    2432:	85 c0                	test   %eax,%eax
+    2434:	78 63                	js     2499 <concreate+0xb9>
+      close(fd);
+    2436:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    2439:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    243c:	50                   	push   %eax
+    243d:	e8 09 2f 00 00       	call   534b <close>
+    2442:	83 c4 10             	add    $0x10,%esp
+      wait();
+    2445:	e8 e1 2e 00 00       	call   532b <wait>
+  for(i = 0; i < 40; i++){
+    244a:	83 fe 28             	cmp    $0x28,%esi
+    244d:	0f 84 7f 00 00 00    	je     24d2 <concreate+0xf2>
+    unlink(file);
+    2453:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    2456:	8d 46 30             	lea    0x30(%esi),%eax
+    2459:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    245c:	53                   	push   %ebx
+    245d:	e8 11 2f 00 00       	call   5373 <unlink>
+    pid = fork();
+    2462:	e8 b4 2e 00 00       	call   531b <fork>
+    if(pid && (i % 3) == 1){
+    2467:	83 c4 10             	add    $0x10,%esp
+    246a:	85 c0                	test   %eax,%eax
+    246c:	75 a2                	jne    2410 <concreate+0x30>
+      link("C0", file);
+    246e:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    2474:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    247a:	0f 83 d0 00 00 00    	jae    2550 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    2480:	83 ec 08             	sub    $0x8,%esp
+    2483:	68 02 02 00 00       	push   $0x202
+    2488:	53                   	push   %ebx
+    2489:	e8 d5 2e 00 00       	call   5363 <open>
+      if(fd < 0){
+    248e:	83 c4 10             	add    $0x10,%esp
+    2491:	85 c0                	test   %eax,%eax
+    2493:	0f 89 ea 01 00 00    	jns    2683 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    2499:	83 ec 04             	sub    $0x4,%esp
+    249c:	53                   	push   %ebx
+    249d:	68 6a 61 00 00       	push   $0x616a
+    24a2:	6a 01                	push   $0x1
+    24a4:	e8 e7 2f 00 00       	call   5490 <printf>
+        exit();
+    24a9:	e8 75 2e 00 00       	call   5323 <exit>
+    24ae:	66 90                	xchg   %ax,%ax
+      link("C0", file);
+    24b0:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    24b3:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    24b6:	53                   	push   %ebx
+    24b7:	68 67 61 00 00       	push   $0x6167
+    24bc:	e8 c2 2e 00 00       	call   5383 <link>
+    24c1:	83 c4 10             	add    $0x10,%esp
+      wait();
+    24c4:	e8 62 2e 00 00       	call   532b <wait>
+  for(i = 0; i < 40; i++){
+    24c9:	83 fe 28             	cmp    $0x28,%esi
+    24cc:	0f 85 81 ff ff ff    	jne    2453 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    24d2:	83 ec 04             	sub    $0x4,%esp
+    24d5:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    24d8:	6a 28                	push   $0x28
+    24da:	6a 00                	push   $0x0
+    24dc:	50                   	push   %eax
+    24dd:	e8 be 2c 00 00       	call   51a0 <memset>
+  fd = open(".", 0);
+    24e2:	5e                   	pop    %esi
+    24e3:	5f                   	pop    %edi
+    24e4:	6a 00                	push   $0x0
+    24e6:	68 39 64 00 00       	push   $0x6439
+    24eb:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    24ee:	e8 70 2e 00 00       	call   5363 <open>
+  n = 0;
+    24f3:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    24fa:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    24fd:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    24ff:	90                   	nop
+    2500:	83 ec 04             	sub    $0x4,%esp
+    2503:	6a 10                	push   $0x10
+    2505:	57                   	push   %edi
+    2506:	56                   	push   %esi
+    2507:	e8 2f 2e 00 00       	call   533b <read>
+    250c:	83 c4 10             	add    $0x10,%esp
+    250f:	85 c0                	test   %eax,%eax
+    2511:	7e 5d                	jle    2570 <concreate+0x190>
+    if(de.inum == 0)
+    2513:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    2518:	74 e6                	je     2500 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    251a:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    251e:	75 e0                	jne    2500 <concreate+0x120>
+    2520:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    2524:	75 da                	jne    2500 <concreate+0x120>
+      i = de.name[1] - '0';
+    2526:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    252a:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    252d:	83 f8 27             	cmp    $0x27,%eax
+    2530:	0f 87 5e 01 00 00    	ja     2694 <concreate+0x2b4>
+      if(fa[i]){
+    2536:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    253b:	0f 85 7e 01 00 00    	jne    26bf <concreate+0x2df>
+      n++;
+    2541:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    2545:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    254a:	eb b4                	jmp    2500 <concreate+0x120>
+    254c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    2550:	83 ec 08             	sub    $0x8,%esp
+    2553:	53                   	push   %ebx
+    2554:	68 67 61 00 00       	push   $0x6167
+    2559:	e8 25 2e 00 00       	call   5383 <link>
+    255e:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2561:	e8 bd 2d 00 00       	call   5323 <exit>
+    2566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    256d:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    2570:	83 ec 0c             	sub    $0xc,%esp
+    2573:	56                   	push   %esi
+    2574:	e8 d2 2d 00 00       	call   534b <close>
+  if(n != 40){
+    2579:	83 c4 10             	add    $0x10,%esp
+    257c:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    2580:	0f 85 26 01 00 00    	jne    26ac <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    2586:	31 f6                	xor    %esi,%esi
+    2588:	eb 48                	jmp    25d2 <concreate+0x1f2>
+    258a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    2590:	85 ff                	test   %edi,%edi
+    2592:	74 05                	je     2599 <concreate+0x1b9>
+    2594:	83 f8 01             	cmp    $0x1,%eax
+    2597:	74 68                	je     2601 <concreate+0x221>
+      unlink(file);
+    2599:	83 ec 0c             	sub    $0xc,%esp
+    259c:	53                   	push   %ebx
+    259d:	e8 d1 2d 00 00       	call   5373 <unlink>
+      unlink(file);
+    25a2:	89 1c 24             	mov    %ebx,(%esp)
+    25a5:	e8 c9 2d 00 00       	call   5373 <unlink>
+      unlink(file);
+    25aa:	89 1c 24             	mov    %ebx,(%esp)
+    25ad:	e8 c1 2d 00 00       	call   5373 <unlink>
+      unlink(file);
+    25b2:	89 1c 24             	mov    %ebx,(%esp)
+    25b5:	e8 b9 2d 00 00       	call   5373 <unlink>
+    25ba:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    25bd:	85 ff                	test   %edi,%edi
+    25bf:	74 a0                	je     2561 <concreate+0x181>
+      wait();
+    25c1:	e8 65 2d 00 00       	call   532b <wait>
+  for(i = 0; i < 40; i++){
+    25c6:	83 c6 01             	add    $0x1,%esi
+    25c9:	83 fe 28             	cmp    $0x28,%esi
+    25cc:	0f 84 86 00 00 00    	je     2658 <concreate+0x278>
+    file[1] = '0' + i;
+    25d2:	8d 46 30             	lea    0x30(%esi),%eax
+    25d5:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    25d8:	e8 3e 2d 00 00       	call   531b <fork>
+    25dd:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    25df:	85 c0                	test   %eax,%eax
+    25e1:	0f 88 88 00 00 00    	js     266f <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    25e7:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    25ec:	f7 e6                	mul    %esi
+    25ee:	89 d0                	mov    %edx,%eax
+    25f0:	83 e2 fe             	and    $0xfffffffe,%edx
+    25f3:	d1 e8                	shr    %eax
+    25f5:	01 c2                	add    %eax,%edx
+    25f7:	89 f0                	mov    %esi,%eax
+    25f9:	29 d0                	sub    %edx,%eax
+    25fb:	89 c1                	mov    %eax,%ecx
+    25fd:	09 f9                	or     %edi,%ecx
+    25ff:	75 8f                	jne    2590 <concreate+0x1b0>
+      close(open(file, 0));
+    2601:	83 ec 08             	sub    $0x8,%esp
+    2604:	6a 00                	push   $0x0
+    2606:	53                   	push   %ebx
+    2607:	e8 57 2d 00 00       	call   5363 <open>
+    260c:	89 04 24             	mov    %eax,(%esp)
+    260f:	e8 37 2d 00 00       	call   534b <close>
+      close(open(file, 0));
+    2614:	58                   	pop    %eax
+    2615:	5a                   	pop    %edx
+    2616:	6a 00                	push   $0x0
+    2618:	53                   	push   %ebx
+    2619:	e8 45 2d 00 00       	call   5363 <open>
+    261e:	89 04 24             	mov    %eax,(%esp)
+    2621:	e8 25 2d 00 00       	call   534b <close>
+      close(open(file, 0));
+    2626:	59                   	pop    %ecx
+    2627:	58                   	pop    %eax
+    2628:	6a 00                	push   $0x0
+    262a:	53                   	push   %ebx
+    262b:	e8 33 2d 00 00       	call   5363 <open>
+    2630:	89 04 24             	mov    %eax,(%esp)
+    2633:	e8 13 2d 00 00       	call   534b <close>
+      close(open(file, 0));
+    2638:	58                   	pop    %eax
+    2639:	5a                   	pop    %edx
+    263a:	6a 00                	push   $0x0
+    263c:	53                   	push   %ebx
+    263d:	e8 21 2d 00 00       	call   5363 <open>
+    2642:	89 04 24             	mov    %eax,(%esp)
+    2645:	e8 01 2d 00 00       	call   534b <close>
+    264a:	83 c4 10             	add    $0x10,%esp
+    264d:	e9 6b ff ff ff       	jmp    25bd <concreate+0x1dd>
+    2652:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    2658:	83 ec 08             	sub    $0x8,%esp
+    265b:	68 bc 61 00 00       	push   $0x61bc
+    2660:	6a 01                	push   $0x1
+    2662:	e8 29 2e 00 00       	call   5490 <printf>
+}
+    2667:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    266a:	5b                   	pop    %ebx
+    266b:	5e                   	pop    %esi
+    266c:	5f                   	pop    %edi
+    266d:	5d                   	pop    %ebp
+    266e:	c3                   	ret
+      printf(1, "fork failed\n");
+    266f:	83 ec 08             	sub    $0x8,%esp
+    2672:	68 6f 6d 00 00       	push   $0x6d6f
+    2677:	6a 01                	push   $0x1
+    2679:	e8 12 2e 00 00       	call   5490 <printf>
+      exit();
+    267e:	e8 a0 2c 00 00       	call   5323 <exit>
+      close(fd);
+    2683:	83 ec 0c             	sub    $0xc,%esp
+    2686:	50                   	push   %eax
+    2687:	e8 bf 2c 00 00       	call   534b <close>
+    268c:	83 c4 10             	add    $0x10,%esp
+    268f:	e9 cd fe ff ff       	jmp    2561 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    2694:	83 ec 04             	sub    $0x4,%esp
+    2697:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    269a:	50                   	push   %eax
+    269b:	68 86 61 00 00       	push   $0x6186
+    26a0:	6a 01                	push   $0x1
+    26a2:	e8 e9 2d 00 00       	call   5490 <printf>
+        exit();
+    26a7:	e8 77 2c 00 00       	call   5323 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    26ac:	51                   	push   %ecx
+    26ad:	51                   	push   %ecx
+    26ae:	68 00 71 00 00       	push   $0x7100
+    26b3:	6a 01                	push   $0x1
+    26b5:	e8 d6 2d 00 00       	call   5490 <printf>
+    exit();
+    26ba:	e8 64 2c 00 00       	call   5323 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    26bf:	83 ec 04             	sub    $0x4,%esp
+    26c2:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    26c5:	50                   	push   %eax
+    26c6:	68 9f 61 00 00       	push   $0x619f
+    26cb:	6a 01                	push   $0x1
+    26cd:	e8 be 2d 00 00       	call   5490 <printf>
+        exit();
+    26d2:	e8 4c 2c 00 00       	call   5323 <exit>
+    26d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    26de:	66 90                	xchg   %ax,%ax
+
+000026e0 <linkunlink>:
+{
+    26e0:	55                   	push   %ebp
+    26e1:	89 e5                	mov    %esp,%ebp
+    26e3:	57                   	push   %edi
+    26e4:	56                   	push   %esi
+    26e5:	53                   	push   %ebx
+    26e6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    26e9:	68 ca 61 00 00       	push   $0x61ca
+    26ee:	6a 01                	push   $0x1
+    26f0:	e8 9b 2d 00 00       	call   5490 <printf>
+  unlink("x");
+    26f5:	c7 04 24 58 62 00 00 	movl   $0x6258,(%esp)
+    26fc:	e8 72 2c 00 00       	call   5373 <unlink>
+  pid = fork();
+    2701:	e8 15 2c 00 00       	call   531b <fork>
+  if(pid < 0){
+    2706:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    2709:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    270c:	85 c0                	test   %eax,%eax
+    270e:	0f 88 b6 00 00 00    	js     27ca <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    2714:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    2718:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    271d:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    2722:	19 ff                	sbb    %edi,%edi
+    2724:	83 e7 60             	and    $0x60,%edi
+    2727:	83 c7 01             	add    $0x1,%edi
+    272a:	eb 1e                	jmp    274a <linkunlink+0x6a>
+    272c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    2730:	83 f8 01             	cmp    $0x1,%eax
+    2733:	74 7b                	je     27b0 <linkunlink+0xd0>
+      unlink("x");
+    2735:	83 ec 0c             	sub    $0xc,%esp
+    2738:	68 58 62 00 00       	push   $0x6258
+    273d:	e8 31 2c 00 00       	call   5373 <unlink>
+    2742:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    2745:	83 eb 01             	sub    $0x1,%ebx
+    2748:	74 41                	je     278b <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    274a:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    2750:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    2756:	89 f8                	mov    %edi,%eax
+    2758:	f7 e6                	mul    %esi
+    275a:	89 d0                	mov    %edx,%eax
+    275c:	83 e2 fe             	and    $0xfffffffe,%edx
+    275f:	d1 e8                	shr    %eax
+    2761:	01 c2                	add    %eax,%edx
+    2763:	89 f8                	mov    %edi,%eax
+    2765:	29 d0                	sub    %edx,%eax
+    2767:	75 c7                	jne    2730 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    2769:	83 ec 08             	sub    $0x8,%esp
+    276c:	68 02 02 00 00       	push   $0x202
+    2771:	68 58 62 00 00       	push   $0x6258
+    2776:	e8 e8 2b 00 00       	call   5363 <open>
+    277b:	89 04 24             	mov    %eax,(%esp)
+    277e:	e8 c8 2b 00 00       	call   534b <close>
+    2783:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    2786:	83 eb 01             	sub    $0x1,%ebx
+    2789:	75 bf                	jne    274a <linkunlink+0x6a>
+  if(pid)
+    278b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    278e:	85 c0                	test   %eax,%eax
+    2790:	74 4b                	je     27dd <linkunlink+0xfd>
+    wait();
+    2792:	e8 94 2b 00 00       	call   532b <wait>
+  printf(1, "linkunlink ok\n");
+    2797:	83 ec 08             	sub    $0x8,%esp
+    279a:	68 df 61 00 00       	push   $0x61df
+    279f:	6a 01                	push   $0x1
+    27a1:	e8 ea 2c 00 00       	call   5490 <printf>
+}
+    27a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    27a9:	5b                   	pop    %ebx
+    27aa:	5e                   	pop    %esi
+    27ab:	5f                   	pop    %edi
+    27ac:	5d                   	pop    %ebp
+    27ad:	c3                   	ret
+    27ae:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    27b0:	83 ec 08             	sub    $0x8,%esp
+    27b3:	68 58 62 00 00       	push   $0x6258
+    27b8:	68 db 61 00 00       	push   $0x61db
+    27bd:	e8 c1 2b 00 00       	call   5383 <link>
+    27c2:	83 c4 10             	add    $0x10,%esp
+    27c5:	e9 7b ff ff ff       	jmp    2745 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    27ca:	52                   	push   %edx
+    27cb:	52                   	push   %edx
+    27cc:	68 6f 6d 00 00       	push   $0x6d6f
+    27d1:	6a 01                	push   $0x1
+    27d3:	e8 b8 2c 00 00       	call   5490 <printf>
+    exit();
+    27d8:	e8 46 2b 00 00       	call   5323 <exit>
+    exit();
+    27dd:	e8 41 2b 00 00       	call   5323 <exit>
+    27e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    27e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000027f0 <bigdir>:
+{
+    27f0:	55                   	push   %ebp
+    27f1:	89 e5                	mov    %esp,%ebp
+    27f3:	57                   	push   %edi
+    27f4:	56                   	push   %esi
+    27f5:	53                   	push   %ebx
+    27f6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    27f9:	68 ee 61 00 00       	push   $0x61ee
+    27fe:	6a 01                	push   $0x1
+    2800:	e8 8b 2c 00 00       	call   5490 <printf>
+  unlink("bd");
+    2805:	c7 04 24 fb 61 00 00 	movl   $0x61fb,(%esp)
+    280c:	e8 62 2b 00 00       	call   5373 <unlink>
+  fd = open("bd", O_CREATE);
+    2811:	5a                   	pop    %edx
+    2812:	59                   	pop    %ecx
+    2813:	68 00 02 00 00       	push   $0x200
+    2818:	68 fb 61 00 00       	push   $0x61fb
+    281d:	e8 41 2b 00 00       	call   5363 <open>
+  if(fd < 0){
+    2822:	83 c4 10             	add    $0x10,%esp
+    2825:	85 c0                	test   %eax,%eax
+    2827:	0f 88 de 00 00 00    	js     290b <bigdir+0x11b>
+  close(fd);
+    282d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    2830:	31 f6                	xor    %esi,%esi
+    2832:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    2835:	50                   	push   %eax
+    2836:	e8 10 2b 00 00       	call   534b <close>
+    283b:	83 c4 10             	add    $0x10,%esp
+    283e:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    2840:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    2842:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    2845:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    2849:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    284c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    2850:	83 c0 30             	add    $0x30,%eax
+    2853:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    2856:	89 f0                	mov    %esi,%eax
+    2858:	83 e0 3f             	and    $0x3f,%eax
+    285b:	83 c0 30             	add    $0x30,%eax
+    285e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    2861:	57                   	push   %edi
+    2862:	68 fb 61 00 00       	push   $0x61fb
+    2867:	e8 17 2b 00 00       	call   5383 <link>
+    286c:	83 c4 10             	add    $0x10,%esp
+    286f:	89 c3                	mov    %eax,%ebx
+    2871:	85 c0                	test   %eax,%eax
+    2873:	75 6e                	jne    28e3 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    2875:	83 c6 01             	add    $0x1,%esi
+    2878:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    287e:	75 c0                	jne    2840 <bigdir+0x50>
+  unlink("bd");
+    2880:	83 ec 0c             	sub    $0xc,%esp
+    2883:	68 fb 61 00 00       	push   $0x61fb
+    2888:	e8 e6 2a 00 00       	call   5373 <unlink>
+    288d:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    2890:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    2892:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    2895:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    2899:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    289c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    28a0:	83 c0 30             	add    $0x30,%eax
+    28a3:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    28a6:	89 d8                	mov    %ebx,%eax
+    28a8:	83 e0 3f             	and    $0x3f,%eax
+    28ab:	83 c0 30             	add    $0x30,%eax
+    28ae:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    28b1:	57                   	push   %edi
+    28b2:	e8 bc 2a 00 00       	call   5373 <unlink>
+    28b7:	83 c4 10             	add    $0x10,%esp
+    28ba:	85 c0                	test   %eax,%eax
+    28bc:	75 39                	jne    28f7 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    28be:	83 c3 01             	add    $0x1,%ebx
+    28c1:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    28c7:	75 c7                	jne    2890 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    28c9:	83 ec 08             	sub    $0x8,%esp
+    28cc:	68 3d 62 00 00       	push   $0x623d
+    28d1:	6a 01                	push   $0x1
+    28d3:	e8 b8 2b 00 00       	call   5490 <printf>
+    28d8:	83 c4 10             	add    $0x10,%esp
+}
+    28db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    28de:	5b                   	pop    %ebx
+    28df:	5e                   	pop    %esi
+    28e0:	5f                   	pop    %edi
+    28e1:	5d                   	pop    %ebp
+    28e2:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    28e3:	83 ec 08             	sub    $0x8,%esp
+    28e6:	68 14 62 00 00       	push   $0x6214
+    28eb:	6a 01                	push   $0x1
+    28ed:	e8 9e 2b 00 00       	call   5490 <printf>
+      exit();
+    28f2:	e8 2c 2a 00 00       	call   5323 <exit>
+      printf(1, "bigdir unlink failed");
+    28f7:	83 ec 08             	sub    $0x8,%esp
+    28fa:	68 28 62 00 00       	push   $0x6228
+    28ff:	6a 01                	push   $0x1
+    2901:	e8 8a 2b 00 00       	call   5490 <printf>
+      exit();
+    2906:	e8 18 2a 00 00       	call   5323 <exit>
+    printf(1, "bigdir create failed\n");
+    290b:	50                   	push   %eax
+    290c:	50                   	push   %eax
+    290d:	68 fe 61 00 00       	push   $0x61fe
+    2912:	6a 01                	push   $0x1
+    2914:	e8 77 2b 00 00       	call   5490 <printf>
+    exit();
+    2919:	e8 05 2a 00 00       	call   5323 <exit>
+    291e:	66 90                	xchg   %ax,%ax
+
+00002920 <indexdir>:
+{
+    2920:	55                   	push   %ebp
+    2921:	89 e5                	mov    %esp,%ebp
+    2923:	57                   	push   %edi
+    2924:	56                   	push   %esi
+    2925:	53                   	push   %ebx
+    2926:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "indexdir test\n");
+    2929:	68 48 62 00 00       	push   $0x6248
+    292e:	6a 01                	push   $0x1
+    2930:	e8 5b 2b 00 00       	call   5490 <printf>
+  if(mkdir("ix") != 0){
+    2935:	c7 04 24 57 62 00 00 	movl   $0x6257,(%esp)
+    293c:	e8 4a 2a 00 00       	call   538b <mkdir>
+    2941:	83 c4 10             	add    $0x10,%esp
+    2944:	85 c0                	test   %eax,%eax
+    2946:	0f 85 15 02 00 00    	jne    2b61 <indexdir+0x241>
+    294c:	89 c3                	mov    %eax,%ebx
+  name[0] = 'i';
+    294e:	0f b7 05 3a 78 00 00 	movzwl 0x783a,%eax
+  name[2] = '/';
+    2955:	c6 45 e2 2f          	movb   $0x2f,-0x1e(%ebp)
+  for(i = 0; i < 400; i++){
+    2959:	31 ff                	xor    %edi,%edi
+  name[5] = '\0';
+    295b:	c6 45 e5 00          	movb   $0x0,-0x1b(%ebp)
+    295f:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  name[0] = 'i';
+    2962:	66 89 45 e0          	mov    %ax,-0x20(%ebp)
+  for(i = 0; i < 400; i++){
+    2966:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    296d:	8d 76 00             	lea    0x0(%esi),%esi
+    name[3] = 'a' + i/20;
+    2970:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+    fd = open(name, O_CREATE|O_RDWR);
+    2975:	83 ec 08             	sub    $0x8,%esp
+    name[3] = 'a' + i/20;
+    2978:	f7 e7                	mul    %edi
+    297a:	c1 ea 04             	shr    $0x4,%edx
+    297d:	8d 42 61             	lea    0x61(%edx),%eax
+    name[4] = 'a' + i%20;
+    2980:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[3] = 'a' + i/20;
+    2983:	88 45 e3             	mov    %al,-0x1d(%ebp)
+    name[4] = 'a' + i%20;
+    2986:	c1 e2 02             	shl    $0x2,%edx
+    2989:	89 f8                	mov    %edi,%eax
+    298b:	29 d0                	sub    %edx,%eax
+    298d:	83 c0 61             	add    $0x61,%eax
+    2990:	88 45 e4             	mov    %al,-0x1c(%ebp)
+    fd = open(name, O_CREATE|O_RDWR);
+    2993:	68 02 02 00 00       	push   $0x202
+    2998:	56                   	push   %esi
+    2999:	e8 c5 29 00 00       	call   5363 <open>
+    if(fd < 0){
+    299e:	83 c4 10             	add    $0x10,%esp
+    29a1:	85 c0                	test   %eax,%eax
+    29a3:	0f 88 51 01 00 00    	js     2afa <indexdir+0x1da>
+    close(fd);
+    29a9:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 400; i++){
+    29ac:	83 c7 01             	add    $0x1,%edi
+    close(fd);
+    29af:	50                   	push   %eax
+    29b0:	e8 96 29 00 00       	call   534b <close>
+  for(i = 0; i < 400; i++){
+    29b5:	83 c4 10             	add    $0x10,%esp
+    29b8:	81 ff 90 01 00 00    	cmp    $0x190,%edi
+    29be:	75 b0                	jne    2970 <indexdir+0x50>
+    name[3] = 'a' + i/20;
+    29c0:	bf cd cc cc cc       	mov    $0xcccccccd,%edi
+    29c5:	8d 76 00             	lea    0x0(%esi),%esi
+    29c8:	89 d8                	mov    %ebx,%eax
+    if((fd = open(name, 0)) < 0){
+    29ca:	83 ec 08             	sub    $0x8,%esp
+    name[3] = 'a' + i/20;
+    29cd:	f7 e7                	mul    %edi
+    29cf:	c1 ea 04             	shr    $0x4,%edx
+    29d2:	8d 42 61             	lea    0x61(%edx),%eax
+    name[4] = 'a' + i%20;
+    29d5:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[3] = 'a' + i/20;
+    29d8:	88 45 e3             	mov    %al,-0x1d(%ebp)
+    name[4] = 'a' + i%20;
+    29db:	c1 e2 02             	shl    $0x2,%edx
+    29de:	89 d8                	mov    %ebx,%eax
+    29e0:	29 d0                	sub    %edx,%eax
+    29e2:	83 c0 61             	add    $0x61,%eax
+    29e5:	88 45 e4             	mov    %al,-0x1c(%ebp)
+    if((fd = open(name, 0)) < 0){
+    29e8:	6a 00                	push   $0x0
+    29ea:	56                   	push   %esi
+    29eb:	e8 73 29 00 00       	call   5363 <open>
+    29f0:	83 c4 10             	add    $0x10,%esp
+    29f3:	85 c0                	test   %eax,%eax
+    29f5:	0f 88 3d 01 00 00    	js     2b38 <indexdir+0x218>
+    close(fd);
+    29fb:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 400; i++){
+    29fe:	83 c3 01             	add    $0x1,%ebx
+    close(fd);
+    2a01:	50                   	push   %eax
+    2a02:	e8 44 29 00 00       	call   534b <close>
+  for(i = 0; i < 400; i++){
+    2a07:	83 c4 10             	add    $0x10,%esp
+    2a0a:	81 fb 90 01 00 00    	cmp    $0x190,%ebx
+    2a10:	75 b6                	jne    29c8 <indexdir+0xa8>
+  if(open("ix/zz", 0) >= 0 || chdir("ix/..") != 0 || chdir("ix/.") != 0){
+    2a12:	83 ec 08             	sub    $0x8,%esp
+    2a15:	6a 00                	push   $0x0
+    2a17:	68 a1 62 00 00       	push   $0x62a1
+    2a1c:	e8 42 29 00 00       	call   5363 <open>
+    2a21:	83 c4 10             	add    $0x10,%esp
+    2a24:	85 c0                	test   %eax,%eax
+    2a26:	0f 89 21 01 00 00    	jns    2b4d <indexdir+0x22d>
+    2a2c:	83 ec 0c             	sub    $0xc,%esp
+    2a2f:	68 bd 62 00 00       	push   $0x62bd
+    2a34:	e8 5a 29 00 00       	call   5393 <chdir>
+    2a39:	83 c4 10             	add    $0x10,%esp
+    2a3c:	85 c0                	test   %eax,%eax
+    2a3e:	0f 85 09 01 00 00    	jne    2b4d <indexdir+0x22d>
+    2a44:	83 ec 0c             	sub    $0xc,%esp
+    2a47:	68 c3 62 00 00       	push   $0x62c3
+    2a4c:	e8 42 29 00 00       	call   5393 <chdir>
+    2a51:	83 c4 10             	add    $0x10,%esp
+    2a54:	89 c7                	mov    %eax,%edi
+    2a56:	85 c0                	test   %eax,%eax
+    2a58:	0f 85 ef 00 00 00    	jne    2b4d <indexdir+0x22d>
+  chdir("/");
+    2a5e:	83 ec 0c             	sub    $0xc,%esp
+    name[3] = 'a' + i/20;
+    2a61:	bb cd cc cc cc       	mov    $0xcccccccd,%ebx
+  chdir("/");
+    2a66:	68 01 58 00 00       	push   $0x5801
+    2a6b:	e8 23 29 00 00       	call   5393 <chdir>
+    2a70:	83 c4 10             	add    $0x10,%esp
+    2a73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2a77:	90                   	nop
+    if(unlink("ix") == 0){
+    2a78:	83 ec 0c             	sub    $0xc,%esp
+    2a7b:	68 57 62 00 00       	push   $0x6257
+    2a80:	e8 ee 28 00 00       	call   5373 <unlink>
+    2a85:	83 c4 10             	add    $0x10,%esp
+    2a88:	85 c0                	test   %eax,%eax
+    2a8a:	0f 84 94 00 00 00    	je     2b24 <indexdir+0x204>
+    name[3] = 'a' + i/20;
+    2a90:	89 f8                	mov    %edi,%eax
+    if(unlink(name) != 0){
+    2a92:	83 ec 0c             	sub    $0xc,%esp
+    name[3] = 'a' + i/20;
+    2a95:	f7 e3                	mul    %ebx
+    2a97:	c1 ea 04             	shr    $0x4,%edx
+    2a9a:	8d 42 61             	lea    0x61(%edx),%eax
+    name[4] = 'a' + i%20;
+    2a9d:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[3] = 'a' + i/20;
+    2aa0:	88 45 e3             	mov    %al,-0x1d(%ebp)
+    name[4] = 'a' + i%20;
+    2aa3:	c1 e2 02             	shl    $0x2,%edx
+    2aa6:	89 f8                	mov    %edi,%eax
+    2aa8:	29 d0                	sub    %edx,%eax
+    2aaa:	83 c0 61             	add    $0x61,%eax
+    2aad:	88 45 e4             	mov    %al,-0x1c(%ebp)
+    if(unlink(name) != 0){
+    2ab0:	56                   	push   %esi
+    2ab1:	e8 bd 28 00 00       	call   5373 <unlink>
+    2ab6:	83 c4 10             	add    $0x10,%esp
+    2ab9:	85 c0                	test   %eax,%eax
+    2abb:	75 52                	jne    2b0f <indexdir+0x1ef>
+  for(i = 0; i < 400; i++){
+    2abd:	83 c7 01             	add    $0x1,%edi
+    2ac0:	81 ff 90 01 00 00    	cmp    $0x190,%edi
+    2ac6:	75 b0                	jne    2a78 <indexdir+0x158>
+  if(unlink("ix") != 0){
+    2ac8:	83 ec 0c             	sub    $0xc,%esp
+    2acb:	68 57 62 00 00       	push   $0x6257
+    2ad0:	e8 9e 28 00 00       	call   5373 <unlink>
+    2ad5:	83 c4 10             	add    $0x10,%esp
+    2ad8:	85 c0                	test   %eax,%eax
+    2ada:	0f 85 94 00 00 00    	jne    2b74 <indexdir+0x254>
+  printf(1, "indexdir ok\n");
+    2ae0:	83 ec 08             	sub    $0x8,%esp
+    2ae3:	68 00 63 00 00       	push   $0x6300
+    2ae8:	6a 01                	push   $0x1
+    2aea:	e8 a1 29 00 00       	call   5490 <printf>
+}
+    2aef:	83 c4 10             	add    $0x10,%esp
+    2af2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2af5:	5b                   	pop    %ebx
+    2af6:	5e                   	pop    %esi
+    2af7:	5f                   	pop    %edi
+    2af8:	5d                   	pop    %ebp
+    2af9:	c3                   	ret
+      printf(1, "indexdir: create %s failed\n", name);
+    2afa:	83 ec 04             	sub    $0x4,%esp
+    2afd:	56                   	push   %esi
+    2afe:	68 6b 62 00 00       	push   $0x626b
+    2b03:	6a 01                	push   $0x1
+    2b05:	e8 86 29 00 00       	call   5490 <printf>
+      exit();
+    2b0a:	e8 14 28 00 00       	call   5323 <exit>
+      printf(1, "indexdir: unlink %s failed\n", name);
+    2b0f:	83 ec 04             	sub    $0x4,%esp
+    2b12:	56                   	push   %esi
+    2b13:	68 c8 62 00 00       	push   $0x62c8
+    2b18:	6a 01                	push   $0x1
+    2b1a:	e8 71 29 00 00       	call   5490 <printf>
+      exit();
+    2b1f:	e8 ff 27 00 00       	call   5323 <exit>
+      printf(1, "indexdir: removed non-empty ix\n");
+    2b24:	83 ec 08             	sub    $0x8,%esp
+    2b27:	68 34 71 00 00       	push   $0x7134
+    2b2c:	6a 01                	push   $0x1
+    2b2e:	e8 5d 29 00 00       	call   5490 <printf>
+      exit();
+    2b33:	e8 eb 27 00 00       	call   5323 <exit>
+      printf(1, "indexdir: open %s failed\n", name);
+    2b38:	83 ec 04             	sub    $0x4,%esp
+    2b3b:	56                   	push   %esi
+    2b3c:	68 87 62 00 00       	push   $0x6287
+    2b41:	6a 01                	push   $0x1
+    2b43:	e8 48 29 00 00       	call   5490 <printf>
+      exit();
+    2b48:	e8 d6 27 00 00       	call   5323 <exit>
+    printf(1, "indexdir: bad lookup\n");
+    2b4d:	83 ec 08             	sub    $0x8,%esp
+    2b50:	68 a7 62 00 00       	push   $0x62a7
+    2b55:	6a 01                	push   $0x1
+    2b57:	e8 34 29 00 00       	call   5490 <printf>
+    exit();
+    2b5c:	e8 c2 27 00 00       	call   5323 <exit>
+    printf(1, "mkdir ix failed\n");
+    2b61:	52                   	push   %edx
+    2b62:	52                   	push   %edx
+    2b63:	68 5a 62 00 00       	push   $0x625a
+    2b68:	6a 01                	push   $0x1
+    2b6a:	e8 21 29 00 00       	call   5490 <printf>
+    exit();
+    2b6f:	e8 af 27 00 00       	call   5323 <exit>
+    printf(1, "indexdir: unlink ix failed\n");
+    2b74:	50                   	push   %eax
+    2b75:	50                   	push   %eax
+    2b76:	68 e4 62 00 00       	push   $0x62e4
+    2b7b:	6a 01                	push   $0x1
+    2b7d:	e8 0e 29 00 00       	call   5490 <printf>
+    exit();
+    2b82:	e8 9c 27 00 00       	call   5323 <exit>
+    2b87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2b8e:	66 90                	xchg   %ax,%ax
+
+00002b90 <subdir>:
+{
+    2b90:	55                   	push   %ebp
+    2b91:	89 e5                	mov    %esp,%ebp
+    2b93:	53                   	push   %ebx
+    2b94:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    2b97:	68 0d 63 00 00       	push   $0x630d
+    2b9c:	6a 01                	push   $0x1
+    2b9e:	e8 ed 28 00 00       	call   5490 <printf>
+  unlink("ff");
+    2ba3:	c7 04 24 96 63 00 00 	movl   $0x6396,(%esp)
+    2baa:	e8 c4 27 00 00       	call   5373 <unlink>
+  if(mkdir("dd") != 0){
+    2baf:	c7 04 24 33 64 00 00 	movl   $0x6433,(%esp)
+    2bb6:	e8 d0 27 00 00       	call   538b <mkdir>
+    2bbb:	83 c4 10             	add    $0x10,%esp
+    2bbe:	85 c0                	test   %eax,%eax
+    2bc0:	0f 85 b3 05 00 00    	jne    3179 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    2bc6:	83 ec 08             	sub    $0x8,%esp
+    2bc9:	68 02 02 00 00       	push   $0x202
+    2bce:	68 6c 63 00 00       	push   $0x636c
+    2bd3:	e8 8b 27 00 00       	call   5363 <open>
+  if(fd < 0){
+    2bd8:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    2bdb:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2bdd:	85 c0                	test   %eax,%eax
+    2bdf:	0f 88 81 05 00 00    	js     3166 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    2be5:	83 ec 04             	sub    $0x4,%esp
+    2be8:	6a 02                	push   $0x2
+    2bea:	68 96 63 00 00       	push   $0x6396
+    2bef:	50                   	push   %eax
+    2bf0:	e8 4e 27 00 00       	call   5343 <write>
+  close(fd);
+    2bf5:	89 1c 24             	mov    %ebx,(%esp)
+    2bf8:	e8 4e 27 00 00       	call   534b <close>
+  if(unlink("dd") >= 0){
+    2bfd:	c7 04 24 33 64 00 00 	movl   $0x6433,(%esp)
+    2c04:	e8 6a 27 00 00       	call   5373 <unlink>
+    2c09:	83 c4 10             	add    $0x10,%esp
+    2c0c:	85 c0                	test   %eax,%eax
+    2c0e:	0f 89 3f 05 00 00    	jns    3153 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    2c14:	83 ec 0c             	sub    $0xc,%esp
+    2c17:	68 47 63 00 00       	push   $0x6347
+    2c1c:	e8 6a 27 00 00       	call   538b <mkdir>
+    2c21:	83 c4 10             	add    $0x10,%esp
+    2c24:	85 c0                	test   %eax,%eax
+    2c26:	0f 85 14 05 00 00    	jne    3140 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    2c2c:	83 ec 08             	sub    $0x8,%esp
+    2c2f:	68 02 02 00 00       	push   $0x202
+    2c34:	68 69 63 00 00       	push   $0x6369
+    2c39:	e8 25 27 00 00       	call   5363 <open>
+  if(fd < 0){
+    2c3e:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    2c41:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2c43:	85 c0                	test   %eax,%eax
+    2c45:	0f 88 24 04 00 00    	js     306f <subdir+0x4df>
+  write(fd, "FF", 2);
+    2c4b:	83 ec 04             	sub    $0x4,%esp
+    2c4e:	6a 02                	push   $0x2
+    2c50:	68 8a 63 00 00       	push   $0x638a
+    2c55:	50                   	push   %eax
+    2c56:	e8 e8 26 00 00       	call   5343 <write>
+  close(fd);
+    2c5b:	89 1c 24             	mov    %ebx,(%esp)
+    2c5e:	e8 e8 26 00 00       	call   534b <close>
+  fd = open("dd/dd/../ff", 0);
+    2c63:	58                   	pop    %eax
+    2c64:	5a                   	pop    %edx
+    2c65:	6a 00                	push   $0x0
+    2c67:	68 8d 63 00 00       	push   $0x638d
+    2c6c:	e8 f2 26 00 00       	call   5363 <open>
+  if(fd < 0){
+    2c71:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    2c74:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2c76:	85 c0                	test   %eax,%eax
+    2c78:	0f 88 de 03 00 00    	js     305c <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    2c7e:	83 ec 04             	sub    $0x4,%esp
+    2c81:	68 00 20 00 00       	push   $0x2000
+    2c86:	68 00 ab 00 00       	push   $0xab00
+    2c8b:	50                   	push   %eax
+    2c8c:	e8 aa 26 00 00       	call   533b <read>
+  if(cc != 2 || buf[0] != 'f'){
+    2c91:	83 c4 10             	add    $0x10,%esp
+    2c94:	83 f8 02             	cmp    $0x2,%eax
+    2c97:	0f 85 3a 03 00 00    	jne    2fd7 <subdir+0x447>
+    2c9d:	80 3d 00 ab 00 00 66 	cmpb   $0x66,0xab00
+    2ca4:	0f 85 2d 03 00 00    	jne    2fd7 <subdir+0x447>
+  close(fd);
+    2caa:	83 ec 0c             	sub    $0xc,%esp
+    2cad:	53                   	push   %ebx
+    2cae:	e8 98 26 00 00       	call   534b <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    2cb3:	59                   	pop    %ecx
+    2cb4:	5b                   	pop    %ebx
+    2cb5:	68 cd 63 00 00       	push   $0x63cd
+    2cba:	68 69 63 00 00       	push   $0x6369
+    2cbf:	e8 bf 26 00 00       	call   5383 <link>
+    2cc4:	83 c4 10             	add    $0x10,%esp
+    2cc7:	85 c0                	test   %eax,%eax
+    2cc9:	0f 85 c6 03 00 00    	jne    3095 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    2ccf:	83 ec 0c             	sub    $0xc,%esp
+    2cd2:	68 69 63 00 00       	push   $0x6369
+    2cd7:	e8 97 26 00 00       	call   5373 <unlink>
+    2cdc:	83 c4 10             	add    $0x10,%esp
+    2cdf:	85 c0                	test   %eax,%eax
+    2ce1:	0f 85 16 03 00 00    	jne    2ffd <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2ce7:	83 ec 08             	sub    $0x8,%esp
+    2cea:	6a 00                	push   $0x0
+    2cec:	68 69 63 00 00       	push   $0x6369
+    2cf1:	e8 6d 26 00 00       	call   5363 <open>
+    2cf6:	83 c4 10             	add    $0x10,%esp
+    2cf9:	85 c0                	test   %eax,%eax
+    2cfb:	0f 89 2c 04 00 00    	jns    312d <subdir+0x59d>
+  if(chdir("dd") != 0){
+    2d01:	83 ec 0c             	sub    $0xc,%esp
+    2d04:	68 33 64 00 00       	push   $0x6433
+    2d09:	e8 85 26 00 00       	call   5393 <chdir>
+    2d0e:	83 c4 10             	add    $0x10,%esp
+    2d11:	85 c0                	test   %eax,%eax
+    2d13:	0f 85 01 04 00 00    	jne    311a <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    2d19:	83 ec 0c             	sub    $0xc,%esp
+    2d1c:	68 01 64 00 00       	push   $0x6401
+    2d21:	e8 6d 26 00 00       	call   5393 <chdir>
+    2d26:	83 c4 10             	add    $0x10,%esp
+    2d29:	85 c0                	test   %eax,%eax
+    2d2b:	0f 85 b9 02 00 00    	jne    2fea <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    2d31:	83 ec 0c             	sub    $0xc,%esp
+    2d34:	68 27 64 00 00       	push   $0x6427
+    2d39:	e8 55 26 00 00       	call   5393 <chdir>
+    2d3e:	83 c4 10             	add    $0x10,%esp
+    2d41:	85 c0                	test   %eax,%eax
+    2d43:	0f 85 a1 02 00 00    	jne    2fea <subdir+0x45a>
+  if(chdir("./..") != 0){
+    2d49:	83 ec 0c             	sub    $0xc,%esp
+    2d4c:	68 36 64 00 00       	push   $0x6436
+    2d51:	e8 3d 26 00 00       	call   5393 <chdir>
+    2d56:	83 c4 10             	add    $0x10,%esp
+    2d59:	85 c0                	test   %eax,%eax
+    2d5b:	0f 85 21 03 00 00    	jne    3082 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    2d61:	83 ec 08             	sub    $0x8,%esp
+    2d64:	6a 00                	push   $0x0
+    2d66:	68 cd 63 00 00       	push   $0x63cd
+    2d6b:	e8 f3 25 00 00       	call   5363 <open>
+  if(fd < 0){
+    2d70:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    2d73:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2d75:	85 c0                	test   %eax,%eax
+    2d77:	0f 88 e0 04 00 00    	js     325d <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    2d7d:	83 ec 04             	sub    $0x4,%esp
+    2d80:	68 00 20 00 00       	push   $0x2000
+    2d85:	68 00 ab 00 00       	push   $0xab00
+    2d8a:	50                   	push   %eax
+    2d8b:	e8 ab 25 00 00       	call   533b <read>
+    2d90:	83 c4 10             	add    $0x10,%esp
+    2d93:	83 f8 02             	cmp    $0x2,%eax
+    2d96:	0f 85 ae 04 00 00    	jne    324a <subdir+0x6ba>
+  close(fd);
+    2d9c:	83 ec 0c             	sub    $0xc,%esp
+    2d9f:	53                   	push   %ebx
+    2da0:	e8 a6 25 00 00       	call   534b <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2da5:	58                   	pop    %eax
+    2da6:	5a                   	pop    %edx
+    2da7:	6a 00                	push   $0x0
+    2da9:	68 69 63 00 00       	push   $0x6369
+    2dae:	e8 b0 25 00 00       	call   5363 <open>
+    2db3:	83 c4 10             	add    $0x10,%esp
+    2db6:	85 c0                	test   %eax,%eax
+    2db8:	0f 89 65 02 00 00    	jns    3023 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    2dbe:	83 ec 08             	sub    $0x8,%esp
+    2dc1:	68 02 02 00 00       	push   $0x202
+    2dc6:	68 81 64 00 00       	push   $0x6481
+    2dcb:	e8 93 25 00 00       	call   5363 <open>
+    2dd0:	83 c4 10             	add    $0x10,%esp
+    2dd3:	85 c0                	test   %eax,%eax
+    2dd5:	0f 89 35 02 00 00    	jns    3010 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    2ddb:	83 ec 08             	sub    $0x8,%esp
+    2dde:	68 02 02 00 00       	push   $0x202
+    2de3:	68 a6 64 00 00       	push   $0x64a6
+    2de8:	e8 76 25 00 00       	call   5363 <open>
+    2ded:	83 c4 10             	add    $0x10,%esp
+    2df0:	85 c0                	test   %eax,%eax
+    2df2:	0f 89 0f 03 00 00    	jns    3107 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    2df8:	83 ec 08             	sub    $0x8,%esp
+    2dfb:	68 00 02 00 00       	push   $0x200
+    2e00:	68 33 64 00 00       	push   $0x6433
+    2e05:	e8 59 25 00 00       	call   5363 <open>
+    2e0a:	83 c4 10             	add    $0x10,%esp
+    2e0d:	85 c0                	test   %eax,%eax
+    2e0f:	0f 89 df 02 00 00    	jns    30f4 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    2e15:	83 ec 08             	sub    $0x8,%esp
+    2e18:	6a 02                	push   $0x2
+    2e1a:	68 33 64 00 00       	push   $0x6433
+    2e1f:	e8 3f 25 00 00       	call   5363 <open>
+    2e24:	83 c4 10             	add    $0x10,%esp
+    2e27:	85 c0                	test   %eax,%eax
+    2e29:	0f 89 b2 02 00 00    	jns    30e1 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    2e2f:	83 ec 08             	sub    $0x8,%esp
+    2e32:	6a 01                	push   $0x1
+    2e34:	68 33 64 00 00       	push   $0x6433
+    2e39:	e8 25 25 00 00       	call   5363 <open>
+    2e3e:	83 c4 10             	add    $0x10,%esp
+    2e41:	85 c0                	test   %eax,%eax
+    2e43:	0f 89 85 02 00 00    	jns    30ce <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    2e49:	83 ec 08             	sub    $0x8,%esp
+    2e4c:	68 15 65 00 00       	push   $0x6515
+    2e51:	68 81 64 00 00       	push   $0x6481
+    2e56:	e8 28 25 00 00       	call   5383 <link>
+    2e5b:	83 c4 10             	add    $0x10,%esp
+    2e5e:	85 c0                	test   %eax,%eax
+    2e60:	0f 84 55 02 00 00    	je     30bb <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    2e66:	83 ec 08             	sub    $0x8,%esp
+    2e69:	68 15 65 00 00       	push   $0x6515
+    2e6e:	68 a6 64 00 00       	push   $0x64a6
+    2e73:	e8 0b 25 00 00       	call   5383 <link>
+    2e78:	83 c4 10             	add    $0x10,%esp
+    2e7b:	85 c0                	test   %eax,%eax
+    2e7d:	0f 84 25 02 00 00    	je     30a8 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    2e83:	83 ec 08             	sub    $0x8,%esp
+    2e86:	68 cd 63 00 00       	push   $0x63cd
+    2e8b:	68 6c 63 00 00       	push   $0x636c
+    2e90:	e8 ee 24 00 00       	call   5383 <link>
+    2e95:	83 c4 10             	add    $0x10,%esp
+    2e98:	85 c0                	test   %eax,%eax
+    2e9a:	0f 84 a9 01 00 00    	je     3049 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    2ea0:	83 ec 0c             	sub    $0xc,%esp
+    2ea3:	68 81 64 00 00       	push   $0x6481
+    2ea8:	e8 de 24 00 00       	call   538b <mkdir>
+    2ead:	83 c4 10             	add    $0x10,%esp
+    2eb0:	85 c0                	test   %eax,%eax
+    2eb2:	0f 84 7e 01 00 00    	je     3036 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    2eb8:	83 ec 0c             	sub    $0xc,%esp
+    2ebb:	68 a6 64 00 00       	push   $0x64a6
+    2ec0:	e8 c6 24 00 00       	call   538b <mkdir>
+    2ec5:	83 c4 10             	add    $0x10,%esp
+    2ec8:	85 c0                	test   %eax,%eax
+    2eca:	0f 84 67 03 00 00    	je     3237 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    2ed0:	83 ec 0c             	sub    $0xc,%esp
+    2ed3:	68 cd 63 00 00       	push   $0x63cd
+    2ed8:	e8 ae 24 00 00       	call   538b <mkdir>
+    2edd:	83 c4 10             	add    $0x10,%esp
+    2ee0:	85 c0                	test   %eax,%eax
+    2ee2:	0f 84 3c 03 00 00    	je     3224 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    2ee8:	83 ec 0c             	sub    $0xc,%esp
+    2eeb:	68 a6 64 00 00       	push   $0x64a6
+    2ef0:	e8 7e 24 00 00       	call   5373 <unlink>
+    2ef5:	83 c4 10             	add    $0x10,%esp
+    2ef8:	85 c0                	test   %eax,%eax
+    2efa:	0f 84 11 03 00 00    	je     3211 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    2f00:	83 ec 0c             	sub    $0xc,%esp
+    2f03:	68 81 64 00 00       	push   $0x6481
+    2f08:	e8 66 24 00 00       	call   5373 <unlink>
+    2f0d:	83 c4 10             	add    $0x10,%esp
+    2f10:	85 c0                	test   %eax,%eax
+    2f12:	0f 84 e6 02 00 00    	je     31fe <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    2f18:	83 ec 0c             	sub    $0xc,%esp
+    2f1b:	68 6c 63 00 00       	push   $0x636c
+    2f20:	e8 6e 24 00 00       	call   5393 <chdir>
+    2f25:	83 c4 10             	add    $0x10,%esp
+    2f28:	85 c0                	test   %eax,%eax
+    2f2a:	0f 84 bb 02 00 00    	je     31eb <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    2f30:	83 ec 0c             	sub    $0xc,%esp
+    2f33:	68 18 65 00 00       	push   $0x6518
+    2f38:	e8 56 24 00 00       	call   5393 <chdir>
+    2f3d:	83 c4 10             	add    $0x10,%esp
+    2f40:	85 c0                	test   %eax,%eax
+    2f42:	0f 84 90 02 00 00    	je     31d8 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    2f48:	83 ec 0c             	sub    $0xc,%esp
+    2f4b:	68 cd 63 00 00       	push   $0x63cd
+    2f50:	e8 1e 24 00 00       	call   5373 <unlink>
+    2f55:	83 c4 10             	add    $0x10,%esp
+    2f58:	85 c0                	test   %eax,%eax
+    2f5a:	0f 85 9d 00 00 00    	jne    2ffd <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    2f60:	83 ec 0c             	sub    $0xc,%esp
+    2f63:	68 6c 63 00 00       	push   $0x636c
+    2f68:	e8 06 24 00 00       	call   5373 <unlink>
+    2f6d:	83 c4 10             	add    $0x10,%esp
+    2f70:	85 c0                	test   %eax,%eax
+    2f72:	0f 85 4d 02 00 00    	jne    31c5 <subdir+0x635>
+  if(unlink("dd") == 0){
+    2f78:	83 ec 0c             	sub    $0xc,%esp
+    2f7b:	68 33 64 00 00       	push   $0x6433
+    2f80:	e8 ee 23 00 00       	call   5373 <unlink>
+    2f85:	83 c4 10             	add    $0x10,%esp
+    2f88:	85 c0                	test   %eax,%eax
+    2f8a:	0f 84 22 02 00 00    	je     31b2 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    2f90:	83 ec 0c             	sub    $0xc,%esp
+    2f93:	68 48 63 00 00       	push   $0x6348
+    2f98:	e8 d6 23 00 00       	call   5373 <unlink>
+    2f9d:	83 c4 10             	add    $0x10,%esp
+    2fa0:	85 c0                	test   %eax,%eax
+    2fa2:	0f 88 f7 01 00 00    	js     319f <subdir+0x60f>
+  if(unlink("dd") < 0){
+    2fa8:	83 ec 0c             	sub    $0xc,%esp
+    2fab:	68 33 64 00 00       	push   $0x6433
+    2fb0:	e8 be 23 00 00       	call   5373 <unlink>
+    2fb5:	83 c4 10             	add    $0x10,%esp
+    2fb8:	85 c0                	test   %eax,%eax
+    2fba:	0f 88 cc 01 00 00    	js     318c <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    2fc0:	83 ec 08             	sub    $0x8,%esp
+    2fc3:	68 15 66 00 00       	push   $0x6615
+    2fc8:	6a 01                	push   $0x1
+    2fca:	e8 c1 24 00 00       	call   5490 <printf>
+}
+    2fcf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2fd2:	83 c4 10             	add    $0x10,%esp
+    2fd5:	c9                   	leave
+    2fd6:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    2fd7:	50                   	push   %eax
+    2fd8:	50                   	push   %eax
+    2fd9:	68 b2 63 00 00       	push   $0x63b2
+    2fde:	6a 01                	push   $0x1
+    2fe0:	e8 ab 24 00 00       	call   5490 <printf>
+    exit();
+    2fe5:	e8 39 23 00 00       	call   5323 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    2fea:	50                   	push   %eax
+    2feb:	50                   	push   %eax
+    2fec:	68 0d 64 00 00       	push   $0x640d
+    2ff1:	6a 01                	push   $0x1
+    2ff3:	e8 98 24 00 00       	call   5490 <printf>
+    exit();
+    2ff8:	e8 26 23 00 00       	call   5323 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    2ffd:	50                   	push   %eax
+    2ffe:	50                   	push   %eax
+    2fff:	68 d8 63 00 00       	push   $0x63d8
+    3004:	6a 01                	push   $0x1
+    3006:	e8 85 24 00 00       	call   5490 <printf>
+    exit();
+    300b:	e8 13 23 00 00       	call   5323 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    3010:	51                   	push   %ecx
+    3011:	51                   	push   %ecx
+    3012:	68 8a 64 00 00       	push   $0x648a
+    3017:	6a 01                	push   $0x1
+    3019:	e8 72 24 00 00       	call   5490 <printf>
+    exit();
+    301e:	e8 00 23 00 00       	call   5323 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    3023:	53                   	push   %ebx
+    3024:	53                   	push   %ebx
+    3025:	68 c4 71 00 00       	push   $0x71c4
+    302a:	6a 01                	push   $0x1
+    302c:	e8 5f 24 00 00       	call   5490 <printf>
+    exit();
+    3031:	e8 ed 22 00 00       	call   5323 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    3036:	51                   	push   %ecx
+    3037:	51                   	push   %ecx
+    3038:	68 1e 65 00 00       	push   $0x651e
+    303d:	6a 01                	push   $0x1
+    303f:	e8 4c 24 00 00       	call   5490 <printf>
+    exit();
+    3044:	e8 da 22 00 00       	call   5323 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    3049:	53                   	push   %ebx
+    304a:	53                   	push   %ebx
+    304b:	68 34 72 00 00       	push   $0x7234
+    3050:	6a 01                	push   $0x1
+    3052:	e8 39 24 00 00       	call   5490 <printf>
+    exit();
+    3057:	e8 c7 22 00 00       	call   5323 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    305c:	50                   	push   %eax
+    305d:	50                   	push   %eax
+    305e:	68 99 63 00 00       	push   $0x6399
+    3063:	6a 01                	push   $0x1
+    3065:	e8 26 24 00 00       	call   5490 <printf>
+    exit();
+    306a:	e8 b4 22 00 00       	call   5323 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    306f:	51                   	push   %ecx
+    3070:	51                   	push   %ecx
+    3071:	68 72 63 00 00       	push   $0x6372
+    3076:	6a 01                	push   $0x1
+    3078:	e8 13 24 00 00       	call   5490 <printf>
+    exit();
+    307d:	e8 a1 22 00 00       	call   5323 <exit>
+    printf(1, "chdir ./.. failed\n");
+    3082:	50                   	push   %eax
+    3083:	50                   	push   %eax
+    3084:	68 3b 64 00 00       	push   $0x643b
+    3089:	6a 01                	push   $0x1
+    308b:	e8 00 24 00 00       	call   5490 <printf>
+    exit();
+    3090:	e8 8e 22 00 00       	call   5323 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    3095:	52                   	push   %edx
+    3096:	52                   	push   %edx
+    3097:	68 7c 71 00 00       	push   $0x717c
+    309c:	6a 01                	push   $0x1
+    309e:	e8 ed 23 00 00       	call   5490 <printf>
+    exit();
+    30a3:	e8 7b 22 00 00       	call   5323 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    30a8:	50                   	push   %eax
+    30a9:	50                   	push   %eax
+    30aa:	68 10 72 00 00       	push   $0x7210
+    30af:	6a 01                	push   $0x1
+    30b1:	e8 da 23 00 00       	call   5490 <printf>
+    exit();
+    30b6:	e8 68 22 00 00       	call   5323 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    30bb:	50                   	push   %eax
+    30bc:	50                   	push   %eax
+    30bd:	68 ec 71 00 00       	push   $0x71ec
+    30c2:	6a 01                	push   $0x1
+    30c4:	e8 c7 23 00 00       	call   5490 <printf>
+    exit();
+    30c9:	e8 55 22 00 00       	call   5323 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    30ce:	50                   	push   %eax
+    30cf:	50                   	push   %eax
+    30d0:	68 fa 64 00 00       	push   $0x64fa
+    30d5:	6a 01                	push   $0x1
+    30d7:	e8 b4 23 00 00       	call   5490 <printf>
+    exit();
+    30dc:	e8 42 22 00 00       	call   5323 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    30e1:	50                   	push   %eax
+    30e2:	50                   	push   %eax
+    30e3:	68 e1 64 00 00       	push   $0x64e1
+    30e8:	6a 01                	push   $0x1
+    30ea:	e8 a1 23 00 00       	call   5490 <printf>
+    exit();
+    30ef:	e8 2f 22 00 00       	call   5323 <exit>
+    printf(1, "create dd succeeded!\n");
+    30f4:	50                   	push   %eax
+    30f5:	50                   	push   %eax
+    30f6:	68 cb 64 00 00       	push   $0x64cb
+    30fb:	6a 01                	push   $0x1
+    30fd:	e8 8e 23 00 00       	call   5490 <printf>
+    exit();
+    3102:	e8 1c 22 00 00       	call   5323 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    3107:	52                   	push   %edx
+    3108:	52                   	push   %edx
+    3109:	68 af 64 00 00       	push   $0x64af
+    310e:	6a 01                	push   $0x1
+    3110:	e8 7b 23 00 00       	call   5490 <printf>
+    exit();
+    3115:	e8 09 22 00 00       	call   5323 <exit>
+    printf(1, "chdir dd failed\n");
+    311a:	50                   	push   %eax
+    311b:	50                   	push   %eax
+    311c:	68 f0 63 00 00       	push   $0x63f0
+    3121:	6a 01                	push   $0x1
+    3123:	e8 68 23 00 00       	call   5490 <printf>
+    exit();
+    3128:	e8 f6 21 00 00       	call   5323 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    312d:	50                   	push   %eax
+    312e:	50                   	push   %eax
+    312f:	68 a0 71 00 00       	push   $0x71a0
+    3134:	6a 01                	push   $0x1
+    3136:	e8 55 23 00 00       	call   5490 <printf>
+    exit();
+    313b:	e8 e3 21 00 00       	call   5323 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    3140:	53                   	push   %ebx
+    3141:	53                   	push   %ebx
+    3142:	68 4e 63 00 00       	push   $0x634e
+    3147:	6a 01                	push   $0x1
+    3149:	e8 42 23 00 00       	call   5490 <printf>
+    exit();
+    314e:	e8 d0 21 00 00       	call   5323 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    3153:	50                   	push   %eax
+    3154:	50                   	push   %eax
+    3155:	68 54 71 00 00       	push   $0x7154
+    315a:	6a 01                	push   $0x1
+    315c:	e8 2f 23 00 00       	call   5490 <printf>
+    exit();
+    3161:	e8 bd 21 00 00       	call   5323 <exit>
+    printf(1, "create dd/ff failed\n");
+    3166:	50                   	push   %eax
+    3167:	50                   	push   %eax
+    3168:	68 32 63 00 00       	push   $0x6332
+    316d:	6a 01                	push   $0x1
+    316f:	e8 1c 23 00 00       	call   5490 <printf>
+    exit();
+    3174:	e8 aa 21 00 00       	call   5323 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    3179:	50                   	push   %eax
+    317a:	50                   	push   %eax
+    317b:	68 1a 63 00 00       	push   $0x631a
+    3180:	6a 01                	push   $0x1
+    3182:	e8 09 23 00 00       	call   5490 <printf>
+    exit();
+    3187:	e8 97 21 00 00       	call   5323 <exit>
+    printf(1, "unlink dd failed\n");
+    318c:	50                   	push   %eax
+    318d:	50                   	push   %eax
+    318e:	68 03 66 00 00       	push   $0x6603
+    3193:	6a 01                	push   $0x1
+    3195:	e8 f6 22 00 00       	call   5490 <printf>
+    exit();
+    319a:	e8 84 21 00 00       	call   5323 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    319f:	52                   	push   %edx
+    31a0:	52                   	push   %edx
+    31a1:	68 ee 65 00 00       	push   $0x65ee
+    31a6:	6a 01                	push   $0x1
+    31a8:	e8 e3 22 00 00       	call   5490 <printf>
+    exit();
+    31ad:	e8 71 21 00 00       	call   5323 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    31b2:	51                   	push   %ecx
+    31b3:	51                   	push   %ecx
+    31b4:	68 58 72 00 00       	push   $0x7258
+    31b9:	6a 01                	push   $0x1
+    31bb:	e8 d0 22 00 00       	call   5490 <printf>
+    exit();
+    31c0:	e8 5e 21 00 00       	call   5323 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    31c5:	53                   	push   %ebx
+    31c6:	53                   	push   %ebx
+    31c7:	68 d9 65 00 00       	push   $0x65d9
+    31cc:	6a 01                	push   $0x1
+    31ce:	e8 bd 22 00 00       	call   5490 <printf>
+    exit();
+    31d3:	e8 4b 21 00 00       	call   5323 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    31d8:	50                   	push   %eax
+    31d9:	50                   	push   %eax
+    31da:	68 c1 65 00 00       	push   $0x65c1
+    31df:	6a 01                	push   $0x1
+    31e1:	e8 aa 22 00 00       	call   5490 <printf>
+    exit();
+    31e6:	e8 38 21 00 00       	call   5323 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    31eb:	50                   	push   %eax
+    31ec:	50                   	push   %eax
+    31ed:	68 a9 65 00 00       	push   $0x65a9
+    31f2:	6a 01                	push   $0x1
+    31f4:	e8 97 22 00 00       	call   5490 <printf>
+    exit();
+    31f9:	e8 25 21 00 00       	call   5323 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    31fe:	50                   	push   %eax
+    31ff:	50                   	push   %eax
+    3200:	68 8d 65 00 00       	push   $0x658d
+    3205:	6a 01                	push   $0x1
+    3207:	e8 84 22 00 00       	call   5490 <printf>
+    exit();
+    320c:	e8 12 21 00 00       	call   5323 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    3211:	50                   	push   %eax
+    3212:	50                   	push   %eax
+    3213:	68 71 65 00 00       	push   $0x6571
+    3218:	6a 01                	push   $0x1
+    321a:	e8 71 22 00 00       	call   5490 <printf>
+    exit();
+    321f:	e8 ff 20 00 00       	call   5323 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    3224:	50                   	push   %eax
+    3225:	50                   	push   %eax
+    3226:	68 54 65 00 00       	push   $0x6554
+    322b:	6a 01                	push   $0x1
+    322d:	e8 5e 22 00 00       	call   5490 <printf>
+    exit();
+    3232:	e8 ec 20 00 00       	call   5323 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    3237:	52                   	push   %edx
+    3238:	52                   	push   %edx
+    3239:	68 39 65 00 00       	push   $0x6539
+    323e:	6a 01                	push   $0x1
+    3240:	e8 4b 22 00 00       	call   5490 <printf>
+    exit();
+    3245:	e8 d9 20 00 00       	call   5323 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    324a:	51                   	push   %ecx
+    324b:	51                   	push   %ecx
+    324c:	68 66 64 00 00       	push   $0x6466
+    3251:	6a 01                	push   $0x1
+    3253:	e8 38 22 00 00       	call   5490 <printf>
+    exit();
+    3258:	e8 c6 20 00 00       	call   5323 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    325d:	53                   	push   %ebx
+    325e:	53                   	push   %ebx
+    325f:	68 4e 64 00 00       	push   $0x644e
+    3264:	6a 01                	push   $0x1
+    3266:	e8 25 22 00 00       	call   5490 <printf>
+    exit();
+    326b:	e8 b3 20 00 00       	call   5323 <exit>
+
+00003270 <bigwrite>:
+{
+    3270:	55                   	push   %ebp
+    3271:	89 e5                	mov    %esp,%ebp
+    3273:	56                   	push   %esi
+    3274:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    3275:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    327a:	83 ec 08             	sub    $0x8,%esp
+    327d:	68 20 66 00 00       	push   $0x6620
+    3282:	6a 01                	push   $0x1
+    3284:	e8 07 22 00 00       	call   5490 <printf>
+  unlink("bigwrite");
+    3289:	c7 04 24 2f 66 00 00 	movl   $0x662f,(%esp)
+    3290:	e8 de 20 00 00       	call   5373 <unlink>
+    3295:	83 c4 10             	add    $0x10,%esp
+    3298:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    329f:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    32a0:	83 ec 08             	sub    $0x8,%esp
+    32a3:	68 02 02 00 00       	push   $0x202
+    32a8:	68 2f 66 00 00       	push   $0x662f
+    32ad:	e8 b1 20 00 00       	call   5363 <open>
+    if(fd < 0){
+    32b2:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    32b5:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    32b7:	85 c0                	test   %eax,%eax
+    32b9:	78 7e                	js     3339 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    32bb:	83 ec 04             	sub    $0x4,%esp
+    32be:	53                   	push   %ebx
+    32bf:	68 00 ab 00 00       	push   $0xab00
+    32c4:	50                   	push   %eax
+    32c5:	e8 79 20 00 00       	call   5343 <write>
+      if(cc != sz){
+    32ca:	83 c4 10             	add    $0x10,%esp
+    32cd:	39 d8                	cmp    %ebx,%eax
+    32cf:	75 55                	jne    3326 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    32d1:	83 ec 04             	sub    $0x4,%esp
+    32d4:	53                   	push   %ebx
+    32d5:	68 00 ab 00 00       	push   $0xab00
+    32da:	56                   	push   %esi
+    32db:	e8 63 20 00 00       	call   5343 <write>
+      if(cc != sz){
+    32e0:	83 c4 10             	add    $0x10,%esp
+    32e3:	39 c3                	cmp    %eax,%ebx
+    32e5:	75 3f                	jne    3326 <bigwrite+0xb6>
+    close(fd);
+    32e7:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    32ea:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    32f0:	56                   	push   %esi
+    32f1:	e8 55 20 00 00       	call   534b <close>
+    unlink("bigwrite");
+    32f6:	c7 04 24 2f 66 00 00 	movl   $0x662f,(%esp)
+    32fd:	e8 71 20 00 00       	call   5373 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    3302:	83 c4 10             	add    $0x10,%esp
+    3305:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    330b:	75 93                	jne    32a0 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    330d:	83 ec 08             	sub    $0x8,%esp
+    3310:	68 62 66 00 00       	push   $0x6662
+    3315:	6a 01                	push   $0x1
+    3317:	e8 74 21 00 00       	call   5490 <printf>
+}
+    331c:	83 c4 10             	add    $0x10,%esp
+    331f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3322:	5b                   	pop    %ebx
+    3323:	5e                   	pop    %esi
+    3324:	5d                   	pop    %ebp
+    3325:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    3326:	50                   	push   %eax
+    3327:	53                   	push   %ebx
+    3328:	68 50 66 00 00       	push   $0x6650
+    332d:	6a 01                	push   $0x1
+    332f:	e8 5c 21 00 00       	call   5490 <printf>
+        exit();
+    3334:	e8 ea 1f 00 00       	call   5323 <exit>
+      printf(1, "cannot create bigwrite\n");
+    3339:	83 ec 08             	sub    $0x8,%esp
+    333c:	68 38 66 00 00       	push   $0x6638
+    3341:	6a 01                	push   $0x1
+    3343:	e8 48 21 00 00       	call   5490 <printf>
+      exit();
+    3348:	e8 d6 1f 00 00       	call   5323 <exit>
+    334d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003350 <hugewrite>:
+{
+    3350:	55                   	push   %ebp
+    3351:	89 e5                	mov    %esp,%ebp
+    3353:	56                   	push   %esi
+    3354:	53                   	push   %ebx
+  printf(1, "hugewrite test\n");
+    3355:	83 ec 08             	sub    $0x8,%esp
+    3358:	68 6f 66 00 00       	push   $0x666f
+    335d:	6a 01                	push   $0x1
+    335f:	e8 2c 21 00 00       	call   5490 <printf>
+  p = sbrk(sz);
+    3364:	c7 04 24 00 60 09 00 	movl   $0x96000,(%esp)
+    336b:	e8 3b 20 00 00       	call   53ab <sbrk>
+  if(p == (char*)-1){
+    3370:	83 c4 10             	add    $0x10,%esp
+    3373:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3376:	0f 84 9b 01 00 00    	je     3517 <hugewrite+0x1c7>
+    337c:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < sz; i++)
+    337e:	31 c9                	xor    %ecx,%ecx
+    p[i] = i % 251;
+    3380:	be bf bf 8c 82       	mov    $0x828cbfbf,%esi
+    3385:	8d 76 00             	lea    0x0(%esi),%esi
+    3388:	89 c8                	mov    %ecx,%eax
+    338a:	f7 e6                	mul    %esi
+    338c:	89 c8                	mov    %ecx,%eax
+    338e:	c1 ea 07             	shr    $0x7,%edx
+    3391:	69 d2 fb 00 00 00    	imul   $0xfb,%edx,%edx
+    3397:	29 d0                	sub    %edx,%eax
+    3399:	88 04 0b             	mov    %al,(%ebx,%ecx,1)
+  for(i = 0; i < sz; i++)
+    339c:	83 c1 01             	add    $0x1,%ecx
+    339f:	81 f9 00 60 09 00    	cmp    $0x96000,%ecx
+    33a5:	75 e1                	jne    3388 <hugewrite+0x38>
+  unlink("hugewrite");
+    33a7:	83 ec 0c             	sub    $0xc,%esp
+    33aa:	68 97 66 00 00       	push   $0x6697
+    33af:	e8 bf 1f 00 00       	call   5373 <unlink>
+  fd = open("hugewrite", O_CREATE | O_RDWR);
+    33b4:	58                   	pop    %eax
+    33b5:	5a                   	pop    %edx
+    33b6:	68 02 02 00 00       	push   $0x202
+    33bb:	68 97 66 00 00       	push   $0x6697
+    33c0:	e8 9e 1f 00 00       	call   5363 <open>
+  if(fd < 0 || write(fd, "x", 1) != 1 || write(fd, p, sz) != sz){
+    33c5:	83 c4 10             	add    $0x10,%esp
+  fd = open("hugewrite", O_CREATE | O_RDWR);
+    33c8:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || write(fd, "x", 1) != 1 || write(fd, p, sz) != sz){
+    33ca:	85 c0                	test   %eax,%eax
+    33cc:	0f 88 31 01 00 00    	js     3503 <hugewrite+0x1b3>
+    33d2:	83 ec 04             	sub    $0x4,%esp
+    33d5:	6a 01                	push   $0x1
+    33d7:	68 58 62 00 00       	push   $0x6258
+    33dc:	50                   	push   %eax
+    33dd:	e8 61 1f 00 00       	call   5343 <write>
+    33e2:	83 c4 10             	add    $0x10,%esp
+    33e5:	83 f8 01             	cmp    $0x1,%eax
+    33e8:	0f 85 15 01 00 00    	jne    3503 <hugewrite+0x1b3>
+    33ee:	83 ec 04             	sub    $0x4,%esp
+    33f1:	68 00 60 09 00       	push   $0x96000
+    33f6:	53                   	push   %ebx
+    33f7:	56                   	push   %esi
+    33f8:	e8 46 1f 00 00       	call   5343 <write>
+    33fd:	83 c4 10             	add    $0x10,%esp
+    3400:	3d 00 60 09 00       	cmp    $0x96000,%eax
+    3405:	0f 85 f8 00 00 00    	jne    3503 <hugewrite+0x1b3>
+  close(fd);
+    340b:	83 ec 0c             	sub    $0xc,%esp
+    340e:	56                   	push   %esi
+    340f:	e8 37 1f 00 00       	call   534b <close>
+  memset(p, 0, sz);
+    3414:	83 c4 0c             	add    $0xc,%esp
+    3417:	68 00 60 09 00       	push   $0x96000
+    341c:	6a 00                	push   $0x0
+    341e:	53                   	push   %ebx
+    341f:	e8 7c 1d 00 00       	call   51a0 <memset>
+  fd = open("hugewrite", O_RDONLY);
+    3424:	59                   	pop    %ecx
+    3425:	5e                   	pop    %esi
+    3426:	6a 00                	push   $0x0
+    3428:	68 97 66 00 00       	push   $0x6697
+    342d:	e8 31 1f 00 00       	call   5363 <open>
+  if(fd < 0 || read(fd, p, 1) != 1 || read(fd, p, sz) != sz){
+    3432:	83 c4 10             	add    $0x10,%esp
+  fd = open("hugewrite", O_RDONLY);
+    3435:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || read(fd, p, 1) != 1 || read(fd, p, sz) != sz){
+    3437:	85 c0                	test   %eax,%eax
+    3439:	0f 88 b0 00 00 00    	js     34ef <hugewrite+0x19f>
+    343f:	83 ec 04             	sub    $0x4,%esp
+    3442:	6a 01                	push   $0x1
+    3444:	53                   	push   %ebx
+    3445:	50                   	push   %eax
+    3446:	e8 f0 1e 00 00       	call   533b <read>
+    344b:	83 c4 10             	add    $0x10,%esp
+    344e:	83 f8 01             	cmp    $0x1,%eax
+    3451:	0f 85 98 00 00 00    	jne    34ef <hugewrite+0x19f>
+    3457:	83 ec 04             	sub    $0x4,%esp
+    345a:	68 00 60 09 00       	push   $0x96000
+    345f:	53                   	push   %ebx
+    3460:	56                   	push   %esi
+    3461:	e8 d5 1e 00 00       	call   533b <read>
+    3466:	83 c4 10             	add    $0x10,%esp
+    3469:	3d 00 60 09 00       	cmp    $0x96000,%eax
+    346e:	75 7f                	jne    34ef <hugewrite+0x19f>
+  close(fd);
+    3470:	83 ec 0c             	sub    $0xc,%esp
+    3473:	56                   	push   %esi
+    if(p[i] != (char)(i % 251)){
+    3474:	be bf bf 8c 82       	mov    $0x828cbfbf,%esi
+  close(fd);
+    3479:	e8 cd 1e 00 00       	call   534b <close>
+    347e:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sz; i++){
+    3481:	31 c9                	xor    %ecx,%ecx
+    3483:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3487:	90                   	nop
+    if(p[i] != (char)(i % 251)){
+    3488:	89 c8                	mov    %ecx,%eax
+    348a:	f7 e6                	mul    %esi
+    348c:	89 c8                	mov    %ecx,%eax
+    348e:	c1 ea 07             	shr    $0x7,%edx
+    3491:	69 d2 fb 00 00 00    	imul   $0xfb,%edx,%edx
+    3497:	29 d0                	sub    %edx,%eax
+    3499:	38 04 0b             	cmp    %al,(%ebx,%ecx,1)
+    349c:	75 3c                	jne    34da <hugewrite+0x18a>
+  for(i = 0; i < sz; i++){
+    349e:	83 c1 01             	add    $0x1,%ecx
+    34a1:	81 f9 00 60 09 00    	cmp    $0x96000,%ecx
+    34a7:	75 df                	jne    3488 <hugewrite+0x138>
+  unlink("hugewrite");
+    34a9:	83 ec 0c             	sub    $0xc,%esp
+    34ac:	68 97 66 00 00       	push   $0x6697
+    34b1:	e8 bd 1e 00 00       	call   5373 <unlink>
+  sbrk(-sz);
+    34b6:	c7 04 24 00 a0 f6 ff 	movl   $0xfff6a000,(%esp)
+    34bd:	e8 e9 1e 00 00       	call   53ab <sbrk>
+  printf(1, "hugewrite ok\n");
+    34c2:	58                   	pop    %eax
+    34c3:	5a                   	pop    %edx
+    34c4:	68 ef 66 00 00       	push   $0x66ef
+    34c9:	6a 01                	push   $0x1
+    34cb:	e8 c0 1f 00 00       	call   5490 <printf>
+}
+    34d0:	83 c4 10             	add    $0x10,%esp
+    34d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    34d6:	5b                   	pop    %ebx
+    34d7:	5e                   	pop    %esi
+    34d8:	5d                   	pop    %ebp
+    34d9:	c3                   	ret
+      printf(1, "hugewrite: wrong data at %d\n", i);
+    34da:	83 ec 04             	sub    $0x4,%esp
+    34dd:	51                   	push   %ecx
+    34de:	68 d2 66 00 00       	push   $0x66d2
+    34e3:	6a 01                	push   $0x1
+    34e5:	e8 a6 1f 00 00       	call   5490 <printf>
+      exit();
+    34ea:	e8 34 1e 00 00       	call   5323 <exit>
+    printf(1, "hugewrite: read failed\n");
+    34ef:	83 ec 08             	sub    $0x8,%esp
+    34f2:	68 ba 66 00 00       	push   $0x66ba
+    34f7:	6a 01                	push   $0x1
+    34f9:	e8 92 1f 00 00       	call   5490 <printf>
+    exit();
+    34fe:	e8 20 1e 00 00       	call   5323 <exit>
+    printf(1, "hugewrite: write failed\n");
+    3503:	83 ec 08             	sub    $0x8,%esp
+    3506:	68 a1 66 00 00       	push   $0x66a1
+    350b:	6a 01                	push   $0x1
+    350d:	e8 7e 1f 00 00       	call   5490 <printf>
+    exit();
+    3512:	e8 0c 1e 00 00       	call   5323 <exit>
+    printf(1, "hugewrite: sbrk failed\n");
+    3517:	51                   	push   %ecx
+    3518:	51                   	push   %ecx
+    3519:	68 7f 66 00 00       	push   $0x667f
+    351e:	6a 01                	push   $0x1
+    3520:	e8 6b 1f 00 00       	call   5490 <printf>
+    exit();
+    3525:	e8 f9 1d 00 00       	call   5323 <exit>
+    352a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003530 <bigfile>:
+{
+    3530:	55                   	push   %ebp
+    3531:	89 e5                	mov    %esp,%ebp
+    3533:	57                   	push   %edi
+    3534:	56                   	push   %esi
+    3535:	53                   	push   %ebx
+    3536:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    3539:	68 fd 66 00 00       	push   $0x66fd
+    353e:	6a 01                	push   $0x1
+    3540:	e8 4b 1f 00 00       	call   5490 <printf>
+  unlink("bigfile");
+    3545:	c7 04 24 19 67 00 00 	movl   $0x6719,(%esp)
+    354c:	e8 22 1e 00 00       	call   5373 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    3551:	58                   	pop    %eax
+    3552:	5a                   	pop    %edx
+    3553:	68 02 02 00 00       	push   $0x202
+    3558:	68 19 67 00 00       	push   $0x6719
+    355d:	e8 01 1e 00 00       	call   5363 <open>
+  if(fd < 0){
+    3562:	83 c4 10             	add    $0x10,%esp
+    3565:	85 c0                	test   %eax,%eax
+    3567:	0f 88 5e 01 00 00    	js     36cb <bigfile+0x19b>
+    356d:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    356f:	31 db                	xor    %ebx,%ebx
+    3571:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    3578:	83 ec 04             	sub    $0x4,%esp
+    357b:	68 58 02 00 00       	push   $0x258
+    3580:	53                   	push   %ebx
+    3581:	68 00 ab 00 00       	push   $0xab00
+    3586:	e8 15 1c 00 00       	call   51a0 <memset>
+    if(write(fd, buf, 600) != 600){
+    358b:	83 c4 0c             	add    $0xc,%esp
+    358e:	68 58 02 00 00       	push   $0x258
+    3593:	68 00 ab 00 00       	push   $0xab00
+    3598:	56                   	push   %esi
+    3599:	e8 a5 1d 00 00       	call   5343 <write>
+    359e:	83 c4 10             	add    $0x10,%esp
+    35a1:	3d 58 02 00 00       	cmp    $0x258,%eax
+    35a6:	0f 85 f8 00 00 00    	jne    36a4 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    35ac:	83 c3 01             	add    $0x1,%ebx
+    35af:	83 fb 14             	cmp    $0x14,%ebx
+    35b2:	75 c4                	jne    3578 <bigfile+0x48>
+  close(fd);
+    35b4:	83 ec 0c             	sub    $0xc,%esp
+    35b7:	56                   	push   %esi
+    35b8:	e8 8e 1d 00 00       	call   534b <close>
+  fd = open("bigfile", 0);
+    35bd:	5e                   	pop    %esi
+    35be:	5f                   	pop    %edi
+    35bf:	6a 00                	push   $0x0
+    35c1:	68 19 67 00 00       	push   $0x6719
+    35c6:	e8 98 1d 00 00       	call   5363 <open>
+  if(fd < 0){
+    35cb:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    35ce:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    35d0:	85 c0                	test   %eax,%eax
+    35d2:	0f 88 e0 00 00 00    	js     36b8 <bigfile+0x188>
+  total = 0;
+    35d8:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    35da:	31 ff                	xor    %edi,%edi
+    35dc:	eb 30                	jmp    360e <bigfile+0xde>
+    35de:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    35e0:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    35e5:	0f 85 91 00 00 00    	jne    367c <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    35eb:	89 fa                	mov    %edi,%edx
+    35ed:	0f be 05 00 ab 00 00 	movsbl 0xab00,%eax
+    35f4:	d1 fa                	sar    %edx
+    35f6:	39 d0                	cmp    %edx,%eax
+    35f8:	75 6e                	jne    3668 <bigfile+0x138>
+    35fa:	0f be 15 2b ac 00 00 	movsbl 0xac2b,%edx
+    3601:	39 d0                	cmp    %edx,%eax
+    3603:	75 63                	jne    3668 <bigfile+0x138>
+    total += cc;
+    3605:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    360b:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    360e:	83 ec 04             	sub    $0x4,%esp
+    3611:	68 2c 01 00 00       	push   $0x12c
+    3616:	68 00 ab 00 00       	push   $0xab00
+    361b:	56                   	push   %esi
+    361c:	e8 1a 1d 00 00       	call   533b <read>
+    if(cc < 0){
+    3621:	83 c4 10             	add    $0x10,%esp
+    3624:	85 c0                	test   %eax,%eax
+    3626:	78 68                	js     3690 <bigfile+0x160>
+    if(cc == 0)
+    3628:	75 b6                	jne    35e0 <bigfile+0xb0>
+  close(fd);
+    362a:	83 ec 0c             	sub    $0xc,%esp
+    362d:	56                   	push   %esi
+    362e:	e8 18 1d 00 00       	call   534b <close>
+  if(total != 20*600){
+    3633:	83 c4 10             	add    $0x10,%esp
+    3636:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    363c:	0f 85 9c 00 00 00    	jne    36de <bigfile+0x1ae>
+  unlink("bigfile");
+    3642:	83 ec 0c             	sub    $0xc,%esp
+    3645:	68 19 67 00 00       	push   $0x6719
+    364a:	e8 24 1d 00 00       	call   5373 <unlink>
+  printf(1, "bigfile test ok\n");
+    364f:	58                   	pop    %eax
+    3650:	5a                   	pop    %edx
+    3651:	68 a8 67 00 00       	push   $0x67a8
+    3656:	6a 01                	push   $0x1
+    3658:	e8 33 1e 00 00       	call   5490 <printf>
+}
+    365d:	83 c4 10             	add    $0x10,%esp
+    3660:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3663:	5b                   	pop    %ebx
+    3664:	5e                   	pop    %esi
+    3665:	5f                   	pop    %edi
+    3666:	5d                   	pop    %ebp
+    3667:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    3668:	83 ec 08             	sub    $0x8,%esp
+    366b:	68 75 67 00 00       	push   $0x6775
+    3670:	6a 01                	push   $0x1
+    3672:	e8 19 1e 00 00       	call   5490 <printf>
+      exit();
+    3677:	e8 a7 1c 00 00       	call   5323 <exit>
+      printf(1, "short read bigfile\n");
+    367c:	83 ec 08             	sub    $0x8,%esp
+    367f:	68 61 67 00 00       	push   $0x6761
+    3684:	6a 01                	push   $0x1
+    3686:	e8 05 1e 00 00       	call   5490 <printf>
+      exit();
+    368b:	e8 93 1c 00 00       	call   5323 <exit>
+      printf(1, "read bigfile failed\n");
+    3690:	83 ec 08             	sub    $0x8,%esp
+    3693:	68 4c 67 00 00       	push   $0x674c
+    3698:	6a 01                	push   $0x1
+    369a:	e8 f1 1d 00 00       	call   5490 <printf>
+      exit();
+    369f:	e8 7f 1c 00 00       	call   5323 <exit>
+      printf(1, "write bigfile failed\n");
+    36a4:	83 ec 08             	sub    $0x8,%esp
+    36a7:	68 21 67 00 00       	push   $0x6721
+    36ac:	6a 01                	push   $0x1
+    36ae:	e8 dd 1d 00 00       	call   5490 <printf>
+      exit();
+    36b3:	e8 6b 1c 00 00       	call   5323 <exit>
+    printf(1, "cannot open bigfile\n");
+    36b8:	53                   	push   %ebx
+    36b9:	53                   	push   %ebx
+    36ba:	68 37 67 00 00       	push   $0x6737
+    36bf:	6a 01                	push   $0x1
+    36c1:	e8 ca 1d 00 00       	call   5490 <printf>
+    exit();
+    36c6:	e8 58 1c 00 00       	call   5323 <exit>
+    printf(1, "cannot create bigfile");
+    36cb:	50                   	push   %eax
+    36cc:	50                   	push   %eax
+    36cd:	68 0b 67 00 00       	push   $0x670b
+    36d2:	6a 01                	push   $0x1
+    36d4:	e8 b7 1d 00 00       	call   5490 <printf>
+    exit();
+    36d9:	e8 45 1c 00 00       	call   5323 <exit>
+    printf(1, "read bigfile wrong total\n");
+    36de:	51                   	push   %ecx
+    36df:	51                   	push   %ecx
+    36e0:	68 8e 67 00 00       	push   $0x678e
+    36e5:	6a 01                	push   $0x1
+    36e7:	e8 a4 1d 00 00       	call   5490 <printf>
+    exit();
+    36ec:	e8 32 1c 00 00       	call   5323 <exit>
+    36f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    36f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    36ff:	90                   	nop
+
+00003700 <extenttest>:
+{
+    3700:	55                   	push   %ebp
+    3701:	89 e5                	mov    %esp,%ebp
+    3703:	57                   	push   %edi
+    3704:	56                   	push   %esi
+    3705:	53                   	push   %ebx
+    3706:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "extent test\n");
+    3709:	68 be 67 00 00       	push   $0x67be
+    370e:	6a 01                	push   $0x1
+    3710:	e8 7b 1d 00 00       	call   5490 <printf>
+  unlink("ext0");
+    3715:	c7 04 24 b9 67 00 00 	movl   $0x67b9,(%esp)
+    371c:	e8 52 1c 00 00       	call   5373 <unlink>
+  unlink("ext1");
+    3721:	c7 04 24 cb 67 00 00 	movl   $0x67cb,(%esp)
+    3728:	e8 46 1c 00 00       	call   5373 <unlink>
+  fd[0] = open("ext0", O_CREATE | O_EXTENT | O_RDWR);
+    372d:	5f                   	pop    %edi
+    372e:	58                   	pop    %eax
+    372f:	68 02 06 00 00       	push   $0x602
+    3734:	68 b9 67 00 00       	push   $0x67b9
+    3739:	e8 25 1c 00 00       	call   5363 <open>
+    373e:	89 c7                	mov    %eax,%edi
+  fd[1] = open("ext1", O_CREATE | O_EXTENT | O_RDWR);
+    3740:	58                   	pop    %eax
+    3741:	5a                   	pop    %edx
+    3742:	68 02 06 00 00       	push   $0x602
+    3747:	68 cb 67 00 00       	push   $0x67cb
+    374c:	e8 12 1c 00 00       	call   5363 <open>
+  if(fd[0] < 0 || fd[1] < 0){
+    3751:	83 c4 10             	add    $0x10,%esp
+  fd[1] = open("ext1", O_CREATE | O_EXTENT | O_RDWR);
+    3754:	89 c6                	mov    %eax,%esi
+  if(fd[0] < 0 || fd[1] < 0){
+    3756:	89 f8                	mov    %edi,%eax
+    3758:	09 f0                	or     %esi,%eax
+    375a:	0f 88 a0 01 00 00    	js     3900 <extenttest+0x200>
+    3760:	bb 61 00 00 00       	mov    $0x61,%ebx
+    3765:	8d 76 00             	lea    0x0(%esi),%esi
+      memset(buf, 'a' + i, 3*BSIZE);
+    3768:	83 ec 04             	sub    $0x4,%esp
+    376b:	68 00 06 00 00       	push   $0x600
+    3770:	53                   	push   %ebx
+    3771:	68 00 ab 00 00       	push   $0xab00
+    3776:	e8 25 1a 00 00       	call   51a0 <memset>
+      if(write(fd[j], buf, 3*BSIZE) != 3*BSIZE){
+    377b:	83 c4 0c             	add    $0xc,%esp
+      buf[0] = j;
+    377e:	c6 05 00 ab 00 00 00 	movb   $0x0,0xab00
+      if(write(fd[j], buf, 3*BSIZE) != 3*BSIZE){
+    3785:	68 00 06 00 00       	push   $0x600
+    378a:	68 00 ab 00 00       	push   $0xab00
+    378f:	57                   	push   %edi
+    3790:	e8 ae 1b 00 00       	call   5343 <write>
+    3795:	83 c4 10             	add    $0x10,%esp
+    3798:	3d 00 06 00 00       	cmp    $0x600,%eax
+    379d:	0f 85 49 01 00 00    	jne    38ec <extenttest+0x1ec>
+      memset(buf, 'a' + i, 3*BSIZE);
+    37a3:	83 ec 04             	sub    $0x4,%esp
+    37a6:	68 00 06 00 00       	push   $0x600
+    37ab:	53                   	push   %ebx
+    37ac:	68 00 ab 00 00       	push   $0xab00
+    37b1:	e8 ea 19 00 00       	call   51a0 <memset>
+      if(write(fd[j], buf, 3*BSIZE) != 3*BSIZE){
+    37b6:	83 c4 0c             	add    $0xc,%esp
+      buf[0] = j;
+    37b9:	c6 05 00 ab 00 00 01 	movb   $0x1,0xab00
+      if(write(fd[j], buf, 3*BSIZE) != 3*BSIZE){
+    37c0:	68 00 06 00 00       	push   $0x600
+    37c5:	68 00 ab 00 00       	push   $0xab00
+    37ca:	56                   	push   %esi
+    37cb:	e8 73 1b 00 00       	call   5343 <write>
+    37d0:	83 c4 10             	add    $0x10,%esp
+    37d3:	3d 00 06 00 00       	cmp    $0x600,%eax
+    37d8:	0f 85 0e 01 00 00    	jne    38ec <extenttest+0x1ec>
+  for(i = 0; i < 3*NEXTENT; i++){
+    37de:	83 c3 01             	add    $0x1,%ebx
+    37e1:	83 fb 73             	cmp    $0x73,%ebx
+    37e4:	75 82                	jne    3768 <extenttest+0x68>
+  close(fd[0]);
+    37e6:	83 ec 0c             	sub    $0xc,%esp
+    37e9:	57                   	push   %edi
+    37ea:	e8 5c 1b 00 00       	call   534b <close>
+  close(fd[1]);
+    37ef:	89 34 24             	mov    %esi,(%esp)
+  for(j = 0; j < 2; j++){
+    37f2:	31 f6                	xor    %esi,%esi
+  close(fd[1]);
+    37f4:	e8 52 1b 00 00       	call   534b <close>
+    37f9:	83 c4 10             	add    $0x10,%esp
+    fd[j] = open(j ? "ext1" : "ext0", 0);
+    37fc:	b8 b9 67 00 00       	mov    $0x67b9,%eax
+    3801:	83 ec 08             	sub    $0x8,%esp
+    3804:	6a 00                	push   $0x0
+    3806:	50                   	push   %eax
+    3807:	e8 57 1b 00 00       	call   5363 <open>
+    if(fd[j] < 0){
+    380c:	83 c4 10             	add    $0x10,%esp
+    fd[j] = open(j ? "ext1" : "ext0", 0);
+    380f:	89 c3                	mov    %eax,%ebx
+    if(fd[j] < 0){
+    3811:	85 c0                	test   %eax,%eax
+    3813:	0f 88 0d 01 00 00    	js     3926 <extenttest+0x226>
+    3819:	bf 61 00 00 00       	mov    $0x61,%edi
+    381e:	eb 3b                	jmp    385b <extenttest+0x15b>
+      if(n != 3*BSIZE || buf[0] != j || buf[1] != 'a' + i ||
+    3820:	3d 00 06 00 00       	cmp    $0x600,%eax
+    3825:	0f 85 ad 00 00 00    	jne    38d8 <extenttest+0x1d8>
+    382b:	0f be 05 00 ab 00 00 	movsbl 0xab00,%eax
+    3832:	39 c6                	cmp    %eax,%esi
+    3834:	0f 85 9e 00 00 00    	jne    38d8 <extenttest+0x1d8>
+    383a:	0f be 05 01 ab 00 00 	movsbl 0xab01,%eax
+    3841:	39 f8                	cmp    %edi,%eax
+    3843:	0f 85 8f 00 00 00    	jne    38d8 <extenttest+0x1d8>
+         buf[3*BSIZE-1] != 'a' + i){
+    3849:	0f be 05 ff b0 00 00 	movsbl 0xb0ff,%eax
+      if(n != 3*BSIZE || buf[0] != j || buf[1] != 'a' + i ||
+    3850:	39 f8                	cmp    %edi,%eax
+    3852:	0f 85 80 00 00 00    	jne    38d8 <extenttest+0x1d8>
+    for(i = 0; (n = read(fd[j], buf, 3*BSIZE)) > 0; i++){
+    3858:	83 c7 01             	add    $0x1,%edi
+    385b:	83 ec 04             	sub    $0x4,%esp
+    385e:	68 00 06 00 00       	push   $0x600
+    3863:	68 00 ab 00 00       	push   $0xab00
+    3868:	53                   	push   %ebx
+    3869:	e8 cd 1a 00 00       	call   533b <read>
+    386e:	83 c4 10             	add    $0x10,%esp
+    3871:	85 c0                	test   %eax,%eax
+    3873:	7f ab                	jg     3820 <extenttest+0x120>
+    if(n < 0 || i != 3*NEXTENT){
+    3875:	83 ff 73             	cmp    $0x73,%edi
+    3878:	0f 85 95 00 00 00    	jne    3913 <extenttest+0x213>
+    387e:	85 c0                	test   %eax,%eax
+    3880:	0f 88 8d 00 00 00    	js     3913 <extenttest+0x213>
+    close(fd[j]);
+    3886:	83 ec 0c             	sub    $0xc,%esp
+    3889:	53                   	push   %ebx
+    388a:	e8 bc 1a 00 00       	call   534b <close>
+    fd[j] = open(j ? "ext1" : "ext0", 0);
+    388f:	b8 cb 67 00 00       	mov    $0x67cb,%eax
+  for(j = 0; j < 2; j++){
+    3894:	83 c4 10             	add    $0x10,%esp
+    3897:	83 fe 01             	cmp    $0x1,%esi
+    389a:	74 0a                	je     38a6 <extenttest+0x1a6>
+    389c:	be 01 00 00 00       	mov    $0x1,%esi
+    38a1:	e9 5b ff ff ff       	jmp    3801 <extenttest+0x101>
+  unlink("ext0");
+    38a6:	83 ec 0c             	sub    $0xc,%esp
+    38a9:	68 b9 67 00 00       	push   $0x67b9
+    38ae:	e8 c0 1a 00 00       	call   5373 <unlink>
+  unlink("ext1");
+    38b3:	c7 04 24 cb 67 00 00 	movl   $0x67cb,(%esp)
+    38ba:	e8 b4 1a 00 00       	call   5373 <unlink>
+  printf(1, "extent test ok\n");
+    38bf:	58                   	pop    %eax
+    38c0:	5a                   	pop    %edx
+    38c1:	68 5a 68 00 00       	push   $0x685a
+    38c6:	6a 01                	push   $0x1
+    38c8:	e8 c3 1b 00 00       	call   5490 <printf>
+}
+    38cd:	83 c4 10             	add    $0x10,%esp
+    38d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    38d3:	5b                   	pop    %ebx
+    38d4:	5e                   	pop    %esi
+    38d5:	5f                   	pop    %edi
+    38d6:	5d                   	pop    %ebp
+    38d7:	c3                   	ret
+        printf(1, "read extent file wrong data\n");
+    38d8:	83 ec 08             	sub    $0x8,%esp
+    38db:	68 1f 68 00 00       	push   $0x681f
+    38e0:	6a 01                	push   $0x1
+    38e2:	e8 a9 1b 00 00       	call   5490 <printf>
+        exit();
+    38e7:	e8 37 1a 00 00       	call   5323 <exit>
+        printf(1, "write extent file failed\n");
+    38ec:	83 ec 08             	sub    $0x8,%esp
+    38ef:	68 ec 67 00 00       	push   $0x67ec
+    38f4:	6a 01                	push   $0x1
+    38f6:	e8 95 1b 00 00       	call   5490 <printf>
+        exit();
+    38fb:	e8 23 1a 00 00       	call   5323 <exit>
+    printf(1, "cannot create extent files\n");
+    3900:	56                   	push   %esi
+    3901:	56                   	push   %esi
+    3902:	68 d0 67 00 00       	push   $0x67d0
+    3907:	6a 01                	push   $0x1
+    3909:	e8 82 1b 00 00       	call   5490 <printf>
+    exit();
+    390e:	e8 10 1a 00 00       	call   5323 <exit>
+      printf(1, "read extent file wrong total\n");
+    3913:	51                   	push   %ecx
+    3914:	51                   	push   %ecx
+    3915:	68 3c 68 00 00       	push   $0x683c
+    391a:	6a 01                	push   $0x1
+    391c:	e8 6f 1b 00 00       	call   5490 <printf>
+      exit();
+    3921:	e8 fd 19 00 00       	call   5323 <exit>
+      printf(1, "cannot open extent file\n");
+    3926:	53                   	push   %ebx
+    3927:	53                   	push   %ebx
+    3928:	68 06 68 00 00       	push   $0x6806
+    392d:	6a 01                	push   $0x1
+    392f:	e8 5c 1b 00 00       	call   5490 <printf>
+      exit();
+    3934:	e8 ea 19 00 00       	call   5323 <exit>
+    3939:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003940 <extentfull>:
+{
+    3940:	55                   	push   %ebp
+    3941:	89 e5                	mov    %esp,%ebp
+    3943:	57                   	push   %edi
+    3944:	56                   	push   %esi
+    3945:	53                   	push   %ebx
+    3946:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "extentfull test\n");
+    3949:	68 6a 68 00 00       	push   $0x686a
+    394e:	6a 01                	push   $0x1
+    3950:	e8 3b 1b 00 00       	call   5490 <printf>
+  unlink("extf0");
+    3955:	c7 04 24 7b 68 00 00 	movl   $0x687b,(%esp)
+    395c:	e8 12 1a 00 00       	call   5373 <unlink>
+  unlink("extf1");
+    3961:	c7 04 24 81 68 00 00 	movl   $0x6881,(%esp)
+    3968:	e8 06 1a 00 00       	call   5373 <unlink>
+  fd[0] = open("extf0", O_CREATE | O_EXTENT | O_RDWR);
+    396d:	58                   	pop    %eax
+    396e:	5a                   	pop    %edx
+    396f:	68 02 06 00 00       	push   $0x602
+    3974:	68 7b 68 00 00       	push   $0x687b
+    3979:	e8 e5 19 00 00       	call   5363 <open>
+  fd[1] = open("extf1", O_CREATE | O_EXTENT | O_RDWR);
+    397e:	59                   	pop    %ecx
+    397f:	5b                   	pop    %ebx
+    3980:	68 02 06 00 00       	push   $0x602
+    3985:	68 81 68 00 00       	push   $0x6881
+  fd[0] = open("extf0", O_CREATE | O_EXTENT | O_RDWR);
+    398a:	89 c7                	mov    %eax,%edi
+  fd[1] = open("extf1", O_CREATE | O_EXTENT | O_RDWR);
+    398c:	e8 d2 19 00 00       	call   5363 <open>
+  if(fd[0] < 0 || fd[1] < 0){
+    3991:	83 c4 10             	add    $0x10,%esp
+  fd[1] = open("extf1", O_CREATE | O_EXTENT | O_RDWR);
+    3994:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(fd[0] < 0 || fd[1] < 0){
+    3997:	09 f8                	or     %edi,%eax
+    3999:	0f 88 4a 01 00 00    	js     3ae9 <extentfull+0x1a9>
+  memset(buf, 'x', BSIZE);
+    399f:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < 2*(NEXTENT + NIEXTENT) && n < 0; i++){
+    39a2:	31 db                	xor    %ebx,%ebx
+  memset(buf, 'x', BSIZE);
+    39a4:	68 00 02 00 00       	push   $0x200
+    39a9:	6a 78                	push   $0x78
+    39ab:	68 00 ab 00 00       	push   $0xab00
+    39b0:	e8 eb 17 00 00       	call   51a0 <memset>
+    39b5:	83 c4 10             	add    $0x10,%esp
+    39b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    39bf:	90                   	nop
+      if(write(fd[j], buf, BSIZE) != BSIZE)
+    39c0:	83 ec 04             	sub    $0x4,%esp
+    39c3:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    39c8:	68 00 02 00 00       	push   $0x200
+    39cd:	68 00 ab 00 00       	push   $0xab00
+    39d2:	57                   	push   %edi
+    39d3:	e8 6b 19 00 00       	call   5343 <write>
+    39d8:	83 c4 0c             	add    $0xc,%esp
+    39db:	68 00 02 00 00       	push   $0x200
+    39e0:	3d 00 02 00 00       	cmp    $0x200,%eax
+    39e5:	68 00 ab 00 00       	push   $0xab00
+    39ea:	0f 45 f3             	cmovne %ebx,%esi
+    39ed:	ff 75 e4             	push   -0x1c(%ebp)
+    39f0:	e8 4e 19 00 00       	call   5343 <write>
+    39f5:	83 c4 10             	add    $0x10,%esp
+    39f8:	3d 00 02 00 00       	cmp    $0x200,%eax
+    39fd:	74 71                	je     3a70 <extentfull+0x130>
+  if(n < NEXTENT + NIEXTENT){
+    39ff:	83 fb 45             	cmp    $0x45,%ebx
+    3a02:	0f 8e ce 00 00 00    	jle    3ad6 <extentfull+0x196>
+  if(write(fd[0], buf, BSIZE) == BSIZE && write(fd[1], buf, BSIZE) == BSIZE){
+    3a08:	83 ec 04             	sub    $0x4,%esp
+    3a0b:	68 00 02 00 00       	push   $0x200
+    3a10:	68 00 ab 00 00       	push   $0xab00
+    3a15:	57                   	push   %edi
+    3a16:	e8 28 19 00 00       	call   5343 <write>
+    3a1b:	83 c4 10             	add    $0x10,%esp
+    3a1e:	3d 00 02 00 00       	cmp    $0x200,%eax
+    3a23:	74 7b                	je     3aa0 <extentfull+0x160>
+  close(fd[0]);
+    3a25:	83 ec 0c             	sub    $0xc,%esp
+    3a28:	57                   	push   %edi
+    3a29:	e8 1d 19 00 00       	call   534b <close>
+  close(fd[1]);
+    3a2e:	58                   	pop    %eax
+    3a2f:	ff 75 e4             	push   -0x1c(%ebp)
+    3a32:	e8 14 19 00 00       	call   534b <close>
+  unlink("extf0");
+    3a37:	c7 04 24 7b 68 00 00 	movl   $0x687b,(%esp)
+    3a3e:	e8 30 19 00 00       	call   5373 <unlink>
+  unlink("extf1");
+    3a43:	c7 04 24 81 68 00 00 	movl   $0x6881,(%esp)
+    3a4a:	e8 24 19 00 00       	call   5373 <unlink>
+  printf(1, "extentfull ok\n");
+    3a4f:	5a                   	pop    %edx
+    3a50:	59                   	pop    %ecx
+    3a51:	68 87 68 00 00       	push   $0x6887
+    3a56:	6a 01                	push   $0x1
+    3a58:	e8 33 1a 00 00       	call   5490 <printf>
+}
+    3a5d:	83 c4 10             	add    $0x10,%esp
+    3a60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3a63:	5b                   	pop    %ebx
+    3a64:	5e                   	pop    %esi
+    3a65:	5f                   	pop    %edi
+    3a66:	5d                   	pop    %ebp
+    3a67:	c3                   	ret
+    3a68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3a6f:	90                   	nop
+  for(i = 0; i < 2*(NEXTENT + NIEXTENT) && n < 0; i++){
+    3a70:	83 c3 01             	add    $0x1,%ebx
+    3a73:	81 fb 8b 00 00 00    	cmp    $0x8b,%ebx
+    3a79:	77 08                	ja     3a83 <extentfull+0x143>
+    3a7b:	85 f6                	test   %esi,%esi
+    3a7d:	0f 88 3d ff ff ff    	js     39c0 <extentfull+0x80>
+  if(n < 0){
+    3a83:	83 fe ff             	cmp    $0xffffffff,%esi
+    3a86:	75 74                	jne    3afc <extentfull+0x1bc>
+    printf(1, "extentfull: extent map never filled\n");
+    3a88:	57                   	push   %edi
+    3a89:	57                   	push   %edi
+    3a8a:	68 78 72 00 00       	push   $0x7278
+    3a8f:	6a 01                	push   $0x1
+    3a91:	e8 fa 19 00 00       	call   5490 <printf>
+    exit();
+    3a96:	e8 88 18 00 00       	call   5323 <exit>
+    3a9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3a9f:	90                   	nop
+  if(write(fd[0], buf, BSIZE) == BSIZE && write(fd[1], buf, BSIZE) == BSIZE){
+    3aa0:	83 ec 04             	sub    $0x4,%esp
+    3aa3:	68 00 02 00 00       	push   $0x200
+    3aa8:	68 00 ab 00 00       	push   $0xab00
+    3aad:	ff 75 e4             	push   -0x1c(%ebp)
+    3ab0:	e8 8e 18 00 00       	call   5343 <write>
+    3ab5:	83 c4 10             	add    $0x10,%esp
+    3ab8:	3d 00 02 00 00       	cmp    $0x200,%eax
+    3abd:	0f 85 62 ff ff ff    	jne    3a25 <extentfull+0xe5>
+    printf(1, "extentfull: write to a full extent map succeeded\n");
+    3ac3:	53                   	push   %ebx
+    3ac4:	53                   	push   %ebx
+    3ac5:	68 d0 72 00 00       	push   $0x72d0
+    3aca:	6a 01                	push   $0x1
+    3acc:	e8 bf 19 00 00       	call   5490 <printf>
+    exit();
+    3ad1:	e8 4d 18 00 00       	call   5323 <exit>
+    printf(1, "extentfull: extent map full after %d blocks\n", n);
+    3ad6:	56                   	push   %esi
+    3ad7:	53                   	push   %ebx
+    3ad8:	68 a0 72 00 00       	push   $0x72a0
+    3add:	6a 01                	push   $0x1
+    3adf:	e8 ac 19 00 00       	call   5490 <printf>
+    exit();
+    3ae4:	e8 3a 18 00 00       	call   5323 <exit>
+    printf(1, "cannot create extent files\n");
+    3ae9:	50                   	push   %eax
+    3aea:	50                   	push   %eax
+    3aeb:	68 d0 67 00 00       	push   $0x67d0
+    3af0:	6a 01                	push   $0x1
+    3af2:	e8 99 19 00 00       	call   5490 <printf>
+    exit();
+    3af7:	e8 27 18 00 00       	call   5323 <exit>
+    3afc:	89 f3                	mov    %esi,%ebx
+    3afe:	e9 fc fe ff ff       	jmp    39ff <extentfull+0xbf>
+    3b03:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3b0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003b10 <fourteen>:
+{
+    3b10:	55                   	push   %ebp
+    3b11:	89 e5                	mov    %esp,%ebp
+    3b13:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    3b16:	68 96 68 00 00       	push   $0x6896
+    3b1b:	6a 01                	push   $0x1
+    3b1d:	e8 6e 19 00 00       	call   5490 <printf>
+  if(mkdir("12345678901234") != 0){
+    3b22:	c7 04 24 d1 68 00 00 	movl   $0x68d1,(%esp)
+    3b29:	e8 5d 18 00 00       	call   538b <mkdir>
+    3b2e:	83 c4 10             	add    $0x10,%esp
+    3b31:	85 c0                	test   %eax,%eax
+    3b33:	0f 85 97 00 00 00    	jne    3bd0 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    3b39:	83 ec 0c             	sub    $0xc,%esp
+    3b3c:	68 04 73 00 00       	push   $0x7304
+    3b41:	e8 45 18 00 00       	call   538b <mkdir>
+    3b46:	83 c4 10             	add    $0x10,%esp
+    3b49:	85 c0                	test   %eax,%eax
+    3b4b:	0f 85 de 00 00 00    	jne    3c2f <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    3b51:	83 ec 08             	sub    $0x8,%esp
+    3b54:	68 00 02 00 00       	push   $0x200
+    3b59:	68 54 73 00 00       	push   $0x7354
+    3b5e:	e8 00 18 00 00       	call   5363 <open>
+  if(fd < 0){
+    3b63:	83 c4 10             	add    $0x10,%esp
+    3b66:	85 c0                	test   %eax,%eax
+    3b68:	0f 88 ae 00 00 00    	js     3c1c <fourteen+0x10c>
+  close(fd);
+    3b6e:	83 ec 0c             	sub    $0xc,%esp
+    3b71:	50                   	push   %eax
+    3b72:	e8 d4 17 00 00       	call   534b <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    3b77:	58                   	pop    %eax
+    3b78:	5a                   	pop    %edx
+    3b79:	6a 00                	push   $0x0
+    3b7b:	68 c4 73 00 00       	push   $0x73c4
+    3b80:	e8 de 17 00 00       	call   5363 <open>
+  if(fd < 0){
+    3b85:	83 c4 10             	add    $0x10,%esp
+    3b88:	85 c0                	test   %eax,%eax
+    3b8a:	78 7d                	js     3c09 <fourteen+0xf9>
+  close(fd);
+    3b8c:	83 ec 0c             	sub    $0xc,%esp
+    3b8f:	50                   	push   %eax
+    3b90:	e8 b6 17 00 00       	call   534b <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    3b95:	c7 04 24 c2 68 00 00 	movl   $0x68c2,(%esp)
+    3b9c:	e8 ea 17 00 00       	call   538b <mkdir>
+    3ba1:	83 c4 10             	add    $0x10,%esp
+    3ba4:	85 c0                	test   %eax,%eax
+    3ba6:	74 4e                	je     3bf6 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    3ba8:	83 ec 0c             	sub    $0xc,%esp
+    3bab:	68 60 74 00 00       	push   $0x7460
+    3bb0:	e8 d6 17 00 00       	call   538b <mkdir>
+    3bb5:	83 c4 10             	add    $0x10,%esp
+    3bb8:	85 c0                	test   %eax,%eax
+    3bba:	74 27                	je     3be3 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    3bbc:	83 ec 08             	sub    $0x8,%esp
+    3bbf:	68 e0 68 00 00       	push   $0x68e0
+    3bc4:	6a 01                	push   $0x1
+    3bc6:	e8 c5 18 00 00       	call   5490 <printf>
+}
+    3bcb:	83 c4 10             	add    $0x10,%esp
+    3bce:	c9                   	leave
+    3bcf:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    3bd0:	50                   	push   %eax
+    3bd1:	50                   	push   %eax
+    3bd2:	68 a5 68 00 00       	push   $0x68a5
+    3bd7:	6a 01                	push   $0x1
+    3bd9:	e8 b2 18 00 00       	call   5490 <printf>
+    exit();
+    3bde:	e8 40 17 00 00       	call   5323 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    3be3:	50                   	push   %eax
+    3be4:	50                   	push   %eax
+    3be5:	68 80 74 00 00       	push   $0x7480
+    3bea:	6a 01                	push   $0x1
+    3bec:	e8 9f 18 00 00       	call   5490 <printf>
+    exit();
+    3bf1:	e8 2d 17 00 00       	call   5323 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    3bf6:	52                   	push   %edx
+    3bf7:	52                   	push   %edx
+    3bf8:	68 30 74 00 00       	push   $0x7430
+    3bfd:	6a 01                	push   $0x1
+    3bff:	e8 8c 18 00 00       	call   5490 <printf>
+    exit();
+    3c04:	e8 1a 17 00 00       	call   5323 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    3c09:	51                   	push   %ecx
+    3c0a:	51                   	push   %ecx
+    3c0b:	68 f4 73 00 00       	push   $0x73f4
+    3c10:	6a 01                	push   $0x1
+    3c12:	e8 79 18 00 00       	call   5490 <printf>
+    exit();
+    3c17:	e8 07 17 00 00       	call   5323 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    3c1c:	51                   	push   %ecx
+    3c1d:	51                   	push   %ecx
+    3c1e:	68 84 73 00 00       	push   $0x7384
+    3c23:	6a 01                	push   $0x1
+    3c25:	e8 66 18 00 00       	call   5490 <printf>
+    exit();
+    3c2a:	e8 f4 16 00 00       	call   5323 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    3c2f:	50                   	push   %eax
+    3c30:	50                   	push   %eax
+    3c31:	68 24 73 00 00       	push   $0x7324
+    3c36:	6a 01                	push   $0x1
+    3c38:	e8 53 18 00 00       	call   5490 <printf>
+    exit();
+    3c3d:	e8 e1 16 00 00       	call   5323 <exit>
+    3c42:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3c49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003c50 <rmdot>:
+{
+    3c50:	55                   	push   %ebp
+    3c51:	89 e5                	mov    %esp,%ebp
+    3c53:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    3c56:	68 ed 68 00 00       	push   $0x68ed
+    3c5b:	6a 01                	push   $0x1
+    3c5d:	e8 2e 18 00 00       	call   5490 <printf>
+  if(mkdir("dots") != 0){
+    3c62:	c7 04 24 f9 68 00 00 	movl   $0x68f9,(%esp)
+    3c69:	e8 1d 17 00 00       	call   538b <mkdir>
+    3c6e:	83 c4 10             	add    $0x10,%esp
+    3c71:	85 c0                	test   %eax,%eax
+    3c73:	0f 85 b0 00 00 00    	jne    3d29 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    3c79:	83 ec 0c             	sub    $0xc,%esp
+    3c7c:	68 f9 68 00 00       	push   $0x68f9
+    3c81:	e8 0d 17 00 00       	call   5393 <chdir>
+    3c86:	83 c4 10             	add    $0x10,%esp
+    3c89:	85 c0                	test   %eax,%eax
+    3c8b:	0f 85 1d 01 00 00    	jne    3dae <rmdot+0x15e>
+  if(unlink(".") == 0){
+    3c91:	83 ec 0c             	sub    $0xc,%esp
+    3c94:	68 39 64 00 00       	push   $0x6439
+    3c99:	e8 d5 16 00 00       	call   5373 <unlink>
+    3c9e:	83 c4 10             	add    $0x10,%esp
+    3ca1:	85 c0                	test   %eax,%eax
+    3ca3:	0f 84 f2 00 00 00    	je     3d9b <rmdot+0x14b>
+  if(unlink("..") == 0){
+    3ca9:	83 ec 0c             	sub    $0xc,%esp
+    3cac:	68 38 64 00 00       	push   $0x6438
+    3cb1:	e8 bd 16 00 00       	call   5373 <unlink>
+    3cb6:	83 c4 10             	add    $0x10,%esp
+    3cb9:	85 c0                	test   %eax,%eax
+    3cbb:	0f 84 c7 00 00 00    	je     3d88 <rmdot+0x138>
+  if(chdir("/") != 0){
+    3cc1:	83 ec 0c             	sub    $0xc,%esp
+    3cc4:	68 01 58 00 00       	push   $0x5801
+    3cc9:	e8 c5 16 00 00       	call   5393 <chdir>
+    3cce:	83 c4 10             	add    $0x10,%esp
+    3cd1:	85 c0                	test   %eax,%eax
+    3cd3:	0f 85 9c 00 00 00    	jne    3d75 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    3cd9:	83 ec 0c             	sub    $0xc,%esp
+    3cdc:	68 41 69 00 00       	push   $0x6941
+    3ce1:	e8 8d 16 00 00       	call   5373 <unlink>
+    3ce6:	83 c4 10             	add    $0x10,%esp
+    3ce9:	85 c0                	test   %eax,%eax
+    3ceb:	74 75                	je     3d62 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    3ced:	83 ec 0c             	sub    $0xc,%esp
+    3cf0:	68 5f 69 00 00       	push   $0x695f
+    3cf5:	e8 79 16 00 00       	call   5373 <unlink>
+    3cfa:	83 c4 10             	add    $0x10,%esp
+    3cfd:	85 c0                	test   %eax,%eax
+    3cff:	74 4e                	je     3d4f <rmdot+0xff>
+  if(unlink("dots") != 0){
+    3d01:	83 ec 0c             	sub    $0xc,%esp
+    3d04:	68 f9 68 00 00       	push   $0x68f9
+    3d09:	e8 65 16 00 00       	call   5373 <unlink>
+    3d0e:	83 c4 10             	add    $0x10,%esp
+    3d11:	85 c0                	test   %eax,%eax
+    3d13:	75 27                	jne    3d3c <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    3d15:	83 ec 08             	sub    $0x8,%esp
+    3d18:	68 94 69 00 00       	push   $0x6994
+    3d1d:	6a 01                	push   $0x1
+    3d1f:	e8 6c 17 00 00       	call   5490 <printf>
+}
+    3d24:	83 c4 10             	add    $0x10,%esp
+    3d27:	c9                   	leave
+    3d28:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    3d29:	50                   	push   %eax
+    3d2a:	50                   	push   %eax
+    3d2b:	68 fe 68 00 00       	push   $0x68fe
+    3d30:	6a 01                	push   $0x1
+    3d32:	e8 59 17 00 00       	call   5490 <printf>
+    exit();
+    3d37:	e8 e7 15 00 00       	call   5323 <exit>
+    printf(1, "unlink dots failed!\n");
+    3d3c:	50                   	push   %eax
+    3d3d:	50                   	push   %eax
+    3d3e:	68 7f 69 00 00       	push   $0x697f
+    3d43:	6a 01                	push   $0x1
+    3d45:	e8 46 17 00 00       	call   5490 <printf>
+    exit();
+    3d4a:	e8 d4 15 00 00       	call   5323 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    3d4f:	52                   	push   %edx
+    3d50:	52                   	push   %edx
+    3d51:	68 67 69 00 00       	push   $0x6967
+    3d56:	6a 01                	push   $0x1
+    3d58:	e8 33 17 00 00       	call   5490 <printf>
+    exit();
+    3d5d:	e8 c1 15 00 00       	call   5323 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    3d62:	51                   	push   %ecx
+    3d63:	51                   	push   %ecx
+    3d64:	68 48 69 00 00       	push   $0x6948
+    3d69:	6a 01                	push   $0x1
+    3d6b:	e8 20 17 00 00       	call   5490 <printf>
+    exit();
+    3d70:	e8 ae 15 00 00       	call   5323 <exit>
+    printf(1, "chdir / failed\n");
+    3d75:	50                   	push   %eax
+    3d76:	50                   	push   %eax
+    3d77:	68 03 58 00 00       	push   $0x5803
+    3d7c:	6a 01                	push   $0x1
+    3d7e:	e8 0d 17 00 00       	call   5490 <printf>
+    exit();
+    3d83:	e8 9b 15 00 00       	call   5323 <exit>
+    printf(1, "rm .. worked!\n");
+    3d88:	50                   	push   %eax
+    3d89:	50                   	push   %eax
+    3d8a:	68 32 69 00 00       	push   $0x6932
+    3d8f:	6a 01                	push   $0x1
+    3d91:	e8 fa 16 00 00       	call   5490 <printf>
+    exit();
+    3d96:	e8 88 15 00 00       	call   5323 <exit>
+    printf(1, "rm . worked!\n");
+    3d9b:	50                   	push   %eax
+    3d9c:	50                   	push   %eax
+    3d9d:	68 24 69 00 00       	push   $0x6924
+    3da2:	6a 01                	push   $0x1
+    3da4:	e8 e7 16 00 00       	call   5490 <printf>
+    exit();
+    3da9:	e8 75 15 00 00       	call   5323 <exit>
+    printf(1, "chdir dots failed\n");
+    3dae:	50                   	push   %eax
+    3daf:	50                   	push   %eax
+    3db0:	68 11 69 00 00       	push   $0x6911
+    3db5:	6a 01                	push   $0x1
+    3db7:	e8 d4 16 00 00       	call   5490 <printf>
+    exit();
+    3dbc:	e8 62 15 00 00       	call   5323 <exit>
+    3dc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3dc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3dcf:	90                   	nop
+
+00003dd0 <dirfile>:
+{
+    3dd0:	55                   	push   %ebp
+    3dd1:	89 e5                	mov    %esp,%ebp
+    3dd3:	53                   	push   %ebx
+    3dd4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    3dd7:	68 9e 69 00 00       	push   $0x699e
+    3ddc:	6a 01                	push   $0x1
+    3dde:	e8 ad 16 00 00       	call   5490 <printf>
+  fd = open("dirfile", O_CREATE);
+    3de3:	5b                   	pop    %ebx
+    3de4:	58                   	pop    %eax
+    3de5:	68 00 02 00 00       	push   $0x200
+    3dea:	68 ab 69 00 00       	push   $0x69ab
+    3def:	e8 6f 15 00 00       	call   5363 <open>
+  if(fd < 0){
+    3df4:	83 c4 10             	add    $0x10,%esp
+    3df7:	85 c0                	test   %eax,%eax
+    3df9:	0f 88 43 01 00 00    	js     3f42 <dirfile+0x172>
+  close(fd);
+    3dff:	83 ec 0c             	sub    $0xc,%esp
+    3e02:	50                   	push   %eax
+    3e03:	e8 43 15 00 00       	call   534b <close>
+  if(chdir("dirfile") == 0){
+    3e08:	c7 04 24 ab 69 00 00 	movl   $0x69ab,(%esp)
+    3e0f:	e8 7f 15 00 00       	call   5393 <chdir>
+    3e14:	83 c4 10             	add    $0x10,%esp
+    3e17:	85 c0                	test   %eax,%eax
+    3e19:	0f 84 10 01 00 00    	je     3f2f <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    3e1f:	83 ec 08             	sub    $0x8,%esp
+    3e22:	6a 00                	push   $0x0
+    3e24:	68 e4 69 00 00       	push   $0x69e4
+    3e29:	e8 35 15 00 00       	call   5363 <open>
+  if(fd >= 0){
+    3e2e:	83 c4 10             	add    $0x10,%esp
+    3e31:	85 c0                	test   %eax,%eax
+    3e33:	0f 89 e3 00 00 00    	jns    3f1c <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    3e39:	83 ec 08             	sub    $0x8,%esp
+    3e3c:	68 00 02 00 00       	push   $0x200
+    3e41:	68 e4 69 00 00       	push   $0x69e4
+    3e46:	e8 18 15 00 00       	call   5363 <open>
+  if(fd >= 0){
+    3e4b:	83 c4 10             	add    $0x10,%esp
+    3e4e:	85 c0                	test   %eax,%eax
+    3e50:	0f 89 c6 00 00 00    	jns    3f1c <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    3e56:	83 ec 0c             	sub    $0xc,%esp
+    3e59:	68 e4 69 00 00       	push   $0x69e4
+    3e5e:	e8 28 15 00 00       	call   538b <mkdir>
+    3e63:	83 c4 10             	add    $0x10,%esp
+    3e66:	85 c0                	test   %eax,%eax
+    3e68:	0f 84 46 01 00 00    	je     3fb4 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    3e6e:	83 ec 0c             	sub    $0xc,%esp
+    3e71:	68 e4 69 00 00       	push   $0x69e4
+    3e76:	e8 f8 14 00 00       	call   5373 <unlink>
+    3e7b:	83 c4 10             	add    $0x10,%esp
+    3e7e:	85 c0                	test   %eax,%eax
+    3e80:	0f 84 1b 01 00 00    	je     3fa1 <dirfile+0x1d1>
+  if(link("README", "dirfile/xx") == 0){
+    3e86:	83 ec 08             	sub    $0x8,%esp
+    3e89:	68 e4 69 00 00       	push   $0x69e4
+    3e8e:	68 48 6a 00 00       	push   $0x6a48
+    3e93:	e8 eb 14 00 00       	call   5383 <link>
+    3e98:	83 c4 10             	add    $0x10,%esp
+    3e9b:	85 c0                	test   %eax,%eax
+    3e9d:	0f 84 eb 00 00 00    	je     3f8e <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    3ea3:	83 ec 0c             	sub    $0xc,%esp
+    3ea6:	68 ab 69 00 00       	push   $0x69ab
+    3eab:	e8 c3 14 00 00       	call   5373 <unlink>
+    3eb0:	83 c4 10             	add    $0x10,%esp
+    3eb3:	85 c0                	test   %eax,%eax
+    3eb5:	0f 85 c0 00 00 00    	jne    3f7b <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    3ebb:	83 ec 08             	sub    $0x8,%esp
+    3ebe:	6a 02                	push   $0x2
+    3ec0:	68 39 64 00 00       	push   $0x6439
+    3ec5:	e8 99 14 00 00       	call   5363 <open>
+  if(fd >= 0){
+    3eca:	83 c4 10             	add    $0x10,%esp
+    3ecd:	85 c0                	test   %eax,%eax
+    3ecf:	0f 89 93 00 00 00    	jns    3f68 <dirfile+0x198>
+  fd = open(".", 0);
+    3ed5:	83 ec 08             	sub    $0x8,%esp
+    3ed8:	6a 00                	push   $0x0
+    3eda:	68 39 64 00 00       	push   $0x6439
+    3edf:	e8 7f 14 00 00       	call   5363 <open>
+  if(write(fd, "x", 1) > 0){
+    3ee4:	83 c4 0c             	add    $0xc,%esp
+    3ee7:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    3ee9:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    3eeb:	68 58 62 00 00       	push   $0x6258
+    3ef0:	50                   	push   %eax
+    3ef1:	e8 4d 14 00 00       	call   5343 <write>
+    3ef6:	83 c4 10             	add    $0x10,%esp
+    3ef9:	85 c0                	test   %eax,%eax
+    3efb:	7f 58                	jg     3f55 <dirfile+0x185>
+  close(fd);
+    3efd:	83 ec 0c             	sub    $0xc,%esp
+    3f00:	53                   	push   %ebx
+    3f01:	e8 45 14 00 00       	call   534b <close>
+  printf(1, "dir vs file OK\n");
+    3f06:	58                   	pop    %eax
+    3f07:	5a                   	pop    %edx
+    3f08:	68 7b 6a 00 00       	push   $0x6a7b
+    3f0d:	6a 01                	push   $0x1
+    3f0f:	e8 7c 15 00 00       	call   5490 <printf>
+}
+    3f14:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3f17:	83 c4 10             	add    $0x10,%esp
+    3f1a:	c9                   	leave
+    3f1b:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    3f1c:	50                   	push   %eax
+    3f1d:	50                   	push   %eax
+    3f1e:	68 ef 69 00 00       	push   $0x69ef
+    3f23:	6a 01                	push   $0x1
+    3f25:	e8 66 15 00 00       	call   5490 <printf>
+    exit();
+    3f2a:	e8 f4 13 00 00       	call   5323 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    3f2f:	52                   	push   %edx
+    3f30:	52                   	push   %edx
+    3f31:	68 ca 69 00 00       	push   $0x69ca
+    3f36:	6a 01                	push   $0x1
+    3f38:	e8 53 15 00 00       	call   5490 <printf>
+    exit();
+    3f3d:	e8 e1 13 00 00       	call   5323 <exit>
+    printf(1, "create dirfile failed\n");
+    3f42:	51                   	push   %ecx
+    3f43:	51                   	push   %ecx
+    3f44:	68 b3 69 00 00       	push   $0x69b3
+    3f49:	6a 01                	push   $0x1
+    3f4b:	e8 40 15 00 00       	call   5490 <printf>
+    exit();
+    3f50:	e8 ce 13 00 00       	call   5323 <exit>
+    printf(1, "write . succeeded!\n");
+    3f55:	51                   	push   %ecx
+    3f56:	51                   	push   %ecx
+    3f57:	68 67 6a 00 00       	push   $0x6a67
+    3f5c:	6a 01                	push   $0x1
+    3f5e:	e8 2d 15 00 00       	call   5490 <printf>
+    exit();
+    3f63:	e8 bb 13 00 00       	call   5323 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    3f68:	53                   	push   %ebx
+    3f69:	53                   	push   %ebx
+    3f6a:	68 d4 74 00 00       	push   $0x74d4
+    3f6f:	6a 01                	push   $0x1
+    3f71:	e8 1a 15 00 00       	call   5490 <printf>
+    exit();
+    3f76:	e8 a8 13 00 00       	call   5323 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    3f7b:	50                   	push   %eax
+    3f7c:	50                   	push   %eax
+    3f7d:	68 4f 6a 00 00       	push   $0x6a4f
+    3f82:	6a 01                	push   $0x1
+    3f84:	e8 07 15 00 00       	call   5490 <printf>
+    exit();
+    3f89:	e8 95 13 00 00       	call   5323 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    3f8e:	50                   	push   %eax
+    3f8f:	50                   	push   %eax
+    3f90:	68 b4 74 00 00       	push   $0x74b4
+    3f95:	6a 01                	push   $0x1
+    3f97:	e8 f4 14 00 00       	call   5490 <printf>
+    exit();
+    3f9c:	e8 82 13 00 00       	call   5323 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    3fa1:	50                   	push   %eax
+    3fa2:	50                   	push   %eax
+    3fa3:	68 2a 6a 00 00       	push   $0x6a2a
+    3fa8:	6a 01                	push   $0x1
+    3faa:	e8 e1 14 00 00       	call   5490 <printf>
+    exit();
+    3faf:	e8 6f 13 00 00       	call   5323 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    3fb4:	50                   	push   %eax
+    3fb5:	50                   	push   %eax
+    3fb6:	68 0d 6a 00 00       	push   $0x6a0d
+    3fbb:	6a 01                	push   $0x1
+    3fbd:	e8 ce 14 00 00       	call   5490 <printf>
+    exit();
+    3fc2:	e8 5c 13 00 00       	call   5323 <exit>
+    3fc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3fce:	66 90                	xchg   %ax,%ax
+
+00003fd0 <manyinodes>:
+{
+    3fd0:	55                   	push   %ebp
+    3fd1:	89 e5                	mov    %esp,%ebp
+    3fd3:	57                   	push   %edi
+    3fd4:	56                   	push   %esi
+    3fd5:	53                   	push   %ebx
+    3fd6:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "manyinodes test\n");
+    3fd9:	68 8b 6a 00 00       	push   $0x6a8b
+    3fde:	6a 01                	push   $0x1
+    3fe0:	e8 ab 14 00 00       	call   5490 <printf>
+  if(mkdir("mi") != 0){
+    3fe5:	c7 04 24 9c 6a 00 00 	movl   $0x6a9c,(%esp)
+    3fec:	e8 9a 13 00 00       	call   538b <mkdir>
+    3ff1:	83 c4 10             	add    $0x10,%esp
+    3ff4:	85 c0                	test   %eax,%eax
+    3ff6:	0f 85 63 02 00 00    	jne    425f <manyinodes+0x28f>
+  if(pipe(held) != 0 || pipe(go) != 0){
+    3ffc:	83 ec 0c             	sub    $0xc,%esp
+    3fff:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    4002:	50                   	push   %eax
+    4003:	e8 2b 13 00 00       	call   5333 <pipe>
+    4008:	83 c4 10             	add    $0x10,%esp
+    400b:	85 c0                	test   %eax,%eax
+    400d:	0f 85 39 02 00 00    	jne    424c <manyinodes+0x27c>
+    4013:	83 ec 0c             	sub    $0xc,%esp
+    4016:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    4019:	50                   	push   %eax
+    401a:	e8 14 13 00 00       	call   5333 <pipe>
+    401f:	83 c4 10             	add    $0x10,%esp
+    4022:	89 c6                	mov    %eax,%esi
+    4024:	85 c0                	test   %eax,%eax
+    4026:	0f 85 20 02 00 00    	jne    424c <manyinodes+0x27c>
+  name[0] = 'm';
+    402c:	0f b7 05 3c 78 00 00 	movzwl 0x783c,%eax
+  name[2] = '/';
+    4033:	c6 45 e2 2f          	movb   $0x2f,-0x1e(%ebp)
+  for(i = 0; i < NCHILD; i++){
+    4037:	31 db                	xor    %ebx,%ebx
+  name[5] = '\0';
+    4039:	c6 45 e5 00          	movb   $0x0,-0x1b(%ebp)
+  name[0] = 'm';
+    403d:	66 89 45 e0          	mov    %ax,-0x20(%ebp)
+  for(i = 0; i < NCHILD; i++){
+    4041:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    pid = fork();
+    4048:	e8 ce 12 00 00       	call   531b <fork>
+    if(pid < 0){
+    404d:	85 c0                	test   %eax,%eax
+    404f:	0f 88 e3 01 00 00    	js     4238 <manyinodes+0x268>
+    if(pid == 0){
+    4055:	0f 84 0a 01 00 00    	je     4165 <manyinodes+0x195>
+  for(i = 0; i < NCHILD; i++){
+    405b:	83 c3 01             	add    $0x1,%ebx
+    405e:	83 fb 14             	cmp    $0x14,%ebx
+    4061:	75 e5                	jne    4048 <manyinodes+0x78>
+  close(held[1]);
+    4063:	83 ec 0c             	sub    $0xc,%esp
+    4066:	ff 75 d4             	push   -0x2c(%ebp)
+    4069:	e8 dd 12 00 00       	call   534b <close>
+  close(go[0]);
+    406e:	5f                   	pop    %edi
+    406f:	ff 75 d8             	push   -0x28(%ebp)
+    4072:	8d 7d cf             	lea    -0x31(%ebp),%edi
+    4075:	e8 d1 12 00 00       	call   534b <close>
+    407a:	83 c4 10             	add    $0x10,%esp
+    407d:	eb 09                	jmp    4088 <manyinodes+0xb8>
+    407f:	90                   	nop
+      nfail++;
+    4080:	83 c6 01             	add    $0x1,%esi
+  for(i = 0; i < NCHILD; i++){
+    4083:	83 eb 01             	sub    $0x1,%ebx
+    4086:	74 21                	je     40a9 <manyinodes+0xd9>
+    if(read(held[0], &c, 1) != 1 || c != 'x')
+    4088:	83 ec 04             	sub    $0x4,%esp
+    408b:	6a 01                	push   $0x1
+    408d:	57                   	push   %edi
+    408e:	ff 75 d0             	push   -0x30(%ebp)
+    4091:	e8 a5 12 00 00       	call   533b <read>
+    4096:	83 c4 10             	add    $0x10,%esp
+    4099:	83 f8 01             	cmp    $0x1,%eax
+    409c:	75 e2                	jne    4080 <manyinodes+0xb0>
+    409e:	80 7d cf 78          	cmpb   $0x78,-0x31(%ebp)
+    40a2:	75 dc                	jne    4080 <manyinodes+0xb0>
+  for(i = 0; i < NCHILD; i++){
+    40a4:	83 eb 01             	sub    $0x1,%ebx
+    40a7:	75 df                	jne    4088 <manyinodes+0xb8>
+  close(go[1]);
+    40a9:	83 ec 0c             	sub    $0xc,%esp
+    40ac:	ff 75 dc             	push   -0x24(%ebp)
+  close(held[0]);
+    40af:	bb 14 00 00 00       	mov    $0x14,%ebx
+  close(go[1]);
+    40b4:	e8 92 12 00 00       	call   534b <close>
+  close(held[0]);
+    40b9:	59                   	pop    %ecx
+    40ba:	ff 75 d0             	push   -0x30(%ebp)
+    40bd:	e8 89 12 00 00       	call   534b <close>
+    40c2:	83 c4 10             	add    $0x10,%esp
+    40c5:	8d 76 00             	lea    0x0(%esi),%esi
+    wait();
+    40c8:	e8 5e 12 00 00       	call   532b <wait>
+  for(i = 0; i < NCHILD; i++)
+    40cd:	83 eb 01             	sub    $0x1,%ebx
+    40d0:	75 f6                	jne    40c8 <manyinodes+0xf8>
+  if(nfail > 0){
+    40d2:	85 f6                	test   %esi,%esi
+    40d4:	0f 85 48 01 00 00    	jne    4222 <manyinodes+0x252>
+    40da:	bf 61 00 00 00       	mov    $0x61,%edi
+    40df:	8d 75 e0             	lea    -0x20(%ebp),%esi
+    40e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[3] = 'a' + i;
+    40e8:	bb 61 00 00 00       	mov    $0x61,%ebx
+    40ed:	8d 76 00             	lea    0x0(%esi),%esi
+      if((fd = open(name, 0)) < 0){
+    40f0:	83 ec 08             	sub    $0x8,%esp
+      name[3] = 'a' + i;
+    40f3:	89 f8                	mov    %edi,%eax
+      name[4] = 'a' + j;
+    40f5:	88 5d e4             	mov    %bl,-0x1c(%ebp)
+      name[3] = 'a' + i;
+    40f8:	88 45 e3             	mov    %al,-0x1d(%ebp)
+      if((fd = open(name, 0)) < 0){
+    40fb:	6a 00                	push   $0x0
+    40fd:	56                   	push   %esi
+    40fe:	e8 60 12 00 00       	call   5363 <open>
+    4103:	83 c4 10             	add    $0x10,%esp
+    4106:	85 c0                	test   %eax,%eax
+    4108:	0f 88 d8 00 00 00    	js     41e6 <manyinodes+0x216>
+      close(fd);
+    410e:	83 ec 0c             	sub    $0xc,%esp
+    for(j = 0; j < NOPEN; j++){
+    4111:	83 c3 01             	add    $0x1,%ebx
+      close(fd);
+    4114:	50                   	push   %eax
+    4115:	e8 31 12 00 00       	call   534b <close>
+      unlink(name);
+    411a:	89 34 24             	mov    %esi,(%esp)
+    411d:	e8 51 12 00 00       	call   5373 <unlink>
+    for(j = 0; j < NOPEN; j++){
+    4122:	83 c4 10             	add    $0x10,%esp
+    4125:	80 fb 6d             	cmp    $0x6d,%bl
+    4128:	75 c6                	jne    40f0 <manyinodes+0x120>
+  for(i = 0; i < NCHILD; i++){
+    412a:	83 c7 01             	add    $0x1,%edi
+    412d:	89 f8                	mov    %edi,%eax
+    412f:	3c 75                	cmp    $0x75,%al
+    4131:	75 b5                	jne    40e8 <manyinodes+0x118>
+  if(unlink("mi") != 0){
+    4133:	83 ec 0c             	sub    $0xc,%esp
+    4136:	68 9c 6a 00 00       	push   $0x6a9c
+    413b:	e8 33 12 00 00       	call   5373 <unlink>
+    4140:	83 c4 10             	add    $0x10,%esp
+    4143:	85 c0                	test   %eax,%eax
+    4145:	0f 85 27 01 00 00    	jne    4272 <manyinodes+0x2a2>
+  printf(1, "manyinodes ok\n");
+    414b:	83 ec 08             	sub    $0x8,%esp
+    414e:	68 fc 6a 00 00       	push   $0x6afc
+    4153:	6a 01                	push   $0x1
+    4155:	e8 36 13 00 00       	call   5490 <printf>
+}
+    415a:	83 c4 10             	add    $0x10,%esp
+    415d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4160:	5b                   	pop    %ebx
+    4161:	5e                   	pop    %esi
+    4162:	5f                   	pop    %edi
+    4163:	5d                   	pop    %ebp
+    4164:	c3                   	ret
+      close(held[0]);
+    4165:	83 ec 0c             	sub    $0xc,%esp
+    4168:	ff 75 d0             	push   -0x30(%ebp)
+        name[3] = 'a' + i;
+    416b:	83 c3 61             	add    $0x61,%ebx
+    416e:	bf 61 00 00 00       	mov    $0x61,%edi
+    4173:	8d 75 e0             	lea    -0x20(%ebp),%esi
+      close(held[0]);
+    4176:	e8 d0 11 00 00       	call   534b <close>
+      close(go[1]);
+    417b:	58                   	pop    %eax
+    417c:	ff 75 dc             	push   -0x24(%ebp)
+    417f:	e8 c7 11 00 00       	call   534b <close>
+      close(0);
+    4184:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    418b:	e8 bb 11 00 00       	call   534b <close>
+        name[3] = 'a' + i;
+    4190:	83 c4 10             	add    $0x10,%esp
+    4193:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4197:	90                   	nop
+        if(open(name, O_CREATE|O_RDWR) < 0){
+    4198:	83 ec 08             	sub    $0x8,%esp
+        name[4] = 'a' + j;
+    419b:	89 f8                	mov    %edi,%eax
+        name[3] = 'a' + i;
+    419d:	88 5d e3             	mov    %bl,-0x1d(%ebp)
+        name[4] = 'a' + j;
+    41a0:	88 45 e4             	mov    %al,-0x1c(%ebp)
+        if(open(name, O_CREATE|O_RDWR) < 0){
+    41a3:	68 02 02 00 00       	push   $0x202
+    41a8:	56                   	push   %esi
+    41a9:	e8 b5 11 00 00       	call   5363 <open>
+    41ae:	83 c4 10             	add    $0x10,%esp
+    41b1:	85 c0                	test   %eax,%eax
+    41b3:	78 46                	js     41fb <manyinodes+0x22b>
+      for(j = 0; j < NOPEN; j++){
+    41b5:	83 c7 01             	add    $0x1,%edi
+    41b8:	89 f8                	mov    %edi,%eax
+    41ba:	3c 6d                	cmp    $0x6d,%al
+    41bc:	75 da                	jne    4198 <manyinodes+0x1c8>
+      write(held[1], "x", 1);
+    41be:	83 ec 04             	sub    $0x4,%esp
+    41c1:	6a 01                	push   $0x1
+    41c3:	68 58 62 00 00       	push   $0x6258
+    41c8:	ff 75 d4             	push   -0x2c(%ebp)
+    41cb:	e8 73 11 00 00       	call   5343 <write>
+      read(go[0], &c, 1);
+    41d0:	83 c4 0c             	add    $0xc,%esp
+    41d3:	8d 45 cf             	lea    -0x31(%ebp),%eax
+    41d6:	6a 01                	push   $0x1
+    41d8:	50                   	push   %eax
+    41d9:	ff 75 d8             	push   -0x28(%ebp)
+    41dc:	e8 5a 11 00 00       	call   533b <read>
+      exit();
+    41e1:	e8 3d 11 00 00       	call   5323 <exit>
+        printf(1, "manyinodes: open %s failed\n", name);
+    41e6:	83 ec 04             	sub    $0x4,%esp
+    41e9:	56                   	push   %esi
+    41ea:	68 ce 6a 00 00       	push   $0x6ace
+    41ef:	6a 01                	push   $0x1
+    41f1:	e8 9a 12 00 00       	call   5490 <printf>
+        exit();
+    41f6:	e8 28 11 00 00       	call   5323 <exit>
+          printf(1, "manyinodes: create %s failed\n", name);
+    41fb:	83 ec 04             	sub    $0x4,%esp
+    41fe:	56                   	push   %esi
+    41ff:	68 b0 6a 00 00       	push   $0x6ab0
+    4204:	6a 01                	push   $0x1
+    4206:	e8 85 12 00 00       	call   5490 <printf>
+          write(held[1], "f", 1);
+    420b:	83 c4 0c             	add    $0xc,%esp
+    420e:	6a 01                	push   $0x1
+    4210:	68 36 60 00 00       	push   $0x6036
+    4215:	ff 75 d4             	push   -0x2c(%ebp)
+    4218:	e8 26 11 00 00       	call   5343 <write>
+          exit();
+    421d:	e8 01 11 00 00       	call   5323 <exit>
+    printf(1, "manyinodes: %d children failed\n", nfail);
+    4222:	52                   	push   %edx
+    4223:	56                   	push   %esi
+    4224:	68 f4 74 00 00       	push   $0x74f4
+    4229:	6a 01                	push   $0x1
+    422b:	e8 60 12 00 00       	call   5490 <printf>
+    exit();
+    4230:	e8 ee 10 00 00       	call   5323 <exit>
+    4235:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(1, "fork failed\n");
+    4238:	83 ec 08             	sub    $0x8,%esp
+    423b:	68 6f 6d 00 00       	push   $0x6d6f
+    4240:	6a 01                	push   $0x1
+    4242:	e8 49 12 00 00       	call   5490 <printf>
+      exit();
+    4247:	e8 d7 10 00 00       	call   5323 <exit>
+    printf(1, "pipe failed\n");
+    424c:	50                   	push   %eax
+    424d:	50                   	push   %eax
+    424e:	68 58 5c 00 00       	push   $0x5c58
+    4253:	6a 01                	push   $0x1
+    4255:	e8 36 12 00 00       	call   5490 <printf>
+    exit();
+    425a:	e8 c4 10 00 00       	call   5323 <exit>
+    printf(1, "mkdir mi failed\n");
+    425f:	50                   	push   %eax
+    4260:	50                   	push   %eax
+    4261:	68 9f 6a 00 00       	push   $0x6a9f
+    4266:	6a 01                	push   $0x1
+    4268:	e8 23 12 00 00       	call   5490 <printf>
+    exit();
+    426d:	e8 b1 10 00 00       	call   5323 <exit>
+    printf(1, "unlink mi failed\n");
+    4272:	50                   	push   %eax
+    4273:	50                   	push   %eax
+    4274:	68 ea 6a 00 00       	push   $0x6aea
+    4279:	6a 01                	push   $0x1
+    427b:	e8 10 12 00 00       	call   5490 <printf>
+    exit();
+    4280:	e8 9e 10 00 00       	call   5323 <exit>
+    4285:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    428c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004290 <iref>:
+{
+    4290:	55                   	push   %ebp
+    4291:	89 e5                	mov    %esp,%ebp
+    4293:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    4294:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    4299:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    429c:	68 0b 6b 00 00       	push   $0x6b0b
+    42a1:	6a 01                	push   $0x1
+    42a3:	e8 e8 11 00 00       	call   5490 <printf>
+    42a8:	83 c4 10             	add    $0x10,%esp
+    42ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    42af:	90                   	nop
+    if(mkdir("irefd") != 0){
+    42b0:	83 ec 0c             	sub    $0xc,%esp
+    42b3:	68 1c 6b 00 00       	push   $0x6b1c
+    42b8:	e8 ce 10 00 00       	call   538b <mkdir>
+    42bd:	83 c4 10             	add    $0x10,%esp
+    42c0:	85 c0                	test   %eax,%eax
+    42c2:	0f 85 bb 00 00 00    	jne    4383 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    42c8:	83 ec 0c             	sub    $0xc,%esp
+    42cb:	68 1c 6b 00 00       	push   $0x6b1c
+    42d0:	e8 be 10 00 00       	call   5393 <chdir>
+    42d5:	83 c4 10             	add    $0x10,%esp
+    42d8:	85 c0                	test   %eax,%eax
+    42da:	0f 85 b7 00 00 00    	jne    4397 <iref+0x107>
+    mkdir("");
+    42e0:	83 ec 0c             	sub    $0xc,%esp
+    42e3:	68 a1 5d 00 00       	push   $0x5da1
+    42e8:	e8 9e 10 00 00       	call   538b <mkdir>
+    link("README", "");
+    42ed:	59                   	pop    %ecx
+    42ee:	58                   	pop    %eax
+    42ef:	68 a1 5d 00 00       	push   $0x5da1
+    42f4:	68 48 6a 00 00       	push   $0x6a48
+    42f9:	e8 85 10 00 00       	call   5383 <link>
+    fd = open("", O_CREATE);
+    42fe:	58                   	pop    %eax
+    42ff:	5a                   	pop    %edx
+    4300:	68 00 02 00 00       	push   $0x200
+    4305:	68 a1 5d 00 00       	push   $0x5da1
+    430a:	e8 54 10 00 00       	call   5363 <open>
+    if(fd >= 0)
+    430f:	83 c4 10             	add    $0x10,%esp
+    4312:	85 c0                	test   %eax,%eax
+    4314:	78 0c                	js     4322 <iref+0x92>
+      close(fd);
+    4316:	83 ec 0c             	sub    $0xc,%esp
+    4319:	50                   	push   %eax
+    431a:	e8 2c 10 00 00       	call   534b <close>
+    431f:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    4322:	83 ec 08             	sub    $0x8,%esp
+    4325:	68 00 02 00 00       	push   $0x200
+    432a:	68 1b 65 00 00       	push   $0x651b
+    432f:	e8 2f 10 00 00       	call   5363 <open>
+    if(fd >= 0)
+    4334:	83 c4 10             	add    $0x10,%esp
+    4337:	85 c0                	test   %eax,%eax
+    4339:	78 0c                	js     4347 <iref+0xb7>
+      close(fd);
+    433b:	83 ec 0c             	sub    $0xc,%esp
+    433e:	50                   	push   %eax
+    433f:	e8 07 10 00 00       	call   534b <close>
+    4344:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    4347:	83 ec 0c             	sub    $0xc,%esp
+    434a:	68 1b 65 00 00       	push   $0x651b
+    434f:	e8 1f 10 00 00       	call   5373 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    4354:	83 c4 10             	add    $0x10,%esp
+    4357:	83 eb 01             	sub    $0x1,%ebx
+    435a:	0f 85 50 ff ff ff    	jne    42b0 <iref+0x20>
+  chdir("/");
+    4360:	83 ec 0c             	sub    $0xc,%esp
+    4363:	68 01 58 00 00       	push   $0x5801
+    4368:	e8 26 10 00 00       	call   5393 <chdir>
+  printf(1, "empty file name OK\n");
+    436d:	58                   	pop    %eax
+    436e:	5a                   	pop    %edx
+    436f:	68 4a 6b 00 00       	push   $0x6b4a
+    4374:	6a 01                	push   $0x1
+    4376:	e8 15 11 00 00       	call   5490 <printf>
+}
+    437b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    437e:	83 c4 10             	add    $0x10,%esp
+    4381:	c9                   	leave
+    4382:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    4383:	83 ec 08             	sub    $0x8,%esp
+    4386:	68 22 6b 00 00       	push   $0x6b22
+    438b:	6a 01                	push   $0x1
+    438d:	e8 fe 10 00 00       	call   5490 <printf>
+      exit();
+    4392:	e8 8c 0f 00 00       	call   5323 <exit>
+      printf(1, "chdir irefd failed\n");
+    4397:	83 ec 08             	sub    $0x8,%esp
+    439a:	68 36 6b 00 00       	push   $0x6b36
+    439f:	6a 01                	push   $0x1
+    43a1:	e8 ea 10 00 00       	call   5490 <printf>
+      exit();
+    43a6:	e8 78 0f 00 00       	call   5323 <exit>
+    43ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    43af:	90                   	nop
+
+000043b0 <forktest>:
+{
+    43b0:	55                   	push   %ebp
+    43b1:	89 e5                	mov    %esp,%ebp
+    43b3:	53                   	push   %ebx
+  for(n=0; n<1000; n++){
+    43b4:	31 db                	xor    %ebx,%ebx
+{
+    43b6:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    43b9:	68 5e 6b 00 00       	push   $0x6b5e
+    43be:	6a 01                	push   $0x1
+    43c0:	e8 cb 10 00 00       	call   5490 <printf>
+    43c5:	83 c4 10             	add    $0x10,%esp
+    43c8:	eb 13                	jmp    43dd <forktest+0x2d>
+    43ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    43d0:	74 4d                	je     441f <forktest+0x6f>
+  for(n=0; n<1000; n++){
+    43d2:	83 c3 01             	add    $0x1,%ebx
+    43d5:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    43db:	74 6e                	je     444b <forktest+0x9b>
+    pid = fork();
+    43dd:	e8 39 0f 00 00       	call   531b <fork>
+    if(pid < 0)
+    43e2:	85 c0                	test   %eax,%eax
+    43e4:	79 ea                	jns    43d0 <forktest+0x20>
+  for(; n > 0; n--){
+    43e6:	85 db                	test   %ebx,%ebx
+    43e8:	74 14                	je     43fe <forktest+0x4e>
+    43ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    43f0:	e8 36 0f 00 00       	call   532b <wait>
+    43f5:	85 c0                	test   %eax,%eax
+    43f7:	78 2b                	js     4424 <forktest+0x74>
+  for(; n > 0; n--){
+    43f9:	83 eb 01             	sub    $0x1,%ebx
+    43fc:	75 f2                	jne    43f0 <forktest+0x40>
+  if(wait() != -1){
+    43fe:	e8 28 0f 00 00       	call   532b <wait>
+    4403:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4406:	75 30                	jne    4438 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    4408:	83 ec 08             	sub    $0x8,%esp
+    440b:	68 90 6b 00 00       	push   $0x6b90
+    4410:	6a 01                	push   $0x1
+    4412:	e8 79 10 00 00       	call   5490 <printf>
+}
+    4417:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    441a:	83 c4 10             	add    $0x10,%esp
+    441d:	c9                   	leave
+    441e:	c3                   	ret
+      exit();
+    441f:	e8 ff 0e 00 00       	call   5323 <exit>
+      printf(1, "wait stopped early\n");
+    4424:	83 ec 08             	sub    $0x8,%esp
+    4427:	68 69 6b 00 00       	push   $0x6b69
+    442c:	6a 01                	push   $0x1
+    442e:	e8 5d 10 00 00       	call   5490 <printf>
+      exit();
+    4433:	e8 eb 0e 00 00       	call   5323 <exit>
+    printf(1, "wait got too many\n");
+    4438:	50                   	push   %eax
+    4439:	50                   	push   %eax
+    443a:	68 7d 6b 00 00       	push   $0x6b7d
+    443f:	6a 01                	push   $0x1
+    4441:	e8 4a 10 00 00       	call   5490 <printf>
+    exit();
+    4446:	e8 d8 0e 00 00       	call   5323 <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    444b:	52                   	push   %edx
+    444c:	52                   	push   %edx
+    444d:	68 14 75 00 00       	push   $0x7514
+    4452:	6a 01                	push   $0x1
+    4454:	e8 37 10 00 00       	call   5490 <printf>
+    exit();
+    4459:	e8 c5 0e 00 00       	call   5323 <exit>
+    445e:	66 90                	xchg   %ax,%ax
+
+00004460 <sbrktest>:
+{
+    4460:	55                   	push   %ebp
+    4461:	89 e5                	mov    %esp,%ebp
+    4463:	57                   	push   %edi
+    4464:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+    4465:	31 f6                	xor    %esi,%esi
+{
+    4467:	53                   	push   %ebx
+    4468:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    446b:	68 9e 6b 00 00       	push   $0x6b9e
+    4470:	ff 35 b0 83 00 00    	push   0x83b0
+    4476:	e8 15 10 00 00       	call   5490 <printf>
+  oldbrk = sbrk(0);
+    447b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    4482:	e8 24 0f 00 00       	call   53ab <sbrk>
+    4487:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    448a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    4491:	e8 15 0f 00 00       	call   53ab <sbrk>
+    4496:	83 c4 10             	add    $0x10,%esp
+    4499:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    449b:	eb 05                	jmp    44a2 <sbrktest+0x42>
+    449d:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+    44a0:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    44a2:	83 ec 0c             	sub    $0xc,%esp
+    44a5:	6a 01                	push   $0x1
+    44a7:	e8 ff 0e 00 00       	call   53ab <sbrk>
+    if(b != a){
+    44ac:	83 c4 10             	add    $0x10,%esp
+    44af:	39 d8                	cmp    %ebx,%eax
+    44b1:	0f 85 9c 02 00 00    	jne    4753 <sbrktest+0x2f3>
+  for(i = 0; i < 5000; i++){
+    44b7:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    44ba:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    44bd:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    44c0:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    44c6:	75 d8                	jne    44a0 <sbrktest+0x40>
+  pid = fork();
+    44c8:	e8 4e 0e 00 00       	call   531b <fork>
+    44cd:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    44cf:	85 c0                	test   %eax,%eax
+    44d1:	0f 88 02 03 00 00    	js     47d9 <sbrktest+0x379>
+  c = sbrk(1);
+    44d7:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    44da:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    44dd:	6a 01                	push   $0x1
+    44df:	e8 c7 0e 00 00       	call   53ab <sbrk>
+  c = sbrk(1);
+    44e4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    44eb:	e8 bb 0e 00 00       	call   53ab <sbrk>
+  if(c != a + 1){
+    44f0:	83 c4 10             	add    $0x10,%esp
+    44f3:	39 c3                	cmp    %eax,%ebx
+    44f5:	0f 85 3b 03 00 00    	jne    4836 <sbrktest+0x3d6>
+  if(pid == 0)
+    44fb:	85 f6                	test   %esi,%esi
+    44fd:	0f 84 2e 03 00 00    	je     4831 <sbrktest+0x3d1>
+  wait();
+    4503:	e8 23 0e 00 00       	call   532b <wait>
+  a = sbrk(0);
+    4508:	83 ec 0c             	sub    $0xc,%esp
+    450b:	6a 00                	push   $0x0
+    450d:	e8 99 0e 00 00       	call   53ab <sbrk>
+    4512:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    4514:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    4519:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    451b:	89 04 24             	mov    %eax,(%esp)
+    451e:	e8 88 0e 00 00       	call   53ab <sbrk>
+  if (p != a) {
+    4523:	83 c4 10             	add    $0x10,%esp
+    4526:	39 c3                	cmp    %eax,%ebx
+    4528:	0f 85 94 02 00 00    	jne    47c2 <sbrktest+0x362>
+  a = sbrk(0);
+    452e:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    4531:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    4538:	6a 00                	push   $0x0
+    453a:	e8 6c 0e 00 00       	call   53ab <sbrk>
+  c = sbrk(-4096);
+    453f:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    4546:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    4548:	e8 5e 0e 00 00       	call   53ab <sbrk>
+  if(c == (char*)0xffffffff){
+    454d:	83 c4 10             	add    $0x10,%esp
+    4550:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4553:	0f 84 22 03 00 00    	je     487b <sbrktest+0x41b>
+  c = sbrk(0);
+    4559:	83 ec 0c             	sub    $0xc,%esp
+    455c:	6a 00                	push   $0x0
+    455e:	e8 48 0e 00 00       	call   53ab <sbrk>
+  if(c != a - 4096){
+    4563:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    4569:	83 c4 10             	add    $0x10,%esp
+    456c:	39 d0                	cmp    %edx,%eax
+    456e:	0f 85 f0 02 00 00    	jne    4864 <sbrktest+0x404>
+  a = sbrk(0);
+    4574:	83 ec 0c             	sub    $0xc,%esp
+    4577:	6a 00                	push   $0x0
+    4579:	e8 2d 0e 00 00       	call   53ab <sbrk>
+  c = sbrk(4096);
+    457e:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    4585:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    4587:	e8 1f 0e 00 00       	call   53ab <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    458c:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    458f:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    4591:	39 c3                	cmp    %eax,%ebx
+    4593:	0f 85 b4 02 00 00    	jne    484d <sbrktest+0x3ed>
+    4599:	83 ec 0c             	sub    $0xc,%esp
+    459c:	6a 00                	push   $0x0
+    459e:	e8 08 0e 00 00       	call   53ab <sbrk>
+    45a3:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    45a9:	83 c4 10             	add    $0x10,%esp
+    45ac:	39 c2                	cmp    %eax,%edx
+    45ae:	0f 85 99 02 00 00    	jne    484d <sbrktest+0x3ed>
+  if(*lastaddr == 99){
+    45b4:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    45bb:	0f 84 2f 02 00 00    	je     47f0 <sbrktest+0x390>
+  a = sbrk(0);
+    45c1:	83 ec 0c             	sub    $0xc,%esp
+    45c4:	6a 00                	push   $0x0
+    45c6:	e8 e0 0d 00 00       	call   53ab <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    45cb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    45d2:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    45d4:	e8 d2 0d 00 00       	call   53ab <sbrk>
+    45d9:	89 c2                	mov    %eax,%edx
+    45db:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    45de:	29 d0                	sub    %edx,%eax
+    45e0:	89 04 24             	mov    %eax,(%esp)
+    45e3:	e8 c3 0d 00 00       	call   53ab <sbrk>
+  if(c != a){
+    45e8:	83 c4 10             	add    $0x10,%esp
+    45eb:	39 c3                	cmp    %eax,%ebx
+    45ed:	0f 85 b8 01 00 00    	jne    47ab <sbrktest+0x34b>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    45f3:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    45f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    45ff:	90                   	nop
+    ppid = getpid();
+    4600:	e8 9e 0d 00 00       	call   53a3 <getpid>
+    4605:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    4607:	e8 0f 0d 00 00       	call   531b <fork>
+    if(pid < 0){
+    460c:	85 c0                	test   %eax,%eax
+    460e:	0f 88 5d 01 00 00    	js     4771 <sbrktest+0x311>
+    if(pid == 0){
+    4614:	0f 84 6f 01 00 00    	je     4789 <sbrktest+0x329>
+    wait();
+    461a:	e8 0c 0d 00 00       	call   532b <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    461f:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    4625:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    462b:	75 d3                	jne    4600 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    462d:	83 ec 0c             	sub    $0xc,%esp
+    4630:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    4633:	50                   	push   %eax
+    4634:	e8 fa 0c 00 00       	call   5333 <pipe>
+    4639:	83 c4 10             	add    $0x10,%esp
+    463c:	85 c0                	test   %eax,%eax
+    463e:	0f 85 da 01 00 00    	jne    481e <sbrktest+0x3be>
+    4644:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    4647:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    464a:	89 df                	mov    %ebx,%edi
+    464c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    4650:	e8 c6 0c 00 00       	call   531b <fork>
+    4655:	89 07                	mov    %eax,(%edi)
+    4657:	85 c0                	test   %eax,%eax
+    4659:	0f 84 91 00 00 00    	je     46f0 <sbrktest+0x290>
+    if(pids[i] != -1)
+    465f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4662:	74 14                	je     4678 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    4664:	83 ec 04             	sub    $0x4,%esp
+    4667:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    466a:	6a 01                	push   $0x1
+    466c:	50                   	push   %eax
+    466d:	ff 75 b8             	push   -0x48(%ebp)
+    4670:	e8 c6 0c 00 00       	call   533b <read>
+    4675:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    4678:	83 c7 04             	add    $0x4,%edi
+    467b:	39 f7                	cmp    %esi,%edi
+    467d:	75 d1                	jne    4650 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    467f:	83 ec 0c             	sub    $0xc,%esp
+    4682:	68 00 10 00 00       	push   $0x1000
+    4687:	e8 1f 0d 00 00       	call   53ab <sbrk>
+    468c:	83 c4 10             	add    $0x10,%esp
+    468f:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    4691:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    4698:	8b 03                	mov    (%ebx),%eax
+    469a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    469d:	74 11                	je     46b0 <sbrktest+0x250>
+    kill(pids[i]);
+    469f:	83 ec 0c             	sub    $0xc,%esp
+    46a2:	50                   	push   %eax
+    46a3:	e8 ab 0c 00 00       	call   5353 <kill>
+    wait();
+    46a8:	e8 7e 0c 00 00       	call   532b <wait>
+    46ad:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    46b0:	83 c3 04             	add    $0x4,%ebx
+    46b3:	39 f3                	cmp    %esi,%ebx
+    46b5:	75 e1                	jne    4698 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    46b7:	83 ff ff             	cmp    $0xffffffff,%edi
+    46ba:	0f 84 47 01 00 00    	je     4807 <sbrktest+0x3a7>
+  if(sbrk(0) > oldbrk)
+    46c0:	83 ec 0c             	sub    $0xc,%esp
+    46c3:	6a 00                	push   $0x0
+    46c5:	e8 e1 0c 00 00       	call   53ab <sbrk>
+    46ca:	83 c4 10             	add    $0x10,%esp
+    46cd:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    46d0:	72 60                	jb     4732 <sbrktest+0x2d2>
+  printf(stdout, "sbrk test OK\n");
+    46d2:	83 ec 08             	sub    $0x8,%esp
+    46d5:	68 46 6c 00 00       	push   $0x6c46
+    46da:	ff 35 b0 83 00 00    	push   0x83b0
+    46e0:	e8 ab 0d 00 00       	call   5490 <printf>
+}
+    46e5:	83 c4 10             	add    $0x10,%esp
+    46e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    46eb:	5b                   	pop    %ebx
+    46ec:	5e                   	pop    %esi
+    46ed:	5f                   	pop    %edi
+    46ee:	5d                   	pop    %ebp
+    46ef:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    46f0:	83 ec 0c             	sub    $0xc,%esp
+    46f3:	6a 00                	push   $0x0
+    46f5:	e8 b1 0c 00 00       	call   53ab <sbrk>
+    46fa:	89 c2                	mov    %eax,%edx
+    46fc:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    4701:	29 d0                	sub    %edx,%eax
+    4703:	89 04 24             	mov    %eax,(%esp)
+    4706:	e8 a0 0c 00 00       	call   53ab <sbrk>
+      write(fds[1], "x", 1);
+    470b:	83 c4 0c             	add    $0xc,%esp
+    470e:	6a 01                	push   $0x1
+    4710:	68 58 62 00 00       	push   $0x6258
+    4715:	ff 75 bc             	push   -0x44(%ebp)
+    4718:	e8 26 0c 00 00       	call   5343 <write>
+    471d:	83 c4 10             	add    $0x10,%esp
+      for(;;) sleep(1000);
+    4720:	83 ec 0c             	sub    $0xc,%esp
+    4723:	68 e8 03 00 00       	push   $0x3e8
+    4728:	e8 86 0c 00 00       	call   53b3 <sleep>
+    472d:	83 c4 10             	add    $0x10,%esp
+    4730:	eb ee                	jmp    4720 <sbrktest+0x2c0>
+    sbrk(-(sbrk(0) - oldbrk));
+    4732:	83 ec 0c             	sub    $0xc,%esp
+    4735:	6a 00                	push   $0x0
+    4737:	e8 6f 0c 00 00       	call   53ab <sbrk>
+    473c:	89 c2                	mov    %eax,%edx
+    473e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    4741:	29 d0                	sub    %edx,%eax
+    4743:	89 04 24             	mov    %eax,(%esp)
+    4746:	e8 60 0c 00 00       	call   53ab <sbrk>
+    474b:	83 c4 10             	add    $0x10,%esp
+    474e:	e9 7f ff ff ff       	jmp    46d2 <sbrktest+0x272>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    4753:	83 ec 0c             	sub    $0xc,%esp
+    4756:	50                   	push   %eax
+    4757:	53                   	push   %ebx
+    4758:	56                   	push   %esi
+    4759:	68 a9 6b 00 00       	push   $0x6ba9
+    475e:	ff 35 b0 83 00 00    	push   0x83b0
+    4764:	e8 27 0d 00 00       	call   5490 <printf>
+      exit();
+    4769:	83 c4 20             	add    $0x20,%esp
+    476c:	e8 b2 0b 00 00       	call   5323 <exit>
+      printf(stdout, "fork failed\n");
+    4771:	83 ec 08             	sub    $0x8,%esp
+    4774:	68 6f 6d 00 00       	push   $0x6d6f
+    4779:	ff 35 b0 83 00 00    	push   0x83b0
+    477f:	e8 0c 0d 00 00       	call   5490 <printf>
+      exit();
+    4784:	e8 9a 0b 00 00       	call   5323 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    4789:	0f be 03             	movsbl (%ebx),%eax
+    478c:	50                   	push   %eax
+    478d:	53                   	push   %ebx
+    478e:	68 12 6c 00 00       	push   $0x6c12
+    4793:	ff 35 b0 83 00 00    	push   0x83b0
+    4799:	e8 f2 0c 00 00       	call   5490 <printf>
+      kill(ppid);
+    479e:	89 34 24             	mov    %esi,(%esp)
+    47a1:	e8 ad 0b 00 00       	call   5353 <kill>
+      exit();
+    47a6:	e8 78 0b 00 00       	call   5323 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    47ab:	50                   	push   %eax
+    47ac:	53                   	push   %ebx
+    47ad:	68 08 76 00 00       	push   $0x7608
+    47b2:	ff 35 b0 83 00 00    	push   0x83b0
+    47b8:	e8 d3 0c 00 00       	call   5490 <printf>
+    exit();
+    47bd:	e8 61 0b 00 00       	call   5323 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    47c2:	56                   	push   %esi
+    47c3:	56                   	push   %esi
+    47c4:	68 38 75 00 00       	push   $0x7538
+    47c9:	ff 35 b0 83 00 00    	push   0x83b0
+    47cf:	e8 bc 0c 00 00       	call   5490 <printf>
+    exit();
+    47d4:	e8 4a 0b 00 00       	call   5323 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    47d9:	50                   	push   %eax
+    47da:	50                   	push   %eax
+    47db:	68 c4 6b 00 00       	push   $0x6bc4
+    47e0:	ff 35 b0 83 00 00    	push   0x83b0
+    47e6:	e8 a5 0c 00 00       	call   5490 <printf>
+    exit();
+    47eb:	e8 33 0b 00 00       	call   5323 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    47f0:	51                   	push   %ecx
+    47f1:	51                   	push   %ecx
+    47f2:	68 d8 75 00 00       	push   $0x75d8
+    47f7:	ff 35 b0 83 00 00    	push   0x83b0
+    47fd:	e8 8e 0c 00 00       	call   5490 <printf>
+    exit();
+    4802:	e8 1c 0b 00 00       	call   5323 <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    4807:	50                   	push   %eax
+    4808:	50                   	push   %eax
+    4809:	68 2b 6c 00 00       	push   $0x6c2b
+    480e:	ff 35 b0 83 00 00    	push   0x83b0
+    4814:	e8 77 0c 00 00       	call   5490 <printf>
+    exit();
+    4819:	e8 05 0b 00 00       	call   5323 <exit>
+    printf(1, "pipe() failed\n");
+    481e:	52                   	push   %edx
+    481f:	52                   	push   %edx
+    4820:	68 e2 5a 00 00       	push   $0x5ae2
+    4825:	6a 01                	push   $0x1
+    4827:	e8 64 0c 00 00       	call   5490 <printf>
+    exit();
+    482c:	e8 f2 0a 00 00       	call   5323 <exit>
+    exit();
+    4831:	e8 ed 0a 00 00       	call   5323 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    4836:	57                   	push   %edi
+    4837:	57                   	push   %edi
+    4838:	68 db 6b 00 00       	push   $0x6bdb
+    483d:	ff 35 b0 83 00 00    	push   0x83b0
+    4843:	e8 48 0c 00 00       	call   5490 <printf>
+    exit();
+    4848:	e8 d6 0a 00 00       	call   5323 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    484d:	56                   	push   %esi
+    484e:	53                   	push   %ebx
+    484f:	68 b0 75 00 00       	push   $0x75b0
+    4854:	ff 35 b0 83 00 00    	push   0x83b0
+    485a:	e8 31 0c 00 00       	call   5490 <printf>
+    exit();
+    485f:	e8 bf 0a 00 00       	call   5323 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    4864:	50                   	push   %eax
+    4865:	53                   	push   %ebx
+    4866:	68 78 75 00 00       	push   $0x7578
+    486b:	ff 35 b0 83 00 00    	push   0x83b0
+    4871:	e8 1a 0c 00 00       	call   5490 <printf>
+    exit();
+    4876:	e8 a8 0a 00 00       	call   5323 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    487b:	53                   	push   %ebx
+    487c:	53                   	push   %ebx
+    487d:	68 f7 6b 00 00       	push   $0x6bf7
+    4882:	ff 35 b0 83 00 00    	push   0x83b0
+    4888:	e8 03 0c 00 00       	call   5490 <printf>
+    exit();
+    488d:	e8 91 0a 00 00       	call   5323 <exit>
+    4892:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4899:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000048a0 <cowtest>:
+{
+    48a0:	55                   	push   %ebp
+    48a1:	89 e5                	mov    %esp,%ebp
+    48a3:	57                   	push   %edi
+    48a4:	56                   	push   %esi
+    48a5:	53                   	push   %ebx
+    48a6:	83 ec 34             	sub    $0x34,%esp
+  printf(stdout, "cow test\n");
+    48a9:	68 54 6c 00 00       	push   $0x6c54
+    48ae:	ff 35 b0 83 00 00    	push   0x83b0
+    48b4:	e8 d7 0b 00 00       	call   5490 <printf>
+  a = sbrk(8*4096);
+    48b9:	c7 04 24 00 80 00 00 	movl   $0x8000,(%esp)
+    48c0:	e8 e6 0a 00 00       	call   53ab <sbrk>
+    48c5:	83 c4 10             	add    $0x10,%esp
+    48c8:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 8; i++)
+    48ca:	89 c3                	mov    %eax,%ebx
+    48cc:	8d b8 00 80 00 00    	lea    0x8000(%eax),%edi
+    48d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    a[i*4096] = 'p';
+    48d8:	c6 00 70             	movb   $0x70,(%eax)
+  for(i = 0; i < 8; i++)
+    48db:	05 00 10 00 00       	add    $0x1000,%eax
+    48e0:	39 f8                	cmp    %edi,%eax
+    48e2:	75 f4                	jne    48d8 <cowtest+0x38>
+  if(pipe(fds) != 0){
+    48e4:	83 ec 0c             	sub    $0xc,%esp
+    48e7:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    48ea:	50                   	push   %eax
+    48eb:	e8 43 0a 00 00       	call   5333 <pipe>
+    48f0:	83 c4 10             	add    $0x10,%esp
+    48f3:	85 c0                	test   %eax,%eax
+    48f5:	0f 85 5c 01 00 00    	jne    4a57 <cowtest+0x1b7>
+  ppid = getpid();
+    48fb:	e8 a3 0a 00 00       	call   53a3 <getpid>
+    4900:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  pid = fork();
+    4903:	e8 13 0a 00 00       	call   531b <fork>
+  if(pid < 0){
+    4908:	85 c0                	test   %eax,%eax
+    490a:	0f 88 30 01 00 00    	js     4a40 <cowtest+0x1a0>
+  if(pid == 0){
+    4910:	75 76                	jne    4988 <cowtest+0xe8>
+    4912:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(a[i*4096] != 'p'){
+    4918:	80 3b 70             	cmpb   $0x70,(%ebx)
+    491b:	0f 85 d0 00 00 00    	jne    49f1 <cowtest+0x151>
+      a[i*4096] = 'c';
+    4921:	c6 03 63             	movb   $0x63,(%ebx)
+    for(i = 0; i < 8; i++){
+    4924:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    492a:	39 fb                	cmp    %edi,%ebx
+    492c:	75 ea                	jne    4918 <cowtest+0x78>
+    write(fds[1], "k", 1);
+    492e:	83 ec 04             	sub    $0x4,%esp
+    4931:	6a 01                	push   $0x1
+    4933:	68 44 6d 00 00       	push   $0x6d44
+    4938:	ff 75 e4             	push   -0x1c(%ebp)
+    493b:	e8 03 0a 00 00       	call   5343 <write>
+    read(fds[0], a, 1);
+    4940:	83 c4 0c             	add    $0xc,%esp
+    4943:	6a 01                	push   $0x1
+    4945:	56                   	push   %esi
+    4946:	ff 75 e0             	push   -0x20(%ebp)
+    4949:	e8 ed 09 00 00       	call   533b <read>
+    if(a[0] != 'k'){
+    494e:	83 c4 10             	add    $0x10,%esp
+    4951:	80 3e 6b             	cmpb   $0x6b,(%esi)
+    4954:	75 0a                	jne    4960 <cowtest+0xc0>
+    exit();
+    4956:	e8 c8 09 00 00       	call   5323 <exit>
+    495b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    495f:	90                   	nop
+      printf(stdout, "cow test: read into cow page failed\n");
+    4960:	83 ec 08             	sub    $0x8,%esp
+    4963:	68 50 76 00 00       	push   $0x7650
+    4968:	ff 35 b0 83 00 00    	push   0x83b0
+    496e:	e8 1d 0b 00 00       	call   5490 <printf>
+      kill(ppid);
+    4973:	58                   	pop    %eax
+    4974:	ff 75 d4             	push   -0x2c(%ebp)
+    4977:	e8 d7 09 00 00       	call   5353 <kill>
+    497c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    497f:	e8 9f 09 00 00       	call   5323 <exit>
+    4984:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  a[0] = 'q';
+    4988:	c6 06 71             	movb   $0x71,(%esi)
+  wait();
+    498b:	e8 9b 09 00 00       	call   532b <wait>
+  close(fds[0]);
+    4990:	83 ec 0c             	sub    $0xc,%esp
+    4993:	ff 75 e0             	push   -0x20(%ebp)
+    4996:	e8 b0 09 00 00       	call   534b <close>
+  close(fds[1]);
+    499b:	58                   	pop    %eax
+    499c:	ff 75 e4             	push   -0x1c(%ebp)
+    499f:	e8 a7 09 00 00       	call   534b <close>
+  if(a[0] != 'q'){
+    49a4:	83 c4 10             	add    $0x10,%esp
+    49a7:	80 3e 71             	cmpb   $0x71,(%esi)
+    49aa:	75 7d                	jne    4a29 <cowtest+0x189>
+    49ac:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    49b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(a[i*4096] != 'p'){
+    49b8:	80 3e 70             	cmpb   $0x70,(%esi)
+    49bb:	75 55                	jne    4a12 <cowtest+0x172>
+  for(i = 1; i < 8; i++){
+    49bd:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    49c3:	39 fe                	cmp    %edi,%esi
+    49c5:	75 f1                	jne    49b8 <cowtest+0x118>
+  sbrk(-8*4096);
+    49c7:	83 ec 0c             	sub    $0xc,%esp
+    49ca:	68 00 80 ff ff       	push   $0xffff8000
+    49cf:	e8 d7 09 00 00       	call   53ab <sbrk>
+  printf(stdout, "cow test OK\n");
+    49d4:	58                   	pop    %eax
+    49d5:	5a                   	pop    %edx
+    49d6:	68 5e 6c 00 00       	push   $0x6c5e
+    49db:	ff 35 b0 83 00 00    	push   0x83b0
+    49e1:	e8 aa 0a 00 00       	call   5490 <printf>
+}
+    49e6:	83 c4 10             	add    $0x10,%esp
+    49e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    49ec:	5b                   	pop    %ebx
+    49ed:	5e                   	pop    %esi
+    49ee:	5f                   	pop    %edi
+    49ef:	5d                   	pop    %ebp
+    49f0:	c3                   	ret
+        printf(stdout, "cow test: child saw parent's write\n");
+    49f1:	83 ec 08             	sub    $0x8,%esp
+    49f4:	68 2c 76 00 00       	push   $0x762c
+    49f9:	ff 35 b0 83 00 00    	push   0x83b0
+    49ff:	e8 8c 0a 00 00       	call   5490 <printf>
+        kill(ppid);
+    4a04:	58                   	pop    %eax
+    4a05:	ff 75 d4             	push   -0x2c(%ebp)
+    4a08:	e8 46 09 00 00       	call   5353 <kill>
+        exit();
+    4a0d:	e8 11 09 00 00       	call   5323 <exit>
+      printf(stdout, "cow test: parent saw child's write\n");
+    4a12:	51                   	push   %ecx
+    4a13:	51                   	push   %ecx
+    4a14:	68 9c 76 00 00       	push   $0x769c
+    4a19:	ff 35 b0 83 00 00    	push   0x83b0
+    4a1f:	e8 6c 0a 00 00       	call   5490 <printf>
+      exit();
+    4a24:	e8 fa 08 00 00       	call   5323 <exit>
+    printf(stdout, "cow test: parent lost its write\n");
+    4a29:	53                   	push   %ebx
+    4a2a:	53                   	push   %ebx
+    4a2b:	68 78 76 00 00       	push   $0x7678
+    4a30:	ff 35 b0 83 00 00    	push   0x83b0
+    4a36:	e8 55 0a 00 00       	call   5490 <printf>
+    exit();
+    4a3b:	e8 e3 08 00 00       	call   5323 <exit>
+    printf(stdout, "fork failed\n");
+    4a40:	50                   	push   %eax
+    4a41:	50                   	push   %eax
+    4a42:	68 6f 6d 00 00       	push   $0x6d6f
+    4a47:	ff 35 b0 83 00 00    	push   0x83b0
+    4a4d:	e8 3e 0a 00 00       	call   5490 <printf>
+    exit();
+    4a52:	e8 cc 08 00 00       	call   5323 <exit>
+    printf(stdout, "pipe() failed\n");
+    4a57:	50                   	push   %eax
+    4a58:	50                   	push   %eax
+    4a59:	68 e2 5a 00 00       	push   $0x5ae2
+    4a5e:	ff 35 b0 83 00 00    	push   0x83b0
+    4a64:	e8 27 0a 00 00       	call   5490 <printf>
+    exit();
+    4a69:	e8 b5 08 00 00       	call   5323 <exit>
+    4a6e:	66 90                	xchg   %ax,%ax
+
+00004a70 <lazytest>:
+{
+    4a70:	55                   	push   %ebp
+    4a71:	89 e5                	mov    %esp,%ebp
+    4a73:	56                   	push   %esi
+    4a74:	53                   	push   %ebx
+  printf(stdout, "lazy test\n");
+    4a75:	83 ec 08             	sub    $0x8,%esp
+    4a78:	68 6b 6c 00 00       	push   $0x6c6b
+    4a7d:	ff 35 b0 83 00 00    	push   0x83b0
+    4a83:	e8 08 0a 00 00       	call   5490 <printf>
+  a = sbrk(sz);
+    4a88:	c7 04 24 00 00 00 04 	movl   $0x4000000,(%esp)
+    4a8f:	e8 17 09 00 00       	call   53ab <sbrk>
+  if(a == (char*)0xffffffff){
+    4a94:	83 c4 10             	add    $0x10,%esp
+    4a97:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4a9a:	0f 84 cc 00 00 00    	je     4b6c <lazytest+0xfc>
+  if(a[sz/2] != 0){
+    4aa0:	80 b8 00 00 00 02 00 	cmpb   $0x0,0x2000000(%eax)
+    4aa7:	89 c3                	mov    %eax,%ebx
+    4aa9:	0f 85 a6 00 00 00    	jne    4b55 <lazytest+0xe5>
+  fd = open("echo", 0);
+    4aaf:	83 ec 08             	sub    $0x8,%esp
+  a[sz-1] = 'x';
+    4ab2:	c6 80 ff ff ff 03 78 	movb   $0x78,0x3ffffff(%eax)
+  fd = open("echo", 0);
+    4ab9:	6a 00                	push   $0x0
+    4abb:	68 8e 58 00 00       	push   $0x588e
+    4ac0:	e8 9e 08 00 00       	call   5363 <open>
+  if(fd < 0 || read(fd, a + sz/4, 4) != 4){
+    4ac5:	83 c4 10             	add    $0x10,%esp
+  fd = open("echo", 0);
+    4ac8:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || read(fd, a + sz/4, 4) != 4){
+    4aca:	85 c0                	test   %eax,%eax
+    4acc:	78 70                	js     4b3e <lazytest+0xce>
+    4ace:	83 ec 04             	sub    $0x4,%esp
+    4ad1:	8d 83 00 00 00 01    	lea    0x1000000(%ebx),%eax
+    4ad7:	6a 04                	push   $0x4
+    4ad9:	50                   	push   %eax
+    4ada:	56                   	push   %esi
+    4adb:	e8 5b 08 00 00       	call   533b <read>
+    4ae0:	83 c4 10             	add    $0x10,%esp
+    4ae3:	83 f8 04             	cmp    $0x4,%eax
+    4ae6:	75 56                	jne    4b3e <lazytest+0xce>
+  close(fd);
+    4ae8:	83 ec 0c             	sub    $0xc,%esp
+    4aeb:	56                   	push   %esi
+    4aec:	e8 5a 08 00 00       	call   534b <close>
+  pid = fork();
+    4af1:	e8 25 08 00 00       	call   531b <fork>
+  if(pid < 0){
+    4af6:	83 c4 10             	add    $0x10,%esp
+    4af9:	85 c0                	test   %eax,%eax
+    4afb:	0f 88 c3 00 00 00    	js     4bc4 <lazytest+0x154>
+  if(pid == 0){
+    4b01:	0f 84 93 00 00 00    	je     4b9a <lazytest+0x12a>
+  wait();
+    4b07:	e8 1f 08 00 00       	call   532b <wait>
+  if(a[sz/8] != 0){
+    4b0c:	80 bb 00 00 80 00 00 	cmpb   $0x0,0x800000(%ebx)
+    4b13:	75 6e                	jne    4b83 <lazytest+0x113>
+  sbrk(-sz);
+    4b15:	83 ec 0c             	sub    $0xc,%esp
+    4b18:	68 00 00 00 fc       	push   $0xfc000000
+    4b1d:	e8 89 08 00 00       	call   53ab <sbrk>
+  printf(stdout, "lazy test OK\n");
+    4b22:	58                   	pop    %eax
+    4b23:	5a                   	pop    %edx
+    4b24:	68 c6 6c 00 00       	push   $0x6cc6
+    4b29:	ff 35 b0 83 00 00    	push   0x83b0
+    4b2f:	e8 5c 09 00 00       	call   5490 <printf>
+}
+    4b34:	83 c4 10             	add    $0x10,%esp
+    4b37:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    4b3a:	5b                   	pop    %ebx
+    4b3b:	5e                   	pop    %esi
+    4b3c:	5d                   	pop    %ebp
+    4b3d:	c3                   	ret
+    printf(stdout, "lazy test: read into lazy page failed\n");
+    4b3e:	50                   	push   %eax
+    4b3f:	50                   	push   %eax
+    4b40:	68 c0 76 00 00       	push   $0x76c0
+    4b45:	ff 35 b0 83 00 00    	push   0x83b0
+    4b4b:	e8 40 09 00 00       	call   5490 <printf>
+    exit();
+    4b50:	e8 ce 07 00 00       	call   5323 <exit>
+    printf(stdout, "lazy test: page not zeroed\n");
+    4b55:	50                   	push   %eax
+    4b56:	50                   	push   %eax
+    4b57:	68 8e 6c 00 00       	push   $0x6c8e
+    4b5c:	ff 35 b0 83 00 00    	push   0x83b0
+    4b62:	e8 29 09 00 00       	call   5490 <printf>
+    exit();
+    4b67:	e8 b7 07 00 00       	call   5323 <exit>
+    printf(stdout, "lazy test: sbrk failed\n");
+    4b6c:	50                   	push   %eax
+    4b6d:	50                   	push   %eax
+    4b6e:	68 76 6c 00 00       	push   $0x6c76
+    4b73:	ff 35 b0 83 00 00    	push   0x83b0
+    4b79:	e8 12 09 00 00       	call   5490 <printf>
+    exit();
+    4b7e:	e8 a0 07 00 00       	call   5323 <exit>
+    printf(stdout, "lazy test: parent saw child's page\n");
+    4b83:	51                   	push   %ecx
+    4b84:	51                   	push   %ecx
+    4b85:	68 e8 76 00 00       	push   $0x76e8
+    4b8a:	ff 35 b0 83 00 00    	push   0x83b0
+    4b90:	e8 fb 08 00 00       	call   5490 <printf>
+    exit();
+    4b95:	e8 89 07 00 00       	call   5323 <exit>
+    if(a[sz-1] != 'x')
+    4b9a:	80 bb ff ff ff 03 78 	cmpb   $0x78,0x3ffffff(%ebx)
+    a[sz/8] = 'c';
+    4ba1:	c6 83 00 00 80 00 63 	movb   $0x63,0x800000(%ebx)
+    if(a[sz-1] != 'x')
+    4ba8:	74 15                	je     4bbf <lazytest+0x14f>
+      printf(stdout, "lazy test: child lost data\n");
+    4baa:	53                   	push   %ebx
+    4bab:	53                   	push   %ebx
+    4bac:	68 aa 6c 00 00       	push   $0x6caa
+    4bb1:	ff 35 b0 83 00 00    	push   0x83b0
+    4bb7:	e8 d4 08 00 00       	call   5490 <printf>
+    4bbc:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4bbf:	e8 5f 07 00 00       	call   5323 <exit>
+    printf(stdout, "fork failed\n");
+    4bc4:	56                   	push   %esi
+    4bc5:	56                   	push   %esi
+    4bc6:	68 6f 6d 00 00       	push   $0x6d6f
+    4bcb:	ff 35 b0 83 00 00    	push   0x83b0
+    4bd1:	e8 ba 08 00 00       	call   5490 <printf>
+    exit();
+    4bd6:	e8 48 07 00 00       	call   5323 <exit>
+    4bdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4bdf:	90                   	nop
+
+00004be0 <validateint>:
+}
+    4be0:	c3                   	ret
+    4be1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4be8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4bef:	90                   	nop
+
+00004bf0 <validatetest>:
+{
+    4bf0:	55                   	push   %ebp
+    4bf1:	89 e5                	mov    %esp,%ebp
+    4bf3:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    4bf4:	31 f6                	xor    %esi,%esi
+{
+    4bf6:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    4bf7:	83 ec 08             	sub    $0x8,%esp
+    4bfa:	68 d4 6c 00 00       	push   $0x6cd4
+    4bff:	ff 35 b0 83 00 00    	push   0x83b0
+    4c05:	e8 86 08 00 00       	call   5490 <printf>
+    4c0a:	83 c4 10             	add    $0x10,%esp
+    4c0d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    4c10:	e8 06 07 00 00       	call   531b <fork>
+    4c15:	89 c3                	mov    %eax,%ebx
+    4c17:	85 c0                	test   %eax,%eax
+    4c19:	74 63                	je     4c7e <validatetest+0x8e>
+    sleep(0);
+    4c1b:	83 ec 0c             	sub    $0xc,%esp
+    4c1e:	6a 00                	push   $0x0
+    4c20:	e8 8e 07 00 00       	call   53b3 <sleep>
+    sleep(0);
+    4c25:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    4c2c:	e8 82 07 00 00       	call   53b3 <sleep>
+    kill(pid);
+    4c31:	89 1c 24             	mov    %ebx,(%esp)
+    4c34:	e8 1a 07 00 00       	call   5353 <kill>
+    wait();
+    4c39:	e8 ed 06 00 00       	call   532b <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    4c3e:	58                   	pop    %eax
+    4c3f:	5a                   	pop    %edx
+    4c40:	56                   	push   %esi
+    4c41:	68 e3 6c 00 00       	push   $0x6ce3
+    4c46:	e8 38 07 00 00       	call   5383 <link>
+    4c4b:	83 c4 10             	add    $0x10,%esp
+    4c4e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4c51:	75 30                	jne    4c83 <validatetest+0x93>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    4c53:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    4c59:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    4c5f:	75 af                	jne    4c10 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    4c61:	83 ec 08             	sub    $0x8,%esp
+    4c64:	68 07 6d 00 00       	push   $0x6d07
+    4c69:	ff 35 b0 83 00 00    	push   0x83b0
+    4c6f:	e8 1c 08 00 00       	call   5490 <printf>
+}
+    4c74:	83 c4 10             	add    $0x10,%esp
+    4c77:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    4c7a:	5b                   	pop    %ebx
+    4c7b:	5e                   	pop    %esi
+    4c7c:	5d                   	pop    %ebp
+    4c7d:	c3                   	ret
+      exit();
+    4c7e:	e8 a0 06 00 00       	call   5323 <exit>
+      printf(stdout, "link should not succeed\n");
+    4c83:	83 ec 08             	sub    $0x8,%esp
+    4c86:	68 ee 6c 00 00       	push   $0x6cee
+    4c8b:	ff 35 b0 83 00 00    	push   0x83b0
+    4c91:	e8 fa 07 00 00       	call   5490 <printf>
+      exit();
+    4c96:	e8 88 06 00 00       	call   5323 <exit>
+    4c9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4c9f:	90                   	nop
+
+00004ca0 <bsstest>:
+{
+    4ca0:	55                   	push   %ebp
+    4ca1:	89 e5                	mov    %esp,%ebp
+    4ca3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    4ca6:	68 14 6d 00 00       	push   $0x6d14
+    4cab:	ff 35 b0 83 00 00    	push   0x83b0
+    4cb1:	e8 da 07 00 00       	call   5490 <printf>
+    4cb6:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    4cb9:	31 c0                	xor    %eax,%eax
+    4cbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4cbf:	90                   	nop
+    if(uninit[i] != '\0'){
+    4cc0:	80 b8 e0 83 00 00 00 	cmpb   $0x0,0x83e0(%eax)
+    4cc7:	75 22                	jne    4ceb <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    4cc9:	83 c0 01             	add    $0x1,%eax
+    4ccc:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    4cd1:	75 ed                	jne    4cc0 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    4cd3:	83 ec 08             	sub    $0x8,%esp
+    4cd6:	68 2f 6d 00 00       	push   $0x6d2f
+    4cdb:	ff 35 b0 83 00 00    	push   0x83b0
+    4ce1:	e8 aa 07 00 00       	call   5490 <printf>
+}
+    4ce6:	83 c4 10             	add    $0x10,%esp
+    4ce9:	c9                   	leave
+    4cea:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    4ceb:	83 ec 08             	sub    $0x8,%esp
+    4cee:	68 1e 6d 00 00       	push   $0x6d1e
+    4cf3:	ff 35 b0 83 00 00    	push   0x83b0
+    4cf9:	e8 92 07 00 00       	call   5490 <printf>
+      exit();
+    4cfe:	e8 20 06 00 00       	call   5323 <exit>
+    4d03:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4d0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00004d10 <bigargtest>:
+{
+    4d10:	55                   	push   %ebp
+    4d11:	89 e5                	mov    %esp,%ebp
+    4d13:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    4d16:	68 3c 6d 00 00       	push   $0x6d3c
+    4d1b:	e8 53 06 00 00       	call   5373 <unlink>
+  pid = fork();
+    4d20:	e8 f6 05 00 00       	call   531b <fork>
+  if(pid == 0){
+    4d25:	83 c4 10             	add    $0x10,%esp
+    4d28:	85 c0                	test   %eax,%eax
+    4d2a:	74 44                	je     4d70 <bigargtest+0x60>
+  } else if(pid < 0){
+    4d2c:	0f 88 c3 00 00 00    	js     4df5 <bigargtest+0xe5>
+  wait();
+    4d32:	e8 f4 05 00 00       	call   532b <wait>
+  fd = open("bigarg-ok", 0);
+    4d37:	83 ec 08             	sub    $0x8,%esp
+    4d3a:	6a 00                	push   $0x0
+    4d3c:	68 3c 6d 00 00       	push   $0x6d3c
+    4d41:	e8 1d 06 00 00       	call   5363 <open>
+  if(fd < 0){
+    4d46:	83 c4 10             	add    $0x10,%esp
+    4d49:	85 c0                	test   %eax,%eax
+    4d4b:	0f 88 8d 00 00 00    	js     4dde <bigargtest+0xce>
+  close(fd);
+    4d51:	83 ec 0c             	sub    $0xc,%esp
+    4d54:	50                   	push   %eax
+    4d55:	e8 f1 05 00 00       	call   534b <close>
+  unlink("bigarg-ok");
+    4d5a:	c7 04 24 3c 6d 00 00 	movl   $0x6d3c,(%esp)
+    4d61:	e8 0d 06 00 00       	call   5373 <unlink>
+}
+    4d66:	83 c4 10             	add    $0x10,%esp
+    4d69:	c9                   	leave
+    4d6a:	c3                   	ret
+    4d6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4d6f:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    4d70:	c7 04 85 00 cb 00 00 	movl   $0x770c,0xcb00(,%eax,4)
+    4d77:	0c 77 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    4d7b:	83 c0 01             	add    $0x1,%eax
+    4d7e:	83 f8 1f             	cmp    $0x1f,%eax
+    4d81:	75 ed                	jne    4d70 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    4d83:	31 c9                	xor    %ecx,%ecx
+    4d85:	89 0d 7c cb 00 00    	mov    %ecx,0xcb7c
+    printf(stdout, "bigarg test\n");
+    4d8b:	50                   	push   %eax
+    4d8c:	50                   	push   %eax
+    4d8d:	68 46 6d 00 00       	push   $0x6d46
+    4d92:	ff 35 b0 83 00 00    	push   0x83b0
+    4d98:	e8 f3 06 00 00       	call   5490 <printf>
+    exec("echo", args);
+    4d9d:	58                   	pop    %eax
+    4d9e:	5a                   	pop    %edx
+    4d9f:	68 00 cb 00 00       	push   $0xcb00
+    4da4:	68 8e 58 00 00       	push   $0x588e
+    4da9:	e8 ad 05 00 00       	call   535b <exec>
+    printf(stdout, "bigarg test ok\n");
+    4dae:	59                   	pop    %ecx
+    4daf:	58                   	pop    %eax
+    4db0:	68 53 6d 00 00       	push   $0x6d53
+    4db5:	ff 35 b0 83 00 00    	push   0x83b0
+    4dbb:	e8 d0 06 00 00       	call   5490 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    4dc0:	58                   	pop    %eax
+    4dc1:	5a                   	pop    %edx
+    4dc2:	68 00 02 00 00       	push   $0x200
+    4dc7:	68 3c 6d 00 00       	push   $0x6d3c
+    4dcc:	e8 92 05 00 00       	call   5363 <open>
+    close(fd);
+    4dd1:	89 04 24             	mov    %eax,(%esp)
+    4dd4:	e8 72 05 00 00       	call   534b <close>
+    exit();
+    4dd9:	e8 45 05 00 00       	call   5323 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    4dde:	50                   	push   %eax
+    4ddf:	50                   	push   %eax
+    4de0:	68 7c 6d 00 00       	push   $0x6d7c
+    4de5:	ff 35 b0 83 00 00    	push   0x83b0
+    4deb:	e8 a0 06 00 00       	call   5490 <printf>
+    exit();
+    4df0:	e8 2e 05 00 00       	call   5323 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    4df5:	52                   	push   %edx
+    4df6:	52                   	push   %edx
+    4df7:	68 63 6d 00 00       	push   $0x6d63
+    4dfc:	ff 35 b0 83 00 00    	push   0x83b0
+    4e02:	e8 89 06 00 00       	call   5490 <printf>
+    exit();
+    4e07:	e8 17 05 00 00       	call   5323 <exit>
+    4e0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004e10 <fsfull>:
+{
+    4e10:	55                   	push   %ebp
+    4e11:	89 e5                	mov    %esp,%ebp
+    4e13:	57                   	push   %edi
+    4e14:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    4e15:	31 f6                	xor    %esi,%esi
+{
+    4e17:	53                   	push   %ebx
+    4e18:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    4e1b:	68 91 6d 00 00       	push   $0x6d91
+    4e20:	6a 01                	push   $0x1
+    4e22:	e8 69 06 00 00       	call   5490 <printf>
+    4e27:	83 c4 10             	add    $0x10,%esp
+    4e2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    4e30:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    4e35:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    4e3a:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    4e3d:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4e41:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    4e43:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4e47:	c1 ea 06             	shr    $0x6,%edx
+    4e4a:	8d 42 30             	lea    0x30(%edx),%eax
+    4e4d:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4e50:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    4e56:	89 f2                	mov    %esi,%edx
+    4e58:	29 c2                	sub    %eax,%edx
+    4e5a:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    4e5f:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    4e61:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4e66:	c1 ea 05             	shr    $0x5,%edx
+    4e69:	83 c2 30             	add    $0x30,%edx
+    4e6c:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    4e6f:	f7 e6                	mul    %esi
+    4e71:	c1 ea 05             	shr    $0x5,%edx
+    4e74:	6b c2 64             	imul   $0x64,%edx,%eax
+    4e77:	89 f2                	mov    %esi,%edx
+    4e79:	29 c2                	sub    %eax,%edx
+    4e7b:	89 d0                	mov    %edx,%eax
+    4e7d:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    4e7f:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    4e81:	c1 ea 03             	shr    $0x3,%edx
+    4e84:	83 c2 30             	add    $0x30,%edx
+    4e87:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    4e8a:	f7 e1                	mul    %ecx
+    4e8c:	89 f0                	mov    %esi,%eax
+    4e8e:	c1 ea 03             	shr    $0x3,%edx
+    4e91:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    4e94:	01 d2                	add    %edx,%edx
+    4e96:	29 d0                	sub    %edx,%eax
+    4e98:	83 c0 30             	add    $0x30,%eax
+    4e9b:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    4e9e:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    4ea1:	50                   	push   %eax
+    4ea2:	68 9e 6d 00 00       	push   $0x6d9e
+    4ea7:	6a 01                	push   $0x1
+    4ea9:	e8 e2 05 00 00       	call   5490 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    4eae:	58                   	pop    %eax
+    4eaf:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    4eb2:	5a                   	pop    %edx
+    4eb3:	68 02 02 00 00       	push   $0x202
+    4eb8:	50                   	push   %eax
+    4eb9:	e8 a5 04 00 00       	call   5363 <open>
+    if(fd < 0){
+    4ebe:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    4ec1:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    4ec3:	85 c0                	test   %eax,%eax
+    4ec5:	78 4f                	js     4f16 <fsfull+0x106>
+    int total = 0;
+    4ec7:	31 db                	xor    %ebx,%ebx
+    4ec9:	eb 07                	jmp    4ed2 <fsfull+0xc2>
+    4ecb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4ecf:	90                   	nop
+      total += cc;
+    4ed0:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    4ed2:	83 ec 04             	sub    $0x4,%esp
+    4ed5:	68 00 02 00 00       	push   $0x200
+    4eda:	68 00 ab 00 00       	push   $0xab00
+    4edf:	57                   	push   %edi
+    4ee0:	e8 5e 04 00 00       	call   5343 <write>
+      if(cc < 512)
+    4ee5:	83 c4 10             	add    $0x10,%esp
+    4ee8:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    4eed:	7f e1                	jg     4ed0 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    4eef:	83 ec 04             	sub    $0x4,%esp
+    4ef2:	53                   	push   %ebx
+    4ef3:	68 aa 6d 00 00       	push   $0x6daa
+    4ef8:	6a 01                	push   $0x1
+    4efa:	e8 91 05 00 00       	call   5490 <printf>
+    close(fd);
+    4eff:	89 3c 24             	mov    %edi,(%esp)
+    4f02:	e8 44 04 00 00       	call   534b <close>
+    if(total == 0)
+    4f07:	83 c4 10             	add    $0x10,%esp
+    4f0a:	85 db                	test   %ebx,%ebx
+    4f0c:	74 1e                	je     4f2c <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    4f0e:	83 c6 01             	add    $0x1,%esi
+    4f11:	e9 1a ff ff ff       	jmp    4e30 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    4f16:	83 ec 04             	sub    $0x4,%esp
+    4f19:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    4f1c:	50                   	push   %eax
+    4f1d:	68 91 62 00 00       	push   $0x6291
+    4f22:	6a 01                	push   $0x1
+    4f24:	e8 67 05 00 00       	call   5490 <printf>
+      break;
+    4f29:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    4f2c:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4f31:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    4f36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4f3d:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    4f40:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    4f42:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    4f45:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4f49:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    4f4b:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4f4f:	c1 ea 06             	shr    $0x6,%edx
+    4f52:	8d 42 30             	lea    0x30(%edx),%eax
+    4f55:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4f58:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    4f5e:	89 f2                	mov    %esi,%edx
+    4f60:	29 c2                	sub    %eax,%edx
+    4f62:	89 d0                	mov    %edx,%eax
+    4f64:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    4f66:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4f68:	c1 ea 05             	shr    $0x5,%edx
+    4f6b:	83 c2 30             	add    $0x30,%edx
+    4f6e:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    4f71:	f7 e3                	mul    %ebx
+    4f73:	c1 ea 05             	shr    $0x5,%edx
+    4f76:	6b ca 64             	imul   $0x64,%edx,%ecx
+    4f79:	89 f2                	mov    %esi,%edx
+    4f7b:	29 ca                	sub    %ecx,%edx
+    4f7d:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    4f82:	89 d0                	mov    %edx,%eax
+    4f84:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    4f86:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    4f88:	c1 ea 03             	shr    $0x3,%edx
+    4f8b:	83 c2 30             	add    $0x30,%edx
+    4f8e:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    4f91:	f7 e1                	mul    %ecx
+    4f93:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    4f95:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    4f98:	c1 ea 03             	shr    $0x3,%edx
+    4f9b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    4f9e:	01 d2                	add    %edx,%edx
+    4fa0:	29 d0                	sub    %edx,%eax
+    4fa2:	83 c0 30             	add    $0x30,%eax
+    4fa5:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    4fa8:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    4fab:	50                   	push   %eax
+    4fac:	e8 c2 03 00 00       	call   5373 <unlink>
+  while(nfiles >= 0){
+    4fb1:	83 c4 10             	add    $0x10,%esp
+    4fb4:	83 fe ff             	cmp    $0xffffffff,%esi
+    4fb7:	75 87                	jne    4f40 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    4fb9:	83 ec 08             	sub    $0x8,%esp
+    4fbc:	68 ba 6d 00 00       	push   $0x6dba
+    4fc1:	6a 01                	push   $0x1
+    4fc3:	e8 c8 04 00 00       	call   5490 <printf>
+}
+    4fc8:	83 c4 10             	add    $0x10,%esp
+    4fcb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4fce:	5b                   	pop    %ebx
+    4fcf:	5e                   	pop    %esi
+    4fd0:	5f                   	pop    %edi
+    4fd1:	5d                   	pop    %ebp
+    4fd2:	c3                   	ret
+    4fd3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4fda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00004fe0 <uio>:
+{
+    4fe0:	55                   	push   %ebp
+    4fe1:	89 e5                	mov    %esp,%ebp
+    4fe3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    4fe6:	68 d0 6d 00 00       	push   $0x6dd0
+    4feb:	6a 01                	push   $0x1
+    4fed:	e8 9e 04 00 00       	call   5490 <printf>
+  pid = fork();
+    4ff2:	e8 24 03 00 00       	call   531b <fork>
+  if(pid == 0){
+    4ff7:	83 c4 10             	add    $0x10,%esp
+    4ffa:	85 c0                	test   %eax,%eax
+    4ffc:	74 1b                	je     5019 <uio+0x39>
+  } else if(pid < 0){
+    4ffe:	78 3d                	js     503d <uio+0x5d>
+  wait();
+    5000:	e8 26 03 00 00       	call   532b <wait>
+  printf(1, "uio test done\n");
+    5005:	83 ec 08             	sub    $0x8,%esp
+    5008:	68 da 6d 00 00       	push   $0x6dda
+    500d:	6a 01                	push   $0x1
+    500f:	e8 7c 04 00 00       	call   5490 <printf>
+}
+    5014:	83 c4 10             	add    $0x10,%esp
+    5017:	c9                   	leave
+    5018:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    5019:	b8 09 00 00 00       	mov    $0x9,%eax
+    501e:	ba 70 00 00 00       	mov    $0x70,%edx
+    5023:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    5024:	ba 71 00 00 00       	mov    $0x71,%edx
+    5029:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    502a:	52                   	push   %edx
+    502b:	52                   	push   %edx
+    502c:	68 ec 77 00 00       	push   $0x77ec
+    5031:	6a 01                	push   $0x1
+    5033:	e8 58 04 00 00       	call   5490 <printf>
+    exit();
+    5038:	e8 e6 02 00 00       	call   5323 <exit>
+    printf (1, "fork failed\n");
+    503d:	50                   	push   %eax
+    503e:	50                   	push   %eax
+    503f:	68 6f 6d 00 00       	push   $0x6d6f
+    5044:	6a 01                	push   $0x1
+    5046:	e8 45 04 00 00       	call   5490 <printf>
+    exit();
+    504b:	e8 d3 02 00 00       	call   5323 <exit>
+
+00005050 <argptest>:
+{
+    5050:	55                   	push   %ebp
+    5051:	89 e5                	mov    %esp,%ebp
+    5053:	53                   	push   %ebx
+    5054:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    5057:	6a 00                	push   $0x0
+    5059:	68 e9 6d 00 00       	push   $0x6de9
+    505e:	e8 00 03 00 00       	call   5363 <open>
+  if (fd < 0) {
+    5063:	83 c4 10             	add    $0x10,%esp
+    5066:	85 c0                	test   %eax,%eax
+    5068:	78 39                	js     50a3 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    506a:	83 ec 0c             	sub    $0xc,%esp
+    506d:	89 c3                	mov    %eax,%ebx
+    506f:	6a 00                	push   $0x0
+    5071:	e8 35 03 00 00       	call   53ab <sbrk>
+    5076:	83 c4 0c             	add    $0xc,%esp
+    5079:	83 e8 01             	sub    $0x1,%eax
+    507c:	6a ff                	push   $0xffffffff
+    507e:	50                   	push   %eax
+    507f:	53                   	push   %ebx
+    5080:	e8 b6 02 00 00       	call   533b <read>
+  close(fd);
+    5085:	89 1c 24             	mov    %ebx,(%esp)
+    5088:	e8 be 02 00 00       	call   534b <close>
+  printf(1, "arg test passed\n");
+    508d:	58                   	pop    %eax
+    508e:	5a                   	pop    %edx
+    508f:	68 fb 6d 00 00       	push   $0x6dfb
+    5094:	6a 01                	push   $0x1
+    5096:	e8 f5 03 00 00       	call   5490 <printf>
+}
+    509b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    509e:	83 c4 10             	add    $0x10,%esp
+    50a1:	c9                   	leave
+    50a2:	c3                   	ret
+    printf(2, "open failed\n");
+    50a3:	51                   	push   %ecx
+    50a4:	51                   	push   %ecx
+    50a5:	68 ee 6d 00 00       	push   $0x6dee
+    50aa:	6a 02                	push   $0x2
+    50ac:	e8 df 03 00 00       	call   5490 <printf>
+    exit();
+    50b1:	e8 6d 02 00 00       	call   5323 <exit>
+    50b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    50bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000050c0 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    50c0:	69 05 ac 83 00 00 0d 	imul   $0x19660d,0x83ac,%eax
+    50c7:	66 19 00 
+    50ca:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    50cf:	a3 ac 83 00 00       	mov    %eax,0x83ac
+}
+    50d4:	c3                   	ret
+    50d5:	66 90                	xchg   %ax,%ax
+    50d7:	66 90                	xchg   %ax,%ax
+    50d9:	66 90                	xchg   %ax,%ax
+    50db:	66 90                	xchg   %ax,%ax
+    50dd:	66 90                	xchg   %ax,%ax
+    50df:	90                   	nop
+
+000050e0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+    50e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    50e1:	31 c0                	xor    %eax,%eax
+{
+    50e3:	89 e5                	mov    %esp,%ebp
+    50e5:	53                   	push   %ebx
+    50e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    50e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    50ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    50f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    50f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    50f7:	83 c0 01             	add    $0x1,%eax
+    50fa:	84 d2                	test   %dl,%dl
+    50fc:	75 f2                	jne    50f0 <strcpy+0x10>
+    ;
+  return os;
+}
+    50fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    5101:	89 c8                	mov    %ecx,%eax
+    5103:	c9                   	leave
+    5104:	c3                   	ret
+    5105:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    510c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00005110 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    5110:	55                   	push   %ebp
+    5111:	89 e5                	mov    %esp,%ebp
+    5113:	53                   	push   %ebx
+    5114:	8b 55 08             	mov    0x8(%ebp),%edx
+    5117:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    511a:	0f b6 02             	movzbl (%edx),%eax
+    511d:	84 c0                	test   %al,%al
+    511f:	75 17                	jne    5138 <strcmp+0x28>
+    5121:	eb 3a                	jmp    515d <strcmp+0x4d>
+    5123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    5127:	90                   	nop
+    5128:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    512c:	83 c2 01             	add    $0x1,%edx
+    512f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    5132:	84 c0                	test   %al,%al
+    5134:	74 1a                	je     5150 <strcmp+0x40>
+    p++, q++;
+    5136:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    5138:	0f b6 19             	movzbl (%ecx),%ebx
+    513b:	38 c3                	cmp    %al,%bl
+    513d:	74 e9                	je     5128 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    513f:	29 d8                	sub    %ebx,%eax
+}
+    5141:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    5144:	c9                   	leave
+    5145:	c3                   	ret
+    5146:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    514d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    5150:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    5154:	31 c0                	xor    %eax,%eax
+    5156:	29 d8                	sub    %ebx,%eax
+}
+    5158:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    515b:	c9                   	leave
+    515c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    515d:	0f b6 19             	movzbl (%ecx),%ebx
+    5160:	31 c0                	xor    %eax,%eax
+    5162:	eb db                	jmp    513f <strcmp+0x2f>
+    5164:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    516b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    516f:	90                   	nop
+
+00005170 <strlen>:
+
+uint
+strlen(char *s)
+{
+    5170:	55                   	push   %ebp
+    5171:	89 e5                	mov    %esp,%ebp
+    5173:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    5176:	80 3a 00             	cmpb   $0x0,(%edx)
+    5179:	74 15                	je     5190 <strlen+0x20>
+    517b:	31 c0                	xor    %eax,%eax
+    517d:	8d 76 00             	lea    0x0(%esi),%esi
+    5180:	83 c0 01             	add    $0x1,%eax
+    5183:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    5187:	89 c1                	mov    %eax,%ecx
+    5189:	75 f5                	jne    5180 <strlen+0x10>
+    ;
+  return n;
+}
+    518b:	89 c8                	mov    %ecx,%eax
+    518d:	5d                   	pop    %ebp
+    518e:	c3                   	ret
+    518f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    5190:	31 c9                	xor    %ecx,%ecx
+}
+    5192:	5d                   	pop    %ebp
+    5193:	89 c8                	mov    %ecx,%eax
+    5195:	c3                   	ret
+    5196:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    519d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000051a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    51a0:	55                   	push   %ebp
+    51a1:	89 e5                	mov    %esp,%ebp
+    51a3:	57                   	push   %edi
+    51a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    51a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    51aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+    51ad:	89 d7                	mov    %edx,%edi
+    51af:	fc                   	cld
+    51b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    51b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    51b5:	89 d0                	mov    %edx,%eax
+    51b7:	c9                   	leave
+    51b8:	c3                   	ret
+    51b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000051c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    51c0:	55                   	push   %ebp
+    51c1:	89 e5                	mov    %esp,%ebp
+    51c3:	8b 45 08             	mov    0x8(%ebp),%eax
+    51c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    51ca:	0f b6 10             	movzbl (%eax),%edx
+    51cd:	84 d2                	test   %dl,%dl
+    51cf:	75 12                	jne    51e3 <strchr+0x23>
+    51d1:	eb 1d                	jmp    51f0 <strchr+0x30>
+    51d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    51d7:	90                   	nop
+    51d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    51dc:	83 c0 01             	add    $0x1,%eax
+    51df:	84 d2                	test   %dl,%dl
+    51e1:	74 0d                	je     51f0 <strchr+0x30>
+    if(*s == c)
+    51e3:	38 d1                	cmp    %dl,%cl
+    51e5:	75 f1                	jne    51d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    51e7:	5d                   	pop    %ebp
+    51e8:	c3                   	ret
+    51e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    51f0:	31 c0                	xor    %eax,%eax
+}
+    51f2:	5d                   	pop    %ebp
+    51f3:	c3                   	ret
+    51f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    51fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    51ff:	90                   	nop
+
+00005200 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    5200:	55                   	push   %ebp
+    5201:	89 e5                	mov    %esp,%ebp
+    5203:	57                   	push   %edi
+    5204:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    5205:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    5208:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    5209:	31 db                	xor    %ebx,%ebx
+{
+    520b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    520e:	eb 27                	jmp    5237 <gets+0x37>
+    cc = read(0, &c, 1);
+    5210:	83 ec 04             	sub    $0x4,%esp
+    5213:	6a 01                	push   $0x1
+    5215:	56                   	push   %esi
+    5216:	6a 00                	push   $0x0
+    5218:	e8 1e 01 00 00       	call   533b <read>
+    if(cc < 1)
+    521d:	83 c4 10             	add    $0x10,%esp
+    5220:	85 c0                	test   %eax,%eax
+    5222:	7e 1d                	jle    5241 <gets+0x41>
+      break;
+    buf[i++] = c;
+    5224:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    5228:	8b 55 08             	mov    0x8(%ebp),%edx
+    522b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    522f:	3c 0a                	cmp    $0xa,%al
+    5231:	74 10                	je     5243 <gets+0x43>
+    5233:	3c 0d                	cmp    $0xd,%al
+    5235:	74 0c                	je     5243 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    5237:	89 df                	mov    %ebx,%edi
+    5239:	83 c3 01             	add    $0x1,%ebx
+    523c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    523f:	7c cf                	jl     5210 <gets+0x10>
+    5241:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    5243:	8b 45 08             	mov    0x8(%ebp),%eax
+    5246:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    524a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    524d:	5b                   	pop    %ebx
+    524e:	5e                   	pop    %esi
+    524f:	5f                   	pop    %edi
+    5250:	5d                   	pop    %ebp
+    5251:	c3                   	ret
+    5252:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00005260 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    5260:	55                   	push   %ebp
+    5261:	89 e5                	mov    %esp,%ebp
+    5263:	56                   	push   %esi
+    5264:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    5265:	83 ec 08             	sub    $0x8,%esp
+    5268:	6a 00                	push   $0x0
+    526a:	ff 75 08             	push   0x8(%ebp)
+    526d:	e8 f1 00 00 00       	call   5363 <open>
+  if(fd < 0)
+    5272:	83 c4 10             	add    $0x10,%esp
+    5275:	85 c0                	test   %eax,%eax
+    5277:	78 27                	js     52a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    5279:	83 ec 08             	sub    $0x8,%esp
+    527c:	ff 75 0c             	push   0xc(%ebp)
+    527f:	89 c3                	mov    %eax,%ebx
+    5281:	50                   	push   %eax
+    5282:	e8 f4 00 00 00       	call   537b <fstat>
+  close(fd);
+    5287:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    528a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    528c:	e8 ba 00 00 00       	call   534b <close>
+  return r;
+    5291:	83 c4 10             	add    $0x10,%esp
+}
+    5294:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    5297:	89 f0                	mov    %esi,%eax
+    5299:	5b                   	pop    %ebx
+    529a:	5e                   	pop    %esi
+    529b:	5d                   	pop    %ebp
+    529c:	c3                   	ret
+    529d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    52a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    52a5:	eb ed                	jmp    5294 <stat+0x34>
+    52a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    52ae:	66 90                	xchg   %ax,%ax
+
+000052b0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    52b0:	55                   	push   %ebp
+    52b1:	89 e5                	mov    %esp,%ebp
+    52b3:	53                   	push   %ebx
+    52b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    52b7:	0f be 02             	movsbl (%edx),%eax
+    52ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    52bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    52c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    52c5:	77 1e                	ja     52e5 <atoi+0x35>
+    52c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    52ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    52d0:	83 c2 01             	add    $0x1,%edx
+    52d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    52d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    52da:	0f be 02             	movsbl (%edx),%eax
+    52dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    52e0:	80 fb 09             	cmp    $0x9,%bl
+    52e3:	76 eb                	jbe    52d0 <atoi+0x20>
+  return n;
+}
+    52e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    52e8:	89 c8                	mov    %ecx,%eax
+    52ea:	c9                   	leave
+    52eb:	c3                   	ret
+    52ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000052f0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    52f0:	55                   	push   %ebp
+    52f1:	89 e5                	mov    %esp,%ebp
+    52f3:	57                   	push   %edi
+    52f4:	56                   	push   %esi
+    52f5:	8b 45 10             	mov    0x10(%ebp),%eax
+    52f8:	8b 55 08             	mov    0x8(%ebp),%edx
+    52fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    52fe:	85 c0                	test   %eax,%eax
+    5300:	7e 13                	jle    5315 <memmove+0x25>
+    5302:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    5304:	89 d7                	mov    %edx,%edi
+    5306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    530d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    5310:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    5311:	39 f8                	cmp    %edi,%eax
+    5313:	75 fb                	jne    5310 <memmove+0x20>
+  return vdst;
+}
+    5315:	5e                   	pop    %esi
+    5316:	89 d0                	mov    %edx,%eax
+    5318:	5f                   	pop    %edi
+    5319:	5d                   	pop    %ebp
+    531a:	c3                   	ret
+
+0000531b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    531b:	b8 01 00 00 00       	mov    $0x1,%eax
+    5320:	cd 40                	int    $0x40
+    5322:	c3                   	ret
+
+00005323 <exit>:
+SYSCALL(exit)
+    5323:	b8 02 00 00 00       	mov    $0x2,%eax
+    5328:	cd 40                	int    $0x40
+    532a:	c3                   	ret
+
+0000532b <wait>:
+SYSCALL(wait)
+    532b:	b8 03 00 00 00       	mov    $0x3,%eax
+    5330:	cd 40                	int    $0x40
+    5332:	c3                   	ret
+
+00005333 <pipe>:
+SYSCALL(pipe)
+    5333:	b8 04 00 00 00       	mov    $0x4,%eax
+    5338:	cd 40                	int    $0x40
+    533a:	c3                   	ret
+
+0000533b <read>:
+SYSCALL(read)
+    533b:	b8 05 00 00 00       	mov    $0x5,%eax
+    5340:	cd 40                	int    $0x40
+    5342:	c3                   	ret
+
+00005343 <write>:
+SYSCALL(write)
+    5343:	b8 10 00 00 00       	mov    $0x10,%eax
+    5348:	cd 40                	int    $0x40
+    534a:	c3                   	ret
+
+0000534b <close>:
+SYSCALL(close)
+    534b:	b8 15 00 00 00       	mov    $0x15,%eax
+    5350:	cd 40                	int    $0x40
+    5352:	c3                   	ret
+
+00005353 <kill>:
+SYSCALL(kill)
+    5353:	b8 06 00 00 00       	mov    $0x6,%eax
+    5358:	cd 40                	int    $0x40
+    535a:	c3                   	ret
+
+0000535b <exec>:
+SYSCALL(exec)
+    535b:	b8 07 00 00 00       	mov    $0x7,%eax
+    5360:	cd 40                	int    $0x40
+    5362:	c3                   	ret
+
+00005363 <open>:
+SYSCALL(open)
+    5363:	b8 0f 00 00 00       	mov    $0xf,%eax
+    5368:	cd 40                	int    $0x40
+    536a:	c3                   	ret
+
+0000536b <mknod>:
+SYSCALL(mknod)
+    536b:	b8 11 00 00 00       	mov    $0x11,%eax
+    5370:	cd 40                	int    $0x40
+    5372:	c3                   	ret
+
+00005373 <unlink>:
+SYSCALL(unlink)
+    5373:	b8 12 00 00 00       	mov    $0x12,%eax
+    5378:	cd 40                	int    $0x40
+    537a:	c3                   	ret
+
+0000537b <fstat>:
+SYSCALL(fstat)
+    537b:	b8 08 00 00 00       	mov    $0x8,%eax
+    5380:	cd 40                	int    $0x40
+    5382:	c3                   	ret
+
+00005383 <link>:
+SYSCALL(link)
+    5383:	b8 13 00 00 00       	mov    $0x13,%eax
+    5388:	cd 40                	int    $0x40
+    538a:	c3                   	ret
+
+0000538b <mkdir>:
+SYSCALL(mkdir)
+    538b:	b8 14 00 00 00       	mov    $0x14,%eax
+    5390:	cd 40                	int    $0x40
+    5392:	c3                   	ret
+
+00005393 <chdir>:
+SYSCALL(chdir)
+    5393:	b8 09 00 00 00       	mov    $0x9,%eax
+    5398:	cd 40                	int    $0x40
+    539a:	c3                   	ret
+
+0000539b <dup>:
+SYSCALL(dup)
+    539b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    53a0:	cd 40                	int    $0x40
+    53a2:	c3                   	ret
+
+000053a3 <getpid>:
+SYSCALL(getpid)
+    53a3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    53a8:	cd 40                	int    $0x40
+    53aa:	c3                   	ret
+
+000053ab <sbrk>:
+SYSCALL(sbrk)
+    53ab:	b8 0c 00 00 00       	mov    $0xc,%eax
+    53b0:	cd 40                	int    $0x40
+    53b2:	c3                   	ret
+
+000053b3 <sleep>:
+SYSCALL(sleep)
+    53b3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    53b8:	cd 40                	int    $0x40
+    53ba:	c3                   	ret
+
+000053bb <uptime>:
+SYSCALL(uptime)
+    53bb:	b8 0e 00 00 00       	mov    $0xe,%eax
+    53c0:	cd 40                	int    $0x40
+    53c2:	c3                   	ret
+
+000053c3 <getpstat>:
+SYSCALL(getpstat)
+    53c3:	b8 16 00 00 00       	mov    $0x16,%eax
+    53c8:	cd 40                	int    $0x40
+    53ca:	c3                   	ret
+
+000053cb <pipesize>:
+SYSCALL(pipesize)
+    53cb:	b8 17 00 00 00       	mov    $0x17,%eax
+    53d0:	cd 40                	int    $0x40
+    53d2:	c3                   	ret
+
+000053d3 <splice>:
+SYSCALL(splice)
+    53d3:	b8 18 00 00 00       	mov    $0x18,%eax
+    53d8:	cd 40                	int    $0x40
+    53da:	c3                   	ret
+
+000053db <copyrange>:
+SYSCALL(copyrange)
+    53db:	b8 19 00 00 00       	mov    $0x19,%eax
+    53e0:	cd 40                	int    $0x40
+    53e2:	c3                   	ret
+    53e3:	66 90                	xchg   %ax,%ax
+    53e5:	66 90                	xchg   %ax,%ax
+    53e7:	66 90                	xchg   %ax,%ax
+    53e9:	66 90                	xchg   %ax,%ax
+    53eb:	66 90                	xchg   %ax,%ax
+    53ed:	66 90                	xchg   %ax,%ax
+    53ef:	90                   	nop
+
+000053f0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    53f0:	55                   	push   %ebp
+    53f1:	89 e5                	mov    %esp,%ebp
+    53f3:	57                   	push   %edi
+    53f4:	56                   	push   %esi
+    53f5:	53                   	push   %ebx
+    53f6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    53f8:	89 d1                	mov    %edx,%ecx
+{
+    53fa:	83 ec 3c             	sub    $0x3c,%esp
+    53fd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    5400:	85 d2                	test   %edx,%edx
+    5402:	0f 89 80 00 00 00    	jns    5488 <printint+0x98>
+    5408:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    540c:	74 7a                	je     5488 <printint+0x98>
+    x = -xx;
+    540e:	f7 d9                	neg    %ecx
+    neg = 1;
+    5410:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    5415:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    5418:	31 f6                	xor    %esi,%esi
+    541a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    5420:	89 c8                	mov    %ecx,%eax
+    5422:	31 d2                	xor    %edx,%edx
+    5424:	89 f7                	mov    %esi,%edi
+    5426:	f7 f3                	div    %ebx
+    5428:	8d 76 01             	lea    0x1(%esi),%esi
+    542b:	0f b6 92 a0 78 00 00 	movzbl 0x78a0(%edx),%edx
+    5432:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    5436:	89 ca                	mov    %ecx,%edx
+    5438:	89 c1                	mov    %eax,%ecx
+    543a:	39 da                	cmp    %ebx,%edx
+    543c:	73 e2                	jae    5420 <printint+0x30>
+  if(neg)
+    543e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    5441:	85 c0                	test   %eax,%eax
+    5443:	74 07                	je     544c <printint+0x5c>
+    buf[i++] = '-';
+    5445:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    544a:	89 f7                	mov    %esi,%edi
+    544c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    544f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    5452:	01 df                	add    %ebx,%edi
+    5454:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    5458:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    545b:	83 ec 04             	sub    $0x4,%esp
+    545e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    5461:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    5464:	6a 01                	push   $0x1
+    5466:	50                   	push   %eax
+    5467:	56                   	push   %esi
+    5468:	e8 d6 fe ff ff       	call   5343 <write>
+  while(--i >= 0)
+    546d:	89 f8                	mov    %edi,%eax
+    546f:	83 c4 10             	add    $0x10,%esp
+    5472:	83 ef 01             	sub    $0x1,%edi
+    5475:	39 d8                	cmp    %ebx,%eax
+    5477:	75 df                	jne    5458 <printint+0x68>
+}
+    5479:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    547c:	5b                   	pop    %ebx
+    547d:	5e                   	pop    %esi
+    547e:	5f                   	pop    %edi
+    547f:	5d                   	pop    %ebp
+    5480:	c3                   	ret
+    5481:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    5488:	31 c0                	xor    %eax,%eax
+    548a:	eb 89                	jmp    5415 <printint+0x25>
+    548c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00005490 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    5490:	55                   	push   %ebp
+    5491:	89 e5                	mov    %esp,%ebp
+    5493:	57                   	push   %edi
+    5494:	56                   	push   %esi
+    5495:	53                   	push   %ebx
+    5496:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    5499:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    549c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    549f:	0f b6 1e             	movzbl (%esi),%ebx
+    54a2:	83 c6 01             	add    $0x1,%esi
+    54a5:	84 db                	test   %bl,%bl
+    54a7:	74 67                	je     5510 <printf+0x80>
+    54a9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    54ac:	31 d2                	xor    %edx,%edx
+    54ae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    54b1:	eb 34                	jmp    54e7 <printf+0x57>
+    54b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    54b7:	90                   	nop
+    54b8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    54bb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    54c0:	83 f8 25             	cmp    $0x25,%eax
+    54c3:	74 18                	je     54dd <printf+0x4d>
+  write(fd, &c, 1);
+    54c5:	83 ec 04             	sub    $0x4,%esp
+    54c8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    54cb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    54ce:	6a 01                	push   $0x1
+    54d0:	50                   	push   %eax
+    54d1:	57                   	push   %edi
+    54d2:	e8 6c fe ff ff       	call   5343 <write>
+    54d7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    54da:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    54dd:	0f b6 1e             	movzbl (%esi),%ebx
+    54e0:	83 c6 01             	add    $0x1,%esi
+    54e3:	84 db                	test   %bl,%bl
+    54e5:	74 29                	je     5510 <printf+0x80>
+    c = fmt[i] & 0xff;
+    54e7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    54ea:	85 d2                	test   %edx,%edx
+    54ec:	74 ca                	je     54b8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    54ee:	83 fa 25             	cmp    $0x25,%edx
+    54f1:	75 ea                	jne    54dd <printf+0x4d>
+      if(c == 'd'){
+    54f3:	83 f8 25             	cmp    $0x25,%eax
+    54f6:	0f 84 24 01 00 00    	je     5620 <printf+0x190>
+    54fc:	83 e8 63             	sub    $0x63,%eax
+    54ff:	83 f8 15             	cmp    $0x15,%eax
+    5502:	77 1c                	ja     5520 <printf+0x90>
+    5504:	ff 24 85 48 78 00 00 	jmp    *0x7848(,%eax,4)
+    550b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    550f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    5510:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5513:	5b                   	pop    %ebx
+    5514:	5e                   	pop    %esi
+    5515:	5f                   	pop    %edi
+    5516:	5d                   	pop    %ebp
+    5517:	c3                   	ret
+    5518:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    551f:	90                   	nop
+  write(fd, &c, 1);
+    5520:	83 ec 04             	sub    $0x4,%esp
+    5523:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    5526:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    552a:	6a 01                	push   $0x1
+    552c:	52                   	push   %edx
+    552d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    5530:	57                   	push   %edi
+    5531:	e8 0d fe ff ff       	call   5343 <write>
+    5536:	83 c4 0c             	add    $0xc,%esp
+    5539:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    553c:	6a 01                	push   $0x1
+    553e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    5541:	52                   	push   %edx
+    5542:	57                   	push   %edi
+    5543:	e8 fb fd ff ff       	call   5343 <write>
+        putc(fd, c);
+    5548:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    554b:	31 d2                	xor    %edx,%edx
+    554d:	eb 8e                	jmp    54dd <printf+0x4d>
+    554f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    5550:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    5553:	83 ec 0c             	sub    $0xc,%esp
+    5556:	b9 10 00 00 00       	mov    $0x10,%ecx
+    555b:	8b 13                	mov    (%ebx),%edx
+    555d:	6a 00                	push   $0x0
+    555f:	89 f8                	mov    %edi,%eax
+        ap++;
+    5561:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    5564:	e8 87 fe ff ff       	call   53f0 <printint>
+        ap++;
+    5569:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    556c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    556f:	31 d2                	xor    %edx,%edx
+    5571:	e9 67 ff ff ff       	jmp    54dd <printf+0x4d>
+    5576:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    557d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    5580:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    5583:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    5585:	83 c0 04             	add    $0x4,%eax
+    5588:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    558b:	85 db                	test   %ebx,%ebx
+    558d:	0f 84 9d 00 00 00    	je     5630 <printf+0x1a0>
+        while(*s != 0){
+    5593:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    5596:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    5598:	84 c0                	test   %al,%al
+    559a:	0f 84 3d ff ff ff    	je     54dd <printf+0x4d>
+    55a0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    55a3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    55a6:	89 de                	mov    %ebx,%esi
+    55a8:	89 d3                	mov    %edx,%ebx
+    55aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    55b0:	83 ec 04             	sub    $0x4,%esp
+    55b3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    55b6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    55b9:	6a 01                	push   $0x1
+    55bb:	53                   	push   %ebx
+    55bc:	57                   	push   %edi
+    55bd:	e8 81 fd ff ff       	call   5343 <write>
+        while(*s != 0){
+    55c2:	0f b6 06             	movzbl (%esi),%eax
+    55c5:	83 c4 10             	add    $0x10,%esp
+    55c8:	84 c0                	test   %al,%al
+    55ca:	75 e4                	jne    55b0 <printf+0x120>
+      state = 0;
+    55cc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    55cf:	31 d2                	xor    %edx,%edx
+    55d1:	e9 07 ff ff ff       	jmp    54dd <printf+0x4d>
+    55d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    55dd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    55e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    55e3:	83 ec 0c             	sub    $0xc,%esp
+    55e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    55eb:	8b 13                	mov    (%ebx),%edx
+    55ed:	6a 01                	push   $0x1
+    55ef:	e9 6b ff ff ff       	jmp    555f <printf+0xcf>
+    55f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    55f8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    55fb:	83 ec 04             	sub    $0x4,%esp
+    55fe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    5601:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    5603:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    5606:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    5609:	6a 01                	push   $0x1
+    560b:	52                   	push   %edx
+    560c:	57                   	push   %edi
+    560d:	e8 31 fd ff ff       	call   5343 <write>
+        ap++;
+    5612:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    5615:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    5618:	31 d2                	xor    %edx,%edx
+    561a:	e9 be fe ff ff       	jmp    54dd <printf+0x4d>
+    561f:	90                   	nop
+  write(fd, &c, 1);
+    5620:	83 ec 04             	sub    $0x4,%esp
+    5623:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    5626:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    5629:	6a 01                	push   $0x1
+    562b:	e9 11 ff ff ff       	jmp    5541 <printf+0xb1>
+    5630:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    5635:	bb 3e 78 00 00       	mov    $0x783e,%ebx
+    563a:	e9 61 ff ff ff       	jmp    55a0 <printf+0x110>
+    563f:	90                   	nop
+
+00005640 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    5640:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    5641:	a1 80 cb 00 00       	mov    0xcb80,%eax
+{
+    5646:	89 e5                	mov    %esp,%ebp
+    5648:	57                   	push   %edi
+    5649:	56                   	push   %esi
+    564a:	53                   	push   %ebx
+    564b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    564e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    5651:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5658:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    565a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    565c:	39 ca                	cmp    %ecx,%edx
+    565e:	73 30                	jae    5690 <free+0x50>
+    5660:	39 c1                	cmp    %eax,%ecx
+    5662:	72 04                	jb     5668 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    5664:	39 c2                	cmp    %eax,%edx
+    5666:	72 f0                	jb     5658 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    5668:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    566b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    566e:	39 f8                	cmp    %edi,%eax
+    5670:	74 2e                	je     56a0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    5672:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    5675:	8b 42 04             	mov    0x4(%edx),%eax
+    5678:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    567b:	39 f1                	cmp    %esi,%ecx
+    567d:	74 38                	je     56b7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    567f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    5681:	5b                   	pop    %ebx
+  freep = p;
+    5682:	89 15 80 cb 00 00    	mov    %edx,0xcb80
+}
+    5688:	5e                   	pop    %esi
+    5689:	5f                   	pop    %edi
+    568a:	5d                   	pop    %ebp
+    568b:	c3                   	ret
+    568c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    5690:	39 c1                	cmp    %eax,%ecx
+    5692:	72 d0                	jb     5664 <free+0x24>
+    5694:	eb c2                	jmp    5658 <free+0x18>
+    5696:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    569d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    56a0:	03 70 04             	add    0x4(%eax),%esi
+    56a3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    56a6:	8b 02                	mov    (%edx),%eax
+    56a8:	8b 00                	mov    (%eax),%eax
+    56aa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    56ad:	8b 42 04             	mov    0x4(%edx),%eax
+    56b0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    56b3:	39 f1                	cmp    %esi,%ecx
+    56b5:	75 c8                	jne    567f <free+0x3f>
+    p->s.size += bp->s.size;
+    56b7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    56ba:	89 15 80 cb 00 00    	mov    %edx,0xcb80
+    p->s.size += bp->s.size;
+    56c0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    56c3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    56c6:	89 0a                	mov    %ecx,(%edx)
+}
+    56c8:	5b                   	pop    %ebx
+    56c9:	5e                   	pop    %esi
+    56ca:	5f                   	pop    %edi
+    56cb:	5d                   	pop    %ebp
+    56cc:	c3                   	ret
+    56cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000056d0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    56d0:	55                   	push   %ebp
+    56d1:	89 e5                	mov    %esp,%ebp
+    56d3:	57                   	push   %edi
+    56d4:	56                   	push   %esi
+    56d5:	53                   	push   %ebx
+    56d6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    56d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    56dc:	8b 15 80 cb 00 00    	mov    0xcb80,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    56e2:	8d 78 07             	lea    0x7(%eax),%edi
+    56e5:	c1 ef 03             	shr    $0x3,%edi
+    56e8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    56eb:	85 d2                	test   %edx,%edx
+    56ed:	0f 84 8d 00 00 00    	je     5780 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    56f3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    56f5:	8b 48 04             	mov    0x4(%eax),%ecx
+    56f8:	39 f9                	cmp    %edi,%ecx
+    56fa:	73 64                	jae    5760 <malloc+0x90>
+  if(nu < 4096)
+    56fc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    5701:	39 df                	cmp    %ebx,%edi
+    5703:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    5706:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    570d:	eb 0a                	jmp    5719 <malloc+0x49>
+    570f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    5710:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    5712:	8b 48 04             	mov    0x4(%eax),%ecx
+    5715:	39 f9                	cmp    %edi,%ecx
+    5717:	73 47                	jae    5760 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    5719:	89 c2                	mov    %eax,%edx
+    571b:	39 05 80 cb 00 00    	cmp    %eax,0xcb80
+    5721:	75 ed                	jne    5710 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    5723:	83 ec 0c             	sub    $0xc,%esp
+    5726:	56                   	push   %esi
+    5727:	e8 7f fc ff ff       	call   53ab <sbrk>
+  if(p == (char*)-1)
+    572c:	83 c4 10             	add    $0x10,%esp
+    572f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    5732:	74 1c                	je     5750 <malloc+0x80>
+  hp->s.size = nu;
+    5734:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    5737:	83 ec 0c             	sub    $0xc,%esp
+    573a:	83 c0 08             	add    $0x8,%eax
+    573d:	50                   	push   %eax
+    573e:	e8 fd fe ff ff       	call   5640 <free>
+  return freep;
+    5743:	8b 15 80 cb 00 00    	mov    0xcb80,%edx
+      if((p = morecore(nunits)) == 0)
+    5749:	83 c4 10             	add    $0x10,%esp
+    574c:	85 d2                	test   %edx,%edx
+    574e:	75 c0                	jne    5710 <malloc+0x40>
+        return 0;
+  }
+}
+    5750:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    5753:	31 c0                	xor    %eax,%eax
+}
+    5755:	5b                   	pop    %ebx
+    5756:	5e                   	pop    %esi
+    5757:	5f                   	pop    %edi
+    5758:	5d                   	pop    %ebp
+    5759:	c3                   	ret
+    575a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    5760:	39 cf                	cmp    %ecx,%edi
+    5762:	74 4c                	je     57b0 <malloc+0xe0>
+        p->s.size -= nunits;
+    5764:	29 f9                	sub    %edi,%ecx
+    5766:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    5769:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    576c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    576f:	89 15 80 cb 00 00    	mov    %edx,0xcb80
+}
+    5775:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    5778:	83 c0 08             	add    $0x8,%eax
+}
+    577b:	5b                   	pop    %ebx
+    577c:	5e                   	pop    %esi
+    577d:	5f                   	pop    %edi
+    577e:	5d                   	pop    %ebp
+    577f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    5780:	c7 05 80 cb 00 00 84 	movl   $0xcb84,0xcb80
+    5787:	cb 00 00 
+    base.s.size = 0;
+    578a:	b8 84 cb 00 00       	mov    $0xcb84,%eax
+    base.s.ptr = freep = prevp = &base;
+    578f:	c7 05 84 cb 00 00 84 	movl   $0xcb84,0xcb84
+    5796:	cb 00 00 
+    base.s.size = 0;
+    5799:	c7 05 88 cb 00 00 00 	movl   $0x0,0xcb88
+    57a0:	00 00 00 
+    if(p->s.size >= nunits){
+    57a3:	e9 54 ff ff ff       	jmp    56fc <malloc+0x2c>
+    57a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    57af:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    57b0:	8b 08                	mov    (%eax),%ecx
+    57b2:	89 0a                	mov    %ecx,(%edx)
+    57b4:	eb b9                	jmp    576f <malloc+0x9f>
@@ -184,6 +184,9 @@ writetest(void)
   printf(stdout, "small file test ok\n");
 }
 
+// enough blocks to reach into the doubly-indirect tree
+#define BIGBLOCKS (NDIRECT + NINDIRECT + 2*NINDIRECT)
+
 void
 writetest1(void)
 {
@@ -197,7 +200,7 @@ writetest1(void)
     exit();
   }
 
-  for(i = 0; i < MAXFILE; i++){
+  for(i = 0; i < BIGBLOCKS; i++){
     ((int*)buf)[0] = i;
     if(write(fd, buf, 512) != 512){
       printf(stdout, "error: write big file failed\n", i);
@@ -217,7 +220,7 @@ writetest1(void)
   for(;;){
     i = read(fd, buf, 512);
     if(i == 0){
-      if(n == MAXFILE - 1){
+      if(n != BIGBLOCKS){
         printf(stdout, "read only %d blocks from big", n);
         exit();
       }
@@ -354,6 +357,189 @@ pipe1(void)
   printf(1, "pipe1 ok\n");
 }
 
+// a bigger pipe holds more before a writer blocks, and
+// keeps its data when resized
+void
+pipesizetest(void)
+{
+  int fds[2], i, n;
+
+  printf(1, "pipesize test\n");
+  if(pipe(fds) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  if(pipesize(fds[1], 3*4096) != 4*4096){
+    printf(1, "pipesize: bad size\n");
+    exit();
+  }
+  for(i = 0; i < 5; i++){
+    memset(buf, i, 3000);
+    if(write(fds[1], buf, 3000) != 3000){
+      printf(1, "pipesize: write failed\n");
+      exit();
+    }
+  }
+  if(pipesize(fds[0], 4096) >= 0){
+    printf(1, "pipesize: shrank below its data\n");
+    exit();
+  }
+  if(pipesize(fds[0], 8*4096) != 8*4096){
+    printf(1, "pipesize: grow failed\n");
+    exit();
+  }
+  close(fds[1]);
+  for(i = 0; i < 5; i++){
+    if((n = read(fds[0], buf, 3000)) != 3000 ||
+       buf[0] != i || buf[2999] != i){
+      printf(1, "pipesize: read %d bad\n", i);
+      exit();
+    }
+  }
+  if(read(fds[0], buf, 1) != 0){
+    printf(1, "pipesize: extra data\n");
+    exit();
+  }
+  close(fds[0]);
+  printf(1, "pipesize ok\n");
+}
+
+// splice a file into a pipe and the pipe back out to a file
+void
+splicetest(void)
+{
+  int fds[2], fds2[2], fd, fd2, i, n, pid, tot;
+
+  printf(1, "splice test\n");
+  unlink("splice.in");
+  unlink("splice.out");
+  fd = open("splice.in", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "splice: create failed\n");
+    exit();
+  }
+  for(i = 0; i < 10; i++){
+    memset(buf, 'a' + i, 1000);
+    if(write(fd, buf, 1000) != 1000){
+      printf(1, "splice: write failed\n");
+      exit();
+    }
+  }
+  close(fd);
+
+  if(pipe(fds) != 0 || pipe(fds2) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+
+  // exactly one side must be a pipe.
+  fd = open("splice.in", 0);
+  fd2 = open("splice.out", O_CREATE|O_RDWR);
+  if(fd < 0 || fd2 < 0 || write(fds2[1], "x", 1) != 1){
+    printf(1, "splice: setup failed\n");
+    exit();
+  }
+  if(splice(fd, fd2, 100) >= 0 || splice(fds2[0], fds[1], 100) >= 0){
+    printf(1, "splice: file to file or pipe to pipe accepted\n");
+    exit();
+  }
+  close(fd);
+  close(fd2);
+  close(fds2[0]);
+  close(fds2[1]);
+
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    close(fds[0]);
+    fd = open("splice.in", 0);
+    if(splice(fd, fds[0], 100) >= 0 || splice(fd, fd, 100) >= 0){
+      printf(1, "splice: bad fds accepted\n");
+      exit();
+    }
+    while((n = splice(fd, fds[1], 3000)) > 0)
+      ;
+    if(n < 0){
+      printf(1, "splice: file to pipe failed\n");
+      exit();
+    }
+    exit();
+  }
+  close(fds[1]);
+  fd = open("splice.out", O_CREATE|O_RDWR);
+  for(tot = 0; (n = splice(fds[0], fd, 10000)) > 0; tot += n)
+    ;
+  wait();
+  close(fds[0]);
+  close(fd);
+  if(n < 0 || tot != 10000){
+    printf(1, "splice: pipe to file moved %d\n", tot);
+    exit();
+  }
+
+  fd = open("splice.out", 0);
+  for(i = 0; i < 10; i++){
+    if(read(fd, buf, 1000) != 1000 || buf[0] != 'a' + i || buf[999] != 'a' + i){
+      printf(1, "splice: wrong data\n");
+      exit();
+    }
+  }
+  close(fd);
+  unlink("splice.in");
+  unlink("splice.out");
+  printf(1, "splice ok\n");
+}
+
+// copy a file with copyrange(), a part at a time
+void
+copyrangetest(void)
+{
+  int fd0, fd1, fds[2], i, n, tot;
+
+  printf(1, "copyrange test\n");
+  fd0 = open("cr.in", O_CREATE|O_RDWR);
+  for(i = 0; i < 20; i++){
+    memset(buf, 'a' + i, 1000);
+    if(write(fd0, buf, 1000) != 1000){
+      printf(1, "copyrange: write failed\n");
+      exit();
+    }
+  }
+  close(fd0);
+
+  fd0 = open("cr.in", O_RDONLY);
+  fd1 = open("cr.out", O_CREATE|O_RDWR);
+  if(pipe(fds) != 0 || copyrange(fd0, fds[1], 10) >= 0){
+    printf(1, "copyrange: copied to a pipe\n");
+    exit();
+  }
+  close(fds[0]);
+  close(fds[1]);
+  for(tot = 0; (n = copyrange(fd0, fd1, 3333)) > 0; tot += n)
+    ;
+  close(fd0);
+  close(fd1);
+  if(n < 0 || tot != 20000){
+    printf(1, "copyrange: copied %d\n", tot);
+    exit();
+  }
+
+  fd1 = open("cr.out", O_RDONLY);
+  for(i = 0; i < 20; i++){
+    if(read(fd1, buf, 1000) != 1000 || buf[0] != 'a' + i || buf[999] != 'a' + i){
+      printf(1, "copyrange: wrong data\n");
+      exit();
+    }
+  }
+  close(fd1);
+  unlink("cr.in");
+  unlink("cr.out");
+  printf(1, "copyrange ok\n");
+}
+
 // meant to be run w/ at most two CPUs
 void
 preempt(void)
@@ -760,6 +946,123 @@ linktest(void)
   printf(1, "linktest ok\n");
 }
 
+// test lookups in one directory running alongside each other
+// and alongside creates and unlinks in that directory
+void
+conlookup(void)
+{
+  int i, j, pid, fd;
+
+  printf(1, "conlookup test\n");
+
+  if(mkdir("cl") != 0){
+    printf(1, "mkdir cl failed\n");
+    exit();
+  }
+  fd = open("cl/f", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "create cl/f failed\n");
+    exit();
+  }
+  close(fd);
+
+  for(i = 0; i < 4; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(1, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      for(j = 0; j < 200; j++){
+        if(i == 0){
+          // The writer: churn another name in cl.
+          fd = open("cl/g", O_CREATE|O_RDWR);
+          if(fd < 0){
+            printf(1, "create cl/g failed\n");
+            exit();
+          }
+          close(fd);
+          unlink("cl/g");
+        }
+        fd = open("/cl/../cl/./f", 0);
+        if(fd < 0){
+          printf(1, "conlookup: open cl/f failed\n");
+          exit();
+        }
+        close(fd);
+        if(open("cl/none", 0) >= 0){
+          printf(1, "conlookup: opened cl/none\n");
+          exit();
+        }
+      }
+      exit();
+    }
+  }
+  for(i = 0; i < 4; i++)
+    wait();
+
+  unlink("cl/g");
+  if(unlink("cl/f") != 0 || unlink("cl") != 0){
+    printf(1, "unlink cl failed\n");
+    exit();
+  }
+  printf(1, "conlookup ok\n");
+}
+
+// test that the directory name cache forgets names that
+// are created and removed, including in a directory whose
+// inode is then reused
+void
+dcachetest(void)
+{
+  int i, fd;
+
+  printf(1, "dcache test\n");
+
+  for(i = 0; i < 3; i++){
+    if(open("dc/f", 0) >= 0 || open("dc", 0) >= 0){
+      printf(1, "dcache: dc exists before mkdir\n");
+      exit();
+    }
+    if(mkdir("dc") != 0){
+      printf(1, "dcache: mkdir dc failed\n");
+      exit();
+    }
+    if(open("dc/f", 0) >= 0){
+      printf(1, "dcache: dc/f exists before create\n");
+      exit();
+    }
+    fd = open("dc/f", O_CREATE|O_RDWR);
+    if(fd < 0){
+      printf(1, "dcache: create dc/f failed\n");
+      exit();
+    }
+    close(fd);
+    if(link("dc/f", "dc/g") != 0){
+      printf(1, "dcache: link dc/g failed\n");
+      exit();
+    }
+    if((fd = open("dc/g", 0)) < 0){
+      printf(1, "dcache: open dc/g failed\n");
+      exit();
+    }
+    close(fd);
+    if(unlink("dc/f") != 0 || unlink("dc/g") != 0){
+      printf(1, "dcache: unlink failed\n");
+      exit();
+    }
+    if(open("dc/f", 0) >= 0 || open("dc/g", 0) >= 0){
+      printf(1, "dcache: unlinked name still there\n");
+      exit();
+    }
+    if(unlink("dc") != 0){
+      printf(1, "dcache: unlink dc failed\n");
+      exit();
+    }
+  }
+  printf(1, "dcache ok\n");
+}
+
 // test concurrent create/link/unlink of the same file
 void
 concreate(void)
@@ -931,6 +1234,67 @@ bigdir(void)
   printf(1, "bigdir ok\n");
 }
 
+// directory big enough to be indexed: lookups, and removal
+// only once it is empty again
+void
+indexdir(void)
+{
+  int i, fd;
+  char name[8];
+
+  printf(1, "indexdir test\n");
+
+  if(mkdir("ix") != 0){
+    printf(1, "mkdir ix failed\n");
+    exit();
+  }
+  name[0] = 'i';
+  name[1] = 'x';
+  name[2] = '/';
+  name[5] = '\0';
+  for(i = 0; i < 400; i++){
+    name[3] = 'a' + i/20;
+    name[4] = 'a' + i%20;
+    fd = open(name, O_CREATE|O_RDWR);
+    if(fd < 0){
+      printf(1, "indexdir: create %s failed\n", name);
+      exit();
+    }
+    close(fd);
+  }
+  for(i = 0; i < 400; i++){
+    name[3] = 'a' + i/20;
+    name[4] = 'a' + i%20;
+    if((fd = open(name, 0)) < 0){
+      printf(1, "indexdir: open %s failed\n", name);
+      exit();
+    }
+    close(fd);
+  }
+  if(open("ix/zz", 0) >= 0 || chdir("ix/..") != 0 || chdir("ix/.") != 0){
+    printf(1, "indexdir: bad lookup\n");
+    exit();
+  }
+  chdir("/");
+  for(i = 0; i < 400; i++){
+    if(unlink("ix") == 0){
+      printf(1, "indexdir: removed non-empty ix\n");
+      exit();
+    }
+    name[3] = 'a' + i/20;
+    name[4] = 'a' + i%20;
+    if(unlink(name) != 0){
+      printf(1, "indexdir: unlink %s failed\n", name);
+      exit();
+    }
+  }
+  if(unlink("ix") != 0){
+    printf(1, "indexdir: unlink ix failed\n");
+    exit();
+  }
+  printf(1, "indexdir ok\n");
+}
+
 void
 subdir(void)
 {
@@ -1144,6 +1508,52 @@ bigwrite(void)
   printf(1, "bigwrite ok\n");
 }
 
+// a single write() much larger than a log transaction,
+// starting in the middle of a block.
+void
+hugewrite(void)
+{
+  int fd, i, sz;
+  char *p;
+
+  printf(1, "hugewrite test\n");
+
+  sz = 600*1024;
+  p = sbrk(sz);
+  if(p == (char*)-1){
+    printf(1, "hugewrite: sbrk failed\n");
+    exit();
+  }
+  for(i = 0; i < sz; i++)
+    p[i] = i % 251;
+
+  unlink("hugewrite");
+  fd = open("hugewrite", O_CREATE | O_RDWR);
+  if(fd < 0 || write(fd, "x", 1) != 1 || write(fd, p, sz) != sz){
+    printf(1, "hugewrite: write failed\n");
+    exit();
+  }
+  close(fd);
+
+  memset(p, 0, sz);
+  fd = open("hugewrite", O_RDONLY);
+  if(fd < 0 || read(fd, p, 1) != 1 || read(fd, p, sz) != sz){
+    printf(1, "hugewrite: read failed\n");
+    exit();
+  }
+  close(fd);
+  for(i = 0; i < sz; i++){
+    if(p[i] != (char)(i % 251)){
+      printf(1, "hugewrite: wrong data at %d\n", i);
+      exit();
+    }
+  }
+  unlink("hugewrite");
+  sbrk(-sz);
+
+  printf(1, "hugewrite ok\n");
+}
+
 void
 bigfile(void)
 {
@@ -1200,6 +1610,108 @@ bigfile(void)
   printf(1, "bigfile test ok\n");
 }
 
+// extent-mapped files, written in turns so that each
+// gets fragmented into more extents than fit in the inode.
+void
+extenttest(void)
+{
+  int fd[2], i, j, n;
+
+  printf(1, "extent test\n");
+
+  unlink("ext0");
+  unlink("ext1");
+  fd[0] = open("ext0", O_CREATE | O_EXTENT | O_RDWR);
+  fd[1] = open("ext1", O_CREATE | O_EXTENT | O_RDWR);
+  if(fd[0] < 0 || fd[1] < 0){
+    printf(1, "cannot create extent files\n");
+    exit();
+  }
+  for(i = 0; i < 3*NEXTENT; i++){
+    for(j = 0; j < 2; j++){
+      memset(buf, 'a' + i, 3*BSIZE);
+      buf[0] = j;
+      if(write(fd[j], buf, 3*BSIZE) != 3*BSIZE){
+        printf(1, "write extent file failed\n");
+        exit();
+      }
+    }
+  }
+  close(fd[0]);
+  close(fd[1]);
+
+  for(j = 0; j < 2; j++){
+    fd[j] = open(j ? "ext1" : "ext0", 0);
+    if(fd[j] < 0){
+      printf(1, "cannot open extent file\n");
+      exit();
+    }
+    for(i = 0; (n = read(fd[j], buf, 3*BSIZE)) > 0; i++){
+      if(n != 3*BSIZE || buf[0] != j || buf[1] != 'a' + i ||
+         buf[3*BSIZE-1] != 'a' + i){
+        printf(1, "read extent file wrong data\n");
+        exit();
+      }
+    }
+    if(n < 0 || i != 3*NEXTENT){
+      printf(1, "read extent file wrong total\n");
+      exit();
+    }
+    close(fd[j]);
+  }
+  unlink("ext0");
+  unlink("ext1");
+
+  printf(1, "extent test ok\n");
+}
+
+// write to two extent-mapped files a block at a time in turns,
+// so that every block of each is an extent of its own, until
+// one's extent map is full.  writes must then come up short
+// rather than panic the kernel.
+void
+extentfull(void)
+{
+  int fd[2], i, j, n;
+
+  printf(1, "extentfull test\n");
+
+  unlink("extf0");
+  unlink("extf1");
+  fd[0] = open("extf0", O_CREATE | O_EXTENT | O_RDWR);
+  fd[1] = open("extf1", O_CREATE | O_EXTENT | O_RDWR);
+  if(fd[0] < 0 || fd[1] < 0){
+    printf(1, "cannot create extent files\n");
+    exit();
+  }
+  memset(buf, 'x', BSIZE);
+  n = -1;
+  for(i = 0; i < 2*(NEXTENT + NIEXTENT) && n < 0; i++){
+    for(j = 0; j < 2; j++){
+      if(write(fd[j], buf, BSIZE) != BSIZE)
+        n = i;
+    }
+  }
+  if(n < 0){
+    printf(1, "extentfull: extent map never filled\n");
+    exit();
+  }
+  if(n < NEXTENT + NIEXTENT){
+    printf(1, "extentfull: extent map full after %d blocks\n", n);
+    exit();
+  }
+  if(write(fd[0], buf, BSIZE) == BSIZE && write(fd[1], buf, BSIZE) == BSIZE){
+    printf(1, "extentfull: write to a full extent map succeeded\n");
+    exit();
+  }
+  close(fd[0]);
+  close(fd[1]);
+  unlink("extf0");
+  unlink("extf1");
+
+  printf(1, "extentfull ok\n");
+}
+
 void
 fourteen(void)
 {
@@ -1339,6 +1851,89 @@ dirfile(void)
   printf(1, "dir vs file OK\n");
 }
 
+// test holding more inodes open at once than NINODE,
+// so that the inode cache has to grow
+void
+manyinodes(void)
+{
+  enum { NCHILD = 20, NOPEN = 12 };
+  int i, j, pid, fd, held[2], go[2], nfail;
+  char name[8], c;
+
+  printf(1, "manyinodes test\n");
+
+  if(mkdir("mi") != 0){
+    printf(1, "mkdir mi failed\n");
+    exit();
+  }
+  if(pipe(held) != 0 || pipe(go) != 0){
+    printf(1, "pipe failed\n");
+    exit();
+  }
+  name[0] = 'm';
+  name[1] = 'i';
+  name[2] = '/';
+  name[5] = '\0';
+  for(i = 0; i < NCHILD; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(1, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      close(held[0]);
+      close(go[1]);
+      close(0);
+      for(j = 0; j < NOPEN; j++){
+        name[3] = 'a' + i;
+        name[4] = 'a' + j;
+        if(open(name, O_CREATE|O_RDWR) < 0){
+          printf(1, "manyinodes: create %s failed\n", name);
+          write(held[1], "f", 1);
+          exit();
+        }
+      }
+      write(held[1], "x", 1);
+      read(go[0], &c, 1);
+      exit();
+    }
+  }
+  close(held[1]);
+  close(go[0]);
+  // Every child reports once, whether it holds its files or not.
+  nfail = 0;
+  for(i = 0; i < NCHILD; i++){
+    if(read(held[0], &c, 1) != 1 || c != 'x')
+      nfail++;
+  }
+  close(go[1]);
+  close(held[0]);
+  for(i = 0; i < NCHILD; i++)
+    wait();
+  if(nfail > 0){
+    printf(1, "manyinodes: %d children failed\n", nfail);
+    exit();
+  }
+
+  for(i = 0; i < NCHILD; i++){
+    for(j = 0; j < NOPEN; j++){
+      name[3] = 'a' + i;
+      name[4] = 'a' + j;
+      if((fd = open(name, 0)) < 0){
+        printf(1, "manyinodes: open %s failed\n", name);
+        exit();
+      }
+      close(fd);
+      unlink(name);
+    }
+  }
+  if(unlink("mi") != 0){
+    printf(1, "unlink mi failed\n");
+    exit();
+  }
+  printf(1, "manyinodes ok\n");
+}
+
 // test that iput() is called at the end of _namei()
 void
 iref(void)
@@ -1347,7 +1942,7 @@ iref(void)
 
   printf(1, "empty file name\n");
 
-  // the 50 is NINODE
+  // more than the old fixed NINODE of 50
   for(i = 0; i < 50 + 1; i++){
     if(mkdir("irefd") != 0){
       printf(1, "mkdir irefd failed\n");
@@ -1546,6 +2141,114 @@ sbrktest(void)
   printf(stdout, "sbrk test OK\n");
 }
 
+// does fork() give parent and child private copies of
+// copy-on-write pages, including when the kernel writes them?
+void
+cowtest(void)
+{
+  char *a;
+  int i, pid, ppid, fds[2];
+
+  printf(stdout, "cow test\n");
+  a = sbrk(8*4096);
+  for(i = 0; i < 8; i++)
+    a[i*4096] = 'p';
+  if(pipe(fds) != 0){
+    printf(stdout, "pipe() failed\n");
+    exit();
+  }
+  ppid = getpid();
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    for(i = 0; i < 8; i++){
+      if(a[i*4096] != 'p'){
+        printf(stdout, "cow test: child saw parent's write\n");
+        kill(ppid);
+        exit();
+      }
+      a[i*4096] = 'c';
+    }
+    // make the kernel write into a shared page
+    write(fds[1], "k", 1);
+    read(fds[0], a, 1);
+    if(a[0] != 'k'){
+      printf(stdout, "cow test: read into cow page failed\n");
+      kill(ppid);
+    }
+    exit();
+  }
+  a[0] = 'q';
+  wait();
+  close(fds[0]);
+  close(fds[1]);
+  if(a[0] != 'q'){
+    printf(stdout, "cow test: parent lost its write\n");
+    exit();
+  }
+  for(i = 1; i < 8; i++){
+    if(a[i*4096] != 'p'){
+      printf(stdout, "cow test: parent saw child's write\n");
+      exit();
+    }
+  }
+  sbrk(-8*4096);
+  printf(stdout, "cow test OK\n");
+}
+
+// does sbrk() defer allocation until pages are touched,
+// from user code, from the kernel, and across fork()?
+void
+lazytest(void)
+{
+  char *a;
+  int fd, pid;
+  uint sz = 64*1024*1024;
+
+  printf(stdout, "lazy test\n");
+  a = sbrk(sz);
+  if(a == (char*)0xffffffff){
+    printf(stdout, "lazy test: sbrk failed\n");
+    exit();
+  }
+  if(a[sz/2] != 0){
+    printf(stdout, "lazy test: page not zeroed\n");
+    exit();
+  }
+  a[sz-1] = 'x';
+
+  // kernel writes into an untouched page
+  fd = open("echo", 0);
+  if(fd < 0 || read(fd, a + sz/4, 4) != 4){
+    printf(stdout, "lazy test: read into lazy page failed\n");
+    exit();
+  }
+  close(fd);
+
+  // fork copies a mostly-unmapped address space
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    a[sz/8] = 'c';
+    if(a[sz-1] != 'x')
+      printf(stdout, "lazy test: child lost data\n");
+    exit();
+  }
+  wait();
+  if(a[sz/8] != 0){
+    printf(stdout, "lazy test: parent saw child's page\n");
+    exit();
+  }
+  sbrk(-sz);
+  printf(stdout, "lazy test OK\n");
+}
+
 void
 validateint(int *p)
 {
@@ -1760,14 +2463,19 @@ main(int argc, char *argv[])
   createdelete();
   linkunlink();
   concreate();
+  conlookup();
+  dcachetest();
   fourfiles();
   sharedfd();
 
   bigargtest();
   bigwrite();
+  hugewrite();
   bigargtest();
   bsstest();
   sbrktest();
+  cowtest();
+  lazytest();
   validatetest();
 
   opentest();
@@ -1781,19 +2489,26 @@ main(int argc, char *argv[])
 
   mem();
   pipe1();
+  pipesizetest();
+  splicetest();
+  copyrangetest();
   preempt();
   exitwait();
 
   rmdot();
   fourteen();
   bigfile();
+  extenttest();
+  extentfull();
   subdir();
   linktest();
   unlinkread();
   dirfile();
   iref();
+  manyinodes();
   forktest();
   bigdir(); // slow
+  indexdir();
 
   uio();
 
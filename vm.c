@@ -311,7 +311,9 @@ clearpteu(pde_t *pgdir, char *uva)
 }
 
 // Given a parent process's page table, create a copy
-// of it for a child.
+// of it for a child.  Writable user pages are not copied:
+// both page tables map them read-only with PTE_COW set,
+// and cowfault() copies a page when either side writes it.
 pde_t*
 copyuvm(pde_t *pgdir, uint sz)
 {
@@ -323,22 +325,126 @@ copyuvm(pde_t *pgdir, uint sz)
   if((d = setupkvm()) == 0)
     return 0;
   for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
+    // Skip heap pages that were never touched (see lazyfault).
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0){
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
     if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
+      continue;
     pa = PTE_ADDR(*pte);
     flags = PTE_FLAGS(*pte);
-    if((mem = kalloc()) == 0)
-      goto bad;
-    memmove(mem, (char*)P2V(pa), PGSIZE);
-    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0)
+    if(!(flags & PTE_U)){
+      // Not a user page (e.g., the stack guard page); copy it.
+      if((mem = kalloc()) == 0)
+        goto bad;
+      memmove(mem, (char*)P2V(pa), PGSIZE);
+      if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0){
+        kfree(mem);
+        goto bad;
+      }
+      continue;
+    }
+    if(flags & PTE_W){
+      flags = (flags & ~PTE_W) | PTE_COW;
+      *pte = pa | flags;
+    }
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
       goto bad;
+    kaddref(P2V(pa));
   }
+  // The parent's PTEs may have lost PTE_W; flush its TLB.
+  lcr3(V2P(pgdir));
   return d;
 
 bad:
   freevm(d);
+  lcr3(V2P(pgdir));
+  return 0;
+}
+
+// Handle a write fault at user virtual address va in pgdir.
+// If the page is copy-on-write, give this address space its own
+// writable copy (or just make it writable if no one else shares it).
+// Returns 0 if the fault was resolved, -1 if it was a real fault.
+int
+cowfault(pde_t *pgdir, uint va)
+{
+  pte_t *pte;
+  uint pa, flags;
+  char *mem;
+
+  if(va >= KERNBASE)
+    return -1;
+  if((pte = walkpgdir(pgdir, (void*)va, 0)) == 0)
+    return -1;
+  if((*pte & (PTE_P|PTE_U|PTE_COW)) != (PTE_P|PTE_U|PTE_COW))
+    return -1;
+  pa = PTE_ADDR(*pte);
+  flags = (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+  if(krefcnt(P2V(pa)) == 1){
+    // Last reference; no need to copy.
+    *pte = pa | flags;
+  } else {
+    if((mem = kalloc()) == 0){
+      cprintf("cowfault: out of memory\n");
+      return -1;
+    }
+    memmove(mem, (char*)P2V(pa), PGSIZE);
+    *pte = V2P(mem) | flags;
+    kfree(P2V(pa));
+  }
+  lcr3(V2P(pgdir));
+  return 0;
+}
+
+// Handle a fault at user virtual address va, below the process
+// size sz, whose page is not mapped.  sbrk() grows the heap
+// without allocating memory; the first touch of each page
+// lands here and maps a zeroed page.
+// Returns 0 if the fault was resolved, -1 if it was a real fault.
+int
+lazyfault(pde_t *pgdir, uint va, uint sz)
+{
+  char *mem;
+
+  if(va >= sz || va >= KERNBASE)
+    return -1;
+  va = PGROUNDDOWN(va);
+  if((mem = kalloc()) == 0){
+    cprintf("lazyfault: out of memory\n");
+    return -1;
+  }
+  memset(mem, 0, PGSIZE);
+  if(mappages(pgdir, (char*)va, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Map the lazily allocated pages among the len bytes of user
+// memory at va, all below the process size sz, and if write,
+// give the process its own copy of any copy-on-write pages, so
+// that the kernel can use them without faulting: a failed
+// lazyfault() or cowfault() in the kernel would be a panic.
+// Returns -1 if out of memory.
+int
+uvmtouch(pde_t *pgdir, uint va, uint len, uint sz, int write)
+{
+  pte_t *pte;
+  uint a;
+
+  for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(pte == 0 || (*pte & PTE_P) == 0){
+      if(lazyfault(pgdir, a, sz) < 0)
+        return -1;
+    } else if(write && (*pte & PTE_COW)){
+      if(cowfault(pgdir, a) < 0)
+        return -1;
+    }
+  }
   return 0;
 }
 
@@ -350,7 +456,7 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;